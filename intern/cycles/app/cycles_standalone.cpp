@@ -8,6 +8,7 @@
 #include "scene/integrator.h"
 #include "scene/scene.h"
 #include "session/buffers.h"
+#include "session/merge.h"
 #include "session/session.h"
 
 #include "util/args.h"
@@ -41,10 +42,12 @@ struct Options {
   Session *session;
   Scene *scene;
   string filepath;
+  vector<string> merge_filepaths;
   int width, height;
   SceneParams scene_params;
   SessionParams session_params;
   bool quiet;
+  bool merge;
   bool show_help, interactive, pause;
   string output_filepath;
   string output_pass;
@@ -136,8 +139,11 @@ static void session_init()
 #endif
 
   if (!options.output_filepath.empty()) {
-    options.session->set_output_driver(make_unique<OIIOOutputDriver>(
-        options.output_filepath, options.output_pass, session_print));
+    options.session->set_output_driver(
+        make_unique<OIIOOutputDriver>(options.output_filepath,
+                                      options.output_pass,
+                                      options.session_params.samples,
+                                      session_print));
   }
 
   if (options.session_params.background && !options.quiet)
@@ -159,6 +165,18 @@ static void session_init()
   options.session->start();
 }
 
+static void merge_images()
+{
+  ImageMerger merger;
+  merger.input = options.merge_filepaths;
+  merger.output = options.output_filepath;
+
+  if (!merger.run()) {
+    fprintf(stderr, "%s\n", merger.error.c_str());
+    exit(EXIT_FAILURE);
+  }
+}
+
 static void session_exit()
 {
   if (options.session) {
@@ -346,8 +364,10 @@ static void keyboard(unsigned char key)
 
 static int files_parse(int argc, const char *argv[])
 {
-  if (argc > 0)
+  if (argc > 0) {
     options.filepath = argv[0];
+    options.merge_filepaths.push_back(argv[0]);
+  }
 
   return 0;
 }
@@ -359,6 +379,7 @@ static void options_parse(int argc, const char **argv)
   options.filepath = "";
   options.session = NULL;
   options.quiet = false;
+  options.merge = false;
   options.session_params.use_auto_tile = false;
   options.session_params.tile_size = 0;
 
@@ -384,7 +405,8 @@ static void options_parse(int argc, const char **argv)
   bool help = false, profile = false, debug = false, version = false;
   int verbosity = 1;
 
-  ap.options("Usage: cycles [options] file.xml",
+  ap.options("Usage: cycles [options] file.xml\n"
+             "       cycles --merge --output merged.exr file1.exr file2.exr ...",
              "%*",
              files_parse,
              "",
@@ -405,6 +427,13 @@ static void options_parse(int argc, const char **argv)
              "--samples %d",
              &options.session_params.samples,
              "Number of samples to render",
+             "--sample-offset %d",
+             &options.session_params.sample_offset,
+             "Number of samples to skip, to render different samples of the same image on "
+             "multiple machines",
+             "--merge",
+             &options.merge,
+             "Merge renders of the same image with different sample offsets into the output file",
              "--output %s",
              &options.output_filepath,
              "File path to write output image",
@@ -474,6 +503,13 @@ static void options_parse(int argc, const char **argv)
     ap.usage();
     exit(EXIT_SUCCESS);
   }
+  else if (options.merge) {
+    if (options.output_filepath.empty()) {
+      fprintf(stderr, "No output file path specified for merging\n");
+      exit(EXIT_FAILURE);
+    }
+    return;
+  }
 
   options.session_params.use_profiling = profile;
 
@@ -520,6 +556,10 @@ static void options_parse(int argc, const char **argv)
     fprintf(stderr, "Invalid number of samples: %d\n", options.session_params.samples);
     exit(EXIT_FAILURE);
   }
+  else if (options.session_params.sample_offset < 0) {
+    fprintf(stderr, "Invalid sample offset: %d\n", options.session_params.sample_offset);
+    exit(EXIT_FAILURE);
+  }
   else if (options.filepath == "") {
     fprintf(stderr, "No file path specified\n");
     exit(EXIT_FAILURE);
@@ -536,6 +576,11 @@ int main(int argc, const char **argv)
   path_init();
   options_parse(argc, argv);
 
+  if (options.merge) {
+    merge_images();
+    return 0;
+  }
+
 #ifdef WITH_CYCLES_STANDALONE_GUI
   if (options.session_params.background) {
 #endif
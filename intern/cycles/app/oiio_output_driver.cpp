@@ -12,22 +12,66 @@ CCL_NAMESPACE_BEGIN
 
 OIIOOutputDriver::OIIOOutputDriver(const string_view filepath,
                                    const string_view pass,
+                                   const int samples,
                                    LogFunction log)
-    : filepath_(filepath), pass_(pass), log_(log)
+    : filepath_(filepath), pass_(pass), samples_(samples), log_(log)
 {
 }
 
 OIIOOutputDriver::~OIIOOutputDriver()
 {
+  /* Write what was rendered when tiled rendering did not finish, missing tiles are left black. */
+  if (!full_pixels_.empty()) {
+    write_image(full_layer_, full_size_.x, full_size_.y, full_pixels_);
+  }
 }
 
 void OIIOOutputDriver::write_render_tile(const Tile &tile)
 {
-  /* Only write the full buffer, no intermediate tiles. */
-  if (!(tile.size == tile.full_size)) {
+  const int width = tile.size.x;
+  const int height = tile.size.y;
+
+  vector<float> pixels(width * height * 4);
+  if (!tile.get_pass_pixels(pass_, 4, pixels.data())) {
+    log_("Failed to read render pass pixels");
     return;
   }
 
+  if (tile.size == tile.full_size) {
+    write_image(tile.layer, width, height, pixels);
+    return;
+  }
+
+  /* Copy the tile into the full image, both use bottom-up convention. */
+  const int full_width = tile.full_size.x;
+  const int full_height = tile.full_size.y;
+  if (full_pixels_.empty() || !(full_size_ == tile.full_size)) {
+    full_pixels_.clear();
+    full_pixels_.resize(size_t(full_width) * full_height * 4, 0.0f);
+    full_layer_ = tile.layer;
+    full_size_ = tile.full_size;
+    num_full_pixels_written_ = 0;
+  }
+
+  for (int y = 0; y < height; y++) {
+    const size_t full_offset = (size_t(tile.offset.y + y) * full_width + tile.offset.x) * 4;
+    memcpy(full_pixels_.data() + full_offset,
+           pixels.data() + size_t(y) * width * 4,
+           sizeof(float) * width * 4);
+  }
+  num_full_pixels_written_ += size_t(width) * height;
+
+  if (num_full_pixels_written_ >= size_t(full_width) * full_height) {
+    write_image(full_layer_, full_width, full_height, full_pixels_);
+    full_pixels_.free_memory();
+  }
+}
+
+void OIIOOutputDriver::write_image(const string &layer,
+                                   const int width,
+                                   const int height,
+                                   vector<float> &pixels)
+{
   log_(string_printf("Writing image %s", filepath_.c_str()));
 
   unique_ptr<ImageOutput> image_output(ImageOutput::create(filepath_));
@@ -36,24 +80,21 @@ void OIIOOutputDriver::write_render_tile(const Tile &tile)
     return;
   }
 
-  const int width = tile.size.x;
-  const int height = tile.size.y;
-
   ImageSpec spec(width, height, 4, TypeDesc::FLOAT);
+
+  /* Store the number of samples the same way as Blender does, so that renders of the same image
+   * with different sample offsets can be merged. */
+  const string layer_name = layer.empty() ? "RenderLayer" : layer;
+  spec.attribute("cycles." + layer_name + ".samples", TypeDesc::STRING, to_string(samples_));
+
   if (!image_output->open(filepath_, spec)) {
     log_("Failed to create image file");
     return;
   }
 
-  vector<float> pixels(width * height * 4);
-  if (!tile.get_pass_pixels(pass_, 4, pixels.data())) {
-    log_("Failed to read render pass pixels");
-    return;
-  }
-
   /* Manipulate offset and stride to convert from bottom-up to top-down convention. */
   ImageBuf image_buffer(spec,
-                        pixels.data() + (height - 1) * width * 4,
+                        pixels.data() + size_t(height - 1) * width * 4,
                         AutoStride,
                         -width * 4 * sizeof(float),
                         AutoStride);
@@ -15,15 +15,28 @@ class OIIOOutputDriver : public OutputDriver {
  public:
   typedef function<void(const string &)> LogFunction;
 
-  OIIOOutputDriver(const string_view filepath, const string_view pass, LogFunction log);
+  OIIOOutputDriver(const string_view filepath,
+                   const string_view pass,
+                   const int samples,
+                   LogFunction log);
   virtual ~OIIOOutputDriver();
 
   void write_render_tile(const Tile &tile) override;
 
  protected:
+  void write_image(const string &layer, const int width, const int height, vector<float> &pixels);
+
   string filepath_;
   string pass_;
+  int samples_;
   LogFunction log_;
+
+  /* With tiled rendering, tiles are written as soon as they are finished. Only the pass which is
+   * saved to the file is kept here, until all pixels of the image have been received. */
+  vector<float> full_pixels_;
+  string full_layer_;
+  int2 full_size_ = zero_int2();
+  size_t num_full_pixels_written_ = 0;
 };
 
 CCL_NAMESPACE_END
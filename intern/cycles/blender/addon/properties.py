@@ -347,6 +347,13 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         items=enum_denoising_input_passes,
         default='RGB_ALBEDO_NORMAL',
     )
+    denoising_max_memory: IntProperty(
+        name="Denoising Max Memory",
+        description="Maximum amount of memory in megabytes the denoiser is allowed to use, "
+        "larger images are denoised in overlapping parts. Zero means no limit",
+        min=0,
+        default=0,
+    )
 
     use_preview_denoising: BoolProperty(
         name="Use Viewport Denoising",
@@ -959,6 +966,12 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         items=enum_bvh_layouts,
         default='EMBREE',
     )
+    debug_use_cpu_sort_paths: BoolProperty(
+        name="Sort Paths",
+        description="Render batches of pixels with their paths sorted by shader, which can be faster "
+        "in scenes with many different materials",
+        default=False,
+    )
 
     debug_use_cuda_adaptive_compile: BoolProperty(name="Adaptive Compile", default=False)
 
@@ -23,6 +23,7 @@
 #include "util/hash.h"
 #include "util/log.h"
 #include "util/math.h"
+#include "util/tbb.h"
 
 #include "mikktspace.hh"
 
@@ -940,10 +941,27 @@ static void create_mesh(Scene *scene,
 
   mesh->reserve_mesh(numverts, numtris);
 
+  /* Parallel copies of per-vertex and per-triangle data, with a grain size to avoid too much
+   * threading overhead for small meshes. */
+  static const int ELEMENTS_PER_TASK = 4096;
+
   /* create vertex coordinates and normals */
-  for (int i = 0; i < numverts; i++) {
-    const MVert &b_vert = verts[i];
-    mesh->add_vertex(make_float3(b_vert.co[0], b_vert.co[1], b_vert.co[2]));
+  if (!subdivision) {
+    array<float3> P(numverts);
+    parallel_for(blocked_range<size_t>(0, numverts, ELEMENTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const MVert &b_vert = verts[i];
+                     P[i] = make_float3(b_vert.co[0], b_vert.co[1], b_vert.co[2]);
+                   }
+                 });
+    mesh->set_verts(P);
+  }
+  else {
+    for (int i = 0; i < numverts; i++) {
+      const MVert &b_vert = verts[i];
+      mesh->add_vertex(make_float3(b_vert.co[0], b_vert.co[1], b_vert.co[2]));
+    }
   }
 
   AttributeSet &attributes = (subdivision) ? mesh->subd_attributes : mesh->attributes;
@@ -953,10 +971,13 @@ static void create_mesh(Scene *scene,
   if (subdivision || !use_loop_normals) {
     const float(*b_vert_normals)[3] = static_cast<const float(*)[3]>(
         b_mesh.vertex_normals[0].ptr.data);
-    for (int i = 0; i < numverts; i++) {
-      const float *b_vert_normal = b_vert_normals[i];
-      N[i] = make_float3(b_vert_normal[0], b_vert_normal[1], b_vert_normal[2]);
-    }
+    parallel_for(blocked_range<size_t>(0, numverts, ELEMENTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const float *b_vert_normal = b_vert_normals[i];
+                     N[i] = make_float3(b_vert_normal[0], b_vert_normal[1], b_vert_normal[2]);
+                   }
+                 });
   }
 
   /* create generated coordinates from undeformed coordinates */
@@ -989,27 +1010,51 @@ static void create_mesh(Scene *scene,
   /* create faces */
   const MPoly *polys = static_cast<const MPoly *>(b_mesh.polygons[0].ptr.data);
   if (!subdivision) {
-    for (BL::MeshLoopTriangle &t : b_mesh.loop_triangles) {
-      const int poly_index = t.polygon_index();
-      const MPoly &b_poly = polys[poly_index];
-      int3 vi = get_int3(t.vertices());
-
-      int shader = get_material_index(poly_index);
-      bool smooth = (b_poly.flag & ME_SMOOTH) || use_loop_normals;
-
-      if (use_loop_normals) {
+    const MLoopTri *looptris = static_cast<const MLoopTri *>(b_mesh.loop_triangles[0].ptr.data);
+    const MLoop *loops = static_cast<const MLoop *>(b_mesh.loops[0].ptr.data);
+    const int *material_index_data = (material_indices) ?
+                                         static_cast<const int *>(
+                                             material_indices->data[0].ptr.data) :
+                                         nullptr;
+    const int max_shader = used_shaders.size() - 1;
+
+    /* Create triangles, reading the Blender arrays directly instead of going through RNA for
+     * every triangle, so they can be filled in parallel.
+     *
+     * NOTE: Autosmooth is already taken care about.
+     */
+    array<int> triangles(numtris * 3);
+    array<int> shader(numtris);
+    array<bool> smooth(numtris);
+    parallel_for(blocked_range<size_t>(0, numtris, ELEMENTS_PER_TASK),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     const MLoopTri &looptri = looptris[i];
+                     const int poly_index = looptri.poly;
+                     for (int j = 0; j < 3; j++) {
+                       triangles[i * 3 + j] = loops[looptri.tri[j]].v;
+                     }
+                     shader[i] = (material_index_data) ?
+                                     clamp(material_index_data[poly_index], 0, max_shader) :
+                                     0;
+                     smooth[i] = (polys[poly_index].flag & ME_SMOOTH) || use_loop_normals;
+                   }
+                 });
+    mesh->set_triangles(triangles);
+    mesh->set_shader(shader);
+    mesh->set_smooth(smooth);
+
+    /* Split normals are written per vertex, the last triangle using a vertex wins, so keep the
+     * original order. */
+    if (use_loop_normals) {
+      for (BL::MeshLoopTriangle &t : b_mesh.loop_triangles) {
+        int3 vi = get_int3(t.vertices());
         BL::Array<float, 9> loop_normals = t.split_normals();
         for (int i = 0; i < 3; i++) {
           N[vi[i]] = make_float3(
               loop_normals[i * 3], loop_normals[i * 3 + 1], loop_normals[i * 3 + 2]);
         }
       }
-
-      /* Create triangles.
-       *
-       * NOTE: Autosmooth is already taken care about.
-       */
-      mesh->add_triangle(vi[0], vi[1], vi[2], shader, smooth);
     }
   }
   else {
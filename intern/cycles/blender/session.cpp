@@ -328,6 +328,24 @@ void BlenderSession::stamp_view_layer_metadata(Scene *scene, const string &view_
                             time_human_readable_from_seconds(total_time - render_time).c_str());
 }
 
+void BlenderSession::stamp_kernel_stats_metadata(const RenderStats &stats,
+                                                 const string &view_layer_name)
+{
+  if (!stats.has_device_profiling) {
+    return;
+  }
+
+  BL::RenderResult b_rr = b_engine.get_result();
+  const string prefix = "cycles." + view_layer_name + ".kernel.";
+
+  foreach (const NamedKernelEntry &entry, stats.device_kernels.entries) {
+    b_rr.stamp_data_add_field((prefix + entry.name + ".time").c_str(),
+                              string_printf("%f", entry.time).c_str());
+    b_rr.stamp_data_add_field((prefix + entry.name + ".work_size").c_str(),
+                              to_string(entry.work_size).c_str());
+  }
+}
+
 void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
 {
   b_depsgraph = b_depsgraph_;
@@ -442,6 +460,7 @@ void BlenderSession::render(BL::Depsgraph &b_depsgraph_)
       RenderStats stats;
       session->collect_statistics(&stats);
       printf("Render statistics:\n%s\n", stats.full_report().c_str());
+      stamp_kernel_stats_metadata(stats, b_rlay_name);
     }
 
     if (session->progress.get_cancel())
@@ -21,6 +21,7 @@ CCL_NAMESPACE_BEGIN
 class BlenderDisplayDriver;
 class BlenderSync;
 class ImageMetaData;
+class RenderStats;
 class Scene;
 class Session;
 
@@ -122,6 +123,10 @@ class BlenderSession {
  protected:
   void stamp_view_layer_metadata(Scene *scene, const string &view_layer_name);
 
+  /* Store execution statistics of the device kernels in the render result metadata, so that they
+   * are available to scripts and in the saved images. */
+  void stamp_kernel_stats_metadata(const RenderStats &stats, const string &view_layer_name);
+
   /* Check whether session error happened.
    * If so, it is reported to the render engine and true is returned.
    * Otherwise false is returned. */
@@ -1509,6 +1509,35 @@ void BlenderSync::resolve_view_layer_attributes(Shader *shader,
   }
 }
 
+/* Remember which shaders use image sequences or movies, so that only those are synced again when
+ * the frame changes. */
+void BlenderSync::tag_animated_images(Shader *shader, ShaderGraph *graph)
+{
+  bool animated = false;
+
+  foreach (ShaderNode *node, graph->nodes) {
+    if (node->is_a(ImageTextureNode::node_type)) {
+      animated |= static_cast<ImageTextureNode *>(node)->get_animated();
+    }
+    else if (node->is_a(EnvironmentTextureNode::node_type)) {
+      animated |= static_cast<EnvironmentTextureNode *>(node)->get_animated();
+    }
+  }
+
+  if (animated) {
+    shader_map.set_flag(shader, SHADER_WITH_ANIMATED_IMAGES);
+  }
+  else {
+    shader_map.clear_flag(shader, SHADER_WITH_ANIMATED_IMAGES);
+  }
+}
+
+bool BlenderSync::animated_images_need_recalc(Shader *shader, bool auto_refresh_update)
+{
+  return auto_refresh_update && shader &&
+         shader_map.test_flag(shader, SHADER_WITH_ANIMATED_IMAGES);
+}
+
 bool BlenderSync::scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsgraph)
 {
   if (shader && shader_map.test_flag(shader, SHADER_WITH_LAYER_ATTRS)) {
@@ -1523,7 +1552,7 @@ bool BlenderSync::scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsg
 
 /* Sync Materials */
 
-void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
+void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_surface);
 
@@ -1539,7 +1568,8 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_mat) || update_all ||
+    if (shader_map.add_or_update(&shader, b_mat) ||
+        animated_images_need_recalc(shader, auto_refresh_update) ||
         scene_attr_needs_recalc(shader, b_depsgraph)) {
       ShaderGraph *graph = new ShaderGraph();
 
@@ -1562,6 +1592,7 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
       }
 
       resolve_view_layer_attributes(shader, graph, b_depsgraph);
+      tag_animated_images(shader, graph);
 
       /* settings */
       PointerRNA cmat = RNA_pointer_get(&b_mat.ptr, "cycles");
@@ -1609,7 +1640,9 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
 
 /* Sync World */
 
-void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph,
+                             BL::SpaceView3D &b_v3d,
+                             bool auto_refresh_update)
 {
   Background *background = scene->background;
   Integrator *integrator = scene->integrator;
@@ -1621,7 +1654,8 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
   Shader *shader = scene->default_background;
 
-  if (world_recalc || update_all || b_world.ptr.data != world_map ||
+  if (world_recalc || animated_images_need_recalc(shader, auto_refresh_update) ||
+      b_world.ptr.data != world_map ||
       viewport_parameters.shader_modified(new_viewport_parameters) ||
       scene_attr_needs_recalc(shader, b_depsgraph)) {
     ShaderGraph *graph = new ShaderGraph();
@@ -1722,6 +1756,7 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
     }
 
     resolve_view_layer_attributes(shader, graph, b_depsgraph);
+    tag_animated_images(shader, graph);
 
     shader->set_graph(graph);
     shader->tag_update(scene);
@@ -1776,7 +1811,7 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
 /* Sync Lights */
 
-void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
+void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_light);
 
@@ -1789,7 +1824,8 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_light) || update_all ||
+    if (shader_map.add_or_update(&shader, b_light) ||
+        animated_images_need_recalc(shader, auto_refresh_update) ||
         scene_attr_needs_recalc(shader, b_depsgraph)) {
       ShaderGraph *graph = new ShaderGraph();
 
@@ -1812,6 +1848,7 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
       }
 
       resolve_view_layer_attributes(shader, graph, b_depsgraph);
+      tag_animated_images(shader, graph);
 
       shader->set_graph(graph);
       shader->tag_update(scene);
@@ -1819,13 +1856,15 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
   }
 }
 
-void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph,
+                               BL::SpaceView3D &b_v3d,
+                               bool auto_refresh_update)
 {
   shader_map.pre_sync();
 
-  sync_world(b_depsgraph, b_v3d, update_all);
-  sync_lights(b_depsgraph, update_all);
-  sync_materials(b_depsgraph, update_all);
+  sync_world(b_depsgraph, b_v3d, auto_refresh_update);
+  sync_lights(b_depsgraph, auto_refresh_update);
+  sync_materials(b_depsgraph, auto_refresh_update);
 }
 
 CCL_NAMESPACE_END
@@ -101,8 +101,8 @@ class BlenderSync {
 
  private:
   /* sync */
-  void sync_lights(BL::Depsgraph &b_depsgraph, bool update_all);
-  void sync_materials(BL::Depsgraph &b_depsgraph, bool update_all);
+  void sync_lights(BL::Depsgraph &b_depsgraph, bool auto_refresh_update);
+  void sync_materials(BL::Depsgraph &b_depsgraph, bool auto_refresh_update);
   void sync_objects(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, float motion_time = 0.0f);
   void sync_motion(BL::RenderSettings &b_render,
                    BL::Depsgraph &b_depsgraph,
@@ -116,11 +116,15 @@ class BlenderSync {
 
   /* Shader */
   array<Node *> find_used_shaders(BL::Object &b_ob);
-  void sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all);
-  void sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all);
+  void sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool auto_refresh_update);
+  void sync_shaders(BL::Depsgraph &b_depsgraph,
+                    BL::SpaceView3D &b_v3d,
+                    bool auto_refresh_update);
   void sync_nodes(Shader *shader, BL::ShaderNodeTree &b_ntree);
 
   bool scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsgraph);
+  void tag_animated_images(Shader *shader, ShaderGraph *graph);
+  bool animated_images_need_recalc(Shader *shader, bool auto_refresh_update);
   void resolve_view_layer_attributes(Shader *shader,
                                      ShaderGraph *graph,
                                      BL::Depsgraph &b_depsgraph);
@@ -219,7 +223,7 @@ class BlenderSync {
   BL::BlendData b_data;
   BL::Scene b_scene;
 
-  enum ShaderFlags { SHADER_WITH_LAYER_ATTRS };
+  enum ShaderFlags { SHADER_WITH_LAYER_ATTRS, SHADER_WITH_ANIMATED_IMAGES };
 
   id_map<void *, Shader, ShaderFlags> shader_map;
   id_map<ObjectKey, Object> object_map;
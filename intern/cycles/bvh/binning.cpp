@@ -10,6 +10,8 @@
 
 #include "util/algorithm.h"
 #include "util/boundbox.h"
+#include "util/tbb.h"
+#include "util/thread.h"
 #include "util/types.h"
 
 CCL_NAMESPACE_BEGIN
@@ -92,64 +94,51 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
     bin_bounds[i][0] = bin_bounds[i][1] = bin_bounds[i][2] = BoundBox::empty;
   }
 
-  /* map geometry to bins, unrolled once */
-  {
-    int64_t i;
-
-    for (i = 0; i < int64_t(size()) - 1; i += 2) {
-      prefetch_L2(&prims[start() + i + 8]);
-
-      /* map even and odd primitive to bin */
-      const BVHReference &prim0 = prims[start() + i + 0];
-      const BVHReference &prim1 = prims[start() + i + 1];
-
-      BoundBox bounds0 = get_prim_bounds(prim0);
-      BoundBox bounds1 = get_prim_bounds(prim1);
-
-      int4 bin0 = get_bin(bounds0);
-      int4 bin1 = get_bin(bounds1);
-
-      /* increase bounds for bins for even primitive */
-      int b00 = (int)extract<0>(bin0);
-      bin_count[b00][0]++;
-      bin_bounds[b00][0].grow(bounds0);
-      int b01 = (int)extract<1>(bin0);
-      bin_count[b01][1]++;
-      bin_bounds[b01][1].grow(bounds0);
-      int b02 = (int)extract<2>(bin0);
-      bin_count[b02][2]++;
-      bin_bounds[b02][2].grow(bounds0);
-
-      /* increase bounds of bins for odd primitive */
-      int b10 = (int)extract<0>(bin1);
-      bin_count[b10][0]++;
-      bin_bounds[b10][0].grow(bounds1);
-      int b11 = (int)extract<1>(bin1);
-      bin_count[b11][1]++;
-      bin_bounds[b11][1].grow(bounds1);
-      int b12 = (int)extract<2>(bin1);
-      bin_count[b12][2]++;
-      bin_bounds[b12][2].grow(bounds1);
+  /* map geometry to bins */
+  auto bin_prims = [&](const size_t begin,
+                       const size_t end,
+                       BoundBox (*r_bin_bounds)[4],
+                       int4 *r_bin_count) {
+    for (size_t i = begin; i < end; i++) {
+      const BoundBox prim_bounds = get_prim_bounds(prims[i]);
+      const int4 bin = get_bin(prim_bounds);
+
+      for (int dim = 0; dim < 3; dim++) {
+        r_bin_count[bin[dim]][dim]++;
+        r_bin_bounds[bin[dim]][dim].grow(prim_bounds);
+      }
     }
+  };
 
-    /* for uneven number of primitives */
-    if (i < int64_t(size())) {
-      /* map primitive to bin */
-      const BVHReference &prim0 = prims[start() + i];
-      BoundBox bounds0 = get_prim_bounds(prim0);
-      int4 bin0 = get_bin(bounds0);
-
-      /* increase bounds of bins */
-      int b00 = (int)extract<0>(bin0);
-      bin_count[b00][0]++;
-      bin_bounds[b00][0].grow(bounds0);
-      int b01 = (int)extract<1>(bin0);
-      bin_count[b01][1]++;
-      bin_bounds[b01][1].grow(bounds0);
-      int b02 = (int)extract<2>(bin0);
-      bin_count[b02][2]++;
-      bin_bounds[b02][2].grow(bounds0);
-    }
+  if (size() < PARALLEL_BINNING_SIZE) {
+    bin_prims(start(), end(), bin_bounds, bin_count);
+  }
+  else {
+    /* The top levels of the tree are built before there are enough nodes to keep all threads
+     * busy, so bin large ranges in parallel. Every task bins into its own counters which are
+     * merged afterwards, the result is the same as with serial binning. */
+    thread_mutex bin_mutex;
+    parallel_for(blocked_range<size_t>(start(), end(), PARALLEL_BINNING_GRAIN_SIZE),
+                 [&](const blocked_range<size_t> &r) {
+                   BoundBox local_bin_bounds[MAX_BINS][4];
+                   int4 local_bin_count[MAX_BINS];
+
+                   for (size_t i = 0; i < num_bins; i++) {
+                     local_bin_count[i] = make_int4(0);
+                     local_bin_bounds[i][0] = local_bin_bounds[i][1] = local_bin_bounds[i][2] =
+                         BoundBox::empty;
+                   }
+
+                   bin_prims(r.begin(), r.end(), local_bin_bounds, local_bin_count);
+
+                   thread_scoped_lock lock(bin_mutex);
+                   for (size_t i = 0; i < num_bins; i++) {
+                     bin_count[i] = bin_count[i] + local_bin_count[i];
+                     for (int dim = 0; dim < 3; dim++) {
+                       bin_bounds[i][dim].grow(local_bin_bounds[i][dim]);
+                     }
+                   }
+                 });
   }
 
   /* sweep from right to left and compute parallel prefix of merged bounds */
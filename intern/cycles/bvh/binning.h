@@ -14,7 +14,7 @@ CCL_NAMESPACE_BEGIN
 
 class BVHBuild;
 
-/* Single threaded object binner. Finds the split with the best SAH heuristic
+/* Object binner. Finds the split with the best SAH heuristic
  * by testing for each dimension multiple partitionings for regular spaced
  * partition locations. A partitioning for a partition location is computed,
  * by putting primitives whose centroid is on the left and right of the split
@@ -56,6 +56,8 @@ class BVHObjectBinning : public BVHRange {
   const Transform *aligned_space_;
 
   enum { MAX_BINS = 32 };
+  /* Ranges with at least this many primitives are binned by multiple threads. */
+  enum { PARALLEL_BINNING_SIZE = 65536, PARALLEL_BINNING_GRAIN_SIZE = 16384 };
   enum { LOG_BLOCK_SIZE = 2 };
 
   /* computes the bin numbers for each dimension for a box. */
@@ -149,6 +149,75 @@ void BVH2::pack_aligned_inner(const BVHStackEntry &e,
                     e1.node->visibility);
 }
 
+/* Aligned nodes store the bounds of their children with 8 bits per value, relative to the union
+ * of both children. Every axis has its own origin and power of two scale, and the rounding is done
+ * such that the decoded bounds always contain the original bounds.
+ *
+ * Coordinates are clamped to this range, so that decoding can never overflow. */
+static const float BVH_QUANTIZE_MAX = 1.6e38f;
+/* Largest exponent for which 255 steps still fit in the float range. */
+static const int BVH_QUANTIZE_MAX_EXPONENT = 120;
+
+static float bvh_dequantize(const float origin, const float scale, const int q)
+{
+  /* Must match bvh_aligned_node_dequantize() in the kernel, `q * scale` is exact. */
+  return origin + (float)q * scale;
+}
+
+static int bvh_quantize_lower(const float origin, const float scale, const float value)
+{
+  int q = clamp((int)floorf((value - origin) / scale), 0, 255);
+  while (q > 0 && bvh_dequantize(origin, scale, q) > value) {
+    q--;
+  }
+  return q;
+}
+
+static int bvh_quantize_upper(const float origin, const float scale, const float value)
+{
+  int q = clamp((int)ceilf((value - origin) / scale), 0, 255);
+  while (q < 255 && bvh_dequantize(origin, scale, q) < value) {
+    q++;
+  }
+  return (bvh_dequantize(origin, scale, q) >= value) ? q : -1;
+}
+
+/* Quantize the bounds of both children along one axis. The result is packed in the same order as
+ * the full precision bounds were: min0, min1, max0, max1. */
+static uint bvh_quantize_axis(
+    float min0, float min1, float max0, float max1, float &r_origin, uint &r_exponent)
+{
+  /* NaN is clamped as well. */
+  min0 = (min0 >= -BVH_QUANTIZE_MAX) ? min(min0, BVH_QUANTIZE_MAX) : -BVH_QUANTIZE_MAX;
+  min1 = (min1 >= -BVH_QUANTIZE_MAX) ? min(min1, BVH_QUANTIZE_MAX) : -BVH_QUANTIZE_MAX;
+  max0 = (max0 <= BVH_QUANTIZE_MAX) ? max(max0, -BVH_QUANTIZE_MAX) : BVH_QUANTIZE_MAX;
+  max1 = (max1 <= BVH_QUANTIZE_MAX) ? max(max1, -BVH_QUANTIZE_MAX) : BVH_QUANTIZE_MAX;
+
+  const float origin = min(min0, min1);
+  const float extent = max(max(max0, max1) - origin, 0.0f);
+
+  int exponent;
+  frexpf(extent / 255.0f, &exponent);
+  exponent = clamp(exponent, -126, BVH_QUANTIZE_MAX_EXPONENT);
+
+  for (;; exponent++) {
+    const float scale = ldexpf(1.0f, exponent);
+    const int q_max0 = bvh_quantize_upper(origin, scale, max0);
+    const int q_max1 = bvh_quantize_upper(origin, scale, max1);
+    if ((q_max0 == -1 || q_max1 == -1) && exponent < BVH_QUANTIZE_MAX_EXPONENT) {
+      continue;
+    }
+    assert(q_max0 != -1 && q_max1 != -1);
+
+    const int q_min0 = bvh_quantize_lower(origin, scale, min0);
+    const int q_min1 = bvh_quantize_lower(origin, scale, min1);
+
+    r_origin = origin;
+    r_exponent = (uint)(exponent + 127);
+    return (uint)q_min0 | ((uint)q_min1 << 8) | ((uint)q_max0 << 16) | ((uint)q_max1 << 24);
+  }
+}
+
 void BVH2::pack_aligned_node(int idx,
                              const BoundBox &b0,
                              const BoundBox &b1,
@@ -161,21 +230,23 @@ void BVH2::pack_aligned_node(int idx,
   assert(c0 < 0 || c0 < pack.nodes.size());
   assert(c1 < 0 || c1 < pack.nodes.size());
 
+  float3 origin;
+  uint exponent_x, exponent_y, exponent_z;
+  const uint bounds_x = bvh_quantize_axis(
+      b0.min.x, b1.min.x, b0.max.x, b1.max.x, origin.x, exponent_x);
+  const uint bounds_y = bvh_quantize_axis(
+      b0.min.y, b1.min.y, b0.max.y, b1.max.y, origin.y, exponent_y);
+  const uint bounds_z = bvh_quantize_axis(
+      b0.min.z, b1.min.z, b0.max.z, b1.max.z, origin.z, exponent_z);
+
   int4 data[BVH_NODE_SIZE] = {
       make_int4(
           visibility0 & ~PATH_RAY_NODE_UNALIGNED, visibility1 & ~PATH_RAY_NODE_UNALIGNED, c0, c1),
-      make_int4(__float_as_int(b0.min.x),
-                __float_as_int(b1.min.x),
-                __float_as_int(b0.max.x),
-                __float_as_int(b1.max.x)),
-      make_int4(__float_as_int(b0.min.y),
-                __float_as_int(b1.min.y),
-                __float_as_int(b0.max.y),
-                __float_as_int(b1.max.y)),
-      make_int4(__float_as_int(b0.min.z),
-                __float_as_int(b1.min.z),
-                __float_as_int(b0.max.z),
-                __float_as_int(b1.max.z)),
+      make_int4(__float_as_int(origin.x),
+                __float_as_int(origin.y),
+                __float_as_int(origin.z),
+                (int)(exponent_x | (exponent_y << 8) | (exponent_z << 16))),
+      make_int4((int)bounds_x, (int)bounds_y, (int)bounds_z, 0),
   };
 
   memcpy(&pack.nodes[idx], data, sizeof(int4) * BVH_NODE_SIZE);
@@ -13,7 +13,8 @@
 
 CCL_NAMESPACE_BEGIN
 
-#define BVH_NODE_SIZE 4
+/* Aligned inner node: child indices and visibility, followed by quantized child bounds. */
+#define BVH_NODE_SIZE 3
 #define BVH_NODE_LEAF_SIZE 1
 #define BVH_UNALIGNED_NODE_SIZE 7
 
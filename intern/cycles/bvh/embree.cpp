@@ -135,8 +135,10 @@ void BVHEmbree::build(Progress &progress, Stats *stats, RTCDevice rtc_device_)
                                                         RTC_BUILD_QUALITY_MEDIUM);
   rtcSetSceneBuildQuality(scene, build_quality);
 
+  object_types.resize(objects.size());
   int i = 0;
   foreach (Object *ob, objects) {
+    object_types[i] = object_type(ob);
     if (params.top_level) {
       if (!ob->is_traceable()) {
         ++i;
@@ -165,6 +167,46 @@ void BVHEmbree::build(Progress &progress, Stats *stats, RTCDevice rtc_device_)
   rtcCommitScene(scene);
 }
 
+BVHEmbree::ObjectType BVHEmbree::object_type(const Object *ob) const
+{
+  if (params.top_level) {
+    if (!ob->is_traceable()) {
+      return OBJECT_NONE;
+    }
+    if (ob->get_geometry()->is_instanced()) {
+      return OBJECT_INSTANCE;
+    }
+  }
+
+  const Geometry *geom = ob->get_geometry();
+  if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
+    return (static_cast<const Mesh *>(geom)->num_triangles() > 0) ? OBJECT_GEOMETRY :
+                                                                     OBJECT_NONE;
+  }
+  if (geom->geometry_type == Geometry::HAIR) {
+    return (static_cast<const Hair *>(geom)->num_curves() > 0) ? OBJECT_GEOMETRY : OBJECT_NONE;
+  }
+  if (geom->geometry_type == Geometry::POINTCLOUD) {
+    return (static_cast<const PointCloud *>(geom)->num_points() > 0) ? OBJECT_GEOMETRY :
+                                                                       OBJECT_NONE;
+  }
+  return OBJECT_NONE;
+}
+
+bool BVHEmbree::can_refit() const
+{
+  if (!scene || object_types.size() != objects.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < objects.size(); i++) {
+    if (object_types[i] != object_type(objects[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void BVHEmbree::add_object(Object *ob, int i)
 {
   Geometry *geom = ob->get_geometry();
@@ -190,6 +232,15 @@ void BVHEmbree::add_object(Object *ob, int i)
 }
 
 void BVHEmbree::add_instance(Object *ob, int i)
+{
+  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
+  set_instance(geom_id, ob);
+  rtcCommitGeometry(geom_id);
+  rtcAttachGeometryByID(scene, geom_id, i * 2);
+  rtcReleaseGeometry(geom_id);
+}
+
+void BVHEmbree::set_instance(RTCGeometry geom_id, const Object *ob)
 {
   BVHEmbree *instance_bvh = (BVHEmbree *)(ob->get_geometry()->bvh);
   assert(instance_bvh != NULL);
@@ -198,7 +249,8 @@ void BVHEmbree::add_instance(Object *ob, int i)
   const size_t num_motion_steps = min(num_object_motion_steps, (size_t)RTC_MAX_TIME_STEP_COUNT);
   assert(num_object_motion_steps <= RTC_MAX_TIME_STEP_COUNT);
 
-  RTCGeometry geom_id = rtcNewGeometry(rtc_device, RTC_GEOMETRY_TYPE_INSTANCE);
+  /* The instanced scene is set again on refit, since it is recreated when the BVH of the
+   * geometry is rebuilt. */
   rtcSetGeometryInstancedScene(geom_id, instance_bvh->scene);
   rtcSetGeometryTimeStepCount(geom_id, num_motion_steps);
 
@@ -226,10 +278,6 @@ void BVHEmbree::add_instance(Object *ob, int i)
 
   rtcSetGeometryUserData(geom_id, (void *)instance_bvh->scene);
   rtcSetGeometryMask(geom_id, ob->visibility_for_tracing());
-
-  rtcCommitGeometry(geom_id);
-  rtcAttachGeometryByID(scene, geom_id, i * 2);
-  rtcReleaseGeometry(geom_id);
 }
 
 void BVHEmbree::add_triangles(const Object *ob, const Mesh *mesh, int i)
@@ -588,6 +636,12 @@ void BVHEmbree::refit(Progress &progress)
         }
       }
     }
+    else if (ob->is_traceable()) {
+      /* Instances may have moved, and their instanced scene may have been rebuilt. */
+      RTCGeometry geom = rtcGetGeometry(scene, geom_id);
+      set_instance(geom, ob);
+      rtcCommitGeometry(geom);
+    }
     geom_id += 2;
   }
 
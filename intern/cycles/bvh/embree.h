@@ -26,6 +26,9 @@ class BVHEmbree : public BVH {
  public:
   void build(Progress &progress, Stats *stats, RTCDevice rtc_device);
   void refit(Progress &progress);
+  /* Whether the objects would be added to the scene in the same way as in the last build, so that
+   * refit() can update the existing Embree geometry instead of building the scene again. */
+  bool can_refit() const;
 
   RTCScene scene;
 
@@ -38,6 +41,7 @@ class BVHEmbree : public BVH {
 
   void add_object(Object *ob, int i);
   void add_instance(Object *ob, int i);
+  void set_instance(RTCGeometry geom_id, const Object *ob);
   void add_curves(const Object *ob, const Hair *hair, int i);
   void add_points(const Object *ob, const PointCloud *pointcloud, int i);
   void add_triangles(const Object *ob, const Mesh *mesh, int i);
@@ -49,8 +53,14 @@ class BVHEmbree : public BVH {
                                const PointCloud *pointcloud,
                                const bool update);
 
+  /* How an object is represented in the Embree scene. */
+  enum ObjectType : char { OBJECT_NONE, OBJECT_GEOMETRY, OBJECT_INSTANCE };
+  ObjectType object_type(const Object *ob) const;
+
   RTCDevice rtc_device;
   enum RTCBuildQuality build_quality;
+  /* Type of every object in the last build. */
+  vector<ObjectType> object_types;
 };
 
 CCL_NAMESPACE_END
@@ -13,6 +13,8 @@
 #include "scene/pointcloud.h"
 
 #include "util/algorithm.h"
+#include "util/tbb.h"
+#include "util/thread.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -147,45 +149,92 @@ BVHSpatialSplit::BVHSpatialSplit(const BVHBuild &builder,
   float3 binSize = (range_bounds.max - origin) * (1.0f / (float)BVHParams::NUM_SPATIAL_BINS);
   float3 invBinSize = 1.0f / binSize;
 
-  for (int dim = 0; dim < 3; dim++) {
-    for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
-      BVHSpatialBin &bin = storage_->bins[dim][i];
+  auto clear_bins = [](BVHSpatialBin (*r_bins)[BVHParams::NUM_SPATIAL_BINS]) {
+    for (int dim = 0; dim < 3; dim++) {
+      for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
+        BVHSpatialBin &bin = r_bins[dim][i];
 
-      bin.bounds = BoundBox::empty;
-      bin.enter = 0;
-      bin.exit = 0;
+        bin.bounds = BoundBox::empty;
+        bin.enter = 0;
+        bin.exit = 0;
+      }
     }
-  }
+  };
 
   /* chop references into bins. */
-  for (unsigned int refIdx = range.start(); refIdx < range.end(); refIdx++) {
-    const BVHReference &ref = references_->at(refIdx);
-    BoundBox prim_bounds = get_prim_bounds(ref);
-    float3 firstBinf = (prim_bounds.min - origin) * invBinSize;
-    float3 lastBinf = (prim_bounds.max - origin) * invBinSize;
-    int3 firstBin = make_int3((int)firstBinf.x, (int)firstBinf.y, (int)firstBinf.z);
-    int3 lastBin = make_int3((int)lastBinf.x, (int)lastBinf.y, (int)lastBinf.z);
-
-    firstBin = clamp(firstBin, 0, BVHParams::NUM_SPATIAL_BINS - 1);
-    lastBin = clamp(lastBin, firstBin, BVHParams::NUM_SPATIAL_BINS - 1);
-
-    for (int dim = 0; dim < 3; dim++) {
-      BVHReference currRef(
-          get_prim_bounds(ref), ref.prim_index(), ref.prim_object(), ref.prim_type());
-
-      for (int i = firstBin[dim]; i < lastBin[dim]; i++) {
-        BVHReference leftRef, rightRef;
-
-        split_reference(
-            builder, leftRef, rightRef, currRef, dim, origin[dim] + binSize[dim] * (float)(i + 1));
-        storage_->bins[dim][i].bounds.grow(leftRef.bounds());
-        currRef = rightRef;
+  auto bin_references = [&](const size_t begin,
+                            const size_t end,
+                            BVHSpatialBin (*r_bins)[BVHParams::NUM_SPATIAL_BINS]) {
+    for (size_t refIdx = begin; refIdx < end; refIdx++) {
+      const BVHReference &ref = references_->at(refIdx);
+      BoundBox prim_bounds = get_prim_bounds(ref);
+      float3 firstBinf = (prim_bounds.min - origin) * invBinSize;
+      float3 lastBinf = (prim_bounds.max - origin) * invBinSize;
+      int3 firstBin = make_int3((int)firstBinf.x, (int)firstBinf.y, (int)firstBinf.z);
+      int3 lastBin = make_int3((int)lastBinf.x, (int)lastBinf.y, (int)lastBinf.z);
+
+      firstBin = clamp(firstBin, 0, BVHParams::NUM_SPATIAL_BINS - 1);
+      lastBin = clamp(lastBin, firstBin, BVHParams::NUM_SPATIAL_BINS - 1);
+
+      for (int dim = 0; dim < 3; dim++) {
+        BVHReference currRef(
+            get_prim_bounds(ref), ref.prim_index(), ref.prim_object(), ref.prim_type());
+
+        for (int i = firstBin[dim]; i < lastBin[dim]; i++) {
+          BVHReference leftRef, rightRef;
+
+          split_reference(builder,
+                          leftRef,
+                          rightRef,
+                          currRef,
+                          dim,
+                          origin[dim] + binSize[dim] * (float)(i + 1));
+          r_bins[dim][i].bounds.grow(leftRef.bounds());
+          currRef = rightRef;
+        }
+
+        r_bins[dim][lastBin[dim]].bounds.grow(currRef.bounds());
+        r_bins[dim][firstBin[dim]].enter++;
+        r_bins[dim][lastBin[dim]].exit++;
       }
-
-      storage_->bins[dim][lastBin[dim]].bounds.grow(currRef.bounds());
-      storage_->bins[dim][firstBin[dim]].enter++;
-      storage_->bins[dim][lastBin[dim]].exit++;
     }
+  };
+
+  if (range.size() < PARALLEL_BINNING_SIZE) {
+    clear_bins(storage_->bins);
+    bin_references(range.start(), range.end(), storage_->bins);
+  }
+  else {
+    /* Splitting references into bins is expensive and done for the largest nodes at the top of
+     * the tree, where there are not enough nodes yet to keep all threads busy. Every task uses its
+     * own bins which are merged afterwards, so the result is the same as with serial binning.
+     *
+     * The merged bins are kept on the stack until all tasks are done: while waiting, this thread
+     * may run other node builds which use the same thread local storage. */
+    BVHSpatialBin bins[3][BVHParams::NUM_SPATIAL_BINS];
+    clear_bins(bins);
+
+    thread_mutex bins_mutex;
+    parallel_for(
+        blocked_range<size_t>(range.start(), range.end(), PARALLEL_BINNING_GRAIN_SIZE),
+        [&](const blocked_range<size_t> &r) {
+          BVHSpatialBin local_bins[3][BVHParams::NUM_SPATIAL_BINS];
+          clear_bins(local_bins);
+
+          bin_references(r.begin(), r.end(), local_bins);
+
+          thread_scoped_lock lock(bins_mutex);
+          for (int dim = 0; dim < 3; dim++) {
+            for (int i = 0; i < BVHParams::NUM_SPATIAL_BINS; i++) {
+              BVHSpatialBin &bin = bins[dim][i];
+              bin.bounds.grow(local_bins[dim][i].bounds);
+              bin.enter += local_bins[dim][i].enter;
+              bin.exit += local_bins[dim][i].exit;
+            }
+          }
+        });
+
+    memcpy(storage_->bins, bins, sizeof(bins));
   }
 
   /* select best split plane. */
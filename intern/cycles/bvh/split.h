@@ -90,6 +90,9 @@ class BVHSpatialSplit {
   const BVHUnaligned *unaligned_heuristic_;
   const Transform *aligned_space_;
 
+  /* Ranges with at least this many references are binned by multiple threads. */
+  enum { PARALLEL_BINNING_SIZE = 65536, PARALLEL_BINNING_GRAIN_SIZE = 16384 };
+
   /* Lower-level functions which calculates boundaries of left and right nodes
    * needed for spatial split.
    *
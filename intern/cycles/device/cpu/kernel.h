@@ -39,6 +39,7 @@ class CPUKernels {
   IntegratorShadeFunction integrator_shade_surface;
   IntegratorShadeFunction integrator_shade_volume;
   IntegratorShadeFunction integrator_megakernel;
+  IntegratorShadeFunction integrator_megakernel_step;
 
   /* Shader evaluation. */
 
@@ -751,7 +751,7 @@ CUDADevice::CUDAMem *CUDADevice::generic_alloc(device_memory &mem, size_t pitch_
   return cmem;
 }
 
-void CUDADevice::generic_copy_to(device_memory &mem)
+void CUDADevice::generic_copy_to(device_memory &mem, size_t size, size_t offset)
 {
   if (!mem.host_pointer || !mem.device_pointer) {
     return;
@@ -763,8 +763,9 @@ void CUDADevice::generic_copy_to(device_memory &mem)
   thread_scoped_lock lock(cuda_mem_map_mutex);
   if (!cuda_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
     const CUDAContextScope scope(this);
-    cuda_assert(
-        cuMemcpyHtoD((CUdeviceptr)mem.device_pointer, mem.host_pointer, mem.memory_size()));
+    cuda_assert(cuMemcpyHtoD((CUdeviceptr)(mem.device_pointer + offset),
+                             (const char *)mem.host_pointer + offset,
+                             size));
   }
 }
 
@@ -833,10 +834,28 @@ void CUDADevice::mem_copy_to(device_memory &mem)
     if (!mem.device_pointer) {
       generic_alloc(mem);
     }
-    generic_copy_to(mem);
+    generic_copy_to(mem, mem.memory_size(), 0);
   }
 }
 
+bool CUDADevice::get_memory_info(size_t &total, size_t &free)
+{
+  const CUDAContextScope scope(this);
+  cuMemGetInfo(&free, &total);
+  return true;
+}
+
+void CUDADevice::mem_copy_to_partial(device_memory &mem, size_t size, size_t offset)
+{
+  if (mem.type == MEM_GLOBAL || mem.type == MEM_TEXTURE || !mem.device_pointer) {
+    mem_copy_to(mem);
+    return;
+  }
+
+  assert(offset + size <= mem.memory_size());
+  generic_copy_to(mem, size, offset);
+}
+
 void CUDADevice::mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem)
 {
   if (mem.type == MEM_TEXTURE || mem.type == MEM_GLOBAL) {
@@ -921,7 +940,7 @@ void CUDADevice::global_alloc(device_memory &mem)
 {
   if (mem.is_resident(this)) {
     generic_alloc(mem);
-    generic_copy_to(mem);
+    generic_copy_to(mem, mem.memory_size(), 0);
   }
 
   const_copy_to(mem.name, &mem.device_pointer, sizeof(mem.device_pointer));
@@ -96,7 +96,7 @@ class CUDADevice : public Device {
 
   CUDAMem *generic_alloc(device_memory &mem, size_t pitch_padding = 0);
 
-  void generic_copy_to(device_memory &mem);
+  void generic_copy_to(device_memory &mem, size_t size, size_t offset);
 
   void generic_free(device_memory &mem);
 
@@ -104,6 +104,10 @@ class CUDADevice : public Device {
 
   void mem_copy_to(device_memory &mem) override;
 
+  bool get_memory_info(size_t &total, size_t &free) override;
+
+  void mem_copy_to_partial(device_memory &mem, size_t size, size_t offset) override;
+
   void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) override;
 
   void mem_zero(device_memory &mem) override;
@@ -67,6 +67,8 @@ NODE_DEFINE(DenoiseParams)
 
   SOCKET_ENUM(prefilter, "Prefilter", *prefilter_enum, DENOISER_PREFILTER_FAST);
 
+  SOCKET_INT(max_memory_mb, "Max Memory", 0);
+
   return type;
 }
 
@@ -64,6 +64,10 @@ class DenoiseParams : public Node {
 
   DenoiserPrefilter prefilter = DENOISER_PREFILTER_FAST;
 
+  /* Maximum amount of memory in megabytes the denoiser is allowed to use. Larger images are
+   * denoised in overlapping parts. Zero means there is no limit. */
+  int max_memory_mb = 0;
+
   static const NodeEnum *get_type_enum();
   static const NodeEnum *get_prefilter_enum();
 
@@ -74,7 +78,8 @@ class DenoiseParams : public Node {
     return !(use == other.use && type == other.type && start_sample == other.start_sample &&
              use_pass_albedo == other.use_pass_albedo &&
              use_pass_normal == other.use_pass_normal &&
-             temporally_stable == other.temporally_stable && prefilter == other.prefilter);
+             temporally_stable == other.temporally_stable && prefilter == other.prefilter &&
+             max_memory_mb == other.max_memory_mb);
   }
 };
 
@@ -412,6 +412,11 @@ DeviceInfo Device::get_multi_device(const vector<DeviceInfo> &subdevices,
   return info;
 }
 
+void Device::mem_copy_to_partial(device_memory &mem, size_t /*size*/, size_t /*offset*/)
+{
+  mem_copy_to(mem);
+}
+
 void Device::tag_update()
 {
   free_memory();
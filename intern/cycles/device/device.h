@@ -184,6 +184,13 @@ class Device {
   /* Get OpenShadingLanguage memory buffer. */
   virtual void *get_cpu_osl_memory();
 
+  /* Get the total and free device memory in bytes. Returns false for devices that use host
+   * memory, or can not query it. */
+  virtual bool get_memory_info(size_t & /*total*/, size_t & /*free*/)
+  {
+    return false;
+  }
+
   /* acceleration structure building */
   virtual void build_bvh(BVH *bvh, Progress &progress, bool refit);
 
@@ -271,6 +278,9 @@ class Device {
 
   virtual void mem_alloc(device_memory &mem) = 0;
   virtual void mem_copy_to(device_memory &mem) = 0;
+  /* Copy `size` bytes starting at `offset` bytes to memory that was already copied to the device
+   * before. Devices that do not support partial copies copy the whole memory. */
+  virtual void mem_copy_to_partial(device_memory &mem, size_t size, size_t offset);
   virtual void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) = 0;
   virtual void mem_zero(device_memory &mem) = 0;
   virtual void mem_free(device_memory &mem) = 0;
@@ -706,7 +706,7 @@ HIPDevice::HIPMem *HIPDevice::generic_alloc(device_memory &mem, size_t pitch_pad
   return cmem;
 }
 
-void HIPDevice::generic_copy_to(device_memory &mem)
+void HIPDevice::generic_copy_to(device_memory &mem, size_t size, size_t offset)
 {
   if (!mem.host_pointer || !mem.device_pointer) {
     return;
@@ -718,8 +718,9 @@ void HIPDevice::generic_copy_to(device_memory &mem)
   thread_scoped_lock lock(hip_mem_map_mutex);
   if (!hip_mem_map[&mem].use_mapped_host || mem.host_pointer != mem.shared_pointer) {
     const HIPContextScope scope(this);
-    hip_assert(
-        hipMemcpyHtoD((hipDeviceptr_t)mem.device_pointer, mem.host_pointer, mem.memory_size()));
+    hip_assert(hipMemcpyHtoD((hipDeviceptr_t)(mem.device_pointer + offset),
+                             (const char *)mem.host_pointer + offset,
+                             size));
   }
 }
 
@@ -788,10 +789,28 @@ void HIPDevice::mem_copy_to(device_memory &mem)
     if (!mem.device_pointer) {
       generic_alloc(mem);
     }
-    generic_copy_to(mem);
+    generic_copy_to(mem, mem.memory_size(), 0);
   }
 }
 
+bool HIPDevice::get_memory_info(size_t &total, size_t &free)
+{
+  const HIPContextScope scope(this);
+  hipMemGetInfo(&free, &total);
+  return true;
+}
+
+void HIPDevice::mem_copy_to_partial(device_memory &mem, size_t size, size_t offset)
+{
+  if (mem.type == MEM_GLOBAL || mem.type == MEM_TEXTURE || !mem.device_pointer) {
+    mem_copy_to(mem);
+    return;
+  }
+
+  assert(offset + size <= mem.memory_size());
+  generic_copy_to(mem, size, offset);
+}
+
 void HIPDevice::mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem)
 {
   if (mem.type == MEM_TEXTURE || mem.type == MEM_GLOBAL) {
@@ -876,7 +895,7 @@ void HIPDevice::global_alloc(device_memory &mem)
 {
   if (mem.is_resident(this)) {
     generic_alloc(mem);
-    generic_copy_to(mem);
+    generic_copy_to(mem, mem.memory_size(), 0);
   }
 
   const_copy_to(mem.name, &mem.device_pointer, sizeof(mem.device_pointer));
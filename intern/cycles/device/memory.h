@@ -275,6 +275,7 @@ class device_memory {
   void device_alloc();
   void device_free();
   void device_copy_to();
+  void device_copy_to(size_t size, size_t offset);
   void device_copy_from(size_t y, size_t w, size_t h, size_t elem);
   void device_zero();
 
@@ -484,6 +485,16 @@ template<typename T> class device_vector : public device_memory {
     modified = true;
   }
 
+  /* Tag `size` elements starting at `offset` as modified. When all changes to the host data are
+   * tagged this way, only the covered range is copied to the device by
+   * copy_to_device_if_modified(). */
+  void tag_modified(size_t offset, size_t size)
+  {
+    modified = true;
+    modified_begin_ = min(modified_begin_, offset);
+    modified_end_ = max(modified_end_, offset + size);
+  }
+
   void tag_realloc()
   {
     need_realloc_ = true;
@@ -524,6 +535,13 @@ template<typename T> class device_vector : public device_memory {
       return;
     }
 
+    /* Only copy the elements that were tagged, when the device memory already exists. */
+    if (device_pointer && modified_begin_ < modified_end_) {
+      device_copy_to(sizeof(T) * (modified_end_ - modified_begin_),
+                     sizeof(T) * modified_begin_);
+      return;
+    }
+
     copy_to_device();
   }
 
@@ -531,6 +549,8 @@ template<typename T> class device_vector : public device_memory {
   {
     modified = false;
     need_realloc_ = false;
+    modified_begin_ = SIZE_MAX;
+    modified_end_ = 0;
   }
 
   void copy_from_device()
@@ -561,6 +581,10 @@ template<typename T> class device_vector : public device_memory {
   {
     return width * ((height == 0) ? 1 : height) * ((depth == 0) ? 1 : depth);
   }
+
+  /* Range of elements tagged as modified since the last copy to the device. */
+  size_t modified_begin_ = SIZE_MAX;
+  size_t modified_end_ = 0;
 };
 
 /* Device Sub Memory
@@ -221,6 +221,21 @@ class MultiDevice : public Device {
     return devices.back().device->get_cpu_osl_memory();
   }
 
+  bool get_memory_info(size_t &total, size_t &free) override
+  {
+    /* Memory is allocated on every device, so the device with the least memory is the limit. */
+    bool found = false;
+    foreach (SubDevice &sub, devices) {
+      size_t sub_total = 0, sub_free = 0;
+      if (sub.device->get_memory_info(sub_total, sub_free)) {
+        total = (found) ? min(total, sub_total) : sub_total;
+        free = (found) ? min(free, sub_free) : sub_free;
+        found = true;
+      }
+    }
+    return found;
+  }
+
   bool is_resident(device_ptr key, Device *sub_device) override
   {
     foreach (SubDevice &sub, devices) {
@@ -320,6 +335,27 @@ class MultiDevice : public Device {
     stats.mem_alloc(mem.device_size - existing_size);
   }
 
+  void mem_copy_to_partial(device_memory &mem, size_t size, size_t offset) override
+  {
+    device_ptr existing_key = mem.device_pointer;
+    if (!existing_key || mem.type == MEM_GLOBAL || mem.type == MEM_TEXTURE) {
+      mem_copy_to(mem);
+      return;
+    }
+
+    /* Only the devices owning the memory of every peer island need the new data. */
+    foreach (const vector<SubDevice *> &island, peer_islands) {
+      SubDevice *owner_sub = find_suitable_mem_device(existing_key, island);
+      mem.device = owner_sub->device;
+      mem.device_pointer = owner_sub->ptr_map[existing_key];
+
+      owner_sub->device->mem_copy_to_partial(mem, size, offset);
+    }
+
+    mem.device = this;
+    mem.device_pointer = existing_key;
+  }
+
   void mem_copy_from(device_memory &mem, size_t y, size_t w, size_t h, size_t elem) override
   {
     device_ptr key = mem.device_pointer;
@@ -31,15 +31,21 @@ bool device_oneapi_init()
    * improves stability as of intel/LLVM SYCL-nightly/20220529.
    * All these env variable can be set beforehand by end-users and
    * will in that case -not- be overwritten. */
+  /* The JIT cache is stored next to the locally compiled CUDA and HIP kernels, instead of the
+   * default SYCL location, so that all kernel binaries are found in one place. */
+  const string cache_dir = path_cache_get(path_join("kernels", "oneapi"));
   /* By default, enable only Level-Zero and if all devices are allowed, also CUDA and HIP.
    * OpenCL backend isn't currently well supported. */
 #  ifdef _WIN32
   if (getenv("SYCL_CACHE_PERSISTENT") == nullptr) {
     _putenv_s("SYCL_CACHE_PERSISTENT", "1");
   }
-  if (getenv("SYCL_CACHE_TRESHOLD") == nullptr) {
+  if (getenv("SYCL_CACHE_THRESHOLD") == nullptr) {
     _putenv_s("SYCL_CACHE_THRESHOLD", "0");
   }
+  if (getenv("SYCL_CACHE_DIR") == nullptr) {
+    _putenv_s("SYCL_CACHE_DIR", cache_dir.c_str());
+  }
   if (getenv("SYCL_DEVICE_FILTER") == nullptr) {
     if (getenv("CYCLES_ONEAPI_ALL_DEVICES") == nullptr) {
       _putenv_s("SYCL_DEVICE_FILTER", "level_zero");
@@ -57,6 +63,7 @@ bool device_oneapi_init()
 #  elif __linux__
   setenv("SYCL_CACHE_PERSISTENT", "1", false);
   setenv("SYCL_CACHE_THRESHOLD", "0", false);
+  setenv("SYCL_CACHE_DIR", cache_dir.c_str(), false);
   if (getenv("CYCLES_ONEAPI_ALL_DEVICES") == nullptr) {
     setenv("SYCL_DEVICE_FILTER", "level_zero", false);
   }
@@ -104,6 +111,7 @@ static void device_iterator_cb(const char *id, const char *name, int num, void *
   info.denoisers = 0;
 
   info.has_gpu_queue = true;
+  info.has_profiling = true;
 
   /* NOTE(@nsirgien): oneAPI right now is focused on one device usage. In future it maybe will
    * change, but right now peer access from one device to another device is not supported. */
@@ -15,7 +15,8 @@ DeviceQueue::DeviceQueue(Device *device)
     : device(device),
       last_kernels_enqueued_(0),
       last_sync_time_(0.0),
-      is_per_kernel_performance_(false)
+      is_per_kernel_performance_(false),
+      is_collect_kernel_stats_(false)
 {
   DCHECK_NE(device, nullptr);
   is_per_kernel_performance_ = getenv("CYCLES_DEBUG_PER_KERNEL_PERFORMANCE");
@@ -53,7 +54,7 @@ DeviceQueue::~DeviceQueue()
 
 void DeviceQueue::debug_init_execution()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (VLOG_DEVICE_STATS_IS_ON || is_collect_kernel_stats_) {
     last_sync_time_ = time_dt();
   }
 
@@ -68,18 +69,24 @@ void DeviceQueue::debug_enqueue_begin(DeviceKernel kernel, const int work_size)
   }
 
   last_kernels_enqueued_ |= (uint64_t(1) << (uint64_t)kernel);
+
+  if (is_collect_kernel_stats_) {
+    KernelStats &stats = stats_kernels_[kernel];
+    stats.work_size += work_size;
+    stats.num_launches++;
+  }
 }
 
 void DeviceQueue::debug_enqueue_end()
 {
-  if (VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) {
+  if ((VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) || is_collect_kernel_stats_) {
     synchronize();
   }
 }
 
 void DeviceQueue::debug_synchronize()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (VLOG_DEVICE_STATS_IS_ON || is_collect_kernel_stats_) {
     const double new_time = time_dt();
     const double elapsed_time = new_time - last_sync_time_;
     VLOG_DEVICE_STATS << "GPU queue synchronize, elapsed " << std::setw(10) << elapsed_time << "s";
@@ -88,6 +95,18 @@ void DeviceQueue::debug_synchronize()
      * container without related kernel information. */
     if (last_kernels_enqueued_ != 0) {
       stats_kernel_time_[last_kernels_enqueued_] += elapsed_time;
+
+      /* Kernels are synchronized one by one when collecting statistics, so the time is only
+       * assigned to a kernel when it is the only one in the mask. */
+      const bool is_single_kernel = (last_kernels_enqueued_ & (last_kernels_enqueued_ - 1)) == 0;
+      if (is_collect_kernel_stats_ && is_single_kernel) {
+        for (int i = 0; i < DEVICE_KERNEL_NUM; i++) {
+          if (last_kernels_enqueued_ == (uint64_t(1) << uint64_t(i))) {
+            stats_kernels_[DeviceKernel(i)].time += elapsed_time;
+            break;
+          }
+        }
+      }
     }
 
     last_sync_time_ = new_time;
@@ -153,6 +153,29 @@ class DeviceQueue {
     return nullptr;
   }
 
+  /* Execution statistics of a kernel. */
+  struct KernelStats {
+    /* Total execution time in seconds. */
+    double time = 0.0;
+    /* Total number of work items the kernel was launched for, such as paths or pixels. */
+    uint64_t work_size = 0;
+    int num_launches = 0;
+  };
+
+  /* Collect execution statistics of every kernel enqueued on this queue, for the render
+   * statistics. This synchronizes the queue after every kernel to measure its time, so should only
+   * be used for profiling. Statistics from previous renders are cleared. */
+  void set_collect_kernel_stats(const bool collect)
+  {
+    is_collect_kernel_stats_ = collect;
+    stats_kernels_.clear();
+  }
+
+  const map<DeviceKernel, KernelStats> &get_kernel_stats() const
+  {
+    return stats_kernels_;
+  }
+
   /* Device this queue has been created for. */
   Device *device;
 
@@ -176,6 +199,9 @@ class DeviceQueue {
   /* If it is true, then a performance statistics in the debugging logs will have focus on kernels
    * and an explicit queue synchronization will be added after each kernel execution. */
   bool is_per_kernel_performance_;
+  /* Statistics of every kernel, collected when enabled with set_collect_kernel_stats(). */
+  bool is_collect_kernel_stats_;
+  map<DeviceKernel, KernelStats> stats_kernels_;
 };
 
 CCL_NAMESPACE_END
@@ -23,6 +23,28 @@ DenoiserGPU::~DenoiserGPU()
   /* Explicit implementation, to allow forward declaration of Device in the header. */
 }
 
+/* Number of rows on each side of a strip which are denoised together with it but are not copied
+ * back, to avoid visible seams between the strips. */
+static constexpr int DENOISE_STRIP_OVERLAP = 64;
+
+/* Number of rows of the buffer which are denoised at once, so that the memory used on the
+ * denoiser device stays below the limit. Returns the full height when there is no limit. */
+static int denoise_strip_height(const BufferParams &buffer_params, const int max_memory_mb)
+{
+  if (max_memory_mb <= 0) {
+    return buffer_params.height;
+  }
+
+  /* Besides the render buffer itself, the denoiser needs about the same amount of memory for its
+   * intermediate passes. */
+  const size_t row_size = sizeof(float) * buffer_params.width * buffer_params.pass_stride * 2;
+  const size_t max_memory = size_t(max_memory_mb) * 1024 * 1024;
+  const int num_rows = int(min(max_memory / row_size, size_t(INT_MAX))) -
+                       2 * DENOISE_STRIP_OVERLAP;
+
+  return clamp(num_rows, DENOISE_STRIP_OVERLAP, max(buffer_params.height, 1));
+}
+
 bool DenoiserGPU::denoise_buffer(const BufferParams &buffer_params,
                                  RenderBuffers *render_buffers,
                                  const int num_samples,
@@ -39,52 +61,82 @@ bool DenoiserGPU::denoise_buffer(const BufferParams &buffer_params,
   task.buffer_params = buffer_params;
   task.allow_inplace_modification = allow_inplace_modification;
 
-  RenderBuffers local_render_buffers(denoiser_device);
-  bool local_buffer_used = false;
-
   if (denoiser_device == render_buffers->buffer.device) {
     /* The device can access an existing buffer pointer. */
-    local_buffer_used = false;
     task.render_buffers = render_buffers;
+    return denoise_buffer(task);
   }
-  else {
-    VLOG_WORK << "Creating temporary buffer on denoiser device.";
 
-    /* Create buffer which is available by the device used by denoiser. */
+  VLOG_WORK << "Creating temporary buffer on denoiser device.";
 
-    /* TODO(sergey): Optimize data transfers. For example, only copy denoising related passes,
-     * ignoring other light ad data passes. */
+  /* Create buffer which is available by the device used by denoiser. */
 
-    local_buffer_used = true;
+  /* TODO(sergey): Optimize data transfers. For example, only copy denoising related passes,
+   * ignoring other light ad data passes. */
 
-    render_buffers->copy_from_device();
+  render_buffers->copy_from_device();
 
-    local_render_buffers.reset(buffer_params);
+  /* When the buffer does not fit into the memory limit it is denoised in horizontal strips, which
+   * keeps the rows contiguous in memory for both the full and the local buffer. */
+  const int width = buffer_params.width;
+  const int height = buffer_params.height;
+  const int strip_height = denoise_strip_height(buffer_params, params_.max_memory_mb);
+  if (strip_height < height) {
+    VLOG_WORK << "Denoising in strips of " << strip_height << " rows to fit memory limit of "
+              << params_.max_memory_mb << " MB.";
+  }
+
+  RenderBuffers local_render_buffers(denoiser_device);
+  bool denoise_result = true;
+
+  for (int strip_y = 0; strip_y < height; strip_y += strip_height) {
+    const int strip_end_y = min(strip_y + strip_height, height);
+    const int local_y = max(strip_y - DENOISE_STRIP_OVERLAP, 0);
+    const int local_end_y = min(strip_end_y + DENOISE_STRIP_OVERLAP, height);
+
+    BufferParams local_params = buffer_params;
+    local_params.full_y = buffer_params.full_y + local_y;
+    local_params.height = local_end_y - local_y;
+    local_params.window_y = 0;
+    local_params.window_height = local_params.height;
+    local_params.update_offset_stride();
+
+    local_render_buffers.reset(local_params);
 
     /* NOTE: The local buffer is allocated for an exact size of the effective render size, while
      * the input render buffer is allocated for the lowest resolution divider possible. So it is
      * important to only copy actually needed part of the input buffer. */
     memcpy(local_render_buffers.buffer.data(),
-           render_buffers->buffer.data(),
+           render_buffers->buffer.data() + size_t(local_y) * width * buffer_params.pass_stride,
            sizeof(float) * local_render_buffers.buffer.size());
 
     denoiser_queue_->copy_to_device(local_render_buffers.buffer);
 
     task.render_buffers = &local_render_buffers;
+    task.buffer_params = local_params;
     task.allow_inplace_modification = true;
-  }
 
-  const bool denoise_result = denoise_buffer(task);
+    if (!denoise_buffer(task)) {
+      denoise_result = false;
+      break;
+    }
 
-  if (local_buffer_used) {
     local_render_buffers.copy_from_device();
 
-    render_buffers_host_copy_denoised(
-        render_buffers, buffer_params, &local_render_buffers, local_render_buffers.params);
+    /* Only copy the rows of the strip itself, the overlap is denoised by the neighbor strips. */
+    BufferParams strip_params = buffer_params;
+    strip_params.height = strip_end_y - strip_y;
 
-    render_buffers->copy_to_device();
+    render_buffers_host_copy_denoised(render_buffers,
+                                      strip_params,
+                                      &local_render_buffers,
+                                      local_params,
+                                      size_t(strip_y - local_y) * width,
+                                      size_t(strip_y) * width);
   }
 
+  render_buffers->copy_to_device();
+
   return denoise_result;
 }
 
@@ -737,14 +737,16 @@ void PathTrace::write_tile_buffer(const RenderWork &render_work)
 
   const bool has_multiple_tiles = tile_manager_.has_multiple_tiles();
 
-  /* Write render tile result, but only if not using tiled rendering.
+  /* Write render tile result, but only if not using tiled rendering, or if the tiles do not need
+   * full-frame post-processing.
    *
-   * Tiles are written to a file during rendering, and written to the software at the end
-   * of rendering (wither when all tiles are finished, or when rendering was requested to be
-   * canceled).
+   * Tiles which need full-frame post-processing (such as denoising) are written to a file during
+   * rendering, and written to the software at the end of rendering (wither when all tiles are
+   * finished, or when rendering was requested to be canceled). Otherwise every tile is written to
+   * the software as soon as it is finished, so that the full frame is never held in memory.
    *
    * Important thing is: tile should be written to the software via callback only once. */
-  if (!has_multiple_tiles) {
+  if (!has_multiple_tiles || !tile_manager_.use_tile_file()) {
     VLOG_WORK << "Write tile result via buffer write callback.";
     tile_buffer_write();
   }
@@ -1258,6 +1260,20 @@ string PathTrace::full_report() const
   return result;
 }
 
+void PathTrace::set_collect_kernel_stats(bool collect)
+{
+  for (auto &&path_trace_work : path_trace_works_) {
+    path_trace_work->set_collect_kernel_stats(collect);
+  }
+}
+
+void PathTrace::collect_kernel_stats(RenderStats *render_stats) const
+{
+  for (auto &&path_trace_work : path_trace_works_) {
+    path_trace_work->collect_kernel_stats(render_stats);
+  }
+}
+
 void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bool reset)
 {
 #ifdef WITH_PATH_GUIDING
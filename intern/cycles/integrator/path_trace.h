@@ -26,6 +26,7 @@ class DisplayDriver;
 class Film;
 class RenderBuffers;
 class RenderScheduler;
+class RenderStats;
 class RenderWork;
 class PathTraceDisplay;
 class OutputDriver;
@@ -174,6 +175,11 @@ class PathTrace {
    * times, and so on. */
   string full_report() const;
 
+  /* Collect execution statistics of the device kernels, such as their time and the number of
+   * rays they processed. Only available for devices which use a GPU queue. */
+  void set_collect_kernel_stats(bool collect);
+  void collect_kernel_stats(RenderStats *render_stats) const;
+
   /* Callback which is called to report current rendering progress.
    *
    * It is supposed to be cheaper than buffer update/write, hence can be called more often.
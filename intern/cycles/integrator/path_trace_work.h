@@ -17,6 +17,7 @@ class DeviceScene;
 class Film;
 class PathTraceDisplay;
 class RenderBuffers;
+class RenderStats;
 
 class PathTraceWork {
  public:
@@ -125,6 +126,15 @@ class PathTraceWork {
   /* Run cryptomatte pass post-processing kernels. */
   virtual void cryptomatte_postproces() = 0;
 
+  /* Collect execution statistics of the device kernels, for works which run on a device queue.
+   * The statistics are added to the render statistics by `collect_kernel_stats()`. */
+  virtual void set_collect_kernel_stats(bool /*collect*/)
+  {
+  }
+  virtual void collect_kernel_stats(RenderStats * /*render_stats*/) const
+  {
+  }
+
   /* Cheap-ish request to see whether rendering is requested and is to be stopped as soon as
    * possible, without waiting for any samples to be finished. */
   inline bool is_cancel_requested() const
@@ -15,12 +15,19 @@
 #include "scene/scene.h"
 #include "session/buffers.h"
 
+#include "util/algorithm.h"
 #include "util/atomic.h"
+#include "util/debug.h"
 #include "util/log.h"
 #include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
+/* Size of the blocks of pixels which are rendered together when paths are sorted. It is kept
+ * small since every path state contains large arrays for shadow intersections. */
+static constexpr int SORTED_PATHS_BLOCK_WIDTH = 8;
+static constexpr int SORTED_PATHS_BLOCK_HEIGHT = 4;
+
 /* Create TBB arena for execution of path tracing and rendering tasks. */
 static inline tbb::task_arena local_tbb_arena_create(const Device *device)
 {
@@ -55,6 +62,7 @@ void PathTraceWorkCPU::init_execution()
 {
   /* Cache per-thread kernel globals. */
   device_->get_cpu_kernel_thread_globals(kernel_thread_globals_);
+  sorted_path_states_.resize(kernel_thread_globals_.size());
 }
 
 void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
@@ -72,8 +80,43 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
     }
   }
 
+  bool use_sorted_paths = DebugFlags().cpu.sort_paths;
+#ifdef WITH_PATH_GUIDING
+  /* Training data is collected per thread and path, so paths can not be interleaved. */
+  if (device_scene_->data.integrator.train_guiding) {
+    use_sorted_paths = false;
+  }
+#endif
+
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
+    if (use_sorted_paths) {
+      const int64_t blocks_x = divide_up(image_width, SORTED_PATHS_BLOCK_WIDTH);
+      const int64_t blocks_y = divide_up(image_height, SORTED_PATHS_BLOCK_HEIGHT);
+      parallel_for(int64_t(0), blocks_x * blocks_y, [&](int64_t block_index) {
+        if (is_cancel_requested()) {
+          return;
+        }
+
+        const int x = (block_index % blocks_x) * SORTED_PATHS_BLOCK_WIDTH;
+        const int y = (block_index / blocks_x) * SORTED_PATHS_BLOCK_HEIGHT;
+
+        KernelWorkTile work_tile;
+        work_tile.x = effective_buffer_params_.full_x + x;
+        work_tile.y = effective_buffer_params_.full_y + y;
+        work_tile.w = min(SORTED_PATHS_BLOCK_WIDTH, int(image_width - x));
+        work_tile.h = min(SORTED_PATHS_BLOCK_HEIGHT, int(image_height - y));
+        work_tile.start_sample = start_sample;
+        work_tile.sample_offset = sample_offset;
+        work_tile.num_samples = samples_num;
+        work_tile.offset = effective_buffer_params_.offset;
+        work_tile.stride = effective_buffer_params_.stride;
+
+        render_samples_sorted_pipeline(work_tile);
+      });
+      return;
+    }
+
     parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
       if (is_cancel_requested()) {
         return;
@@ -161,6 +204,100 @@ void PathTraceWorkCPU::render_samples_full_pipeline(KernelGlobalsCPU *kernel_glo
   }
 }
 
+/* Key to order paths by the kernel they execute next, and by shader for shading kernels. Zero when
+ * the path and its shadow paths are done. */
+static uint64_t sorted_path_key(const IntegratorStateCPU *state)
+{
+  if (state->shadow.shadow_path.queued_kernel) {
+    return uint64_t(state->shadow.shadow_path.queued_kernel) << 32;
+  }
+  if (state->ao.shadow_path.queued_kernel) {
+    return uint64_t(state->ao.shadow_path.queued_kernel) << 32;
+  }
+  if (state->path.queued_kernel) {
+    return (uint64_t(state->path.queued_kernel) << 32) | state->path.shader_sort_key;
+  }
+  return 0;
+}
+
+void PathTraceWorkCPU::render_samples_sorted_pipeline(const KernelWorkTile &work_tile)
+{
+  const int thread_index = tbb::this_task_arena::current_thread_index();
+  CPUKernelThreadGlobals *kernel_globals = &kernel_thread_globals_[thread_index];
+
+  const bool has_bake = device_scene_->data.bake.use;
+  const int pixels_num = work_tile.w * work_tile.h;
+
+  /* Every pixel has its main path state followed by the state used for the path split off at a
+   * shadow catcher, matching what the kernel expects. */
+  vector<IntegratorStateCPU> &integrator_states = sorted_path_states_[thread_index];
+  if (integrator_states.size() < SORTED_PATHS_BLOCK_WIDTH * SORTED_PATHS_BLOCK_HEIGHT * 2) {
+    integrator_states.resize(SORTED_PATHS_BLOCK_WIDTH * SORTED_PATHS_BLOCK_HEIGHT * 2);
+  }
+
+  /* Pixels for which the initialization failed, e.g. because they converged. */
+  vector<bool> pixel_done(pixels_num, false);
+  vector<std::pair<uint64_t, int>> queue;
+  queue.reserve(pixels_num * 2);
+
+  float *render_buffer = buffers_->buffer.data();
+
+  for (int sample = 0; sample < work_tile.num_samples; ++sample) {
+    if (is_cancel_requested()) {
+      break;
+    }
+
+    for (int i = 0; i < pixels_num; ++i) {
+      IntegratorStateCPU *state = &integrator_states[i * 2];
+      path_state_init_queues(state);
+      path_state_init_queues(state + 1);
+
+      if (pixel_done[i]) {
+        continue;
+      }
+
+      KernelWorkTile pixel_work_tile = work_tile;
+      pixel_work_tile.x = work_tile.x + i % work_tile.w;
+      pixel_work_tile.y = work_tile.y + i / work_tile.w;
+      pixel_work_tile.w = 1;
+      pixel_work_tile.h = 1;
+      pixel_work_tile.start_sample = work_tile.start_sample + sample;
+      pixel_work_tile.num_samples = 1;
+
+      if (has_bake) {
+        pixel_done[i] = !kernels_.integrator_init_from_bake(
+            kernel_globals, state, &pixel_work_tile, render_buffer);
+      }
+      else {
+        pixel_done[i] = !kernels_.integrator_init_from_camera(
+            kernel_globals, state, &pixel_work_tile, render_buffer);
+      }
+    }
+
+    /* Step all paths one kernel at a time. Executing the same kernel and shader for consecutive
+     * paths keeps the instructions and shader data in the caches, similar to the sorting of paths
+     * by shader on the GPU. */
+    while (true) {
+      queue.clear();
+      for (int i = 0; i < pixels_num * 2; ++i) {
+        const uint64_t key = sorted_path_key(&integrator_states[i]);
+        if (key) {
+          queue.emplace_back(key, i);
+        }
+      }
+      if (queue.empty()) {
+        break;
+      }
+
+      std::sort(queue.begin(), queue.end());
+      for (const std::pair<uint64_t, int> &item : queue) {
+        kernels_.integrator_megakernel_step(
+            kernel_globals, &integrator_states[item.second], render_buffer);
+      }
+    }
+  }
+}
+
 void PathTraceWorkCPU::copy_to_display(PathTraceDisplay *display,
                                        PassMode pass_mode,
                                        int num_samples)
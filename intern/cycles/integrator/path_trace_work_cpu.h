@@ -73,6 +73,10 @@ class PathTraceWorkCPU : public PathTraceWork {
                                     const KernelWorkTile &work_tile,
                                     const int samples_num);
 
+  /* Render all samples of a block of pixels, executing the kernels of the paths in an order sorted
+   * by kernel and shader instead of one path after another. */
+  void render_samples_sorted_pipeline(const KernelWorkTile &work_tile);
+
   /* CPU kernels. */
   const CPUKernels &kernels_;
 
@@ -82,6 +86,10 @@ class PathTraceWorkCPU : public PathTraceWork {
    * accessing it, but some "localization" is required to decouple from kernel globals stored
    * on the device level. */
   vector<CPUKernelThreadGlobals> kernel_thread_globals_;
+
+  /* Per-thread path states used when rendering with sorted paths. Allocated on first use since
+   * they are large. */
+  vector<vector<IntegratorStateCPU>> sorted_path_states_;
 };
 
 CCL_NAMESPACE_END
@@ -8,6 +8,7 @@
 
 #include "integrator/pass_accessor_gpu.h"
 #include "scene/scene.h"
+#include "scene/stats.h"
 #include "session/buffers.h"
 #include "util/log.h"
 #include "util/string.h"
@@ -1068,6 +1069,20 @@ void PathTraceWorkGPU::cryptomatte_postproces()
   queue_->enqueue(DEVICE_KERNEL_CRYPTOMATTE_POSTPROCESS, work_size, args);
 }
 
+void PathTraceWorkGPU::set_collect_kernel_stats(bool collect)
+{
+  queue_->set_collect_kernel_stats(collect);
+}
+
+void PathTraceWorkGPU::collect_kernel_stats(RenderStats *render_stats) const
+{
+  for (const auto &[kernel, stats] : queue_->get_kernel_stats()) {
+    render_stats->device_kernels.add_entry(NamedKernelEntry(
+        device_kernel_as_string(kernel), stats.time, stats.work_size, stats.num_launches));
+  }
+  render_stats->has_device_profiling = true;
+}
+
 bool PathTraceWorkGPU::copy_render_buffers_from_device()
 {
   queue_->copy_from_device(buffers_->buffer);
@@ -48,6 +48,9 @@ class PathTraceWorkGPU : public PathTraceWork {
   virtual int adaptive_sampling_converge_filter_count_active(float threshold, bool reset) override;
   virtual void cryptomatte_postproces() override;
 
+  virtual void set_collect_kernel_stats(bool collect) override;
+  virtual void collect_kernel_stats(RenderStats *render_stats) const override;
+
  protected:
   void alloc_integrator_soa();
   void alloc_integrator_queue();
@@ -93,6 +93,12 @@ int RenderScheduler::get_sample_offset() const
 void RenderScheduler::set_time_limit(double time_limit)
 {
   time_limit_ = time_limit;
+
+  /* When rendering within a time budget, lower the noise floor progressively for final renders
+   * too. This way the samples go to the pixels with the most remaining noise first, and the image
+   * has a uniform noise level whenever the time runs out, instead of some areas being converged
+   * and others still noisy. */
+  use_progressive_noise_floor_ = !background_ || time_limit_ != 0.0;
 }
 
 double RenderScheduler::get_time_limit() const
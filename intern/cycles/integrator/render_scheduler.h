@@ -117,7 +117,8 @@ class RenderScheduler {
   int get_sample_offset() const;
 
   /* Time limit for the path tracing tasks, in minutes.
-   * Zero disables the limit. */
+   * Zero disables the limit. With adaptive sampling, a time limit makes the noise threshold be
+   * lowered progressively, like in the viewport. */
   void set_time_limit(double time_limit);
   double get_time_limit() const;
 
@@ -436,7 +437,7 @@ class RenderScheduler {
   AdaptiveSampling adaptive_sampling_;
 
   /* Progressively lower adaptive sampling threshold level, keeping the image at a uniform noise
-   * level. */
+   * level. Used for viewport renders and for renders with a time limit. */
   bool use_progressive_noise_floor_ = false;
 
   /* Default value for the resolution divider which will be used when there is no render time
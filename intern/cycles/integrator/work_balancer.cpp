@@ -37,9 +37,14 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
   return total_time;
 }
 
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* The balance is based on equalizing time which devices spent performing a task. The amount of
+ * work a device does per unit of time is estimated from its current weight and the time it spent,
+ * and the new weights are chosen proportional to it, so that all devices are expected to finish
+ * their work at the same time.
+ *
+ * Moving towards the average time in small steps takes multiple rebalances to converge. Every one
+ * of them re-allocates and copies render buffers, and until then the faster devices are idle
+ * while waiting for the slowest one. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
@@ -48,31 +53,32 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
+  if (time_average <= 0.0) {
+    return false;
+  }
+
   double total_weight = 0;
   vector<double> new_weights;
   new_weights.reserve(num_infos);
 
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
-
   bool has_big_difference = false;
 
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = lerp(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
+    /* A device which did not spend any time (for example, because its slice of the image was
+     * empty) can not be measured, so keep its weight. Otherwise scale the weight by how much
+     * faster or slower than the average the device was. */
+    const double new_weight = (info.time_spent > 0.0) ?
+                                  info.weight * time_average / info.time_spent :
+                                  info.weight;
     new_weights.push_back(new_weight);
     total_weight += new_weight;
 
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    if (std::fabs(1.0 - info.time_spent / time_average) > 0.02) {
       has_big_difference = true;
     }
   }
 
-  if (!has_big_difference) {
+  if (!has_big_difference || total_weight <= 0.0) {
     return false;
   }
 
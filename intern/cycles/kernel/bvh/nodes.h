@@ -15,6 +15,21 @@ ccl_device_forceinline Transform bvh_unaligned_node_fetch_space(KernelGlobals kg
   return space;
 }
 
+/* Decode the quantized bounds of both children along one axis, in the order min0, min1, max0,
+ * max1. See bvh_quantize_axis() in the BVH builder. */
+ccl_device_forceinline float4 bvh_aligned_node_dequantize(const float origin,
+                                                          const uint exponent,
+                                                          const uint bounds)
+{
+  const float scale = __uint_as_float(exponent << 23);
+  return make_float4((float)(bounds & 0xFF),
+                     (float)((bounds >> 8) & 0xFF),
+                     (float)((bounds >> 16) & 0xFF),
+                     (float)(bounds >> 24)) *
+             scale +
+         origin;
+}
+
 ccl_device_forceinline int bvh_aligned_node_intersect(KernelGlobals kg,
                                                       const float3 P,
                                                       const float3 idir,
@@ -29,9 +44,16 @@ ccl_device_forceinline int bvh_aligned_node_intersect(KernelGlobals kg,
 #ifdef __VISIBILITY_FLAG__
   float4 cnodes = kernel_data_fetch(bvh_nodes, node_addr + 0);
 #endif
-  float4 node0 = kernel_data_fetch(bvh_nodes, node_addr + 1);
-  float4 node1 = kernel_data_fetch(bvh_nodes, node_addr + 2);
-  float4 node2 = kernel_data_fetch(bvh_nodes, node_addr + 3);
+  const float4 origin = kernel_data_fetch(bvh_nodes, node_addr + 1);
+  const float4 bounds = kernel_data_fetch(bvh_nodes, node_addr + 2);
+  const uint exponents = __float_as_uint(origin.w);
+
+  const float4 node0 = bvh_aligned_node_dequantize(
+      origin.x, exponents & 0xFF, __float_as_uint(bounds.x));
+  const float4 node1 = bvh_aligned_node_dequantize(
+      origin.y, (exponents >> 8) & 0xFF, __float_as_uint(bounds.y));
+  const float4 node2 = bvh_aligned_node_dequantize(
+      origin.z, (exponents >> 16) & 0xFF, __float_as_uint(bounds.z));
 
   /* intersect ray against child nodes */
   float c0lox = (node0.x - P.x) * idir.x;
@@ -570,7 +570,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_uchar4[offset + k] = data[k];
         }
-        attr_uchar4.tag_modified();
+        attr_uchar4.tag_modified(offset, size);
       }
       attr_uchar4_offset += size;
     }
@@ -583,7 +583,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float[offset + k] = data[k];
         }
-        attr_float.tag_modified();
+        attr_float.tag_modified(offset, size);
       }
       attr_float_offset += size;
     }
@@ -596,7 +596,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float2[offset + k] = data[k];
         }
-        attr_float2.tag_modified();
+        attr_float2.tag_modified(offset, size);
       }
       attr_float2_offset += size;
     }
@@ -609,7 +609,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size * 3; k++) {
           attr_float4[offset + k] = (&tfm->x)[k];
         }
-        attr_float4.tag_modified();
+        attr_float4.tag_modified(offset, size * 3);
       }
       attr_float4_offset += size * 3;
     }
@@ -622,7 +622,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float4[offset + k] = data[k];
         }
-        attr_float4.tag_modified();
+        attr_float4.tag_modified(offset, size);
       }
       attr_float4_offset += size;
     }
@@ -635,7 +635,7 @@ void GeometryManager::update_attribute_element_offset(Geometry *geom,
         for (size_t k = 0; k < size; k++) {
           attr_float3[offset + k] = data[k];
         }
-        attr_float3.tag_modified();
+        attr_float3.tag_modified(offset, size);
       }
       attr_float3_offset += size;
     }
@@ -1034,7 +1034,7 @@ void GeometryManager::geom_calc_offset(Scene *scene, BVHLayout bvh_layout)
   }
 }
 
-void GeometryManager::device_update_mesh(Device *,
+void GeometryManager::device_update_mesh(Device *device,
                                          DeviceScene *dscene,
                                          Scene *scene,
                                          Progress &progress)
@@ -1104,13 +1104,20 @@ void GeometryManager::device_update_mesh(Device *,
       if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
         Mesh *mesh = static_cast<Mesh *>(geom);
 
+        /* Tag the packed ranges, so that only those are copied to the device when the arrays
+         * did not need to be reallocated. */
+        const size_t num_triangles = mesh->num_triangles();
+        const size_t num_verts = mesh->get_verts().size();
+
         if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
             mesh->triangles_is_modified() || copy_all_data) {
           mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+          dscene->tri_shader.tag_modified(mesh->prim_offset, num_triangles);
         }
 
         if (mesh->verts_is_modified() || copy_all_data) {
           mesh->pack_normals(&vnormal[mesh->vert_offset]);
+          dscene->tri_vnormal.tag_modified(mesh->vert_offset, num_verts);
         }
 
         if (mesh->verts_is_modified() || mesh->triangles_is_modified() ||
@@ -1119,6 +1126,10 @@ void GeometryManager::device_update_mesh(Device *,
                            &tri_vindex[mesh->prim_offset],
                            &tri_patch[mesh->prim_offset],
                            &tri_patch_uv[mesh->vert_offset]);
+          dscene->tri_verts.tag_modified(mesh->prim_offset * 3, num_triangles * 3);
+          dscene->tri_vindex.tag_modified(mesh->prim_offset, num_triangles);
+          dscene->tri_patch.tag_modified(mesh->prim_offset, num_triangles);
+          dscene->tri_patch_uv.tag_modified(mesh->vert_offset, num_verts);
         }
 
         if (progress.get_cancel())
@@ -1140,9 +1151,17 @@ void GeometryManager::device_update_mesh(Device *,
   if (curve_segment_size != 0) {
     progress.set_status("Updating Mesh", "Copying Curves to device");
 
+    /* Curve segments are only used by ray-tracing APIs which refer to them by index. The BVH2
+     * leaves store the curve and segment already, so skip the array to save memory. */
+    const BVHLayout bvh_layout = BVHParams::best_bvh_layout(scene->params.bvh_layout,
+                                                            device->get_bvh_layout_mask());
+    const bool need_curve_segments = bvh_layout != BVH_LAYOUT_BVH2;
+
     float4 *curve_keys = dscene->curve_keys.alloc(curve_key_size);
     KernelCurve *curves = dscene->curves.alloc(curve_size);
-    KernelCurveSegment *curve_segments = dscene->curve_segments.alloc(curve_segment_size);
+    KernelCurveSegment *curve_segments = need_curve_segments ?
+                                             dscene->curve_segments.alloc(curve_segment_size) :
+                                             nullptr;
 
     const bool copy_all_data = dscene->curve_keys.need_realloc() ||
                                dscene->curves.need_realloc() ||
@@ -1164,7 +1183,8 @@ void GeometryManager::device_update_mesh(Device *,
         hair->pack_curves(scene,
                           &curve_keys[hair->curve_key_offset],
                           &curves[hair->prim_offset],
-                          &curve_segments[hair->curve_segment_offset]);
+                          curve_segments ? &curve_segments[hair->curve_segment_offset] :
+                                           nullptr);
         if (progress.get_cancel())
           return;
       }
@@ -1172,7 +1192,9 @@ void GeometryManager::device_update_mesh(Device *,
 
     dscene->curve_keys.copy_to_device_if_modified();
     dscene->curves.copy_to_device_if_modified();
-    dscene->curve_segments.copy_to_device_if_modified();
+    if (need_curve_segments) {
+      dscene->curve_segments.copy_to_device_if_modified();
+    }
   }
 
   if (point_size != 0) {
@@ -1242,9 +1264,11 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG_INFO << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
+  /* Embree falls back to a full build when objects changed how they are added to the scene. */
   const bool can_refit = scene->bvh != nullptr &&
                          (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
-                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
+                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL ||
+                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_EMBREE);
 
   BVH *bvh = scene->bvh;
   if (!scene->bvh) {
@@ -1819,6 +1843,10 @@ void GeometryManager::device_update(Device *device,
                                    dicing_camera->get_full_height());
     dicing_camera->update(scene);
 
+    /* Meshes are tessellated independently of each other, so they can be diced in parallel. This
+     * matters most for scenes with many small displaced objects. */
+    TaskPool pool;
+
     size_t i = 0;
     foreach (Geometry *geom, scene->geometry) {
       if (!(geom->is_modified() && geom->is_mesh())) {
@@ -1827,27 +1855,34 @@ void GeometryManager::device_update(Device *device,
 
       Mesh *mesh = static_cast<Mesh *>(geom);
       if (mesh->need_tesselation()) {
-        string msg = "Tessellating ";
-        if (mesh->name == "")
-          msg += string_printf("%u/%u", (uint)(i + 1), (uint)total_tess_needed);
-        else
-          msg += string_printf(
-              "%s %u/%u", mesh->name.c_str(), (uint)(i + 1), (uint)total_tess_needed);
+        mesh->subd_params->camera = dicing_camera;
 
-        progress.set_status("Updating Mesh", msg);
+        pool.push([mesh, i, total_tess_needed, &progress]() {
+          if (progress.get_cancel()) {
+            return;
+          }
 
-        mesh->subd_params->camera = dicing_camera;
-        DiagSplit dsplit(*mesh->subd_params);
-        mesh->tessellate(&dsplit);
+          string msg = "Tessellating ";
+          if (mesh->name == "")
+            msg += string_printf("%u/%u", (uint)(i + 1), (uint)total_tess_needed);
+          else
+            msg += string_printf(
+                "%s %u/%u", mesh->name.c_str(), (uint)(i + 1), (uint)total_tess_needed);
 
-        i++;
+          progress.set_status("Updating Mesh", msg);
 
-        if (progress.get_cancel()) {
-          return;
-        }
+          DiagSplit dsplit(*mesh->subd_params);
+          mesh->tessellate(&dsplit);
+        });
+
+        i++;
       }
     }
 
+    TaskPool::Summary summary;
+    pool.wait_work(&summary);
+    VLOG_WORK << "Tessellation pool statistics:\n" << summary.full_report();
+
     if (progress.get_cancel()) {
       return;
     }
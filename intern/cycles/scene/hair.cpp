@@ -491,6 +491,10 @@ void Hair::pack_curves(Scene *scene,
     curves[i].num_keys = curve.num_keys;
     curves[i].type = type;
 
+    if (curve_segments == nullptr) {
+      continue;
+    }
+
     for (int k = 0; k < curve.num_segments(); ++k, ++index) {
       curve_segments[index].prim = prim_offset + i;
       curve_segments[index].type = PRIMITIVE_PACK_SEGMENT(type, k);
@@ -76,6 +76,49 @@ const char *name_from_type(ImageDataType type)
   return "";
 }
 
+/* Size in bytes of one pixel, zero for types that can not be scaled down. */
+size_t pixel_size_from_type(ImageDataType type)
+{
+  switch (type) {
+    case IMAGE_DATA_TYPE_FLOAT4:
+      return sizeof(float4);
+    case IMAGE_DATA_TYPE_BYTE4:
+      return sizeof(uchar4);
+    case IMAGE_DATA_TYPE_HALF4:
+      return sizeof(half4);
+    case IMAGE_DATA_TYPE_FLOAT:
+      return sizeof(float);
+    case IMAGE_DATA_TYPE_BYTE:
+      return sizeof(uchar);
+    case IMAGE_DATA_TYPE_HALF:
+      return sizeof(half);
+    case IMAGE_DATA_TYPE_USHORT4:
+      return sizeof(ushort4);
+    case IMAGE_DATA_TYPE_USHORT:
+      return sizeof(uint16_t);
+    default:
+      return 0;
+  }
+}
+
+/* Size in bytes of the image texture once it is scaled down to the texture limit, in the same
+ * way as ImageManager::file_load_image(). */
+size_t image_memory_size(const ImageMetaData &metadata, const int texture_limit)
+{
+  const size_t max_size = max(max(metadata.width, metadata.height), metadata.depth);
+  double scale_factor = 1.0;
+  if (texture_limit > 0) {
+    while (max_size * scale_factor > texture_limit) {
+      scale_factor *= 0.5;
+    }
+  }
+
+  const double num_pixels = double(metadata.width) * scale_factor *
+                            double(metadata.height) * scale_factor *
+                            ((metadata.depth > 1) ? double(metadata.depth) * scale_factor : 1.0);
+  return size_t(num_pixels) * pixel_size_from_type(metadata.type);
+}
+
 }  // namespace
 
 /* Image Handle */
@@ -321,6 +364,7 @@ ImageManager::ImageManager(const DeviceInfo &info)
   need_update_ = true;
   osl_texture_system = NULL;
   animation_frame = 0;
+  memory_texture_limit = 0;
 
   /* Set image limits */
   features.has_nanovdb = info.has_nanovdb;
@@ -691,7 +735,10 @@ void ImageManager::device_load_image(Device *device, Scene *scene, int slot, Pro
 
   progress->set_status("Updating Images", "Loading " + img->loader->name());
 
-  const int texture_limit = scene->params.texture_limit;
+  int texture_limit = scene->params.texture_limit;
+  if (memory_texture_limit > 0 && (texture_limit == 0 || memory_texture_limit < texture_limit)) {
+    texture_limit = memory_texture_limit;
+  }
 
   load_image_metadata(img);
   ImageDataType type = img->metadata.type;
@@ -863,6 +910,17 @@ void ImageManager::device_update(Device *device, Scene *scene, Progress &progres
       device_free_image(device, slot);
     }
     else if (img && img->need_load) {
+      pool.push(function_bind(&ImageManager::load_image_metadata, this, img));
+    }
+  }
+
+  pool.wait_work();
+
+  memory_texture_limit = compute_memory_texture_limit(device, scene->params.texture_limit);
+
+  for (size_t slot = 0; slot < images.size(); slot++) {
+    Image *img = images[slot];
+    if (img && img->need_load) {
       pool.push(
           function_bind(&ImageManager::device_load_image, this, device, scene, slot, &progress));
     }
@@ -873,6 +931,52 @@ void ImageManager::device_update(Device *device, Scene *scene, Progress &progres
   need_update_ = false;
 }
 
+int ImageManager::compute_memory_texture_limit(Device *device, const int texture_limit)
+{
+  size_t total_memory = 0, free_memory = 0;
+  if (!device->get_memory_info(total_memory, free_memory)) {
+    return 0;
+  }
+
+  /* Leave a quarter of the free memory for render buffers and other working memory that is
+   * allocated after the images. */
+  const size_t budget = free_memory - free_memory / 4;
+
+  size_t max_size = 0;
+  foreach (const Image *img, images) {
+    if (img && img->need_load) {
+      const ImageMetaData &metadata = img->metadata;
+      max_size = max(max_size, max(max(metadata.width, metadata.height), metadata.depth));
+    }
+  }
+
+  /* Halve the limit until the images fit, which scales down the largest images first. */
+  const int min_texture_limit = 128;
+  int limit = (texture_limit > 0) ? texture_limit : int(next_power_of_two(uint(max_size)));
+  const int initial_limit = limit;
+  while (true) {
+    size_t memory_size = 0;
+    foreach (const Image *img, images) {
+      if (img && img->need_load) {
+        memory_size += image_memory_size(img->metadata, limit);
+      }
+    }
+
+    if (memory_size <= budget || limit <= min_texture_limit) {
+      break;
+    }
+    limit /= 2;
+  }
+
+  if (limit == initial_limit) {
+    return 0;
+  }
+
+  VLOG_WARNING << "Images do not fit in " << string_human_readable_size(budget)
+               << " of available device memory, limiting their resolution to " << limit << ".";
+  return limit;
+}
+
 void ImageManager::device_update_slot(Device *device, Scene *scene, int slot, Progress *progress)
 {
   Image *img = images[slot];
@@ -217,6 +217,8 @@ class ImageManager {
   thread_mutex device_mutex;
   thread_mutex images_mutex;
   int animation_frame;
+  /* Computed by compute_memory_texture_limit() on every update. */
+  int memory_texture_limit;
 
   vector<Image *> images;
   void *osl_texture_system;
@@ -231,6 +233,9 @@ class ImageManager {
   bool file_load_image(Image *img, int texture_limit);
 
   void device_load_image(Device *device, Scene *scene, int slot, Progress *progress);
+  /* Texture size limit that makes the images that need to be loaded fit in the free device
+   * memory, or zero when there is enough memory or the device can not report it. */
+  int compute_memory_texture_limit(Device *device, const int texture_limit);
   void device_free_image(Device *device, int slot);
 
   friend class ImageHandle;
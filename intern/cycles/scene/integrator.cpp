@@ -20,7 +20,6 @@
 #include "util/foreach.h"
 #include "util/hash.h"
 #include "util/log.h"
-#include "util/task.h"
 #include "util/time.h"
 
 CCL_NAMESPACE_BEGIN
@@ -135,6 +134,7 @@ NODE_DEFINE(Integrator)
               "Denoiser Prefilter",
               denoiser_prefilter_enum,
               DENOISER_PREFILTER_ACCURATE);
+  SOCKET_INT(denoiser_max_memory, "Denoiser Max Memory", 0);
 
   return type;
 }
@@ -276,12 +276,7 @@ void Integrator::device_update(Device *device, DeviceScene *dscene, Scene *scene
     }
     float4 *directions = (float4 *)dscene->sample_pattern_lut.alloc(
         sequence_size * NUM_TAB_SOBOL_PATTERNS * NUM_TAB_SOBOL_DIMENSIONS);
-    TaskPool pool;
-    for (int j = 0; j < NUM_TAB_SOBOL_PATTERNS; ++j) {
-      float4 *sequence = directions + j * sequence_size;
-      pool.push(function_bind(&tabulated_sobol_generate_4D, sequence, sequence_size, j));
-    }
-    pool.wait_work();
+    tabulated_sobol_fill_table(directions, sequence_size);
 
     dscene->sample_pattern_lut.copy_to_device();
   }
@@ -393,6 +388,8 @@ DenoiseParams Integrator::get_denoise_params() const
 
   denoise_params.prefilter = denoiser_prefilter;
 
+  denoise_params.max_memory_mb = denoiser_max_memory;
+
   return denoise_params;
 }
 
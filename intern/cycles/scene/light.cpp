@@ -23,6 +23,7 @@
 #include "util/path.h"
 #include "util/progress.h"
 #include "util/task.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -464,6 +465,7 @@ void LightManager::device_update_tree(Device *,
   KernelIntegrator *kintegrator = &dscene->data.integrator;
 
   if (!kintegrator->use_light_tree) {
+    light_tree_.reset();
     dscene->light_tree_nodes.free();
     dscene->light_tree_emitters.free();
     dscene->light_to_tree.free();
@@ -475,10 +477,11 @@ void LightManager::device_update_tree(Device *,
   /* Update light tree. */
   progress.set_status("Updating Lights", "Computing tree");
 
-  /* Add both lights and emissive triangles to this vector for light tree construction. */
-  vector<LightTreePrimitive> light_prims;
-  light_prims.reserve(kintegrator->num_distribution);
-  vector<LightTreePrimitive> distant_lights;
+  /* Add both lights and emissive triangles to this vector for light tree construction, as pairs
+   * of primitive and object or light index. */
+  vector<pair<int, int>> emitters;
+  emitters.reserve(kintegrator->num_distribution);
+  vector<pair<int, int>> distant_lights;
   distant_lights.reserve(kintegrator->num_distant_lights);
   vector<uint> object_lookup_offsets(scene->objects.size());
 
@@ -490,10 +493,10 @@ void LightManager::device_update_tree(Device *,
   foreach (Light *light, scene->lights) {
     if (light->is_enabled) {
       if (light->light_type == LIGHT_BACKGROUND || light->light_type == LIGHT_DISTANT) {
-        distant_lights.emplace_back(scene, ~device_light_index, scene_light_index);
+        distant_lights.emplace_back(~device_light_index, scene_light_index);
       }
       else {
-        light_prims.emplace_back(scene, ~device_light_index, scene_light_index);
+        emitters.emplace_back(~device_light_index, scene_light_index);
       }
 
       device_light_index++;
@@ -527,7 +530,7 @@ void LightManager::device_update_tree(Device *,
                            scene->default_surface;
 
       if (shader->emission_sampling != EMISSION_SAMPLING_NONE) {
-        light_prims.emplace_back(scene, i, object_id);
+        emitters.emplace_back(i, object_id);
       }
     }
 
@@ -535,15 +538,47 @@ void LightManager::device_update_tree(Device *,
     object_id++;
   }
 
-  /* Append distant lights to the end of `light_prims` */
-  std::move(distant_lights.begin(), distant_lights.end(), std::back_inserter(light_prims));
+  /* Append distant lights to the end of `emitters` */
+  emitters.insert(emitters.end(), distant_lights.begin(), distant_lights.end());
 
   /* Update integrator state. */
-  kintegrator->use_direct_light = !light_prims.empty();
-
-  /* TODO: For now, we'll start with a smaller number of max lights in a node.
-   * More benchmarking is needed to determine what number works best. */
-  LightTree light_tree(light_prims, kintegrator->num_distant_lights, 8);
+  kintegrator->use_direct_light = !emitters.empty();
+
+  /* Creating the primitives evaluates the geometry of every emissive triangle, which is done in
+   * parallel since meshes may contain millions of them. */
+  vector<LightTreePrimitive> light_prims(emitters.size());
+  auto create_light_prims = [&](const vector<pair<int, int>> &keys) {
+    parallel_for(blocked_range<size_t>(0, keys.size(), 1024), [&](const blocked_range<size_t> &r) {
+      for (size_t i = r.begin(); i != r.end(); i++) {
+        light_prims[i] = LightTreePrimitive(scene, keys[i].first, keys[i].second);
+      }
+    });
+  };
+
+  if (light_tree_ && light_tree_num_distant_lights_ == kintegrator->num_distant_lights &&
+      light_tree_emitters_ == emitters) {
+    /* Only the transform, geometry or strength of the emitters changed, refit the existing tree
+     * instead of building a new one. The tree is less efficient to sample when emitters moved a
+     * lot, but this avoids a full build for every frame of an animation. */
+    create_light_prims(light_tree_sorted_emitters_);
+    light_tree_->refit(light_prims);
+  }
+  else {
+    create_light_prims(emitters);
+
+    /* TODO: For now, we'll start with a smaller number of max lights in a node.
+     * More benchmarking is needed to determine what number works best. */
+    light_tree_ = make_unique<LightTree>(light_prims, kintegrator->num_distant_lights, 8);
+    light_tree_num_distant_lights_ = kintegrator->num_distant_lights;
+    light_tree_emitters_ = std::move(emitters);
+
+    /* The build reorders the primitives, remember their order for refitting. */
+    light_tree_sorted_emitters_.resize(light_prims.size());
+    for (size_t i = 0; i < light_prims.size(); i++) {
+      light_tree_sorted_emitters_[i] = {light_prims[i].prim_id, light_prims[i].object_id};
+    }
+  }
+  const LightTree &light_tree = *light_tree_;
 
   /* We want to create separate arrays corresponding to triangles and lights,
    * which will be used to index back into the light tree for PDF calculations. */
@@ -1157,6 +1192,7 @@ void LightManager::device_update(Device *device,
 void LightManager::device_free(Device *, DeviceScene *dscene, const bool free_background)
 {
   /* to-do: check if the light tree member variables need to be wrapped in a conditional too*/
+  light_tree_.reset();
   dscene->light_tree_nodes.free();
   dscene->light_tree_emitters.free();
   dscene->light_to_tree.free();
@@ -14,14 +14,17 @@
 #include "scene/shader.h"
 
 #include "util/ies.h"
+#include "util/map.h"
 #include "util/thread.h"
 #include "util/types.h"
+#include "util/unique_ptr.h"
 #include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
 
 class Device;
 class DeviceScene;
+class LightTree;
 class Object;
 class Progress;
 class Scene;
@@ -156,6 +159,14 @@ class LightManager {
   bool last_background_enabled;
   int last_background_resolution;
 
+  /* Light tree of the last update, which is refit instead of rebuilt when the emitters did not
+   * change. Emitters are stored as pairs of primitive and object or light index, both in the order
+   * they were added and in the order of the tree. */
+  unique_ptr<LightTree> light_tree_;
+  vector<pair<int, int>> light_tree_emitters_;
+  vector<pair<int, int>> light_tree_sorted_emitters_;
+  int light_tree_num_distant_lights_ = 0;
+
   uint32_t update_flags;
 };
 
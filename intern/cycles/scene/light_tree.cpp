@@ -5,8 +5,14 @@
 #include "scene/mesh.h"
 #include "scene/object.h"
 
+#include "util/tbb.h"
+
 CCL_NAMESPACE_BEGIN
 
+/* Subtrees with at least this many primitives are built in parallel. Smaller ones are not worth
+ * the overhead of a task and of copying the nodes. */
+static const int LIGHT_TREE_PARALLEL_BUILD_SIZE = 4096;
+
 float OrientationBounds::calculate_measure() const
 {
   float theta_w = fminf(M_PI_F, theta_o + theta_e);
@@ -201,8 +207,8 @@ LightTree::LightTree(vector<LightTreePrimitive> &prims,
   /* The amount of nodes is estimated to be twice the amount of primitives */
   nodes_.reserve(2 * num_prims);
 
-  nodes_.emplace_back();                             /* root node */
-  recursive_build(0, num_local_lights, prims, 0, 1); /* build tree */
+  nodes_.emplace_back();                                     /* root node */
+  recursive_build(0, num_local_lights, prims, 0, 1, nodes_); /* build tree */
   nodes_[0].make_interior(nodes_.size());
 
   /* All distant lights are grouped to one node (right child of the root node) */
@@ -224,15 +230,51 @@ const vector<LightTreeNode> &LightTree::get_nodes() const
   return nodes_;
 }
 
-int LightTree::recursive_build(
-    int start, int end, vector<LightTreePrimitive> &prims, uint bit_trail, int depth)
+void LightTree::refit(const vector<LightTreePrimitive> &prims)
+{
+  /* Children are always stored after their parent, so iterating backwards updates them first.
+   * The root node is not used for sampling and is left as it is. */
+  for (int index = nodes_.size() - 1; index > 0; index--) {
+    LightTreeNode &node = nodes_[index];
+    BoundBox bbox = BoundBox::empty;
+    OrientationBounds bcone = OrientationBounds::empty;
+    float energy_total = 0.0f;
+
+    if (node.is_leaf()) {
+      for (int i = node.first_prim_index; i < node.first_prim_index + node.num_prims; i++) {
+        const LightTreePrimitive &prim = prims[i];
+        bbox.grow(prim.bbox);
+        bcone = merge(bcone, prim.bcone);
+        energy_total += prim.energy;
+      }
+    }
+    else {
+      const LightTreeNode &left = nodes_[index + 1];
+      const LightTreeNode &right = nodes_[node.right_child_index];
+      bbox = merge(left.bbox, right.bbox);
+      bcone = merge(left.bcone, right.bcone);
+      energy_total = left.energy + right.energy;
+    }
+
+    node.bbox = bbox;
+    node.bcone = bcone;
+    node.energy = energy_total;
+  }
+}
+
+int LightTree::recursive_build(int start,
+                               int end,
+                               vector<LightTreePrimitive> &prims,
+                               uint bit_trail,
+                               int depth,
+                               vector<LightTreeNode> &nodes)
 {
   BoundBox bbox = BoundBox::empty;
   OrientationBounds bcone = OrientationBounds::empty;
   BoundBox centroid_bounds = BoundBox::empty;
   float energy_total = 0.0;
   int num_prims = end - start;
-  int current_index = nodes_.size();
+  int current_index = nodes.size();
 
   for (int i = start; i < end; i++) {
     const LightTreePrimitive &prim = prims.at(i);
@@ -243,7 +285,7 @@ int LightTree::recursive_build(
     energy_total += prim.energy;
   }
 
-  nodes_.emplace_back(bbox, bcone, energy_total, bit_trail);
+  nodes.emplace_back(bbox, bcone, energy_total, bit_trail);
 
   bool try_splitting = num_prims > 1 && len(centroid_bounds.size()) > 0.0f;
   int split_dim = -1, split_bucket = 0, num_left_prims = 0;
@@ -274,13 +316,38 @@ int LightTree::recursive_build(
       middle = (start + end) / 2;
     }
 
-    [[maybe_unused]] int left_index = recursive_build(start, middle, prims, bit_trail, depth + 1);
-    int right_index = recursive_build(middle, end, prims, bit_trail | (1u << depth), depth + 1);
-    assert(left_index == current_index + 1);
-    nodes_[current_index].make_interior(right_index);
+    const uint right_bit_trail = bit_trail | (1u << depth);
+    if (num_prims >= LIGHT_TREE_PARALLEL_BUILD_SIZE) {
+      /* Build the right subtree into its own array in parallel, and append it afterwards. The
+       * primitive ranges of both subtrees don't overlap, so they can be partitioned at the same
+       * time. */
+      vector<LightTreeNode> right_nodes;
+      tbb::task_group tasks;
+      tasks.run([&]() {
+        recursive_build(middle, end, prims, right_bit_trail, depth + 1, right_nodes);
+      });
+      recursive_build(start, middle, prims, bit_trail, depth + 1, nodes);
+      tasks.wait();
+
+      const int right_index = nodes.size();
+      for (LightTreeNode &node : right_nodes) {
+        if (!node.is_leaf()) {
+          node.right_child_index += right_index;
+        }
+      }
+      nodes.insert(nodes.end(), right_nodes.begin(), right_nodes.end());
+      nodes[current_index].make_interior(right_index);
+    }
+    else {
+      [[maybe_unused]] int left_index = recursive_build(
+          start, middle, prims, bit_trail, depth + 1, nodes);
+      int right_index = recursive_build(middle, end, prims, right_bit_trail, depth + 1, nodes);
+      assert(left_index == current_index + 1);
+      nodes[current_index].make_interior(right_index);
+    }
   }
   else {
-    nodes_[current_index].make_leaf(start, num_prims);
+    nodes[current_index].make_leaf(start, num_prims);
   }
   return current_index;
 }
@@ -65,6 +65,7 @@ struct LightTreePrimitive {
   OrientationBounds bcone;
   BoundBox bbox;
 
+  LightTreePrimitive() = default;
   LightTreePrimitive(Scene *scene, int prim_id, int object_id);
 
   inline bool is_triangle() const
@@ -141,9 +142,18 @@ class LightTree {
 
   const vector<LightTreeNode> &get_nodes() const;
 
+  /* Update the bounds and energy of all nodes while keeping the tree topology, for when emitters
+   * moved or changed strength. The primitives must be the same ones the tree was built with, in
+   * the order they were left in by the build. */
+  void refit(const vector<LightTreePrimitive> &prims);
+
  private:
-  int recursive_build(
-      int start, int end, vector<LightTreePrimitive> &prims, uint bit_trail, int depth);
+  int recursive_build(int start,
+                      int end,
+                      vector<LightTreePrimitive> &prims,
+                      uint bit_trail,
+                      int depth,
+                      vector<LightTreeNode> &nodes);
   float min_split_saoh(const BoundBox &centroid_bbox,
                        int start,
                        int end,
@@ -6544,6 +6544,72 @@ void MathNode::constant_fold(const ConstantFolder &folder)
   }
   else {
     folder.fold_math(math_type);
+
+    if (math_type == NODE_MATH_ADD && !output("Value")->links.empty()) {
+      fuse_multiply_add(folder.graph);
+    }
+  }
+}
+
+/* Merge a multiply node that only feeds into this add node, so that a single multiply add node
+ * is compiled instead of two nodes. */
+void MathNode::fuse_multiply_add(ShaderGraph *graph)
+{
+  for (int i = 0; i < 2; i++) {
+    ShaderInput *product_in = input((i == 0) ? "Value1" : "Value2");
+    ShaderInput *addend_in = input((i == 0) ? "Value2" : "Value1");
+    ShaderOutput *product_out = product_in->link;
+
+    if (product_out == NULL || product_out->links.size() != 1 ||
+        product_out->parent->type != MathNode::get_node_type()) {
+      continue;
+    }
+
+    MathNode *multiply = static_cast<MathNode *>(product_out->parent);
+    if (multiply->get_math_type() != NODE_MATH_MULTIPLY) {
+      continue;
+    }
+
+    VLOG_DEBUG << "Fusing " << multiply->name << "::" << product_out->name()
+               << " into multiply add " << name << ".";
+
+    ShaderOutput *addend_link = addend_in->link;
+    const float addend = (i == 0) ? value2 : value1;
+
+    graph->disconnect(product_in);
+    if (addend_link) {
+      graph->disconnect(addend_in);
+    }
+
+    ShaderInput *value3_in = input("Value3");
+    if (value3_in->link) {
+      graph->disconnect(value3_in);
+    }
+
+    /* The factors of the multiply become the first two inputs, the addend the third one. */
+    ShaderInput *factor1_in = multiply->input("Value1");
+    ShaderInput *factor2_in = multiply->input("Value2");
+    if (factor1_in->link) {
+      graph->connect(factor1_in->link, input("Value1"));
+    }
+    else {
+      set_value1(multiply->get_value1());
+    }
+    if (factor2_in->link) {
+      graph->connect(factor2_in->link, input("Value2"));
+    }
+    else {
+      set_value2(multiply->get_value2());
+    }
+    if (addend_link) {
+      graph->connect(addend_link, value3_in);
+    }
+    else {
+      set_value3(addend);
+    }
+
+    set_math_type(NODE_MATH_MULTIPLY_ADD);
+    return;
   }
 }
 
@@ -1369,6 +1369,7 @@ class MathNode : public ShaderNode {
   SHADER_NODE_CLASS(MathNode)
   void expand(ShaderGraph *graph);
   void constant_fold(const ConstantFolder &folder);
+  void fuse_multiply_add(ShaderGraph *graph);
 
   NODE_SOCKET_API(float, value1)
   NODE_SOCKET_API(float, value2)
@@ -38,6 +38,12 @@ bool namedSampleCountPairComparator(const NamedSampleCountPair &a, const NamedSa
   return a.samples > b.samples;
 }
 
+bool namedKernelEntryComparator(const NamedKernelEntry &a, const NamedKernelEntry &b)
+{
+  /* We sort in descending order. */
+  return a.time > b.time;
+}
+
 }  // namespace
 
 NamedSizeEntry::NamedSizeEntry() : name(""), size(0)
@@ -102,6 +108,52 @@ string NamedTimeStats::full_report(int indent_level)
   return result;
 }
 
+/* Named kernel statistics. */
+
+NamedKernelEntry::NamedKernelEntry(const string &name,
+                                   double time,
+                                   uint64_t work_size,
+                                   uint64_t num_launches)
+    : name(name), time(time), work_size(work_size), num_launches(num_launches)
+{
+}
+
+NamedKernelStats::NamedKernelStats() : total_time(0.0)
+{
+}
+
+void NamedKernelStats::add_entry(const NamedKernelEntry &entry)
+{
+  total_time += entry.time;
+  foreach (NamedKernelEntry &existing_entry, entries) {
+    if (existing_entry.name == entry.name) {
+      existing_entry.time += entry.time;
+      existing_entry.work_size += entry.work_size;
+      existing_entry.num_launches += entry.num_launches;
+      return;
+    }
+  }
+  entries.push_back(entry);
+}
+
+string NamedKernelStats::full_report(int indent_level)
+{
+  const string indent(indent_level * kIndentNumSpaces, ' ');
+  const string double_indent = indent + indent;
+  string result = "";
+  result += string_printf("%sTotal time: %fs\n", indent.c_str(), total_time);
+  sort(entries.begin(), entries.end(), namedKernelEntryComparator);
+  foreach (const NamedKernelEntry &entry, entries) {
+    result += string_printf("%s%-40s %fs, %s items in %s launches\n",
+                            double_indent.c_str(),
+                            entry.name.c_str(),
+                            entry.time,
+                            string_human_readable_number(entry.work_size).c_str(),
+                            string_human_readable_number(entry.num_launches).c_str());
+  }
+  return result;
+}
+
 /* Named time sample statistics. */
 
 NamedNestedSampleStats::NamedNestedSampleStats() : name(""), self_samples(0), sum_samples(0)
@@ -244,6 +296,7 @@ string ImageStats::full_report(int indent_level)
 RenderStats::RenderStats()
 {
   has_profiling = false;
+  has_device_profiling = false;
 }
 
 void RenderStats::collect_profiling(Scene *scene, Profiler &prof)
@@ -307,8 +360,11 @@ string RenderStats::full_report()
     result += "Shader statistics:\n" + shaders.full_report(1);
     result += "Object statistics:\n" + objects.full_report(1);
   }
+  else if (has_device_profiling) {
+    result += "Device kernel statistics:\n" + device_kernels.full_report(1);
+  }
   else {
-    result += "Profiling information not available (only works with CPU rendering)";
+    result += "Profiling information not available";
   }
   return result;
 }
@@ -134,6 +134,35 @@ class NamedSampleCountStats {
   entry_map entries;
 };
 
+/* Execution statistics of a device kernel. The work size is the number of items the kernel was
+ * launched for, for example the number of rays for the intersection kernels. */
+class NamedKernelEntry {
+ public:
+  NamedKernelEntry(const string &name, double time, uint64_t work_size, uint64_t num_launches);
+
+  string name;
+  double time;
+  uint64_t work_size;
+  uint64_t num_launches;
+};
+
+/* Contains execution statistics of all device kernels. Entries with the same name are merged,
+ * to accumulate statistics of multiple devices. */
+class NamedKernelStats {
+ public:
+  NamedKernelStats();
+
+  void add_entry(const NamedKernelEntry &entry);
+
+  /* Generate full human-readable report. */
+  string full_report(int indent_level = 0);
+
+  /* Total time of all entries. */
+  double total_time;
+
+  vector<NamedKernelEntry> entries;
+};
+
 /* Statistics about mesh in the render database. */
 class MeshStats {
  public:
@@ -173,6 +202,10 @@ class RenderStats {
 
   bool has_profiling;
 
+  /* Execution statistics of device kernels, collected when profiling GPU rendering. */
+  bool has_device_profiling;
+  NamedKernelStats device_kernels;
+
   MeshStats mesh;
   ImageStats image;
   NamedNestedSampleStats kernel;
@@ -6,9 +6,15 @@
  */
 
 #include "scene/tabulated_sobol.h"
+
+#include "kernel/types.h"
+
 #include "util/hash.h"
+#include "util/task.h"
+#include "util/thread.h"
 
 #include <math.h>
+#include <string.h>
 #include <vector>
 
 CCL_NAMESPACE_BEGIN
@@ -68,4 +74,33 @@ void tabulated_sobol_generate_4D(float4 points[], int size, int rng_seed)
   }
 }
 
+void tabulated_sobol_fill_table(float4 table[], const int sequence_size)
+{
+  /* Uses std::vector, since the cache outlives the guarded allocator at exit. */
+  static thread_mutex cache_mutex;
+  static std::vector<float4> cache;
+  static int cache_sequence_size = 0;
+
+  const size_t table_size = size_t(sequence_size) * NUM_TAB_SOBOL_PATTERNS;
+
+  thread_scoped_lock cache_lock(cache_mutex);
+
+  if (cache_sequence_size != sequence_size) {
+    cache.resize(table_size);
+
+    TaskPool pool;
+    for (int j = 0; j < NUM_TAB_SOBOL_PATTERNS; ++j) {
+      float4 *sequence = cache.data() + size_t(j) * sequence_size;
+      pool.push([sequence, sequence_size, j]() {
+        tabulated_sobol_generate_4D(sequence, sequence_size, j);
+      });
+    }
+    pool.wait_work();
+
+    cache_sequence_size = sequence_size;
+  }
+
+  memcpy(table, cache.data(), sizeof(float4) * table_size);
+}
+
 CCL_NAMESPACE_END
@@ -10,6 +10,13 @@ CCL_NAMESPACE_BEGIN
 
 void tabulated_sobol_generate_4D(float4 points[], int size, int rng_seed);
 
+/* Fill the table with all NUM_TAB_SOBOL_PATTERNS patterns of the given sequence size.
+ *
+ * The table only depends on the sequence size, so the most recently generated one is kept in
+ * memory. Rendering many frames in a row with the same number of samples only generates the
+ * table once. */
+void tabulated_sobol_fill_table(float4 table[], int sequence_size);
+
 CCL_NAMESPACE_END
 
 #endif /* __TABULATED_SOBOL_H__ */
@@ -174,14 +174,15 @@ class RenderBuffers {
  * content corresponds to a render result at a non-unit resolution divider.
  *
  * `src_offset` allows to offset source pixel index which is used when a fraction of the source
- * buffer is to be copied.
+ * buffer is to be copied. Similarly, `dst_offset` is the index of the first destination pixel.
  *
  * Copy happens of the number of pixels in the destination. */
 void render_buffers_host_copy_denoised(RenderBuffers *dst,
                                        const BufferParams &dst_params,
                                        const RenderBuffers *src,
                                        const BufferParams &src_params,
-                                       const size_t src_offset = 0);
+                                       const size_t src_offset = 0,
+                                       const size_t dst_offset = 0);
 
 CCL_NAMESPACE_END
 
@@ -251,8 +251,13 @@ void Session::thread_run()
 
 void Session::thread_render()
 {
-  if (params.use_profiling && (params.device.type == DEVICE_CPU)) {
-    profiler.start();
+  if (params.use_profiling) {
+    if (params.device.type == DEVICE_CPU) {
+      profiler.start();
+    }
+    else {
+      path_trace_->set_collect_kernel_stats(true);
+    }
   }
 
   /* session thread loop */
@@ -714,8 +719,13 @@ void Session::device_free()
 void Session::collect_statistics(RenderStats *render_stats)
 {
   scene->collect_statistics(render_stats);
-  if (params.use_profiling && (params.device.type == DEVICE_CPU)) {
-    render_stats->collect_profiling(scene, profiler);
+  if (params.use_profiling) {
+    if (params.device.type == DEVICE_CPU) {
+      render_stats->collect_profiling(scene, profiler);
+    }
+    else {
+      path_trace_->collect_kernel_stats(render_stats);
+    }
   }
 }
 
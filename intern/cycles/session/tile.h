@@ -92,6 +92,15 @@ class TileManager {
    * The file will be considered final, all handles to it will be closed. */
   void finish_write_tiles();
 
+  /* Check whether finished tiles are to be written to a file on disk, to be processed as a full
+   * frame once all tiles are rendered. This is only needed when the full frame is required for
+   * post-processing such as denoising, otherwise tiles are written to the output driver as soon as
+   * they are finished. */
+  inline bool use_tile_file() const
+  {
+    return write_state_.use_tile_file;
+  }
+
   /* Check whether any tile has been written to disk. */
   inline bool has_written_tiles() const
   {
@@ -172,6 +181,9 @@ class TileManager {
      * the state and is created whenever writing is requested. */
     unique_ptr<ImageOutput> tile_out;
 
+    /* True when tiles are written to the file, see #use_tile_file(). */
+    bool use_tile_file = false;
+
     int num_tiles_written = 0;
   } write_state_;
 };
@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright 2011-2022 Blender Foundation */
+
+#include "testing/testing.h"
+
+#include "integrator/work_balancer.h"
+
+CCL_NAMESPACE_BEGIN
+
+TEST(work_balance, Initial)
+{
+  vector<WorkBalanceInfo> infos(4);
+  work_balance_do_initial(infos);
+
+  for (const WorkBalanceInfo &info : infos) {
+    EXPECT_NEAR(info.weight, 0.25, 1e-6);
+  }
+}
+
+TEST(work_balance, RebalanceEqualTime)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 1.01;
+
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+TEST(work_balance, RebalanceConvergesInOneStep)
+{
+  /* The first device is three times faster than the second one. */
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 3.0;
+
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.75, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.25, 1e-6);
+  EXPECT_EQ(infos[0].time_spent, 0.0);
+  EXPECT_EQ(infos[1].time_spent, 0.0);
+
+  /* With the new weights both devices take the same time, nothing changes. */
+  infos[0].time_spent = 1.5;
+  infos[1].time_spent = 1.5;
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.75, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.25, 1e-6);
+}
+
+TEST(work_balance, RebalanceUnmeasuredDevice)
+{
+  vector<WorkBalanceInfo> infos(3);
+  work_balance_do_initial(infos);
+  infos[0].time_spent = 1.0;
+  infos[1].time_spent = 2.0;
+  infos[2].time_spent = 0.0;
+
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight + infos[1].weight + infos[2].weight, 1.0, 1e-6);
+  EXPECT_NEAR(infos[0].weight, 2.0 * infos[1].weight, 1e-6);
+  EXPECT_GT(infos[2].weight, 0.0);
+}
+
+TEST(work_balance, RebalanceNoTime)
+{
+  vector<WorkBalanceInfo> infos(2);
+  work_balance_do_initial(infos);
+
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+CCL_NAMESPACE_END
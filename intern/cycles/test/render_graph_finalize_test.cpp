@@ -1152,6 +1152,54 @@ TEST_F(RenderGraph, constant_fold_part_math_pow_1)
   graph.finalize(scene);
 }
 
+/*
+ * Tests: Math Multiply feeding only into Math Add is fused into Multiply Add.
+ */
+TEST_F(RenderGraph, constant_fold_math_multiply_add)
+{
+  EXPECT_ANY_MESSAGE(log);
+  CORRECT_INFO_MESSAGE(log, "Fusing Math_Mul::Value into multiply add Math_Add.");
+
+  builder.add_attribute("Attribute")
+      .add_node(ShaderNodeBuilder<MathNode>(graph, "Math_Mul")
+                    .set_param("math_type", NODE_MATH_MULTIPLY)
+                    .set_param("use_clamp", false)
+                    .set("Value2", 2.0f))
+      .add_connection("Attribute::Fac", "Math_Mul::Value1")
+      .add_node(ShaderNodeBuilder<MathNode>(graph, "Math_Add")
+                    .set_param("math_type", NODE_MATH_ADD)
+                    .set_param("use_clamp", false)
+                    .set("Value1", 0.5f))
+      .add_connection("Math_Mul::Value", "Math_Add::Value2")
+      .output_value("Math_Add::Value");
+
+  graph.finalize(scene);
+}
+
+/*
+ * Tests: Math Multiply is not fused when its result is also used elsewhere.
+ */
+TEST_F(RenderGraph, constant_fold_math_multiply_add_shared)
+{
+  EXPECT_ANY_MESSAGE(log);
+  INVALID_INFO_MESSAGE(log, "Fusing ");
+
+  builder.add_attribute("Attribute")
+      .add_node(ShaderNodeBuilder<MathNode>(graph, "Math_Mul")
+                    .set_param("math_type", NODE_MATH_MULTIPLY)
+                    .set_param("use_clamp", false)
+                    .set("Value2", 2.0f))
+      .add_connection("Attribute::Fac", "Math_Mul::Value1")
+      .add_node(ShaderNodeBuilder<MathNode>(graph, "Math_Add")
+                    .set_param("math_type", NODE_MATH_ADD)
+                    .set_param("use_clamp", false))
+      .add_connection("Math_Mul::Value", "Math_Add::Value1")
+      .add_connection("Math_Mul::Value", "Math_Add::Value2")
+      .output_value("Math_Add::Value");
+
+  graph.finalize(scene);
+}
+
 /*
  * Tests: Vector Math with all constant inputs.
  */
@@ -38,6 +38,7 @@ void DebugFlags::CPU::reset()
 #undef CHECK_CPU_FLAGS
 
   bvh_layout = BVH_LAYOUT_AUTO;
+  sort_paths = (getenv("CYCLES_CPU_SORT_PATHS") != NULL);
 }
 
 DebugFlags::CUDA::CUDA()
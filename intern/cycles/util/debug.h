@@ -61,6 +61,11 @@ class DebugFlags {
      * CPUs and GPUs can be selected here instead.
      */
     BVHLayout bvh_layout = BVH_LAYOUT_AUTO;
+
+    /* Render batches of pixels and execute the kernels of all their paths in an order sorted by
+     * kernel and shader, instead of tracing every path from start to end. Improves instruction
+     * and data cache usage for scenes with many different shaders. */
+    bool sort_paths = false;
   };
 
   /* Descriptor of CUDA feature-set to be used. */
@@ -13,6 +13,10 @@
 
 #include <assert.h>
 
+#if defined(__linux__)
+#  include <sys/mman.h>
+#endif
+
 #include "mallocn_intern.h"
 
 #ifdef WITH_JEMALLOC_CONF
@@ -74,6 +78,38 @@ void *aligned_malloc(size_t size, size_t alignment)
 #endif
 }
 
+/**
+ * Size of transparent huge pages on x86-64 and ARM64 with 4 KB base pages.
+ */
+#define HUGE_PAGE_SIZE ((size_t)2 * 1024 * 1024)
+
+/**
+ * Only blocks that span many huge pages benefit enough to make the possible waste of memory for
+ * partially used huge pages worth it. Those are typically attribute arrays of large meshes and
+ * render buffers, which are accessed randomly and cause many TLB misses with regular pages.
+ */
+#define HUGE_PAGE_MIN_BLOCK_SIZE (HUGE_PAGE_SIZE * 8)
+
+void memory_advise_large_block(void *ptr, size_t size)
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if (size < HUGE_PAGE_MIN_BLOCK_SIZE) {
+    return;
+  }
+  /* Only whole huge pages inside of the block can be advised. This has to happen before the
+   * memory is touched for the first time, afterwards the kernel only merges the pages lazily.
+   * Failure is harmless, e.g. when huge pages are disabled on the system. */
+  const uintptr_t begin = ((uintptr_t)ptr + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+  const uintptr_t end = ((uintptr_t)ptr + size) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1);
+  if (begin < end) {
+    madvise((void *)begin, (size_t)(end - begin), MADV_HUGEPAGE);
+  }
+#else
+  (void)ptr;
+  (void)size;
+#endif
+}
+
 void aligned_free(void *ptr)
 {
 #ifdef _WIN32
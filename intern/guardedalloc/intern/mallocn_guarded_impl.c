@@ -438,6 +438,7 @@ void *MEM_guarded_mallocN(size_t len, const char *str)
   memh = (MemHead *)malloc(len + sizeof(MemHead) + sizeof(MemTail));
 
   if (LIKELY(memh)) {
+    memory_advise_large_block(memh, len + sizeof(MemHead) + sizeof(MemTail));
     make_memhead_header(memh, len, str);
     if (UNLIKELY(malloc_debug_memset && len)) {
       memset(memh + 1, 255, len);
@@ -504,6 +505,7 @@ void *MEM_guarded_mallocN_aligned(size_t len, size_t alignment, const char *str)
       len + extra_padding + sizeof(MemHead) + sizeof(MemTail), alignment);
 
   if (LIKELY(memh)) {
+    memory_advise_large_block(memh, len + extra_padding + sizeof(MemHead) + sizeof(MemTail));
     /* We keep padding in the beginning of MemHead,
      * this way it's always possible to get MemHead
      * from the data pointer.
@@ -539,6 +541,7 @@ void *MEM_guarded_callocN(size_t len, const char *str)
   memh = (MemHead *)calloc(len + sizeof(MemHead) + sizeof(MemTail), 1);
 
   if (memh) {
+    memory_advise_large_block(memh, len + sizeof(MemHead) + sizeof(MemTail));
     make_memhead_header(memh, len, str);
 #ifdef DEBUG_MEMCOUNTER
     if (_mallocn_count == DEBUG_MEMCOUNTER_ERROR_VAL)
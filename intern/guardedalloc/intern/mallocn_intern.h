@@ -86,9 +86,23 @@ extern "C" {
 void *aligned_malloc(size_t size, size_t alignment);
 void aligned_free(void *ptr);
 
+/**
+ * Give the operating system hints about how to map the memory of large blocks (i.e. to use
+ * transparent huge pages). Does nothing for smaller blocks. Should be called before the memory
+ * is written to.
+ */
+void memory_advise_large_block(void *ptr, size_t size);
+
 extern bool leak_detector_has_run;
 extern char free_after_leak_detection_message[];
 
+void memory_usage_block_alloc(size_t size);
+void memory_usage_block_free(size_t size);
+size_t memory_usage_block_num(void);
+size_t memory_usage_current(void);
+size_t memory_usage_peak(void);
+void memory_usage_peak_reset(void);
+
 /* Prototypes for counted allocator functions */
 size_t MEM_lockfree_allocN_len(const void *vmemh) ATTR_WARN_UNUSED_RESULT;
 void MEM_lockfree_freeN(void *vmemh);
@@ -0,0 +1,197 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup intern_mem
+ *
+ * Memory usage counters of the lock-free allocator.
+ *
+ * Updating a single set of global counters from every allocation causes a lot of cache line
+ * contention when many threads allocate at the same time, e.g. during depsgraph evaluation.
+ * Instead, every thread has its own counters which are only written by that thread. The global
+ * values are computed by summing up the counters of all threads when they are requested, which
+ * happens rarely in comparison.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#include "MEM_guardedalloc.h"
+#include "mallocn_intern.h"
+
+namespace {
+
+/**
+ * Amount of memory a thread has to allocate or free since the last peak update, before the peak
+ * is updated again. It has to be large enough to avoid locking too often, and small enough so
+ * that the peak is still accurate enough.
+ */
+constexpr int64_t peak_update_threshold = 1024 * 1024;
+
+struct Local;
+
+struct Global {
+  /**
+   * Protects the list of thread local counters. Only locked when a thread starts or exits, and
+   * when the total counters are computed.
+   */
+  std::mutex locals_mutex;
+  Local *locals_first = nullptr;
+
+  /**
+   * Counters of threads that have exited. Blocks that were allocated by those threads may still
+   * be freed later by other threads, so the per-thread counters can also become negative.
+   */
+  std::atomic<int64_t> blocks_num_outside_locals = 0;
+  std::atomic<int64_t> mem_in_use_outside_locals = 0;
+
+  std::atomic<size_t> peak = 0;
+};
+
+struct Local {
+  Local *prev = nullptr;
+  Local *next = nullptr;
+  /**
+   * Set when the thread local storage is destructed at thread exit. Allocations that happen
+   * afterwards (e.g. from other thread local destructors) use the global counters directly.
+   */
+  bool destructed = false;
+
+  /** Only written by the owning thread, but read by other threads when computing the totals. */
+  std::atomic<int64_t> blocks_num = 0;
+  std::atomic<int64_t> mem_in_use = 0;
+  int64_t mem_in_use_during_peak_update = 0;
+
+  Local();
+  ~Local();
+};
+
+Global &get_global()
+{
+  /* Never freed, the counters may still be used by static destructors at exit, including the
+   * ones of the leak detector. Not allocated with `new`, which may be overridden to use the
+   * guarded allocator itself. */
+  static Global *global = new (std::malloc(sizeof(Global))) Global();
+  return *global;
+}
+
+Local::Local()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+  next = global.locals_first;
+  if (next != nullptr) {
+    next->prev = this;
+  }
+  global.locals_first = this;
+}
+
+Local::~Local()
+{
+  Global &global = get_global();
+  std::lock_guard lock{global.locals_mutex};
+  if (prev != nullptr) {
+    prev->next = next;
+  }
+  else {
+    global.locals_first = next;
+  }
+  if (next != nullptr) {
+    next->prev = prev;
+  }
+  global.blocks_num_outside_locals.fetch_add(blocks_num, std::memory_order_relaxed);
+  global.mem_in_use_outside_locals.fetch_add(mem_in_use, std::memory_order_relaxed);
+  destructed = true;
+}
+
+Local &get_local_data()
+{
+  static thread_local Local local;
+  return local;
+}
+
+struct Totals {
+  int64_t blocks_num;
+  int64_t mem_in_use;
+};
+
+Totals get_totals(Global &global)
+{
+  Totals totals = {global.blocks_num_outside_locals.load(std::memory_order_relaxed),
+                   global.mem_in_use_outside_locals.load(std::memory_order_relaxed)};
+  std::lock_guard lock{global.locals_mutex};
+  for (const Local *local = global.locals_first; local != nullptr; local = local->next) {
+    totals.blocks_num += local->blocks_num.load(std::memory_order_relaxed);
+    totals.mem_in_use += local->mem_in_use.load(std::memory_order_relaxed);
+  }
+  return totals;
+}
+
+void update_global_peak(Global &global)
+{
+  const size_t mem_in_use = size_t(std::max<int64_t>(get_totals(global).mem_in_use, 0));
+  size_t peak = global.peak.load(std::memory_order_relaxed);
+  while (mem_in_use > peak &&
+         !global.peak.compare_exchange_weak(peak, mem_in_use, std::memory_order_relaxed)) {
+  }
+}
+
+void update_local(const int64_t blocks_delta, const int64_t size_delta)
+{
+  Local &local = get_local_data();
+  if (UNLIKELY(local.destructed)) {
+    Global &global = get_global();
+    global.blocks_num_outside_locals.fetch_add(blocks_delta, std::memory_order_relaxed);
+    global.mem_in_use_outside_locals.fetch_add(size_delta, std::memory_order_relaxed);
+    return;
+  }
+
+  /* Only this thread writes the counters, so there is no need for an atomic read-modify-write
+   * operation, which is what makes this cheaper than updating global counters. */
+  local.blocks_num.store(local.blocks_num.load(std::memory_order_relaxed) + blocks_delta,
+                         std::memory_order_relaxed);
+  const int64_t mem_in_use = local.mem_in_use.load(std::memory_order_relaxed) + size_delta;
+  local.mem_in_use.store(mem_in_use, std::memory_order_relaxed);
+
+  if (std::abs(mem_in_use - local.mem_in_use_during_peak_update) >= peak_update_threshold) {
+    local.mem_in_use_during_peak_update = mem_in_use;
+    update_global_peak(get_global());
+  }
+}
+
+}  // namespace
+
+void memory_usage_block_alloc(const size_t size)
+{
+  update_local(1, int64_t(size));
+}
+
+void memory_usage_block_free(const size_t size)
+{
+  update_local(-1, -int64_t(size));
+}
+
+size_t memory_usage_block_num()
+{
+  return size_t(std::max<int64_t>(get_totals(get_global()).blocks_num, 0));
+}
+
+size_t memory_usage_current()
+{
+  return size_t(std::max<int64_t>(get_totals(get_global()).mem_in_use, 0));
+}
+
+size_t memory_usage_peak()
+{
+  Global &global = get_global();
+  update_global_peak(global);
+  return global.peak.load(std::memory_order_relaxed);
+}
+
+void memory_usage_peak_reset()
+{
+  Global &global = get_global();
+  global.peak.store(memory_usage_current(), std::memory_order_relaxed);
+}
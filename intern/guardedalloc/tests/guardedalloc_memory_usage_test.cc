@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <thread>
+#include <vector>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+#include "guardedalloc_test_base.h"
+
+TEST_F(LockFreeAllocatorTest, MemoryUsageMultiThreaded)
+{
+  const uint blocks_before = MEM_get_memory_blocks_in_use();
+  const size_t mem_before = MEM_get_memory_in_use();
+
+  const int threads_num = 4;
+  const int blocks_per_thread = 1000;
+  const size_t block_size = 1000;
+  std::vector<void *> blocks(threads_num * blocks_per_thread);
+
+  std::vector<std::thread> threads;
+  for (int thread_i = 0; thread_i < threads_num; thread_i++) {
+    threads.emplace_back([&, thread_i]() {
+      for (int i = 0; i < blocks_per_thread; i++) {
+        blocks[thread_i * blocks_per_thread + i] = MEM_mallocN(block_size, __func__);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  /* The threads have exited, their counters must still be accounted for. */
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_before + blocks.size());
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_before + blocks.size() * block_size);
+  EXPECT_GE(MEM_get_peak_memory(), mem_before + blocks.size() * block_size);
+
+  /* Free from a different thread than the one that allocated. */
+  for (void *block : blocks) {
+    MEM_freeN(block);
+  }
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_before);
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_before);
+}
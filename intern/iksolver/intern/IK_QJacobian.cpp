@@ -52,6 +52,9 @@ void IK_QJacobian::ArmMatrices(int dof, int task_size)
     m_svd_w.resize(dof);
 
     m_svd_u_beta.resize(dof);
+
+    m_svd = Eigen::JacobiSVD<MatrixXd>(
+        task_size, dof, Eigen::ComputeThinU | Eigen::ComputeThinV);
   }
   else {
     // use the SVD of the transpose jacobian, it works just as well
@@ -65,6 +68,9 @@ void IK_QJacobian::ArmMatrices(int dof, int task_size)
     m_svd_w.resize(task_size);
 
     m_svd_u_beta.resize(task_size);
+
+    m_svd = Eigen::JacobiSVD<MatrixXd>(
+        dof, task_size, Eigen::ComputeThinU | Eigen::ComputeThinV);
   }
 }
 
@@ -86,22 +92,24 @@ void IK_QJacobian::SetDerivatives(int id, int dof_id, const Vector3d &v, double
 
 void IK_QJacobian::Invert()
 {
+  // the SVD and the transposed matrix were allocated in ArmMatrices, so
+  // the decomposition does not allocate memory in the inner solver loop
   if (m_transpose) {
     // SVD will decompose Jt into V*W*Ut with U,V orthogonal and W diagonal,
     // so J = U*W*Vt and Jinv = V*Winv*Ut
-    Eigen::JacobiSVD<MatrixXd> svd(m_jacobian.transpose(),
-                                   Eigen::ComputeThinU | Eigen::ComputeThinV);
-    m_svd_u = svd.matrixV();
-    m_svd_w = svd.singularValues();
-    m_svd_v = svd.matrixU();
+    m_jacobian_tmp = m_jacobian.transpose();
+    m_svd.compute(m_jacobian_tmp);
+    m_svd_u = m_svd.matrixV();
+    m_svd_w = m_svd.singularValues();
+    m_svd_v = m_svd.matrixU();
   }
   else {
     // SVD will decompose J into U*W*Vt with U,V orthogonal and W diagonal,
     // so Jinv = V*Winv*Ut
-    Eigen::JacobiSVD<MatrixXd> svd(m_jacobian, Eigen::ComputeThinU | Eigen::ComputeThinV);
-    m_svd_u = svd.matrixU();
-    m_svd_w = svd.singularValues();
-    m_svd_v = svd.matrixV();
+    m_svd.compute(m_jacobian);
+    m_svd_u = m_svd.matrixU();
+    m_svd_w = m_svd.singularValues();
+    m_svd_v = m_svd.matrixV();
   }
 
   if (m_sdls)
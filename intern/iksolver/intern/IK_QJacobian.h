@@ -9,6 +9,8 @@
 
 #include "IK_Math.h"
 
+#include <Eigen/SVD>
+
 class IK_QJacobian {
  public:
   IK_QJacobian();
@@ -55,6 +57,7 @@ class IK_QJacobian {
   VectorXd m_d_norm_weight;
 
   /// space required for SVD computation
+  Eigen::JacobiSVD<MatrixXd> m_svd;
   VectorXd m_svd_w;
   MatrixXd m_svd_v;
   MatrixXd m_svd_u;
@@ -31,9 +31,9 @@ double IK_QJacobianSolver::ComputeScale()
     return 1.0 / length;
 }
 
-void IK_QJacobianSolver::Scale(double scale, std::list<IK_QTask *> &tasks)
+void IK_QJacobianSolver::Scale(double scale, const std::list<IK_QTask *> &tasks)
 {
-  std::list<IK_QTask *>::iterator task;
+  std::list<IK_QTask *>::const_iterator task;
   std::vector<IK_QSegment *>::iterator seg;
 
   for (task = tasks.begin(); task != tasks.end(); task++)
@@ -144,7 +144,8 @@ void IK_QJacobianSolver::SetPoleVectorConstraint(
   m_getpoleangle = getangle;
 }
 
-void IK_QJacobianSolver::ConstrainPoleVector(IK_QSegment *root, std::list<IK_QTask *> &tasks)
+void IK_QJacobianSolver::ConstrainPoleVector(IK_QSegment *root,
+                                             const std::list<IK_QTask *> &tasks)
 {
   // this function will be called before and after solving. calling it before
   // solving gives predictable solutions by rotating towards the solution,
@@ -154,7 +155,7 @@ void IK_QJacobianSolver::ConstrainPoleVector(IK_QSegment *root, std::list<IK_QTa
     return;
 
   // disable pole vector constraint in case of multiple position tasks
-  std::list<IK_QTask *>::iterator task;
+  std::list<IK_QTask *>::const_iterator task;
   int positiontasks = 0;
 
   for (task = tasks.begin(); task != tasks.end(); task++)
@@ -275,7 +276,7 @@ bool IK_QJacobianSolver::UpdateAngles(double &norm)
 }
 
 bool IK_QJacobianSolver::Solve(IK_QSegment *root,
-                               std::list<IK_QTask *> tasks,
+                               const std::list<IK_QTask *> &tasks,
                                const double,
                                const int max_iterations)
 {
@@ -294,7 +295,7 @@ bool IK_QJacobianSolver::Solve(IK_QSegment *root,
     // update transform
     root->UpdateTransform(m_rootmatrix);
 
-    std::list<IK_QTask *>::iterator task;
+    std::list<IK_QTask *>::const_iterator task;
 
     // compute jacobian
     for (task = tasks.begin(); task != tasks.end(); task++) {
@@ -40,17 +40,17 @@ class IK_QJacobianSolver {
 
   // returns true if converged, false if max number of iterations was used
   bool Solve(IK_QSegment *root,
-             std::list<IK_QTask *> tasks,
+             const std::list<IK_QTask *> &tasks,
              const double tolerance,
              const int max_iterations);
 
  private:
   void AddSegmentList(IK_QSegment *seg);
   bool UpdateAngles(double &norm);
-  void ConstrainPoleVector(IK_QSegment *root, std::list<IK_QTask *> &tasks);
+  void ConstrainPoleVector(IK_QSegment *root, const std::list<IK_QTask *> &tasks);
 
   double ComputeScale();
-  void Scale(double scale, std::list<IK_QTask *> &tasks);
+  void Scale(double scale, const std::list<IK_QTask *> &tasks);
 
  private:
   IK_QJacobian m_jacobian;
@@ -567,14 +567,29 @@ void OCIOImpl::cpuProcessorApply_predivide(OCIO_ConstCPUProcessorRcPtr *cpu_proc
       assert(img->isFloat());
       float *pixels = (float *)img->getData();
 
-      size_t width = img->getWidth();
-      size_t height = img->getHeight();
+      const size_t pixels_num = size_t(img->getWidth()) * size_t(img->getHeight());
+
+      /* Un-premultiply the whole image and apply the processor to it at once rather than pixel
+       * by pixel, so OCIO can use its vectorized packed image code path. Pixels with an alpha
+       * of zero or one are left as is, like in #cpuProcessorApplyRGBA_predivide. */
+      for (size_t i = 0; i < pixels_num; i++) {
+        float *pixel = pixels + 4 * i;
+        if (pixel[3] != 1.0f && pixel[3] != 0.0f) {
+          const float inv_alpha = 1.0f / pixel[3];
+          pixel[0] *= inv_alpha;
+          pixel[1] *= inv_alpha;
+          pixel[2] *= inv_alpha;
+        }
+      }
 
-      for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-          float *pixel = pixels + 4 * (y * width + x);
+      (*(ConstCPUProcessorRcPtr *)cpu_processor)->apply(*img);
 
-          cpuProcessorApplyRGBA_predivide(cpu_processor, pixel);
+      for (size_t i = 0; i < pixels_num; i++) {
+        float *pixel = pixels + 4 * i;
+        if (pixel[3] != 1.0f && pixel[3] != 0.0f) {
+          pixel[0] *= pixel[3];
+          pixel[1] *= pixel[3];
+          pixel[2] *= pixel[3];
         }
       }
     }
@@ -25,8 +25,17 @@ def _initialize():
     path_list = paths()
     for path in path_list:
         _bpy.utils._sys_path_ensure_append(path)
+
+    use_time = _bpy.app.debug_startup_time
+    if use_time:
+        import time
+
     for addon in _preferences.addons:
+        if use_time:
+            t_addon = time.time()
         enable(addon.module)
+        if use_time:
+            print("Add-on %r enabled in %.4f" % (addon.module, time.time() - t_addon))
 
 
 def paths():
@@ -199,6 +199,7 @@ def load_scripts(*, reload_scripts=False, refresh_scripts=False):
     :type refresh_scripts: bool
     """
     use_time = use_class_register_check = _bpy.app.debug_python
+    use_time = use_time or _bpy.app.debug_startup_time
     use_user = not _is_factory_startup
 
     if use_time:
@@ -269,6 +269,7 @@ class RENDER_PT_output(RenderOutputButtonsPanel, Panel):
         col = layout.column(heading="Saving")
         col.prop(rd, "use_file_extension")
         col.prop(rd, "use_render_cache")
+        col.prop(rd, "use_async_write")
 
         layout.template_image_settings(image_settings, color_management=False)
 
@@ -409,6 +410,8 @@ class RENDER_PT_encoding_video(RenderOutputButtonsPanel, Panel):
 
         # Encoding speed
         layout.prop(ffmpeg, "ffmpeg_preset")
+        if ffmpeg.codec == 'H264':
+            layout.prop(ffmpeg, "use_hardware_encoder")
         # I-frames
         layout.prop(ffmpeg, "gopsize")
         # B-Frames
@@ -729,6 +729,7 @@ class NODE_PT_backdrop(Panel):
         col.prop(snode, "backdrop_zoom", text="Zoom")
 
         col.prop(snode, "backdrop_offset", text="Offset")
+        col.prop(snode, "use_backdrop_visible_region")
 
         col.separator()
 
@@ -757,7 +758,7 @@ class NODE_PT_quality(bpy.types.Panel):
         prefs = bpy.context.preferences
 
         col = layout.column()
-        if prefs.experimental.use_full_frame_compositor:
+        if prefs.experimental.use_full_frame_compositor or prefs.experimental.use_realtime_compositor:
             col.prop(tree, "execution_mode")
 
         col.prop(tree, "render_quality", text="Render")
@@ -799,6 +800,7 @@ class NODE_PT_overlay(Panel):
         if snode.tree_type == 'GeometryNodeTree':
             col.separator()
             col.prop(overlay, "show_timing", text="Timings")
+            col.prop(overlay, "show_memory", text="Memory")
             col.prop(overlay, "show_named_attributes", text="Named Attributes")
 
 
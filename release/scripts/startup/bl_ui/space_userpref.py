@@ -696,6 +696,10 @@ class USERPREF_PT_system_video_sequencer(SystemPanel, CenterAlignMixIn, Panel):
 
         layout.prop(system, "sequencer_proxy_setup")
 
+        layout.separator()
+
+        layout.prop(system, "use_hardware_video_decoding")
+
 
 # -----------------------------------------------------------------------------
 # Viewport Panels
@@ -2325,6 +2329,7 @@ class USERPREF_PT_experimental_new_features(ExperimentalPanel, Panel):
                 ({"property": "use_extended_asset_browser"}, ("project/view/130/", "Project Page")),
                 ({"property": "use_override_templates"}, ("T73318", "Milestone 4")),
                 ({"property": "use_realtime_compositor"}, "T99210"),
+                ({"property": "use_sequencer_gpu_compositing"}, None),
             ),
         )
 
@@ -245,6 +245,9 @@ typedef struct BVHTreeFromPointCloud {
   BVHTree_NearestPointCallback nearest_callback;
 
   const float (*coords)[3];
+
+  /* Private data */
+  bool cached;
 } BVHTreeFromPointCloud;
 
 BVHTree *BKE_bvhtree_from_pointcloud_get(struct BVHTreeFromPointCloud *data,
@@ -261,6 +264,11 @@ void free_bvhtree_from_pointcloud(struct BVHTreeFromPointCloud *data);
 
 bool bvhcache_has_tree(const struct BVHCache *bvh_cache, const BVHTree *tree);
 struct BVHCache *bvhcache_init(void);
+/**
+ * Keep the cached trees when only the positions of the mesh changed. Trees that support it are
+ * refit to the new positions the next time they are requested, the others are freed.
+ */
+void bvhcache_tag_positions_changed(struct BVHCache *bvh_cache);
 /**
  * Frees a BVH-cache.
  */
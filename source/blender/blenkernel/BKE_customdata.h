@@ -66,6 +66,13 @@ typedef enum eCDAllocType {
    * if all layer values will be set by the caller after creating the layer.
    */
   CD_CONSTRUCT = 5,
+  /**
+   * Share the data with the source layers using reference counting, only allowed if the source has
+   * the same number of elements. The data is copied when it is accessed for writing with
+   * #CustomData_duplicate_referenced_layer and related functions, so this must only be used when
+   * all writes go through those. Referenced source layers are duplicated instead.
+   */
+  CD_SHARE = 6,
 } eCDAllocType;
 
 #define CD_TYPE_AS_MASK(_type) (eCustomDataMask)((eCustomDataMask)1 << (eCustomDataMask)(_type))
@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+#pragma once
+
+/** \file
+ * \ingroup bke
+ *
+ * Background reading of upcoming frames of image sequences, used by images and movie clips so
+ * that playback does not have to wait for the files to be read and decoded.
+ *
+ * Frames are identified by their file path, load flags and color space, so the owner only has to
+ * ask for the same file again when it needs the frame. Frames that are still being read when they
+ * are requested are waited for instead of being read a second time.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct ImBuf;
+
+/** Maximum number of frames that are read ahead for a single owner. */
+#define IMAGE_READ_AHEAD_FRAMES_MAX 8
+
+/**
+ * Start reading the files in the background, in the given order. Frames that were read ahead
+ * earlier for the same owner and are not in the list anymore are discarded, e.g. after the
+ * playback direction changed or the user jumped to a different frame.
+ *
+ * \param owner: Data-block that reads the frames, only used to identify its frames.
+ * \param colorspace: Color space passed to #IMB_loadiffname, can be null.
+ */
+void BKE_image_read_ahead_schedule(const void *owner,
+                                   const char **filepaths,
+                                   int filepaths_num,
+                                   int flag,
+                                   const char *colorspace);
+
+/**
+ * Take the frame that was read ahead, waiting for it when it is still being read.
+ *
+ * \param colorspace: Same as for #BKE_image_read_ahead_schedule. Like with #IMB_loadiffname, it
+ * is updated with the color space of the file when that was not set.
+ *
+ * \return The image buffer owned by the caller, or null when the file was not read ahead or
+ * could not be read. The caller should read the file itself in that case.
+ */
+struct ImBuf *BKE_image_read_ahead_take(const char *filepath, int flag, char *colorspace);
+
+/**
+ * Discard all frames of the owner, for example when it is freed or reloaded.
+ */
+void BKE_image_read_ahead_cancel(const void *owner);
+
+/**
+ * Stop the background threads and free all frames that were not used.
+ */
+void BKE_image_read_ahead_exit(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -72,6 +72,12 @@ void BKE_mesh_tag_coords_changed_uniformly(struct Mesh *mesh);
 
 void BKE_mesh_tag_topology_changed(struct Mesh *mesh);
 
+/**
+ * Call after changing the sharp edge or smooth face flags, the auto smooth settings or the custom
+ * normals, to tag the cached face corner normals for recomputation.
+ */
+void BKE_mesh_tag_sharpness_changed(struct Mesh *mesh);
+
 /**
  * Call when new edges and vertices have been created but positions and faces haven't changed.
  */
@@ -360,6 +366,14 @@ const float (*BKE_mesh_vertex_normals_ensure(const struct Mesh *mesh))[3];
  */
 const float (*BKE_mesh_poly_normals_ensure(const struct Mesh *mesh))[3];
 
+/**
+ * Return the normal of every face corner, computed like #BKE_mesh_calc_normals_split from the
+ * auto smooth settings, the sharp edges and the custom normals of the mesh. The result is cached
+ * until the positions or topology change, or #BKE_mesh_tag_sharpness_changed is called.
+ * \warning May still return null if the mesh has no face corners.
+ */
+const float (*BKE_mesh_corner_normals_ensure(const struct Mesh *mesh))[3];
+
 /**
  * Tag mesh vertex and face normals to be recalculated when/if they are needed later.
  *
@@ -80,11 +80,31 @@ struct LooseEdgeCache {
   int count = -1;
 };
 
+/**
+ * Cache of a map from every vertex to the indices of the elements that use it, e.g. its edges.
+ * Accessed with #Mesh::vert_to_edge_map() and #Mesh::vert_to_loop_map().
+ */
+struct VertToElemMap {
+  /** The elements of vertex `i` are `indices[offsets[i]]` to `indices[offsets[i + 1] - 1]`. */
+  Array<int> offsets;
+  /** The element indices, sorted by vertex and then by index. */
+  Array<int> indices;
+
+  Span<int> operator[](const int64_t vert) const
+  {
+    return indices.as_span().slice(offsets[vert], offsets[vert + 1] - offsets[vert]);
+  }
+};
+
 struct MeshRuntime {
   /* Evaluated mesh for objects which do not have effective modifiers.
    * This mesh is used as a result of modifier stack evaluation.
    * Since modifier stack evaluation is threaded on object level we need some synchronization. */
   Mesh *mesh_eval = nullptr;
+  /* Same as #mesh_eval, for instances that request loop normals when #mesh_eval was created
+   * without them (e.g. when only some of the objects are drawn in a mode that needs them).
+   * Sharing it means these instances also share a GPU batch cache instead of having one each. */
+  Mesh *mesh_eval_loop_normals = nullptr;
   std::mutex eval_mutex;
 
   /* A separate mutex is needed for normal calculation, because sometimes
@@ -160,12 +180,26 @@ struct MeshRuntime {
   float (*vert_normals)[3] = nullptr;
   float (*poly_normals)[3] = nullptr;
 
+  /**
+   * Cache of the face corner normals, accessed with #BKE_mesh_corner_normals_ensure. Unlike other
+   * caches it isn't shared with copies of the mesh, because the copies often change the sharp
+   * flags or custom normals before the normals are used.
+   */
+  SharedCache<Array<float3>> corner_normals_cache;
+
   /**
    * A cache of data about the loose edges. Can be shared with other data-blocks with unchanged
    * topology. Accessed with #Mesh::loose_edges().
    */
   SharedCache<LooseEdgeCache> loose_edges_cache;
 
+  /**
+   * Maps from vertices to the edges and face corners that use them. They only depend on the
+   * topology, so they are shared with other data-blocks with the same topology.
+   */
+  SharedCache<VertToElemMap> vert_to_edge_map_cache;
+  SharedCache<VertToElemMap> vert_to_loop_map_cache;
+
   /**
    * A #BLI_bitmap containing tags for the center vertices of subdivided polygons, set by the
    * subdivision surface modifier and used by drawing code instead of polygon center face dots.
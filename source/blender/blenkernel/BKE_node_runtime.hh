@@ -104,6 +104,13 @@ class bNodeTreeRuntime : NonCopyable, NonMovable {
   void (*update_draw)(void *) = nullptr;
   void *tbh = nullptr, *prh = nullptr, *sdh = nullptr, *udh = nullptr;
 
+  /**
+   * Part of the viewer image that is visible in the backdrop of the node editor that started the
+   * compositing job, in normalized coordinates. Only used for the localized tree of the job.
+   */
+  bool use_backdrop_border = false;
+  rctf backdrop_border = {0.0f, 1.0f, 0.0f, 1.0f};
+
   /** Information about how inputs and outputs of the node group interact with fields. */
   std::unique_ptr<nodes::FieldInferencingInterface> field_inferencing_interface;
 
@@ -715,6 +715,10 @@ typedef struct SculptSession {
       /* Needed to continuously re-apply over the same weights (BRUSH_ACCUMULATE disabled).
        * Lazy initialize as needed (flag is set to 1 to tag it as uninitialized). */
       struct MDeformVert *dvert_prev;
+      /* Same as above for the weight of the active group only, which is all that is needed when
+       * painting a single group without Lock Relative. Cheaper than copying the whole vertex.
+       * Lazy initialize as needed (FLT_MAX tags it as uninitialized). */
+      float *weight_prev;
     } wpaint;
 
     /* TODO: identify sculpt-only fields */
@@ -757,6 +761,14 @@ typedef struct SculptSession {
 
   int last_automasking_settings_hash;
   uchar last_automask_stroke_id;
+
+  /**
+   * Auto-masking factors of the last stroke that only depend on the topology, face sets and
+   * visibility, so following strokes with the same settings don't have to compute them again.
+   * Freed together with the PBVH.
+   */
+  float *automasking_factors_cache;
+  int automasking_factors_cache_hash;
 } SculptSession;
 
 void BKE_sculptsession_free(struct Object *ob);
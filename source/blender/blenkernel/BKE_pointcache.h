@@ -388,6 +388,14 @@ void BKE_ptcache_disk_cache_rename(struct PTCacheID *pid,
  * Loads simulation from external (disk) cache files.
  */
 void BKE_ptcache_load_external(struct PTCacheID *pid);
+/**
+ * Wait until all disk cache frames that are written in the background are on disk.
+ */
+void BKE_ptcache_disk_writes_wait(void);
+/**
+ * Finish the background writes and free their resources, on exit.
+ */
+void BKE_ptcache_disk_writes_exit(void);
 /**
  * Set correct flags after successful simulation step.
  */
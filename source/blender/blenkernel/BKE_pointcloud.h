@@ -8,6 +8,7 @@
  */
 
 #ifdef __cplusplus
+#  include <memory>
 #  include <mutex>
 
 #  include "BLI_bounds_types.hh"
@@ -19,6 +20,7 @@
 extern "C" {
 #endif
 
+struct BVHTree;
 struct BoundBox;
 struct CustomDataLayer;
 struct Depsgraph;
@@ -34,6 +36,10 @@ extern const char *POINTCLOUD_ATTR_RADIUS;
 #ifdef __cplusplus
 namespace blender::bke {
 
+struct BVHTreeDeleter {
+  void operator()(BVHTree *tree) const;
+};
+
 struct PointCloudRuntime {
   /**
    * A cache of bounds shared between data-blocks with unchanged positions and radii.
@@ -42,6 +48,12 @@ struct PointCloudRuntime {
    */
   mutable SharedCache<Bounds<float3>> bounds_cache;
 
+  /**
+   * A BVH tree of all points, used for nearest point lookups. It only depends on the positions,
+   * so it is shared and invalidated in the same way as #bounds_cache.
+   */
+  mutable SharedCache<std::unique_ptr<BVHTree, BVHTreeDeleter>> bvh_cache;
+
   MEM_CXX_CLASS_ALLOC_FUNCS("PointCloudRuntime");
 };
 
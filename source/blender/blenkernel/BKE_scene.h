@@ -206,6 +206,25 @@ void BKE_scene_graph_update_for_newframe(struct Depsgraph *depsgraph);
  */
 void BKE_scene_graph_update_for_newframe_ex(struct Depsgraph *depsgraph, bool clear_recalc);
 
+typedef void (*SceneFrameEvaluatedFn)(struct Depsgraph *depsgraph, int frame, void *user_data);
+
+/**
+ * Evaluate all frames in the range (including the end frame) with multiple dependency graphs
+ * which are evaluated in parallel. The graphs are created for the same scene, view layer and
+ * evaluation mode as the given one. The callback is called from the calling thread for every
+ * frame in order, with the graph that has been evaluated for that frame.
+ *
+ * This is only valid when the evaluated state of a frame does not depend on the previous frames,
+ * so it can't be used with simulations or when caches are written. The frame of the original
+ * scene is not changed and no frame change handlers are called.
+ */
+void BKE_scene_graph_evaluate_frames_parallel(const struct Depsgraph *depsgraph,
+                                              int frame_start,
+                                              int frame_end,
+                                              int graphs_num,
+                                              SceneFrameEvaluatedFn fn,
+                                              void *user_data);
+
 /**
  * Ensures given scene/view_layer pair has a valid, up-to-date depsgraph.
  *
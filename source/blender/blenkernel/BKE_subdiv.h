@@ -168,6 +168,10 @@ typedef struct Subdiv {
   struct SubdivDisplacement *displacement_evaluator;
   /* Statistics for debugging. */
   SubdivStats stats;
+  /* Hash of the mesh the topology refiner was created from or last compared with, or zero. Used
+   * to skip the comparison when only the vertex positions of a mesh changed, see
+   * #BKE_subdiv_update_from_mesh. */
+  uint64_t mesh_topology_hash;
 
   /* Cached values, are not supposed to be accessed directly. */
   struct {
@@ -31,9 +31,13 @@ typedef struct SubsurfRuntimeData {
   /* Subdivision settings, exists before descriptor or mesh wrapper is created. */
   SubdivSettings settings;
 
-  /* Cached subdivision surface descriptor, with topology and settings. */
-  struct Subdiv *subdiv;
-  bool set_by_draw_code;
+  /* Cached subdivision surface descriptors, with topology and settings. The descriptors used for
+   * CPU and GPU evaluation are kept separately, because the evaluator type of a descriptor can't
+   * change and GPU evaluators can only be freed by the draw code. This way the topology doesn't
+   * have to be recreated when the GPU subdivided mesh is also evaluated on the CPU, e.g. for a
+   * rendered viewport or snapping. */
+  struct Subdiv *subdiv_cpu;
+  struct Subdiv *subdiv_gpu;
 
   /* Cached mesh wrapper data, to be used for GPU subdiv or lazy evaluation on CPU. */
   bool has_gpu_subdiv;
@@ -87,6 +87,21 @@ void BKE_texture_get_value(const struct Scene *scene,
                            struct TexResult *texres,
                            bool use_color_management);
 
+/**
+ * Evaluate the texture at many coordinates at once, e.g. for all vertices of a mesh. The result
+ * is the same as calling #BKE_texture_get_value_ex for every coordinate, but the evaluation is
+ * multi-threaded and the images are only looked up once.
+ *
+ * \param pool: When null, a temporary pool is used for the duration of the call.
+ */
+void BKE_texture_get_values(const struct Scene *scene,
+                            struct Tex *texture,
+                            const float (*tex_co)[3],
+                            int tex_co_num,
+                            struct TexResult *r_texres,
+                            struct ImagePool *pool,
+                            bool use_color_management);
+
 /**
  * Make sure all images used by texture are loaded into pool.
  */
@@ -28,8 +28,15 @@ typedef struct DenseFloatVolumeGrid {
   float *voxels;
 } DenseFloatVolumeGrid;
 
+/**
+ * Copy the active voxels of the grid into a dense array. When the active voxels do not fit
+ * within \a max_resolution along every axis or within \a max_voxels in total, the grid is
+ * downsampled by the smallest integer factor that fits. Limits of zero are ignored.
+ */
 bool BKE_volume_grid_dense_floats(const struct Volume *volume,
                                   const struct VolumeGrid *volume_grid,
+                                  int max_resolution,
+                                  int64_t max_voxels,
                                   DenseFloatVolumeGrid *r_dense_grid);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
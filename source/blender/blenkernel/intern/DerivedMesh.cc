@@ -1141,10 +1141,21 @@ static void mesh_calc_modifiers(struct Depsgraph *depsgraph,
     }
     else if (!mesh_has_modifier_final_normals(mesh_input, &final_datamask, runtime->mesh_eval)) {
       /* Modifier stack was (re-)evaluated with a request for additional normals
-       * different than the instanced mesh, can't instance anymore now. */
-      mesh_final = BKE_mesh_copy_for_eval(mesh_input, true);
-      mesh_calc_modifier_final_normals(mesh_input, &final_datamask, sculpt_dyntopo, mesh_final);
-      mesh_calc_finalize(mesh_input, mesh_final);
+       * different than the instanced mesh, can't use that one. Instances with the same request
+       * still share a second mesh, so they also share the GPU batch cache. */
+      std::lock_guard lock{mesh_input->runtime->eval_mutex};
+      if (runtime->mesh_eval_loop_normals == nullptr) {
+        blender::threading::isolate_task([&] {
+          mesh_final = BKE_mesh_copy_for_eval(mesh_input, true);
+          mesh_calc_modifier_final_normals(
+              mesh_input, &final_datamask, sculpt_dyntopo, mesh_final);
+          mesh_calc_finalize(mesh_input, mesh_final);
+          runtime->mesh_eval_loop_normals = mesh_final;
+        });
+      }
+      else {
+        mesh_final = runtime->mesh_eval_loop_normals;
+      }
     }
     else {
       /* Already finalized by another instance, reuse. */
@@ -1584,7 +1595,8 @@ static void mesh_build_data(struct Depsgraph *depsgraph,
    * object's runtime: this could cause access freed data on depsgraph destruction (mesh who owns
    * the final result might be freed prior to object). */
   Mesh *mesh = (Mesh *)ob->data;
-  const bool is_mesh_eval_owned = (mesh_eval != mesh->runtime->mesh_eval);
+  const bool is_mesh_eval_owned = (mesh_eval != mesh->runtime->mesh_eval &&
+                                    mesh_eval != mesh->runtime->mesh_eval_loop_normals);
   BKE_object_eval_assign_data(ob, &mesh_eval->id, is_mesh_eval_owned);
 
   /* Add the final mesh as a non-owning component to the geometry set. */
@@ -1644,7 +1656,8 @@ static void editbmesh_build_data(struct Depsgraph *depsgraph,
     }
   }
 
-  const bool is_mesh_eval_owned = (me_final != mesh->runtime->mesh_eval);
+  const bool is_mesh_eval_owned = (me_final != mesh->runtime->mesh_eval &&
+                                    me_final != mesh->runtime->mesh_eval_loop_normals);
   BKE_object_eval_assign_data(obedit, &me_final->id, is_mesh_eval_owned);
 
   /* Make sure that drivers can target shapekey properties.
@@ -564,10 +564,55 @@ static bool animsys_construct_orig_pointer_rna(const PointerRNA *ptr, PointerRNA
   return true;
 }
 
+/**
+ * The F-Curves of array properties are usually next to each other (e.g. `location[0]` to
+ * `location[2]`), so the last resolved path is kept to avoid resolving the same path again.
+ */
+typedef struct AnimsysPathResolveCache {
+  const char *rna_path;
+  PathResolvedRNA anim_rna;
+  int array_len;
+} AnimsysPathResolveCache;
+
+/**
+ * Same as #BKE_animsys_rna_path_resolve, but reuses the result of the previous call with the same
+ * cache when the path is the same. The cache is only valid for one pointer, and only as long as
+ * the data it points to is not reallocated, so it is only kept during a single evaluation loop.
+ * The cache may be null.
+ */
+static bool animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                            const char *rna_path,
+                                            const int array_index,
+                                            AnimsysPathResolveCache *cache,
+                                            PathResolvedRNA *r_result)
+{
+  if (cache == NULL) {
+    return BKE_animsys_rna_path_resolve(ptr, rna_path, array_index, r_result);
+  }
+  if (cache->rna_path != NULL && rna_path != NULL && STREQ(cache->rna_path, rna_path)) {
+    if (cache->array_len && array_index >= cache->array_len) {
+      return false;
+    }
+    *r_result = cache->anim_rna;
+    r_result->prop_index = cache->array_len ? array_index : -1;
+    return true;
+  }
+
+  cache->rna_path = NULL;
+  if (!BKE_animsys_rna_path_resolve(ptr, rna_path, array_index, r_result)) {
+    return false;
+  }
+  cache->rna_path = rna_path;
+  cache->anim_rna = *r_result;
+  cache->array_len = RNA_property_array_length(&r_result->ptr, r_result->prop);
+  return true;
+}
+
 static void animsys_write_orig_anim_rna(PointerRNA *ptr,
                                         const char *rna_path,
                                         int array_index,
-                                        float value)
+                                        float value,
+                                        AnimsysPathResolveCache *orig_cache)
 {
   PointerRNA ptr_orig;
   if (!animsys_construct_orig_pointer_rna(ptr, &ptr_orig)) {
@@ -575,7 +620,8 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
   PathResolvedRNA orig_anim_rna;
   /* TODO(sergey): Should be possible to cache resolved path in dependency graph somehow. */
-  if (BKE_animsys_rna_path_resolve(&ptr_orig, rna_path, array_index, &orig_anim_rna)) {
+  if (animsys_rna_path_resolve_cached(
+          &ptr_orig, rna_path, array_index, orig_cache, &orig_anim_rna)) {
     BKE_animsys_write_to_rna_path(&orig_anim_rna, value);
   }
 }
@@ -590,6 +636,9 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  AnimsysPathResolveCache path_cache = {NULL};
+  AnimsysPathResolveCache orig_path_cache = {NULL};
+
   /* Calculate then execute each curve. */
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
@@ -598,11 +647,13 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (animsys_rna_path_resolve_cached(
+            ptr, fcu->rna_path, fcu->array_index, &path_cache, &anim_rna)) {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
-        animsys_write_orig_anim_rna(ptr, fcu->rna_path, fcu->array_index, curval);
+        animsys_write_orig_anim_rna(
+            ptr, fcu->rna_path, fcu->array_index, curval, &orig_path_cache);
       }
     }
   }
@@ -650,6 +701,7 @@ static void animsys_blend_in_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      const float blend_factor)
 {
+  AnimsysPathResolveCache path_cache = {NULL};
   char *channel_to_skip = NULL;
   int num_channels_to_skip = 0;
   LISTBASE_FOREACH (FCurve *, fcu, fcurves) {
@@ -670,7 +722,8 @@ static void animsys_blend_in_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (!BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (!animsys_rna_path_resolve_cached(
+            ptr, fcu->rna_path, fcu->array_index, &path_cache, &anim_rna)) {
       continue;
     }
 
@@ -742,6 +795,7 @@ static void animsys_evaluate_drivers(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context)
 {
   FCurve *fcu;
+  AnimsysPathResolveCache path_cache = {NULL};
 
   /* drivers are stored as F-Curves, but we cannot use the standard code, as we need to check if
    * the depsgraph requested that this driver be evaluated...
@@ -759,7 +813,8 @@ static void animsys_evaluate_drivers(PointerRNA *ptr,
          * NOTE: for 'layering' option later on, we should check if we should remove old value
          * before adding new to only be done when drivers only changed. */
         PathResolvedRNA anim_rna;
-        if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+        if (animsys_rna_path_resolve_cached(
+                ptr, fcu->rna_path, fcu->array_index, &path_cache, &anim_rna)) {
           const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
           ok = BKE_animsys_write_to_rna_path(&anim_rna, curval);
         }
@@ -834,12 +889,15 @@ void animsys_evaluate_action_group(PointerRNA *ptr,
     return;
   }
 
+  AnimsysPathResolveCache path_cache = {NULL};
+
   /* calculate then execute each curve */
   for (fcu = agrp->channels.first; (fcu) && (fcu->grp == agrp); fcu = fcu->next) {
     /* check if this curve should be skipped */
     if ((fcu->flag & (FCURVE_MUTED | FCURVE_DISABLED)) == 0 && !BKE_fcurve_is_empty(fcu)) {
       PathResolvedRNA anim_rna;
-      if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+      if (animsys_rna_path_resolve_cached(
+              ptr, fcu->rna_path, fcu->array_index, &path_cache, &anim_rna)) {
         const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
         BKE_animsys_write_to_rna_path(&anim_rna, curval);
       }
@@ -3014,6 +3072,8 @@ void nladata_flush_channels(PointerRNA *ptr,
     return;
   }
 
+  AnimsysPathResolveCache orig_path_cache = {NULL};
+
   /* for each channel with accumulated values, write its value on the property it affects */
   LISTBASE_FOREACH (NlaEvalChannel *, nec, &channels->channels) {
     /**
@@ -3037,7 +3097,8 @@ void nladata_flush_channels(PointerRNA *ptr,
         }
         BKE_animsys_write_to_rna_path(&rna, value);
         if (flush_to_original) {
-          animsys_write_orig_anim_rna(ptr, nec->rna_path, rna.prop_index, value);
+          animsys_write_orig_anim_rna(
+              ptr, nec->rna_path, rna.prop_index, value, &orig_path_cache);
         }
       }
     }
@@ -4165,7 +4226,7 @@ void BKE_animsys_eval_driver(Depsgraph *depsgraph, ID *id, int driver_index, FCu
 
         /* Flush results & status codes to original data for UI (T59984) */
         if (ok && DEG_is_active(depsgraph)) {
-          animsys_write_orig_anim_rna(&id_ptr, fcu->rna_path, fcu->array_index, curval);
+          animsys_write_orig_anim_rna(&id_ptr, fcu->rna_path, fcu->array_index, curval, NULL);
 
           /* curval is displayed in the UI, and flag contains error-status codes */
           fcu_orig->curval = fcu->curval;
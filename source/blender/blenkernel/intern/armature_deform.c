@@ -222,6 +222,15 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
  * #BKE_armature_deform_coords and related functions.
  * \{ */
 
+typedef enum eArmatureSkinGroup {
+  /** The group doesn't deform the vertices. */
+  ARM_SKIN_GROUP_NONE = 0,
+  /** The bone of the group can use its matrix in #ArmatureUserdata.skin_mats_from_defbase. */
+  ARM_SKIN_GROUP_MATRIX = 1,
+  /** The bone of the group needs the regular deformation. */
+  ARM_SKIN_GROUP_BONE = 2,
+} eArmatureSkinGroup;
+
 typedef struct ArmatureUserdata {
   const Object *ob_arm;
   const Mesh *me_target;
@@ -242,6 +251,14 @@ typedef struct ArmatureUserdata {
   bPoseChannel **pchan_from_defbase;
   int defbase_len;
 
+  /**
+   * Deform matrix of the bone of every vertex group, including the pre and post matrices, or
+   * null when the simple linear blending path can't be used. See #armature_vert_skin_deform.
+   */
+  float (*skin_mats_from_defbase)[4][4];
+  /** How the weights of every vertex group are used, see #eArmatureSkinGroup. */
+  uchar *skin_group_from_defbase;
+
   float premat[4][4];
   float postmat[4][4];
 
@@ -251,6 +268,57 @@ typedef struct ArmatureUserdata {
   } bmesh;
 } ArmatureUserdata;
 
+/**
+ * Linear blending of bones without B-Bone segments: the deformation of a vertex is a weighted
+ * sum of matrices, so the pre and post matrices can be combined with the bone matrices once,
+ * instead of transforming every vertex to armature space and back.
+ *
+ * \return false if the vertex is deformed by bones that don't support this, in which case
+ * nothing was changed.
+ */
+static bool armature_vert_skin_deform(const ArmatureUserdata *data,
+                                      const MDeformVert *dvert,
+                                      const float armature_weight,
+                                      float co[3])
+{
+  const MDeformWeight *dw = dvert->dw;
+  bool deformed = false;
+  float mat[4][4];
+  float contrib = 0.0f;
+  zero_m4(mat);
+  for (uint j = dvert->totweight; j != 0; j--, dw++) {
+    const uint index = dw->def_nr;
+    if (index >= data->defbase_len) {
+      continue;
+    }
+    switch ((eArmatureSkinGroup)data->skin_group_from_defbase[index]) {
+      case ARM_SKIN_GROUP_NONE:
+        break;
+      case ARM_SKIN_GROUP_MATRIX:
+        madd_m4_m4m4fl(mat, mat, data->skin_mats_from_defbase[index], dw->weight);
+        contrib += dw->weight;
+        deformed = true;
+        break;
+      case ARM_SKIN_GROUP_BONE:
+        return false;
+    }
+  }
+  if (!deformed) {
+    /* Fall back to envelopes. */
+    return !data->use_envelope;
+  }
+
+  /* actually should be EPSILON? weight values and contrib can be like 10e-39 small */
+  if (contrib > 0.0001f) {
+    float dco[3];
+    mul_v3_m4v3(dco, mat, co);
+    mul_v3_fl(dco, 1.0f / contrib);
+    sub_v3_v3(dco, co);
+    madd_v3_v3fl(co, dco, armature_weight);
+  }
+  return true;
+}
+
 static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
                                           const int i,
                                           const MDeformVert *dvert)
@@ -318,6 +386,12 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     co = vert_coords[i];
   }
 
+  if (data->skin_mats_from_defbase && dvert && dvert->totweight) {
+    if (armature_vert_skin_deform(data, dvert, armature_weight, co)) {
+      return;
+    }
+  }
+
   /* Apply the object's matrix */
   mul_m4_v3(data->premat, co);
 
@@ -587,6 +661,30 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   mul_m4_m4m4(data.postmat, obinv, ob_arm->object_to_world);
   invert_m4_m4(data.premat, data.postmat);
 
+  /* The matrices are only used for linear blending without interpolation with the previous
+   * coordinates. Deform matrices would also need the bone matrices separately. */
+  if (use_dverts && !use_quaternion && !vert_deform_mats && !vert_coords_prev) {
+    data.skin_mats_from_defbase = MEM_malloc_arrayN(
+        defbase_len, sizeof(*data.skin_mats_from_defbase), __func__);
+    data.skin_group_from_defbase = MEM_malloc_arrayN(
+        defbase_len, sizeof(*data.skin_group_from_defbase), __func__);
+    for (int i = 0; i < defbase_len; i++) {
+      const bPoseChannel *pchan = pchan_from_defbase[i];
+      if (pchan == NULL) {
+        data.skin_group_from_defbase[i] = ARM_SKIN_GROUP_NONE;
+        continue;
+      }
+      const Bone *bone = pchan->bone;
+      if ((bone->flag & BONE_MULT_VG_ENV) ||
+          (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments)) {
+        data.skin_group_from_defbase[i] = ARM_SKIN_GROUP_BONE;
+        continue;
+      }
+      mul_m4_series(data.skin_mats_from_defbase[i], data.postmat, pchan->chan_mat, data.premat);
+      data.skin_group_from_defbase[i] = ARM_SKIN_GROUP_MATRIX;
+    }
+  }
+
   if (em_target != NULL) {
     /* While this could cause an extra loop over mesh data, in most cases this will
      * have already been properly set. */
@@ -614,6 +712,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   if (pchan_from_defbase) {
     MEM_freeN(pchan_from_defbase);
   }
+  MEM_SAFE_FREE(data.skin_mats_from_defbase);
+  MEM_SAFE_FREE(data.skin_group_from_defbase);
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
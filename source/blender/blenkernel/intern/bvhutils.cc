@@ -26,6 +26,7 @@
 #include "BKE_editmesh.h"
 #include "BKE_mesh.h"
 #include "BKE_mesh_runtime.h"
+#include "BKE_pointcloud.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -40,6 +41,8 @@ using blender::VArray;
 
 struct BVHCacheItem {
   bool is_filled;
+  /** The positions changed since the tree was built, see #bvhcache_tag_positions_changed. */
+  bool needs_refit;
   BVHTree *tree;
 };
 
@@ -79,7 +82,7 @@ static bool bvhcache_find(BVHCache **bvh_cache_p,
   }
   BVHCache *bvh_cache = *bvh_cache_p;
 
-  if (bvh_cache->items[type].is_filled) {
+  if (bvh_cache->items[type].is_filled && !bvh_cache->items[type].needs_refit) {
     *r_tree = bvh_cache->items[type].tree;
     return true;
   }
@@ -136,6 +139,32 @@ static void bvhcache_insert(BVHCache *bvh_cache, BVHTree *tree, BVHCacheType typ
   BLI_assert(!item->is_filled);
   item->tree = tree;
   item->is_filled = true;
+  item->needs_refit = false;
+}
+
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache)
+{
+  for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
+    BVHCacheItem *item = &bvh_cache->items[index];
+    if (!item->is_filled) {
+      continue;
+    }
+    if (item->tree != nullptr && ELEM(index,
+                                      BVHTREE_FROM_VERTS,
+                                      BVHTREE_FROM_EDGES,
+                                      BVHTREE_FROM_LOOPTRI,
+                                      BVHTREE_FROM_LOOPTRI_NO_HIDDEN,
+                                      BVHTREE_FROM_LOOSEVERTS,
+                                      BVHTREE_FROM_LOOSEEDGES)) {
+      item->needs_refit = true;
+      continue;
+    }
+    /* Legacy faces might not be up to date, and edit-mesh trees are rare enough on evaluated
+     * meshes that rebuilding them is fine. Trees without elements have nothing to refit. */
+    BLI_bvhtree_free(item->tree);
+    item->tree = nullptr;
+    item->is_filled = false;
+  }
 }
 
 void bvhcache_free(BVHCache *bvh_cache)
@@ -171,6 +200,77 @@ static void bvhtree_balance(BVHTree *tree, const bool isolate)
   }
 }
 
+static int mesh_verts_refit_co(void *userdata, int index, float r_co[3][3])
+{
+  const BVHTreeFromMesh *data = (const BVHTreeFromMesh *)userdata;
+  copy_v3_v3(r_co[0], data->vert[index].co);
+  return 1;
+}
+
+static int mesh_edges_refit_co(void *userdata, int index, float r_co[3][3])
+{
+  const BVHTreeFromMesh *data = (const BVHTreeFromMesh *)userdata;
+  const MEdge &edge = data->edge[index];
+  copy_v3_v3(r_co[0], data->vert[edge.v1].co);
+  copy_v3_v3(r_co[1], data->vert[edge.v2].co);
+  return 2;
+}
+
+static int mesh_looptri_refit_co(void *userdata, int index, float r_co[3][3])
+{
+  const BVHTreeFromMesh *data = (const BVHTreeFromMesh *)userdata;
+  const MLoopTri &lt = data->looptri[index];
+  for (int i = 0; i < 3; i++) {
+    copy_v3_v3(r_co[i], data->vert[data->loop[lt.tri[i]].v].co);
+  }
+  return 3;
+}
+
+struct BVHRefitIsolatedData {
+  BVHTree *tree;
+  BVHTree_RefitCallback callback;
+  const BVHTreeFromMesh *data;
+};
+
+static void bvhtree_refit_isolated(void *userdata)
+{
+  BVHRefitIsolatedData *refit_data = (BVHRefitIsolatedData *)userdata;
+  BLI_bvhtree_refit(refit_data->tree, refit_data->callback, (void *)refit_data->data);
+}
+
+/**
+ * Update the bounds of a cached tree after the positions of the mesh changed, which is much
+ * faster than building it again. Like balancing, this is multi-threaded and runs in isolation
+ * because the cache mutex is locked.
+ */
+static void bvhcache_refit_mesh_tree(BVHCacheItem *item,
+                                     const BVHCacheType type,
+                                     const BVHTreeFromMesh *data)
+{
+  BVHRefitIsolatedData refit_data;
+  refit_data.tree = item->tree;
+  refit_data.data = data;
+  switch (type) {
+    case BVHTREE_FROM_VERTS:
+    case BVHTREE_FROM_LOOSEVERTS:
+      refit_data.callback = mesh_verts_refit_co;
+      break;
+    case BVHTREE_FROM_EDGES:
+    case BVHTREE_FROM_LOOSEEDGES:
+      refit_data.callback = mesh_edges_refit_co;
+      break;
+    case BVHTREE_FROM_LOOPTRI:
+    case BVHTREE_FROM_LOOPTRI_NO_HIDDEN:
+      refit_data.callback = mesh_looptri_refit_co;
+      break;
+    default:
+      BLI_assert_unreachable();
+      return;
+  }
+  BLI_task_isolate(bvhtree_refit_isolated, &refit_data);
+  item->needs_refit = false;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1237,6 +1337,17 @@ BVHTree *BKE_bvhtree_from_mesh_get(struct BVHTreeFromMesh *data,
     return data->tree;
   }
 
+  BVHCacheItem *item = &(*bvh_cache_p)->items[bvh_cache_type];
+  if (item->is_filled) {
+    /* The topology is the same, only the positions changed. */
+    BLI_assert(item->needs_refit);
+    bvhcache_refit_mesh_tree(item, bvh_cache_type, data);
+    bvhcache_unlock(*bvh_cache_p, lock_started);
+    data->tree = item->tree;
+    data->cached = true;
+    return data->tree;
+  }
+
   /* Create BVHTree. */
   BitVector<> mask;
   int mask_bits_act_len = -1;
@@ -1419,26 +1530,55 @@ void free_bvhtree_from_mesh(struct BVHTreeFromMesh *data)
 /** \name Point Cloud BVH Building
  * \{ */
 
-BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
-                                         const PointCloud *pointcloud,
-                                         const int tree_type)
+static BVHTree *bvhtree_from_pointcloud_create(const blender::Span<blender::float3> positions,
+                                               const int tree_type)
 {
-  BVHTree *tree = BLI_bvhtree_new(pointcloud->totpoint, 0.0f, tree_type, 6);
+  BVHTree *tree = BLI_bvhtree_new(positions.size(), 0.0f, tree_type, 6);
   if (!tree) {
     return nullptr;
   }
-
-  blender::bke::AttributeAccessor attributes = pointcloud->attributes();
-  blender::VArraySpan<blender::float3> positions = attributes.lookup_or_default<blender::float3>(
-      "position", ATTR_DOMAIN_POINT, blender::float3(0));
-
   for (const int i : positions.index_range()) {
     BLI_bvhtree_insert(tree, i, positions[i], 1);
   }
-  BLI_assert(BLI_bvhtree_get_len(tree) == pointcloud->totpoint);
+  BLI_assert(BLI_bvhtree_get_len(tree) == positions.size());
   bvhtree_balance(tree, false);
+  return tree;
+}
 
-  data->coords = (const float(*)[3])positions.data();
+BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
+                                         const PointCloud *pointcloud,
+                                         const int tree_type)
+{
+  using namespace blender;
+  memset(data, 0, sizeof(*data));
+
+  const bke::AttributeAccessor attributes = pointcloud->attributes();
+  const VArray<float3> positions_varray = attributes.lookup<float3>(POINTCLOUD_ATTR_POSITION,
+                                                                    ATTR_DOMAIN_POINT);
+  if (!positions_varray || !positions_varray.is_span()) {
+    return nullptr;
+  }
+  const Span<float3> positions = positions_varray.get_internal_span();
+
+  /* Nodes usually build the tree with the default type. Cache that tree on the point cloud, so
+   * that it's shared between nodes and evaluations until the positions change. */
+  BVHTree *tree = nullptr;
+  if (tree_type == 2) {
+    using CachedTree = std::unique_ptr<BVHTree, bke::BVHTreeDeleter>;
+    pointcloud->runtime->bvh_cache.ensure([&](CachedTree &r_tree) {
+      r_tree.reset(bvhtree_from_pointcloud_create(positions, tree_type));
+    });
+    tree = pointcloud->runtime->bvh_cache.data().get();
+    data->cached = true;
+  }
+  else {
+    tree = bvhtree_from_pointcloud_create(positions, tree_type);
+  }
+  if (!tree) {
+    return nullptr;
+  }
+
+  data->coords = reinterpret_cast<const float(*)[3]>(positions.data());
   data->tree = tree;
   data->nearest_callback = nullptr;
 
@@ -1447,7 +1587,7 @@ BVHTree *BKE_bvhtree_from_pointcloud_get(BVHTreeFromPointCloud *data,
 
 void free_bvhtree_from_pointcloud(BVHTreeFromPointCloud *data)
 {
-  if (data->tree) {
+  if (data->tree && !data->cached) {
     BLI_bvhtree_free(data->tree);
   }
   memset(data, 0, sizeof(*data));
@@ -21,6 +21,7 @@
 #include "BLI_hash_mm3.h"
 #include "BLI_listbase.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "RE_pipeline.h"
 
@@ -183,7 +184,8 @@ uint32_t BKE_cryptomatte_object_hash(CryptomatteSession *session,
                                      const char *layer_name,
                                      const Object *object)
 {
-  blender::bke::cryptomatte::CryptomatteLayer *layer = session->layers.lookup_ptr(layer_name);
+  blender::bke::cryptomatte::CryptomatteLayer *layer = session->layers.lookup_ptr_as(
+      blender::StringRef(layer_name));
   BLI_assert(layer);
   return layer->add_ID(object->id);
 }
@@ -195,7 +197,8 @@ uint32_t BKE_cryptomatte_material_hash(CryptomatteSession *session,
   if (material == nullptr) {
     return 0.0f;
   }
-  blender::bke::cryptomatte::CryptomatteLayer *layer = session->layers.lookup_ptr(layer_name);
+  blender::bke::cryptomatte::CryptomatteLayer *layer = session->layers.lookup_ptr_as(
+      blender::StringRef(layer_name));
   BLI_assert(layer);
   return layer->add_ID(material->id);
 }
@@ -450,24 +453,56 @@ static bool from_manifest(CryptomatteLayer &layer, blender::StringRefNull manife
   return true;
 }
 
-static std::string to_manifest(const CryptomatteLayer *layer)
+/* Append `"name":"hash"`, quoting the name like `std::quoted` does. */
+static void append_manifest_entry(std::string &manifest,
+                                  const StringRef name,
+                                  const CryptomatteHash hash)
 {
-  std::stringstream manifest;
+  manifest += '"';
+  for (const char c : name) {
+    if (ELEM(c, '"', '\\')) {
+      manifest += '\\';
+    }
+    manifest += c;
+  }
+  char hex_encoded[16];
+  BLI_snprintf(hex_encoded, sizeof(hex_encoded), "\":\"%08x\"", hash.hash);
+  manifest += hex_encoded;
+}
 
-  bool is_first = true;
+static std::string to_manifest(const CryptomatteLayer *layer)
+{
   const blender::Map<std::string, CryptomatteHash> &const_map = layer->hashes;
-  manifest << "{";
+  Vector<std::pair<StringRef, CryptomatteHash>> entries;
+  entries.reserve(const_map.size());
   for (blender::Map<std::string, CryptomatteHash>::Item item : const_map.items()) {
-    if (is_first) {
-      is_first = false;
-    }
-    else {
-      manifest << ",";
+    entries.append({item.key, item.value});
+  }
+
+  /* Scenes can have many objects, so parts of the manifest are written in parallel and joined
+   * afterwards, keeping the order of the map. */
+  const int64_t grain_size = 4096;
+  Vector<std::string> parts((entries.size() + grain_size - 1) / grain_size);
+  threading::parallel_for(parts.index_range(), 1, [&](const IndexRange parts_range) {
+    for (const int64_t part_index : parts_range) {
+      std::string &part = parts[part_index];
+      const IndexRange range = entries.index_range().slice(
+          part_index * grain_size, std::min(grain_size, entries.size() - part_index * grain_size));
+      for (const int64_t i : range) {
+        if (i != 0) {
+          part += ',';
+        }
+        append_manifest_entry(part, entries[i].first, entries[i].second);
+      }
     }
-    manifest << quoted(item.key) << ":\"" << item.value.hex_encoded() << "\"";
+  });
+
+  std::string manifest = "{";
+  for (const std::string &part : parts) {
+    manifest += part;
   }
-  manifest << "}";
-  return manifest.str();
+  manifest += "}";
+  return manifest;
 }
 
 }  // namespace manifest
@@ -540,7 +575,8 @@ uint32_t CryptomatteLayer::add_ID(const ID &id)
 
 void CryptomatteLayer::add_hash(blender::StringRef name, CryptomatteHash cryptomatte_hash)
 {
-  hashes.add_overwrite(name, cryptomatte_hash);
+  /* IDs are added for every render, only construct the key when the name is new. */
+  hashes.add_overwrite_as(name, cryptomatte_hash);
 }
 
 std::optional<std::string> CryptomatteLayer::operator[](float encoded_hash) const
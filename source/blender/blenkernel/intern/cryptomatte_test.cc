@@ -2,6 +2,8 @@
  * Copyright 2021 Blender Foundation. */
 #include "testing/testing.h"
 
+#include <algorithm>
+
 #include "BKE_cryptomatte.h"
 #include "BKE_cryptomatte.hh"
 #include "BKE_image.h"
@@ -51,6 +53,23 @@ TEST(cryptomatte, layer_quoted)
   ASSERT_EQ("{\"\\\"Object\\\"\":\"0000007b\"}", layer.manifest());
 }
 
+TEST(cryptomatte, layer_many_entries)
+{
+  /* Large layers have their manifest written in parts, check that they are joined correctly. */
+  blender::bke::cryptomatte::CryptomatteLayer layer;
+  const int entries_num = 10000;
+  for (int i = 0; i < entries_num; i++) {
+    layer.add_hash("Object" + std::to_string(i), i);
+  }
+  const std::string manifest = layer.manifest();
+  EXPECT_EQ(std::count(manifest.begin(), manifest.end(), ','), entries_num - 1);
+
+  std::unique_ptr<blender::bke::cryptomatte::CryptomatteLayer> read_layer =
+      blender::bke::cryptomatte::CryptomatteLayer::read_from_manifest(manifest);
+  EXPECT_EQ(read_layer->hashes.size(), entries_num);
+  EXPECT_EQ(read_layer->hashes.lookup("Object1234").hash, 1234u);
+}
+
 static void test_cryptomatte_manifest(std::string expected, std::string manifest)
 {
   EXPECT_EQ(expected,
@@ -246,20 +246,22 @@ BoundBox *BKE_curves_boundbox_get(Object *ob)
 
   if (ob->runtime.bb == nullptr) {
     ob->runtime.bb = MEM_cnew<BoundBox>(__func__);
+  }
 
-    const blender::bke::CurvesGeometry &curves = blender::bke::CurvesGeometry::wrap(
-        curves_id->geometry);
-
-    float3 min(FLT_MAX);
-    float3 max(-FLT_MAX);
-    if (!curves.bounds_min_max(min, max)) {
-      min = float3(-1);
-      max = float3(1);
-    }
+  const blender::bke::CurvesGeometry &curves = blender::bke::CurvesGeometry::wrap(
+      curves_id->geometry);
 
-    BKE_boundbox_init_from_minmax(ob->runtime.bb, min, max);
+  /* The bounds are cached on the geometry, so recomputing the box when it is dirty is cheap. */
+  float3 min(FLT_MAX);
+  float3 max(-FLT_MAX);
+  if (!curves.bounds_min_max(min, max)) {
+    min = float3(-1);
+    max = float3(1);
   }
 
+  BKE_boundbox_init_from_minmax(ob->runtime.bb, min, max);
+  ob->runtime.bb->flag &= ~BOUNDBOX_DIRTY;
+
   return ob->runtime.bb;
 }
 
@@ -8,6 +8,9 @@
  * BKE_customdata.h contains the function prototypes for this file.
  */
 
+#include <atomic>
+#include <mutex>
+
 #include "MEM_guardedalloc.h"
 
 /* Since we have versioning code here (CustomData_verify_versions()). */
@@ -2248,6 +2251,96 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
                                                        int totelem,
                                                        const char *name);
 
+/**
+ * Layer data that is shared between multiple layers, e.g. of an original mesh and its
+ * copy-on-write copy. The data is freed when the last layer stops using it. Shared data must not
+ * be modified, layers are made the sole owner of their data again with
+ * #customData_layer_ensure_owned before writing, which happens in the
+ * `CustomData_duplicate_referenced_layer` functions.
+ */
+struct CustomDataLayerSharing {
+  std::atomic<int> users;
+  void *data;
+  int type;
+  int totelem;
+};
+
+static void customData_free_layer_data(const int type, void *data, const int totelem)
+{
+  const LayerTypeInfo *typeInfo = layerType_getInfo(type);
+  if (typeInfo->free) {
+    typeInfo->free(data, totelem, typeInfo->size);
+  }
+  MEM_freeN(data);
+}
+
+static void customData_layer_sharing_remove_user(CustomDataLayerSharing *sharing)
+{
+  if (sharing->users.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    customData_free_layer_data(sharing->type, sharing->data, sharing->totelem);
+    MEM_delete(sharing);
+  }
+}
+
+/**
+ * Protects the creation of the sharing and the ownership changes of shared layers. The same
+ * original data can be copied by multiple dependency graphs at the same time, e.g. when rendering.
+ */
+static std::mutex &customData_layer_sharing_mutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+/** Share the data of the source layer with the destination layer, which must have no data. */
+static void customData_layer_share(CustomDataLayer *src_layer,
+                                   CustomDataLayer *dst_layer,
+                                   const int totelem)
+{
+  BLI_assert(!(src_layer->flag & CD_FLAG_NOFREE));
+  std::lock_guard lock{customData_layer_sharing_mutex()};
+  if (src_layer->sharing == nullptr) {
+    CustomDataLayerSharing *sharing = MEM_new<CustomDataLayerSharing>(__func__);
+    sharing->users.store(1, std::memory_order_relaxed);
+    sharing->data = src_layer->data;
+    sharing->type = src_layer->type;
+    sharing->totelem = totelem;
+    src_layer->sharing = sharing;
+  }
+  src_layer->sharing->users.fetch_add(1, std::memory_order_relaxed);
+  dst_layer->sharing = src_layer->sharing;
+  dst_layer->data = src_layer->data;
+}
+
+/**
+ * Make sure the layer is the only owner of its data, so that it can be modified. Shared data is
+ * copied when other layers still use it.
+ */
+static void customData_layer_ensure_owned(CustomDataLayer *layer)
+{
+  if (layer->sharing == nullptr) {
+    return;
+  }
+  std::lock_guard lock{customData_layer_sharing_mutex()};
+  CustomDataLayerSharing *sharing = layer->sharing;
+  layer->sharing = nullptr;
+  if (sharing->users.load(std::memory_order_acquire) == 1) {
+    /* This layer is the last user, so it can take over the data. */
+    MEM_delete(sharing);
+    return;
+  }
+  const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+  void *data = MEM_malloc_arrayN(size_t(sharing->totelem), typeInfo->size, __func__);
+  if (typeInfo->copy) {
+    typeInfo->copy(sharing->data, data, sharing->totelem);
+  }
+  else {
+    memcpy(data, sharing->data, size_t(sharing->totelem) * typeInfo->size);
+  }
+  layer->data = data;
+  customData_layer_sharing_remove_user(sharing);
+}
+
 void CustomData_update_typemap(CustomData *data)
 {
   int lasttype = -1;
@@ -2325,6 +2418,7 @@ bool CustomData_merge(const CustomData *source,
       case CD_ASSIGN:
       case CD_REFERENCE:
       case CD_DUPLICATE:
+      case CD_SHARE:
         data = layer->data;
         break;
       default:
@@ -2332,13 +2426,20 @@ bool CustomData_merge(const CustomData *source,
         break;
     }
 
+    eCDAllocType layer_alloctype = alloctype;
     if ((alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
-      newlayer = customData_add_layer__internal(
-          dest, type, CD_REFERENCE, data, totelem, layer->name);
+      layer_alloctype = CD_REFERENCE;
     }
-    else {
-      newlayer = customData_add_layer__internal(dest, type, alloctype, data, totelem, layer->name);
+    else if ((alloctype == CD_ASSIGN) && layer->sharing != nullptr) {
+      /* Transfer the ownership of the shared data, see below. */
+      layer_alloctype = CD_SHARE;
+    }
+    else if ((alloctype == CD_SHARE) && (flag & CD_FLAG_NOFREE)) {
+      /* Only data owned by the source can be shared. */
+      layer_alloctype = CD_DUPLICATE;
     }
+    newlayer = customData_add_layer__internal(
+        dest, type, layer_alloctype, data, totelem, layer->name);
 
     if (newlayer) {
       newlayer->uid = layer->uid;
@@ -2359,7 +2460,14 @@ bool CustomData_merge(const CustomData *source,
           BKE_anonymous_attribute_id_increment_weak(layer->anonymous_id);
         }
       }
+      if (layer_alloctype == CD_SHARE && newlayer->data != nullptr && newlayer->data == data) {
+        customData_layer_share(layer, newlayer, totelem);
+      }
       if (alloctype == CD_ASSIGN) {
+        if (layer->sharing != nullptr) {
+          customData_layer_sharing_remove_user(layer->sharing);
+          layer->sharing = nullptr;
+        }
         layer->data = nullptr;
       }
     }
@@ -2415,6 +2523,7 @@ void CustomData_realloc(CustomData *data, const int old_size, const int new_size
 
     const int64_t old_size_in_bytes = int64_t(old_size) * typeInfo->size;
     const int64_t new_size_in_bytes = int64_t(new_size) * typeInfo->size;
+    customData_layer_ensure_owned(layer);
     if (layer->flag & CD_FLAG_NOFREE) {
       const void *old_data = layer->data;
       layer->data = MEM_malloc_arrayN(new_size, typeInfo->size, __func__);
@@ -2457,22 +2566,16 @@ void CustomData_copy(const CustomData *source,
 
 static void customData_free_layer__internal(CustomDataLayer *layer, const int totelem)
 {
-  const LayerTypeInfo *typeInfo;
-
   if (layer->anonymous_id != nullptr) {
     BKE_anonymous_attribute_id_decrement_weak(layer->anonymous_id);
     layer->anonymous_id = nullptr;
   }
-  if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
-    typeInfo = layerType_getInfo(layer->type);
-
-    if (typeInfo->free) {
-      typeInfo->free(layer->data, totelem, typeInfo->size);
-    }
-
-    if (layer->data) {
-      MEM_freeN(layer->data);
-    }
+  if (layer->sharing != nullptr) {
+    customData_layer_sharing_remove_user(layer->sharing);
+    layer->sharing = nullptr;
+  }
+  else if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
+    customData_free_layer_data(layer->type, layer->data, totelem);
   }
 }
 
@@ -2842,6 +2945,13 @@ static CustomDataLayer *customData_add_layer__internal(CustomData *data,
         flag |= CD_FLAG_NOFREE;
       }
       break;
+    case CD_SHARE:
+      /* The sharing is set up by the caller, which knows the source layer. */
+      if (totelem > 0) {
+        BLI_assert(layerdata != nullptr);
+        newlayerdata = layerdata;
+      }
+      break;
     case CD_DUPLICATE:
       if (totelem > 0) {
         newlayerdata = MEM_malloc_arrayN(totelem, typeInfo->size, layerType_getName(type));
@@ -3095,6 +3205,8 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
+  customData_layer_ensure_owned(layer);
+
   if (layer->flag & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
@@ -3362,6 +3474,7 @@ void CustomData_free_elem(CustomData *data, const int index, const int count)
       const LayerTypeInfo *typeInfo = layerType_getInfo(data->layers[i].type);
 
       if (typeInfo->free) {
+        customData_layer_ensure_owned(&data->layers[i]);
         size_t offset = size_t(index) * typeInfo->size;
 
         typeInfo->free(POINTER_OFFSET(data->layers[i].data, offset), count, typeInfo->size);
@@ -5260,6 +5373,7 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+    layer->sharing = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
       BLO_read_data_address(reader, &layer->data);
@@ -922,6 +922,14 @@ static void tag_component_positions_changed(void *owner)
   }
 }
 
+static void tag_component_sharpness_changed(void *owner)
+{
+  Mesh *mesh = static_cast<Mesh *>(owner);
+  if (mesh != nullptr) {
+    BKE_mesh_tag_sharpness_changed(mesh);
+  }
+}
+
 static bool get_shade_smooth(const MPoly &mpoly)
 {
   return mpoly.flag & ME_SMOOTH;
@@ -1288,7 +1296,7 @@ static ComponentAttributeProviders create_attribute_providers_for_mesh()
       face_access,
       make_derived_read_attribute<MPoly, bool, get_shade_smooth>,
       make_derived_write_attribute<MPoly, bool, get_shade_smooth, set_shade_smooth>,
-      nullptr);
+      tag_component_sharpness_changed);
 
   static BuiltinCustomDataLayerProvider crease(
       "crease",
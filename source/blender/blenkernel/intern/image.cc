@@ -68,6 +68,7 @@
 #include "BKE_idtype.h"
 #include "BKE_image.h"
 #include "BKE_image_format.h"
+#include "BKE_image_read_ahead.h"
 #include "BKE_lib_id.h"
 #include "BKE_main.h"
 #include "BKE_node.h"
@@ -618,6 +619,8 @@ void BKE_image_free_buffers_ex(Image *ima, bool do_lock)
 
   BKE_image_free_gputextures(ima);
 
+  BKE_image_read_ahead_cancel(ima);
+
   if (do_lock) {
     BLI_mutex_unlock(static_cast<ThreadMutex *>(ima->runtime.cache_mutex));
   }
@@ -4088,6 +4091,53 @@ static ImBuf *image_load_movie_file(Image *ima, ImageUser *iuser, int frame)
   return ibuf;
 }
 
+static bool image_sequence_frame_is_cached(Image *ima, const int frame)
+{
+  bool is_cached_empty = false;
+  ImBuf *ibuf = image_get_cached_ibuf_for_index_entry(ima, 0, frame, &is_cached_empty);
+  const bool is_cached = ibuf != nullptr || is_cached_empty;
+  IMB_freeImBuf(ibuf);
+  return is_cached;
+}
+
+/**
+ * Read the next frames of an image sequence in the background, in the direction of playback.
+ * The direction is guessed from the neighbor frames that are cached already.
+ */
+static void image_read_ahead_sequence(Image *ima,
+                                      const ImageUser *iuser,
+                                      const int cfra,
+                                      const int flag)
+{
+  if (BKE_image_is_multiview(ima) || ima->type == IMA_TYPE_MULTILAYER) {
+    return;
+  }
+
+  const bool is_backwards = image_sequence_frame_is_cached(ima, cfra + 1) &&
+                            !image_sequence_frame_is_cached(ima, cfra - 1);
+  const int direction = is_backwards ? -1 : 1;
+  char filepaths[IMAGE_READ_AHEAD_FRAMES_MAX][FILE_MAX];
+  const char *filepath_ptrs[IMAGE_READ_AHEAD_FRAMES_MAX];
+  int filepaths_num = 0;
+
+  for (int i = 1; i <= IMAGE_READ_AHEAD_FRAMES_MAX; i++) {
+    const int frame = cfra + direction * i;
+    if (image_sequence_frame_is_cached(ima, frame)) {
+      continue;
+    }
+
+    ImageUser iuser_t = *iuser;
+    iuser_t.framenr = frame;
+    iuser_t.view = 0;
+    BKE_image_user_file_path(&iuser_t, ima, filepaths[filepaths_num]);
+    filepath_ptrs[filepaths_num] = filepaths[filepaths_num];
+    filepaths_num++;
+  }
+
+  BKE_image_read_ahead_schedule(
+      ima, filepath_ptrs, filepaths_num, flag, ima->colorspace_settings.name);
+}
+
 static ImBuf *load_image_single(Image *ima,
                                 ImageUser *iuser,
                                 int cfra,
@@ -4146,7 +4196,12 @@ static ImBuf *load_image_single(Image *ima,
     /* read ibuf */
     flag |= IB_metadata;
     flag |= imbuf_alpha_flags_for_image(ima);
-    ibuf = IMB_loadiffname(filepath, flag, ima->colorspace_settings.name);
+    if (is_sequence) {
+      ibuf = BKE_image_read_ahead_take(filepath, flag, ima->colorspace_settings.name);
+    }
+    if (ibuf == nullptr) {
+      ibuf = IMB_loadiffname(filepath, flag, ima->colorspace_settings.name);
+    }
   }
 
   if (ibuf) {
@@ -4184,6 +4239,10 @@ static ImBuf *load_image_single(Image *ima,
     }
   }
 
+  if (ibuf && is_sequence && iuser && view_id == 0) {
+    image_read_ahead_sequence(ima, iuser, cfra, flag);
+  }
+
   return ibuf;
 }
 
@@ -314,13 +314,78 @@ static void image_gpu_texture_partial_update_changes_available(
   }
 }
 
+/**
+ * Upload the new content of an image sequence or movie into the existing texture, instead of
+ * freeing it and creating a new one. This avoids reallocating the texture and its mipmaps for
+ * every frame when scrubbing, which causes noticeable hitches with large images.
+ *
+ * \return false when the existing texture cannot hold the new image buffer, in which case the
+ * GPU textures still have to be freed.
+ */
+static bool image_gpu_texture_update_in_place(Image *image, ImageUser *iuser)
+{
+  if (!ELEM(image->source, IMA_SRC_SEQUENCE, IMA_SRC_MOVIE)) {
+    return false;
+  }
+
+  int current_view = iuser ? iuser->multi_index : 0;
+  if (current_view >= 2) {
+    current_view = 0;
+  }
+  GPUTexture *tex = image->gputexture[TEXTARGET_2D][current_view];
+  if (tex == nullptr) {
+    return false;
+  }
+  /* Only the main texture is reused, the other targets are rarely used with animated images. */
+  for (int eye = 0; eye < 2; eye++) {
+    for (int i = 0; i < TEXTARGET_COUNT; i++) {
+      if (image->gputexture[i][eye] != nullptr && image->gputexture[i][eye] != tex) {
+        return false;
+      }
+    }
+  }
+
+  ImBuf *ibuf = BKE_image_acquire_ibuf(image, iuser, nullptr);
+  if (ibuf == nullptr) {
+    return false;
+  }
+
+  const bool use_high_bitdepth = (image->flag & IMA_HIGH_BITDEPTH);
+  /* The texture must have been created unscaled and with the same format. */
+  const bool is_compatible = (GPU_texture_width(tex) == ibuf->x) &&
+                             (GPU_texture_height(tex) == ibuf->y) &&
+                             (GPU_texture_format(tex) ==
+                              IMB_gpu_get_texture_format(ibuf, use_high_bitdepth, true));
+  if (is_compatible) {
+    const bool store_premultiplied = BKE_image_has_gpu_texture_premultiplied_alpha(image, ibuf);
+    IMB_update_gpu_texture_sub(tex,
+                               ibuf,
+                               0,
+                               0,
+                               0,
+                               ibuf->x,
+                               ibuf->y,
+                               use_high_bitdepth,
+                               true,
+                               store_premultiplied);
+    if (image->gpuflag & IMA_GPU_MIPMAP_COMPLETE) {
+      GPU_texture_generate_mipmap(tex);
+    }
+  }
+
+  BKE_image_release_ibuf(image, ibuf, nullptr);
+  return is_compatible;
+}
+
 static void image_gpu_texture_try_partial_update(Image *image, ImageUser *iuser)
 {
   PartialUpdateChecker<ImageTileData> checker(image, iuser, image->runtime.partial_update_user);
   PartialUpdateChecker<ImageTileData>::CollectResult changes = checker.collect_changes();
   switch (changes.get_result_code()) {
     case ePartialUpdateCollectResult::FullUpdateNeeded: {
-      image_free_gpu(image, true);
+      if (!image_gpu_texture_update_in_place(image, iuser)) {
+        image_free_gpu(image, true);
+      }
       break;
     }
 
@@ -625,7 +690,7 @@ static ImBuf *update_do_scale(uchar *rect,
 
   /* Scale pixels. */
   ImBuf *ibuf = IMB_allocFromBuffer((uint *)rect, rect_float, part_w, part_h, 4);
-  IMB_scaleImBuf(ibuf, *w, *h);
+  IMB_scaleImBuf_filtered(ibuf, *w, *h, IMB_SCALE_FILTER_MITCHELL);
 
   return ibuf;
 }
@@ -0,0 +1,254 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bke
+ */
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_vector.hh"
+
+#include "IMB_imbuf.h"
+#include "IMB_imbuf_types.h"
+
+#include "BKE_image_read_ahead.h"
+
+namespace blender::bke::image_read_ahead {
+
+enum class FrameState {
+  /** The task that reads the file did not start yet. */
+  Pending,
+  Reading,
+  Done,
+};
+
+struct Frame {
+  const void *owner = nullptr;
+  std::string filepath;
+  std::string colorspace;
+  bool has_colorspace = false;
+  int flag = 0;
+
+  FrameState state = FrameState::Pending;
+  /** Null when the file could not be read. */
+  ImBuf *ibuf = nullptr;
+  /** Color space after reading the file, see #IMB_loadiffname. */
+  char colorspace_result[IM_MAX_SPACE] = "";
+};
+
+struct ReadAheadState {
+  std::mutex mutex;
+  /** Notified whenever a frame has been read. */
+  std::condition_variable frame_done;
+  Map<std::string, Frame> frames;
+  TaskPool *task_pool = nullptr;
+};
+
+static ReadAheadState &get_state()
+{
+  static ReadAheadState state;
+  return state;
+}
+
+static std::string frame_key(const char *filepath, const int flag, const char *colorspace)
+{
+  return std::string(filepath) + '\n' + std::to_string(flag) + '\n' +
+         (colorspace ? colorspace : "");
+}
+
+static void frame_free(Frame &frame)
+{
+  if (frame.ibuf) {
+    IMB_freeImBuf(frame.ibuf);
+    frame.ibuf = nullptr;
+  }
+}
+
+static void read_frame_task(TaskPool *__restrict pool, void *taskdata)
+{
+  ReadAheadState &state = get_state();
+  const std::string &key = *static_cast<std::string *>(taskdata);
+
+  std::string filepath;
+  char colorspace[IM_MAX_SPACE];
+  bool has_colorspace;
+  int flag;
+  {
+    std::lock_guard lock{state.mutex};
+    Frame *frame = state.frames.lookup_ptr(key);
+    /* The frame was taken or discarded in the meantime. */
+    if (frame == nullptr || frame->state != FrameState::Pending) {
+      return;
+    }
+    if (BLI_task_pool_current_canceled(pool)) {
+      return;
+    }
+    frame->state = FrameState::Reading;
+    filepath = frame->filepath;
+    STRNCPY(colorspace, frame->colorspace.c_str());
+    has_colorspace = frame->has_colorspace;
+    flag = frame->flag;
+  }
+
+  ImBuf *ibuf = IMB_loadiffname(filepath.c_str(), flag, has_colorspace ? colorspace : nullptr);
+
+  {
+    std::lock_guard lock{state.mutex};
+    Frame *frame = state.frames.lookup_ptr(key);
+    if (frame && frame->state == FrameState::Reading) {
+      frame->ibuf = ibuf;
+      STRNCPY(frame->colorspace_result, colorspace);
+      frame->state = FrameState::Done;
+      ibuf = nullptr;
+    }
+  }
+  state.frame_done.notify_all();
+
+  if (ibuf) {
+    IMB_freeImBuf(ibuf);
+  }
+}
+
+static void free_task_data(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<std::string *>(taskdata));
+}
+
+/** Remove all frames of the owner that are not in the set. */
+static void discard_owner_frames(ReadAheadState &state,
+                                 const void *owner,
+                                 const Set<std::string> &keep)
+{
+  Vector<std::string> keys_to_remove;
+  for (auto item : state.frames.items()) {
+    if (item.value.owner == owner && !keep.contains(item.key)) {
+      keys_to_remove.append(item.key);
+    }
+  }
+  for (const std::string &key : keys_to_remove) {
+    /* Frames that are being read are freed by their task. */
+    frame_free(state.frames.lookup(key));
+    state.frames.remove(key);
+  }
+}
+
+}  // namespace blender::bke::image_read_ahead
+
+void BKE_image_read_ahead_schedule(const void *owner,
+                                   const char **filepaths,
+                                   const int filepaths_num,
+                                   const int flag,
+                                   const char *colorspace)
+{
+  using namespace blender;
+  using namespace blender::bke::image_read_ahead;
+  ReadAheadState &state = get_state();
+  std::lock_guard lock{state.mutex};
+
+  const int frames_num = std::min(filepaths_num, IMAGE_READ_AHEAD_FRAMES_MAX);
+  Set<std::string> keys;
+  for (int i = 0; i < frames_num; i++) {
+    keys.add(frame_key(filepaths[i], flag, colorspace));
+  }
+  discard_owner_frames(state, owner, keys);
+
+  if (state.task_pool == nullptr) {
+    state.task_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+  }
+
+  /* Tasks are pushed in order, so the nearest frames are usually read first. */
+  for (int i = 0; i < frames_num; i++) {
+    std::string key = frame_key(filepaths[i], flag, colorspace);
+    if (state.frames.contains(key)) {
+      continue;
+    }
+    Frame frame;
+    frame.owner = owner;
+    frame.filepath = filepaths[i];
+    frame.has_colorspace = colorspace != nullptr;
+    frame.colorspace = colorspace ? colorspace : "";
+    frame.flag = flag;
+    state.frames.add_new(key, std::move(frame));
+
+    BLI_task_pool_push(state.task_pool,
+                       read_frame_task,
+                       MEM_new<std::string>(__func__, std::move(key)),
+                       false,
+                       free_task_data);
+  }
+}
+
+ImBuf *BKE_image_read_ahead_take(const char *filepath, const int flag, char *colorspace)
+{
+  using namespace blender::bke::image_read_ahead;
+  ReadAheadState &state = get_state();
+  const std::string key = frame_key(filepath, flag, colorspace);
+
+  std::unique_lock lock{state.mutex};
+  Frame *frame = state.frames.lookup_ptr(key);
+  if (frame == nullptr) {
+    return nullptr;
+  }
+  if (frame->state == FrameState::Pending) {
+    /* Reading the file right away is faster than waiting for the task to be scheduled. */
+    state.frames.remove(key);
+    return nullptr;
+  }
+
+  /* The map can change while waiting, so the frame has to be looked up again. */
+  state.frame_done.wait(lock, [&]() {
+    frame = state.frames.lookup_ptr(key);
+    return frame == nullptr || frame->state == FrameState::Done;
+  });
+  if (frame == nullptr) {
+    return nullptr;
+  }
+
+  ImBuf *ibuf = frame->ibuf;
+  if (ibuf && colorspace) {
+    BLI_strncpy(colorspace, frame->colorspace_result, IM_MAX_SPACE);
+  }
+  state.frames.remove(key);
+  return ibuf;
+}
+
+void BKE_image_read_ahead_cancel(const void *owner)
+{
+  using namespace blender;
+  using namespace blender::bke::image_read_ahead;
+  ReadAheadState &state = get_state();
+  std::lock_guard lock{state.mutex};
+  discard_owner_frames(state, owner, {});
+}
+
+void BKE_image_read_ahead_exit()
+{
+  using namespace blender::bke::image_read_ahead;
+  ReadAheadState &state = get_state();
+
+  TaskPool *task_pool;
+  {
+    std::lock_guard lock{state.mutex};
+    task_pool = state.task_pool;
+    state.task_pool = nullptr;
+  }
+  if (task_pool) {
+    /* Wait without holding the lock, the running tasks need it to finish. */
+    BLI_task_pool_cancel(task_pool);
+    BLI_task_pool_free(task_pool);
+  }
+
+  std::lock_guard lock{state.mutex};
+  for (Frame &frame : state.frames.values()) {
+    frame_free(frame);
+  }
+  state.frames.clear();
+}
@@ -15,6 +15,7 @@
 #include "BLI_endian_switch.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -1393,8 +1394,29 @@ static void do_mesh_key(Object *ob, Key *key, char *out, const int tot)
     WeightsArrayCache cache = {0, nullptr};
     float **per_keyblock_weights;
     per_keyblock_weights = keyblock_get_per_block_weights(ob, key, &cache);
-    key_evaluate_relative(
-        0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    /* The active key is copied from the edit-mesh for every call, so avoid splitting the work
+     * in that case. */
+    const bool use_edit_mesh = key->from && GS(key->from->name) == ID_ME &&
+                               ((const Mesh *)key->from)->edit_mesh;
+    if (use_edit_mesh) {
+      key_evaluate_relative(
+          0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    }
+    else {
+      /* Blend all keys for one range of vertices at a time, which also keeps the result in the
+       * cache while it is accumulated. */
+      blender::threading::parallel_for(
+          blender::IndexRange(tot), 4096, [&](const blender::IndexRange range) {
+            key_evaluate_relative(int(range.first()),
+                                  int(range.one_after_last()),
+                                  tot,
+                                  (char *)out,
+                                  key,
+                                  actkb,
+                                  per_keyblock_weights,
+                                  KEY_MODE_DUMMY);
+          });
+    }
     keyblock_free_per_block_weights(key, per_keyblock_weights, &cache);
   }
   else {
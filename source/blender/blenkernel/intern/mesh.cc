@@ -26,6 +26,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_math_batch.hh"
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
@@ -129,6 +130,8 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
    * Caches will be "un-shared" as necessary later on. */
   mesh_dst->runtime->bounds_cache = mesh_src->runtime->bounds_cache;
   mesh_dst->runtime->loose_edges_cache = mesh_src->runtime->loose_edges_cache;
+  mesh_dst->runtime->vert_to_edge_map_cache = mesh_src->runtime->vert_to_edge_map_cache;
+  mesh_dst->runtime->vert_to_loop_map_cache = mesh_src->runtime->vert_to_loop_map_cache;
   mesh_dst->runtime->looptris_cache = mesh_src->runtime->looptris_cache;
 
   /* Only do tessface if we have no polys. */
@@ -149,7 +152,13 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
   mesh_dst->default_color_attribute = static_cast<char *>(
       MEM_dupallocN(mesh_src->default_color_attribute));
 
-  const eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
+  eCDAllocType alloc_type = CD_DUPLICATE;
+  if (flag & LIB_ID_COPY_CD_REFERENCE) {
+    alloc_type = CD_REFERENCE;
+  }
+  else if (flag & LIB_ID_COPY_CD_SHARE) {
+    alloc_type = CD_SHARE;
+  }
   CustomData_copy(&mesh_src->vdata, &mesh_dst->vdata, mask.vmask, alloc_type, mesh_dst->totvert);
   CustomData_copy(&mesh_src->edata, &mesh_dst->edata, mask.emask, alloc_type, mesh_dst->totedge);
   CustomData_copy(&mesh_src->ldata, &mesh_dst->ldata, mask.lmask, alloc_type, mesh_dst->totloop);
@@ -1475,6 +1484,7 @@ void BKE_mesh_smooth_flag_set(Mesh *me, const bool use_smooth)
       poly.flag &= ~ME_SMOOTH;
     }
   }
+  BKE_mesh_tag_sharpness_changed(me);
 }
 
 void BKE_mesh_auto_smooth_flag_set(Mesh *me,
@@ -1488,6 +1498,7 @@ void BKE_mesh_auto_smooth_flag_set(Mesh *me,
   else {
     me->flag &= ~ME_AUTOSMOOTH;
   }
+  BKE_mesh_tag_sharpness_changed(me);
 }
 
 int poly_find_loop_from_vert(const MPoly *poly, const MLoop *loopstart, int vert)
@@ -1575,45 +1586,49 @@ bool BKE_mesh_minmax(const Mesh *me, float r_min[3], float r_max[3])
 
 void BKE_mesh_transform(Mesh *me, const float mat[4][4], bool do_keys)
 {
+  using namespace blender;
   MutableSpan<MVert> verts = me->verts_for_write();
-
-  for (MVert &vert : verts) {
-    mul_m4_v3(mat, vert.co);
-  }
+  threading::parallel_for(verts.index_range(), 2048, [&](const IndexRange range) {
+    for (MVert &vert : verts.slice(range)) {
+      mul_m4_v3(mat, vert.co);
+    }
+  });
 
   if (do_keys && me->key) {
     LISTBASE_FOREACH (KeyBlock *, kb, &me->key->block) {
-      float *fp = (float *)kb->data;
-      for (int i = kb->totelem; i--; fp += 3) {
-        mul_m4_v3(mat, fp);
-      }
+      math::transform_points(float4x4(mat), {static_cast<float3 *>(kb->data), kb->totelem});
     }
   }
 
   /* don't update normals, caller can do this explicitly.
    * We do update loop normals though, those may not be auto-generated
    * (see e.g. STL import script)! */
-  float(*lnors)[3] = (float(*)[3])CustomData_duplicate_referenced_layer(
-      &me->ldata, CD_NORMAL, me->totloop);
+  float3 *lnors = static_cast<float3 *>(
+      CustomData_duplicate_referenced_layer(&me->ldata, CD_NORMAL, me->totloop));
   if (lnors) {
-    float m3[3][3];
-
-    copy_m3_m4(m3, mat);
-    normalize_m3(m3);
-    for (int i = 0; i < me->totloop; i++, lnors++) {
-      mul_m3_v3(m3, *lnors);
-    }
+    float3x3 m3;
+    copy_m3_m4(m3.values, mat);
+    normalize_m3(m3.values);
+    math::transform_directions(m3, {lnors, me->totloop});
   }
   BKE_mesh_tag_coords_changed(me);
 }
 
 void BKE_mesh_translate(Mesh *me, const float offset[3], const bool do_keys)
 {
-  MutableSpan<MVert> verts = me->verts_for_write();
-  for (MVert &vert : verts) {
-    add_v3_v3(vert.co, offset);
+  using namespace blender;
+  std::optional<Bounds<float3>> bounds;
+  if (me->runtime->bounds_cache.is_cached()) {
+    bounds = me->runtime->bounds_cache.data();
   }
 
+  MutableSpan<MVert> verts = me->verts_for_write();
+  threading::parallel_for(verts.index_range(), 2048, [&](const IndexRange range) {
+    for (MVert &vert : verts.slice(range)) {
+      add_v3_v3(vert.co, offset);
+    }
+  });
+
   int i;
   if (do_keys && me->key) {
     LISTBASE_FOREACH (KeyBlock *, kb, &me->key->block) {
@@ -1624,6 +1639,13 @@ void BKE_mesh_translate(Mesh *me, const float offset[3], const bool do_keys)
     }
   }
   BKE_mesh_tag_coords_changed_uniformly(me);
+
+  if (bounds) {
+    /* Translating the bounds is much cheaper than recomputing them. */
+    bounds->min += float3(offset);
+    bounds->max += float3(offset);
+    me->runtime->bounds_cache.set(*bounds);
+  }
 }
 
 void BKE_mesh_tessface_clear(Mesh *mesh)
@@ -1818,9 +1840,9 @@ static float (*ensure_corner_normal_layer(Mesh &mesh))[3]
   return r_loop_normals;
 }
 
-void BKE_mesh_calc_normals_split_ex(Mesh *mesh,
-                                    MLoopNorSpaceArray *r_lnors_spacearr,
-                                    float (*r_corner_normals)[3])
+static void calc_corner_normals(const Mesh *mesh,
+                                MLoopNorSpaceArray *r_lnors_spacearr,
+                                float (*r_corner_normals)[3])
 {
   short(*clnors)[2] = nullptr;
 
@@ -1857,9 +1879,29 @@ void BKE_mesh_calc_normals_split_ex(Mesh *mesh,
                               clnors);
 }
 
+void BKE_mesh_calc_normals_split_ex(Mesh *mesh,
+                                    MLoopNorSpaceArray *r_lnors_spacearr,
+                                    float (*r_corner_normals)[3])
+{
+  calc_corner_normals(mesh, r_lnors_spacearr, r_corner_normals);
+}
+
+const float (*BKE_mesh_corner_normals_ensure(const Mesh *mesh))[3]
+{
+  mesh->runtime->corner_normals_cache.ensure([&](blender::Array<blender::float3> &r_data) {
+    r_data.reinitialize(mesh->totloop);
+    calc_corner_normals(mesh, nullptr, reinterpret_cast<float(*)[3]>(r_data.data()));
+  });
+  return reinterpret_cast<const float(*)[3]>(mesh->runtime->corner_normals_cache.data().data());
+}
+
 void BKE_mesh_calc_normals_split(Mesh *mesh)
 {
-  BKE_mesh_calc_normals_split_ex(mesh, nullptr, ensure_corner_normal_layer(*mesh));
+  const float(*corner_normals)[3] = BKE_mesh_corner_normals_ensure(mesh);
+  float(*r_loop_normals)[3] = ensure_corner_normal_layer(*mesh);
+  if (mesh->totloop > 0) {
+    memcpy(r_loop_normals, corner_normals, sizeof(float[3]) * mesh->totloop);
+  }
 }
 
 /* **** Depsgraph evaluation **** */
@@ -1876,6 +1918,11 @@ void BKE_mesh_eval_geometry(Depsgraph *depsgraph, Mesh *mesh)
     BKE_id_free(nullptr, mesh->runtime->mesh_eval);
     mesh->runtime->mesh_eval = nullptr;
   }
+  if (mesh->runtime->mesh_eval_loop_normals != nullptr) {
+    mesh->runtime->mesh_eval_loop_normals->edit_mesh = nullptr;
+    BKE_id_free(nullptr, mesh->runtime->mesh_eval_loop_normals);
+    mesh->runtime->mesh_eval_loop_normals = nullptr;
+  }
   if (DEG_is_active(depsgraph)) {
     Mesh *mesh_orig = (Mesh *)DEG_get_original_id(&mesh->id);
     if (mesh->texflag & ME_AUTOSPACE_EVALUATED) {
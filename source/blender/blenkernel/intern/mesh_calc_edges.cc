@@ -64,7 +64,46 @@ union OrigEdgeOrIndex {
   const MEdge *original_edge;
   int index;
 };
-using EdgeMap = Map<OrderedEdge, OrigEdgeOrIndex>;
+
+/**
+ * Vertex indices are never negative, so negative values can mark empty and removed slots. This
+ * way the map doesn't need a separate state per slot, which makes the slots smaller and lets more
+ * of them share a cache line during probing.
+ */
+struct OrderedEdgeKeyInfo {
+  static OrderedEdge get_empty()
+  {
+    return OrderedEdge(-1, -1);
+  }
+
+  static void remove(OrderedEdge &key)
+  {
+    key = OrderedEdge(-2, -2);
+  }
+
+  static bool is_empty(const OrderedEdge &key)
+  {
+    return key.v_low == -1;
+  }
+
+  static bool is_removed(const OrderedEdge &key)
+  {
+    return key.v_low == -2;
+  }
+
+  static bool is_not_empty_or_removed(const OrderedEdge &key)
+  {
+    return key.v_low >= 0;
+  }
+};
+
+using EdgeMap = Map<OrderedEdge,
+                    OrigEdgeOrIndex,
+                    0,
+                    DefaultProbingStrategy,
+                    DefaultHash<OrderedEdge>,
+                    DefaultEquality<OrderedEdge>,
+                    IntrusiveMapSlot<OrderedEdge, OrigEdgeOrIndex, OrderedEdgeKeyInfo>>;
 
 static void reserve_hash_maps(const Mesh *mesh,
                               const bool keep_existing_edges,
@@ -243,6 +282,7 @@ void BKE_mesh_calc_edges(Mesh *mesh, bool keep_existing_edges, const bool select
   CustomData_reset(&mesh->edata);
   CustomData_add_layer(&mesh->edata, CD_MEDGE, CD_ASSIGN, new_edges.data(), new_totedge);
   mesh->totedge = new_totedge;
+  mesh->runtime->vert_to_edge_map_cache.tag_dirty();
 
   if (select_new_edges) {
     MutableAttributeAccessor attributes = mesh->attributes_for_write();
@@ -16,6 +16,7 @@
 #include "BLI_bitmap.h"
 #include "BLI_buffer.h"
 #include "BLI_math.h"
+#include "BLI_sort.hh"
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
@@ -181,6 +182,37 @@ void BKE_mesh_uv_vert_map_free(UvVertMap *vmap)
   }
 }
 
+/**
+ * Create the #MeshElemMap array for indices grouped with #blender::group_indices_by_key.
+ */
+static MeshElemMap *elem_map_from_offsets(const blender::Span<int> offsets, int *indices)
+{
+  using namespace blender;
+  const int64_t groups_num = offsets.size() - 1;
+  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(groups_num), __func__);
+  threading::parallel_for(IndexRange(groups_num), 4096, [&](const IndexRange range) {
+    for (const int64_t group : range) {
+      map[group].indices = indices + offsets[group];
+      map[group].count = offsets[group + 1] - offsets[group];
+    }
+  });
+  return map;
+}
+
+/**
+ * Divide all indices by a constant factor after grouping several entries per element, e.g. the
+ * three corners of every triangle.
+ */
+static void indices_divide(blender::MutableSpan<int> indices, const int factor)
+{
+  using namespace blender;
+  threading::parallel_for(indices.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      indices[i] /= factor;
+    }
+  });
+}
+
 /**
  * Generates a map where the key is the vertex and the value is a list
  * of polys or loops that use that vertex as a corner. The lists are allocated
@@ -197,44 +229,27 @@ static void mesh_vert_poly_or_loop_map_create(MeshElemMap **r_map,
                                               int totloop,
                                               const bool do_loops)
 {
-  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(totvert), __func__);
-  int *indices, *index_iter;
-  int i, j;
-
-  indices = static_cast<int *>(MEM_mallocN(sizeof(int) * size_t(totloop), __func__));
-  index_iter = indices;
-
-  /* Count number of polys for each vertex */
-  for (i = 0; i < totpoly; i++) {
-    const MPoly *p = &mpoly[i];
-
-    for (j = 0; j < p->totloop; j++) {
-      map[mloop[p->loopstart + j].v].count++;
-    }
-  }
-
-  /* Assign indices mem */
-  for (i = 0; i < totvert; i++) {
-    map[i].indices = index_iter;
-    index_iter += map[i].count;
-
-    /* Reset 'count' for use as index in last loop */
-    map[i].count = 0;
-  }
-
-  /* Find the users */
-  for (i = 0; i < totpoly; i++) {
-    const MPoly *p = &mpoly[i];
-
-    for (j = 0; j < p->totloop; j++) {
-      uint v = mloop[p->loopstart + j].v;
-
-      map[v].indices[map[v].count] = do_loops ? p->loopstart + j : i;
-      map[v].count++;
-    }
+  using namespace blender;
+  int *indices = static_cast<int *>(MEM_mallocN(sizeof(int) * size_t(totloop), __func__));
+  MutableSpan<int> indices_span(indices, totloop);
+
+  /* Group the corners by their vertex with a counting sort. The corners of every vertex are sorted
+   * by index, which is also the order of their faces. */
+  Array<int> offsets(totvert + 1);
+  group_indices_by_key(
+      totloop, [&](const int64_t i) { return int(mloop[i].v); }, offsets, indices_span);
+
+  if (!do_loops) {
+    const Array<int> loop_to_poly = bke::mesh_topology::build_loop_to_poly_map(
+        Span<MPoly>(mpoly, totpoly), totloop);
+    threading::parallel_for(indices_span.index_range(), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        indices_span[i] = loop_to_poly[indices_span[i]];
+      }
+    });
   }
 
-  *r_map = map;
+  *r_map = elem_map_from_offsets(offsets, indices);
   *r_mem = indices;
 }
 
@@ -269,116 +284,78 @@ void BKE_mesh_vert_looptri_map_create(MeshElemMap **r_map,
                                       const MLoop *mloop,
                                       const int /*totloop*/)
 {
-  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(totvert), __func__);
+  using namespace blender;
   int *indices = static_cast<int *>(MEM_mallocN(sizeof(int) * size_t(totlooptri) * 3, __func__));
-  int *index_step;
-  const MLoopTri *mlt;
-  int i;
-
-  /* count face users */
-  for (i = 0, mlt = mlooptri; i < totlooptri; mlt++, i++) {
-    for (int j = 3; j--;) {
-      map[mloop[mlt->tri[j]].v].count++;
-    }
-  }
-
-  /* create offsets */
-  index_step = indices;
-  for (i = 0; i < totvert; i++) {
-    map[i].indices = index_step;
-    index_step += map[i].count;
-
-    /* re-count, using this as an index below */
-    map[i].count = 0;
-  }
-
-  /* assign looptri-edge users */
-  for (i = 0, mlt = mlooptri; i < totlooptri; mlt++, i++) {
-    for (int j = 3; j--;) {
-      MeshElemMap *map_ele = &map[mloop[mlt->tri[j]].v];
-      map_ele->indices[map_ele->count++] = i;
-    }
-  }
-
-  *r_map = map;
+  MutableSpan<int> indices_span(indices, int64_t(totlooptri) * 3);
+
+  /* Group the three corners of every triangle by their vertex. */
+  Array<int> offsets(totvert + 1);
+  group_indices_by_key(
+      indices_span.size(),
+      [&](const int64_t i) { return int(mloop[mlooptri[i / 3].tri[i % 3]].v); },
+      offsets,
+      indices_span);
+  indices_divide(indices_span, 3);
+
+  *r_map = elem_map_from_offsets(offsets, indices);
   *r_mem = indices;
 }
 
+/**
+ * Group the two vertices of every edge, the result contains `2 * edge_index + vert_index` for
+ * every vertex of an edge.
+ */
+static void vert_edge_map_group(const MEdge *medge,
+                                const int totvert,
+                                const int totedge,
+                                blender::MutableSpan<int> r_offsets,
+                                blender::MutableSpan<int> r_indices)
+{
+  BLI_assert(r_offsets.size() == totvert + 1);
+  UNUSED_VARS_NDEBUG(totvert);
+  blender::group_indices_by_key(
+      int64_t(totedge) * 2,
+      [&](const int64_t i) {
+        const MEdge &edge = medge[i / 2];
+        return int(i % 2 == 0 ? edge.v1 : edge.v2);
+      },
+      r_offsets,
+      r_indices);
+}
+
 void BKE_mesh_vert_edge_map_create(
     MeshElemMap **r_map, int **r_mem, const MEdge *medge, int totvert, int totedge)
 {
-  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(totvert), __func__);
+  using namespace blender;
   int *indices = static_cast<int *>(MEM_mallocN(sizeof(int[2]) * size_t(totedge), __func__));
-  int *i_pt = indices;
-
-  int i;
+  MutableSpan<int> indices_span(indices, int64_t(totedge) * 2);
 
-  /* Count number of edges for each vertex */
-  for (i = 0; i < totedge; i++) {
-    map[medge[i].v1].count++;
-    map[medge[i].v2].count++;
-  }
-
-  /* Assign indices mem */
-  for (i = 0; i < totvert; i++) {
-    map[i].indices = i_pt;
-    i_pt += map[i].count;
-
-    /* Reset 'count' for use as index in last loop */
-    map[i].count = 0;
-  }
-
-  /* Find the users */
-  for (i = 0; i < totedge; i++) {
-    const uint v[2] = {medge[i].v1, medge[i].v2};
+  Array<int> offsets(totvert + 1);
+  vert_edge_map_group(medge, totvert, totedge, offsets, indices_span);
+  indices_divide(indices_span, 2);
 
-    map[v[0]].indices[map[v[0]].count] = i;
-    map[v[1]].indices[map[v[1]].count] = i;
-
-    map[v[0]].count++;
-    map[v[1]].count++;
-  }
-
-  *r_map = map;
+  *r_map = elem_map_from_offsets(offsets, indices);
   *r_mem = indices;
 }
 
 void BKE_mesh_vert_edge_vert_map_create(
     MeshElemMap **r_map, int **r_mem, const MEdge *medge, int totvert, int totedge)
 {
-  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(totvert), __func__);
+  using namespace blender;
   int *indices = static_cast<int *>(MEM_mallocN(sizeof(int[2]) * size_t(totedge), __func__));
-  int *i_pt = indices;
-
-  int i;
-
-  /* Count number of edges for each vertex */
-  for (i = 0; i < totedge; i++) {
-    map[medge[i].v1].count++;
-    map[medge[i].v2].count++;
-  }
-
-  /* Assign indices mem */
-  for (i = 0; i < totvert; i++) {
-    map[i].indices = i_pt;
-    i_pt += map[i].count;
-
-    /* Reset 'count' for use as index in last loop */
-    map[i].count = 0;
-  }
-
-  /* Find the users */
-  for (i = 0; i < totedge; i++) {
-    const uint v[2] = {medge[i].v1, medge[i].v2};
-
-    map[v[0]].indices[map[v[0]].count] = int(v[1]);
-    map[v[1]].indices[map[v[1]].count] = int(v[0]);
-
-    map[v[0]].count++;
-    map[v[1]].count++;
-  }
+  MutableSpan<int> indices_span(indices, int64_t(totedge) * 2);
+
+  Array<int> offsets(totvert + 1);
+  vert_edge_map_group(medge, totvert, totedge, offsets, indices_span);
+  /* Replace every edge with its other vertex. */
+  threading::parallel_for(indices_span.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const MEdge &edge = medge[indices_span[i] / 2];
+      indices_span[i] = int(indices_span[i] % 2 == 0 ? edge.v2 : edge.v1);
+    }
+  });
 
-  *r_map = map;
+  *r_map = elem_map_from_offsets(offsets, indices);
   *r_mem = indices;
 }
 
@@ -444,42 +421,24 @@ void BKE_mesh_edge_poly_map_create(MeshElemMap **r_map,
                                    const MLoop *mloop,
                                    const int totloop)
 {
-  MeshElemMap *map = MEM_cnew_array<MeshElemMap>(size_t(totedge), __func__);
+  using namespace blender;
   int *indices = static_cast<int *>(MEM_mallocN(sizeof(int) * size_t(totloop), __func__));
-  int *index_step;
-  const MPoly *mp;
-  int i;
-
-  /* count face users */
-  for (i = 0, mp = mpoly; i < totpoly; mp++, i++) {
-    const MLoop *ml;
-    int j = mp->totloop;
-    for (ml = &mloop[mp->loopstart]; j--; ml++) {
-      map[ml->e].count++;
-    }
-  }
-
-  /* create offsets */
-  index_step = indices;
-  for (i = 0; i < totedge; i++) {
-    map[i].indices = index_step;
-    index_step += map[i].count;
-
-    /* re-count, using this as an index below */
-    map[i].count = 0;
-  }
-
-  /* assign poly-edge users */
-  for (i = 0, mp = mpoly; i < totpoly; mp++, i++) {
-    const MLoop *ml;
-    int j = mp->totloop;
-    for (ml = &mloop[mp->loopstart]; j--; ml++) {
-      MeshElemMap *map_ele = &map[ml->e];
-      map_ele->indices[map_ele->count++] = i;
+  MutableSpan<int> indices_span(indices, totloop);
+
+  /* Group the corners by their edge, sorting by corner index also sorts by face index. */
+  Array<int> offsets(totedge + 1);
+  group_indices_by_key(
+      totloop, [&](const int64_t i) { return int(mloop[i].e); }, offsets, indices_span);
+
+  const Array<int> loop_to_poly = bke::mesh_topology::build_loop_to_poly_map(
+      Span<MPoly>(mpoly, totpoly), totloop);
+  threading::parallel_for(indices_span.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      indices_span[i] = loop_to_poly[indices_span[i]];
     }
-  }
+  });
 
-  *r_map = map;
+  *r_map = elem_map_from_offsets(offsets, indices);
   *r_mem = indices;
 }
 
@@ -23,12 +23,14 @@
 #include "BLI_math.h"
 #include "BLI_math_vec_types.hh"
 #include "BLI_memarena.h"
+#include "BLI_sort.hh"
 #include "BLI_span.hh"
 #include "BLI_stack.h"
 #include "BLI_task.h"
 #include "BLI_task.hh"
 #include "BLI_timeit.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_editmesh_cache.h"
@@ -44,6 +46,7 @@ using blender::int2;
 using blender::MutableSpan;
 using blender::short2;
 using blender::Span;
+using blender::Vector;
 
 // #define DEBUG_TIME
 
@@ -101,6 +104,7 @@ void BKE_mesh_normals_tag_dirty(Mesh *mesh)
 {
   mesh->runtime->vert_normals_dirty = true;
   mesh->runtime->poly_normals_dirty = true;
+  mesh->runtime->corner_normals_cache.tag_dirty();
 }
 
 float (*BKE_mesh_vertex_normals_for_write(Mesh *mesh))[3]
@@ -790,11 +794,12 @@ void BKE_lnor_space_custom_normal_to_data(const MLoopNorSpace *lnor_space,
   }
 }
 
-#define LOOP_SPLIT_TASK_BLOCK_SIZE 1024
+/** Number of fans processed by a task, most fans only have a few loops. */
+#define LOOP_SPLIT_TASK_GRAIN_SIZE 256
 
 struct LoopSplitTaskData {
   enum class Type : int8_t {
-    BlockEnd = 0, /* Set implicitly by calloc. */
+    None = 0,
     Fan = 1,
     Single = 2,
   };
@@ -1261,29 +1266,6 @@ static void loop_split_worker_do(LoopSplitTaskDataCommon *common_data,
   }
 }
 
-static void loop_split_worker(TaskPool *__restrict pool, void *taskdata)
-{
-  LoopSplitTaskDataCommon *common_data = (LoopSplitTaskDataCommon *)BLI_task_pool_user_data(pool);
-  LoopSplitTaskData *data = (LoopSplitTaskData *)taskdata;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr. */
-  BLI_Stack *edge_vectors = common_data->lnors_spacearr ?
-                                BLI_stack_new(sizeof(float[3]), __func__) :
-                                nullptr;
-
-  for (int i = 0; i < LOOP_SPLIT_TASK_BLOCK_SIZE; i++, data++) {
-    if (data->flag == LoopSplitTaskData::Type::BlockEnd) {
-      break;
-    }
-
-    loop_split_worker_do(common_data, data, edge_vectors);
-  }
-
-  if (edge_vectors) {
-    BLI_stack_free(edge_vectors);
-  }
-}
-
 /**
  * Check whether given loop is part of an unknown-so-far cyclic smooth fan, or not.
  * Needed because cyclic smooth fans have no obvious 'entry point',
@@ -1294,7 +1276,7 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const Span<MLoop> mloop
                                                          const Span<int2> edge_to_loops,
                                                          const Span<int> loop_to_poly,
                                                          const int *e2l_prev,
-                                                         BitVector<> &skip_loops,
+                                                         MutableSpan<bool> skip_loops,
                                                          const int ml_curr_index,
                                                          const int ml_prev_index,
                                                          const int mp_curr_index)
@@ -1318,7 +1300,7 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const Span<MLoop> mloop
   BLI_assert(mpfan_curr_index >= 0);
 
   BLI_assert(!skip_loops[mlfan_vert_index]);
-  skip_loops[mlfan_vert_index].set();
+  skip_loops[mlfan_vert_index] = true;
 
   while (true) {
     /* Find next loop of the smooth fan. */
@@ -1349,11 +1331,20 @@ static bool loop_split_generator_check_cyclic_smooth_fan(const Span<MLoop> mloop
     }
 
     /* We can skip it in future, and keep checking the smooth fan. */
-    skip_loops[mlfan_vert_index].set();
+    skip_loops[mlfan_vert_index] = true;
   }
 }
 
-static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common_data)
+/**
+ * Find the loops that are single or that start a smooth fan, which are the loops that have to be
+ * processed to compute all loop normals.
+ *
+ * A fan only contains loops of the same vertex, so the vertices are handled in parallel. The loops
+ * of every vertex are visited in the same order as when iterating over the loops of all polygons,
+ * so that the same loops are chosen as the entry point of cyclic smooth fans. That matters because
+ * the custom normal spaces are defined relative to the edges of the entry loop.
+ */
+static Vector<LoopSplitTaskData> loop_split_generator(LoopSplitTaskDataCommon *common_data)
 {
   using namespace blender;
   using namespace blender::bke;
@@ -1364,131 +1355,100 @@ static void loop_split_generator(TaskPool *pool, LoopSplitTaskDataCommon *common
   const Span<int> loop_to_poly = common_data->loop_to_poly;
   const Span<int2> edge_to_loops = common_data->edge_to_loops;
 
-  BitVector<> skip_loops(loops.size(), false);
-
-  LoopSplitTaskData *data_buff = nullptr;
-  int data_idx = 0;
-
-  /* Temp edge vectors stack, only used when computing lnor spacearr
-   * (and we are not multi-threading). */
-  BLI_Stack *edge_vectors = nullptr;
-
 #ifdef DEBUG_TIME
   SCOPED_TIMER_AVERAGED(__func__);
 #endif
 
-  if (!pool) {
-    if (lnors_spacearr) {
-      edge_vectors = BLI_stack_new(sizeof(float[3]), __func__);
-    }
-  }
-
-  /* We now know edges that can be smoothed (with their vector, and their two loops),
-   * and edges that will be hard! Now, time to generate the normals.
-   */
-  for (const int mp_index : polys.index_range()) {
-    const MPoly &poly = polys[mp_index];
-
-    for (const int ml_curr_index : IndexRange(poly.loopstart, poly.totloop)) {
-      const int ml_prev_index = mesh_topology::poly_loop_prev(poly, ml_curr_index);
-
-#if 0
-      printf("Checking loop %d / edge %u / vert %u (sharp edge: %d, skiploop: %d)",
-             ml_curr_index,
-             loops[ml_curr_index].e,
-             loops[ml_curr_index].v,
-             IS_EDGE_SHARP(edge_to_loops[loops[ml_curr_index].e]),
-             skip_loops[ml_curr_index]);
-#endif
-
-      /* A smooth edge, we have to check for cyclic smooth fan case.
-       * If we find a new, never-processed cyclic smooth fan, we can do it now using that loop/edge
-       * as 'entry point', otherwise we can skip it. */
-
-      /* NOTE: In theory, we could make #loop_split_generator_check_cyclic_smooth_fan() store
-       * mlfan_vert_index'es and edge indexes in two stacks, to avoid having to fan again around
-       * the vert during actual computation of `clnor` & `clnorspace`.
-       * However, this would complicate the code, add more memory usage, and despite its logical
-       * complexity, #loop_manifold_fan_around_vert_next() is quite cheap in term of CPU cycles,
-       * so really think it's not worth it. */
-      if (!IS_EDGE_SHARP(edge_to_loops[loops[ml_curr_index].e]) &&
-          (skip_loops[ml_curr_index] ||
-           !loop_split_generator_check_cyclic_smooth_fan(loops,
-                                                         polys,
-                                                         edge_to_loops,
-                                                         loop_to_poly,
-                                                         edge_to_loops[loops[ml_prev_index].e],
-                                                         skip_loops,
-                                                         ml_curr_index,
-                                                         ml_prev_index,
-                                                         mp_index))) {
-        // printf("SKIPPING!\n");
-      }
-      else {
-        LoopSplitTaskData *data, data_local;
-
-        // printf("PROCESSING!\n");
-
-        if (pool) {
-          if (data_idx == 0) {
-            data_buff = (LoopSplitTaskData *)MEM_calloc_arrayN(
-                LOOP_SPLIT_TASK_BLOCK_SIZE, sizeof(*data_buff), __func__);
-          }
-          data = &data_buff[data_idx];
-        }
-        else {
-          data = &data_local;
-          memset(data, 0, sizeof(*data));
-        }
+  Array<int> vert_to_loop_offsets(common_data->verts.size() + 1);
+  Array<int> vert_to_loop_indices(loops.size());
+  group_indices_by_key(
+      loops.size(),
+      [&](const int64_t loop_i) { return int(loops[loop_i].v); },
+      vert_to_loop_offsets,
+      vert_to_loop_indices);
+
+  /* Only written for loops of the vertex that is processed, so a bit vector can't be used. */
+  Array<bool> skip_loops(loops.size(), false);
+  Array<LoopSplitTaskData::Type> loop_types(loops.size(), LoopSplitTaskData::Type::None);
+
+  threading::parallel_for(
+      IndexRange(common_data->verts.size()), 1024, [&](const IndexRange range) {
+        for (const int vert_i : range) {
+          MutableSpan<int> vert_loops = vert_to_loop_indices.as_mutable_span().slice(
+              vert_to_loop_offsets[vert_i],
+              vert_to_loop_offsets[vert_i + 1] - vert_to_loop_offsets[vert_i]);
+          std::sort(vert_loops.begin(), vert_loops.end(), [&](const int a, const int b) {
+            return loop_to_poly[a] < loop_to_poly[b] ||
+                   (loop_to_poly[a] == loop_to_poly[b] && a < b);
+          });
+
+          for (const int ml_curr_index : vert_loops) {
+            const int mp_index = loop_to_poly[ml_curr_index];
+            const MPoly &poly = polys[mp_index];
+            const int ml_prev_index = mesh_topology::poly_loop_prev(poly, ml_curr_index);
+
+            /* A smooth edge, we have to check for cyclic smooth fan case.
+             * If we find a new, never-processed cyclic smooth fan, we can do it now using that
+             * loop/edge as 'entry point', otherwise we can skip it. */
+
+            /* NOTE: In theory, we could make #loop_split_generator_check_cyclic_smooth_fan()
+             * store mlfan_vert_index'es and edge indexes in two stacks, to avoid having to fan
+             * again around the vert during actual computation of `clnor` & `clnorspace`.
+             * However, this would complicate the code, add more memory usage, and despite its
+             * logical complexity, #loop_manifold_fan_around_vert_next() is quite cheap in term of
+             * CPU cycles, so really think it's not worth it. */
+            if (!IS_EDGE_SHARP(edge_to_loops[loops[ml_curr_index].e]) &&
+                (skip_loops[ml_curr_index] ||
+                 !loop_split_generator_check_cyclic_smooth_fan(
+                     loops,
+                     polys,
+                     edge_to_loops,
+                     loop_to_poly,
+                     edge_to_loops[loops[ml_prev_index].e],
+                     skip_loops,
+                     ml_curr_index,
+                     ml_prev_index,
+                     mp_index))) {
+              continue;
+            }
 
-        if (IS_EDGE_SHARP(edge_to_loops[loops[ml_curr_index].e]) &&
-            IS_EDGE_SHARP(edge_to_loops[loops[ml_prev_index].e])) {
-          data->ml_curr_index = ml_curr_index;
-          data->ml_prev_index = ml_prev_index;
-          data->flag = LoopSplitTaskData::Type::Single;
-          data->mp_index = mp_index;
-          if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
-          }
-        }
-        else {
-          /* We do not need to check/tag loops as already computed. Due to the fact that a loop
-           * only points to one of its two edges, the same fan will never be walked more than once.
-           * Since we consider edges that have neighbor polys with inverted (flipped) normals as
-           * sharp, we are sure that no fan will be skipped, even only considering the case (sharp
-           * current edge, smooth previous edge), and not the alternative (smooth current edge,
-           * sharp previous edge). All this due/thanks to the link between normals and loop
-           * ordering (i.e. winding). */
-          data->ml_curr_index = ml_curr_index;
-          data->ml_prev_index = ml_prev_index;
-          data->flag = LoopSplitTaskData::Type::Fan;
-          data->mp_index = mp_index;
-          if (lnors_spacearr) {
-            data->lnor_space = BKE_lnor_space_create(lnors_spacearr);
+            if (IS_EDGE_SHARP(edge_to_loops[loops[ml_curr_index].e]) &&
+                IS_EDGE_SHARP(edge_to_loops[loops[ml_prev_index].e])) {
+              loop_types[ml_curr_index] = LoopSplitTaskData::Type::Single;
+            }
+            else {
+              /* We do not need to check/tag loops as already computed. Due to the fact that a
+               * loop only points to one of its two edges, the same fan will never be walked more
+               * than once. Since we consider edges that have neighbor polys with inverted
+               * (flipped) normals as sharp, we are sure that no fan will be skipped, even only
+               * considering the case (sharp current edge, smooth previous edge), and not the
+               * alternative (smooth current edge, sharp previous edge). All this due/thanks to
+               * the link between normals and loop ordering (i.e. winding). */
+              loop_types[ml_curr_index] = LoopSplitTaskData::Type::Fan;
+            }
           }
         }
+      });
 
-        if (pool) {
-          data_idx++;
-          if (data_idx == LOOP_SPLIT_TASK_BLOCK_SIZE) {
-            BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-            data_idx = 0;
-          }
-        }
-        else {
-          loop_split_worker_do(common_data, data, edge_vectors);
-        }
+  /* The spaces have to be created outside of the tasks, since #MemArena is not thread-safe. Keep
+   * the order of the polygons, for a deterministic order of the spaces. */
+  Vector<LoopSplitTaskData> tasks;
+  for (const int mp_index : polys.index_range()) {
+    const MPoly &poly = polys[mp_index];
+    for (const int ml_curr_index : IndexRange(poly.loopstart, poly.totloop)) {
+      if (loop_types[ml_curr_index] == LoopSplitTaskData::Type::None) {
+        continue;
       }
+      LoopSplitTaskData data;
+      data.lnor_space = lnors_spacearr ? BKE_lnor_space_create(lnors_spacearr) : nullptr;
+      data.ml_curr_index = ml_curr_index;
+      data.ml_prev_index = mesh_topology::poly_loop_prev(poly, ml_curr_index);
+      data.mp_index = mp_index;
+      data.flag = loop_types[ml_curr_index];
+      tasks.append(data);
     }
   }
-
-  if (pool && data_idx) {
-    BLI_task_pool_push(pool, loop_split_worker, data_buff, true, nullptr);
-  }
-
-  if (edge_vectors) {
-    BLI_stack_free(edge_vectors);
-  }
+  return tasks;
 }
 
 void BKE_mesh_normals_loop_split(const MVert *mverts,
@@ -1624,19 +1584,20 @@ void BKE_mesh_normals_loop_split(const MVert *mverts,
                        edge_to_loops,
                        nullptr);
 
-  if (numLoops < LOOP_SPLIT_TASK_BLOCK_SIZE * 8) {
-    /* Not enough loops to be worth the whole threading overhead. */
-    loop_split_generator(nullptr, &common_data);
-  }
-  else {
-    TaskPool *task_pool = BLI_task_pool_create(&common_data, TASK_PRIORITY_HIGH);
-
-    loop_split_generator(task_pool, &common_data);
+  Vector<LoopSplitTaskData> tasks = loop_split_generator(&common_data);
 
-    BLI_task_pool_work_and_wait(task_pool);
-
-    BLI_task_pool_free(task_pool);
-  }
+  /* Two different fans never affect the same loops, so they can be processed in parallel. */
+  threading::parallel_for(tasks.index_range(), LOOP_SPLIT_TASK_GRAIN_SIZE, [&](IndexRange range) {
+    /* Temp edge vectors stack, only used when computing lnor spacearr. */
+    BLI_Stack *edge_vectors = r_lnors_spacearr ? BLI_stack_new(sizeof(float[3]), __func__) :
+                                                 nullptr;
+    for (const int i : range) {
+      loop_split_worker_do(&common_data, &tasks[i], edge_vectors);
+    }
+    if (edge_vectors) {
+      BLI_stack_free(edge_vectors);
+    }
+  });
 
   if (r_lnors_spacearr) {
     if (r_lnors_spacearr == &_lnors_spacearr) {
@@ -1985,6 +1946,7 @@ static void mesh_set_custom_normals(Mesh *mesh, float (*r_custom_nors)[3], const
                                polys.size(),
                                clnors,
                                use_vertices);
+  BKE_mesh_tag_sharpness_changed(mesh);
 }
 
 void BKE_mesh_set_custom_normals(Mesh *mesh, float (*r_custom_loop_normals)[3])
@@ -14,6 +14,7 @@
 #include "DNA_object_types.h"
 
 #include "BLI_math_geom.h"
+#include "BLI_sort.hh"
 #include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
@@ -58,6 +59,11 @@ static void free_mesh_eval(MeshRuntime &mesh_runtime)
     BKE_id_free(nullptr, mesh_runtime.mesh_eval);
     mesh_runtime.mesh_eval = nullptr;
   }
+  if (mesh_runtime.mesh_eval_loop_normals != nullptr) {
+    mesh_runtime.mesh_eval_loop_normals->edit_mesh = nullptr;
+    BKE_id_free(nullptr, mesh_runtime.mesh_eval_loop_normals);
+    mesh_runtime.mesh_eval_loop_normals = nullptr;
+  }
 }
 
 static void free_subdiv_ccg(MeshRuntime &mesh_runtime)
@@ -83,6 +89,7 @@ static void free_normals(MeshRuntime &mesh_runtime)
   MEM_SAFE_FREE(mesh_runtime.poly_normals);
   mesh_runtime.vert_normals_dirty = true;
   mesh_runtime.poly_normals_dirty = true;
+  mesh_runtime.corner_normals_cache.tag_dirty();
 }
 
 static void free_batch_cache(MeshRuntime &mesh_runtime)
@@ -140,6 +147,48 @@ void Mesh::loose_edges_tag_none() const
   });
 }
 
+const blender::bke::VertToElemMap &Mesh::vert_to_edge_map() const
+{
+  using namespace blender::bke;
+  this->runtime->vert_to_edge_map_cache.ensure([&](VertToElemMap &r_data) {
+    const Span<MEdge> edges = this->edges();
+    r_data.offsets.reinitialize(this->totvert + 1);
+    r_data.indices.reinitialize(edges.size() * 2);
+    /* Every edge is added twice, once for each of its vertices. */
+    blender::group_indices_by_key(
+        edges.size() * 2,
+        [&](const int64_t i) {
+          const MEdge &edge = edges[i / 2];
+          return int(i % 2 == 0 ? edge.v1 : edge.v2);
+        },
+        r_data.offsets,
+        r_data.indices);
+    blender::threading::parallel_for(
+        r_data.indices.index_range(), 4096, [&](const blender::IndexRange range) {
+          for (const int64_t i : range) {
+            r_data.indices[i] /= 2;
+          }
+        });
+  });
+  return this->runtime->vert_to_edge_map_cache.data();
+}
+
+const blender::bke::VertToElemMap &Mesh::vert_to_loop_map() const
+{
+  using namespace blender::bke;
+  this->runtime->vert_to_loop_map_cache.ensure([&](VertToElemMap &r_data) {
+    const Span<MLoop> loops = this->loops();
+    r_data.offsets.reinitialize(this->totvert + 1);
+    r_data.indices.reinitialize(loops.size());
+    blender::group_indices_by_key(
+        loops.size(),
+        [&](const int64_t i) { return int(loops[i].v); },
+        r_data.offsets,
+        r_data.indices);
+  });
+  return this->runtime->vert_to_loop_map_cache.data();
+}
+
 blender::Span<MLoopTri> Mesh::looptris() const
 {
   this->runtime->looptris_cache.ensure([&](blender::Array<MLoopTri> &r_data) {
@@ -224,6 +273,8 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
   free_subdiv_ccg(*mesh->runtime);
   mesh->runtime->bounds_cache.tag_dirty();
   mesh->runtime->loose_edges_cache.tag_dirty();
+  mesh->runtime->vert_to_edge_map_cache.tag_dirty();
+  mesh->runtime->vert_to_loop_map_cache.tag_dirty();
   mesh->runtime->looptris_cache.tag_dirty();
   if (mesh->runtime->shrinkwrap_data) {
     BKE_shrinkwrap_boundary_data_free(mesh->runtime->shrinkwrap_data);
@@ -240,6 +291,7 @@ void BKE_mesh_tag_edges_split(struct Mesh *mesh)
   free_normals(*mesh->runtime);
   free_subdiv_ccg(*mesh->runtime);
   mesh->runtime->loose_edges_cache.tag_dirty();
+  mesh->runtime->vert_to_edge_map_cache.tag_dirty();
   if (mesh->runtime->shrinkwrap_data) {
     BKE_shrinkwrap_boundary_data_free(mesh->runtime->shrinkwrap_data);
   }
@@ -249,8 +301,16 @@ void BKE_mesh_tag_edges_split(struct Mesh *mesh)
 void BKE_mesh_tag_coords_changed(Mesh *mesh)
 {
   BKE_mesh_normals_tag_dirty(mesh);
-  free_bvh_cache(*mesh->runtime);
-  mesh->runtime->looptris_cache.tag_dirty();
+  if (mesh->runtime->bvh_cache) {
+    bvhcache_tag_positions_changed(mesh->runtime->bvh_cache);
+  }
+  /* The triangulation of quads and n-gons depends on the positions, but triangles are always
+   * "tessellated" the same way. Every face has at least three corners, so the mesh only has
+   * triangles when there are exactly three times as many corners as faces. Keeping the cache
+   * means it stays shared with the original mesh for deform-only modifier stacks. */
+  if (mesh->totloop != mesh->totpoly * 3) {
+    mesh->runtime->looptris_cache.tag_dirty();
+  }
   mesh->runtime->bounds_cache.tag_dirty();
 }
 
@@ -266,6 +326,11 @@ void BKE_mesh_tag_topology_changed(struct Mesh *mesh)
   BKE_mesh_runtime_clear_geometry(mesh);
 }
 
+void BKE_mesh_tag_sharpness_changed(struct Mesh *mesh)
+{
+  mesh->runtime->corner_normals_cache.tag_dirty();
+}
+
 bool BKE_mesh_is_deformed_only(const Mesh *mesh)
 {
   return mesh->runtime->deformed_only;
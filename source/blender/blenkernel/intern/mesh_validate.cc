@@ -19,10 +19,15 @@
 
 #include "BLI_sys_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_edgehash.h"
+#include "BLI_hash.hh"
 #include "BLI_math_base.h"
 #include "BLI_math_vector.h"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.h"
@@ -33,8 +38,11 @@
 
 #include "MEM_guardedalloc.h"
 
+using blender::Array;
+using blender::IndexRange;
 using blender::MutableSpan;
 using blender::Span;
+using blender::Vector;
 
 /* loop v/e are unsigned, so using max uint_32 value as invalid marker... */
 #define INVALID_LOOP_EDGE_MARKER 4294967295u
@@ -204,6 +212,287 @@ static int search_polyloop_cmp(const void *v1, const void *v2)
     } \
   } while (0)
 
+/* -------------------------------------------------------------------- */
+/** \name Parallel Validation
+ *
+ * Imported and generated meshes are almost always valid, but the detailed validation below is
+ * single threaded and builds an edge hash and sorted copies of all faces, which takes a long time
+ * for large meshes. This pass only detects whether anything is wrong, without reporting or fixing
+ * it, which can be done in parallel with cheaper data structures. The detailed validation only
+ * runs when this finds a problem, in which case its result is the same as before.
+ * \{ */
+
+static void poly_sorted_verts(const MPoly &poly, const MLoop *mloops, Vector<int, 16> &r_verts)
+{
+  r_verts.clear();
+  for (const int i : IndexRange(poly.loopstart, poly.totloop)) {
+    r_verts.append(int(mloops[i].v));
+  }
+  std::sort(r_verts.begin(), r_verts.end());
+}
+
+static bool mesh_arrays_verts_are_valid(const Mesh *mesh, const Span<MVert> verts)
+{
+  const float(*vert_normals)[3] = nullptr;
+  if (!BKE_mesh_vertex_normals_are_dirty(mesh)) {
+    vert_normals = BKE_mesh_vertex_normals_ensure(mesh);
+  }
+  return blender::threading::parallel_reduce(
+      verts.index_range(),
+      4096,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        if (!valid) {
+          return false;
+        }
+        for (const int i : range) {
+          const float *co = verts[i].co;
+          if (!isfinite(co[0]) || !isfinite(co[1]) || !isfinite(co[2])) {
+            return false;
+          }
+          if (vert_normals && is_zero_v3(vert_normals[i]) && !is_zero_v3(co)) {
+            return false;
+          }
+        }
+        return true;
+      },
+      std::logical_and<bool>());
+}
+
+static bool mesh_arrays_edges_are_valid(const Span<MEdge> edges, const uint totvert)
+{
+  Array<uint64_t> edge_keys(edges.size());
+  const bool valid = blender::threading::parallel_reduce(
+      edges.index_range(),
+      4096,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        if (!valid) {
+          return false;
+        }
+        for (const int i : range) {
+          const MEdge &edge = edges[i];
+          if (edge.v1 == edge.v2 || edge.v1 >= totvert || edge.v2 >= totvert) {
+            return false;
+          }
+          edge_keys[i] = (uint64_t(std::min(edge.v1, edge.v2)) << 32) |
+                         uint64_t(std::max(edge.v1, edge.v2));
+        }
+        return true;
+      },
+      std::logical_and<bool>());
+  if (!valid) {
+    return false;
+  }
+
+  /* Duplicate edges are next to each other after sorting. */
+  blender::parallel_radix_sort(edge_keys.as_mutable_span());
+  return blender::threading::parallel_reduce(
+      edges.index_range().drop_front(1),
+      4096,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        return valid && std::all_of(range.begin(), range.end(), [&](const int64_t i) {
+                 return edge_keys[i] != edge_keys[i - 1];
+               });
+      },
+      std::logical_and<bool>());
+}
+
+static bool mesh_arrays_polys_are_valid(const Mesh *mesh,
+                                        const Span<MEdge> edges,
+                                        const Span<MLoop> loops,
+                                        const Span<MPoly> polys,
+                                        const uint totvert)
+{
+  const blender::bke::AttributeAccessor attributes = mesh->attributes();
+  const blender::VArraySpan<int> material_indices = attributes.lookup_or_default<int>(
+      "material_index", ATTR_DOMAIN_FACE, 0);
+
+  /* Hash of the sorted vertices of every face, used to find faces with the same vertices. */
+  Array<std::pair<uint64_t, int>> poly_keys(polys.size());
+  const bool valid = blender::threading::parallel_reduce(
+      polys.index_range(),
+      1024,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        if (!valid) {
+          return false;
+        }
+        Vector<int, 16> sorted_verts;
+        for (const int i : range) {
+          const MPoly &poly = polys[i];
+          if (material_indices[i] < 0 || poly.totloop < 3) {
+            return false;
+          }
+          /* Faces have to use consecutive ranges of corners in order, so that every corner is
+           * used by exactly one face. Faces stored in a different order are still valid, but
+           * rare enough to leave them to the detailed validation. */
+          const int expected_loopstart = i == 0 ? 0 : polys[i - 1].loopstart +
+                                                          polys[i - 1].totloop;
+          if (poly.loopstart != expected_loopstart) {
+            return false;
+          }
+          if (i == polys.size() - 1 && poly.loopstart + poly.totloop != loops.size()) {
+            return false;
+          }
+          for (const int corner : IndexRange(poly.totloop)) {
+            const MLoop &loop = loops[poly.loopstart + corner];
+            const MLoop &loop_next = loops[poly.loopstart + (corner + 1) % poly.totloop];
+            if (loop.v >= totvert || loop.e >= uint(edges.size())) {
+              return false;
+            }
+            const MEdge &edge = edges[loop.e];
+            if (!((edge.v1 == loop.v && edge.v2 == loop_next.v) ||
+                  (edge.v1 == loop_next.v && edge.v2 == loop.v))) {
+              return false;
+            }
+          }
+          poly_sorted_verts(poly, loops.data(), sorted_verts);
+          if (std::adjacent_find(sorted_verts.begin(), sorted_verts.end()) !=
+              sorted_verts.end()) {
+            return false;
+          }
+          uint64_t hash = uint64_t(poly.totloop);
+          for (const int vert : sorted_verts) {
+            hash = blender::get_default_hash_2(hash, vert);
+          }
+          poly_keys[i] = {hash, i};
+        }
+        return true;
+      },
+      std::logical_and<bool>());
+  if (!valid) {
+    return false;
+  }
+
+  blender::parallel_sort(poly_keys.begin(), poly_keys.end());
+  return blender::threading::parallel_reduce(
+      polys.index_range().drop_front(1),
+      1024,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        if (!valid) {
+          return false;
+        }
+        Vector<int, 16> verts_a;
+        Vector<int, 16> verts_b;
+        for (const int i : range) {
+          if (poly_keys[i].first != poly_keys[i - 1].first) {
+            continue;
+          }
+          poly_sorted_verts(polys[poly_keys[i].second], loops.data(), verts_a);
+          poly_sorted_verts(polys[poly_keys[i - 1].second], loops.data(), verts_b);
+          if (verts_a.as_span() == verts_b.as_span()) {
+            return false;
+          }
+        }
+        return true;
+      },
+      std::logical_and<bool>());
+}
+
+static bool mesh_arrays_deform_verts_are_valid(const Span<MDeformVert> dverts)
+{
+  return blender::threading::parallel_reduce(
+      dverts.index_range(),
+      4096,
+      true,
+      [&](const IndexRange range, const bool valid) {
+        if (!valid) {
+          return false;
+        }
+        for (const MDeformVert &dvert : dverts.slice(range)) {
+          for (const MDeformWeight &dw : Span(dvert.dw, dvert.totweight)) {
+            if (!isfinite(dw.weight) || dw.weight < 0.0f || dw.weight > 1.0f ||
+                dw.def_nr >= INT_MAX) {
+              return false;
+            }
+          }
+        }
+        return true;
+      },
+      std::logical_and<bool>());
+}
+
+static bool mesh_select_is_valid(const Mesh *mesh)
+{
+  for (const MSelect &msel : Span(mesh->mselect, mesh->mselect ? mesh->totselect : 0)) {
+    if (msel.index < 0) {
+      return false;
+    }
+    switch (msel.type) {
+      case ME_VSEL:
+        if (msel.index > mesh->totvert) {
+          return false;
+        }
+        break;
+      case ME_ESEL:
+        if (msel.index > mesh->totedge) {
+          return false;
+        }
+        break;
+      case ME_FSEL:
+        if (msel.index > mesh->totpoly) {
+          return false;
+        }
+        break;
+    }
+  }
+  return true;
+}
+
+/**
+ * \return True when #BKE_mesh_validate_arrays would not find any problem. False negatives are
+ * allowed for rare cases, then the detailed validation has to run.
+ */
+static bool mesh_arrays_are_valid_parallel(const Mesh *mesh,
+                                           const Span<MVert> verts,
+                                           const Span<MEdge> edges,
+                                           const MFace *mfaces,
+                                           const Span<MLoop> loops,
+                                           const Span<MPoly> polys,
+                                           const MDeformVert *dverts)
+{
+  if (mesh == nullptr) {
+    return false;
+  }
+  if (mfaces && polys.is_empty()) {
+    /* Legacy faces are only validated by the detailed pass. */
+    return false;
+  }
+  if (edges.is_empty() && !polys.is_empty()) {
+    return false;
+  }
+  if (polys.is_empty() && !loops.is_empty()) {
+    /* All corners are unused. */
+    return false;
+  }
+  if (!mesh_select_is_valid(mesh)) {
+    return false;
+  }
+
+  bool verts_valid = true;
+  bool edges_valid = true;
+  bool polys_valid = true;
+  bool dverts_valid = true;
+  blender::threading::parallel_invoke(
+      verts.size() + edges.size() > 1024,
+      [&]() { verts_valid = mesh_arrays_verts_are_valid(mesh, verts); },
+      [&]() { edges_valid = mesh_arrays_edges_are_valid(edges, uint(verts.size())); },
+      [&]() {
+        polys_valid = mesh_arrays_polys_are_valid(mesh, edges, loops, polys, uint(verts.size()));
+      },
+      [&]() {
+        if (dverts) {
+          dverts_valid = mesh_arrays_deform_verts_are_valid(Span(dverts, verts.size()));
+        }
+      });
+  return verts_valid && edges_valid && polys_valid && dverts_valid;
+}
+
+/** \} */
+
 /* NOLINTNEXTLINE: readability-function-size */
 bool BKE_mesh_validate_arrays(Mesh *mesh,
                               MVert *mverts,
@@ -221,6 +510,20 @@ bool BKE_mesh_validate_arrays(Mesh *mesh,
                               const bool do_fixes,
                               bool *r_changed)
 {
+  if (mesh_arrays_are_valid_parallel(mesh,
+                                     Span(mverts, totvert),
+                                     Span(medges, totedge),
+                                     mfaces,
+                                     Span(mloops, totloop),
+                                     Span(mpolys, totpoly),
+                                     dverts)) {
+    PRINT_MSG(
+        "verts(%u), edges(%u), loops(%u), polygons(%u)", totvert, totedge, totloop, totpoly);
+    PRINT_MSG("%s: finished\n\n", __func__);
+    *r_changed = false;
+    return true;
+  }
+
 #define REMOVE_EDGE_TAG(_me) \
   { \
     _me->v2 = _me->v1; \
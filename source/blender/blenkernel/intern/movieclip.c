@@ -32,6 +32,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
 #include "DNA_space_types.h"
+#include "DNA_userdef_types.h"
 #include "DNA_view3d_types.h"
 
 #include "BLI_utildefines.h"
@@ -49,6 +50,7 @@
 #include "BKE_global.h"
 #include "BKE_idtype.h"
 #include "BKE_image.h" /* openanim */
+#include "BKE_image_read_ahead.h"
 #include "BKE_lib_id.h"
 #include "BKE_lib_query.h"
 #include "BKE_main.h"
@@ -604,14 +606,14 @@ void BKE_movieclip_convert_multilayer_ibuf(struct ImBuf *ibuf)
 #endif
 }
 
-static ImBuf *movieclip_load_sequence_file(MovieClip *clip,
-                                           const MovieClipUser *user,
-                                           int framenr,
-                                           int flag)
+/* The file path and color space of a frame of an image sequence or proxy. */
+static void movieclip_sequence_file_get(MovieClip *clip,
+                                        const MovieClipUser *user,
+                                        int framenr,
+                                        int flag,
+                                        char *name,
+                                        char **r_colorspace)
 {
-  struct ImBuf *ibuf;
-  char name[FILE_MAX];
-  int loadflag;
   bool use_proxy = false;
   char *colorspace;
 
@@ -637,10 +639,27 @@ static ImBuf *movieclip_load_sequence_file(MovieClip *clip,
     colorspace = clip->colorspace_settings.name;
   }
 
-  loadflag = IB_rect | IB_multilayer | IB_alphamode_detect | IB_metadata;
+  *r_colorspace = colorspace;
+}
+
+#define MOVIECLIP_SEQUENCE_LOAD_FLAG (IB_rect | IB_multilayer | IB_alphamode_detect | IB_metadata)
+
+static ImBuf *movieclip_load_sequence_file(MovieClip *clip,
+                                           const MovieClipUser *user,
+                                           int framenr,
+                                           int flag)
+{
+  struct ImBuf *ibuf;
+  char name[FILE_MAX];
+  char *colorspace;
+
+  movieclip_sequence_file_get(clip, user, framenr, flag, name, &colorspace);
 
-  /* read ibuf */
-  ibuf = IMB_loadiffname(name, loadflag, colorspace);
+  /* read ibuf, unless it was read ahead already */
+  ibuf = BKE_image_read_ahead_take(name, MOVIECLIP_SEQUENCE_LOAD_FLAG, colorspace);
+  if (ibuf == NULL) {
+    ibuf = IMB_loadiffname(name, MOVIECLIP_SEQUENCE_LOAD_FLAG, colorspace);
+  }
   BKE_movieclip_convert_multilayer_ibuf(ibuf);
 
   return ibuf;
@@ -654,8 +673,13 @@ static void movieclip_open_anim_file(MovieClip *clip)
     BLI_strncpy(str, clip->filepath, FILE_MAX);
     BLI_path_abs(str, ID_BLEND_PATH_FROM_GLOBAL(&clip->id));
 
+    int flags = IB_rect;
+    if (U.video_flag & USER_VIDEO_HARDWARE_DECODE) {
+      flags |= IB_animhwdecode;
+    }
+
     /* FIXME: make several stream accessible in image editor, too */
-    clip->anim = openanim(str, IB_rect, 0, clip->colorspace_settings.name);
+    clip->anim = openanim(str, flags, 0, clip->colorspace_settings.name);
 
     if (clip->anim) {
       if (clip->flag & MCLIP_USE_PROXY_CUSTOM_DIR) {
@@ -906,6 +930,36 @@ static bool has_imbuf_cache(MovieClip *clip, MovieClipUser *user, int flag)
   return false;
 }
 
+/* Read the next frames of an image sequence in the background, in the direction of playback. Files
+ * past the end of the sequence fail to load, which is cheap. */
+static void movieclip_read_ahead_sequence(MovieClip *clip,
+                                          const MovieClipUser *user,
+                                          int framenr,
+                                          int prev_framenr,
+                                          int flag)
+{
+  const int direction = (framenr < prev_framenr) ? -1 : 1;
+  char names[IMAGE_READ_AHEAD_FRAMES_MAX][FILE_MAX];
+  const char *name_ptrs[IMAGE_READ_AHEAD_FRAMES_MAX];
+  char *colorspace = NULL;
+  int names_num = 0;
+
+  for (int i = 1; i <= IMAGE_READ_AHEAD_FRAMES_MAX; i++) {
+    MovieClipUser user_t = *user;
+    user_t.framenr = framenr + direction * i;
+    if (has_imbuf_cache(clip, &user_t, flag)) {
+      continue;
+    }
+    movieclip_sequence_file_get(
+        clip, &user_t, user_t.framenr, flag, names[names_num], &colorspace);
+    name_ptrs[names_num] = names[names_num];
+    names_num++;
+  }
+
+  BKE_image_read_ahead_schedule(
+      clip, name_ptrs, names_num, MOVIECLIP_SEQUENCE_LOAD_FLAG, colorspace);
+}
+
 static bool put_imbuf_cache(
     MovieClip *clip, const MovieClipUser *user, ImBuf *ibuf, int flag, bool destructive)
 {
@@ -1333,6 +1387,9 @@ static ImBuf *movieclip_get_postprocessed_ibuf(
 
     if (clip->source == MCLIP_SRC_SEQUENCE || use_sequence) {
       ibuf = movieclip_load_sequence_file(clip, user, framenr, flag);
+      if (ibuf && (cache_flag & MOVIECLIP_CACHE_SKIP) == 0) {
+        movieclip_read_ahead_sequence(clip, user, framenr, clip->lastframe, flag);
+      }
     }
     else {
       ibuf = movieclip_load_movie_file(clip, user, framenr, flag);
@@ -1687,6 +1744,8 @@ static void free_buffers(MovieClip *clip)
     clip->anim = NULL;
   }
 
+  BKE_image_read_ahead_cancel(clip);
+
   MovieClip_RuntimeGPUTexture *tex;
   for (tex = clip->runtime.gputextures.first; tex; tex = tex->next) {
     for (int i = 0; i < TEXTARGET_COUNT; i++) {
@@ -16,6 +16,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.h"
 
 #include "BKE_customdata.h"
 #include "BKE_lib_id.h"
@@ -66,6 +67,84 @@ static float v3_dist_from_plane(const float v[3], const float center[3], const f
   return dot_v3v3(s, no);
 }
 
+typedef struct RefitBaseMeshData {
+  MVert *base_verts;
+  const MPoly *base_polys;
+  const MLoop *base_loops;
+  const MeshElemMap *pmap;
+  const float(*origco)[3];
+} RefitBaseMeshData;
+
+static void refit_base_mesh_vert_task(void *__restrict userdata,
+                                      const int i,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const RefitBaseMeshData *data = userdata;
+  float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
+
+  /* Don't adjust vertices not used by at least one poly. */
+  if (!data->pmap[i].count) {
+    return;
+  }
+
+  /* Find center. */
+  int tot = 0;
+  for (int j = 0; j < data->pmap[i].count; j++) {
+    const MPoly *p = &data->base_polys[data->pmap[i].indices[j]];
+
+    /* This double counts, not sure if that's bad or good. */
+    for (int k = 0; k < p->totloop; k++) {
+      const int vndx = data->base_loops[p->loopstart + k].v;
+      if (vndx != i) {
+        add_v3_v3(center, data->origco[vndx]);
+        tot++;
+      }
+    }
+  }
+  mul_v3_fl(center, 1.0f / tot);
+
+  /* Find normal. */
+  for (int j = 0; j < data->pmap[i].count; j++) {
+    const MPoly *p = &data->base_polys[data->pmap[i].indices[j]];
+    MPoly fake_poly;
+    MLoop *fake_loops;
+    float(*fake_co)[3];
+    float no[3];
+
+    /* Set up poly, loops, and coords in order to call BKE_mesh_calc_poly_normal_coords(). */
+    fake_poly.totloop = p->totloop;
+    fake_poly.loopstart = 0;
+    fake_loops = MEM_malloc_arrayN(p->totloop, sizeof(MLoop), "fake_loops");
+    fake_co = MEM_malloc_arrayN(p->totloop, sizeof(float[3]), "fake_co");
+
+    for (int k = 0; k < p->totloop; k++) {
+      const int vndx = data->base_loops[p->loopstart + k].v;
+
+      fake_loops[k].v = k;
+
+      if (vndx == i) {
+        copy_v3_v3(fake_co[k], center);
+      }
+      else {
+        copy_v3_v3(fake_co[k], data->origco[vndx]);
+      }
+    }
+
+    BKE_mesh_calc_poly_normal_coords(&fake_poly, fake_loops, (const float(*)[3])fake_co, no);
+    MEM_freeN(fake_loops);
+    MEM_freeN(fake_co);
+
+    add_v3_v3(avg_no, no);
+  }
+  normalize_v3(avg_no);
+
+  /* Push vertex away from the plane. */
+  const float dist = v3_dist_from_plane(data->base_verts[i].co, center, avg_no);
+  copy_v3_v3(push, avg_no);
+  mul_v3_fl(push, dist);
+  add_v3_v3(data->base_verts[i].co, push);
+}
+
 void multires_reshape_apply_base_refit_base_mesh(MultiresReshapeContext *reshape_context)
 {
   Mesh *base_mesh = reshape_context->base_mesh;
@@ -88,71 +167,18 @@ void multires_reshape_apply_base_refit_base_mesh(MultiresReshapeContext *reshape
     copy_v3_v3(origco[i], base_verts[i].co);
   }
 
-  for (int i = 0; i < base_mesh->totvert; i++) {
-    float avg_no[3] = {0, 0, 0}, center[3] = {0, 0, 0}, push[3];
-
-    /* Don't adjust vertices not used by at least one poly. */
-    if (!pmap[i].count) {
-      continue;
-    }
-
-    /* Find center. */
-    int tot = 0;
-    for (int j = 0; j < pmap[i].count; j++) {
-      const MPoly *p = &reshape_context->base_polys[pmap[i].indices[j]];
-
-      /* This double counts, not sure if that's bad or good. */
-      for (int k = 0; k < p->totloop; k++) {
-        const int vndx = reshape_context->base_loops[p->loopstart + k].v;
-        if (vndx != i) {
-          add_v3_v3(center, origco[vndx]);
-          tot++;
-        }
-      }
-    }
-    mul_v3_fl(center, 1.0f / tot);
-
-    /* Find normal. */
-    for (int j = 0; j < pmap[i].count; j++) {
-      const MPoly *p = &reshape_context->base_polys[pmap[i].indices[j]];
-      MPoly fake_poly;
-      MLoop *fake_loops;
-      float(*fake_co)[3];
-      float no[3];
-
-      /* Set up poly, loops, and coords in order to call BKE_mesh_calc_poly_normal_coords(). */
-      fake_poly.totloop = p->totloop;
-      fake_poly.loopstart = 0;
-      fake_loops = MEM_malloc_arrayN(p->totloop, sizeof(MLoop), "fake_loops");
-      fake_co = MEM_malloc_arrayN(p->totloop, sizeof(float[3]), "fake_co");
-
-      for (int k = 0; k < p->totloop; k++) {
-        const int vndx = reshape_context->base_loops[p->loopstart + k].v;
-
-        fake_loops[k].v = k;
-
-        if (vndx == i) {
-          copy_v3_v3(fake_co[k], center);
-        }
-        else {
-          copy_v3_v3(fake_co[k], origco[vndx]);
-        }
-      }
-
-      BKE_mesh_calc_poly_normal_coords(&fake_poly, fake_loops, (const float(*)[3])fake_co, no);
-      MEM_freeN(fake_loops);
-      MEM_freeN(fake_co);
-
-      add_v3_v3(avg_no, no);
-    }
-    normalize_v3(avg_no);
-
-    /* Push vertex away from the plane. */
-    const float dist = v3_dist_from_plane(base_verts[i].co, center, avg_no);
-    copy_v3_v3(push, avg_no);
-    mul_v3_fl(push, dist);
-    add_v3_v3(base_verts[i].co, push);
-  }
+  /* Every vertex only reads the original coordinates, so they can be refitted in parallel. */
+  RefitBaseMeshData data = {
+      .base_verts = base_verts,
+      .base_polys = reshape_context->base_polys,
+      .base_loops = reshape_context->base_loops,
+      .pmap = pmap,
+      .origco = (const float(*)[3])origco,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, base_mesh->totvert, &data, refit_base_mesh_vert_task, &settings);
 
   MEM_freeN(origco);
   MEM_freeN(pmap);
@@ -1779,6 +1779,7 @@ void BKE_object_eval_assign_data(Object *object_eval, ID *data_eval, bool is_own
 void BKE_object_free_derived_caches(Object *ob)
 {
   MEM_SAFE_FREE(ob->runtime.bb);
+  ob->runtime.geometry_eval_inputs_hash = 0;
 
   object_update_from_subsurf_ccg(ob);
 
@@ -5,6 +5,8 @@
  * \ingroup bke
  */
 
+#include <atomic>
+
 #include "DNA_anim_types.h"
 #include "DNA_collection_types.h"
 #include "DNA_constraint_types.h"
@@ -31,6 +33,7 @@
 #include "BKE_effect.h"
 #include "BKE_gpencil.h"
 #include "BKE_gpencil_modifier.h"
+#include "BKE_idprop.h"
 #include "BKE_image.h"
 #include "BKE_key.h"
 #include "BKE_lattice.h"
@@ -39,6 +42,7 @@
 #include "BKE_material.h"
 #include "BKE_mball.h"
 #include "BKE_mesh.h"
+#include "BKE_modifier.h"
 #include "BKE_object.h"
 #include "BKE_particle.h"
 #include "BKE_pointcache.h"
@@ -131,6 +135,35 @@ void BKE_object_eval_transform_final(Depsgraph *depsgraph, Object *ob)
   }
 }
 
+static CustomData_MeshMasks object_mesh_eval_data_mask(const Depsgraph *depsgraph,
+                                                        const Scene *scene)
+{
+  CustomData_MeshMasks cddata_masks = scene->customdata_mask;
+  CustomData_MeshMasks_update(&cddata_masks, &CD_MASK_BAREMESH);
+  /* Custom attributes should not be removed automatically. They might be used by the render
+   * engine or scripts. They can still be removed explicitly using geometry nodes.
+   * Crease can be used in generic situations with geometry nodes as well. */
+  cddata_masks.vmask |= CD_MASK_PROP_ALL | CD_MASK_CREASE;
+  cddata_masks.emask |= CD_MASK_PROP_ALL | CD_MASK_CREASE;
+  cddata_masks.fmask |= CD_MASK_PROP_ALL;
+  cddata_masks.pmask |= CD_MASK_PROP_ALL;
+  cddata_masks.lmask |= CD_MASK_PROP_ALL;
+
+  /* Make sure Freestyle edge/face marks appear in DM for render (see T40315).
+   * Due to Line Art implementation, edge marks should also be shown in viewport. */
+#ifdef WITH_FREESTYLE
+  cddata_masks.emask |= CD_MASK_FREESTYLE_EDGE;
+  cddata_masks.pmask |= CD_MASK_FREESTYLE_FACE;
+  cddata_masks.vmask |= CD_MASK_MDEFORMVERT;
+#endif
+  if (DEG_get_mode(depsgraph) == DAG_EVAL_RENDER) {
+    /* Always compute UVs, vertex colors as orcos for render. */
+    cddata_masks.lmask |= CD_MASK_MLOOPUV | CD_MASK_PROP_BYTE_COLOR;
+    cddata_masks.vmask |= CD_MASK_ORCO | CD_MASK_PROP_COLOR;
+  }
+  return cddata_masks;
+}
+
 void BKE_object_handle_data_update(Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   DEG_debug_print_eval(depsgraph, __func__, ob->id.name, ob);
@@ -138,29 +171,7 @@ void BKE_object_handle_data_update(Depsgraph *depsgraph, Scene *scene, Object *o
   /* includes all keys and modifiers */
   switch (ob->type) {
     case OB_MESH: {
-      CustomData_MeshMasks cddata_masks = scene->customdata_mask;
-      CustomData_MeshMasks_update(&cddata_masks, &CD_MASK_BAREMESH);
-      /* Custom attributes should not be removed automatically. They might be used by the render
-       * engine or scripts. They can still be removed explicitly using geometry nodes.
-       * Crease can be used in generic situations with geometry nodes as well. */
-      cddata_masks.vmask |= CD_MASK_PROP_ALL | CD_MASK_CREASE;
-      cddata_masks.emask |= CD_MASK_PROP_ALL | CD_MASK_CREASE;
-      cddata_masks.fmask |= CD_MASK_PROP_ALL;
-      cddata_masks.pmask |= CD_MASK_PROP_ALL;
-      cddata_masks.lmask |= CD_MASK_PROP_ALL;
-
-      /* Make sure Freestyle edge/face marks appear in DM for render (see T40315).
-       * Due to Line Art implementation, edge marks should also be shown in viewport. */
-#ifdef WITH_FREESTYLE
-      cddata_masks.emask |= CD_MASK_FREESTYLE_EDGE;
-      cddata_masks.pmask |= CD_MASK_FREESTYLE_FACE;
-      cddata_masks.vmask |= CD_MASK_MDEFORMVERT;
-#endif
-      if (DEG_get_mode(depsgraph) == DAG_EVAL_RENDER) {
-        /* Always compute UVs, vertex colors as orcos for render. */
-        cddata_masks.lmask |= CD_MASK_MLOOPUV | CD_MASK_PROP_BYTE_COLOR;
-        cddata_masks.vmask |= CD_MASK_ORCO | CD_MASK_PROP_COLOR;
-      }
+      CustomData_MeshMasks cddata_masks = object_mesh_eval_data_mask(depsgraph, scene);
       makeDerivedMesh(depsgraph, scene, ob, &cddata_masks); /* was CD_MASK_BAREMESH */
       break;
     }
@@ -323,12 +334,139 @@ void BKE_object_batch_cache_dirty_tag(Object *ob)
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Evaluated Geometry Reuse
+ *
+ * The geometry of an object is re-evaluated every frame as soon as any of its modifier settings
+ * is animated, even when the animated values do not change. The depsgraph clears the stored
+ * inputs hash when anything other than the object's own animation or drivers affects the update
+ * of the geometry (see `deg_graph_flush_updates`), so here only the modifier settings have to be
+ * compared with those that were used for the evaluated mesh.
+ * \{ */
+
+static uint64_t hash_bytes(uint64_t hash, const void *data, const size_t size)
+{
+  /* FNV-1a. */
+  const uchar *bytes = static_cast<const uchar *>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3LLU;
+  }
+  return hash;
+}
+
+template<typename T> static uint64_t hash_value(const uint64_t hash, const T &value)
+{
+  return hash_bytes(hash, &value, sizeof(T));
+}
+
+static uint64_t hash_idproperty(uint64_t hash, const IDProperty *prop)
+{
+  hash = hash_value(hash, prop->type);
+  hash = hash_bytes(hash, prop->name, strlen(prop->name));
+  switch (prop->type) {
+    case IDP_INT:
+    case IDP_FLOAT:
+    case IDP_DOUBLE:
+      hash = hash_value(hash, prop->data.val);
+      hash = hash_value(hash, prop->data.val2);
+      break;
+    case IDP_STRING:
+      hash = hash_bytes(hash, IDP_String(prop), size_t(prop->len));
+      break;
+    case IDP_ID:
+      hash = hash_value(hash, prop->data.pointer);
+      break;
+    case IDP_ARRAY:
+      hash = hash_value(hash, prop->subtype);
+      hash = hash_value(hash, prop->len);
+      if (prop->subtype == IDP_GROUP) {
+        const IDProperty *array = static_cast<const IDProperty *>(IDP_Array(prop));
+        for (int i = 0; i < prop->len; i++) {
+          hash = hash_idproperty(hash, &array[i]);
+        }
+      }
+      else {
+        const size_t elem_size = prop->subtype == IDP_DOUBLE ? sizeof(double) : sizeof(int);
+        hash = hash_bytes(hash, IDP_Array(prop), elem_size * size_t(prop->len));
+      }
+      break;
+    case IDP_IDPARRAY: {
+      const IDProperty *array = static_cast<const IDProperty *>(IDP_Array(prop));
+      for (int i = 0; i < prop->len; i++) {
+        hash = hash_idproperty(hash, &array[i]);
+      }
+      break;
+    }
+    case IDP_GROUP:
+      LISTBASE_FOREACH (const IDProperty *, child, &prop->data.group) {
+        hash = hash_idproperty(hash, child);
+      }
+      break;
+  }
+  return hash;
+}
+
+static uint64_t object_geometry_eval_inputs_hash(const Object *ob,
+                                                 const CustomData_MeshMasks &cddata_masks)
+{
+  uint64_t hash = hash_value(0xcbf29ce484222325LLU, cddata_masks);
+  LISTBASE_FOREACH (const ModifierData *, md, &ob->modifiers) {
+    hash = hash_value(hash, md->type);
+    hash = hash_value(hash, md->mode);
+    hash = hash_value(hash, md->flag);
+    if (md->type == eModifierType_Nodes) {
+      /* The evaluation log is replaced on every evaluation. */
+      const NodesModifierData *nmd = reinterpret_cast<const NodesModifierData *>(md);
+      hash = hash_value(hash, nmd->node_group);
+      if (nmd->settings.properties != nullptr) {
+        hash = hash_idproperty(hash, nmd->settings.properties);
+      }
+      continue;
+    }
+    /* Pointers to runtime data that changes on every evaluation give a different hash every
+     * time, which only means that the geometry of such objects is never reused. */
+    const ModifierTypeInfo *mti = BKE_modifier_get_info(ModifierType(md->type));
+    hash = hash_bytes(hash, md + 1, size_t(mti->structSize) - sizeof(ModifierData));
+  }
+  /* Zero means that the inputs are unknown. */
+  return hash != 0 ? hash : 1;
+}
+
+static bool object_geometry_eval_can_be_reused(const Object *ob)
+{
+  /* Edit and paint modes modify the evaluated data or depend on it being re-created. Particle
+   * systems are evaluated as part of the geometry, but their state is not part of the hash. */
+  return ob->type == OB_MESH && ob->mode == OB_MODE_OBJECT && ob->runtime.data_eval != nullptr &&
+         BLI_listbase_is_empty(&ob->particlesystem);
+}
+
+/** \} */
+
+/** Shared by all objects, so that a version is never used for different geometry. */
+static std::atomic<uint64_t> geometry_eval_version_counter = 0;
+
 void BKE_object_eval_uber_data(Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   DEG_debug_print_eval(depsgraph, __func__, ob->id.name, ob);
   BLI_assert(ob->type != OB_ARMATURE);
+
+  uint64_t inputs_hash = 0;
+  if (ob->type == OB_MESH) {
+    inputs_hash = object_geometry_eval_inputs_hash(
+        ob, object_mesh_eval_data_mask(depsgraph, scene));
+    if (inputs_hash == ob->runtime.geometry_eval_inputs_hash &&
+        object_geometry_eval_can_be_reused(ob)) {
+      return;
+    }
+  }
+
   BKE_object_handle_data_update(depsgraph, scene, ob);
   BKE_object_batch_cache_dirty_tag(ob);
+
+  if (ob->runtime.data_eval != nullptr) {
+    ob->runtime.geometry_eval_inputs_hash = inputs_hash;
+  }
+  ob->runtime.geometry_eval_version = geometry_eval_version_counter.fetch_add(1) + 1;
 }
 
 void BKE_object_eval_ptcache_reset(Depsgraph *depsgraph, Scene *scene, Object *object)
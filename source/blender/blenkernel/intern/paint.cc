@@ -1383,6 +1383,7 @@ void BKE_sculptsession_free_vwpaint_data(SculptSession *ss)
       MEM_freeN(ss->mode.wpaint.dvert_prev);
       ss->mode.wpaint.dvert_prev = nullptr;
     }
+    MEM_SAFE_FREE(ss->mode.wpaint.weight_prev);
   }
   else {
     return;
@@ -1447,6 +1448,8 @@ static void sculptsession_free_pbvh(Object *object)
   MEM_SAFE_FREE(ss->epmap);
   MEM_SAFE_FREE(ss->epmap_mem);
 
+  MEM_SAFE_FREE(ss->automasking_factors_cache);
+
   MEM_SAFE_FREE(ss->vemap);
   MEM_SAFE_FREE(ss->vemap_mem);
 
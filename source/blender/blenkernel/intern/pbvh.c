@@ -280,16 +280,21 @@ void pbvh_grow_nodes(PBVH *pbvh, int totnode)
 }
 
 /* Add a vertex to the map, with a positive value for unique vertices and
- * a negative value for additional vertices */
-static int map_insert_vert(PBVH *pbvh, GHash *map, uint *face_verts, uint *uniq_verts, int vertex)
+ * a negative value for additional vertices. A vertex is unique in the first
+ * leaf that uses it, see #pbvh_build_mesh_leaves. */
+static int map_insert_vert(const int *vert_owner,
+                           const int leaf_rank,
+                           GHash *map,
+                           uint *face_verts,
+                           uint *uniq_verts,
+                           int vertex)
 {
   void *key, **value_p;
 
   key = POINTER_FROM_INT(vertex);
   if (!BLI_ghash_ensure_p(map, key, &value_p)) {
     int value_i;
-    if (!pbvh->vert_bitmap[vertex]) {
-      pbvh->vert_bitmap[vertex] = true;
+    if (vert_owner[vertex] == leaf_rank) {
       value_i = *uniq_verts;
       (*uniq_verts)++;
     }
@@ -305,7 +310,10 @@ static int map_insert_vert(PBVH *pbvh, GHash *map, uint *face_verts, uint *uniq_
 }
 
 /* Find vertices used by the faces in this node and update the draw buffers */
-static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node)
+static void build_mesh_leaf_node(PBVH *pbvh,
+                                 PBVHNode *node,
+                                 const int *vert_owner,
+                                 const int leaf_rank)
 {
   bool has_visible = false;
 
@@ -326,8 +334,12 @@ static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node)
   for (int i = 0; i < totface; i++) {
     const MLoopTri *lt = &pbvh->looptri[node->prim_indices[i]];
     for (int j = 0; j < 3; j++) {
-      face_vert_indices[i][j] = map_insert_vert(
-          pbvh, map, &node->face_verts, &node->uniq_verts, pbvh->mloop[lt->tri[j]].v);
+      face_vert_indices[i][j] = map_insert_vert(vert_owner,
+                                                leaf_rank,
+                                                map,
+                                                &node->face_verts,
+                                                &node->uniq_verts,
+                                                pbvh->mloop[lt->tri[j]].v);
     }
 
     if (has_visible == false) {
@@ -429,6 +441,7 @@ static void build_grid_leaf_node(PBVH *pbvh, PBVHNode *node)
   BKE_pbvh_node_mark_rebuild_draw(node);
 }
 
+/* The vertices and draw data of the leaves are built afterwards, see #pbvh_build_leaves. */
 static void build_leaf(PBVH *pbvh, int node_index, BBC *prim_bbc, int offset, int count)
 {
   pbvh->nodes[node_index].flag |= PBVH_Leaf;
@@ -438,15 +451,102 @@ static void build_leaf(PBVH *pbvh, int node_index, BBC *prim_bbc, int offset, in
 
   /* Still need vb for searches */
   update_vb(pbvh, &pbvh->nodes[node_index], prim_bbc, offset, count);
+}
+
+/* Gather the leaves in the order in which #build_sub creates them. */
+static int gather_leaves_recursive(const PBVH *pbvh, int node_index, int *r_leaves, int leaves_num)
+{
+  const PBVHNode *node = &pbvh->nodes[node_index];
+  if (node->flag & PBVH_Leaf) {
+    r_leaves[leaves_num] = node_index;
+    return leaves_num + 1;
+  }
+  leaves_num = gather_leaves_recursive(pbvh, node->children_offset, r_leaves, leaves_num);
+  return gather_leaves_recursive(pbvh, node->children_offset + 1, r_leaves, leaves_num);
+}
+
+typedef struct PBVHBuildLeavesData {
+  PBVH *pbvh;
+  const int *leaves;
+  /* For every vertex, the rank of the first leaf that uses it. */
+  int *vert_owner;
+} PBVHBuildLeavesData;
+
+static void atomic_min_int32(int32_t *v, const int32_t value)
+{
+  int32_t prev = *v;
+  while (value < prev) {
+    const int32_t found = atomic_cas_int32(v, prev, value);
+    if (found == prev) {
+      break;
+    }
+    prev = found;
+  }
+}
+
+static void pbvh_vert_owner_task_cb(void *__restrict userdata,
+                                    const int leaf_rank,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHBuildLeavesData *data = userdata;
+  PBVH *pbvh = data->pbvh;
+  const PBVHNode *node = &pbvh->nodes[data->leaves[leaf_rank]];
+
+  for (int i = 0; i < node->totprim; i++) {
+    const MLoopTri *lt = &pbvh->looptri[node->prim_indices[i]];
+    for (int j = 0; j < 3; j++) {
+      atomic_min_int32(&data->vert_owner[pbvh->mloop[lt->tri[j]].v], leaf_rank);
+    }
+  }
+}
+
+static void pbvh_build_leaf_task_cb(void *__restrict userdata,
+                                    const int leaf_rank,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PBVHBuildLeavesData *data = userdata;
+  PBVH *pbvh = data->pbvh;
+  PBVHNode *node = &pbvh->nodes[data->leaves[leaf_rank]];
 
   if (pbvh->looptri) {
-    build_mesh_leaf_node(pbvh, pbvh->nodes + node_index);
+    build_mesh_leaf_node(pbvh, node, data->vert_owner, leaf_rank);
   }
   else {
-    build_grid_leaf_node(pbvh, pbvh->nodes + node_index);
+    build_grid_leaf_node(pbvh, node);
   }
 }
 
+/* Build the vertex lists of all leaves in parallel. Vertices shared by multiple leaves are owned
+ * by the first leaf in build order, so the result does not depend on the threading. */
+static void pbvh_build_leaves(PBVH *pbvh)
+{
+  int *leaves = MEM_malloc_arrayN(pbvh->totnode, sizeof(int), __func__);
+  const int leaves_num = gather_leaves_recursive(pbvh, 0, leaves, 0);
+
+  PBVHBuildLeavesData data = {
+      .pbvh = pbvh,
+      .leaves = leaves,
+      .vert_owner = NULL,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+
+  if (pbvh->looptri) {
+    data.vert_owner = MEM_malloc_arrayN(pbvh->totvert, sizeof(int), __func__);
+    for (int i = 0; i < pbvh->totvert; i++) {
+      data.vert_owner[i] = INT_MAX;
+    }
+    BLI_task_parallel_range(0, leaves_num, &data, pbvh_vert_owner_task_cb, &settings);
+  }
+
+  BLI_task_parallel_range(0, leaves_num, &data, pbvh_build_leaf_task_cb, &settings);
+
+  MEM_SAFE_FREE(data.vert_owner);
+  MEM_freeN(leaves);
+}
+
 /* Return zero if all primitives in the node can be drawn with the
  * same material (including flat/smooth shading), non-zero otherwise */
 static bool leaf_needs_material_split(PBVH *pbvh, int offset, int count)
@@ -658,6 +758,68 @@ static void pbvh_build(PBVH *pbvh, BB *cb, BBC *prim_bbc, int totprim)
 
   pbvh->totnode = 1;
   build_sub(pbvh, 0, cb, prim_bbc, 0, totprim, NULL, 0);
+  pbvh_build_leaves(pbvh);
+}
+
+typedef struct PBVHPrimBoundsData {
+  BBC *prim_bbc;
+  /* Meshes. */
+  const MLoopTri *looptri;
+  const MLoop *mloop;
+  const MVert *verts;
+  /* Grids. */
+  CCGElem **grids;
+  const CCGKey *key;
+} PBVHPrimBoundsData;
+
+static void pbvh_prim_bounds_task_cb(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict tls)
+{
+  PBVHPrimBoundsData *data = userdata;
+  BBC *bbc = data->prim_bbc + i;
+
+  BB_reset((BB *)bbc);
+
+  if (data->looptri) {
+    const MLoopTri *lt = &data->looptri[i];
+    for (int j = 0; j < 3; j++) {
+      BB_expand((BB *)bbc, data->verts[data->mloop[lt->tri[j]].v].co);
+    }
+  }
+  else {
+    const CCGKey *key = data->key;
+    CCGElem *grid = data->grids[i];
+    for (int j = 0; j < key->grid_area; j++) {
+      BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
+    }
+  }
+
+  BBC_update_centroid(bbc);
+
+  BB_expand((BB *)tls->userdata_chunk, bbc->bcentroid);
+}
+
+static void pbvh_prim_bounds_reduce(const void *__restrict UNUSED(userdata),
+                                    void *__restrict chunk_join,
+                                    void *__restrict chunk)
+{
+  BB_expand_with_bb((BB *)chunk_join, (BB *)chunk);
+}
+
+/* For each primitive, store the AABB and the AABB centroid, and compute the bounds of all
+ * centroids. */
+static void pbvh_prim_bounds_calc(PBVHPrimBoundsData *data, const int totprim, BB *r_cb)
+{
+  BB_reset(r_cb);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  settings.userdata_chunk = r_cb;
+  settings.userdata_chunk_size = sizeof(*r_cb);
+  settings.func_reduce = pbvh_prim_bounds_reduce;
+  BLI_task_parallel_range(0, totprim, data, pbvh_prim_bounds_task_cb, &settings);
 }
 
 static void pbvh_draw_args_init(PBVH *pbvh, PBVH_GPU_Args *args, PBVHNode *node)
@@ -854,26 +1016,16 @@ void BKE_pbvh_build_mesh(PBVH *pbvh,
   pbvh->face_sets_color_seed = mesh->face_sets_color_seed;
   pbvh->face_sets_color_default = mesh->face_sets_color_default;
 
-  BB_reset(&cb);
-
   /* For each face, store the AABB and the AABB centroid */
   prim_bbc = MEM_mallocN(sizeof(BBC) * looptri_num, "prim_bbc");
 
-  for (int i = 0; i < looptri_num; i++) {
-    const MLoopTri *lt = &looptri[i];
-    const int sides = 3;
-    BBC *bbc = prim_bbc + i;
-
-    BB_reset((BB *)bbc);
-
-    for (int j = 0; j < sides; j++) {
-      BB_expand((BB *)bbc, verts[pbvh->mloop[lt->tri[j]].v].co);
-    }
-
-    BBC_update_centroid(bbc);
-
-    BB_expand(&cb, bbc->bcentroid);
-  }
+  PBVHPrimBoundsData bounds_data = {
+      .prim_bbc = prim_bbc,
+      .looptri = looptri,
+      .mloop = mloop,
+      .verts = verts,
+  };
+  pbvh_prim_bounds_calc(&bounds_data, looptri_num, &cb);
 
   if (looptri_num) {
     pbvh_build(pbvh, &cb, prim_bbc, looptri_num);
@@ -885,9 +1037,6 @@ void BKE_pbvh_build_mesh(PBVH *pbvh,
 
   MEM_freeN(prim_bbc);
 
-  /* Clear the bitmap so it can be used as an update tag later on. */
-  memset(pbvh->vert_bitmap, 0, sizeof(bool) * totvert);
-
   BKE_pbvh_update_active_vcol(pbvh, mesh);
 
 #ifdef VALIDATE_UNIQUE_NODE_FACES
@@ -943,25 +1092,16 @@ void BKE_pbvh_build_grids(PBVH *pbvh,
   pbvh->mesh = me;
 
   BB cb;
-  BB_reset(&cb);
 
   /* For each grid, store the AABB and the AABB centroid */
   BBC *prim_bbc = MEM_mallocN(sizeof(BBC) * totgrid, "prim_bbc");
 
-  for (int i = 0; i < totgrid; i++) {
-    CCGElem *grid = grids[i];
-    BBC *bbc = prim_bbc + i;
-
-    BB_reset((BB *)bbc);
-
-    for (int j = 0; j < gridsize * gridsize; j++) {
-      BB_expand((BB *)bbc, CCG_elem_offset_co(key, grid, j));
-    }
-
-    BBC_update_centroid(bbc);
-
-    BB_expand(&cb, bbc->bcentroid);
-  }
+  PBVHPrimBoundsData bounds_data = {
+      .prim_bbc = prim_bbc,
+      .grids = grids,
+      .key = key,
+  };
+  pbvh_prim_bounds_calc(&bounds_data, totgrid, &cb);
 
   if (totgrid) {
     pbvh_build(pbvh, &cb, prim_bbc, totgrid);
@@ -11,6 +11,7 @@
 #include "BLI_heap_simple.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.h"
@@ -923,54 +924,124 @@ static void short_edge_queue_edge_add(EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+/* Check if the edges of the face should be considered for the queue. */
+static bool edge_queue_face_test(const EdgeQueue *q, BMFace *f)
 {
 #ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  if (q->use_view_normal) {
+    if (dot_v3v3(f->no, q->view_normal) < 0.0f) {
+      return false;
     }
   }
 #endif
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    /* Check each edge of the face */
-    BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    BMLoop *l_iter = l_first;
-    do {
-#ifdef USE_EDGEQUEUE_EVEN_SUBDIV
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->q->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
-      }
-#else
-      long_edge_queue_edge_add(eq_ctx, l_iter->e);
-#endif
-    } while ((l_iter = l_iter->next) != l_first);
+  return q->edge_queue_tri_in_range(q, f);
+}
+
+/* Faces of a node that passed #edge_queue_face_test, in the iteration order of the node. */
+typedef struct EdgeQueueNodeFaces {
+  PBVHNode *node;
+  BMFace **faces;
+  int faces_num;
+} EdgeQueueNodeFaces;
+
+typedef struct EdgeQueueNodeFacesData {
+  const EdgeQueue *q;
+  EdgeQueueNodeFaces *nodes_faces;
+} EdgeQueueNodeFacesData;
+
+static void edge_queue_node_faces_task_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  EdgeQueueNodeFacesData *data = userdata;
+  const EdgeQueue *q = data->q;
+  EdgeQueueNodeFaces *node_faces = &data->nodes_faces[i];
+  GSet *bm_faces = node_faces->node->bm_faces;
+
+  node_faces->faces = MEM_malloc_arrayN(BLI_gset_len(bm_faces), sizeof(BMFace *), __func__);
+  node_faces->faces_num = 0;
+
+  GSetIterator gs_iter;
+  GSET_ITER (gs_iter, bm_faces) {
+    BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
+    if (edge_queue_face_test(q, f)) {
+      node_faces->faces[node_faces->faces_num++] = f;
+    }
   }
 }
 
-static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+/* Find the faces of the nodes marked for topology update that are in range. Testing the
+ * faces is the expensive part of creating the queue and does not modify the mesh, so it is done
+ * in parallel. Adding the edges to the queue happens afterwards in the same order as before, so
+ * the result does not depend on the threading. */
+static EdgeQueueNodeFaces *edge_queue_nodes_faces_gather(EdgeQueueContext *eq_ctx,
+                                                        PBVH *pbvh,
+                                                        int *r_nodes_num)
 {
-#ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  EdgeQueueNodeFaces *nodes_faces = MEM_malloc_arrayN(
+      pbvh->totnode, sizeof(EdgeQueueNodeFaces), __func__);
+  int nodes_num = 0;
+
+  for (int n = 0; n < pbvh->totnode; n++) {
+    PBVHNode *node = &pbvh->nodes[n];
+
+    /* Check leaf nodes marked for topology update */
+    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
+        !(node->flag & PBVH_FullyHidden)) {
+      nodes_faces[nodes_num++].node = node;
     }
   }
-#endif
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
+  EdgeQueueNodeFacesData data = {
+      .q = eq_ctx->q,
+      .nodes_faces = nodes_faces,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, nodes_num, &data, edge_queue_node_faces_task_cb, &settings);
 
-    /* Check each edge of the face */
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
+  *r_nodes_num = nodes_num;
+  return nodes_faces;
+}
+
+static void edge_queue_nodes_faces_free(EdgeQueueNodeFaces *nodes_faces, const int nodes_num)
+{
+  for (int i = 0; i < nodes_num; i++) {
+    MEM_freeN(nodes_faces[i].faces);
   }
+  MEM_freeN(nodes_faces);
+}
+
+static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  /* Check each edge of the face */
+  BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  BMLoop *l_iter = l_first;
+  do {
+#ifdef USE_EDGEQUEUE_EVEN_SUBDIV
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->q->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
+    }
+#else
+    long_edge_queue_edge_add(eq_ctx, l_iter->e);
+#endif
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  BMLoop *l_iter;
+  BMLoop *l_first;
+
+  /* Check each edge of the face */
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
 }
 
 /* Create a priority queue containing vertex pairs connected by a long
@@ -1018,22 +1089,15 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        long_edge_queue_face_add(eq_ctx, f);
-      }
+  int nodes_num;
+  EdgeQueueNodeFaces *nodes_faces = edge_queue_nodes_faces_gather(eq_ctx, pbvh, &nodes_num);
+  for (int i = 0; i < nodes_num; i++) {
+    /* Check each face */
+    for (int j = 0; j < nodes_faces[i].faces_num; j++) {
+      long_edge_queue_face_add(eq_ctx, nodes_faces[i].faces[j]);
     }
   }
+  edge_queue_nodes_faces_free(nodes_faces, nodes_num);
 }
 
 /* Create a priority queue containing vertex pairs connected by a
@@ -1077,22 +1141,15 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (int n = 0; n < pbvh->totnode; n++) {
-    PBVHNode *node = &pbvh->nodes[n];
-
-    /* Check leaf nodes marked for topology update */
-    if ((node->flag & PBVH_Leaf) && (node->flag & PBVH_UpdateTopology) &&
-        !(node->flag & PBVH_FullyHidden)) {
-      GSetIterator gs_iter;
-
-      /* Check each face */
-      GSET_ITER (gs_iter, node->bm_faces) {
-        BMFace *f = BLI_gsetIterator_getKey(&gs_iter);
-
-        short_edge_queue_face_add(eq_ctx, f);
-      }
+  int nodes_num;
+  EdgeQueueNodeFaces *nodes_faces = edge_queue_nodes_faces_gather(eq_ctx, pbvh, &nodes_num);
+  for (int i = 0; i < nodes_num; i++) {
+    /* Check each face */
+    for (int j = 0; j < nodes_faces[i].faces_num; j++) {
+      short_edge_queue_face_add(eq_ctx, nodes_faces[i].faces[j]);
     }
   }
+  edge_queue_nodes_faces_free(nodes_faces, nodes_num);
 }
 
 /*************************** Topology update **************************/
@@ -4,6 +4,8 @@
 
 #include <optional>
 
+#include "BLI_task.hh"
+
 namespace blender::bke::pbvh::uv_islands {
 
 static void uv_edge_append_to_uv_vertices(UVEdge &uv_edge)
@@ -1238,34 +1240,42 @@ float UVBorderEdge::length() const
 /** \name UVIslands
  * \{ */
 
+/* The islands only reference the mesh data and their own elements, so they are built and extended
+ * in parallel. The islands can have very different sizes, hence the grain size of one island. */
 UVIslands::UVIslands(MeshData &mesh_data)
 {
-  islands.reserve(mesh_data.uv_island_len);
+  /* Group the primitives first, to avoid iterating over all primitives for every island. */
+  Array<Vector<MeshPrimitive *>> island_primitives(mesh_data.uv_island_len);
+  for (MeshPrimitive &primitive : mesh_data.primitives) {
+    island_primitives[primitive.uv_island_id].append(&primitive);
+  }
 
-  for (int64_t uv_island_id = 0; uv_island_id < mesh_data.uv_island_len; uv_island_id++) {
-    islands.append_as(UVIsland());
-    UVIsland *uv_island = &islands.last();
-    for (MeshPrimitive &primitive : mesh_data.primitives) {
-      if (primitive.uv_island_id == uv_island_id) {
-        add_primitive(*uv_island, primitive);
+  islands.resize(mesh_data.uv_island_len);
+  threading::parallel_for(islands.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t uv_island_id : range) {
+      for (MeshPrimitive *primitive : island_primitives[uv_island_id]) {
+        add_primitive(islands[uv_island_id], *primitive);
       }
     }
-  }
+  });
 }
 
 void UVIslands::extract_borders()
 {
-  for (UVIsland &island : islands) {
-    island.extract_borders();
-  }
+  threading::parallel_for(islands.index_range(), 1, [&](const IndexRange range) {
+    for (UVIsland &island : islands.as_mutable_span().slice(range)) {
+      island.extract_borders();
+    }
+  });
 }
 
 void UVIslands::extend_borders(const UVIslandsMask &islands_mask)
 {
-  ushort index = 0;
-  for (UVIsland &island : islands) {
-    island.extend_border(islands_mask, index++);
-  }
+  threading::parallel_for(islands.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t index : range) {
+      islands[index].extend_border(islands_mask, ushort(index));
+    }
+  });
 }
 
 /** \} */
@@ -1343,11 +1353,15 @@ static void add_uv_island(UVIslandsMask::Tile &tile,
 
 void UVIslandsMask::add(const UVIslands &uv_islands)
 {
-  for (Tile &tile : tiles) {
-    for (int index = 0; index < uv_islands.islands.size(); index++) {
-      add_uv_island(tile, uv_islands.islands[index], index);
+  /* Islands can overlap in UV space, so they are added in order and only the tiles are processed
+   * in parallel. */
+  threading::parallel_for(tiles.index_range(), 1, [&](const IndexRange range) {
+    for (Tile &tile : tiles.as_mutable_span().slice(range)) {
+      for (int index = 0; index < uv_islands.islands.size(); index++) {
+        add_uv_island(tile, uv_islands.islands[index], index);
+      }
     }
-  }
+  });
 }
 
 void UVIslandsMask::add_tile(const float2 udim_offset, ushort2 resolution)
@@ -1417,9 +1431,11 @@ static void dilate_tile(UVIslandsMask::Tile &tile, int max_iterations)
 
 void UVIslandsMask::dilate(int max_iterations)
 {
-  for (Tile &tile : tiles) {
-    dilate_tile(tile, max_iterations);
-  }
+  threading::parallel_for(tiles.index_range(), 1, [&](const IndexRange range) {
+    for (Tile &tile : tiles.as_mutable_span().slice(range)) {
+      dilate_tile(tile, max_iterations);
+    }
+  });
 }
 
 bool UVIslandsMask::Tile::is_masked(const uint16_t island_index, const float2 uv) const
@@ -10,6 +10,7 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <zstd.h>
 
 #include "CLG_log.h"
 
@@ -29,8 +30,11 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_endian_switch.h"
+#include "BLI_ghash.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -76,6 +80,9 @@
 #  include "LzmaLib.h"
 #endif
 
+/* Level 3 is the default of zstd, decompression is equally fast for all levels. */
+#define PTCACHE_ZSTD_LEVEL 3
+
 /* needed for directory lookup */
 #ifndef WIN32
 #  include <dirent.h>
@@ -102,6 +109,21 @@
 
 static CLG_LogRef LOG = {"bke.pointcache"};
 
+/**
+ * Frames of disk caches that are written while simulating are compressed and written in a
+ * background thread, so the simulation doesn't have to wait for it. Files are only accessed
+ * after the writes that affect them are finished.
+ */
+static struct {
+  /** Protects #filepaths, which is also accessed by the thread that writes the files. */
+  ThreadMutex filepaths_mutex;
+  /** Files that are queued or being written. */
+  GSet *filepaths;
+  /** Protects #task_pool, pushing and waiting can happen from multiple evaluation threads. */
+  ThreadMutex task_pool_mutex;
+  TaskPool *task_pool;
+} ptcache_disk_writes = {BLI_MUTEX_INITIALIZER, NULL, BLI_MUTEX_INITIALIZER, NULL};
+
 static int ptcache_data_size[] = {
     sizeof(uint),     /* BPHYS_DATA_INDEX */
     sizeof(float[3]), /* BPHYS_DATA_LOCATION */
@@ -1440,29 +1462,55 @@ static int ptcache_filepath(
   return len; /* make sure the above string is always 16 chars */
 }
 
+static bool ptcache_disk_write_is_pending(const char *filepath)
+{
+  BLI_mutex_lock(&ptcache_disk_writes.filepaths_mutex);
+  const bool is_pending = ptcache_disk_writes.filepaths &&
+                          BLI_gset_haskey(ptcache_disk_writes.filepaths, filepath);
+  BLI_mutex_unlock(&ptcache_disk_writes.filepaths_mutex);
+  return is_pending;
+}
+
+/** Wait for the background write of the file, if there is any. */
+static void ptcache_disk_write_wait(const char *filepath)
+{
+  if (ptcache_disk_write_is_pending(filepath)) {
+    BKE_ptcache_disk_writes_wait();
+  }
+}
+
 /**
- * Caller must close after!
+ * Get the path of the file of the frame.
+ * \return False when a file can't be used for the mode.
  */
-static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
+static bool ptcache_file_path_get(PTCacheID *pid, int mode, int cfra, char *filepath)
 {
-  PTCacheFile *pf;
-  FILE *fp = NULL;
-  char filepath[MAX_PTCACHE_FILE];
-
 #ifndef DURIAN_POINTCACHE_LIB_OK
   /* don't allow writing for linked objects */
   if (pid->owner_id->lib && mode == PTCACHE_FILE_WRITE) {
-    return NULL;
+    return false;
   }
+#else
+  UNUSED_VARS(mode);
 #endif
   if ((pid->cache->flag & PTCACHE_EXTERNAL) == 0) {
     const char *blendfile_path = BKE_main_blendfile_path_from_global();
     if (blendfile_path[0] == '\0') {
-      return NULL; /* save blend file before using disk pointcache */
+      return false; /* save blend file before using disk pointcache */
     }
   }
 
   ptcache_filepath(pid, filepath, cfra, true, true);
+  return true;
+}
+
+/**
+ * Caller must close after!
+ */
+static PTCacheFile *ptcache_file_path_open(const char *filepath, int mode, int cfra)
+{
+  PTCacheFile *pf;
+  FILE *fp = NULL;
 
   if (mode == PTCACHE_FILE_READ) {
     fp = BLI_fopen(filepath, "rb");
@@ -1489,6 +1537,22 @@ static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
 
   return pf;
 }
+/**
+ * Caller must close after!
+ */
+static PTCacheFile *ptcache_file_open(PTCacheID *pid, int mode, int cfra)
+{
+  char filepath[MAX_PTCACHE_FILE];
+
+  if (!ptcache_file_path_get(pid, mode, cfra, filepath)) {
+    return NULL;
+  }
+
+  /* The file may be accessed while it is still written in the background. */
+  ptcache_disk_write_wait(filepath);
+
+  return ptcache_file_path_open(filepath, mode, cfra);
+}
 static void ptcache_file_close(PTCacheFile *pf)
 {
   if (pf) {
@@ -1534,6 +1598,10 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
         r = LzmaUncompress(result, &leno, in, &leni, props, sizeOfIt);
       }
 #endif
+      if (compressed == PTCACHE_COMPRESS_ZSTD) {
+        const size_t out_size = ZSTD_decompress(result, len, in, in_len);
+        r = ZSTD_isError(out_size) || out_size != len;
+      }
       MEM_freeN(in);
     }
   }
@@ -1595,6 +1663,19 @@ static int ptcache_file_compressed_write(
     }
   }
 #endif
+  if (mode == PTCACHE_COMPRESS_ZSTD) {
+    /* The output buffers are allocated with #LZO_OUT_LEN, which is larger than the worst case
+     * size of zstd. */
+    BLI_assert(ZSTD_compressBound(in_len) <= LZO_OUT_LEN(in_len));
+    out_len = ZSTD_compress(out, ZSTD_compressBound(in_len), in, in_len, PTCACHE_ZSTD_LEVEL);
+
+    if (ZSTD_isError(out_len) || (out_len >= in_len)) {
+      compressed = 0;
+    }
+    else {
+      compressed = PTCACHE_COMPRESS_ZSTD;
+    }
+  }
 
   ptcache_file_write(pf, &compressed, 1, sizeof(uchar));
   if (compressed) {
@@ -2012,14 +2093,16 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
 
   return pm;
 }
-static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
+static int ptcache_mem_frame_to_file(const char *filepath,
+                                     const uint type,
+                                     const int compression,
+                                     int (*write_header)(PTCacheFile *pf),
+                                     PTCacheMem *pm)
 {
   PTCacheFile *pf = NULL;
   uint i, error = 0;
 
-  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
-
-  pf = ptcache_file_open(pid, PTCACHE_FILE_WRITE, pm->frame);
+  pf = ptcache_file_path_open(filepath, PTCACHE_FILE_WRITE, pm->frame);
 
   if (pf == NULL) {
     if (G.debug & G_DEBUG) {
@@ -2030,29 +2113,28 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 
   pf->data_types = pm->data_types;
   pf->totpoint = pm->totpoint;
-  pf->type = pid->type;
+  pf->type = type;
   pf->flag = 0;
 
   if (pm->extradata.first) {
     pf->flag |= PTCACHE_TYPEFLAG_EXTRADATA;
   }
 
-  if (pid->cache->compression) {
+  if (compression) {
     pf->flag |= PTCACHE_TYPEFLAG_COMPRESS;
   }
 
-  if (!ptcache_file_header_begin_write(pf) || !pid->write_header(pf)) {
+  if (!ptcache_file_header_begin_write(pf) || !write_header(pf)) {
     error = 1;
   }
 
   if (!error) {
-    if (pid->cache->compression) {
+    if (compression) {
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         if (pm->data[i]) {
           uint in_len = pm->totpoint * ptcache_data_size[i];
           uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-          ptcache_file_compressed_write(
-              pf, (uchar *)(pm->data[i]), in_len, out, pid->cache->compression);
+          ptcache_file_compressed_write(pf, (uchar *)(pm->data[i]), in_len, out, compression);
           MEM_freeN(out);
         }
       }
@@ -2084,11 +2166,10 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
       ptcache_file_write(pf, &extra->type, 1, sizeof(uint));
       ptcache_file_write(pf, &extra->totdata, 1, sizeof(uint));
 
-      if (pid->cache->compression) {
+      if (compression) {
         uint in_len = extra->totdata * ptcache_extra_datasize[extra->type];
         uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-        ptcache_file_compressed_write(
-            pf, (uchar *)(extra->data), in_len, out, pid->cache->compression);
+        ptcache_file_compressed_write(pf, (uchar *)(extra->data), in_len, out, compression);
         MEM_freeN(out);
       }
       else {
@@ -2105,6 +2186,127 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 
   return error == 0;
 }
+static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
+{
+  char filepath[MAX_PTCACHE_FILE];
+
+  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+
+  if (!ptcache_file_path_get(pid, PTCACHE_FILE_WRITE, pm->frame, filepath)) {
+    if (G.debug & G_DEBUG) {
+      printf("Error opening disk cache file for writing\n");
+    }
+    return 0;
+  }
+
+  /* Don't write the same file from two threads. */
+  ptcache_disk_write_wait(filepath);
+
+  return ptcache_mem_frame_to_file(
+      filepath, pid->type, pid->cache->compression, pid->write_header, pm);
+}
+
+typedef struct PTCacheDiskWrite {
+  char filepath[MAX_PTCACHE_FILE];
+  uint type;
+  int compression;
+  int (*write_header)(PTCacheFile *pf);
+  PTCacheMem *pm;
+} PTCacheDiskWrite;
+
+static void ptcache_disk_write_run(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  PTCacheDiskWrite *write = taskdata;
+
+  ptcache_mem_frame_to_file(
+      write->filepath, write->type, write->compression, write->write_header, write->pm);
+
+  BLI_mutex_lock(&ptcache_disk_writes.filepaths_mutex);
+  BLI_gset_remove(ptcache_disk_writes.filepaths, write->filepath, NULL);
+  BLI_mutex_unlock(&ptcache_disk_writes.filepaths_mutex);
+}
+
+static void ptcache_disk_write_free(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  PTCacheDiskWrite *write = taskdata;
+  ptcache_mem_clear(write->pm);
+  MEM_freeN(write->pm);
+  MEM_freeN(write);
+}
+
+/**
+ * Same as #ptcache_mem_frame_to_disk, but the file is written in the background.
+ * Takes ownership of the frame.
+ */
+static int ptcache_mem_frame_to_disk_async(PTCacheID *pid, PTCacheMem *pm)
+{
+  PTCacheDiskWrite *write = MEM_callocN(sizeof(PTCacheDiskWrite), __func__);
+
+  BKE_ptcache_id_clear(pid, PTCACHE_CLEAR_FRAME, pm->frame);
+
+  if (!ptcache_file_path_get(pid, PTCACHE_FILE_WRITE, pm->frame, write->filepath)) {
+    if (G.debug & G_DEBUG) {
+      printf("Error opening disk cache file for writing\n");
+    }
+    ptcache_mem_clear(pm);
+    MEM_freeN(pm);
+    MEM_freeN(write);
+    return 0;
+  }
+
+  /* Clearing a frame doesn't wait when the cache can't be cleared. */
+  ptcache_disk_write_wait(write->filepath);
+
+  write->type = pid->type;
+  write->compression = pid->cache->compression;
+  write->write_header = pid->write_header;
+  write->pm = pm;
+
+  BLI_mutex_lock(&ptcache_disk_writes.filepaths_mutex);
+  if (ptcache_disk_writes.filepaths == NULL) {
+    ptcache_disk_writes.filepaths = BLI_gset_str_new(__func__);
+  }
+  BLI_gset_add(ptcache_disk_writes.filepaths, write->filepath);
+  BLI_mutex_unlock(&ptcache_disk_writes.filepaths_mutex);
+
+  BLI_mutex_lock(&ptcache_disk_writes.task_pool_mutex);
+  if (ptcache_disk_writes.task_pool == NULL) {
+    /* A single thread writes the files in order. */
+    ptcache_disk_writes.task_pool = BLI_task_pool_create_background(NULL, TASK_PRIORITY_LOW);
+  }
+  BLI_task_pool_push(
+      ptcache_disk_writes.task_pool, ptcache_disk_write_run, write, true, ptcache_disk_write_free);
+  BLI_mutex_unlock(&ptcache_disk_writes.task_pool_mutex);
+
+  return 1;
+}
+
+void BKE_ptcache_disk_writes_wait(void)
+{
+  BLI_mutex_lock(&ptcache_disk_writes.task_pool_mutex);
+  if (ptcache_disk_writes.task_pool) {
+    BLI_task_pool_work_and_wait(ptcache_disk_writes.task_pool);
+  }
+  BLI_mutex_unlock(&ptcache_disk_writes.task_pool_mutex);
+}
+
+void BKE_ptcache_disk_writes_exit(void)
+{
+  BLI_mutex_lock(&ptcache_disk_writes.task_pool_mutex);
+  if (ptcache_disk_writes.task_pool) {
+    /* Freeing the pool finishes the writes. */
+    BLI_task_pool_free(ptcache_disk_writes.task_pool);
+    ptcache_disk_writes.task_pool = NULL;
+  }
+  BLI_mutex_unlock(&ptcache_disk_writes.task_pool_mutex);
+
+  BLI_mutex_lock(&ptcache_disk_writes.filepaths_mutex);
+  if (ptcache_disk_writes.filepaths) {
+    BLI_gset_free(ptcache_disk_writes.filepaths, NULL);
+    ptcache_disk_writes.filepaths = NULL;
+  }
+  BLI_mutex_unlock(&ptcache_disk_writes.filepaths_mutex);
+}
 
 static int ptcache_read_stream(PTCacheID *pid, int cfra)
 {
@@ -2454,18 +2656,11 @@ static int ptcache_write(PTCacheID *pid, int cfra, int overwrite)
   pm->frame = cfra;
 
   if (cache->flag & PTCACHE_DISK_CACHE) {
-    error += !ptcache_mem_frame_to_disk(pid, pm);
-
-    // if (pm) /* pm is always set */
-    {
-      ptcache_mem_clear(pm);
-      MEM_freeN(pm);
-    }
+    /* The frames are freed after they are written. */
+    error += !ptcache_mem_frame_to_disk_async(pid, pm);
 
     if (pm2) {
-      error += !ptcache_mem_frame_to_disk(pid, pm2);
-      ptcache_mem_clear(pm2);
-      MEM_freeN(pm2);
+      error += !ptcache_mem_frame_to_disk_async(pid, pm2);
     }
   }
   else {
@@ -2617,6 +2812,9 @@ void BKE_ptcache_id_clear(PTCacheID *pid, int mode, uint cfra)
     case PTCACHE_CLEAR_BEFORE:
     case PTCACHE_CLEAR_AFTER:
       if (pid->cache->flag & PTCACHE_DISK_CACHE) {
+        /* Files that are still written would be left behind. */
+        BKE_ptcache_disk_writes_wait();
+
         ptcache_path(pid, path);
 
         dir = opendir(path);
@@ -2707,6 +2905,7 @@ void BKE_ptcache_id_clear(PTCacheID *pid, int mode, uint cfra)
       if (pid->cache->flag & PTCACHE_DISK_CACHE) {
         if (BKE_ptcache_id_exist(pid, cfra)) {
           ptcache_filepath(pid, filepath, cfra, true, true); /* no path */
+          ptcache_disk_write_wait(filepath);
           BLI_delete(filepath, false, false);
         }
       }
@@ -2749,7 +2948,7 @@ bool BKE_ptcache_id_exist(PTCacheID *pid, int cfra)
 
     ptcache_filepath(pid, filepath, cfra, true, true);
 
-    return BLI_exists(filepath);
+    return ptcache_disk_write_is_pending(filepath) || BLI_exists(filepath);
   }
 
   PTCacheMem *pm = pid->cache->mem_cache.first;
@@ -2821,6 +3020,8 @@ void BKE_ptcache_id_time(
       char ext[MAX_PTCACHE_PATH];
       uint len; /* store the length of the string */
 
+      BKE_ptcache_disk_writes_wait();
+
       ptcache_path(pid, path);
 
       len = ptcache_filepath(pid, filepath, (int)cfra, 0, 0); /* no path */
@@ -3371,6 +3572,9 @@ void BKE_ptcache_bake(PTCacheBaker *baker)
     }
   }
 
+  /* The bake is only finished when all files are written. */
+  BKE_ptcache_disk_writes_wait();
+
   scene->r.framelen = frameleno;
   scene->r.cfra = cfrao;
 
@@ -3497,6 +3701,8 @@ void BKE_ptcache_disk_cache_rename(PTCacheID *pid, const char *name_src, const c
     return;
   }
 
+  BKE_ptcache_disk_writes_wait();
+
   /* save old name */
   BLI_strncpy(old_name, pid->cache->name, sizeof(old_name));
 
@@ -3556,6 +3762,8 @@ void BKE_ptcache_load_external(PTCacheID *pid)
     return;
   }
 
+  BKE_ptcache_disk_writes_wait();
+
   ptcache_path(pid, path);
 
   len = ptcache_filepath(pid, filepath, 1, false, false); /* no path */
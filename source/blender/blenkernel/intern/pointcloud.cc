@@ -13,6 +13,7 @@
 
 #include "BLI_bounds.hh"
 #include "BLI_index_range.hh"
+#include "BLI_kdopbvh.h"
 #include "BLI_listbase.h"
 #include "BLI_math_vector.hh"
 #include "BLI_rand.h"
@@ -87,6 +88,7 @@ static void pointcloud_copy_data(Main * /*bmain*/, ID *id_dst, const ID *id_src,
 
   pointcloud_dst->runtime = new blender::bke::PointCloudRuntime();
   pointcloud_dst->runtime->bounds_cache = pointcloud_src->runtime->bounds_cache;
+  pointcloud_dst->runtime->bvh_cache = pointcloud_src->runtime->bvh_cache;
 
   pointcloud_dst->batch_cache = nullptr;
 }
@@ -283,6 +285,9 @@ void BKE_pointcloud_nomain_to_pointcloud(PointCloud *pointcloud_src,
     }
     BKE_id_free(nullptr, pointcloud_src);
   }
+
+  pointcloud_dst->tag_positions_changed();
+  pointcloud_dst->tag_radii_changed();
 }
 
 bool PointCloud::bounds_min_max(blender::float3 &min, blender::float3 &max) const
@@ -331,6 +336,7 @@ BoundBox *BKE_pointcloud_boundbox_get(Object *ob)
     pointcloud->bounds_min_max(min, max);
   }
   BKE_boundbox_init_from_minmax(ob->runtime.bb, min, max);
+  ob->runtime.bb->flag &= ~BOUNDBOX_DIRTY;
 
   return ob->runtime.bb;
 }
@@ -429,9 +435,19 @@ void BKE_pointcloud_data_update(struct Depsgraph *depsgraph, struct Scene *scene
   object->runtime.geometry_set_eval = new GeometrySet(std::move(geometry_set));
 }
 
+namespace blender::bke {
+
+void BVHTreeDeleter::operator()(BVHTree *tree) const
+{
+  BLI_bvhtree_free(tree);
+}
+
+}  // namespace blender::bke
+
 void PointCloud::tag_positions_changed()
 {
   this->runtime->bounds_cache.tag_dirty();
+  this->runtime->bvh_cache.tag_dirty();
 }
 
 void PointCloud::tag_radii_changed()
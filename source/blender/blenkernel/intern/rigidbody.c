@@ -19,6 +19,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #ifdef WITH_BULLET
 #  include "RBI_api.h"
@@ -1936,67 +1937,116 @@ static void rigidbody_update_kinematic_obj_substep(ListBase *substep_targets, fl
   }
 }
 
+typedef struct ExternalForcesData {
+  Scene *scene;
+  EffectorWeights *effector_weights;
+  ListBase *effectors;
+  Object **objects;
+  float (*forces)[3];
+} ExternalForcesData;
+
+static void rigidbody_update_external_forces_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ExternalForcesData *data = userdata;
+  RigidBodyOb *rbo = data->objects[i]->rigidbody_object;
+  EffectedPoint epoint;
+  float eff_loc[3], eff_vel[3];
+
+  /* create dummy 'point' which represents last known position of object as result of sim */
+  /* XXX: this can create some inaccuracies with sim position,
+   * but is probably better than using un-simulated values? */
+  RB_body_get_position(rbo->shared->physics_object, eff_loc);
+  RB_body_get_linear_velocity(rbo->shared->physics_object, eff_vel);
+
+  pd_point_from_loc(data->scene, eff_loc, eff_vel, 0, &epoint);
+
+  /* Calculate net force of effectors, and apply to sim object:
+   * - we use 'central force' since apply force requires a "relative position"
+   *   which we don't have... */
+  zero_v3(data->forces[i]);
+  BKE_effectors_apply(
+      data->effectors, NULL, data->effector_weights, &epoint, data->forces[i], NULL, NULL);
+}
+
 static void rigidbody_update_external_forces(Depsgraph *depsgraph,
                                              Scene *scene,
                                              RigidBodyWorld *rbw)
 {
+  /* Only dynamic bodies need effector update - but don't do it on an effector. */
+  int objects_len = 0;
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
-    /* only update if rigid body exists */
     RigidBodyOb *rbo = ob->rigidbody_object;
-    if (ob->type != OB_MESH || rbo->shared->physics_object == NULL) {
-      continue;
-    }
-
-    /* update influence of effectors - but don't do it on an effector */
-    /* only dynamic bodies need effector update */
-    if (rbo->type == RBO_TYPE_ACTIVE &&
+    if (ob->type == OB_MESH && rbo->shared->physics_object && rbo->type == RBO_TYPE_ACTIVE &&
         ((ob->pd == NULL) || (ob->pd->forcefield == PFIELD_NULL))) {
-      EffectorWeights *effector_weights = rbw->effector_weights;
-      EffectedPoint epoint;
-      ListBase *effectors;
+      objects_len++;
+    }
+  }
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
-      /* get effectors present in the group specified by effector_weights */
-      effectors = BKE_effectors_create(depsgraph, ob, NULL, effector_weights, false);
-      if (effectors) {
-        float eff_force[3] = {0.0f, 0.0f, 0.0f};
-        float eff_loc[3], eff_vel[3];
+  if (objects_len == 0) {
+    return;
+  }
 
-        /* create dummy 'point' which represents last known position of object as result of sim
-         */
-        /* XXX: this can create some inaccuracies with sim position,
-         * but is probably better than using un-simulated values? */
-        RB_body_get_position(rbo->shared->physics_object, eff_loc);
-        RB_body_get_linear_velocity(rbo->shared->physics_object, eff_vel);
-
-        pd_point_from_loc(scene, eff_loc, eff_vel, 0, &epoint);
-
-        /* Calculate net force of effectors, and apply to sim object:
-         * - we use 'central force' since apply force requires a "relative position"
-         *   which we don't have... */
-        BKE_effectors_apply(effectors, NULL, effector_weights, &epoint, eff_force, NULL, NULL);
-        if (G.f & G_DEBUG) {
-          printf("\tapplying force (%f,%f,%f) to '%s'\n",
-                 eff_force[0],
-                 eff_force[1],
-                 eff_force[2],
-                 ob->id.name + 2);
-        }
-        /* activate object in case it is deactivated */
-        if (!is_zero_v3(eff_force)) {
-          RB_body_activate(rbo->shared->physics_object);
-        }
-        RB_body_apply_central_force(rbo->shared->physics_object, eff_force);
-      }
-      else if (G.f & G_DEBUG) {
-        printf("\tno forces to apply to '%s'\n", ob->id.name + 2);
-      }
+  /* Get effectors present in the group specified by effector_weights. The objects are not
+   * effectors themselves, so they can share the same effectors instead of creating them for
+   * every object (they would only be excluded from their own effectors otherwise). */
+  EffectorWeights *effector_weights = rbw->effector_weights;
+  ListBase *effectors = BKE_effectors_create(depsgraph, NULL, NULL, effector_weights, false);
+  if (effectors == NULL) {
+    if (G.f & G_DEBUG) {
+      printf("\tno forces to apply to rigid bodies\n");
+    }
+    return;
+  }
 
-      /* cleanup */
-      BKE_effectors_free(effectors);
+  Object **objects = MEM_mallocN(sizeof(*objects) * objects_len, __func__);
+  int i = 0;
+  FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
+    RigidBodyOb *rbo = ob->rigidbody_object;
+    if (ob->type == OB_MESH && rbo->shared->physics_object && rbo->type == RBO_TYPE_ACTIVE &&
+        ((ob->pd == NULL) || (ob->pd->forcefield == PFIELD_NULL))) {
+      objects[i++] = ob;
     }
-    /* NOTE: passive objects don't need to be updated since they don't move */
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
+
+  /* Evaluating the effectors is the expensive part, the forces are applied to the
+   * simulation afterwards since that modifies the Bullet bodies. */
+  ExternalForcesData data = {
+      .scene = scene,
+      .effector_weights = effector_weights,
+      .effectors = effectors,
+      .objects = objects,
+      .forces = MEM_mallocN(sizeof(*data.forces) * objects_len, __func__),
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, objects_len, &data, rigidbody_update_external_forces_cb, &settings);
+
+  for (i = 0; i < objects_len; i++) {
+    RigidBodyOb *rbo = objects[i]->rigidbody_object;
+    const float *eff_force = data.forces[i];
+    if (G.f & G_DEBUG) {
+      printf("\tapplying force (%f,%f,%f) to '%s'\n",
+             eff_force[0],
+             eff_force[1],
+             eff_force[2],
+             objects[i]->id.name + 2);
+    }
+    /* activate object in case it is deactivated */
+    if (!is_zero_v3(eff_force)) {
+      RB_body_activate(rbo->shared->physics_object);
+    }
+    RB_body_apply_central_force(rbo->shared->physics_object, eff_force);
+  }
+  /* NOTE: passive objects don't need to be updated since they don't move */
+
+  MEM_freeN(data.forces);
+  MEM_freeN(objects);
+  BKE_effectors_free(effectors);
 }
 
 static void rigidbody_free_substep_data(ListBase *substep_targets)
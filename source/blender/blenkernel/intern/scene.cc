@@ -39,11 +39,13 @@
 #include "DNA_world_types.h"
 
 #include "BKE_callbacks.h"
+#include "BLI_array.hh"
 #include "BLI_blenlib.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -115,6 +117,10 @@
 
 #include "bmesh.h"
 
+#ifdef WITH_PYTHON
+#  include "BPY_extern.h"
+#endif
+
 CurveMapping *BKE_sculpt_default_cavity_curve()
 
 {
@@ -2813,6 +2819,71 @@ void BKE_scene_graph_update_for_newframe(Depsgraph *depsgraph)
   BKE_scene_graph_update_for_newframe_ex(depsgraph, true);
 }
 
+static void scene_graph_evaluate_frame(Depsgraph *depsgraph, const int frame)
+{
+  /* The frame of the original scene is used by the copy-on-write scene when it is expanded, and
+   * it is not changed for the parallel evaluation. So the evaluated scene is set to the frame
+   * directly, and evaluated again when it was only just expanded. */
+  Scene *scene_eval = DEG_get_evaluated_scene(depsgraph);
+  scene_eval->r.cfra = frame;
+  scene_eval->r.subframe = 0.0f;
+  DEG_evaluate_on_framechange(depsgraph, float(frame));
+  if (scene_eval->r.cfra != frame) {
+    scene_eval->r.cfra = frame;
+    scene_eval->r.subframe = 0.0f;
+    DEG_evaluate_on_framechange(depsgraph, float(frame));
+  }
+}
+
+void BKE_scene_graph_evaluate_frames_parallel(const Depsgraph *depsgraph,
+                                              const int frame_start,
+                                              const int frame_end,
+                                              const int graphs_num,
+                                              SceneFrameEvaluatedFn fn,
+                                              void *user_data)
+{
+  using namespace blender;
+  if (frame_end < frame_start) {
+    return;
+  }
+  const int frames_num = frame_end - frame_start + 1;
+
+  Array<Depsgraph *> graphs(std::clamp(graphs_num, 1, frames_num));
+  for (Depsgraph *&graph : graphs) {
+    graph = DEG_graph_new(DEG_get_bmain(depsgraph),
+                          DEG_get_input_scene(depsgraph),
+                          DEG_get_input_view_layer(depsgraph),
+                          DEG_get_mode(depsgraph));
+    DEG_graph_build_from_view_layer(graph);
+  }
+
+  for (int batch_start = frame_start; batch_start <= frame_end; batch_start += graphs.size()) {
+    const int batch_size = std::min<int>(graphs.size(), frame_end - batch_start + 1);
+
+#ifdef WITH_PYTHON
+    /* Release the GIL, so that Python drivers can be evaluated from other threads while this
+     * thread is waiting for them. */
+    BPy_BEGIN_ALLOW_THREADS;
+#endif
+    threading::parallel_for(IndexRange(batch_size), 1, [&](const IndexRange range) {
+      for (const int i : range) {
+        scene_graph_evaluate_frame(graphs[i], batch_start + i);
+      }
+    });
+#ifdef WITH_PYTHON
+    BPy_END_ALLOW_THREADS;
+#endif
+
+    for (const int i : IndexRange(batch_size)) {
+      fn(graphs[i], batch_start + i, user_data);
+    }
+  }
+
+  for (Depsgraph *graph : graphs) {
+    DEG_graph_free(graph);
+  }
+}
+
 void BKE_scene_view_layer_graph_evaluated_ensure(Main *bmain, Scene *scene, ViewLayer *view_layer)
 {
   Depsgraph *depsgraph = BKE_scene_ensure_depsgraph(bmain, scene, view_layer);
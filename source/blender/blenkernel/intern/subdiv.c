@@ -172,10 +172,21 @@ Subdiv *BKE_subdiv_update_from_mesh(Subdiv *subdiv,
                                     const SubdivSettings *settings,
                                     const Mesh *mesh)
 {
+  /* For deforming meshes the topology usually stays the same, in which case the hash is much
+   * cheaper than creating a converter and comparing it with the topology refiner. */
+  const uint64_t mesh_topology_hash = BKE_subdiv_converter_mesh_topology_hash(mesh);
+  if (subdiv != NULL && subdiv->topology_refiner != NULL && mesh_topology_hash != 0 &&
+      subdiv->mesh_topology_hash == mesh_topology_hash &&
+      BKE_subdiv_settings_equal(&subdiv->settings, settings)) {
+    return subdiv;
+  }
   OpenSubdiv_Converter converter;
   BKE_subdiv_converter_init_for_mesh(&converter, settings, mesh);
   subdiv = BKE_subdiv_update_from_converter(subdiv, settings, &converter);
   BKE_subdiv_converter_free(&converter);
+  if (subdiv != NULL) {
+    subdiv->mesh_topology_hash = mesh_topology_hash;
+  }
   return subdiv;
 }
 
@@ -25,6 +25,11 @@ void BKE_subdiv_converter_init_for_mesh(struct OpenSubdiv_Converter *converter,
  * converter was allocated on heap, it is up to the user to free that memory. */
 void BKE_subdiv_converter_free(struct OpenSubdiv_Converter *converter);
 
+/* Hash of all the mesh data that is used by the mesh converter. When the hash didn't change, the
+ * topology refiner that was created from the mesh can be used without comparing it with the mesh,
+ * which is much more expensive. Zero is returned when the hash is not available. */
+uint64_t BKE_subdiv_converter_mesh_topology_hash(const struct Mesh *mesh);
+
 /* ============================ INTERNAL HELPERS ============================ */
 
 /* TODO(sergey): Find a way to make it OpenSubdiv_VtxBoundaryInterpolation,
@@ -13,6 +13,10 @@
 #include "DNA_meshdata_types.h"
 
 #include "BLI_bitmap.h"
+#include "BLI_hash_mm2a.h"
+#include "BLI_hash_mm3.h"
+#include "BLI_math_base.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_customdata.h"
@@ -406,6 +410,109 @@ static void init_user_data(OpenSubdiv_Converter *converter,
   converter->user_data = user_data;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Topology Hash
+ * \{ */
+
+/* Size of the pieces of data that are hashed in parallel. */
+#define TOPOLOGY_HASH_CHUNK_SIZE (1 << 16)
+#define TOPOLOGY_HASH_MAX_BUFFERS 16
+
+typedef struct TopologyHashBuffer {
+  const void *data;
+  size_t size;
+  int first_chunk;
+} TopologyHashBuffer;
+
+typedef struct TopologyHashContext {
+  TopologyHashBuffer buffers[TOPOLOGY_HASH_MAX_BUFFERS];
+  int buffers_num;
+  uint32_t *chunk_hashes;
+} TopologyHashContext;
+
+static void topology_hash_add_buffer(TopologyHashContext *ctx, const void *data, size_t size)
+{
+  if (data == NULL || size == 0 || ctx->buffers_num == TOPOLOGY_HASH_MAX_BUFFERS) {
+    return;
+  }
+  TopologyHashBuffer *buffer = &ctx->buffers[ctx->buffers_num++];
+  buffer->data = data;
+  buffer->size = size;
+}
+
+static void topology_hash_chunk_task(void *__restrict userdata,
+                                     const int chunk_index,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  TopologyHashContext *ctx = userdata;
+  int buffer_index = ctx->buffers_num - 1;
+  while (ctx->buffers[buffer_index].first_chunk > chunk_index) {
+    buffer_index--;
+  }
+  const TopologyHashBuffer *buffer = &ctx->buffers[buffer_index];
+  const size_t offset = (size_t)(chunk_index - buffer->first_chunk) * TOPOLOGY_HASH_CHUNK_SIZE;
+  const size_t size = min_zz(TOPOLOGY_HASH_CHUNK_SIZE, buffer->size - offset);
+  ctx->chunk_hashes[chunk_index] = BLI_hash_mm3(
+      (const unsigned char *)buffer->data + offset, size, (uint32_t)chunk_index);
+}
+
+uint64_t BKE_subdiv_converter_mesh_topology_hash(const Mesh *mesh)
+{
+  /* Hash more than what is strictly needed (e.g. selection flags), so that whole arrays can be
+   * hashed. That only causes unnecessary comparisons with the mesh when such data changes. */
+  const int counts[5] = {mesh->totvert,
+                         mesh->totedge,
+                         mesh->totpoly,
+                         mesh->totloop,
+                         CustomData_number_of_layers(&mesh->ldata, CD_MLOOPUV)};
+
+  TopologyHashContext ctx = {{{NULL}}};
+  topology_hash_add_buffer(&ctx, counts, sizeof(counts));
+  topology_hash_add_buffer(&ctx, BKE_mesh_edges(mesh), sizeof(MEdge) * (size_t)mesh->totedge);
+  topology_hash_add_buffer(&ctx, BKE_mesh_polys(mesh), sizeof(MPoly) * (size_t)mesh->totpoly);
+  topology_hash_add_buffer(&ctx, BKE_mesh_loops(mesh), sizeof(MLoop) * (size_t)mesh->totloop);
+  topology_hash_add_buffer(&ctx,
+                           CustomData_get_layer(&mesh->vdata, CD_CREASE),
+                           sizeof(float) * (size_t)mesh->totvert);
+  topology_hash_add_buffer(&ctx,
+                           CustomData_get_layer(&mesh->edata, CD_CREASE),
+                           sizeof(float) * (size_t)mesh->totedge);
+  for (int i = 0; i < counts[4]; i++) {
+    if (ctx.buffers_num == TOPOLOGY_HASH_MAX_BUFFERS) {
+      /* Not all data can be hashed, so the hash can't be relied on. */
+      return 0;
+    }
+    topology_hash_add_buffer(&ctx,
+                             CustomData_get_layer_n(&mesh->ldata, CD_MLOOPUV, i),
+                             sizeof(MLoopUV) * (size_t)mesh->totloop);
+  }
+
+  int chunks_num = 0;
+  for (int i = 0; i < ctx.buffers_num; i++) {
+    ctx.buffers[i].first_chunk = chunks_num;
+    chunks_num += (int)((ctx.buffers[i].size + TOPOLOGY_HASH_CHUNK_SIZE - 1) /
+                        TOPOLOGY_HASH_CHUNK_SIZE);
+  }
+  ctx.chunk_hashes = MEM_malloc_arrayN(chunks_num, sizeof(uint32_t), __func__);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 4;
+  BLI_task_parallel_range(0, chunks_num, &ctx, topology_hash_chunk_task, &settings);
+
+  /* The chunk hashes are combined in order, so the result doesn't depend on the threading. */
+  const size_t hashes_size = sizeof(uint32_t) * (size_t)chunks_num;
+  const uint64_t hash_low = BLI_hash_mm2((const unsigned char *)ctx.chunk_hashes, hashes_size, 0);
+  const uint64_t hash_high = BLI_hash_mm2(
+      (const unsigned char *)ctx.chunk_hashes, hashes_size, 0x9E3779B9);
+  MEM_freeN(ctx.chunk_hashes);
+
+  const uint64_t hash = (hash_high << 32) | hash_low;
+  return hash != 0 ? hash : 1;
+}
+
+/** \} */
+
 void BKE_subdiv_converter_init_for_mesh(struct OpenSubdiv_Converter *converter,
                                         const SubdivSettings *settings,
                                         const Mesh *mesh)
@@ -162,14 +162,8 @@ Subdiv *BKE_subsurf_modifier_subdiv_descriptor_ensure(SubsurfRuntimeData *runtim
                                                       const Mesh *mesh,
                                                       const bool for_draw_code)
 {
-  if (runtime_data->subdiv && runtime_data->set_by_draw_code != for_draw_code) {
-    BKE_subdiv_free(runtime_data->subdiv);
-    runtime_data->subdiv = nullptr;
-  }
-  Subdiv *subdiv = BKE_subdiv_update_from_mesh(
-      runtime_data->subdiv, &runtime_data->settings, mesh);
-  runtime_data->subdiv = subdiv;
-  runtime_data->set_by_draw_code = for_draw_code;
+  Subdiv *&subdiv = for_draw_code ? runtime_data->subdiv_gpu : runtime_data->subdiv_cpu;
+  subdiv = BKE_subdiv_update_from_mesh(subdiv, &runtime_data->settings, mesh);
   return subdiv;
 }
 
@@ -16,6 +16,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math.h"
 #include "BLI_math_color.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -688,6 +689,20 @@ bool BKE_texture_dependsOnTime(const struct Tex *texture)
 
 /* ------------------------------------------------------------------------- */
 
+static void texture_value_from_result(const int result_type, TexResult *texres)
+{
+  /* if the texture gave an RGB value, we assume it didn't give a valid
+   * intensity, since this is in the context of modifiers don't use perceptual color conversion.
+   * if the texture didn't give an RGB value, copy the intensity across
+   */
+  if (result_type & TEX_RGB) {
+    texres->tin = (1.0f / 3.0f) * (texres->trgba[0] + texres->trgba[1] + texres->trgba[2]);
+  }
+  else {
+    copy_v3_fl(texres->trgba, texres->tin);
+  }
+}
+
 void BKE_texture_get_value_ex(const Scene *scene,
                               Tex *texture,
                               const float *tex_co,
@@ -705,16 +720,7 @@ void BKE_texture_get_value_ex(const Scene *scene,
   /* no node textures for now */
   result_type = multitex_ext_safe(texture, tex_co, texres, pool, do_color_manage, false);
 
-  /* if the texture gave an RGB value, we assume it didn't give a valid
-   * intensity, since this is in the context of modifiers don't use perceptual color conversion.
-   * if the texture didn't give an RGB value, copy the intensity across
-   */
-  if (result_type & TEX_RGB) {
-    texres->tin = (1.0f / 3.0f) * (texres->trgba[0] + texres->trgba[1] + texres->trgba[2]);
-  }
-  else {
-    copy_v3_fl(texres->trgba, texres->tin);
-  }
+  texture_value_from_result(result_type, texres);
 }
 
 void BKE_texture_get_value(const Scene *scene,
@@ -726,6 +732,41 @@ void BKE_texture_get_value(const Scene *scene,
   BKE_texture_get_value_ex(scene, texture, tex_co, texres, nullptr, use_color_management);
 }
 
+void BKE_texture_get_values(const Scene *scene,
+                            Tex *texture,
+                            const float (*tex_co)[3],
+                            const int tex_co_num,
+                            TexResult *r_texres,
+                            struct ImagePool *pool,
+                            const bool use_color_management)
+{
+  using namespace blender;
+
+  /* Checked once for all coordinates instead of for every sample. */
+  const bool do_color_manage = scene && use_color_management &&
+                               BKE_scene_check_color_management_enabled(scene);
+
+  /* Without a pool every sample would acquire and release the image buffers, which locks. */
+  ImagePool *local_pool = nullptr;
+  if (pool == nullptr) {
+    local_pool = pool = BKE_image_pool_new();
+  }
+  BKE_texture_fetch_images_for_pool(texture, pool);
+
+  threading::parallel_for(IndexRange(tex_co_num), 512, [&](const IndexRange range) {
+    for (const int i : range) {
+      /* no node textures for now */
+      const int result_type = multitex_ext_safe(
+          texture, tex_co[i], &r_texres[i], pool, do_color_manage, false);
+      texture_value_from_result(result_type, &r_texres[i]);
+    }
+  });
+
+  if (local_pool) {
+    BKE_image_pool_free(local_pool);
+  }
+}
+
 static void texture_nodes_fetch_images_for_pool(Tex *texture,
                                                 bNodeTree *ntree,
                                                 struct ImagePool *pool)
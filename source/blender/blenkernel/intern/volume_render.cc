@@ -10,6 +10,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vec_types.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "DNA_volume_types.h"
@@ -70,6 +71,124 @@ static void extract_dense_float_voxels(const VolumeGridType grid_type,
   }
 }
 
+template<typename VoxelType, typename AccessorType>
+static VoxelType voxel_value_get(const AccessorType &accessor, const openvdb::Coord &coord)
+{
+  using ValueType = typename AccessorType::ValueType;
+  if constexpr (std::is_same_v<ValueType, openvdb::ValueMask>) {
+    return VoxelType(accessor.isValueOn(coord) ? 1.0f : 0.0f);
+  }
+  else {
+    return VoxelType(accessor.getValue(coord));
+  }
+}
+
+/**
+ * Fill a dense array where every voxel covers `factor^3` voxels of the grid, starting at
+ * `bbox.min()`. Each voxel is the average of the 8 grid voxels around its center, which is much
+ * cheaper than averaging all covered voxels and still avoids most aliasing for smooth grids.
+ */
+template<typename GridType, typename VoxelType>
+static void extract_downsampled_voxels(const openvdb::GridBase &grid,
+                                       const openvdb::CoordBBox bbox,
+                                       const int factor,
+                                       const int resolution[3],
+                                       VoxelType *r_voxels)
+{
+  BLI_assert(grid.isType<GridType>());
+  BLI_assert(factor >= 2);
+  const GridType &typed_grid = static_cast<const GridType &>(grid);
+  const openvdb::Coord min = bbox.min();
+  const int64_t slice_size = int64_t(resolution[0]) * int64_t(resolution[1]);
+
+  blender::threading::parallel_for(
+      blender::IndexRange(resolution[2]), 1, [&](const blender::IndexRange range) {
+        /* Accessors cache tree nodes and are not thread-safe, so every task uses its own. */
+        typename GridType::ConstAccessor accessor = typed_grid.getConstAccessor();
+        for (const int64_t z : range) {
+          VoxelType *slice = r_voxels + z * slice_size;
+          for (int y = 0; y < resolution[1]; y++) {
+            for (int x = 0; x < resolution[0]; x++) {
+              const openvdb::Coord center = min + openvdb::Coord(x * factor + factor / 2 - 1,
+                                                                 y * factor + factor / 2 - 1,
+                                                                 int(z) * factor + factor / 2 - 1);
+              VoxelType sum = voxel_value_get<VoxelType>(accessor, center);
+              for (int i = 1; i < 8; i++) {
+                const openvdb::Coord offset(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+                sum += voxel_value_get<VoxelType>(accessor, center + offset);
+              }
+              slice[y * resolution[0] + x] = sum * (1.0f / 8.0f);
+            }
+          }
+        }
+      });
+}
+
+static void extract_downsampled_float_voxels(const VolumeGridType grid_type,
+                                             const openvdb::GridBase &grid,
+                                             const openvdb::CoordBBox &bbox,
+                                             const int factor,
+                                             const int resolution[3],
+                                             float *r_voxels)
+{
+  openvdb::Vec3f *r_vector_voxels = reinterpret_cast<openvdb::Vec3f *>(r_voxels);
+  switch (grid_type) {
+    case VOLUME_GRID_BOOLEAN:
+      return extract_downsampled_voxels<openvdb::BoolGrid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_FLOAT:
+      return extract_downsampled_voxels<openvdb::FloatGrid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_DOUBLE:
+      return extract_downsampled_voxels<openvdb::DoubleGrid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_INT:
+      return extract_downsampled_voxels<openvdb::Int32Grid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_INT64:
+      return extract_downsampled_voxels<openvdb::Int64Grid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_MASK:
+      return extract_downsampled_voxels<openvdb::MaskGrid, float>(
+          grid, bbox, factor, resolution, r_voxels);
+    case VOLUME_GRID_VECTOR_FLOAT:
+      return extract_downsampled_voxels<openvdb::Vec3fGrid, openvdb::Vec3f>(
+          grid, bbox, factor, resolution, r_vector_voxels);
+    case VOLUME_GRID_VECTOR_DOUBLE:
+      return extract_downsampled_voxels<openvdb::Vec3dGrid, openvdb::Vec3f>(
+          grid, bbox, factor, resolution, r_vector_voxels);
+    case VOLUME_GRID_VECTOR_INT:
+      return extract_downsampled_voxels<openvdb::Vec3IGrid, openvdb::Vec3f>(
+          grid, bbox, factor, resolution, r_vector_voxels);
+    case VOLUME_GRID_POINTS:
+    case VOLUME_GRID_UNKNOWN:
+      /* Zero channels to copy. */
+      break;
+  }
+}
+
+/**
+ * Smallest integer factor the resolution has to be divided by to stay within the limits.
+ */
+static int dense_downsample_factor_get(const openvdb::Vec3i &resolution,
+                                       const int max_resolution,
+                                       const int64_t max_voxels)
+{
+  for (int factor = 1;; factor++) {
+    const openvdb::Vec3i downsampled = (resolution + openvdb::Vec3i(factor - 1)) / factor;
+    const int64_t voxels_num = int64_t(downsampled[0]) * int64_t(downsampled[1]) *
+                               int64_t(downsampled[2]);
+    const bool fits_resolution = max_resolution <= 0 ||
+                                 (downsampled[0] <= max_resolution &&
+                                  downsampled[1] <= max_resolution &&
+                                  downsampled[2] <= max_resolution);
+    const bool fits_voxels = max_voxels <= 0 || voxels_num <= max_voxels;
+    if ((fits_resolution && fits_voxels) || voxels_num == 1) {
+      return factor;
+    }
+  }
+}
+
 static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform,
                                             const openvdb::CoordBBox &bbox,
                                             float r_texture_to_object[4][4])
@@ -90,18 +209,22 @@ static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform
 
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const VolumeGrid *volume_grid,
+                                  const int max_resolution,
+                                  const int64_t max_voxels,
                                   DenseFloatVolumeGrid *r_dense_grid)
 {
 #ifdef WITH_OPENVDB
   const VolumeGridType grid_type = BKE_volume_grid_type(volume_grid);
   openvdb::GridBase::ConstPtr grid = BKE_volume_grid_openvdb_for_read(volume, volume_grid);
 
-  const openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
+  openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
   if (bbox.empty()) {
     return false;
   }
 
-  const openvdb::Vec3i resolution = bbox.dim().asVec3i();
+  const int factor = dense_downsample_factor_get(
+      bbox.dim().asVec3i(), max_resolution, max_voxels);
+  const openvdb::Vec3i resolution = (bbox.dim().asVec3i() + openvdb::Vec3i(factor - 1)) / factor;
   const int64_t num_voxels = int64_t(resolution[0]) * int64_t(resolution[1]) *
                              int64_t(resolution[2]);
   const int channels = BKE_volume_grid_channels(volume_grid);
@@ -111,7 +234,14 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
     return false;
   }
 
-  extract_dense_float_voxels(grid_type, *grid, bbox, voxels);
+  if (factor == 1) {
+    extract_dense_float_voxels(grid_type, *grid, bbox, voxels);
+  }
+  else {
+    extract_downsampled_float_voxels(grid_type, *grid, bbox, factor, resolution.asV(), voxels);
+    /* The downsampled voxels may extend past the active voxels. */
+    bbox.max() = bbox.min() + openvdb::Coord(resolution * factor) - openvdb::Coord(1);
+  }
   create_texture_to_object_matrix(grid->transform().baseMap()->getAffineMap()->getMat4(),
                                   bbox,
                                   r_dense_grid->texture_to_object);
@@ -121,7 +251,7 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
   return true;
 #endif
-  UNUSED_VARS(volume, volume_grid, r_dense_grid);
+  UNUSED_VARS(volume, volume_grid, max_resolution, max_voxels, r_dense_grid);
   return false;
 }
 
@@ -45,6 +45,7 @@
 #  include <libavutil/channel_layout.h>
 #  include <libavutil/imgutils.h>
 #  include <libavutil/opt.h>
+#  include <libavutil/pixdesc.h>
 #  include <libavutil/rational.h>
 #  include <libavutil/samplefmt.h>
 #  include <libswscale/swscale.h>
@@ -93,9 +94,27 @@ typedef struct FFMpegContext {
 #  ifdef WITH_AUDASPACE
   AUD_Device *audio_mixdown_device;
 #  endif
+
+  /* Frames are converted and encoded on a separate thread, so rendering of the next frame doesn't
+   * wait for the encoder. Jobs cycle between the free and pending queues. */
+  struct FFMpegEncodeJob *encode_jobs;
+  ThreadQueue *encode_free_queue;
+  ThreadQueue *encode_pending_queue;
+  ListBase encode_threads;
+  bool encode_error;
 } FFMpegContext;
 
+/* A frame handed over to the encoder thread. */
+typedef struct FFMpegEncodeJob {
+  /* Rendered pixels in Blender's own pixel format. */
+  AVFrame *rgb_frame;
+  /* Audio is written up to this time after the frame, to keep the streams interleaved. */
+  double audio_to_pts;
+} FFMpegEncodeJob;
+
 #  define FFMPEG_AUTOSPLIT_SIZE 2000000000
+/* Number of rendered frames that can wait for the encoder thread. */
+#  define FFMPEG_ENCODE_QUEUE_SIZE 3
 
 #  define PRINT \
     if (G.debug & G_DEBUG_FFMPEG) \
@@ -367,24 +386,10 @@ static int write_video_frame(FFMpegContext *context, AVFrame *frame, ReportList
   return success;
 }
 
-/* read and encode a frame of video from the buffer */
-static AVFrame *generate_video_frame(FFMpegContext *context, const uint8_t *pixels)
+/* Copy the Blender pixels into the FFmpeg datastructure, taking care of endianness and flipping
+ * the image vertically. */
+static void fill_rgb_frame(AVFrame *rgb_frame, const uint8_t *pixels, int height)
 {
-  AVCodecParameters *codec = context->video_stream->codecpar;
-  int height = codec->height;
-  AVFrame *rgb_frame;
-
-  if (context->img_convert_frame != NULL) {
-    /* Pixel format conversion is needed. */
-    rgb_frame = context->img_convert_frame;
-  }
-  else {
-    /* The output pixel format is Blender's internal pixel format. */
-    rgb_frame = context->current_frame;
-  }
-
-  /* Copy the Blender pixels into the FFmpeg datastructure, taking care of endianness and flipping
-   * the image vertically. */
   int linesize = rgb_frame->linesize[0];
   for (int y = 0; y < height; y++) {
     uint8_t *target = rgb_frame->data[0] + linesize * (height - y - 1);
@@ -408,22 +413,44 @@ static AVFrame *generate_video_frame(FFMpegContext *context, const uint8_t *pixe
 #    error ENDIAN_ORDER should either be L_ENDIAN or B_ENDIAN.
 #  endif
   }
+}
 
-  /* Convert to the output pixel format, if it's different that Blender's internal one. */
-  if (context->img_convert_frame != NULL) {
-    BLI_assert(context->img_convert_ctx != NULL);
-    sws_scale(context->img_convert_ctx,
-              (const uint8_t *const *)rgb_frame->data,
-              rgb_frame->linesize,
-              0,
-              codec->height,
-              context->current_frame->data,
-              context->current_frame->linesize);
+/* Convert to the output pixel format, if it's different that Blender's internal one. Returns the
+ * frame to pass to the encoder. */
+static AVFrame *convert_rgb_frame(FFMpegContext *context, AVFrame *rgb_frame)
+{
+  if (context->img_convert_ctx == NULL) {
+    return rgb_frame;
   }
 
+  sws_scale(context->img_convert_ctx,
+            (const uint8_t *const *)rgb_frame->data,
+            rgb_frame->linesize,
+            0,
+            context->video_stream->codecpar->height,
+            context->current_frame->data,
+            context->current_frame->linesize);
   return context->current_frame;
 }
 
+/* read and encode a frame of video from the buffer */
+static AVFrame *generate_video_frame(FFMpegContext *context, const uint8_t *pixels)
+{
+  AVFrame *rgb_frame;
+
+  if (context->img_convert_frame != NULL) {
+    /* Pixel format conversion is needed. */
+    rgb_frame = context->img_convert_frame;
+  }
+  else {
+    /* The output pixel format is Blender's internal pixel format. */
+    rgb_frame = context->current_frame;
+  }
+
+  fill_rgb_frame(rgb_frame, pixels, context->video_stream->codecpar->height);
+  return convert_rgb_frame(context, rgb_frame);
+}
+
 static AVRational calc_time_base(uint den, double num, int codec_id)
 {
   /* Convert the input 'num' to an integer. Simply shift the decimal places until we get an integer
@@ -666,6 +693,50 @@ static const AVCodec *get_av1_encoder(
 
 /* prepare a video stream for the output file */
 
+/* First pixel format of the codec that isn't an opaque hardware frame format. */
+static enum AVPixelFormat get_software_pix_fmt(const AVCodec *codec)
+{
+  for (const enum AVPixelFormat *p = codec->pix_fmts; *p != AV_PIX_FMT_NONE; p++) {
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get(*p);
+    if ((desc->flags & AV_PIX_FMT_FLAG_HWACCEL) == 0) {
+      return *p;
+    }
+  }
+  return codec->pix_fmts[0];
+}
+
+/* Find a hardware encoder for the codec that can actually be opened on this system, encoders are
+ * often built into FFmpeg without a device that supports them. */
+static const AVCodec *get_hw_encoder(int codec_id, int rectx, int recty)
+{
+  static const char *h264_encoders[] = {"h264_nvenc", "h264_qsv", "h264_videotoolbox", NULL};
+
+  if (codec_id != AV_CODEC_ID_H264) {
+    return NULL;
+  }
+
+  for (int i = 0; h264_encoders[i] != NULL; i++) {
+    const AVCodec *codec = avcodec_find_encoder_by_name(h264_encoders[i]);
+    if (codec == NULL || codec->pix_fmts == NULL) {
+      continue;
+    }
+
+    AVCodecContext *c = avcodec_alloc_context3(codec);
+    c->width = rectx;
+    c->height = recty;
+    c->time_base = (AVRational){1, 25};
+    c->pix_fmt = get_software_pix_fmt(codec);
+    const bool is_available = avcodec_open2(c, codec, NULL) >= 0;
+    avcodec_free_context(&c);
+
+    if (is_available) {
+      PRINT("Using hardware encoder %s\n", codec->name);
+      return codec;
+    }
+  }
+  return NULL;
+}
+
 static AVStream *alloc_video_stream(FFMpegContext *context,
                                     RenderData *rd,
                                     int codec_id,
@@ -678,6 +749,7 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
   AVStream *st;
   const AVCodec *codec;
   AVDictionary *opts = NULL;
+  bool is_hw_encoder = false;
 
   error[0] = '\0';
 
@@ -695,7 +767,15 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
     codec = get_av1_encoder(context, rd, &opts, rectx, recty);
   }
   else {
-    codec = avcodec_find_encoder(codec_id);
+    codec = NULL;
+    /* Lossless output needs 4:4:4 sampling, which hardware encoders don't reliably support. */
+    if ((rd->ffcodecdata.flags & FFMPEG_USE_HW_ENCODER) && context->ffmpeg_crf != 0) {
+      codec = get_hw_encoder(codec_id, rectx, recty);
+      is_hw_encoder = codec != NULL;
+    }
+    if (!codec) {
+      codec = avcodec_find_encoder(codec_id);
+    }
   }
   if (!codec) {
     fprintf(stderr, "Couldn't find valid video codec\n");
@@ -754,6 +834,11 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
      * We don't care about bit rate in crf mode. */
     c->bit_rate = 0;
     ffmpeg_dict_set_int(&opts, "crf", context->ffmpeg_crf);
+    if (is_hw_encoder) {
+      /* Constant quality options of NVENC and Quick Sync, on the same scale as CRF. */
+      ffmpeg_dict_set_int(&opts, "cq", context->ffmpeg_crf);
+      c->global_quality = context->ffmpeg_crf;
+    }
   }
   else {
     c->bit_rate = context->ffmpeg_video_bitrate * 1000;
@@ -785,8 +870,9 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
         printf("Unknown preset number %i, ignoring.\n", context->ffmpeg_preset);
     }
     /* "codec_id != AV_CODEC_ID_AV1" is required due to "preset" already being set by an AV1 codec.
+     * Hardware encoders have their own preset names, which x264 ones would fail to parse as.
      */
-    if (preset_name != NULL && codec_id != AV_CODEC_ID_AV1) {
+    if (preset_name != NULL && codec_id != AV_CODEC_ID_AV1 && !is_hw_encoder) {
       av_dict_set(&opts, "preset", preset_name, 0);
     }
     if (deadline_name != NULL) {
@@ -797,7 +883,7 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
   /* Be sure to use the correct pixel format(e.g. RGB, YUV) */
 
   if (codec->pix_fmts) {
-    c->pix_fmt = codec->pix_fmts[0];
+    c->pix_fmt = get_software_pix_fmt(codec);
   }
   else {
     /* makes HuffYUV happy ... */
@@ -1499,6 +1585,90 @@ static void write_audio_frames(FFMpegContext *context, double to_pts)
 }
 #  endif
 
+static void *ffmpeg_encode_thread(void *context_v)
+{
+  FFMpegContext *context = context_v;
+  FFMpegEncodeJob *job;
+
+  while ((job = BLI_thread_queue_pop(context->encode_pending_queue))) {
+    AVFrame *avframe = convert_rgb_frame(context, job->rgb_frame);
+    if (write_video_frame(context, avframe, NULL) != 1) {
+      context->encode_error = true;
+    }
+#  ifdef WITH_AUDASPACE
+    write_audio_frames(context, job->audio_to_pts);
+#  endif
+    BLI_thread_queue_push(context->encode_free_queue, job);
+  }
+
+  return NULL;
+}
+
+static void ffmpeg_encode_thread_start(FFMpegContext *context)
+{
+  AVCodecParameters *codec = context->video_stream->codecpar;
+
+  context->encode_jobs = MEM_calloc_arrayN(
+      FFMPEG_ENCODE_QUEUE_SIZE, sizeof(FFMpegEncodeJob), "FFMpegEncodeJob");
+  context->encode_free_queue = BLI_thread_queue_init();
+  context->encode_pending_queue = BLI_thread_queue_init();
+  context->encode_error = false;
+
+  for (int i = 0; i < FFMPEG_ENCODE_QUEUE_SIZE; i++) {
+    FFMpegEncodeJob *job = &context->encode_jobs[i];
+    job->rgb_frame = alloc_picture(AV_PIX_FMT_RGBA, codec->width, codec->height);
+    BLI_thread_queue_push(context->encode_free_queue, job);
+  }
+
+  BLI_threadpool_init(&context->encode_threads, ffmpeg_encode_thread, 1);
+  BLI_threadpool_insert(&context->encode_threads, context);
+}
+
+/* Wait for all queued frames to be encoded and stop the encoder thread. */
+static void ffmpeg_encode_thread_end(FFMpegContext *context)
+{
+  if (context->encode_pending_queue == NULL) {
+    return;
+  }
+
+  BLI_thread_queue_nowait(context->encode_pending_queue);
+  BLI_threadpool_end(&context->encode_threads);
+
+  for (int i = 0; i < FFMPEG_ENCODE_QUEUE_SIZE; i++) {
+    delete_picture(context->encode_jobs[i].rgb_frame);
+  }
+  MEM_freeN(context->encode_jobs);
+  context->encode_jobs = NULL;
+
+  BLI_thread_queue_free(context->encode_free_queue);
+  BLI_thread_queue_free(context->encode_pending_queue);
+  context->encode_free_queue = NULL;
+  context->encode_pending_queue = NULL;
+}
+
+/* Hand the frame over to the encoder thread, waiting only when all queued frames are in use. */
+static int ffmpeg_encode_thread_append(FFMpegContext *context,
+                                       const uint8_t *pixels,
+                                       double audio_to_pts,
+                                       ReportList *reports)
+{
+  if (context->encode_pending_queue == NULL) {
+    ffmpeg_encode_thread_start(context);
+  }
+
+  FFMpegEncodeJob *job = BLI_thread_queue_pop(context->encode_free_queue);
+  if (context->encode_error) {
+    BLI_thread_queue_push(context->encode_free_queue, job);
+    BKE_report(reports, RPT_ERROR, "Error writing frame");
+    return 0;
+  }
+
+  fill_rgb_frame(job->rgb_frame, pixels, context->video_stream->codecpar->height);
+  job->audio_to_pts = audio_to_pts;
+  BLI_thread_queue_push(context->encode_pending_queue, job);
+  return 1;
+}
+
 int BKE_ffmpeg_append(void *context_v,
                       RenderData *rd,
                       int start_frame,
@@ -1515,7 +1685,14 @@ int BKE_ffmpeg_append(void *context_v,
 
   PRINT("Writing frame %i, render width=%d, render height=%d\n", frame, rectx, recty);
 
-  if (context->video_stream) {
+  /* Autosplit has to check the file size after every frame, so it encodes synchronously. */
+  if (context->video_stream && !context->ffmpeg_autosplit) {
+    /* Add +1 frame because we want to encode audio up until the next video frame. */
+    const double audio_to_pts = (frame - start_frame + 1) /
+                                (((double)rd->frs_sec) / (double)rd->frs_sec_base);
+    success = ffmpeg_encode_thread_append(context, (uchar *)pixels, audio_to_pts, reports);
+  }
+  else if (context->video_stream) {
     avframe = generate_video_frame(context, (uchar *)pixels);
     success = (avframe && write_video_frame(context, avframe, reports));
 #  ifdef WITH_AUDASPACE
@@ -1543,6 +1720,9 @@ static void end_ffmpeg_impl(FFMpegContext *context, int is_autosplit)
 {
   PRINT("Closing ffmpeg...\n");
 
+  /* Finish encoding queued frames, this also writes their audio. */
+  ffmpeg_encode_thread_end(context);
+
 #  ifdef WITH_AUDASPACE
   if (is_autosplit == false) {
     if (context->audio_mixdown_device) {
@@ -9,6 +9,7 @@
  */
 
 #include <optional>
+#include <type_traits>
 
 #include "BLI_bounds_types.hh"
 #include "BLI_math_vector.hh"
@@ -16,11 +17,19 @@
 
 namespace blender::bounds {
 
+namespace detail {
+/** Implementation for positions that uses SIMD instructions, see `math_batch.cc`. */
+std::optional<Bounds<float3>> min_max_float3(Span<float3> values);
+}  // namespace detail
+
 /**
  * Find the smallest and largest values element-wise in the span.
  */
 template<typename T> static std::optional<Bounds<T>> min_max(Span<T> values)
 {
+  if constexpr (std::is_same_v<T, float3>) {
+    return detail::min_max_float3(values);
+  }
   if (values.is_empty()) {
     return std::nullopt;
   }
@@ -0,0 +1,354 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Hash tables that can be modified from multiple threads at the same time.
+ *
+ * #ConcurrentMap and #ConcurrentSet are meant for parallel algorithms that would otherwise have to
+ * partition their data into many thread local or per-bucket hash tables. When TBB is available,
+ * they wrap its concurrent containers, which use fine grained locking for maps and lock-free
+ * insertion for sets. Otherwise a fixed number of #Map and #Set shards, each protected by its own
+ * mutex, is used.
+ *
+ * The iteration order is not deterministic. Algorithms that have to give the same result on every
+ * run have to sort the result or derive indices from something other than the insertion order.
+ */
+
+#ifdef WITH_TBB
+/* Quiet top level deprecation message, unrelated to API usage here. */
+#  if defined(WIN32) && !defined(NOMINMAX)
+/* TBB includes Windows.h which will define min/max macros causing issues
+ * when we try to use std::min and std::max later on. */
+#    define NOMINMAX
+#    define TBB_MIN_MAX_CLEANUP
+#  endif
+#  include <tbb/concurrent_hash_map.h>
+#  include <tbb/concurrent_unordered_set.h>
+#  ifdef WIN32
+/* We cannot keep this defined, since other parts of the code deal with this on their own, leading
+ * to multiple define warnings unless we un-define this, however we can only undefine this if we
+ * were the ones that made the definition earlier. */
+#    ifdef TBB_MIN_MAX_CLEANUP
+#      undef NOMINMAX
+#    endif
+#  endif
+#endif
+
+#include <array>
+#include <mutex>
+
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender::threading {
+
+namespace concurrent_map_utils {
+
+/** Number of shards used when TBB is not available. Has to be a power of two. */
+constexpr int64_t shards_num = 64;
+
+/**
+ * The shards are selected with the high bits of the hash, because the low bits are used to find
+ * the slot within a shard.
+ */
+inline int64_t shard_index(const uint64_t hash)
+{
+  return int64_t(((hash * 0x9E3779B97F4A7C15LLU) >> 32) & uint64_t(shards_num - 1));
+}
+
+/** Adapts Blender's hash and equality functors to the interface that TBB expects. */
+template<typename Key, typename Hash, typename IsEqual> struct TBBHashCompare {
+  size_t hash(const Key &key) const
+  {
+    return size_t(Hash{}(key));
+  }
+
+  bool equal(const Key &a, const Key &b) const
+  {
+    return IsEqual{}(a, b);
+  }
+
+  size_t operator()(const Key &key) const
+  {
+    return this->hash(key);
+  }
+
+  bool operator()(const Key &a, const Key &b) const
+  {
+    return this->equal(a, b);
+  }
+};
+
+}  // namespace concurrent_map_utils
+
+/**
+ * A map that supports adding, looking up and removing keys from multiple threads at the same time.
+ * Values are only accessed within callbacks, during which the corresponding key is locked, so any
+ * other thread accessing the same key waits until the callback has finished.
+ *
+ * The value type has to be default constructible.
+ */
+template<typename Key,
+         typename Value,
+         typename Hash = DefaultHash<Key>,
+         typename IsEqual = DefaultEquality<Key>>
+class ConcurrentMap : NonCopyable, NonMovable {
+#ifdef WITH_TBB
+
+ private:
+  using HashCompare = concurrent_map_utils::TBBHashCompare<Key, Hash, IsEqual>;
+  using TBBMap = tbb::concurrent_hash_map<Key, Value, HashCompare>;
+  TBBMap map_;
+
+ public:
+  /**
+   * Add the key with the value returned by `create_value` if it does not exist yet, otherwise call
+   * `modify_value` with a reference to the existing value. Returns true when the key was added.
+   */
+  template<typename CreateValueF, typename ModifyValueF>
+  bool add_or_modify(const Key &key,
+                     const CreateValueF &create_value,
+                     const ModifyValueF &modify_value)
+  {
+    typename TBBMap::accessor accessor;
+    if (map_.insert(accessor, key)) {
+      accessor->second = create_value();
+      return true;
+    }
+    modify_value(accessor->second);
+    return false;
+  }
+
+  /**
+   * Call the function with a const reference to the value of the key, when it exists. Multiple
+   * threads can look up the same key at the same time. Returns true when the key exists.
+   */
+  template<typename Fn> bool lookup_cb(const Key &key, const Fn &fn) const
+  {
+    typename TBBMap::const_accessor accessor;
+    if (map_.find(accessor, key)) {
+      fn(accessor->second);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * Remove the key from the map. Returns true when the key existed.
+   */
+  bool remove(const Key &key)
+  {
+    return map_.erase(key);
+  }
+
+  /**
+   * Call the function for every key and value. Not thread-safe with respect to other changes.
+   */
+  template<typename Fn> void foreach_item(const Fn &fn)
+  {
+    for (auto &item : map_) {
+      fn(item.first, item.second);
+    }
+  }
+
+  /**
+   * Not thread-safe with respect to other changes.
+   */
+  int64_t size() const
+  {
+    return int64_t(map_.size());
+  }
+
+#else /* WITH_TBB */
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    Map<Key, Value, 0, DefaultProbingStrategy, Hash, IsEqual> map;
+  };
+  std::array<Shard, concurrent_map_utils::shards_num> shards_;
+
+  Shard &get_shard(const Key &key)
+  {
+    return shards_[concurrent_map_utils::shard_index(Hash{}(key))];
+  }
+
+  const Shard &get_shard(const Key &key) const
+  {
+    return shards_[concurrent_map_utils::shard_index(Hash{}(key))];
+  }
+
+ public:
+  template<typename CreateValueF, typename ModifyValueF>
+  bool add_or_modify(const Key &key,
+                     const CreateValueF &create_value,
+                     const ModifyValueF &modify_value)
+  {
+    Shard &shard = this->get_shard(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.add_or_modify(
+        key,
+        [&](Value *value) {
+          new (value) Value(create_value());
+          return true;
+        },
+        [&](Value *value) {
+          modify_value(*value);
+          return false;
+        });
+  }
+
+  template<typename Fn> bool lookup_cb(const Key &key, const Fn &fn) const
+  {
+    const Shard &shard = this->get_shard(key);
+    std::lock_guard lock{shard.mutex};
+    if (const Value *value = shard.map.lookup_ptr(key)) {
+      fn(*value);
+      return true;
+    }
+    return false;
+  }
+
+  bool remove(const Key &key)
+  {
+    Shard &shard = this->get_shard(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.map.remove(key);
+  }
+
+  template<typename Fn> void foreach_item(const Fn &fn)
+  {
+    for (Shard &shard : shards_) {
+      for (auto item : shard.map.items()) {
+        fn(item.key, item.value);
+      }
+    }
+  }
+
+  int64_t size() const
+  {
+    int64_t size = 0;
+    for (const Shard &shard : shards_) {
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+#endif /* WITH_TBB */
+
+  /**
+   * Add the key-value pair if the key does not exist yet. Returns true when it was added.
+   */
+  bool add(const Key &key, const Value &value)
+  {
+    return this->add_or_modify(
+        key, [&]() { return value; }, [](Value & /*value*/) {});
+  }
+
+  bool contains(const Key &key) const
+  {
+    return this->lookup_cb(key, [](const Value & /*value*/) {});
+  }
+};
+
+/**
+ * A set that supports adding keys from multiple threads at the same time. Keys cannot be removed,
+ * which allows the TBB implementation to insert without locking.
+ */
+template<typename Key, typename Hash = DefaultHash<Key>, typename IsEqual = DefaultEquality<Key>>
+class ConcurrentSet : NonCopyable, NonMovable {
+#ifdef WITH_TBB
+
+ private:
+  using HashCompare = concurrent_map_utils::TBBHashCompare<Key, Hash, IsEqual>;
+  tbb::concurrent_unordered_set<Key, HashCompare, HashCompare> set_;
+
+ public:
+  /**
+   * Add the key if it does not exist yet. Returns true when it was added.
+   */
+  bool add(const Key &key)
+  {
+    return set_.insert(key).second;
+  }
+
+  bool contains(const Key &key) const
+  {
+    return set_.count(key) > 0;
+  }
+
+  /**
+   * Call the function for every key. Not thread-safe with respect to concurrent insertion.
+   */
+  template<typename Fn> void foreach_key(const Fn &fn) const
+  {
+    for (const Key &key : set_) {
+      fn(key);
+    }
+  }
+
+  int64_t size() const
+  {
+    return int64_t(set_.size());
+  }
+
+#else /* WITH_TBB */
+
+ private:
+  struct alignas(64) Shard {
+    mutable std::mutex mutex;
+    Set<Key, 0, DefaultProbingStrategy, Hash, IsEqual> set;
+  };
+  std::array<Shard, concurrent_map_utils::shards_num> shards_;
+
+  Shard &get_shard(const Key &key)
+  {
+    return shards_[concurrent_map_utils::shard_index(Hash{}(key))];
+  }
+
+  const Shard &get_shard(const Key &key) const
+  {
+    return shards_[concurrent_map_utils::shard_index(Hash{}(key))];
+  }
+
+ public:
+  bool add(const Key &key)
+  {
+    Shard &shard = this->get_shard(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.set.add(key);
+  }
+
+  bool contains(const Key &key) const
+  {
+    const Shard &shard = this->get_shard(key);
+    std::lock_guard lock{shard.mutex};
+    return shard.set.contains(key);
+  }
+
+  template<typename Fn> void foreach_key(const Fn &fn) const
+  {
+    for (const Shard &shard : shards_) {
+      for (const Key &key : shard.set) {
+        fn(key);
+      }
+    }
+  }
+
+  int64_t size() const
+  {
+    int64_t size = 0;
+    for (const Shard &shard : shards_) {
+      size += shard.set.size();
+    }
+    return size;
+  }
+
+#endif /* WITH_TBB */
+};
+
+}  // namespace blender::threading
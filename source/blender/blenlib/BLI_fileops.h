@@ -244,6 +244,15 @@ size_t BLI_file_zstd_from_mem_at_pos(void *buf,
                                      int compression_level) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 size_t BLI_file_unzstd_to_mem_at_pos(void *buf, size_t len, FILE *file, size_t file_offset)
     ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+/**
+ * Decompress `Zstd` frames that are already in memory, e.g. in a memory-mapped file. Unlike
+ * #BLI_file_unzstd_to_mem_at_pos the data is decompressed in one go, without copying it through
+ * intermediate stream buffers.
+ *
+ * eturn The size of the decompressed data, zero on failure.
+ */
+size_t BLI_file_unzstd_from_mem(void *buf, size_t len, const void *src, size_t src_len)
+    ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 bool BLI_file_magic_is_zstd(const char header[4]);
 
 /**
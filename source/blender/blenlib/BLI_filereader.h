@@ -30,12 +30,20 @@ struct FileReader;
 typedef ssize_t (*FileReaderReadFn)(struct FileReader *reader, void *buffer, size_t size);
 typedef off64_t (*FileReaderSeekFn)(struct FileReader *reader, off64_t offset, int whence);
 typedef void (*FileReaderCloseFn)(struct FileReader *reader);
+typedef const void *(*FileReaderPeekFn)(struct FileReader *reader, off64_t offset, size_t size);
 
 /** General structure for all #FileReaders, implementations add custom fields at the end. */
 typedef struct FileReader {
   FileReaderReadFn read;
   FileReaderSeekFn seek;
   FileReaderCloseFn close;
+  /**
+   * Optional, only set by readers that have the whole (uncompressed) file in memory.
+   * Returns a pointer to `size` bytes at `offset` without copying them, or NULL when the range
+   * is out of bounds. The pointer stays valid until the reader is closed, the offset of the
+   * reader is not changed.
+   */
+  FileReaderPeekFn peek;
 
   off64_t offset;
 } FileReader;
@@ -57,6 +65,13 @@ FileReader *BLI_filereader_new_memory(const void *data, size_t len) ATTR_WARN_UN
     ATTR_NONNULL();
 /** Create #FileReader from applying `Zstd` decompression on an underlying file. */
 FileReader *BLI_filereader_new_zstd(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
+/**
+ * Same as #BLI_filereader_new_zstd, but for files with a seek table the frames ahead of the
+ * read position are decompressed in parallel using the task scheduler.
+ * Use for large sequential reads, the task scheduler has to be initialized.
+ */
+FileReader *BLI_filereader_new_zstd_parallel(FileReader *base) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 /** Create #FileReader from applying `Gzip` decompression on an underlying file. */
 FileReader *BLI_filereader_new_gzip(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 
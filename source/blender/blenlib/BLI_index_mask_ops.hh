@@ -22,6 +22,34 @@ IndexMask find_indices_based_on_predicate__merge(
     IndexMask indices_to_check,
     threading::EnumerableThreadSpecific<Vector<Vector<int64_t>>> &sub_masks,
     Vector<int64_t> &r_indices);
+
+/**
+ * Append the indices in #mask for which the predicate is true. Every index is written to a small
+ * stack buffer and the write position only advances when the predicate is true. This avoids a
+ * hard to predict branch per index and a reallocation check per appended index, and the final
+ * vector only grows with the number of selected indices.
+ *
+ * \param mask: Either an #IndexRange or a #Span<int64_t>. The predicate gets the position in the
+ * mask and the index itself.
+ */
+template<typename MaskT, typename Predicate>
+inline void find_indices_based_on_predicate__chunk(const MaskT &mask,
+                                                   const Predicate &predicate,
+                                                   Vector<int64_t> &r_indices)
+{
+  constexpr int64_t buffer_size = 1024;
+  int64_t buffer[buffer_size];
+  for (int64_t start = 0; start < mask.size(); start += buffer_size) {
+    const int64_t size = std::min(buffer_size, mask.size() - start);
+    int64_t count = 0;
+    for (const int64_t i : IndexRange(start, size)) {
+      const int64_t index = mask[i];
+      buffer[count] = index;
+      count += predicate(i, index) ? 1 : 0;
+    }
+    r_indices.extend(buffer, count);
+  }
+}
 }  // namespace detail
 
 /**
@@ -44,11 +72,12 @@ inline IndexMask find_indices_based_on_predicate(const IndexMask indices_to_chec
       indices_to_check.index_range(), parallel_grain_size, [&](const IndexRange range) {
         const IndexMask sub_mask = indices_to_check.slice(range);
         Vector<int64_t> masked_indices;
-        for (const int64_t i : sub_mask) {
-          if (predicate(i)) {
-            masked_indices.append(i);
-          }
-        }
+        sub_mask.to_best_mask_type([&](const auto &best_mask) {
+          detail::find_indices_based_on_predicate__chunk(
+              best_mask,
+              [&](const int64_t /*i*/, const int64_t index) { return predicate(index); },
+              masked_indices);
+        });
         if (!masked_indices.is_empty()) {
           sub_masks.local().append(std::move(masked_indices));
         }
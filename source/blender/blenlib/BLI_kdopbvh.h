@@ -124,6 +124,12 @@ typedef void (*BVHTree_NearestProjectedCallback)(void *userdata,
                                                  int clip_plane_len,
                                                  BVHTreeNearest *nearest);
 
+/**
+ * Callback to get the new coordinates of an element when refitting a tree, see
+ * #BLI_bvhtree_refit. Writes up to three points and returns how many were written.
+ */
+typedef int (*BVHTree_RefitCallback)(void *userdata, int index, float r_co[3][3]);
+
 /* callbacks to BLI_bvhtree_walk_dfs */
 
 /**
@@ -165,6 +171,15 @@ bool BLI_bvhtree_update_node(
  * Call #BLI_bvhtree_update_node() first for every node/point/triangle.
  */
 void BLI_bvhtree_update_tree(BVHTree *tree);
+/**
+ * Recompute the bounds of all leaves with the coordinates returned by the callback, and then of
+ * all branches. The structure of the tree is kept, so this is much cheaper than building a new
+ * tree when the elements have only moved, e.g. for deformed meshes. Queries stay correct, though
+ * they may become slower when the elements moved a lot relative to each other.
+ *
+ * The callback is called from multiple threads for large trees.
+ */
+void BLI_bvhtree_refit(BVHTree *tree, BVHTree_RefitCallback callback, void *userdata);
 
 /**
  * Use to check the total number of threads #BLI_bvhtree_overlap will use.
@@ -225,6 +240,19 @@ int BLI_bvhtree_find_nearest(BVHTree *tree,
                              BVHTreeNearest *nearest,
                              BVHTree_NearestPointCallback callback,
                              void *userdata);
+/**
+ * Same as #BLI_bvhtree_find_nearest_ex for many points, which are processed in parallel.
+ * Every element of \a nearest has to be initialized like the argument of the single point
+ * version, and receives the result for the point with the same index.
+ * The callback has to be thread-safe.
+ */
+void BLI_bvhtree_find_nearest_batch(BVHTree *tree,
+                                    const float (*co)[3],
+                                    int points_num,
+                                    BVHTreeNearest *nearest,
+                                    BVHTree_NearestPointCallback callback,
+                                    void *userdata,
+                                    int flag);
 
 /**
  * Find the first node nearby.
@@ -251,6 +279,21 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
                          BVHTreeRayHit *hit,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
+/**
+ * Same as #BLI_bvhtree_ray_cast_ex for many rays, which are processed in parallel.
+ * Every element of \a hits has to be initialized like the argument of the single ray version,
+ * and receives the result for the ray with the same index.
+ * The callback has to be thread-safe.
+ */
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*co)[3],
+                                const float (*dir)[3],
+                                int rays_num,
+                                float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                int flag);
 
 /**
  * Calls the callback for every ray intersection
@@ -0,0 +1,45 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Operations on large arrays of vectors, e.g. the positions of a mesh or a point cloud.
+ *
+ * The functions are multi-threaded and use SIMD instructions when available (SSE2, or NEON through
+ * `sse2neon`), so they should be preferred over calling the per-element operation in a loop.
+ * The results are the same as when the per-element function is used, except for floating point
+ * rounding differences.
+ */
+
+#include "BLI_float3x3.hh"
+#include "BLI_float4x4.hh"
+#include "BLI_math_vec_types.hh"
+#include "BLI_span.hh"
+
+namespace blender::math {
+
+/**
+ * Transform all points by the matrix, including its translation, like `transform * point`.
+ */
+void transform_points(const float4x4 &transform, MutableSpan<float3> points);
+
+/**
+ * Same as above, but writes the result to a separate array with the same size. The source and
+ * destination may also be the same array.
+ */
+void transform_points(Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst);
+
+/**
+ * Multiply all directions by the matrix, like `transform * direction`. The result is not
+ * normalized.
+ */
+void transform_directions(const float3x3 &transform, MutableSpan<float3> directions);
+
+/**
+ * Normalize all vectors, see #math::normalize for the handling of zero length vectors.
+ */
+void normalize_span(MutableSpan<float3> vectors);
+
+}  // namespace blender::math
@@ -105,6 +105,13 @@ enum {
    * order of allocation when no chunks have been freed.
    */
   BLI_MEMPOOL_ALLOW_ITER = (1 << 0),
+  /**
+   * Allow allocating and freeing elements from multiple threads at the same time.
+   *
+   * \note Clearing, iterating and creating lookup tables still require that no other thread
+   * accesses the pool at the same time.
+   */
+  BLI_MEMPOOL_THREADSAFE = (1 << 1),
 };
 
 /**
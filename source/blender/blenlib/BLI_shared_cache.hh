@@ -59,6 +59,22 @@ template<typename T> class SharedCache {
   }
 
   /** Retrieve the cached data. */
+  /**
+   * Set the cached data directly, for when it is known without doing the calculation, e.g. when
+   * the new value can be derived from the previous cached value. The cache is "un-shared" first.
+   */
+  void set(T data)
+  {
+    this->tag_dirty();
+    cache_->mutex.ensure([&]() { cache_->data = std::move(data); });
+  }
+
+  /** Return true if the data is computed and doesn't have to be recomputed by #ensure. */
+  bool is_cached() const
+  {
+    return cache_->mutex.is_cached();
+  }
+
   const T &data()
   {
     BLI_assert(cache_->mutex.is_cached());
@@ -8,10 +8,19 @@
 
 #ifdef WITH_TBB
 #  include <tbb/parallel_sort.h>
-#else
-#  include <algorithm>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "BLI_array.hh"
+#include "BLI_index_range.hh"
+#include "BLI_span.hh"
+#include "BLI_task.hh"
+
 namespace blender {
 
 #ifdef WITH_TBB
@@ -29,4 +38,284 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Parallel Stable Sort
+ *
+ * Merge sort that sorts chunks in parallel with #std::stable_sort and then merges them pairwise,
+ * also in parallel. Elements have to be default constructible and movable.
+ * \{ */
+
+template<typename RandomAccessIterator, typename Compare>
+void parallel_stable_sort(RandomAccessIterator begin,
+                          RandomAccessIterator end,
+                          const Compare &comp)
+{
+  using T = typename std::iterator_traits<RandomAccessIterator>::value_type;
+  const int64_t size = int64_t(end - begin);
+  /* Chunks have to be large enough that sorting them is much more expensive than starting a task,
+   * while there still have to be enough of them to keep all threads busy. */
+  const int64_t chunk_size = std::max<int64_t>(4096, size / 64);
+  if (size <= chunk_size) {
+    std::stable_sort(begin, end, comp);
+    return;
+  }
+
+  const int64_t chunks_num = (size + chunk_size - 1) / chunk_size;
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+    for (const int64_t chunk : range) {
+      const int64_t chunk_begin = chunk * chunk_size;
+      const int64_t chunk_end = std::min(chunk_begin + chunk_size, size);
+      std::stable_sort(begin + chunk_begin, begin + chunk_end, comp);
+    }
+  });
+
+  Array<T> buffer(size);
+  bool sorted_in_buffer = false;
+  for (int64_t width = chunk_size; width < size; width *= 2) {
+    const int64_t merges_num = (size + 2 * width - 1) / (2 * width);
+    threading::parallel_for(IndexRange(merges_num), 1, [&](const IndexRange range) {
+      for (const int64_t merge : range) {
+        const int64_t start = merge * 2 * width;
+        const int64_t mid = std::min(start + width, size);
+        const int64_t stop = std::min(start + 2 * width, size);
+        if (sorted_in_buffer) {
+          std::merge(std::make_move_iterator(buffer.begin() + start),
+                     std::make_move_iterator(buffer.begin() + mid),
+                     std::make_move_iterator(buffer.begin() + mid),
+                     std::make_move_iterator(buffer.begin() + stop),
+                     begin + start,
+                     comp);
+        }
+        else {
+          std::merge(std::make_move_iterator(begin + start),
+                     std::make_move_iterator(begin + mid),
+                     std::make_move_iterator(begin + mid),
+                     std::make_move_iterator(begin + stop),
+                     buffer.begin() + start,
+                     comp);
+        }
+      }
+    });
+    sorted_in_buffer = !sorted_in_buffer;
+  }
+
+  if (sorted_in_buffer) {
+    threading::parallel_for(IndexRange(size), 4096, [&](const IndexRange range) {
+      std::move(buffer.begin() + range.first(),
+                buffer.begin() + range.one_after_last(),
+                begin + range.first());
+    });
+  }
+}
+
+template<typename RandomAccessIterator>
+void parallel_stable_sort(RandomAccessIterator begin, RandomAccessIterator end)
+{
+  using T = typename std::iterator_traits<RandomAccessIterator>::value_type;
+  parallel_stable_sort(begin, end, std::less<T>());
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Parallel Radix Sort
+ *
+ * Least significant digit radix sort for integer and floating point values. It sorts in
+ * `O(n * sizeof(T))`, which is usually faster than comparison based sorting for large arrays.
+ * Floats are sorted by their total order, i.e. negative zero comes before positive zero, and NaN
+ * values are sorted to the ends depending on their sign bit.
+ * \{ */
+
+namespace sort_detail {
+
+template<typename T> struct RadixKey {
+  static_assert(std::is_arithmetic_v<T>, "Radix sort only supports integer and float types");
+  using UInt = std::conditional_t<
+      sizeof(T) == 1,
+      uint8_t,
+      std::conditional_t<sizeof(T) == 2,
+                         uint16_t,
+                         std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+  static constexpr UInt sign_bit = UInt(1) << (sizeof(T) * 8 - 1);
+
+  /** Map the value to an unsigned integer with the same order. */
+  static UInt get(const T value)
+  {
+    UInt bits;
+    memcpy(&bits, &value, sizeof(T));
+    if constexpr (std::is_floating_point_v<T>) {
+      return (bits & sign_bit) ? UInt(~bits) : UInt(bits | sign_bit);
+    }
+    else if constexpr (std::is_signed_v<T>) {
+      return UInt(bits ^ sign_bit);
+    }
+    else {
+      return bits;
+    }
+  }
+};
+
+}  // namespace sort_detail
+
+template<typename T> void parallel_radix_sort(MutableSpan<T> values)
+{
+  using Key = sort_detail::RadixKey<T>;
+  constexpr int64_t buckets_num = 256;
+  const int64_t size = values.size();
+  if (size < 1024) {
+    std::sort(values.begin(), values.end(), [](const T a, const T b) {
+      return Key::get(a) < Key::get(b);
+    });
+    return;
+  }
+
+  const int64_t chunk_size = std::max<int64_t>(16384, size / 64);
+  const int64_t chunks_num = (size + chunk_size - 1) / chunk_size;
+  const auto get_chunk = [&](const int64_t chunk) {
+    const int64_t start = chunk * chunk_size;
+    return IndexRange(start, std::min(chunk_size, size - start));
+  };
+  /* Number of values per bucket for every chunk, later converted to write offsets. */
+  Array<int64_t> chunk_offsets(chunks_num * buckets_num);
+
+  Array<T> buffer(size);
+  MutableSpan<T> src = values;
+  MutableSpan<T> dst = buffer;
+  for (int64_t pass = 0; pass < int64_t(sizeof(T)); pass++) {
+    const int shift = int(pass * 8);
+    chunk_offsets.fill(0);
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        MutableSpan<int64_t> counts = chunk_offsets.as_mutable_span().slice(
+            chunk * buckets_num, buckets_num);
+        for (const T value : src.slice(get_chunk(chunk))) {
+          counts[(Key::get(value) >> shift) & 0xFF]++;
+        }
+      }
+    });
+
+    /* Convert the counts to offsets. Values of a bucket are written in chunk order, which keeps
+     * the sort stable and makes it possible to do the passes one after another. */
+    int64_t offset = 0;
+    bool single_bucket = false;
+    for (const int64_t bucket : IndexRange(buckets_num)) {
+      const int64_t bucket_start = offset;
+      for (const int64_t chunk : IndexRange(chunks_num)) {
+        int64_t &value = chunk_offsets[chunk * buckets_num + bucket];
+        const int64_t count = value;
+        value = offset;
+        offset += count;
+      }
+      if (offset - bucket_start == size) {
+        single_bucket = true;
+      }
+    }
+    if (single_bucket) {
+      /* All values have the same digit, the pass would not change the order. */
+      continue;
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange range) {
+      for (const int64_t chunk : range) {
+        MutableSpan<int64_t> offsets = chunk_offsets.as_mutable_span().slice(
+            chunk * buckets_num, buckets_num);
+        for (const T value : src.slice(get_chunk(chunk))) {
+          dst[offsets[(Key::get(value) >> shift) & 0xFF]++] = value;
+        }
+      }
+    });
+    std::swap(src, dst);
+  }
+
+  if (src.data() != values.data()) {
+    values.copy_from(src);
+  }
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Group Indices by Key
+ *
+ * Counting sort of the indices `[0, size)` by an integer key in `[0, groups_num)`. The result is
+ * stored in the compressed form that is also used for e.g. vertex to corner maps: the indices of
+ * group `i` are `r_indices[r_offsets[i]]` to `r_indices[r_offsets[i + 1] - 1]`, in increasing
+ * order. `r_offsets` must have `groups_num + 1` elements and `r_indices` `size` elements.
+ * \{ */
+
+template<typename GetKeyFn>
+void group_indices_by_key(const int64_t size,
+                          const GetKeyFn &get_key,
+                          MutableSpan<int> r_offsets,
+                          MutableSpan<int> r_indices)
+{
+  BLI_assert(r_indices.size() == size);
+  BLI_assert(!r_offsets.is_empty());
+  const int64_t groups_num = r_offsets.size() - 1;
+  const IndexRange range(size);
+
+  if (size < 8192) {
+    r_offsets.fill(0);
+    for (const int64_t i : range) {
+      r_offsets[get_key(i)]++;
+    }
+    int offset = 0;
+    for (const int64_t group : IndexRange(groups_num)) {
+      const int count = r_offsets[group];
+      r_offsets[group] = offset;
+      offset += count;
+    }
+    r_offsets.last() = offset;
+    Array<int> counters(r_offsets.as_span().drop_back(1));
+    for (const int64_t i : range) {
+      r_indices[counters[get_key(i)]++] = int(i);
+    }
+    return;
+  }
+
+  Array<std::atomic<int>> counters(groups_num);
+  threading::parallel_for(IndexRange(groups_num), 4096, [&](const IndexRange groups) {
+    for (const int64_t group : groups) {
+      counters[group].store(0, std::memory_order_relaxed);
+    }
+  });
+  threading::parallel_for(range, 4096, [&](const IndexRange sub_range) {
+    for (const int64_t i : sub_range) {
+      counters[get_key(i)].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  int offset = 0;
+  for (const int64_t group : IndexRange(groups_num)) {
+    const int count = counters[group].load(std::memory_order_relaxed);
+    r_offsets[group] = offset;
+    counters[group].store(offset, std::memory_order_relaxed);
+    offset += count;
+  }
+  r_offsets.last() = offset;
+
+  threading::parallel_for(range, 4096, [&](const IndexRange sub_range) {
+    for (const int64_t i : sub_range) {
+      r_indices[counters[get_key(i)].fetch_add(1, std::memory_order_relaxed)] = int(i);
+    }
+  });
+
+  /* The order within each group depends on thread scheduling, sort to make it deterministic. */
+  threading::parallel_for(IndexRange(groups_num), 1024, [&](const IndexRange groups) {
+    for (const int64_t group : groups) {
+      std::sort(r_indices.begin() + r_offsets[group], r_indices.begin() + r_offsets[group + 1]);
+    }
+  });
+}
+
+inline void group_indices_by_key(const Span<int> keys,
+                                 MutableSpan<int> r_offsets,
+                                 MutableSpan<int> r_indices)
+{
+  group_indices_by_key(
+      keys.size(), [&](const int64_t i) { return keys[i]; }, r_offsets, r_indices);
+}
+
+/** \} */
+
 }  // namespace blender
@@ -433,6 +433,38 @@ void BLI_task_isolate(void (*func)(void *userdata), void *userdata);
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Task Arena
+ *
+ * Work executed in an arena is only run by the threads that joined that arena. All parallel
+ * loops and task pools started from inside #BLI_task_arena_execute stay in the arena, so their
+ * concurrency is bounded by the arena and they are scheduled with its priority.
+ *
+ * The interactive arena is the default one, used for depsgraph evaluation, drawing and all
+ * other work started from the main thread. The background arena is meant for long running jobs
+ * that should not starve interactive work: it runs with a lower priority and a limited number
+ * of threads, which can be set with #BLI_task_arena_background_concurrency_set.
+ * \{ */
+
+typedef enum eTaskArena {
+  TASK_ARENA_INTERACTIVE,
+  TASK_ARENA_BACKGROUND,
+} eTaskArena;
+
+/**
+ * Execute the function in the given arena. The calling thread joins the arena and blocks until
+ * the function has finished.
+ */
+void BLI_task_arena_execute(eTaskArena arena, void (*func)(void *userdata), void *userdata);
+/**
+ * Set the maximum number of threads used by #TASK_ARENA_BACKGROUND, zero or a negative value
+ * restores the default. Must be called from the main thread when no background work is running.
+ */
+void BLI_task_arena_background_concurrency_set(int num_threads);
+int BLI_task_arena_concurrency(eTaskArena arena);
+
+/** \} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -1031,6 +1031,40 @@ void BLI_bvhtree_update_tree(BVHTree *tree)
     node_join(tree, *index);
   }
 }
+
+typedef struct BVHRefitData {
+  BVHTree *tree;
+  BVHTree_RefitCallback callback;
+  void *userdata;
+} BVHRefitData;
+
+static void bvhtree_refit_leaf_task_cb(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHRefitData *data = (BVHRefitData *)userdata;
+  BVHTree *tree = data->tree;
+  BVHNode *node = tree->nodes[i];
+  float co[3][3];
+  const int numpoints = data->callback(data->userdata, node->index, co);
+
+  create_kdop_hull(tree, node, &co[0][0], numpoints, 0);
+  bvhtree_node_inflate(tree, node, tree->epsilon);
+}
+
+void BLI_bvhtree_refit(BVHTree *tree, BVHTree_RefitCallback callback, void *userdata)
+{
+  BVHRefitData data = {tree, callback, userdata};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (tree->leaf_num > KDOPBVH_THREAD_LEAF_THRESHOLD);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, tree->leaf_num, &data, bvhtree_refit_leaf_task_cb, &settings);
+
+  BLI_bvhtree_update_tree(tree);
+}
+
 int BLI_bvhtree_get_len(const BVHTree *tree)
 {
   return tree->leaf_num;
@@ -1622,6 +1656,40 @@ int BLI_bvhtree_find_nearest(BVHTree *tree,
   return BLI_bvhtree_find_nearest_ex(tree, co, nearest, callback, userdata, 0);
 }
 
+typedef struct BVHNearestBatchData {
+  BVHTree *tree;
+  const float (*co)[3];
+  BVHTreeNearest *nearest;
+  BVHTree_NearestPointCallback callback;
+  void *userdata;
+  int flag;
+} BVHNearestBatchData;
+
+static void bvhtree_find_nearest_batch_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHNearestBatchData *data = (BVHNearestBatchData *)userdata;
+  BLI_bvhtree_find_nearest_ex(
+      data->tree, data->co[i], &data->nearest[i], data->callback, data->userdata, data->flag);
+}
+
+void BLI_bvhtree_find_nearest_batch(BVHTree *tree,
+                                    const float (*co)[3],
+                                    const int points_num,
+                                    BVHTreeNearest *nearest,
+                                    BVHTree_NearestPointCallback callback,
+                                    void *userdata,
+                                    const int flag)
+{
+  BVHNearestBatchData data = {tree, co, nearest, callback, userdata, flag};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, points_num, &data, bvhtree_find_nearest_batch_task_cb, &settings);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1783,19 +1851,23 @@ static float fast_ray_nearest_hit(const BVHRayCastData *data, const BVHNode *nod
   return max_fff(t1x, t1y, t1z);
 }
 
-static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+static float ray_node_nearest_hit(const BVHRayCastData *data, const BVHNode *node)
 {
-  int i;
-
-  /* ray-bv is really fast.. and simple tests revealed its worth to test it
-   * before calling the ray-primitive functions */
   /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
-  float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
-                                            ray_nearest_hit(data, node->bv);
-  if (dist >= data->hit.dist) {
-    return;
-  }
+  return (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
+                                      ray_nearest_hit(data, node->bv);
+}
 
+/**
+ * Visit a node whose bounding volume is hit at the given distance.
+ *
+ * All children are tested first and then visited from front to back, so the closest hits are
+ * found early and the remaining children can be skipped without testing them again. That matters
+ * most for wide trees like the 4- and 8-ary ones used for meshes, where only visiting the
+ * children in the order of the split axis would descend into many boxes behind the final hit.
+ */
+static void dfs_raycast_node(BVHRayCastData *data, BVHNode *node, const float dist)
+{
   if (node->node_num == 0) {
     if (data->callback) {
       data->callback(data->userdata, node->index, &data->ray, &data->hit);
@@ -1805,22 +1877,48 @@ static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
       data->hit.dist = dist;
       madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, dist);
     }
+    return;
   }
-  else {
-    /* pick loop direction to dive into the tree (based on ray direction and split axis) */
-    if (data->ray_dot_axis[node->main_axis] > 0.0f) {
-      for (i = 0; i != node->node_num; i++) {
-        dfs_raycast(data, node->children[i]);
-      }
+
+  BVHNode *children[MAX_TREETYPE];
+  float children_dist[MAX_TREETYPE];
+  int children_num = 0;
+  for (int i = 0; i != node->node_num; i++) {
+    BVHNode *child = node->children[i];
+    const float child_dist = ray_node_nearest_hit(data, child);
+    if (child_dist >= data->hit.dist) {
+      continue;
     }
-    else {
-      for (i = node->node_num - 1; i >= 0; i--) {
-        dfs_raycast(data, node->children[i]);
-      }
+    /* Insertion sort, there are only a few children. */
+    int j = children_num++;
+    for (; j > 0 && children_dist[j - 1] > child_dist; j--) {
+      children[j] = children[j - 1];
+      children_dist[j] = children_dist[j - 1];
+    }
+    children[j] = child;
+    children_dist[j] = child_dist;
+  }
+
+  for (int i = 0; i < children_num; i++) {
+    /* The hit distance may have become smaller while visiting the previous children. */
+    if (children_dist[i] >= data->hit.dist) {
+      break;
     }
+    dfs_raycast_node(data, children[i], children_dist[i]);
   }
 }
 
+static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+{
+  /* ray-bv is really fast.. and simple tests revealed its worth to test it
+   * before calling the ray-primitive functions */
+  const float dist = ray_node_nearest_hit(data, node);
+  if (dist >= data->hit.dist) {
+    return;
+  }
+  dfs_raycast_node(data, node, dist);
+}
+
 /**
  * A version of #dfs_raycast with minor changes to reset the index & dist each ray cast.
  */
@@ -1951,6 +2049,50 @@ int BLI_bvhtree_ray_cast(BVHTree *tree,
       tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT);
 }
 
+typedef struct BVHRayCastBatchData {
+  BVHTree *tree;
+  const float (*co)[3];
+  const float (*dir)[3];
+  float radius;
+  BVHTreeRayHit *hits;
+  BVHTree_RayCastCallback callback;
+  void *userdata;
+  int flag;
+} BVHRayCastBatchData;
+
+static void bvhtree_ray_cast_batch_task_cb(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BVHRayCastBatchData *data = (BVHRayCastBatchData *)userdata;
+  BLI_bvhtree_ray_cast_ex(data->tree,
+                          data->co[i],
+                          data->dir[i],
+                          data->radius,
+                          &data->hits[i],
+                          data->callback,
+                          data->userdata,
+                          data->flag);
+}
+
+void BLI_bvhtree_ray_cast_batch(BVHTree *tree,
+                                const float (*co)[3],
+                                const float (*dir)[3],
+                                const int rays_num,
+                                const float radius,
+                                BVHTreeRayHit *hits,
+                                BVHTree_RayCastCallback callback,
+                                void *userdata,
+                                const int flag)
+{
+  BVHRayCastBatchData data = {tree, co, dir, radius, hits, callback, userdata, flag};
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, rays_num, &data, bvhtree_ray_cast_batch_task_cb, &settings);
+}
+
 float BLI_bvhtree_bb_raycast(const float bv[6],
                              const float light_start[3],
                              const float light_end[3],
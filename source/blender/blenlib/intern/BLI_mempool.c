@@ -11,6 +11,8 @@
  * - Freeing chunks.
  * - Iterating over allocated chunks
  *   (optionally when using the #BLI_MEMPOOL_ALLOW_ITER flag).
+ * - Allocating and freeing from multiple threads
+ *   (optionally when using the #BLI_MEMPOOL_THREADSAFE flag).
  */
 
 #include <stdlib.h>
@@ -22,6 +24,7 @@
 
 #include "BLI_mempool.h"         /* own include */
 #include "BLI_mempool_private.h" /* own include */
+#include "BLI_threads.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -120,6 +123,12 @@ struct BLI_mempool {
   /** Number of elements allocated in total. */
   uint totalloc;
 #endif
+  /**
+   * Protects the free list and the chunk list when #BLI_MEMPOOL_THREADSAFE is used. The critical
+   * sections only consist of a few pointer operations (except when a new chunk is allocated), so a
+   * spin lock is cheaper than a mutex here.
+   */
+  SpinLock lock;
 };
 
 #define MEMPOOL_ELEM_SIZE_MIN (sizeof(void *) * 2)
@@ -164,6 +173,20 @@ BLI_INLINE uint mempool_maxchunks(const uint elem_num, const uint pchunk)
   return (elem_num <= pchunk) ? 1 : ((elem_num / pchunk) + 1);
 }
 
+BLI_INLINE void mempool_lock(BLI_mempool *pool)
+{
+  if (pool->flag & BLI_MEMPOOL_THREADSAFE) {
+    BLI_spin_lock(&pool->lock);
+  }
+}
+
+BLI_INLINE void mempool_unlock(BLI_mempool *pool)
+{
+  if (pool->flag & BLI_MEMPOOL_THREADSAFE) {
+    BLI_spin_unlock(&pool->lock);
+  }
+}
+
 static BLI_mempool_chunk *mempool_chunk_alloc(BLI_mempool *pool)
 {
   return MEM_mallocN(sizeof(BLI_mempool_chunk) + (size_t)pool->csize, "BLI_Mempool Chunk");
@@ -300,6 +323,9 @@ BLI_mempool *BLI_mempool_create(uint esize, uint elem_num, uint pchunk, uint fla
   pool->totalloc = 0;
 #endif
   pool->totused = 0;
+  if (flag & BLI_MEMPOOL_THREADSAFE) {
+    BLI_spin_init(&pool->lock);
+  }
 
   if (elem_num) {
     /* Allocate the actual chunks. */
@@ -320,6 +346,8 @@ void *BLI_mempool_alloc(BLI_mempool *pool)
 {
   BLI_freenode *free_pop;
 
+  mempool_lock(pool);
+
   if (UNLIKELY(pool->free == NULL)) {
     /* Need to allocate a new chunk. */
     BLI_mempool_chunk *mpchunk = mempool_chunk_alloc(pool);
@@ -341,6 +369,8 @@ void *BLI_mempool_alloc(BLI_mempool *pool)
   VALGRIND_MEMPOOL_ALLOC(pool, free_pop, pool->esize);
 #endif
 
+  mempool_unlock(pool);
+
   return (void *)free_pop;
 }
 
@@ -355,6 +385,8 @@ void BLI_mempool_free(BLI_mempool *pool, void *addr)
 {
   BLI_freenode *newhead = addr;
 
+  mempool_lock(pool);
+
 #ifndef NDEBUG
   {
     BLI_mempool_chunk *chunk;
@@ -429,6 +461,8 @@ void BLI_mempool_free(BLI_mempool *pool, void *addr)
     VALGRIND_MEMPOOL_FREE(pool, CHUNK_DATA(first));
 #endif
   }
+
+  mempool_unlock(pool);
 }
 
 int BLI_mempool_len(const BLI_mempool *pool)
@@ -712,6 +746,10 @@ void BLI_mempool_destroy(BLI_mempool *pool)
   VALGRIND_DESTROY_MEMPOOL(pool);
 #endif
 
+  if (pool->flag & BLI_MEMPOOL_THREADSAFE) {
+    BLI_spin_end(&pool->lock);
+  }
+
   MEM_freeN(pool);
 }
 
@@ -74,6 +74,13 @@ typedef enum eOpCode {
   OPCODE_JMP_AND,
   /* For comparison chaining: (a b -> 0 JUMP) IF NOT func2(a,b) ELSE (a b -> b). */
   OPCODE_CMP_CHAIN,
+  /* Arithmetic operators, evaluated without calling the function pointer (which is still set):
+   * (a b -> a+b), (a b -> a-b), (a b -> a*b), (a b -> a/b), (a -> -a). */
+  OPCODE_ADD,
+  OPCODE_SUB,
+  OPCODE_MUL,
+  OPCODE_DIV,
+  OPCODE_NEGATE,
 } eOpCode;
 
 typedef double (*UnaryOpFunc)(double);
@@ -201,6 +208,30 @@ eExprPyLike_EvalStatus BLI_expr_pylike_eval(ExprPyLike_Parsed *expr,
         stack[sp - 3] = ops[pc].arg.func3(stack[sp - 3], stack[sp - 2], stack[sp - 1]);
         sp -= 2;
         break;
+      case OPCODE_ADD:
+        FAIL_IF(sp < 2);
+        stack[sp - 2] = stack[sp - 2] + stack[sp - 1];
+        sp--;
+        break;
+      case OPCODE_SUB:
+        FAIL_IF(sp < 2);
+        stack[sp - 2] = stack[sp - 2] - stack[sp - 1];
+        sp--;
+        break;
+      case OPCODE_MUL:
+        FAIL_IF(sp < 2);
+        stack[sp - 2] = stack[sp - 2] * stack[sp - 1];
+        sp--;
+        break;
+      case OPCODE_DIV:
+        FAIL_IF(sp < 2);
+        stack[sp - 2] = stack[sp - 2] / stack[sp - 1];
+        sp--;
+        break;
+      case OPCODE_NEGATE:
+        FAIL_IF(sp < 1);
+        stack[sp - 1] = -stack[sp - 1];
+        break;
       case OPCODE_MIN:
         FAIL_IF(sp < ops[pc].arg.ival);
         for (int j = 1; j < ops[pc].arg.ival; j++, sp--) {
@@ -622,6 +653,23 @@ static bool parse_add_func(ExprParseState *state, eOpCode code, int args, void *
       return false;
   }
 
+  /* The most common operators get their own opcode, to avoid an indirect call. */
+  if (funcptr == op_add) {
+    code = OPCODE_ADD;
+  }
+  else if (funcptr == op_sub) {
+    code = OPCODE_SUB;
+  }
+  else if (funcptr == op_mul) {
+    code = OPCODE_MUL;
+  }
+  else if (funcptr == op_div) {
+    code = OPCODE_DIV;
+  }
+  else if (funcptr == op_negate) {
+    code = OPCODE_NEGATE;
+  }
+
   parse_add_op(state, code, 1 - args)->arg.ptr = funcptr;
   return true;
 }
@@ -130,6 +130,12 @@ size_t BLI_file_unzstd_to_mem_at_pos(void *buf, size_t len, FILE *file, size_t f
   return ZSTD_isError(ret) ? 0 : output.pos;
 }
 
+size_t BLI_file_unzstd_from_mem(void *buf, size_t len, const void *src, size_t src_len)
+{
+  const size_t ret = ZSTD_decompress(buf, len, src, src_len);
+  return ZSTD_isError(ret) ? 0 : ret;
+}
+
 bool BLI_file_magic_is_gzip(const char header[4])
 {
   /* GZIP itself starts with the magic bytes 0x1f 0x8b.
@@ -12,9 +12,34 @@
 #include "BLI_endian_switch.h"
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #include "MEM_guardedalloc.h"
 
+/** Upper limit for the number of frames that are decompressed together in one prefetch batch. */
+#define ZSTD_PREFETCH_BATCH_MAX 16
+
+/** A single seekable frame that is decompressed by a prefetch task. */
+typedef struct ZstdFrameSlot {
+  char *compressed_data;
+  char *content;
+  size_t compressed_size;
+  size_t uncompressed_size;
+  /** Each slot owns a context, since slots are decompressed concurrently. */
+  ZSTD_DCtx *ctx;
+  bool ok;
+} ZstdFrameSlot;
+
+/** A range of consecutive frames that is decompressed in parallel. */
+typedef struct ZstdPrefetchBatch {
+  TaskPool *pool;
+  ZstdFrameSlot slots[ZSTD_PREFETCH_BATCH_MAX];
+  int first_frame;
+  int frames_num;
+  /** Tasks have been pushed to the pool, but nobody waited for them yet. */
+  bool pending;
+} ZstdPrefetchBatch;
+
 typedef struct {
   FileReader reader;
 
@@ -31,7 +56,21 @@ typedef struct {
 
     char *cached_content;
     int cached_frame;
+
+    /** Frame of the last cache miss, used to detect sequential reading. */
+    int last_miss_frame;
   } seek;
+
+  /**
+   * Double-buffered read-ahead for seekable files: while the frames of the current batch are
+   * being consumed, the frames of the next batch are already being decompressed in the
+   * background. Only used when #ZstdReader.prefetch.batch_frames is non-zero.
+   */
+  struct {
+    ZstdPrefetchBatch batches[2];
+    int current;
+    int batch_frames;
+  } prefetch;
 } ZstdReader;
 
 static bool zstd_read_u32(FileReader *base, uint32_t *val)
@@ -154,6 +193,109 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
+static void zstd_prefetch_frame_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  ZstdFrameSlot *slot = (ZstdFrameSlot *)taskdata;
+
+  size_t res = ZSTD_decompressDCtx(slot->ctx,
+                                   slot->content,
+                                   slot->uncompressed_size,
+                                   slot->compressed_data,
+                                   slot->compressed_size);
+  slot->ok = !ZSTD_isError(res) && res == slot->uncompressed_size;
+}
+
+static void zstd_prefetch_batch_wait(ZstdPrefetchBatch *batch)
+{
+  if (batch->pending) {
+    BLI_task_pool_work_and_wait(batch->pool);
+    batch->pending = false;
+  }
+}
+
+/**
+ * Read the compressed data of the frames starting at `first_frame` and push tasks that
+ * decompress them. The base reader is only accessed from the calling thread.
+ */
+static void zstd_prefetch_batch_start(ZstdReader *zstd, ZstdPrefetchBatch *batch, int first_frame)
+{
+  zstd_prefetch_batch_wait(batch);
+
+  batch->first_frame = first_frame;
+  batch->frames_num = 0;
+
+  const int frames_num = min_ii(zstd->prefetch.batch_frames,
+                                zstd->seek.frames_num - first_frame);
+  for (int i = 0; i < frames_num; i++) {
+    const int frame = first_frame + i;
+    ZstdFrameSlot *slot = &batch->slots[i];
+
+    MEM_SAFE_FREE(slot->compressed_data);
+    MEM_SAFE_FREE(slot->content);
+    slot->ok = false;
+    slot->compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                            zstd->seek.compressed_ofs[frame];
+    slot->uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                              zstd->seek.uncompressed_ofs[frame];
+
+    slot->compressed_data = MEM_mallocN(slot->compressed_size, __func__);
+    if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+        zstd->base->read(zstd->base, slot->compressed_data, slot->compressed_size) <
+            slot->compressed_size) {
+      /* Frames that can't be read are left to the regular (synchronous) code-path. */
+      break;
+    }
+    slot->content = MEM_mallocN(slot->uncompressed_size, __func__);
+    if (slot->ctx == NULL) {
+      slot->ctx = ZSTD_createDCtx();
+    }
+
+    BLI_task_pool_push(batch->pool, zstd_prefetch_frame_task, slot, false, NULL);
+    batch->frames_num++;
+  }
+
+  batch->pending = batch->frames_num > 0;
+}
+
+/** Discard everything that was prefetched so far and start reading ahead at `first_frame`. */
+static void zstd_prefetch_restart(ZstdReader *zstd, int first_frame)
+{
+  ZstdPrefetchBatch *current = &zstd->prefetch.batches[zstd->prefetch.current];
+  ZstdPrefetchBatch *next = &zstd->prefetch.batches[1 - zstd->prefetch.current];
+
+  zstd_prefetch_batch_start(zstd, current, first_frame);
+  zstd_prefetch_batch_start(zstd, next, first_frame + current->frames_num);
+}
+
+/** Return the content of a prefetched frame, or NULL if the frame isn't part of any batch. */
+static const char *zstd_prefetch_lookup(ZstdReader *zstd, int frame)
+{
+  for (int i = 0; i < 2; i++) {
+    const int batch_index = (zstd->prefetch.current + i) % 2;
+    ZstdPrefetchBatch *batch = &zstd->prefetch.batches[batch_index];
+    if (frame < batch->first_frame || frame >= batch->first_frame + batch->frames_num) {
+      continue;
+    }
+
+    zstd_prefetch_batch_wait(batch);
+    ZstdFrameSlot *slot = &batch->slots[frame - batch->first_frame];
+    if (!slot->ok) {
+      /* Let the synchronous code-path handle (and report) the error. */
+      return NULL;
+    }
+
+    if (batch_index != zstd->prefetch.current) {
+      /* Reading moved on to the next batch,
+       * so the previous one can be reused for the frames after it. */
+      ZstdPrefetchBatch *previous = &zstd->prefetch.batches[zstd->prefetch.current];
+      zstd->prefetch.current = batch_index;
+      zstd_prefetch_batch_start(zstd, previous, batch->first_frame + batch->frames_num);
+    }
+    return slot->content;
+  }
+  return NULL;
+}
+
 /* Ensure that the currently loaded frame is the correct one. */
 static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 {
@@ -162,6 +304,13 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
     return zstd->seek.cached_content;
   }
 
+  if (zstd->prefetch.batch_frames > 0) {
+    const char *prefetched = zstd_prefetch_lookup(zstd, frame);
+    if (prefetched != NULL) {
+      return prefetched;
+    }
+  }
+
   /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
   MEM_SAFE_FREE(zstd->seek.cached_content);
 
@@ -188,6 +337,14 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
 
   zstd->seek.cached_frame = frame;
   zstd->seek.cached_content = uncompressed_data;
+
+  /* Two consecutive misses mean that reading is sequential,
+   * so start decompressing the following frames ahead of time. */
+  if (zstd->prefetch.batch_frames > 0 && frame == zstd->seek.last_miss_frame + 1) {
+    zstd_prefetch_restart(zstd, frame + 1);
+  }
+  zstd->seek.last_miss_frame = frame;
+
   return uncompressed_data;
 }
 
@@ -278,6 +435,21 @@ static void zstd_close(FileReader *reader)
   ZstdReader *zstd = (ZstdReader *)reader;
 
   ZSTD_freeDCtx(zstd->ctx);
+  if (zstd->prefetch.batch_frames > 0) {
+    for (int i = 0; i < 2; i++) {
+      ZstdPrefetchBatch *batch = &zstd->prefetch.batches[i];
+      zstd_prefetch_batch_wait(batch);
+      BLI_task_pool_free(batch->pool);
+      for (int j = 0; j < ZSTD_PREFETCH_BATCH_MAX; j++) {
+        ZstdFrameSlot *slot = &batch->slots[j];
+        MEM_SAFE_FREE(slot->compressed_data);
+        MEM_SAFE_FREE(slot->content);
+        if (slot->ctx) {
+          ZSTD_freeDCtx(slot->ctx);
+        }
+      }
+    }
+  }
   if (zstd->reader.seek) {
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
@@ -294,7 +466,7 @@ static void zstd_close(FileReader *reader)
   MEM_freeN(zstd);
 }
 
-FileReader *BLI_filereader_new_zstd(FileReader *base)
+static FileReader *filereader_new_zstd_ex(FileReader *base, const bool use_prefetch)
 {
   ZstdReader *zstd = MEM_callocN(sizeof(ZstdReader), __func__);
 
@@ -304,6 +476,17 @@ FileReader *BLI_filereader_new_zstd(FileReader *base)
   if (zstd_read_seek_table(zstd)) {
     zstd->reader.read = zstd_read_seekable;
     zstd->reader.seek = zstd_seek;
+
+    zstd->seek.last_miss_frame = -2;
+    if (use_prefetch) {
+      const int threads_num = BLI_task_scheduler_num_threads();
+      if (threads_num > 1 && zstd->seek.frames_num > 2) {
+        zstd->prefetch.batch_frames = min_ii(threads_num, ZSTD_PREFETCH_BATCH_MAX);
+        for (int i = 0; i < 2; i++) {
+          zstd->prefetch.batches[i].pool = BLI_task_pool_create(zstd, TASK_PRIORITY_HIGH);
+        }
+      }
+    }
   }
   else {
     zstd->reader.read = zstd_read;
@@ -323,3 +506,13 @@ FileReader *BLI_filereader_new_zstd(FileReader *base)
 
   return (FileReader *)zstd;
 }
+
+FileReader *BLI_filereader_new_zstd(FileReader *base)
+{
+  return filereader_new_zstd_ex(base, false);
+}
+
+FileReader *BLI_filereader_new_zstd_parallel(FileReader *base)
+{
+  return filereader_new_zstd_ex(base, true);
+}
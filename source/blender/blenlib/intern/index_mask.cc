@@ -236,12 +236,11 @@ IndexMask find_indices_from_virtual_array(const IndexMask indices_to_check,
         virtual_array.materialize_compressed(sliced_mask, buffer);
 
         Vector<int64_t> masked_indices;
-        sliced_mask.to_best_mask_type([&](auto best_mask) {
-          for (const int64_t i : IndexRange(best_mask.size())) {
-            if (buffer[i]) {
-              masked_indices.append(best_mask[i]);
-            }
-          }
+        sliced_mask.to_best_mask_type([&](const auto &best_mask) {
+          detail::find_indices_based_on_predicate__chunk(
+              best_mask,
+              [&](const int64_t i, const int64_t /*index*/) { return buffer[i]; },
+              masked_indices);
         });
         if (!masked_indices.is_empty()) {
           sub_masks.local().append(std::move(masked_indices));
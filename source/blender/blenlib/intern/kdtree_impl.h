@@ -9,6 +9,7 @@
 #include "BLI_kdtree_impl.h"
 #include "BLI_math.h"
 #include "BLI_strict_flags.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #define _BLI_KDTREE_CONCAT_AUX(MACRO_ARG1, MACRO_ARG2) MACRO_ARG1##MACRO_ARG2
@@ -852,6 +853,146 @@ static void deduplicate_recursive(const struct DeDuplicateParams *p, uint i)
   }
 }
 
+/**
+ * Points within range of every node are found in parallel before the serial merging pass, which
+ * then only has to loop over these lists. Nodes with more neighbors than this (e.g. many points
+ * at the same location) are searched again during the merging instead, to keep memory usage low.
+ */
+#define KD_DUPLICATES_NEIGHBORS_MAX 32
+#define KD_DUPLICATES_THREADED_LIMIT 10000
+
+struct DeDuplicateNeighborsParams {
+  const KDTreeNode *nodes;
+  uint root;
+  float range;
+  float range_sq;
+  /** Number of neighbors of each node, larger than the maximum when it has too many. */
+  uint *neighbors_num;
+  /** Start of the neighbors of each node in #neighbors, null during the counting pass. */
+  const uint *neighbors_offset;
+  int *neighbors;
+};
+
+/** Same traversal as #deduplicate_recursive, to find exactly the same points. */
+static void deduplicate_neighbors_recursive(const struct DeDuplicateNeighborsParams *p,
+                                            const float search_co[KD_DIMS],
+                                            const int search,
+                                            uint i,
+                                            int *r_neighbors,
+                                            uint *r_neighbors_num)
+{
+  if (*r_neighbors_num > KD_DUPLICATES_NEIGHBORS_MAX) {
+    return;
+  }
+  const KDTreeNode *node = &p->nodes[i];
+  if (search_co[node->d] + p->range <= node->co[node->d]) {
+    if (node->left != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(
+          p, search_co, search, node->left, r_neighbors, r_neighbors_num);
+    }
+  }
+  else if (search_co[node->d] - p->range >= node->co[node->d]) {
+    if (node->right != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(
+          p, search_co, search, node->right, r_neighbors, r_neighbors_num);
+    }
+  }
+  else {
+    if ((search != node->index) && (len_squared_vnvn(node->co, search_co) <= p->range_sq)) {
+      if (r_neighbors && *r_neighbors_num < KD_DUPLICATES_NEIGHBORS_MAX) {
+        r_neighbors[*r_neighbors_num] = node->index;
+      }
+      *r_neighbors_num += 1;
+    }
+    if (node->left != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(
+          p, search_co, search, node->left, r_neighbors, r_neighbors_num);
+    }
+    if (node->right != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(
+          p, search_co, search, node->right, r_neighbors, r_neighbors_num);
+    }
+  }
+}
+
+static void deduplicate_neighbors_task_cb(void *__restrict userdata,
+                                          const int i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const struct DeDuplicateNeighborsParams *p = userdata;
+  const KDTreeNode *node = &p->nodes[i];
+  if (p->neighbors_offset == NULL) {
+    uint neighbors_num = 0;
+    deduplicate_neighbors_recursive(p, node->co, node->index, p->root, NULL, &neighbors_num);
+    p->neighbors_num[i] = neighbors_num;
+  }
+  else if (p->neighbors_num[i] <= KD_DUPLICATES_NEIGHBORS_MAX) {
+    uint neighbors_num = 0;
+    deduplicate_neighbors_recursive(p,
+                                    node->co,
+                                    node->index,
+                                    p->root,
+                                    p->neighbors + p->neighbors_offset[i],
+                                    &neighbors_num);
+  }
+}
+
+/**
+ * Find the neighbors of all nodes in parallel, see #KD_DUPLICATES_NEIGHBORS_MAX.
+ * Returns the neighbors, the number and offset of each node are written to the output arrays.
+ */
+static int *deduplicate_neighbors_calc(const KDTree *tree,
+                                       const float range,
+                                       uint *r_neighbors_num,
+                                       uint *r_neighbors_offset)
+{
+  struct DeDuplicateNeighborsParams p = {
+      .nodes = tree->nodes,
+      .root = tree->root,
+      .range = range,
+      .range_sq = square_f(range),
+      .neighbors_num = r_neighbors_num,
+      .neighbors_offset = NULL,
+      .neighbors = NULL,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(
+      0, (int)tree->nodes_len, &p, deduplicate_neighbors_task_cb, &settings);
+
+  uint offset = 0;
+  for (uint i = 0; i < tree->nodes_len; i++) {
+    r_neighbors_offset[i] = offset;
+    if (r_neighbors_num[i] <= KD_DUPLICATES_NEIGHBORS_MAX) {
+      offset += r_neighbors_num[i];
+    }
+  }
+
+  int *neighbors = MEM_mallocN(sizeof(int) * MAX2(offset, 1u), __func__);
+  p.neighbors_offset = r_neighbors_offset;
+  p.neighbors = neighbors;
+  BLI_task_parallel_range(
+      0, (int)tree->nodes_len, &p, deduplicate_neighbors_task_cb, &settings);
+  return neighbors;
+}
+
+/**
+ * Merge the points that were found for one node, equivalent to #deduplicate_recursive.
+ */
+static void deduplicate_from_neighbors(const struct DeDuplicateParams *p,
+                                       const int *neighbors,
+                                       const uint neighbors_num)
+{
+  for (uint i = 0; i < neighbors_num; i++) {
+    if (p->duplicates[neighbors[i]] == -1) {
+      p->duplicates[neighbors[i]] = p->search;
+      *p->duplicates_found += 1;
+    }
+  }
+}
+
 /**
  * Find duplicate points in \a range.
  * Favors speed over quality since it doesn't find the best target vertex for merging.
@@ -884,6 +1025,25 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
       .duplicates_found = &found,
   };
 
+  uint *neighbors_num = NULL;
+  uint *neighbors_offset = NULL;
+  int *neighbors = NULL;
+  if (tree->nodes_len > KD_DUPLICATES_THREADED_LIMIT) {
+    neighbors_num = MEM_mallocN(sizeof(uint) * tree->nodes_len, __func__);
+    neighbors_offset = MEM_mallocN(sizeof(uint) * tree->nodes_len, __func__);
+    neighbors = deduplicate_neighbors_calc(tree, range, neighbors_num, neighbors_offset);
+  }
+
+#define DEDUPLICATE_NODE(node_index) \
+  if (neighbors && neighbors_num[node_index] <= KD_DUPLICATES_NEIGHBORS_MAX) { \
+    deduplicate_from_neighbors( \
+        &p, neighbors + neighbors_offset[node_index], neighbors_num[node_index]); \
+  } \
+  else { \
+    deduplicate_recursive(&p, tree->root); \
+  } \
+  ((void)0)
+
   if (use_index_order) {
     uint *order = kdtree_order(tree);
     for (uint i = 0; i < tree->nodes_len; i++) {
@@ -893,7 +1053,7 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
         p.search = index;
         copy_vn_vn(p.search_co, tree->nodes[node_index].co);
         int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
+        DEDUPLICATE_NODE(node_index);
         if (found != found_prev) {
           /* Prevent chains of doubles. */
           duplicates[index] = index;
@@ -910,7 +1070,7 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
         p.search = index;
         copy_vn_vn(p.search_co, tree->nodes[node_index].co);
         int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
+        DEDUPLICATE_NODE(node_index);
         if (found != found_prev) {
           /* Prevent chains of doubles. */
           duplicates[index] = index;
@@ -918,6 +1078,12 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
       }
     }
   }
+
+#undef DEDUPLICATE_NODE
+
+  MEM_SAFE_FREE(neighbors_num);
+  MEM_SAFE_FREE(neighbors_offset);
+  MEM_SAFE_FREE(neighbors);
   return found;
 }
 
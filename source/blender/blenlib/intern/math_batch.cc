@@ -0,0 +1,149 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ *
+ * The vectors are stored as `float[3]` without padding, so the SIMD kernels load four floats at a
+ * time, which includes the first component of the next vector. That is why the last vector of
+ * every array is always processed with the scalar code, to avoid reading past the end.
+ */
+
+#include "BLI_bounds.hh"
+#include "BLI_math_batch.hh"
+#include "BLI_math_vector.hh"
+#include "BLI_simd.h"
+#include "BLI_task.hh"
+
+namespace blender::math {
+
+#ifdef BLI_HAVE_SSE2
+
+static __m128 load_float3_unsafe(const float3 &v)
+{
+  /* The fourth component is undefined. */
+  return _mm_loadu_ps(&v.x);
+}
+
+static void store_float3(const __m128 v, float3 &r)
+{
+  _mm_storel_pi(reinterpret_cast<__m64 *>(&r.x), v);
+  _mm_store_ss(&r.z, _mm_movehl_ps(v, v));
+}
+
+static __m128 mul_columns(const __m128 col0, const __m128 col1, const __m128 col2, const __m128 v)
+{
+  const __m128 x = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 0, 0, 0));
+  const __m128 y = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+  const __m128 z = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(col0, x), _mm_mul_ps(col1, y)), _mm_mul_ps(col2, z));
+}
+
+#endif
+
+static void transform_points_range(const float4x4 &transform,
+                                   const Span<float3> src,
+                                   MutableSpan<float3> dst)
+{
+  int64_t i = 0;
+#ifdef BLI_HAVE_SSE2
+  const __m128 col0 = _mm_loadu_ps(transform.values[0]);
+  const __m128 col1 = _mm_loadu_ps(transform.values[1]);
+  const __m128 col2 = _mm_loadu_ps(transform.values[2]);
+  const __m128 col3 = _mm_loadu_ps(transform.values[3]);
+  for (; i < src.size() - 1; i++) {
+    const __m128 v = load_float3_unsafe(src[i]);
+    store_float3(_mm_add_ps(mul_columns(col0, col1, col2, v), col3), dst[i]);
+  }
+#endif
+  for (; i < src.size(); i++) {
+    dst[i] = transform * src[i];
+  }
+}
+
+void transform_points(const Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+  threading::parallel_for(src.index_range(), 2048, [&](const IndexRange range) {
+    transform_points_range(transform, src.slice(range), dst.slice(range));
+  });
+}
+
+void transform_points(const float4x4 &transform, MutableSpan<float3> points)
+{
+  transform_points(points, transform, points);
+}
+
+void transform_directions(const float3x3 &transform, MutableSpan<float3> directions)
+{
+  threading::parallel_for(directions.index_range(), 2048, [&](const IndexRange range) {
+    MutableSpan<float3> directions_range = directions.slice(range);
+    int64_t i = 0;
+#ifdef BLI_HAVE_SSE2
+    const float(*m)[3] = transform.values;
+    const __m128 col0 = _mm_setr_ps(m[0][0], m[0][1], m[0][2], 0.0f);
+    const __m128 col1 = _mm_setr_ps(m[1][0], m[1][1], m[1][2], 0.0f);
+    const __m128 col2 = _mm_setr_ps(m[2][0], m[2][1], m[2][2], 0.0f);
+    for (; i < directions_range.size() - 1; i++) {
+      float3 &direction = directions_range[i];
+      store_float3(mul_columns(col0, col1, col2, load_float3_unsafe(direction)), direction);
+    }
+#endif
+    for (; i < directions_range.size(); i++) {
+      directions_range[i] = transform * directions_range[i];
+    }
+  });
+}
+
+void normalize_span(MutableSpan<float3> vectors)
+{
+  /* The scalar loop is simple enough to be vectorized by the compiler. */
+  threading::parallel_for(vectors.index_range(), 2048, [&](const IndexRange range) {
+    for (float3 &vector : vectors.slice(range)) {
+      vector = math::normalize(vector);
+    }
+  });
+}
+
+}  // namespace blender::math
+
+namespace blender::bounds::detail {
+
+static Bounds<float3> min_max_float3_range(const Span<float3> values, Bounds<float3> result)
+{
+  int64_t i = 0;
+#ifdef BLI_HAVE_SSE2
+  __m128 min = _mm_setr_ps(result.min.x, result.min.y, result.min.z, 0.0f);
+  __m128 max = _mm_setr_ps(result.max.x, result.max.y, result.max.z, 0.0f);
+  for (; i < values.size() - 1; i++) {
+    const __m128 v = math::load_float3_unsafe(values[i]);
+    min = _mm_min_ps(min, v);
+    max = _mm_max_ps(max, v);
+  }
+  math::store_float3(min, result.min);
+  math::store_float3(max, result.max);
+#endif
+  for (; i < values.size(); i++) {
+    math::min_max(values[i], result.min, result.max);
+  }
+  return result;
+}
+
+std::optional<Bounds<float3>> min_max_float3(const Span<float3> values)
+{
+  if (values.is_empty()) {
+    return std::nullopt;
+  }
+  const Bounds<float3> init{values.first(), values.first()};
+  return threading::parallel_reduce(
+      values.index_range(),
+      2048,
+      init,
+      [&](const IndexRange range, const Bounds<float3> &init) {
+        return min_max_float3_range(values.slice(range), init);
+      },
+      [](const Bounds<float3> &a, const Bounds<float3> &b) {
+        return Bounds<float3>{math::min(a.min, b.min), math::max(a.max, b.max)};
+      });
+}
+
+}  // namespace blender::bounds::detail
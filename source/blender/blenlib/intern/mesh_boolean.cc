@@ -886,15 +886,34 @@ static const Vert *find_flap_vert(const Face &tri, const Edge e, bool *r_rev)
  * that if a triangle is in class 1 then it is has the same flap vert
  * as tri0.
  */
+/**
+ * Return true if the double coordinates of \a v are exactly the same as its exact coordinates.
+ * That is true for all vertices of the input meshes and many of the vertices that are created
+ * by the intersection, so the exact orientation test on doubles can be used for them.
+ */
+static bool vert_co_is_exact(const Vert *v)
+{
+  return v->co_exact[0] == v->co[0] && v->co_exact[1] == v->co[1] && v->co_exact[2] == v->co[2];
+}
+
+/**
+ * Same as the #orient3d variant that uses `mpq3`, but first tries the adaptive exact predicate
+ * on doubles, which is much faster and gives the same result when the coordinates are exact.
+ */
+static int orient3d_filtered(const Vert *a, const Vert *b, const Vert *c, const Vert *d)
+{
+  if (vert_co_is_exact(a) && vert_co_is_exact(b) && vert_co_is_exact(c) && vert_co_is_exact(d)) {
+    return orient3d(a->co, b->co, c->co, d->co);
+  }
+  return orient3d(a->co_exact, b->co_exact, c->co_exact, d->co_exact);
+}
+
 static int sort_tris_class(const Face &tri, const Face &tri0, const Edge e)
 {
   const int dbg_level = 0;
   if (dbg_level > 0) {
     std::cout << "classify  e = " << e << "\n";
   }
-  mpq3 a0 = tri0[0]->co_exact;
-  mpq3 a1 = tri0[1]->co_exact;
-  mpq3 a2 = tri0[2]->co_exact;
   bool rev;
   bool rev0;
   const Vert *flapv0 = find_flap_vert(tri0, e, &rev0);
@@ -906,9 +925,8 @@ static int sort_tris_class(const Face &tri, const Face &tri0, const Edge e)
     std::cout << " rev = " << rev << " flapv = " << flapv << "\n";
   }
   BLI_assert(flapv != nullptr && flapv0 != nullptr);
-  const mpq3 flap = flapv->co_exact;
-  /* orient will be positive if flap is below oriented plane of a0,a1,a2. */
-  int orient = orient3d(a0, a1, a2, flap);
+  /* orient will be positive if flap is below oriented plane of tri0. */
+  int orient = orient3d_filtered(tri0[0], tri0[1], tri0[2], flapv);
   int ans;
   if (orient > 0) {
     ans = rev0 ? 4 : 3;
@@ -1073,21 +1091,16 @@ static Array<int> sort_tris_around_edge(
  * Will modify \a pinfo and \a cinfo and the patches and cells they contain.
  */
 static void find_cells_from_edge(const IMesh &tm,
-                                 const TriMeshTopology &tmtopo,
                                  PatchesInfo &pinfo,
                                  CellsInfo &cinfo,
-                                 const Edge e)
+                                 const Edge e,
+                                 const Span<int> sorted_tris)
 {
   const int dbg_level = 0;
   if (dbg_level > 0) {
     std::cout << "FIND_CELLS_FROM_EDGE " << e << "\n";
   }
-  const Vector<int> *edge_tris = tmtopo.edge_tris(e);
-  BLI_assert(edge_tris != nullptr);
-  Array<int> sorted_tris = sort_tris_around_edge(
-      tm, e, Span<int>(*edge_tris), (*edge_tris)[0], nullptr);
-
-  int n_edge_tris = edge_tris->size();
+  int n_edge_tris = sorted_tris.size();
   Array<int> edge_patches(n_edge_tris);
   for (int i = 0; i < n_edge_tris; ++i) {
     edge_patches[i] = pinfo.tri_patch(sorted_tris[i]);
@@ -1188,18 +1201,31 @@ static CellsInfo find_cells(const IMesh &tm, const TriMeshTopology &tmtopo, Patc
     std::cout << "\nFIND_CELLS\n";
   }
   CellsInfo cinfo;
-  /* For each unique edge shared between patch pairs, process it. */
-  Set<Edge> processed_edges;
+  /* Gather the unique edges shared between patch pairs. */
+  VectorSet<Edge> patch_edges;
   for (const auto item : pinfo.patch_patch_edge_map().items()) {
     int p = item.key.first;
     int q = item.key.second;
     if (p < q) {
-      const Edge &e = item.value;
-      if (!processed_edges.contains(e)) {
-        processed_edges.add_new(e);
-        find_cells_from_edge(tm, tmtopo, pinfo, cinfo, e);
-      }
+      patch_edges.add(item.value);
+    }
+  }
+  /* Sorting the triangles around the edges only reads the mesh and is the expensive part,
+   * because of the exact orientation tests, so do it in parallel. */
+  Array<Array<int>> edges_sorted_tris(patch_edges.size());
+  threading::parallel_for(patch_edges.index_range(), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      const Edge e = patch_edges[i];
+      const Vector<int> *edge_tris = tmtopo.edge_tris(e);
+      BLI_assert(edge_tris != nullptr);
+      edges_sorted_tris[i] = sort_tris_around_edge(
+          tm, e, Span<int>(*edge_tris), (*edge_tris)[0], nullptr);
     }
+  });
+  /* Building the cells depends on the order in which the edges are processed, which stays the
+   * same as when the triangles are sorted and processed one edge at a time. */
+  for (const int i : patch_edges.index_range()) {
+    find_cells_from_edge(tm, pinfo, cinfo, patch_edges[i], edges_sorted_tris[i]);
   }
   /* Some patches may have no cells at this point. These are either:
    * (a) a closed manifold patch only incident on itself (sphere, torus, klein bottle, etc.).
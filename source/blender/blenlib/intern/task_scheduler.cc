@@ -20,14 +20,53 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    define WITH_TBB_ARENA_PRIORITY
+#  endif
 #endif
 
+#include <algorithm>
+
 /* Task Scheduler */
 
 static int task_scheduler_num_threads = 1;
 #ifdef WITH_TBB_GLOBAL_CONTROL
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
+#ifdef WITH_TBB
+static tbb::task_arena *task_arena_background = nullptr;
+#endif
+
+static int task_arena_background_default_concurrency()
+{
+  /* Keep half of the threads free for interactive work. Use at least two threads where possible,
+   * since every job thread that enters the arena takes up a slot itself. */
+  return std::min(task_scheduler_num_threads, std::max(2, task_scheduler_num_threads / 2));
+}
+
+static void task_arena_background_free()
+{
+#ifdef WITH_TBB
+  MEM_delete(task_arena_background);
+  task_arena_background = nullptr;
+#endif
+}
+
+static void task_arena_background_create(const int num_threads)
+{
+#ifdef WITH_TBB
+  task_arena_background_free();
+  /* The arena is initialized lazily by TBB, on first use. */
+#  ifdef WITH_TBB_ARENA_PRIORITY
+  task_arena_background = MEM_new<tbb::task_arena>(
+      __func__, num_threads, 1, tbb::task_arena::priority::low);
+#  else
+  task_arena_background = MEM_new<tbb::task_arena>(__func__, num_threads, 1);
+#  endif
+#else
+  UNUSED_VARS(num_threads);
+#endif
+}
 
 void BLI_task_scheduler_init()
 {
@@ -51,10 +90,13 @@ void BLI_task_scheduler_init()
 #else
   task_scheduler_num_threads = BLI_system_thread_count();
 #endif
+
+  task_arena_background_create(task_arena_background_default_concurrency());
 }
 
 void BLI_task_scheduler_exit()
 {
+  task_arena_background_free();
 #ifdef WITH_TBB_GLOBAL_CONTROL
   MEM_delete(task_scheduler_global_control);
 #endif
@@ -74,3 +116,35 @@ void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
   func(userdata);
 #endif
 }
+
+void BLI_task_arena_execute(const eTaskArena arena, void (*func)(void *userdata), void *userdata)
+{
+#ifdef WITH_TBB
+  if (arena == TASK_ARENA_BACKGROUND && task_arena_background != nullptr) {
+    task_arena_background->execute([&] { func(userdata); });
+    return;
+  }
+#else
+  UNUSED_VARS(arena);
+#endif
+  func(userdata);
+}
+
+void BLI_task_arena_background_concurrency_set(const int num_threads)
+{
+  task_arena_background_create((num_threads > 0) ?
+                                   std::min(num_threads, task_scheduler_num_threads) :
+                                   task_arena_background_default_concurrency());
+}
+
+int BLI_task_arena_concurrency(const eTaskArena arena)
+{
+#ifdef WITH_TBB
+  if (arena == TASK_ARENA_BACKGROUND && task_arena_background != nullptr) {
+    return task_arena_background->max_concurrency();
+  }
+#else
+  UNUSED_VARS(arena);
+#endif
+  return task_scheduler_num_threads;
+}
@@ -61,4 +61,21 @@ TEST(bounds, Large)
   EXPECT_EQ(result->max, int2(9999, 9999));
 }
 
+TEST(bounds, LargeFloat3)
+{
+  Array<float3> data(10000);
+  for (const int64_t i : data.index_range()) {
+    data[i] = float3(i, -i, float(i % 100));
+  }
+  auto result = bounds::min_max(data.as_span());
+  EXPECT_EQ(result->min, float3(0, -9999, 0));
+  EXPECT_EQ(result->max, float3(9999, 0, 99));
+
+  /* The last element is handled separately. */
+  data.last() = float3(-1.0f, 1.0f, 200.0f);
+  result = bounds::min_max(data.as_span());
+  EXPECT_EQ(result->min, float3(-1, -9998, 0));
+  EXPECT_EQ(result->max, float3(9998, 1, 200));
+}
+
 }  // namespace blender::tests
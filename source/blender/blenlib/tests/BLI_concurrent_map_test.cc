@@ -0,0 +1,75 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_task.hh"
+
+#include "testing/testing.h"
+
+namespace blender::threading::tests {
+
+TEST(concurrent_map, AddOrModify)
+{
+  ConcurrentMap<int, int> map;
+  parallel_for(IndexRange(10000), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      map.add_or_modify(
+          i % 100, []() { return 1; }, [](int &value) { value++; });
+    }
+  });
+  EXPECT_EQ(map.size(), 100);
+  for (const int i : IndexRange(100)) {
+    int value = 0;
+    EXPECT_TRUE(map.lookup_cb(i, [&](const int &v) { value = v; }));
+    EXPECT_EQ(value, 100);
+  }
+  EXPECT_FALSE(map.contains(100));
+}
+
+TEST(concurrent_map, AddRemove)
+{
+  ConcurrentMap<int, float> map;
+  EXPECT_TRUE(map.add(3, 1.0f));
+  EXPECT_FALSE(map.add(3, 2.0f));
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_TRUE(map.remove(3));
+  EXPECT_FALSE(map.remove(3));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.size(), 0);
+}
+
+TEST(concurrent_map, ForeachItem)
+{
+  ConcurrentMap<int, int> map;
+  for (const int i : IndexRange(50)) {
+    map.add(i, i * 2);
+  }
+  int64_t sum = 0;
+  map.foreach_item([&](const int key, int &value) {
+    EXPECT_EQ(value, key * 2);
+    sum += value;
+  });
+  EXPECT_EQ(sum, 49 * 50);
+}
+
+TEST(concurrent_set, ParallelAdd)
+{
+  ConcurrentSet<int> set;
+  std::atomic<int> added_num = 0;
+  parallel_for(IndexRange(10000), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (set.add(i % 1000)) {
+        added_num++;
+      }
+    }
+  });
+  EXPECT_EQ(added_num, 1000);
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_TRUE(set.contains(999));
+  EXPECT_FALSE(set.contains(1000));
+
+  int64_t sum = 0;
+  set.foreach_key([&](const int key) { sum += key; });
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+}  // namespace blender::threading::tests
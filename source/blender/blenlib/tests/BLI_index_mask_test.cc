@@ -1,6 +1,7 @@
 /* SPDX-License-Identifier: Apache-2.0 */
 
 #include "BLI_index_mask.hh"
+#include "BLI_index_mask_ops.hh"
 #include "testing/testing.h"
 
 namespace blender::tests {
@@ -213,4 +214,39 @@ TEST(index_mask, ContainedIn)
   EXPECT_FALSE(IndexMask({5, 6}).contained_in(IndexRange()));
 }
 
+TEST(index_mask, FindIndicesBasedOnPredicate)
+{
+  Vector<int64_t> indices;
+  const IndexMask mask = index_mask_ops::find_indices_based_on_predicate(
+      IndexRange(10000), 512, indices, [](const int64_t i) { return i % 3 == 0; });
+  EXPECT_EQ(mask.size(), 3334);
+  for (const int64_t i : mask.index_range()) {
+    EXPECT_EQ(mask[i], i * 3);
+  }
+
+  Vector<int64_t> sparse_indices;
+  const IndexMask sparse_mask = index_mask_ops::find_indices_based_on_predicate(
+      mask, 512, sparse_indices, [](const int64_t i) { return i % 2 == 0; });
+  EXPECT_EQ(sparse_mask.size(), 1667);
+  for (const int64_t i : sparse_mask.index_range()) {
+    EXPECT_EQ(sparse_mask[i], i * 6);
+  }
+}
+
+TEST(index_mask, FindIndicesFromVirtualArray)
+{
+  Array<bool> values(5000);
+  for (const int64_t i : values.index_range()) {
+    values[i] = i % 5 == 1;
+  }
+  Vector<int64_t> indices;
+  const IndexMask mask = index_mask_ops::find_indices_from_virtual_array(
+      IndexRange(5000), VArray<bool>::ForFunc(5000, [&](const int64_t i) { return values[i]; }),
+      256, indices);
+  EXPECT_EQ(mask.size(), 1000);
+  for (const int64_t i : mask.index_range()) {
+    EXPECT_EQ(mask[i], i * 5 + 1);
+  }
+}
+
 }  // namespace blender::tests
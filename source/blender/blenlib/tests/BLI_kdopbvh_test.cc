@@ -132,3 +132,56 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+TEST(kdopbvh, BatchQueriesMatchSingle)
+{
+  const int points_len = 2000;
+  struct RNG *rng = BLI_rng_new(4321);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 4, 6);
+
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*dirs)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+    BLI_rng_get_float_unit_v3(rng, dirs[i]);
+  }
+  BLI_bvhtree_balance(tree);
+
+  BVHTreeNearest *nearest = (BVHTreeNearest *)MEM_mallocN(sizeof(BVHTreeNearest) * points_len,
+                                                          __func__);
+  BVHTreeRayHit *hits = (BVHTreeRayHit *)MEM_mallocN(sizeof(BVHTreeRayHit) * points_len,
+                                                     __func__);
+  for (int i = 0; i < points_len; i++) {
+    nearest[i].index = -1;
+    nearest[i].dist_sq = FLT_MAX;
+    hits[i].index = -1;
+    hits[i].dist = BVH_RAYCAST_DIST_MAX;
+  }
+  BLI_bvhtree_find_nearest_batch(tree, points, points_len, nearest, nullptr, nullptr, 0);
+  BLI_bvhtree_ray_cast_batch(
+      tree, points, dirs, points_len, 0.0f, hits, nullptr, nullptr, BVH_RAYCAST_DEFAULT);
+
+  for (int i = 0; i < points_len; i++) {
+    BVHTreeNearest nearest_single;
+    nearest_single.index = -1;
+    nearest_single.dist_sq = FLT_MAX;
+    BLI_bvhtree_find_nearest(tree, points[i], &nearest_single, nullptr, nullptr);
+    EXPECT_EQ(nearest[i].index, nearest_single.index);
+    EXPECT_EQ(nearest[i].dist_sq, nearest_single.dist_sq);
+
+    BVHTreeRayHit hit_single;
+    hit_single.index = -1;
+    hit_single.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(tree, points[i], dirs[i], 0.0f, &hit_single, nullptr, nullptr);
+    EXPECT_EQ(hits[i].index, hit_single.index);
+    EXPECT_EQ(hits[i].dist, hit_single.dist);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(dirs);
+  MEM_freeN(nearest);
+  MEM_freeN(hits);
+}
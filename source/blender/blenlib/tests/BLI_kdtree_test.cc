@@ -5,6 +5,7 @@
 #include "BLI_kdtree.h"
 
 #include <cmath>
+#include <vector>
 
 /* -------------------------------------------------------------------- */
 /* Tests */
@@ -52,6 +53,53 @@ static void deduplicate_test()
   }
 }
 
+/**
+ * Large enough to find the neighbors in parallel, with some points that have too many neighbors
+ * to be stored, so both code paths are used.
+ */
+static void calc_duplicates_fast_test(const bool use_index_order)
+{
+  const int grid_size = 40;
+  std::vector<int> expected;
+  std::vector<float> coords;
+  for (int i = 0; i < grid_size * grid_size * grid_size; i++) {
+    const int copies = (i % 97 == 0) ? 40 : (i % 3) + 1;
+    const int first = int(expected.size());
+    for (int copy = 0; copy < copies; copy++) {
+      expected.push_back(copies == 1 ? -1 : first);
+      coords.push_back(float(i % grid_size));
+      coords.push_back(float((i / grid_size) % grid_size));
+      coords.push_back(float(i / (grid_size * grid_size)) + copy * 0.001f);
+    }
+  }
+  const int points_num = int(expected.size());
+  KDTree_3d *tree = BLI_kdtree_3d_new(points_num);
+  for (int i = 0; i < points_num; i++) {
+    BLI_kdtree_3d_insert(tree, i, &coords[i * 3]);
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  std::vector<int> duplicates(points_num, -1);
+  const int found = BLI_kdtree_3d_calc_duplicates_fast(
+      tree, 0.1f, use_index_order, duplicates.data());
+  int expected_found = 0;
+  for (int i = 0; i < points_num; i++) {
+    expected_found += expected[i] != -1 && expected[i] != i;
+    if (use_index_order) {
+      EXPECT_EQ(duplicates[i], expected[i]);
+    }
+    else if (expected[i] == -1) {
+      EXPECT_EQ(duplicates[i], -1);
+    }
+    else {
+      /* The target depends on the order of the nodes, but it has to be one of the copies. */
+      EXPECT_EQ(expected[duplicates[i]], expected[i]);
+    }
+  }
+  EXPECT_EQ(found, expected_found);
+  BLI_kdtree_3d_free(tree);
+}
+
 TEST(kdtree, Standard)
 {
   standard_test();
@@ -61,3 +109,9 @@ TEST(kdtree, Deduplicate)
 {
   deduplicate_test();
 }
+
+TEST(kdtree, CalcDuplicatesFast)
+{
+  calc_duplicates_fast_test(true);
+  calc_duplicates_fast_test(false);
+}
@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_array.hh"
+#include "BLI_math_batch.hh"
+#include "BLI_math_rotation.h"
+
+namespace blender::math::tests {
+
+static Array<float3> create_test_vectors(const int64_t size)
+{
+  Array<float3> vectors(size);
+  for (const int64_t i : vectors.index_range()) {
+    vectors[i] = float3(float(i % 17) - 8.0f, float(i % 5) * 0.5f, -float(i % 11));
+  }
+  return vectors;
+}
+
+TEST(math_batch, TransformPoints)
+{
+  const float4x4 transform = float4x4::from_loc_eul_scale(
+      float3(1.0f, -2.0f, 3.0f), float3(0.3f, 1.2f, -0.4f), float3(2.0f, 0.5f, 1.5f));
+  const Array<float3> src = create_test_vectors(10001);
+  Array<float3> dst(src.size());
+  transform_points(src, transform, dst);
+  for (const int64_t i : src.index_range()) {
+    const float3 expected = transform * src[i];
+    EXPECT_V3_NEAR(dst[i], expected, 1e-5f);
+  }
+
+  Array<float3> in_place = src;
+  transform_points(transform, in_place);
+  EXPECT_EQ_ARRAY(in_place.data(), dst.data(), dst.size());
+}
+
+TEST(math_batch, TransformPointsSingle)
+{
+  const float4x4 transform = float4x4::from_location(float3(1.0f, 2.0f, 3.0f));
+  Array<float3> points = {float3(1.0f, 1.0f, 1.0f)};
+  transform_points(transform, points);
+  EXPECT_EQ(points[0], float3(2.0f, 3.0f, 4.0f));
+
+  Array<float3> empty;
+  transform_points(transform, empty);
+}
+
+TEST(math_batch, TransformDirections)
+{
+  float3x3 transform;
+  eul_to_mat3(transform.values, float3(0.5f, -0.2f, 2.0f));
+  const Array<float3> src = create_test_vectors(4099);
+  Array<float3> directions = src;
+  transform_directions(transform, directions);
+  for (const int64_t i : src.index_range()) {
+    const float3 expected = transform * src[i];
+    EXPECT_V3_NEAR(directions[i], expected, 1e-5f);
+  }
+}
+
+TEST(math_batch, NormalizeSpan)
+{
+  Array<float3> vectors = {float3(3.0f, 0.0f, 4.0f), float3(0.0f), float3(0.0f, -2.0f, 0.0f)};
+  normalize_span(vectors);
+  EXPECT_V3_NEAR(vectors[0], float3(0.6f, 0.0f, 0.8f), 1e-6f);
+  EXPECT_EQ(vectors[1], float3(0.0f));
+  EXPECT_V3_NEAR(vectors[2], float3(0.0f, -1.0f, 0.0f), 1e-6f);
+}
+
+}  // namespace blender::math::tests
@@ -0,0 +1,111 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <random>
+
+#include "BLI_sort.hh"
+#include "BLI_vector.hh"
+
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+template<typename T> static Vector<T> random_values(const int64_t size, const int seed)
+{
+  std::mt19937 rng(seed);
+  Vector<T> values(size);
+  for (T &value : values) {
+    if constexpr (std::is_floating_point_v<T>) {
+      value = std::uniform_real_distribution<T>(-1000.0, 1000.0)(rng);
+    }
+    else {
+      value = T(rng());
+    }
+  }
+  return values;
+}
+
+TEST(sort, RadixSortInt)
+{
+  for (const int64_t size : {0, 10, 1000, 100000}) {
+    Vector<int> values = random_values<int>(size, 0);
+    Vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(values.as_mutable_span());
+    EXPECT_EQ_ARRAY(values.data(), expected.data(), size);
+  }
+}
+
+TEST(sort, RadixSortUInt64)
+{
+  Vector<uint64_t> values = random_values<uint64_t>(50000, 1);
+  Vector<uint64_t> expected = values;
+  std::sort(expected.begin(), expected.end());
+  parallel_radix_sort(values.as_mutable_span());
+  EXPECT_EQ_ARRAY(values.data(), expected.data(), values.size());
+}
+
+TEST(sort, RadixSortFloat)
+{
+  Vector<float> values = random_values<float>(100000, 2);
+  values[0] = 0.0f;
+  values[1] = -0.0f;
+  Vector<float> expected = values;
+  std::sort(expected.begin(), expected.end());
+  parallel_radix_sort(values.as_mutable_span());
+  EXPECT_EQ_ARRAY(values.data(), expected.data(), values.size());
+}
+
+TEST(sort, RadixSortSameHighBytes)
+{
+  Vector<int> values;
+  for (const int i : IndexRange(5000)) {
+    values.append((i * 7919) % 200);
+  }
+  Vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+  parallel_radix_sort(values.as_mutable_span());
+  EXPECT_EQ_ARRAY(values.data(), expected.data(), values.size());
+}
+
+TEST(sort, ParallelStableSort)
+{
+  /* Sort by the key only, the index has to stay in increasing order for equal keys. */
+  Vector<std::pair<int, int>> values;
+  for (const int i : IndexRange(200000)) {
+    values.append({(i * 7919) % 100, i});
+  }
+  Vector<std::pair<int, int>> expected = values;
+  const auto compare = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+    return a.first < b.first;
+  };
+  std::stable_sort(expected.begin(), expected.end(), compare);
+  parallel_stable_sort(values.begin(), values.end(), compare);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(sort, GroupIndicesByKey)
+{
+  for (const int64_t size : {5, 100000}) {
+    Vector<int> keys;
+    for (const int i : IndexRange(size)) {
+      keys.append((i * 31) % 7);
+    }
+    Array<int> offsets(8);
+    Array<int> indices(size);
+    group_indices_by_key(keys, offsets, indices);
+    EXPECT_EQ(offsets.first(), 0);
+    EXPECT_EQ(offsets.last(), size);
+    for (const int group : IndexRange(7)) {
+      const Span<int> group_indices = indices.as_span().slice(
+          offsets[group], offsets[group + 1] - offsets[group]);
+      for (const int i : group_indices.index_range()) {
+        EXPECT_EQ(keys[group_indices[i]], group);
+        if (i > 0) {
+          EXPECT_LT(group_indices[i - 1], group_indices[i]);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace blender::tests
@@ -10,6 +10,7 @@
 
 #include "BLI_utildefines.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
@@ -248,6 +249,49 @@ static void task_listbase_iter_func(void *userdata,
   atomic_sub_and_fetch_uint32((uint32_t *)count, 1);
 }
 
+TEST(task, MempoolThreadsafeAlloc)
+{
+  const int items_num = 100000;
+  BLI_mempool *mempool = BLI_mempool_create(
+      sizeof(int), 0, 512, BLI_MEMPOOL_ALLOW_ITER | BLI_MEMPOOL_THREADSAFE);
+  blender::Array<int *> items(items_num);
+
+  blender::threading::parallel_for(
+      blender::IndexRange(items_num), 256, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          items[i] = static_cast<int *>(BLI_mempool_alloc(mempool));
+          *items[i] = i;
+        }
+      });
+  EXPECT_EQ(BLI_mempool_len(mempool), items_num);
+
+  /* Every element is only returned once. */
+  for (const int i : items.index_range()) {
+    EXPECT_EQ(*items[i], i);
+  }
+
+  blender::threading::parallel_for(
+      blender::IndexRange(items_num), 256, [&](const blender::IndexRange range) {
+        for (const int i : range) {
+          if (i % 2 == 0) {
+            BLI_mempool_free(mempool, items[i]);
+          }
+        }
+      });
+  EXPECT_EQ(BLI_mempool_len(mempool), items_num / 2);
+
+  int found_num = 0;
+  BLI_mempool_iter iter;
+  BLI_mempool_iternew(mempool, &iter);
+  while (int *item = static_cast<int *>(BLI_mempool_iterstep(&iter))) {
+    EXPECT_EQ(*item % 2, 1);
+    found_num++;
+  }
+  EXPECT_EQ(found_num, items_num / 2);
+
+  BLI_mempool_destroy(mempool);
+}
+
 TEST(task, ListBaseIter)
 {
   ListBase list = {nullptr, nullptr};
@@ -293,3 +337,20 @@ TEST(task, ParallelInvoke)
                                       [&]() { counter++; });
   EXPECT_EQ(counter, 6);
 }
+
+TEST(task, ArenaExecute)
+{
+  std::atomic<int> counter = 0;
+  BLI_task_arena_execute(
+      TASK_ARENA_BACKGROUND,
+      [](void *userdata) {
+        std::atomic<int> &counter = *static_cast<std::atomic<int> *>(userdata);
+        blender::threading::parallel_for(
+            blender::IndexRange(1000), 10, [&](const blender::IndexRange range) {
+              counter += int(range.size());
+            });
+      },
+      &counter);
+  EXPECT_EQ(counter, 1000);
+  EXPECT_GE(BLI_task_arena_concurrency(TASK_ARENA_BACKGROUND), 1);
+}
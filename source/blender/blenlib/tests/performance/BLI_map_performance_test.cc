@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <string>
+
+#include "BLI_map.hh"
+#include "BLI_rand.h"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+
+namespace blender::tests {
+
+#define NUM_RUNS 3
+
+/* Keys with a factor have the same lower bits, which results in more collisions with simple
+ * hash functions. */
+static Vector<int> random_ints(const int amount, const int factor)
+{
+  RNG *rng = BLI_rng_new(0);
+  Vector<int> values;
+  for (int i = 0; i < amount; i++) {
+    values.append(BLI_rng_get_int(rng) * factor);
+  }
+  BLI_rng_free(rng);
+  return values;
+}
+
+template<typename MapT, typename Key>
+BLI_NOINLINE static void map_add_lookup_remove(const std::string &name, const Span<Key> keys)
+{
+  MapT map;
+  {
+    SCOPED_TIMER(name + " Add");
+    for (const Key &key : keys) {
+      map.add(key, 0);
+    }
+  }
+  int count = 0;
+  {
+    SCOPED_TIMER(name + " Contains");
+    for (const Key &key : keys) {
+      count += map.contains(key);
+    }
+  }
+  {
+    SCOPED_TIMER(name + " Remove");
+    for (const Key &key : keys) {
+      count += map.remove(key);
+    }
+  }
+
+  /* Print the value for simple error checking and to avoid some compiler optimizations. */
+  std::cout << "Count: " << count << "\n";
+}
+
+TEST(map, IntKeys1M)
+{
+  const Vector<int> keys = random_ints(1000000, 1);
+  for (int i = 0; i < NUM_RUNS; i++) {
+    map_add_lookup_remove<Map<int, int>, int>("blender::Map      ", keys);
+    map_add_lookup_remove<StdUnorderedMapWrapper<int, int>, int>("std::unordered_map", keys);
+  }
+}
+
+TEST(map, IntKeysCollisions1M)
+{
+  const Vector<int> keys = random_ints(1000000, 3 << 10);
+  for (int i = 0; i < NUM_RUNS; i++) {
+    map_add_lookup_remove<Map<int, int>, int>("blender::Map      ", keys);
+    map_add_lookup_remove<StdUnorderedMapWrapper<int, int>, int>("std::unordered_map", keys);
+  }
+}
+
+TEST(map, StringKeys100k)
+{
+  Vector<std::string> keys;
+  for (const int value : random_ints(100000, 1)) {
+    keys.append("key_" + std::to_string(value));
+  }
+  for (int i = 0; i < NUM_RUNS; i++) {
+    map_add_lookup_remove<Map<std::string, int>, std::string>("blender::Map      ", keys);
+    map_add_lookup_remove<StdUnorderedMapWrapper<std::string, int>, std::string>(
+        "std::unordered_map", keys);
+  }
+}
+
+}  // namespace blender::tests
@@ -18,8 +18,13 @@ typedef struct {
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** When true, this chunk is identical to the matching chunk of the previous #MemFile (used by
+   * undo code to detect unchanged IDs). */
   bool is_identical;
+  /** When true, this chunk doesn't own the memory, it's shared with a chunk of the previous
+   * #MemFile. Always set for identical chunks, but also set when the same content was found
+   * elsewhere in the previous #MemFile. */
+  bool is_buffer_shared;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
    * Defined when writing the next step (i.e. last undo step has those always false). */
@@ -27,6 +32,8 @@ typedef struct {
   /** Session UUID of the ID being currently written (MAIN_ID_SESSION_UUID_UNSET when not writing
    * ID-related data). Used to find matching chunks in previous memundo step. */
   uint id_session_uuid;
+  /** Cheap hash of the chunk content, see #memfile_chunk_hash. */
+  uint hash;
 } MemFileChunk;
 
 typedef struct MemFile {
@@ -43,6 +50,9 @@ typedef struct MemFileWriteData {
 
   /** Maps an ID session uuid to its first reference MemFileChunk, if existing. */
   struct GHash *id_session_uuid_mapping;
+  /** Maps #MemFileChunk.hash to a reference MemFileChunk, to share buffers with chunks of the
+   * reference memfile that have the same content, but are not at the matching position. */
+  struct GHash *hash_to_reference_chunk;
 } MemFileWriteData;
 
 typedef struct MemFileUndoData {
@@ -82,6 +92,16 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
 /* **************** support for memory-write, for undo buffers *************** */
 
 extern void BLO_memfile_free(MemFile *memfile);
+/**
+ * Same as #BLO_memfile_free, but the chunks are freed on a background thread, since freeing
+ * large undo steps can take a noticeable amount of time. The memory must not be shared with any
+ * other #MemFile anymore (call #BLO_memfile_merge first).
+ */
+extern void BLO_memfile_free_deferred(MemFile *memfile);
+/**
+ * Wait until all memory passed to #BLO_memfile_free_deferred is freed, call before exiting.
+ */
+extern void BLO_memfile_free_deferred_wait(void);
 /**
  * Result is that 'first' is being freed.
  * to keep list of memfiles consistent, 'first' is always first in list.
@@ -55,6 +55,7 @@
 #include "BLI_math.h"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "PIL_time.h"
@@ -856,6 +857,22 @@ static bool blo_bhead_read_data(FileData *fd, BHead *thisblock, void *buf)
   return success;
 }
 
+/**
+ * Access the data of a block that was not read yet without copying it. This is only possible
+ * when the whole file is available in memory, e.g. when it is memory-mapped.
+ *
+ * \return null when the data has to be read with #blo_bhead_read_data instead.
+ */
+static const void *blo_bhead_peek_data(FileData *fd, BHead *thisblock)
+{
+  BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
+  BLI_assert(new_bhead->has_data == false && new_bhead->file_offset != 0);
+  if (fd->file->peek == nullptr) {
+    return nullptr;
+  }
+  return fd->file->peek(fd->file, new_bhead->file_offset, size_t(new_bhead->bhead.len));
+}
+
 static BHead *blo_bhead_read_full(FileData *fd, BHead *thisblock)
 {
   BHeadN *new_bhead = BHEADN_FROM_BHEAD(thisblock);
@@ -1111,7 +1128,7 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
     }
   }
   else if (BLI_file_magic_is_zstd(header)) {
-    file = BLI_filereader_new_zstd(rawfile);
+    file = BLI_filereader_new_zstd_parallel(rawfile);
     if (file != nullptr) {
       rawfile = nullptr; /* The `Zstd` #FileReader takes ownership of `rawfile`. */
     }
@@ -1192,7 +1209,7 @@ FileData *blo_filedata_from_memory(const void *mem, int memsize, BlendFileReadRe
     file = BLI_filereader_new_gzip(mem_file);
   }
   else if (BLI_file_magic_is_zstd(static_cast<const char *>(mem))) {
-    file = BLI_filereader_new_zstd(mem_file);
+    file = BLI_filereader_new_zstd_parallel(mem_file);
   }
 
   if (file == nullptr) {
@@ -1746,6 +1763,34 @@ static void switch_endian_structs(const SDNA *filesdna, BHead *bhead)
   }
 }
 
+/** Arrays with at least this many elements are reconstructed in parallel. */
+#define RECONSTRUCT_PARALLEL_GRAIN_SIZE 4096
+
+/**
+ * Convert the data of a block to the current DNA. Large arrays (e.g. the vertices and loops of
+ * meshes in old files) are split up into chunks which are converted in parallel.
+ */
+static void *read_struct_reconstruct(FileData *fd, const BHead *bh, const void *data)
+{
+  using namespace blender;
+  const int block_size = DNA_struct_reconstruct_block_size(fd->reconstruct_info, bh->SDNAnr);
+  if (bh->nr < RECONSTRUCT_PARALLEL_GRAIN_SIZE * 2 || block_size == 0) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, data);
+  }
+
+  void *new_blocks = MEM_callocN(size_t(bh->nr) * size_t(block_size), "reconstruct");
+  threading::parallel_for(
+      IndexRange(bh->nr), RECONSTRUCT_PARALLEL_GRAIN_SIZE, [&](const IndexRange range) {
+        DNA_struct_reconstruct_range(fd->reconstruct_info,
+                                     bh->SDNAnr,
+                                     int(range.start()),
+                                     int(range.size()),
+                                     data,
+                                     new_blocks);
+      });
+  return new_blocks;
+}
+
 static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
 {
   void *temp = nullptr;
@@ -1771,16 +1816,23 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
 
     if (fd->compflags[bh->SDNAnr] != SDNA_CMP_REMOVED) {
       if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+        const void *data = (bh + 1);
 #ifdef USE_BHEAD_READ_ON_DEMAND
         if (BHEADN_FROM_BHEAD(bh)->has_data == false) {
-          bh = blo_bhead_read_full(fd, bh);
-          if (UNLIKELY(bh == nullptr)) {
-            fd->flags &= ~FD_FLAGS_FILE_OK;
-            return nullptr;
+          /* Reconstruct straight from the mapped file when possible,
+           * instead of reading the whole block into a temporary copy first. */
+          data = blo_bhead_peek_data(fd, bh);
+          if (data == nullptr) {
+            bh = blo_bhead_read_full(fd, bh);
+            if (UNLIKELY(bh == nullptr)) {
+              fd->flags &= ~FD_FLAGS_FILE_OK;
+              return nullptr;
+            }
+            data = (bh + 1);
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+        temp = read_struct_reconstruct(fd, bh, data);
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -3972,6 +4024,14 @@ static int verg_bheadsort(const void *v1, const void *v2)
   return 0;
 }
 
+/**
+ * Build the lookup table used to find the blocks of ID pointers when expanding linked data.
+ *
+ * Only ID blocks are added: expanding never resolves pointers to other data, and large files
+ * contain orders of magnitude more #DATA blocks than IDs. Keeping them out of the table makes
+ * linking a few IDs from a huge library scale with the number of IDs instead of the number of
+ * blocks in the file.
+ */
 static void sort_bhead_old_map(FileData *fd)
 {
   BHead *bhead;
@@ -3979,7 +4039,9 @@ static void sort_bhead_old_map(FileData *fd)
   int tot = 0;
 
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    tot++;
+    if (blo_bhead_is_id(bhead)) {
+      tot++;
+    }
   }
 
   fd->tot_bheadmap = tot;
@@ -3990,9 +4052,12 @@ static void sort_bhead_old_map(FileData *fd)
   bhs = fd->bheadmap = static_cast<BHeadSort *>(
       MEM_malloc_arrayN(tot, sizeof(BHeadSort), "BHeadSort"));
 
-  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead), bhs++) {
-    bhs->bhead = bhead;
-    bhs->old = bhead->old;
+  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (blo_bhead_is_id(bhead)) {
+      bhs->bhead = bhead;
+      bhs->old = bhead->old;
+      bhs++;
+    }
   }
 
   qsort(fd->bheadmap, tot, sizeof(BHeadSort), verg_bheadsort);
@@ -25,6 +25,9 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_hash_mm2a.h"
+#include "BLI_mmap.h"
+#include "BLI_task.h"
 
 #include "BLO_readfile.h"
 #include "BLO_undofile.h"
@@ -43,7 +46,7 @@ void BLO_memfile_free(MemFile *memfile)
   MemFileChunk *chunk;
 
   while ((chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks)))) {
-    if (chunk->is_identical == false) {
+    if (chunk->is_buffer_shared == false) {
       MEM_freeN((void *)chunk->buf);
     }
     MEM_freeN(chunk);
@@ -51,6 +54,42 @@ void BLO_memfile_free(MemFile *memfile)
   memfile->size = 0;
 }
 
+/** Background pool freeing the chunks of deleted undo steps, created on first use. */
+static TaskPool *memfile_free_task_pool = nullptr;
+
+static void memfile_free_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  BLO_memfile_free(static_cast<MemFile *>(taskdata));
+}
+
+void BLO_memfile_free_deferred(MemFile *memfile)
+{
+  if (BLI_listbase_is_empty(&memfile->chunks)) {
+    return;
+  }
+
+  if (memfile_free_task_pool == nullptr) {
+    memfile_free_task_pool = BLI_task_pool_create_background(nullptr, TASK_PRIORITY_LOW);
+  }
+
+  /* Take over the chunks, the caller is free to free the #MemFile itself right away. */
+  MemFile *memfile_taken = static_cast<MemFile *>(MEM_mallocN(sizeof(MemFile), __func__));
+  *memfile_taken = *memfile;
+  BLI_listbase_clear(&memfile->chunks);
+  memfile->size = 0;
+
+  BLI_task_pool_push(memfile_free_task_pool, memfile_free_task, memfile_taken, true, nullptr);
+}
+
+void BLO_memfile_free_deferred_wait()
+{
+  if (memfile_free_task_pool != nullptr) {
+    BLI_task_pool_work_and_wait(memfile_free_task_pool);
+    BLI_task_pool_free(memfile_free_task_pool);
+    memfile_free_task_pool = nullptr;
+  }
+}
+
 void BLO_memfile_merge(MemFile *first, MemFile *second)
 {
   /* We use this mapping to store the memory buffers from second memfile chunks which are not owned
@@ -61,8 +100,9 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
   /* First, detect all memchunks in second memfile that are not owned by it. */
   for (MemFileChunk *sc = static_cast<MemFileChunk *>(second->chunks.first); sc != nullptr;
        sc = static_cast<MemFileChunk *>(sc->next)) {
-    if (sc->is_identical) {
-      BLI_ghash_insert(buffer_to_second_memchunk, (void *)sc->buf, sc);
+    if (sc->is_buffer_shared) {
+      /* Several chunks may share the same buffer, any of them can take over ownership. */
+      BLI_ghash_reinsert(buffer_to_second_memchunk, (void *)sc->buf, sc, nullptr, nullptr);
     }
   }
 
@@ -70,13 +110,14 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
    * it is also used by the second memfile, transfer the ownership. */
   for (MemFileChunk *fc = static_cast<MemFileChunk *>(first->chunks.first); fc != nullptr;
        fc = static_cast<MemFileChunk *>(fc->next)) {
-    if (!fc->is_identical) {
+    if (!fc->is_buffer_shared) {
       MemFileChunk *sc = static_cast<MemFileChunk *>(
           BLI_ghash_lookup(buffer_to_second_memchunk, fc->buf));
       if (sc != nullptr) {
-        BLI_assert(sc->is_identical);
+        BLI_assert(sc->is_buffer_shared);
+        sc->is_buffer_shared = false;
         sc->is_identical = false;
-        fc->is_identical = true;
+        fc->is_buffer_shared = true;
       }
       /* Note that if the second memfile does not use that chunk, we assume that the first one
        * fully owns it without sharing it with any other memfile, and hence it should be freed with
@@ -96,6 +137,17 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+/**
+ * Only the size and both ends of the chunk are hashed, so that hashing is cheap. Collisions are
+ * resolved by comparing the whole content.
+ */
+static uint memfile_chunk_hash(const char *buf, const size_t size)
+{
+  const size_t sample_size = MIN2(size, size_t(64));
+  const uint hash = BLI_hash_mm2((const uchar *)buf, sample_size, uint(size));
+  return BLI_hash_mm2((const uchar *)buf + size - sample_size, sample_size, hash);
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
@@ -112,6 +164,16 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
    * current Main data-base broke the order matching with the memchunks from previous step.
    */
   if (reference_memfile != nullptr) {
+    mem_data->hash_to_reference_chunk = BLI_ghash_new(
+        BLI_ghashutil_inthash_p_simple, BLI_ghashutil_intcmp, __func__);
+    LISTBASE_FOREACH (MemFileChunk *, mem_chunk, &reference_memfile->chunks) {
+      BLI_ghash_reinsert(mem_data->hash_to_reference_chunk,
+                         POINTER_FROM_UINT(mem_chunk->hash),
+                         mem_chunk,
+                         nullptr,
+                         nullptr);
+    }
+
     mem_data->id_session_uuid_mapping = BLI_ghash_new(
         BLI_ghashutil_inthash_p_simple, BLI_ghashutil_intcmp, __func__);
     uint current_session_uuid = MAIN_ID_SESSION_UUID_UNSET;
@@ -137,6 +199,9 @@ void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
   if (mem_data->id_session_uuid_mapping != nullptr) {
     BLI_ghash_free(mem_data->id_session_uuid_mapping, nullptr, nullptr);
   }
+  if (mem_data->hash_to_reference_chunk != nullptr) {
+    BLI_ghash_free(mem_data->hash_to_reference_chunk, nullptr, nullptr);
+  }
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -149,6 +214,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   curchunk->size = size;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
+  curchunk->is_buffer_shared = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
@@ -162,13 +228,32 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
     if (compchunk->size == curchunk->size) {
       if (memcmp(compchunk->buf, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
+        curchunk->hash = compchunk->hash;
         curchunk->is_identical = true;
+        curchunk->is_buffer_shared = true;
         compchunk->is_identical_future = true;
       }
     }
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
+  if (curchunk->buf == nullptr) {
+    curchunk->hash = memfile_chunk_hash(buf, size);
+
+    /* The same content may still exist elsewhere in the previous step (e.g. when data was
+     * inserted before it), share its memory then. This chunk is not considered identical, since
+     * the content does not belong to the same part of the ID in the previous step. */
+    if (mem_data->hash_to_reference_chunk != nullptr) {
+      MemFileChunk *refchunk = static_cast<MemFileChunk *>(
+          BLI_ghash_lookup(mem_data->hash_to_reference_chunk, POINTER_FROM_UINT(curchunk->hash)));
+      if (refchunk != nullptr && refchunk->size == size &&
+          memcmp(refchunk->buf, buf, size) == 0) {
+        curchunk->buf = refchunk->buf;
+        curchunk->is_buffer_shared = true;
+      }
+    }
+  }
+
   /* not equal... */
   if (curchunk->buf == nullptr) {
     char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
@@ -199,6 +284,64 @@ struct Main *BLO_memfile_main_get(struct MemFile *memfile,
   return bmain_undo;
 }
 
+/**
+ * Update an existing file in place, only writing the chunks of \a memfile that differ from the
+ * current file contents. When little changed since the previous auto-save, this avoids writing
+ * the whole file again.
+ *
+ * \return false when the existing file can't be updated in place (it doesn't exist, is larger
+ * than the new data since files are never truncated here, or a write failed).
+ * The whole file has to be written then.
+ */
+static bool memfile_write_file_incremental(MemFile *memfile, const char *filepath, int oflags)
+{
+  size_t memfile_len = 0;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    memfile_len += chunk->size;
+  }
+
+  const int file = BLI_open(filepath, oflags, 0666);
+  if (file == -1) {
+    return false;
+  }
+
+  const size_t file_len = size_t(BLI_lseek(file, 0, SEEK_END));
+  BLI_mmap_file *mmap_file = (file_len > 0 && file_len <= memfile_len) ? BLI_mmap_open(file) :
+                                                                         nullptr;
+  if (mmap_file == nullptr) {
+    close(file);
+    return false;
+  }
+  const char *file_data = static_cast<const char *>(BLI_mmap_get_pointer(mmap_file));
+
+  bool success = true;
+  size_t offset = 0;
+  LISTBASE_FOREACH (MemFileChunk *, chunk, &memfile->chunks) {
+    const bool is_unchanged = (offset + chunk->size <= file_len) &&
+                              (memcmp(file_data + offset, chunk->buf, chunk->size) == 0);
+    if (!is_unchanged) {
+      if (BLI_lseek(file, int64_t(offset), SEEK_SET) == -1) {
+        success = false;
+        break;
+      }
+#ifdef _WIN32
+      if (size_t(write(file, chunk->buf, uint(chunk->size))) != chunk->size)
+#else
+      if (size_t(write(file, chunk->buf, chunk->size)) != chunk->size)
+#endif
+      {
+        success = false;
+        break;
+      }
+    }
+    offset += chunk->size;
+  }
+
+  BLI_mmap_free(mmap_file);
+  close(file);
+  return success;
+}
+
 bool BLO_memfile_write_file(struct MemFile *memfile, const char *filepath)
 {
   MemFileChunk *chunk;
@@ -220,6 +363,13 @@ bool BLO_memfile_write_file(struct MemFile *memfile, const char *filepath)
 #    warning "Symbolic links will be followed on undo save, possibly causing CVE-2008-1103"
 #  endif
 #endif
+
+  /* Most of the time only a few IDs changed since the last auto-save. */
+  const int oflags_update = (oflags & ~(O_WRONLY | O_CREAT | O_TRUNC)) | O_RDWR;
+  if (memfile_write_file_incremental(memfile, filepath, oflags_update)) {
+    return true;
+  }
+
   file = BLI_open(filepath, oflags, 0666);
 
   if (file == -1) {
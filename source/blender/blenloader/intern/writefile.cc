@@ -177,6 +177,13 @@ struct WriteWrap {
     int level;
     ListBase frames;
 
+    /**
+     * Compression contexts that are not used by any task right now (as #LinkData).
+     * Creating a context for every frame means reallocating and clearing all the internal
+     * tables of the compressor every megabyte, so they are reused across tasks instead.
+     */
+    ListBase free_contexts;
+
     bool write_error;
   } zstd;
 };
@@ -219,14 +226,23 @@ static void *zstd_write_task(void *userdata)
   ZstdWriteBlockTask *task = static_cast<ZstdWriteBlockTask *>(userdata);
   WriteWrap *ww = task->ww;
 
+  BLI_mutex_lock(&ww->zstd.mutex);
+  LinkData *context_link = static_cast<LinkData *>(BLI_pophead(&ww->zstd.free_contexts));
+  BLI_mutex_unlock(&ww->zstd.mutex);
+  if (context_link == nullptr) {
+    context_link = BLI_genericNodeN(ZSTD_createCCtx());
+  }
+  ZSTD_CCtx *ctx = static_cast<ZSTD_CCtx *>(context_link->data);
+
   size_t out_buf_len = ZSTD_compressBound(task->size);
   void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  size_t out_size = ZSTD_compressCCtx(
+      ctx, out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
 
   MEM_freeN(task->data);
 
   BLI_mutex_lock(&ww->zstd.mutex);
+  BLI_addtail(&ww->zstd.free_contexts, context_link);
 
   while (ww->zstd.next_frame != task->frame_number) {
     BLI_condition_wait(&ww->zstd.condition, &ww->zstd.mutex);
@@ -318,6 +334,11 @@ static bool ww_close_zstd(WriteWrap *ww)
   BLI_threadpool_end(&ww->zstd.threadpool);
   BLI_freelistN(&ww->zstd.tasks);
 
+  LISTBASE_FOREACH (LinkData *, context_link, &ww->zstd.free_contexts) {
+    ZSTD_freeCCtx(static_cast<ZSTD_CCtx *>(context_link->data));
+  }
+  BLI_freelistN(&ww->zstd.free_contexts);
+
   BLI_mutex_end(&ww->zstd.mutex);
   BLI_condition_end(&ww->zstd.condition);
 
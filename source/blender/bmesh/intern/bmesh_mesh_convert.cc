@@ -69,6 +69,8 @@
  *   These indices are also used to maintain correct indices for hook modifiers and vertex parents.
  */
 
+#include <atomic>
+
 #include "DNA_key_types.h"
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -924,9 +926,8 @@ static void convert_bmesh_selection_flags_to_mesh_attributes(BMesh &bm,
 
 void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMeshParams *params)
 {
-  BMVert *v, *eve;
-  BMEdge *e;
-  BMFace *f;
+  using namespace blender;
+  BMVert *eve;
   BMIter iter;
   int i, j;
 
@@ -971,99 +972,119 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMesh
   MutableSpan<MPoly> mpoly = me->polys_for_write();
   MutableSpan<MLoop> mloop = me->loops_for_write();
 
-  bool need_select_vert = false;
-  bool need_select_edge = false;
-  bool need_select_poly = false;
-  bool need_hide_vert = false;
-  bool need_hide_edge = false;
-  bool need_hide_poly = false;
-  bool need_material_index = false;
+  /* The elements are converted in parallel, which requires valid indices and lookup tables.
+   * The flags are found per range of elements and combined afterwards. */
+  BM_mesh_elem_index_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_EDGE | BM_FACE);
+
+  std::atomic<bool> need_select_vert = false;
+  std::atomic<bool> need_select_edge = false;
+  std::atomic<bool> need_select_poly = false;
+  std::atomic<bool> need_hide_vert = false;
+  std::atomic<bool> need_hide_edge = false;
+  std::atomic<bool> need_hide_poly = false;
+  std::atomic<bool> need_material_index = false;
+
+  threading::parallel_for(mvert.index_range(), 1024, [&](const IndexRange range) {
+    bool any_hidden = false;
+    bool any_selected = false;
+    for (const int i : range) {
+      BMVert *v = BM_vert_at_index(bm, i);
+      copy_v3_v3(mvert[i].co, v->co);
+
+      any_hidden |= BM_elem_flag_test_bool(v, BM_ELEM_HIDDEN);
+      any_selected |= BM_elem_flag_test_bool(v, BM_ELEM_SELECT);
 
-  i = 0;
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    copy_v3_v3(mvert[i].co, v->co);
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->vdata, &me->vdata, v->head.data, i);
 
-    if (BM_elem_flag_test(v, BM_ELEM_HIDDEN)) {
+      BM_CHECK_ELEMENT(v);
+    }
+    if (any_hidden) {
       need_hide_vert = true;
     }
-    if (BM_elem_flag_test(v, BM_ELEM_SELECT)) {
+    if (any_selected) {
       need_select_vert = true;
     }
+  });
 
-    BM_elem_index_set(v, i); /* set_inline */
-
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->vdata, &me->vdata, v->head.data, i);
-
-    i++;
+  threading::parallel_for(medge.index_range(), 1024, [&](const IndexRange range) {
+    bool any_hidden = false;
+    bool any_selected = false;
+    for (const int i : range) {
+      BMEdge *e = BM_edge_at_index(bm, i);
+      medge[i].v1 = BM_elem_index_get(e->v1);
+      medge[i].v2 = BM_elem_index_get(e->v2);
 
-    BM_CHECK_ELEMENT(v);
-  }
-  bm->elem_index_dirty &= ~BM_VERT;
+      medge[i].flag = BM_edge_flag_to_mflag(e);
+      any_hidden |= BM_elem_flag_test_bool(e, BM_ELEM_HIDDEN);
+      any_selected |= BM_elem_flag_test_bool(e, BM_ELEM_SELECT);
 
-  i = 0;
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    medge[i].v1 = BM_elem_index_get(e->v1);
-    medge[i].v2 = BM_elem_index_get(e->v2);
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->edata, &me->edata, e->head.data, i);
 
-    medge[i].flag = BM_edge_flag_to_mflag(e);
-    if (BM_elem_flag_test(e, BM_ELEM_HIDDEN)) {
+      BM_CHECK_ELEMENT(e);
+    }
+    if (any_hidden) {
       need_hide_edge = true;
     }
-    if (BM_elem_flag_test(e, BM_ELEM_SELECT)) {
+    if (any_selected) {
       need_select_edge = true;
     }
+  });
 
-    BM_elem_index_set(e, i); /* set_inline */
+  j = 0;
+  for (const int i : mpoly.index_range()) {
+    mpoly[i].loopstart = j;
+    j += BM_face_at_index(bm, i)->len;
+  }
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->edata, &me->edata, e->head.data, i);
+  threading::parallel_for(mpoly.index_range(), 1024, [&](const IndexRange range) {
+    bool any_hidden = false;
+    bool any_selected = false;
+    bool any_material = false;
+    for (const int i : range) {
+      BMFace *f = BM_face_at_index(bm, i);
+      BMLoop *l_iter, *l_first;
+      mpoly[i].totloop = f->len;
+      any_material |= f->mat_nr != 0;
+      mpoly[i].flag = BM_face_flag_to_mflag(f);
+      any_hidden |= BM_elem_flag_test_bool(f, BM_ELEM_HIDDEN);
+      any_selected |= BM_elem_flag_test_bool(f, BM_ELEM_SELECT);
+
+      int loop_i = mpoly[i].loopstart;
+      l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+      do {
+        mloop[loop_i].e = BM_elem_index_get(l_iter->e);
+        mloop[loop_i].v = BM_elem_index_get(l_iter->v);
+
+        /* Copy over custom-data. */
+        CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, loop_i);
+
+        loop_i++;
+        BM_CHECK_ELEMENT(l_iter);
+        BM_CHECK_ELEMENT(l_iter->e);
+        BM_CHECK_ELEMENT(l_iter->v);
+      } while ((l_iter = l_iter->next) != l_first);
 
-    i++;
-    BM_CHECK_ELEMENT(e);
-  }
-  bm->elem_index_dirty &= ~BM_EDGE;
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->pdata, &me->pdata, f->head.data, i);
 
-  i = 0;
-  j = 0;
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_iter, *l_first;
-    mpoly[i].loopstart = j;
-    mpoly[i].totloop = f->len;
-    if (f->mat_nr != 0) {
-      need_material_index = true;
+      BM_CHECK_ELEMENT(f);
     }
-    mpoly[i].flag = BM_face_flag_to_mflag(f);
-    if (BM_elem_flag_test(f, BM_ELEM_HIDDEN)) {
+    if (any_hidden) {
       need_hide_poly = true;
     }
-    if (BM_elem_flag_test(f, BM_ELEM_SELECT)) {
+    if (any_selected) {
       need_select_poly = true;
     }
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      mloop[j].e = BM_elem_index_get(l_iter->e);
-      mloop[j].v = BM_elem_index_get(l_iter->v);
-
-      /* Copy over custom-data. */
-      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
-
-      j++;
-      BM_CHECK_ELEMENT(l_iter);
-      BM_CHECK_ELEMENT(l_iter->e);
-      BM_CHECK_ELEMENT(l_iter->v);
-    } while ((l_iter = l_iter->next) != l_first);
-
-    if (f == bm->act_face) {
-      me->act_face = i;
+    if (any_material) {
+      need_material_index = true;
     }
+  });
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->pdata, &me->pdata, f->head.data, i);
-
-    i++;
-    BM_CHECK_ELEMENT(f);
+  if (bm->act_face) {
+    me->act_face = BM_elem_index_get(bm->act_face);
   }
 
   if (need_material_index) {
@@ -17,6 +17,7 @@
 #include "BLI_array.h"
 #include "BLI_math.h"
 #include "BLI_memarena.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_curveprofile.h"
@@ -2129,6 +2130,25 @@ static void calculate_profile_segments(const Profile *profile,
  * the coordinate values for the power of 2 >= bp->seg, because the ADJ pattern needs power-of-2
  * boundaries during construction.
  */
+/**
+ * Allocate the profile coordinates if they weren't already. This is separate from
+ * #calculate_profile so the allocations can be done before calculating profiles in parallel.
+ */
+static void profile_coords_ensure(BevelParams *bp, Profile *pro)
+{
+  if (pro->prof_co != NULL) {
+    return;
+  }
+  pro->prof_co = (float *)BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->seg + 1));
+  if (bp->seg != bp->pro_spacing.seg_2) {
+    pro->prof_co_2 = (float *)BLI_memarena_alloc(bp->mem_arena,
+                                                 sizeof(float[3]) * (bp->pro_spacing.seg_2 + 1));
+  }
+  else {
+    pro->prof_co_2 = pro->prof_co;
+  }
+}
+
 static void calculate_profile(BevelParams *bp, BoundVert *bndv, bool reversed, bool miter)
 {
   Profile *pro = &bndv->profile;
@@ -2139,16 +2159,7 @@ static void calculate_profile(BevelParams *bp, BoundVert *bndv, bool reversed, b
   }
 
   bool need_2 = bp->seg != bp->pro_spacing.seg_2;
-  if (pro->prof_co == NULL) {
-    pro->prof_co = (float *)BLI_memarena_alloc(bp->mem_arena, sizeof(float[3]) * (bp->seg + 1));
-    if (need_2) {
-      pro->prof_co_2 = (float *)BLI_memarena_alloc(bp->mem_arena,
-                                                   sizeof(float[3]) * (bp->pro_spacing.seg_2 + 1));
-    }
-    else {
-      pro->prof_co_2 = pro->prof_co;
-    }
-  }
+  profile_coords_ensure(bp, pro);
 
   bool use_map;
   float map[4][4];
@@ -5923,6 +5934,90 @@ static void bevel_vert_two_edges(BevelParams *bp, BMesh *bm, BevVert *bv)
 
 /* Given that the boundary is built, now make the actual BMVerts
  * for the boundary and the interior of the vertex mesh. */
+/**
+ * Special case: just two beveled edges welded together.
+ * Find the two BoundVerts involved in the weld, which are null when there is no weld.
+ */
+static bool vmesh_weld_find(BevVert *bv, BoundVert **r_weld1, BoundVert **r_weld2)
+{
+  VMesh *vm = bv->vmesh;
+  *r_weld1 = NULL;
+  *r_weld2 = NULL;
+  if (!((bv->selcount == 2) && (vm->count == 2))) {
+    return false;
+  }
+  BoundVert *bndv = vm->boundstart;
+  do {
+    if (bndv->ebev) {
+      if (!*r_weld1) {
+        *r_weld1 = bndv;
+      }
+      else { /* Get the last of the two BoundVerts. */
+        *r_weld2 = bndv;
+      }
+    }
+  } while ((bndv = bndv->next) != vm->boundstart);
+  return true;
+}
+
+/**
+ * Calculate the profiles of the vertex mesh, the last step before the actual mesh vertices are
+ * created by #build_vmesh. This doesn't change the #BMesh or allocate memory from the arena,
+ * (see #profile_coords_ensure) so it can run for multiple vertices in parallel.
+ */
+static void build_vmesh_profiles(BevelParams *bp, BevVert *bv)
+{
+  /* Move profile planes if this is a weld case. */
+  BoundVert *weld1, *weld2;
+  if (vmesh_weld_find(bv, &weld1, &weld2) && weld2) {
+    set_profile_params(bp, bv, weld1);
+    set_profile_params(bp, bv, weld2);
+    move_weld_profile_planes(bv, weld1, weld2);
+  }
+
+  /* It's simpler to calculate all profiles only once at a single moment, so keep just a single
+   * profile calculation here. */
+  calculate_vm_profiles(bp, bv, bv->vmesh);
+}
+
+typedef struct BuildVMeshProfilesData {
+  BevelParams *bp;
+  BevVert **bevverts;
+} BuildVMeshProfilesData;
+
+static void build_vmesh_profiles_cb(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  BuildVMeshProfilesData *data = userdata;
+  build_vmesh_profiles(data->bp, data->bevverts[i]);
+}
+
+static void build_vmesh_profiles_all(BevelParams *bp, BevVert **bevverts, const int bevverts_len)
+{
+  if (bp->seg > 1) {
+    for (int i = 0; i < bevverts_len; i++) {
+      BoundVert *bndv = bevverts[i]->vmesh->boundstart;
+      do {
+        profile_coords_ensure(bp, &bndv->profile);
+      } while ((bndv = bndv->next) != bevverts[i]->vmesh->boundstart);
+    }
+  }
+
+  BuildVMeshProfilesData data = {
+      .bp = bp,
+      .bevverts = bevverts,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, bevverts_len, &data, build_vmesh_profiles_cb, &settings);
+}
+
+/**
+ * Build the mesh around the vertex. The profiles must have been calculated already, see
+ * #build_vmesh_profiles.
+ */
 static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
 {
   VMesh *vm = bv->vmesh;
@@ -5936,9 +6031,9 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
                                            sizeof(NewVert) * n * (ns2 + 1) * (ns + 1));
 
   /* Special case: just two beveled edges welded together. */
-  const bool weld = (bv->selcount == 2) && (vm->count == 2);
-  BoundVert *weld1 = NULL; /* Will hold two BoundVerts involved in weld. */
-  BoundVert *weld2 = NULL;
+  BoundVert *weld1; /* Will hold two BoundVerts involved in weld. */
+  BoundVert *weld2;
+  const bool weld = vmesh_weld_find(bv, &weld1, &weld2);
 
   /* Make (i, 0, 0) mesh verts for all i boundverts. */
   BoundVert *bndv = vm->boundstart;
@@ -5947,25 +6042,8 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
     copy_v3_v3(mesh_vert(vm, i, 0, 0)->co, bndv->nv.co); /* Mesh NewVert to boundary NewVert. */
     create_mesh_bmvert(bm, vm, i, 0, 0, bv->v);          /* Create BMVert for that NewVert. */
     bndv->nv.v = mesh_vert(vm, i, 0, 0)->v; /* Use the BMVert for the BoundVert's NewVert. */
-
-    /* Find boundverts and move profile planes if this is a weld case. */
-    if (weld && bndv->ebev) {
-      if (!weld1) {
-        weld1 = bndv;
-      }
-      else { /* Get the last of the two BoundVerts. */
-        weld2 = bndv;
-        set_profile_params(bp, bv, weld1);
-        set_profile_params(bp, bv, weld2);
-        move_weld_profile_planes(bv, weld1, weld2);
-      }
-    }
   } while ((bndv = bndv->next) != vm->boundstart);
 
-  /* It's simpler to calculate all profiles only once at a single moment, so keep just a single
-   * profile calculation here, the last point before actual mesh verts are created. */
-  calculate_vm_profiles(bp, bv, vm);
-
   /* Create new vertices and place them based on the profiles. */
   /* Copy other ends to (i, 0, ns) for all i, and fill in profiles for edges. */
   bndv = vm->boundstart;
@@ -7851,14 +7929,25 @@ void BM_mesh_bevel(BMesh *bm,
     }
   }
 
-  /* Build the meshes around vertices, now that positions are final. */
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-      bv = find_bevvert(&bp, v);
-      if (bv) {
-        build_vmesh(&bp, bm, bv);
+  /* Build the meshes around vertices, now that positions are final.
+   * The profiles are calculated in parallel first, creating the geometry is done after that
+   * since it modifies the #BMesh. */
+  {
+    BevVert **bevverts = MEM_mallocN(sizeof(*bevverts) * BLI_ghash_len(bp.vert_hash), __func__);
+    int bevverts_len = 0;
+    BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
+      if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
+        bv = find_bevvert(&bp, v);
+        if (bv) {
+          bevverts[bevverts_len++] = bv;
+        }
       }
     }
+    build_vmesh_profiles_all(&bp, bevverts, bevverts_len);
+    for (int i = 0; i < bevverts_len; i++) {
+      build_vmesh(&bp, bm, bevverts[i]);
+    }
+    MEM_freeN(bevverts);
   }
 
   /* Build polygons for edges. */
@@ -33,6 +33,9 @@ eExecutionModel CompositorContext::get_execution_model() const
     BLI_assert(bnodetree_ != nullptr);
     switch (bnodetree_->execution_mode) {
       case 1:
+      case 2:
+        /* The GPU execution mode only falls back to the CPU compositor when the node tree is not
+         * supported by the realtime compositor. */
         return eExecutionModel::FullFrame;
       case 0:
         return eExecutionModel::Tiled;
@@ -4,6 +4,8 @@
 #include "COM_ExecutionModel.h"
 #include "COM_CompositorContext.h"
 
+#include "BKE_node_runtime.hh"
+
 namespace blender::compositor {
 
 ExecutionModel::ExecutionModel(CompositorContext &context, Span<NodeOperation *> operations)
@@ -17,6 +19,12 @@ ExecutionModel::ExecutionModel(CompositorContext &context, Span<NodeOperation *>
                               viewer_border->ymin < viewer_border->ymax;
   border_.viewer_border = viewer_border;
 
+  /* The viewer border takes precedence, as it is usually smaller than the visible region. */
+  border_.use_backdrop_border = !border_.use_viewer_border &&
+                                node_tree->runtime->use_backdrop_border &&
+                                !context.is_rendering();
+  border_.backdrop_border = &node_tree->runtime->backdrop_border;
+
   const RenderData *rd = context_.get_render_data();
   /* Case when cropping to render border happens is handled in
    * compositor output and render layer nodes. */
@@ -30,6 +30,9 @@ class ExecutionModel {
     const rctf *render_border;
     bool use_viewer_border;
     const rctf *viewer_border;
+    /** Visible part of the viewer image in the node editor backdrop, only used by viewers. */
+    bool use_backdrop_border;
+    const rctf *backdrop_border;
   } border_;
 
   /**
@@ -3,6 +3,10 @@
 
 #include "COM_FullFrameExecutionModel.h"
 
+#include "BLI_ghash.h"
+#include "BLI_hash.hh"
+#include "BLI_hash_mm2a.h"
+
 #include "BLT_translation.h"
 
 #include "COM_Debug.h"
@@ -38,6 +42,7 @@ void FullFrameExecutionModel::execute(ExecutionSystem &exec_system)
   DebugInfo::graphviz(&exec_system, "compositor_prior_rendering");
 
   determine_areas_to_render_and_reads();
+  determine_result_keys_needed();
   render_operations();
 }
 
@@ -98,6 +103,20 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
   constexpr int output_x = 0;
   constexpr int output_y = 0;
 
+  std::optional<size_t> result_key;
+  if (active_buffers_.is_result_key_needed(op)) {
+    result_key = generate_result_key(op);
+  }
+  if (result_key && is_result_cached(op)) {
+    std::unique_ptr<MemoryBuffer> cached_buf = SharedOperationBuffers::get_cached_buffer(
+        *result_key);
+    if (cached_buf) {
+      set_rendered_buffer(op, cached_buf.release(), result_key);
+      operation_finished(op);
+      return;
+    }
+  }
+
   const bool has_outputs = op->get_number_of_output_sockets() > 0;
   MemoryBuffer *op_buf = has_outputs ? create_operation_buffer(op, output_x, output_y) : nullptr;
   if (op->get_width() > 0 && op->get_height() > 0) {
@@ -112,13 +131,102 @@ void FullFrameExecutionModel::render_operation(NodeOperation *op)
       delete buf;
     }
   }
+  if (result_key && is_result_cached(op) && op_buf && !op_buf->is_a_single_elem()) {
+    SharedOperationBuffers::cache_buffer(*result_key, *op_buf);
+  }
+
   /* Even if operation has no resolution set the empty buffer. It will be clipped with a
    * TranslateOperation from convert resolutions if linked to an operation with resolution. */
-  active_buffers_.set_rendered_buffer(op, std::unique_ptr<MemoryBuffer>(op_buf));
+  set_rendered_buffer(op, op_buf, result_key);
 
   operation_finished(op);
 }
 
+/** Hash of the buffer area and content. */
+static size_t hash_buffer_content(MemoryBuffer &buffer)
+{
+  const rcti &rect = buffer.get_rect();
+  size_t hash = get_default_hash_4(rect.xmin, rect.xmax, rect.ymin, rect.ymax);
+  hash = BLI_ghashutil_combine_hash(hash, get_default_hash(buffer.is_a_single_elem()));
+  const size_t buffer_size = size_t(buffer.get_memory_width()) * buffer.get_memory_height() *
+                             buffer.get_elem_bytes_len();
+  return BLI_ghashutil_combine_hash(
+      hash, BLI_hash_mm2((const uchar *)buffer.get_buffer(), buffer_size, 0));
+}
+
+void FullFrameExecutionModel::set_rendered_buffer(NodeOperation *op,
+                                                  MemoryBuffer *buffer,
+                                                  std::optional<size_t> key)
+{
+  if (!key && buffer && active_buffers_.is_result_key_needed(op)) {
+    /* The operation doesn't hash its parameters, identify the result by its content. */
+    key = hash_buffer_content(*buffer);
+  }
+  if (key) {
+    active_buffers_.set_result_key(op, *key);
+  }
+  active_buffers_.set_rendered_buffer(op, std::unique_ptr<MemoryBuffer>(buffer));
+}
+
+bool FullFrameExecutionModel::is_result_cached(NodeOperation *op)
+{
+  /* Only complex operations are cached, which are the ones that are expensive in comparison to
+   * copying their result. Final renders are not cached, every frame is composited once. */
+  const NodeOperationFlags flags = op->get_flags();
+  return !context_.is_rendering() && flags.complex && !flags.is_constant_operation &&
+         op->get_number_of_output_sockets() > 0 && op->generate_params_hash().has_value();
+}
+
+void FullFrameExecutionModel::determine_result_keys_needed()
+{
+  for (NodeOperation *op : operations_) {
+    if (!active_buffers_.has_registered_reads(op) || !is_result_cached(op)) {
+      continue;
+    }
+
+    /* Keys of inputs are only needed recursively if they are generated from their own inputs,
+     * otherwise they are generated from the rendered buffer. */
+    Vector<NodeOperation *> stack;
+    stack.append(op);
+    while (stack.size() > 0) {
+      NodeOperation *operation = stack.pop_last();
+      if (active_buffers_.is_result_key_needed(operation)) {
+        continue;
+      }
+      active_buffers_.register_result_key_needed(operation);
+      if (!operation->generate_params_hash()) {
+        continue;
+      }
+      for (int i = 0; i < operation->get_number_of_input_sockets(); i++) {
+        stack.append(operation->get_input_operation(i));
+      }
+    }
+  }
+}
+
+std::optional<size_t> FullFrameExecutionModel::generate_result_key(NodeOperation *op)
+{
+  std::optional<size_t> key = op->generate_params_hash();
+  if (!key) {
+    return std::nullopt;
+  }
+
+  for (int i = 0; i < op->get_number_of_input_sockets(); i++) {
+    const std::optional<size_t> input_key = active_buffers_.get_result_key(
+        op->get_input_operation(i));
+    if (!input_key) {
+      return std::nullopt;
+    }
+    *key = BLI_ghashutil_combine_hash(*key, *input_key);
+  }
+
+  for (const rcti &area : active_buffers_.get_areas_to_render(op, 0, 0)) {
+    *key = BLI_ghashutil_combine_hash(
+        *key, get_default_hash_4(area.xmin, area.xmax, area.ymin, area.ymax));
+  }
+  return key;
+}
+
 void FullFrameExecutionModel::render_operations()
 {
   const bool is_rendering = context_.is_rendering();
@@ -241,10 +349,14 @@ void FullFrameExecutionModel::get_output_render_area(NodeOperation *output_op, r
   const bool has_viewer_border = border_.use_viewer_border &&
                                  (output_op->get_flags().is_viewer_operation ||
                                   output_op->get_flags().is_preview_operation);
+  const bool has_backdrop_border = border_.use_backdrop_border &&
+                                   output_op->get_flags().is_viewer_operation;
   const bool has_render_border = border_.use_render_border;
-  if (has_viewer_border || has_render_border) {
+  if (has_viewer_border || has_backdrop_border || has_render_border) {
     /* Get border with normalized coordinates. */
-    const rctf *norm_border = has_viewer_border ? border_.viewer_border : border_.render_border;
+    const rctf *norm_border = has_viewer_border   ? border_.viewer_border :
+                              has_backdrop_border ? border_.backdrop_border :
+                                                    border_.render_border;
 
     /* Return de-normalized border within canvas. */
     const int w = output_op->get_width();
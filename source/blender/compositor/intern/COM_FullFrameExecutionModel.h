@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "BLI_vector.hh"
 
 #include "COM_Enums.h"
@@ -81,6 +83,21 @@ class FullFrameExecutionModel : public ExecutionModel {
    */
   void determine_reads(NodeOperation *output_op);
 
+  /**
+   * Whether the result of given operation is stored in the cache shared between executions.
+   */
+  bool is_result_cached(NodeOperation *op);
+  /**
+   * Registers the operations which result key is needed to look up cached results.
+   */
+  void determine_result_keys_needed();
+  /**
+   * Generate the result key of an operation that hashes its parameters, from the result keys of
+   * its inputs and the areas to render.
+   */
+  std::optional<size_t> generate_result_key(NodeOperation *op);
+  void set_rendered_buffer(NodeOperation *op, MemoryBuffer *buffer, std::optional<size_t> key);
+
   void update_progress_bar();
 
 #ifdef WITH_CXX_GUARDEDALLOC
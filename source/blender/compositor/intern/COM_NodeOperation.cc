@@ -84,6 +84,18 @@ std::optional<NodeOperationHash> NodeOperation::generate_hash()
   return hash;
 }
 
+std::optional<size_t> NodeOperation::generate_params_hash()
+{
+  std::optional<NodeOperationHash> hash = generate_hash();
+  if (!hash) {
+    return std::nullopt;
+  }
+
+  size_t params_hash = hash->type_hash_;
+  combine_hashes(params_hash, hash->params_hash_);
+  return params_hash;
+}
+
 NodeOperationOutput *NodeOperation::get_output_socket(uint index)
 {
   return &outputs_[index];
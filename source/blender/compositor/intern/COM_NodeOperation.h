@@ -392,6 +392,13 @@ class NodeOperation {
    */
   std::optional<NodeOperationHash> generate_hash();
 
+  /**
+   * Generate a hash of the operation type and parameters. Unlike #generate_hash it doesn't depend
+   * on the linked operations, so it stays the same across executions. Requires
+   * `hash_output_params` to be implemented, otherwise `std::nullopt` is returned.
+   */
+  std::optional<size_t> generate_params_hash();
+
   unsigned int get_number_of_input_sockets() const
   {
     return inputs_.size();
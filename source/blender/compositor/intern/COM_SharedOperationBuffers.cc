@@ -2,12 +2,41 @@
  * Copyright 2021 Blender Foundation. */
 
 #include "COM_SharedOperationBuffers.h"
+#include "COM_MemoryBuffer.h"
 #include "COM_NodeOperation.h"
 
 namespace blender::compositor {
 
+/** Memory limit of the results cached between executions. */
+constexpr int64_t cache_memory_limit = int64_t(1024) * 1024 * 1024;
+
+struct CachedBuffer {
+  std::unique_ptr<MemoryBuffer> buffer;
+  int64_t memory_size;
+  uint64_t last_used;
+};
+
+struct CachedBuffers {
+  Map<size_t, CachedBuffer> buffers;
+  int64_t memory_used = 0;
+  uint64_t use_counter = 0;
+};
+
+/* Only accessed by one execution at a time, compositor executions are serialized. */
+static CachedBuffers *g_cached_buffers = nullptr;
+
+static int64_t get_buffer_memory_size(const MemoryBuffer &buffer)
+{
+  return int64_t(buffer.get_memory_width()) * buffer.get_memory_height() *
+         buffer.get_elem_bytes_len();
+}
+
 SharedOperationBuffers::BufferData::BufferData()
-    : buffer(nullptr), registered_reads(0), received_reads(0), is_rendered(false)
+    : buffer(nullptr),
+      registered_reads(0),
+      received_reads(0),
+      is_rendered(false),
+      is_result_key_needed(false)
 {
 }
 
@@ -90,4 +119,81 @@ void SharedOperationBuffers::read_finished(NodeOperation *read_op)
   }
 }
 
+void SharedOperationBuffers::register_result_key_needed(NodeOperation *op)
+{
+  get_buffer_data(op).is_result_key_needed = true;
+}
+
+bool SharedOperationBuffers::is_result_key_needed(NodeOperation *op)
+{
+  return get_buffer_data(op).is_result_key_needed;
+}
+
+void SharedOperationBuffers::set_result_key(NodeOperation *op, const size_t key)
+{
+  get_buffer_data(op).result_key = key;
+}
+
+std::optional<size_t> SharedOperationBuffers::get_result_key(NodeOperation *op)
+{
+  return get_buffer_data(op).result_key;
+}
+
+std::unique_ptr<MemoryBuffer> SharedOperationBuffers::get_cached_buffer(const size_t key)
+{
+  if (g_cached_buffers == nullptr) {
+    return nullptr;
+  }
+  CachedBuffer *cached = g_cached_buffers->buffers.lookup_ptr(key);
+  if (cached == nullptr) {
+    return nullptr;
+  }
+  cached->last_used = ++g_cached_buffers->use_counter;
+  return std::make_unique<MemoryBuffer>(*cached->buffer);
+}
+
+void SharedOperationBuffers::cache_buffer(const size_t key, const MemoryBuffer &buffer)
+{
+  const int64_t memory_size = get_buffer_memory_size(buffer);
+  /* Don't let a single result take most of the cache. */
+  if (memory_size > cache_memory_limit / 4) {
+    return;
+  }
+
+  if (g_cached_buffers == nullptr) {
+    g_cached_buffers = new CachedBuffers();
+  }
+  CachedBuffers &cache = *g_cached_buffers;
+  if (cache.buffers.contains(key)) {
+    return;
+  }
+
+  /* Free least recently used results until the buffer fits. */
+  while (cache.memory_used + memory_size > cache_memory_limit && !cache.buffers.is_empty()) {
+    size_t oldest_key = 0;
+    uint64_t oldest_use = UINT64_MAX;
+    for (const auto item : cache.buffers.items()) {
+      if (item.value.last_used < oldest_use) {
+        oldest_key = item.key;
+        oldest_use = item.value.last_used;
+      }
+    }
+    cache.memory_used -= cache.buffers.lookup(oldest_key).memory_size;
+    cache.buffers.remove(oldest_key);
+  }
+
+  CachedBuffer cached;
+  cached.buffer = std::make_unique<MemoryBuffer>(buffer);
+  cached.memory_size = memory_size;
+  cached.last_used = ++cache.use_counter;
+  cache.buffers.add_new(key, std::move(cached));
+  cache.memory_used += memory_size;
+}
+
+void SharedOperationBuffers::free_cache()
+{
+  delete g_cached_buffers;
+  g_cached_buffers = nullptr;
+}
+
 }  // namespace blender::compositor
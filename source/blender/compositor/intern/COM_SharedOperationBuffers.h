@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include "BLI_map.hh"
 #include "BLI_vector.hh"
 
@@ -20,6 +22,12 @@ class NodeOperation;
 /**
  * Stores and shares operations rendered buffers including render data. Buffers are
  * disposed once all dependent operations have finished reading them.
+ *
+ * Results of expensive operations can also be kept in a cache shared between executions, so that
+ * e.g. changing the parameters of a node after a blur doesn't render the blur again. Cached
+ * results are identified by a result key, which is a hash of the operation parameters and of the
+ * result keys of its inputs. Operations that don't hash their parameters are identified by the
+ * content of their rendered buffer instead.
  */
 class SharedOperationBuffers {
  private:
@@ -31,6 +39,9 @@ class SharedOperationBuffers {
     int registered_reads;
     int received_reads;
     bool is_rendered;
+    /** Whether a result key has to be generated, because a cached operation depends on it. */
+    bool is_result_key_needed;
+    std::optional<size_t> result_key;
   } BufferData;
   blender::Map<NodeOperation *, BufferData> buffers_;
 
@@ -77,6 +88,25 @@ class SharedOperationBuffers {
    */
   void read_finished(NodeOperation *read_op);
 
+  /**
+   * Registers that the result key of given operation is needed by a cached operation.
+   */
+  void register_result_key_needed(NodeOperation *op);
+  bool is_result_key_needed(NodeOperation *op);
+  void set_result_key(NodeOperation *op, size_t key);
+  std::optional<size_t> get_result_key(NodeOperation *op);
+
+  /**
+   * Get a copy of a result cached by a previous execution, or null when there is none.
+   */
+  static std::unique_ptr<MemoryBuffer> get_cached_buffer(size_t key);
+  /**
+   * Store a copy of the buffer in the cache shared between executions. The least recently used
+   * results are freed when the memory limit of the cache is exceeded.
+   */
+  static void cache_buffer(size_t key, const MemoryBuffer &buffer);
+  static void free_cache();
+
  private:
   BufferData &get_buffer_data(NodeOperation *op);
 
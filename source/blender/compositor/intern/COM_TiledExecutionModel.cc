@@ -41,6 +41,14 @@ TiledExecutionModel::TiledExecutionModel(CompositorContext &context,
       group->set_viewer_border(
           viewer_border->xmin, viewer_border->xmax, viewer_border->ymin, viewer_border->ymax);
     }
+    else if (border_.use_backdrop_border &&
+             group->get_output_operation()->get_flags().is_viewer_operation) {
+      const rctf *backdrop_border = border_.backdrop_border;
+      group->set_viewer_border(backdrop_border->xmin,
+                               backdrop_border->xmax,
+                               backdrop_border->ymin,
+                               backdrop_border->ymax);
+    }
   }
 }
 
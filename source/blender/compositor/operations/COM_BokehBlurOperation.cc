@@ -248,6 +248,12 @@ void BokehBlurOperation::update_size()
   sizeavailable_ = true;
 }
 
+void BokehBlurOperation::hash_output_params()
+{
+  hash_params(size_, sizeavailable_, extend_bounds_);
+  hash_param(get_quality());
+}
+
 void BokehBlurOperation::determine_canvas(const rcti &preferred_area, rcti &r_area)
 {
   if (!extend_bounds_) {
@@ -102,6 +102,18 @@ void *FastGaussianBlurOperation::initialize_tile_data(rcti *rect)
   return iirgaus_;
 }
 
+rcti FastGaussianBlurOperation::get_blur_area(const rcti &output_area,
+                                             const float sigma_x,
+                                             const float sigma_y)
+{
+  /* The weights are less than 0.04% of the center weight beyond four standard deviations. */
+  const int margin_x = int(ceilf(4.0f * sigma_x));
+  const int margin_y = int(ceilf(4.0f * sigma_y));
+  rcti blur_area = output_area;
+  BLI_rcti_pad(&blur_area, margin_x, margin_y);
+  return blur_area;
+}
+
 void FastGaussianBlurOperation::IIR_gauss(MemoryBuffer *src, float sigma, uint chan, uint xy)
 {
   BLI_assert(!src->is_a_single_elem());
@@ -251,7 +263,7 @@ void FastGaussianBlurOperation::get_area_of_interest(const int input_idx,
 {
   switch (input_idx) {
     case IMAGE_INPUT_INDEX:
-      r_input_area = this->get_canvas();
+      r_input_area = get_blur_area(output_area, sx_, sy_);
       break;
     default:
       BlurBaseOperation::get_area_of_interest(input_idx, output_area, r_input_area);
@@ -266,15 +278,20 @@ void FastGaussianBlurOperation::update_memory_buffer_started(MemoryBuffer *outpu
   /* TODO(manzanilla): Add a render test and make #IIR_gauss multi-threaded with support for
    * an output buffer. */
   const MemoryBuffer *input = inputs[IMAGE_INPUT_INDEX];
+  /* Only the area of interest of the input is rendered, so blur the part of the input around the
+   * output area. The rest of the input buffer must not be read, as it is not initialized. */
+  rcti blur_area = get_blur_area(area, sx_, sy_);
+  BLI_rcti_isect(&blur_area, &input->get_rect(), &blur_area);
+  BLI_rcti_isect(&blur_area, &output->get_rect(), &blur_area);
   MemoryBuffer *image = nullptr;
   const bool is_full_output = BLI_rcti_compare(&output->get_rect(), &area);
   if (is_full_output) {
     image = output;
   }
   else {
-    image = new MemoryBuffer(get_output_socket()->get_data_type(), area);
+    image = new MemoryBuffer(get_output_socket()->get_data_type(), blur_area);
   }
-  image->copy_from(input, area);
+  image->copy_from(input, is_full_output ? area : blur_area);
 
   if ((sx_ == sy_) && (sx_ > 0.0f)) {
     for (const int c : IndexRange(COM_DATA_TYPE_COLOR_CHANNELS)) {
@@ -385,22 +402,32 @@ void *FastGaussianBlurValueOperation::initialize_tile_data(rcti *rect)
 }
 
 void FastGaussianBlurValueOperation::get_area_of_interest(const int /*input_idx*/,
-                                                          const rcti & /*output_area*/,
+                                                          const rcti &output_area,
                                                           rcti &r_input_area)
 {
-  r_input_area = this->get_canvas();
+  r_input_area = FastGaussianBlurOperation::get_blur_area(output_area, sigma_, sigma_);
 }
 
-void FastGaussianBlurValueOperation::update_memory_buffer_started(MemoryBuffer * /*output*/,
-                                                                  const rcti & /*area*/,
+void FastGaussianBlurValueOperation::update_memory_buffer_started(MemoryBuffer *output,
+                                                                  const rcti &area,
                                                                   Span<MemoryBuffer *> inputs)
 {
-  if (iirgaus_ == nullptr) {
-    const MemoryBuffer *image = inputs[0];
-    MemoryBuffer *gauss = new MemoryBuffer(*image);
-    FastGaussianBlurOperation::IIR_gauss(gauss, sigma_, 0, 3);
-    iirgaus_ = gauss;
+  /* Blur the part of the input around every rendered area, since only the area of interest of the
+   * input is rendered. */
+  const MemoryBuffer *image = inputs[0];
+  rcti blur_area = FastGaussianBlurOperation::get_blur_area(area, sigma_, sigma_);
+  BLI_rcti_isect(&blur_area, &image->get_rect(), &blur_area);
+  BLI_rcti_isect(&blur_area, &output->get_rect(), &blur_area);
+
+  delete iirgaus_;
+  if (image->is_a_single_elem()) {
+    iirgaus_ = new MemoryBuffer(*image);
+    return;
   }
+  MemoryBuffer *gauss = new MemoryBuffer(DataType::Value, blur_area);
+  gauss->copy_from(image, blur_area);
+  FastGaussianBlurOperation::IIR_gauss(gauss, sigma_, 0, 3);
+  iirgaus_ = gauss;
 }
 
 void FastGaussianBlurValueOperation::update_memory_buffer_partial(MemoryBuffer *output,
@@ -22,6 +22,11 @@ class FastGaussianBlurOperation : public BlurBaseOperation {
   void execute_pixel(float output[4], int x, int y, void *data) override;
 
   static void IIR_gauss(MemoryBuffer *src, float sigma, unsigned int channel, unsigned int xy);
+  /**
+   * Get the area of the input needed to blur the output area, which is extended by the distance
+   * beyond which the Gaussian weights are negligible.
+   */
+  static rcti get_blur_area(const rcti &output_area, float sigma_x, float sigma_y);
   void *initialize_tile_data(rcti *rect) override;
   void init_data() override;
   void deinit_execution() override;
@@ -60,6 +60,10 @@ class Context {
    * appropriate place, which can be directly in the UI or just logged to the output stream. */
   virtual void set_info_message(StringRef message) const = 0;
 
+  /* True if viewer nodes should write to the output texture. This is false when compositing final
+   * renders, where only the composite node writes to the render result. */
+  virtual bool use_viewer_output() const;
+
   /* Get the current frame number of the active scene. */
   int get_frame_number() const;
 
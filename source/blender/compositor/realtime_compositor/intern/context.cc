@@ -23,6 +23,11 @@ float Context::get_time() const
   return frame_number / frame_rate;
 }
 
+bool Context::use_viewer_output() const
+{
+  return true;
+}
+
 TexturePool &Context::texture_pool()
 {
   return texture_pool_;
@@ -70,6 +70,16 @@ void DEG_graph_relations_update(struct Depsgraph *graph);
 /** Tag all relations in the database for update. */
 void DEG_relations_tag_update(struct Main *bmain);
 
+/**
+ * Tag relations for update after the dependencies of the given ID changed, e.g. after adding a
+ * modifier or constraint. Unlike #DEG_relations_tag_update, only graphs which contain the ID are
+ * rebuilt: nothing in the other graphs depends on the ID, so they are not affected.
+ *
+ * \note Changes that can add the ID to a graph (e.g. linking an object to a collection) have to
+ * tag the relations of the changed owner instead, or use #DEG_relations_tag_update.
+ */
+void DEG_id_relations_tag_update(struct Main *bmain, struct ID *id);
+
 /* Add Dependencies  ----------------------------- */
 
 /**
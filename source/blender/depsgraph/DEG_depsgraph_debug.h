@@ -52,6 +52,22 @@ void DEG_debug_stats_gnuplot(const struct Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Timeline */
+
+/**
+ * Begin recording which operations are evaluated by which thread and when. Events of a previous
+ * recording are discarded.
+ */
+void DEG_debug_timeline_begin(struct Depsgraph *depsgraph);
+void DEG_debug_timeline_end(struct Depsgraph *depsgraph);
+
+/**
+ * Write the recorded timeline as Trace Event Format JSON, which can be viewed with
+ * `chrome://tracing` or Perfetto.
+ */
+void DEG_debug_timeline_chrome_trace(const struct Depsgraph *depsgraph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -11,7 +11,10 @@
 
 #include "DNA_anim_types.h"
 
+#include "BLI_array.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_animsys.h"
 
@@ -66,10 +69,17 @@ uint64_t AnimatedPropertyID::hash() const
 
 namespace {
 
+/* Property animated by an F-Curve, with the ID which owns the property. This is not necessarily
+ * the ID which owns the F-Curve, to deal with cases when nested datablock is animated by its
+ * parent. */
+struct AnimatedProperty {
+  const ID *owner_id;
+  AnimatedPropertyID property_id;
+};
+
 struct AnimatedPropertyCallbackData {
   PointerRNA pointer_rna;
-  AnimatedPropertyStorage *animated_property_storage;
-  DepsgraphBuilderCache *builder_cache;
+  Vector<AnimatedProperty> *r_animated_properties;
 };
 
 void animated_property_cb(ID * /*id*/, FCurve *fcurve, void *data_v)
@@ -85,15 +95,32 @@ void animated_property_cb(ID * /*id*/, FCurve *fcurve, void *data_v)
           &data->pointer_rna, fcurve->rna_path, &pointer_rna, &property_rna)) {
     return;
   }
-  /* Get storage for the ID.
-   * This is needed to deal with cases when nested datablock is animated by its parent. */
-  AnimatedPropertyStorage *animated_property_storage = data->animated_property_storage;
-  if (pointer_rna.owner_id != data->pointer_rna.owner_id) {
-    animated_property_storage = data->builder_cache->ensureAnimatedPropertyStorage(
-        pointer_rna.owner_id);
+  data->r_animated_properties->append(
+      {pointer_rna.owner_id, AnimatedPropertyID(&pointer_rna, property_rna)});
+}
+
+/* Only reads the ID and its F-Curves, so it can be called for multiple IDs in parallel. */
+void find_animated_properties(const ID *id, Vector<AnimatedProperty> &r_animated_properties)
+{
+  AnimatedPropertyCallbackData data;
+  RNA_id_pointer_create(const_cast<ID *>(id), &data.pointer_rna);
+  data.r_animated_properties = &r_animated_properties;
+  BKE_fcurves_id_cb(const_cast<ID *>(id), animated_property_cb, &data);
+}
+
+void tag_animated_properties(DepsgraphBuilderCache *builder_cache,
+                             AnimatedPropertyStorage *id_storage,
+                             const ID *id,
+                             const Span<AnimatedProperty> animated_properties)
+{
+  for (const AnimatedProperty &animated_property : animated_properties) {
+    AnimatedPropertyStorage *animated_property_storage = id_storage;
+    if (animated_property.owner_id != id) {
+      animated_property_storage = builder_cache->ensureAnimatedPropertyStorage(
+          animated_property.owner_id);
+    }
+    animated_property_storage->tagPropertyAsAnimated(animated_property.property_id);
   }
-  /* Set the property as animated. */
-  animated_property_storage->tagPropertyAsAnimated(&pointer_rna, property_rna);
 }
 
 }  // namespace
@@ -104,11 +131,9 @@ AnimatedPropertyStorage::AnimatedPropertyStorage() : is_fully_initialized(false)
 
 void AnimatedPropertyStorage::initializeFromID(DepsgraphBuilderCache *builder_cache, const ID *id)
 {
-  AnimatedPropertyCallbackData data;
-  RNA_id_pointer_create(const_cast<ID *>(id), &data.pointer_rna);
-  data.animated_property_storage = this;
-  data.builder_cache = builder_cache;
-  BKE_fcurves_id_cb(const_cast<ID *>(id), animated_property_cb, &data);
+  Vector<AnimatedProperty> animated_properties;
+  find_animated_properties(id, animated_properties);
+  tag_animated_properties(builder_cache, this, id, animated_properties);
 }
 
 void AnimatedPropertyStorage::tagPropertyAsAnimated(const AnimatedPropertyID &property_id)
@@ -166,4 +191,25 @@ AnimatedPropertyStorage *DepsgraphBuilderCache::ensureInitializedAnimatedPropert
   return animated_property_storage;
 }
 
+void DepsgraphBuilderCache::initializeAnimatedPropertyStorages(const Span<const ID *> ids)
+{
+  /* Resolving the RNA paths is the expensive part, it's done in parallel. The storages are
+   * modified afterwards on a single thread, since F-Curves can also tag properties of other IDs.
+   */
+  Array<Vector<AnimatedProperty>> animated_properties(ids.size());
+  threading::parallel_for(ids.index_range(), 16, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      find_animated_properties(ids[i], animated_properties[i]);
+    }
+  });
+  for (const int64_t i : ids.index_range()) {
+    AnimatedPropertyStorage *animated_property_storage = ensureAnimatedPropertyStorage(ids[i]);
+    if (animated_property_storage->is_fully_initialized) {
+      continue;
+    }
+    tag_animated_properties(this, animated_property_storage, ids[i], animated_properties[i]);
+    animated_property_storage->is_fully_initialized = true;
+  }
+}
+
 }  // namespace blender::deg
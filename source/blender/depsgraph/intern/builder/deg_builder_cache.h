@@ -73,6 +73,10 @@ class DepsgraphBuilderCache {
   AnimatedPropertyStorage *ensureAnimatedPropertyStorage(const ID *id);
   AnimatedPropertyStorage *ensureInitializedAnimatedPropertyStorage(const ID *id);
 
+  /* Initialize storage for all the given IDs at once, resolving their F-Curves in parallel.
+   * Should be called before building when it's known that most of the IDs will be queried. */
+  void initializeAnimatedPropertyStorages(Span<const ID *> ids);
+
   /* Shortcuts to go through ensureInitializedAnimatedPropertyStorage and its
    * isPropertyAnimated.
    *
@@ -390,6 +390,18 @@ void DepsgraphNodeBuilder::begin_build()
     BLI_assert(!id_info_hash_.contains(id_node->id_orig_session_uuid));
     id_info_hash_.add_new(id_node->id_orig_session_uuid, id_info);
     id_node->id_cow = nullptr;
+
+    /* Keep deferred copy-on-write updates, the tag is not restored otherwise since it was already
+     * flushed. */
+    if (id_node->is_cow_update_deferred) {
+      ComponentNode *cow_comp = id_node->find_component(NodeType::COPY_ON_WRITE);
+      if (cow_comp != nullptr) {
+        OperationNode *cow_node = cow_comp->get_entry_operation();
+        if (cow_node != nullptr && (cow_node->flag & DEPSOP_FLAG_NEEDS_UPDATE)) {
+          saved_entry_tags_.append_as(cow_node);
+        }
+      }
+    }
   }
 
   for (const OperationNode *op_node : graph_->entry_tags) {
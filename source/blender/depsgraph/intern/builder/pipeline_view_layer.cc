@@ -3,6 +3,17 @@
 
 #include "pipeline_view_layer.h"
 
+#include "BLI_listbase.h"
+#include "BLI_set.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_anim_data.h"
+#include "BKE_layer.h"
+
+#include "DNA_layer_types.h"
+#include "DNA_object_types.h"
+
+#include "intern/builder/deg_builder_cache.h"
 #include "intern/builder/deg_builder_nodes.h"
 #include "intern/builder/deg_builder_relations.h"
 #include "intern/depsgraph.h"
@@ -16,6 +27,23 @@ ViewLayerBuilderPipeline::ViewLayerBuilderPipeline(::Depsgraph *graph)
 
 void ViewLayerBuilderPipeline::build_nodes(DepsgraphNodeBuilder &node_builder)
 {
+  /* The builders check animated properties of almost every object and object data in the view
+   * layer, initialize those upfront in parallel instead of on demand. */
+  Vector<const ID *> animated_ids;
+  Set<const ID *> visited_ids;
+  const auto add_id = [&](const ID *id) {
+    if (id != nullptr && BKE_animdata_from_id(const_cast<ID *>(id)) != nullptr &&
+        visited_ids.add(id)) {
+      animated_ids.append(id);
+    }
+  };
+  BKE_view_layer_synced_ensure(scene_, view_layer_);
+  LISTBASE_FOREACH (Base *, base, BKE_view_layer_object_bases_get(view_layer_)) {
+    add_id(&base->object->id);
+    add_id(static_cast<const ID *>(base->object->data));
+  }
+  builder_cache_.initializeAnimatedPropertyStorages(animated_ids);
+
   node_builder.build_view_layer(scene_, view_layer_, DEG_ID_LINKED_DIRECTLY);
 }
 
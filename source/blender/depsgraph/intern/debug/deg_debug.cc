@@ -7,6 +7,8 @@
 
 #include "intern/debug/deg_debug.h"
 
+#include <atomic>
+
 #include "BLI_console.h"
 #include "BLI_hash.h"
 #include "BLI_string.h"
@@ -16,10 +18,18 @@
 
 #include "BKE_global.h"
 
+#include "intern/node/deg_node_component.h"
+#include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
+
 namespace blender::deg {
 
 DepsgraphDebug::DepsgraphDebug()
-    : flags(G.debug), is_ever_evaluated(false), graph_evaluation_start_time_(0)
+    : flags(G.debug),
+      is_ever_evaluated(false),
+      graph_evaluation_start_time_(0),
+      is_timeline_recording_(false),
+      timeline_start_time_(0)
 {
 }
 
@@ -56,6 +66,60 @@ void DepsgraphDebug::end_graph_evaluation()
   is_ever_evaluated = true;
 }
 
+void DepsgraphDebug::begin_timeline()
+{
+  std::lock_guard lock{timeline_mutex_};
+  timeline_events.clear();
+  timeline_start_time_ = PIL_check_seconds_timer();
+  is_timeline_recording_ = true;
+}
+
+void DepsgraphDebug::end_timeline()
+{
+  is_timeline_recording_ = false;
+}
+
+bool DepsgraphDebug::do_timeline() const
+{
+  return is_timeline_recording_;
+}
+
+/* Small numbers which identify threads in the timeline, which is easier to read than the system
+ * thread identifiers. */
+static int timeline_thread_index()
+{
+  static std::atomic<int> threads_num = 0;
+  static thread_local int index = threads_num.fetch_add(1);
+  return index;
+}
+
+void DepsgraphDebug::add_timeline_event(const OperationNode *operation_node,
+                                        const double start_time,
+                                        const double end_time)
+{
+  TimelineEvent event;
+  event.name = operation_node->identifier();
+  event.id_name = operation_node->owner->owner->id_orig->name;
+  event.thread = timeline_thread_index();
+  event.start_time = start_time - timeline_start_time_;
+  event.end_time = end_time - timeline_start_time_;
+
+  std::lock_guard lock{timeline_mutex_};
+  timeline_events.append(std::move(event));
+}
+
+void DepsgraphDebug::add_timeline_graph_event(const double start_time, const double end_time)
+{
+  TimelineEvent event;
+  event.name = name.empty() ? "Depsgraph evaluation" : "Depsgraph evaluation: " + name;
+  event.thread = timeline_thread_index();
+  event.start_time = start_time - timeline_start_time_;
+  event.end_time = end_time - timeline_start_time_;
+
+  std::lock_guard lock{timeline_mutex_};
+  timeline_events.append(std::move(event));
+}
+
 bool terminal_do_color()
 {
   return (G.debug & G_DEBUG_DEPSGRAPH_PRETTY) != 0;
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "intern/debug/deg_time_average.h"
 #include "intern/depsgraph_type.h"
 
@@ -16,6 +18,20 @@
 
 namespace blender::deg {
 
+struct OperationNode;
+
+/* Evaluation of a single operation, recorded for the timeline. */
+struct TimelineEvent {
+  /* Identifier of the operation and the full name of the ID it belongs to. */
+  string name;
+  string id_name;
+  /* Index of the thread which evaluated the operation. */
+  int thread;
+  /* Seconds since the recording of the timeline began. */
+  double start_time;
+  double end_time;
+};
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
@@ -25,6 +41,20 @@ class DepsgraphDebug {
   void begin_graph_evaluation();
   void end_graph_evaluation();
 
+  /* Recording of the timeline of operation evaluations. Beginning the recording clears events of
+   * a previous recording. */
+  void begin_timeline();
+  void end_timeline();
+  bool do_timeline() const;
+  /* Thread-safe, times are in seconds as returned by #PIL_check_seconds_timer. */
+  void add_timeline_event(const OperationNode *operation_node,
+                          double start_time,
+                          double end_time);
+  /* Add an event for the whole graph evaluation. */
+  void add_timeline_graph_event(double start_time, double end_time);
+
+  Vector<TimelineEvent> timeline_events;
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -46,6 +76,10 @@ class DepsgraphDebug {
   double graph_evaluation_start_time_;
 
   AveragedTimeSampler<MAX_FPS_COUNTERS> fps_samples_;
+
+  bool is_timeline_recording_;
+  double timeline_start_time_;
+  std::mutex timeline_mutex_;
 };
 
 #define DEG_DEBUG_PRINTF(depsgraph, type, ...) \
@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Export of the recorded evaluation timeline in the Trace Event Format, which can be opened in
+ * `chrome://tracing` or Perfetto.
+ */
+
+#include "DEG_depsgraph_debug.h"
+
+#include "intern/debug/deg_debug.h"
+#include "intern/depsgraph.h"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+namespace {
+
+void write_json_string(FILE *fp, const StringRef str)
+{
+  fputc('"', fp);
+  for (const char ch : str) {
+    switch (ch) {
+      case '"':
+        fputs("\\\"", fp);
+        break;
+      case '\\':
+        fputs("\\\\", fp);
+        break;
+      case '\n':
+        fputs("\\n", fp);
+        break;
+      case '\t':
+        fputs("\\t", fp);
+        break;
+      default:
+        if ((unsigned char)ch < 0x20) {
+          fprintf(fp, "\\u%04x", ch);
+        }
+        else {
+          fputc(ch, fp);
+        }
+        break;
+    }
+  }
+  fputc('"', fp);
+}
+
+void write_event(FILE *fp, const TimelineEvent &event)
+{
+  /* Times are in microseconds. */
+  fputs("{\"ph\":\"X\",\"pid\":0,", fp);
+  fprintf(fp,
+          "\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,",
+          event.thread,
+          event.start_time * 1e6,
+          (event.end_time - event.start_time) * 1e6);
+  fputs("\"name\":", fp);
+  write_json_string(fp, event.name);
+  if (event.id_name.empty()) {
+    fputs(",\"cat\":\"Depsgraph\"}", fp);
+    return;
+  }
+  /* The ID code is used as category, so that it's possible to filter e.g. all objects. */
+  fputs(",\"cat\":", fp);
+  write_json_string(fp, StringRef(event.id_name).substr(0, 2));
+  fputs(",\"args\":{\"id\":", fp);
+  write_json_string(fp, StringRef(event.id_name).drop_prefix(2));
+  fputs("}}", fp);
+}
+
+}  // namespace
+}  // namespace blender::deg
+
+void DEG_debug_timeline_chrome_trace(const Depsgraph *depsgraph, FILE *fp)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  fputs("{\"traceEvents\":[\n", fp);
+  bool is_first = true;
+  for (const deg::TimelineEvent &event : deg_graph->debug.timeline_events) {
+    if (!is_first) {
+      fputs(",\n", fp);
+    }
+    deg::write_event(fp, event);
+    is_first = false;
+  }
+  fputs("\n],\"displayTimeUnit\":\"ms\"}\n", fp);
+}
@@ -50,6 +50,7 @@ Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluati
       need_update_nodes_visibility(true),
       need_tag_id_on_graph_visibility_update(true),
       need_tag_id_on_graph_visibility_time_update(false),
+      is_time_flush_cached(false),
       bmain(bmain),
       scene(scene),
       view_layer(view_layer),
@@ -232,6 +233,9 @@ void Depsgraph::clear_all_nodes()
   clear_id_nodes();
   delete time_source;
   time_source = nullptr;
+  time_flush_operations.clear();
+  time_flush_components.clear();
+  is_time_flush_cached = false;
 }
 
 ID *Depsgraph::get_cow_id(const ID *id_orig) const
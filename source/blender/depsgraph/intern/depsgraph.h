@@ -33,6 +33,7 @@ struct ViewLayer;
 
 namespace blender::deg {
 
+struct ComponentNode;
 struct IDNode;
 struct Node;
 struct OperationNode;
@@ -113,6 +114,13 @@ struct Depsgraph {
   /* Nodes which have been tagged as "directly modified". */
   Set<OperationNode *> entry_tags;
 
+  /* Operations and components which an update of only the time source is flushed to, collected
+   * by the first flush of such an update after the graph was built. Frame changes use them to
+   * tag the time dependent part of the graph without traversing its relations. */
+  Vector<OperationNode *> time_flush_operations;
+  Vector<ComponentNode *> time_flush_components;
+  bool is_time_flush_cached;
+
   /* Convenience Data ................... */
 
   /* XXX: should be collected after building (if actually needed?) */
@@ -29,6 +29,7 @@
 #include "DEG_depsgraph.h"
 #include "DEG_depsgraph_build.h"
 #include "DEG_depsgraph_debug.h"
+#include "DEG_depsgraph_query.h"
 
 #include "builder/deg_builder_relations.h"
 #include "builder/pipeline_all_objects.h"
@@ -305,3 +306,19 @@ void DEG_relations_tag_update(Main *bmain)
     DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
   }
 }
+
+void DEG_id_relations_tag_update(Main *bmain, ID *id)
+{
+  DEG_GLOBAL_DEBUG_PRINTF(TAG, "%s: Tagging relations of %s for update.\n", __func__, id->name);
+  ID *id_orig = DEG_get_original_id(id);
+  for (deg::Depsgraph *depsgraph : deg::get_all_registered_graphs(bmain)) {
+    if (depsgraph->need_update_relations) {
+      continue;
+    }
+    if (depsgraph->find_id_node(id_orig) == nullptr) {
+      /* Avoid rebuilding graphs of other scenes and view layers, which can be expensive. */
+      continue;
+    }
+    DEG_graph_tag_relations_update(reinterpret_cast<Depsgraph *>(depsgraph));
+  }
+}
@@ -9,13 +9,17 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+
 #include "PIL_time.h"
 
 #include "BLI_compiler_attrs.h"
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
+#include "BLI_math_base.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.h"
 
@@ -80,26 +84,49 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  bool do_timeline;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
 };
 
+/* Operations for which the evaluation of their whole critical path takes less time than this (in
+ * seconds) are not worth a separate task. */
+constexpr float cheap_critical_path_time = 20e-6f;
+
+/* Time which is assumed for operations which were never evaluated, so they are never considered to
+ * be cheap. It also makes the first evaluation prefer longer chains of operations. */
+constexpr float unknown_operation_time = 1e-3f;
+
+/* Sort the operations so that the ones with the longest critical path come first. */
+void sort_by_critical_path(MutableSpan<OperationNode *> nodes)
+{
+  std::stable_sort(nodes.begin(), nodes.end(), [](const OperationNode *a, const OperationNode *b) {
+    return a->critical_path_time > b->critical_path_time;
+  });
+}
+
 void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
 {
   ::Depsgraph *depsgraph = reinterpret_cast<::Depsgraph *>(state->graph);
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
+  /* Perform operation. The timing is always measured, as it is used to prioritize scheduling of
+   * the following evaluations. */
+  const double start_time = PIL_check_seconds_timer();
+  operation_node->evaluate(depsgraph);
+  const double end_time = PIL_check_seconds_timer();
+  const double time = end_time - start_time;
   if (state->do_stats) {
-    const double start_time = PIL_check_seconds_timer();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
+    operation_node->stats.current_time += time;
   }
-  else {
-    operation_node->evaluate(depsgraph);
+  if (state->do_timeline) {
+    state->graph->debug.add_timeline_event(operation_node, start_time, end_time);
   }
+  operation_node->average_time = (operation_node->average_time < 0.0f) ?
+                                     float(time) :
+                                     interpf(float(time), operation_node->average_time, 0.25f);
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
@@ -113,23 +140,43 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
-  OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  /* Operations which are evaluated by this task, the last one is evaluated first. */
+  Vector<OperationNode *, 16> local_queue;
+  Vector<OperationNode *, 16> ready_children;
+  local_queue.append(reinterpret_cast<OperationNode *>(taskdata));
+  while (!local_queue.is_empty()) {
+    OperationNode *operation_node = local_queue.pop_last();
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The child with the longest critical path is evaluated by this task right
+     * away, so that it does not have to wait for other tasks that are already in the queue.
+     * Children for which the whole critical path is cheap are also evaluated by this task, as
+     * pushing them to the pool would take about as much time as their evaluation. They are
+     * evaluated first, so that they don't wait for the whole chain of the expensive child. */
+    ready_children.clear();
+    schedule_children(
+        state, operation_node, [&](OperationNode *node) { ready_children.append(node); });
+    sort_by_critical_path(ready_children);
+    for (const int64_t i : ready_children.index_range()) {
+      OperationNode *node = ready_children[i];
+      if (i == 0 || node->critical_path_time < cheap_critical_path_time) {
+        local_queue.append(node);
+      }
+      else {
+        BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+      }
+    }
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
 {
   const ComponentNode *comp_node = op_node->owner;
-  /* Special case for copy on write component: it is to be always evaluated, to keep copied
-   * "database" in a consistent state. */
+  /* Special case for copy on write component: it is to be evaluated regardless of the visibility
+   * of the component, to keep copied "database" in a consistent state. Only the data-blocks which
+   * nothing visible depends on are skipped, they are copied once they become visible. */
   if (comp_node->type == NodeType::COPY_ON_WRITE) {
-    return true;
+    return !comp_node->owner->is_cow_update_deferred;
   }
 
   /* Special case for dynamic visibility pass: the actual visibility is not yet known, so limit to
@@ -173,6 +220,61 @@ void calculate_pending_parents_for_node(const DepsgraphEvalState *state, Operati
   }
 }
 
+bool is_pending_child_relation(const DepsgraphEvalState *state, const Relation *rel)
+{
+  if (rel->to->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC) != 0) {
+    return false;
+  }
+  OperationNode *to = (OperationNode *)rel->to;
+  return check_operation_node_visible(state, to) && (to->flag & DEPSOP_FLAG_NEEDS_UPDATE) != 0;
+}
+
+/* Estimate the critical path of every operation which is to be evaluated, based on the averaged
+ * evaluation times of the previous updates. Only the operations tagged for update are taken into
+ * account, since the others will not be evaluated.
+ *
+ * The pending parents counters have to be calculated already. They are used to visit operations
+ * in topological order, which is then traversed backwards to accumulate the times. */
+void calculate_critical_path(DepsgraphEvalState *state)
+{
+  Vector<OperationNode *> sorted_nodes;
+  for (OperationNode *node : state->graph->operations) {
+    node->custom_flags = int(node->num_links_pending);
+    if (node->num_links_pending == 0 && check_operation_node_visible(state, node) &&
+        (node->flag & DEPSOP_FLAG_NEEDS_UPDATE) != 0) {
+      sorted_nodes.append(node);
+    }
+  }
+  for (int64_t i = 0; i < sorted_nodes.size(); i++) {
+    for (Relation *rel : sorted_nodes[i]->outlinks) {
+      if (!is_pending_child_relation(state, rel)) {
+        continue;
+      }
+      OperationNode *child = (OperationNode *)rel->to;
+      if (--child->custom_flags == 0) {
+        sorted_nodes.append(child);
+      }
+    }
+  }
+  for (int64_t i = sorted_nodes.size() - 1; i >= 0; i--) {
+    OperationNode *node = sorted_nodes[i];
+    float children_time = 0.0f;
+    for (Relation *rel : node->outlinks) {
+      if (is_pending_child_relation(state, rel)) {
+        children_time = max_ff(children_time, ((OperationNode *)rel->to)->critical_path_time);
+      }
+    }
+    float time = node->average_time;
+    if (node->is_noop()) {
+      time = 0.0f;
+    }
+    else if (time < 0.0f) {
+      time = unknown_operation_time;
+    }
+    node->critical_path_time = time + children_time;
+  }
+}
+
 void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
 {
   if (!state->need_update_pending_parents) {
@@ -183,6 +285,8 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
     calculate_pending_parents_for_node(state, node);
   }
 
+  calculate_critical_path(state);
+
   state->need_update_pending_parents = false;
 }
 
@@ -286,8 +390,15 @@ void schedule_node(DepsgraphEvalState *state,
 void schedule_graph(DepsgraphEvalState *state,
                     const FunctionRef<void(OperationNode *node)> schedule_fn)
 {
+  /* Start the operations with the longest critical path first. */
+  Vector<OperationNode *> ready_nodes;
   for (OperationNode *node : state->graph->operations) {
-    schedule_node(state, node, false, schedule_fn);
+    schedule_node(
+        state, node, false, [&](OperationNode *ready_node) { ready_nodes.append(ready_node); });
+  }
+  sort_by_critical_path(ready_nodes);
+  for (OperationNode *node : ready_nodes) {
+    schedule_fn(node);
   }
 }
 
@@ -399,6 +510,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  state.do_timeline = graph->debug.do_timeline();
+  const double timeline_start_time = state.do_timeline ? PIL_check_seconds_timer() : 0.0;
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
@@ -431,8 +544,15 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 
     evaluate_graph_threaded_stage(&state, task_pool, EvaluationStage::DYNAMIC_VISIBILITY);
 
+    const bool is_visibility_changed = graph->need_update_nodes_visibility;
     deg_graph_flush_visibility_flags_if_needed(graph);
 
+    /* Data-blocks which became visible might have deferred copy-on-write updates. */
+    if (is_visibility_changed) {
+      state.need_update_pending_parents = true;
+      evaluate_graph_threaded_stage(&state, task_pool, EvaluationStage::COPY_ON_WRITE);
+    }
+
     /* Update parents to an updated visibility and evaluation stage.
      *
      * Need to do it regardless of whether visibility is actually changed or not: current state of
@@ -454,6 +574,10 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
     deg_eval_stats_aggregate(graph);
   }
 
+  if (state.do_timeline) {
+    graph->debug.add_timeline_graph_event(timeline_start_time, PIL_check_seconds_timer());
+  }
+
   /* Clear any uncleared tags. */
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
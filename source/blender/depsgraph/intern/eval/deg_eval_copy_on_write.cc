@@ -270,7 +270,7 @@ struct ValidateData {
 
 /* Similar to generic BKE_id_copy() but does not require main and assumes pointer
  * is already allocated. */
-bool id_copy_inplace_no_main(const ID *id, ID *newid)
+bool id_copy_inplace_no_main(const ID *id, ID *newid, const int extra_flag = 0)
 {
   const ID *id_for_copy = id;
 
@@ -291,7 +291,7 @@ bool id_copy_inplace_no_main(const ID *id, ID *newid)
                                 (ID *)id_for_copy,
                                 &newid,
                                 (LIB_ID_COPY_LOCALIZE | LIB_ID_CREATE_NO_ALLOCATE |
-                                 LIB_ID_COPY_SET_COPIED_ON_WRITE)) != nullptr);
+                                 LIB_ID_COPY_SET_COPIED_ON_WRITE | extra_flag)) != nullptr);
 
 #ifdef NESTED_ID_NASTY_WORKAROUND
   if (result) {
@@ -302,6 +302,23 @@ bool id_copy_inplace_no_main(const ID *id, ID *newid)
   return result;
 }
 
+/* Whether the geometry arrays of the mesh can be shared between the original and the copied
+ * datablock. Paint and sculpt modes keep pointers to the arrays of the original mesh across
+ * updates, which would become invalid when the original is made the owner of a copy of the shared
+ * data while the copied mesh keeps the old arrays. */
+bool mesh_can_share_data_with_copy(const Depsgraph *depsgraph, const Mesh *mesh_orig)
+{
+  const ViewLayer *view_layer = depsgraph->view_layer;
+  if (view_layer == nullptr || view_layer->basact == nullptr) {
+    return true;
+  }
+  const Object *object = view_layer->basact->object;
+  if (object == nullptr || object->data != mesh_orig) {
+    return true;
+  }
+  return (object->mode & (OB_MODE_ALL_PAINT | OB_MODE_PARTICLE_EDIT)) == 0;
+}
+
 /* Similar to BKE_scene_copy() but does not require main and assumes pointer
  * is already allocated. */
 bool scene_copy_inplace_no_main(const Scene *scene, Scene *new_scene)
@@ -794,8 +811,6 @@ ID *deg_expand_copy_on_write_datablock(const Depsgraph *depsgraph, const IDNode
   BLI_assert(id_cow->py_instance == nullptr);
 
   /* Copy data from original ID to a copied version. */
-  /* TODO(sergey): Avoid doing full ID copy somehow, make Mesh to reference
-   * original geometry arrays for until those are modified. */
   /* TODO(sergey): We do some trickery with temp bmain and extra ID pointer
    * just to be able to use existing API. Ideally we need to replace this with
    * in-place copy from existing datablock to a prepared memory.
@@ -819,8 +834,11 @@ ID *deg_expand_copy_on_write_datablock(const Depsgraph *depsgraph, const IDNode
       break;
     }
     case ID_ME: {
-      /* TODO(sergey): Ideally we want to handle meshes in a special
-       * manner here to avoid initial copy of all the geometry arrays. */
+      /* Avoid the initial copy of all the geometry arrays, they are only copied when either of the
+       * meshes is modified. */
+      if (mesh_can_share_data_with_copy(depsgraph, (const Mesh *)id_orig)) {
+        done = id_copy_inplace_no_main(id_orig, id_cow, LIB_ID_COPY_CD_SHARE);
+      }
       break;
     }
     default:
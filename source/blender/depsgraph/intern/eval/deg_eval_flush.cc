@@ -82,19 +82,22 @@ void flush_init_id_node_func(void *__restrict data_v,
   }
 }
 
+inline void flush_prepare_id_nodes(Depsgraph *graph)
+{
+  const int num_id_nodes = graph->id_nodes.size();
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, num_id_nodes, graph, flush_init_id_node_func, &settings);
+}
+
 inline void flush_prepare(Depsgraph *graph)
 {
   for (OperationNode *node : graph->operations) {
     node->scheduled = false;
   }
 
-  {
-    const int num_id_nodes = graph->id_nodes.size();
-    TaskParallelSettings settings;
-    BLI_parallel_range_settings_defaults(&settings);
-    settings.min_iter_per_thread = 1024;
-    BLI_task_parallel_range(0, num_id_nodes, graph, flush_init_id_node_func, &settings);
-  }
+  flush_prepare_id_nodes(graph);
 }
 
 inline void flush_schedule_entrypoints(Depsgraph *graph, FlushQueue *queue)
@@ -200,6 +203,49 @@ inline OperationNode *flush_schedule_children(OperationNode *op_node, FlushQueue
   return result;
 }
 
+/* Store the result of the flush of a time source update, so that the following time updates can
+ * skip the traversal. */
+void flush_store_time_update(Depsgraph *graph, Vector<OperationNode *> &&operations)
+{
+  graph->time_flush_operations = std::move(operations);
+  graph->time_flush_components.clear();
+  for (IDNode *id_node : graph->id_nodes) {
+    for (ComponentNode *comp_node : id_node->components.values()) {
+      if (comp_node->custom_flags == COMPONENT_STATE_DONE) {
+        graph->time_flush_components.append(comp_node);
+      }
+    }
+  }
+  graph->is_time_flush_cached = true;
+}
+
+/* Tag everything the previous flush of a time source update has tagged. Returns false when the
+ * result could differ from an actual flush, which happens when user edits of earlier updates are
+ * still pending: those are flushed over relations which are not used by time updates. */
+bool flush_time_update_from_cache(Depsgraph *graph)
+{
+  if (!graph->is_time_flush_cached) {
+    return false;
+  }
+  for (const OperationNode *op_node : graph->time_flush_operations) {
+    if (op_node->flag & DEPSOP_FLAG_USER_MODIFIED) {
+      return false;
+    }
+  }
+
+  flush_prepare_id_nodes(graph);
+  for (OperationNode *op_node : graph->time_flush_operations) {
+    op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
+    flush_handle_id_node(op_node->owner->owner);
+  }
+  /* The pose components which the queue is used for are in the list already. */
+  FlushQueue queue;
+  for (ComponentNode *comp_node : graph->time_flush_components) {
+    flush_handle_component_node(comp_node->owner, comp_node, &queue);
+  }
+  return true;
+}
+
 void flush_engine_data_update(ID *id)
 {
   DrawDataList *draw_data_list = DRW_drawdatalist_from_id(id);
@@ -277,6 +323,67 @@ void flush_editors_id_update(Depsgraph *graph, const DEGEditorUpdateContext *upd
   }
 }
 
+/* Check whether the geometry of the object is only updated because of the object's own animation
+ * or drivers. Those only change settings of modifiers, which are compared with the settings used
+ * for the previous evaluation, so the evaluated geometry can be kept when they did not change. */
+bool is_geometry_update_from_own_animation(const IDNode *id_node, const ComponentNode *comp_node)
+{
+  for (const OperationNode *op_node : comp_node->operations) {
+    /* Tagged by the user, by a time dependency or after a relations update. */
+    if (op_node->flag & DEPSOP_FLAG_DIRECTLY_MODIFIED) {
+      return false;
+    }
+    for (const Relation *rel : op_node->inlinks) {
+      if (rel->flag & RELATION_FLAG_NO_FLUSH) {
+        continue;
+      }
+      /* The time source tags the operations directly. */
+      if (rel->from->get_class() != NodeClass::OPERATION) {
+        continue;
+      }
+      const OperationNode *from_node = (const OperationNode *)rel->from;
+      if ((from_node->flag & DEPSOP_FLAG_NEEDS_UPDATE) == 0) {
+        continue;
+      }
+      const ComponentNode *from_comp_node = from_node->owner;
+      if (from_comp_node == comp_node) {
+        continue;
+      }
+      if (from_comp_node->owner != id_node) {
+        return false;
+      }
+      if (from_comp_node->type != NodeType::ANIMATION &&
+          from_node->opcode != OperationCode::DRIVER) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+/* Forget the inputs of the evaluated geometry of objects whose geometry is updated because of a
+ * change which is not covered by the inputs hash, see #BKE_object_eval_uber_data. */
+void invalidate_geometry_eval_inputs(Depsgraph *graph)
+{
+  for (IDNode *id_node : graph->id_nodes) {
+    if (id_node->custom_flags != ID_STATE_MODIFIED || GS(id_node->id_orig->name) != ID_OB) {
+      continue;
+    }
+    const ComponentNode *geometry_comp = id_node->find_component(NodeType::GEOMETRY);
+    if (geometry_comp == nullptr || geometry_comp->custom_flags != COMPONENT_STATE_DONE) {
+      continue;
+    }
+    if (!deg_copy_on_write_is_expanded(id_node->id_cow)) {
+      continue;
+    }
+    if (is_geometry_update_from_own_animation(id_node, geometry_comp)) {
+      continue;
+    }
+    Object *object_cow = (Object *)id_node->id_cow;
+    object_cow->runtime.geometry_eval_inputs_hash = 0;
+  }
+}
+
 #ifdef INVALIDATE_ON_FLUSH
 void invalidate_tagged_evaluated_transform(ID *id)
 {
@@ -347,41 +454,59 @@ void deg_graph_flush_updates(Depsgraph *graph)
   BLI_assert(graph != nullptr);
   Main *bmain = graph->bmain;
 
+  /* Frame changes during playback only tag the time source, and always flush to the same part of
+   * the graph. */
+  const bool is_time_update_only = graph->entry_tags.is_empty() &&
+                                   graph->time_source->tagged_for_update;
+
   graph->time_source->flush_update_tag(graph);
 
   /* Nothing to update, early out. */
   if (graph->entry_tags.is_empty()) {
     return;
   }
-  /* Reset all flags, get ready for the flush. */
-  flush_prepare(graph);
-  /* Starting from the tagged "entry" nodes, flush outwards. */
-  FlushQueue queue;
-  flush_schedule_entrypoints(graph, &queue);
   /* Prepare update context for editors. */
   DEGEditorUpdateContext update_ctx;
   update_ctx.bmain = bmain;
   update_ctx.depsgraph = (::Depsgraph *)graph;
   update_ctx.scene = graph->scene;
   update_ctx.view_layer = graph->view_layer;
-  /* Do actual flush. */
-  while (!queue.empty()) {
-    OperationNode *op_node = queue.front();
-    queue.pop_front();
-    while (op_node != nullptr) {
-      /* Tag operation as required for update. */
-      op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
-      /* Inform corresponding ID and component nodes about the change. */
-      ComponentNode *comp_node = op_node->owner;
-      IDNode *id_node = comp_node->owner;
-      flush_handle_id_node(id_node);
-      flush_handle_component_node(id_node, comp_node, &queue);
-      /* Flush to nodes along links. */
-      op_node = flush_schedule_children(op_node, &queue);
+  if (!is_time_update_only || !flush_time_update_from_cache(graph)) {
+    /* Reset all flags, get ready for the flush. */
+    flush_prepare(graph);
+    /* Starting from the tagged "entry" nodes, flush outwards. */
+    FlushQueue queue;
+    flush_schedule_entrypoints(graph, &queue);
+    bool store_time_update = is_time_update_only;
+    Vector<OperationNode *> flushed_operations;
+    /* Do actual flush. */
+    while (!queue.empty()) {
+      OperationNode *op_node = queue.front();
+      queue.pop_front();
+      while (op_node != nullptr) {
+        /* Tag operation as required for update. */
+        op_node->flag |= DEPSOP_FLAG_NEEDS_UPDATE;
+        /* Inform corresponding ID and component nodes about the change. */
+        ComponentNode *comp_node = op_node->owner;
+        IDNode *id_node = comp_node->owner;
+        flush_handle_id_node(id_node);
+        flush_handle_component_node(id_node, comp_node, &queue);
+        if (store_time_update) {
+          store_time_update = (op_node->flag & DEPSOP_FLAG_USER_MODIFIED) == 0;
+          flushed_operations.append(op_node);
+        }
+        /* Flush to nodes along links. */
+        op_node = flush_schedule_children(op_node, &queue);
+      }
+    }
+    if (store_time_update) {
+      flush_store_time_update(graph, std::move(flushed_operations));
     }
   }
   /* Inform editors about all changes. */
   flush_editors_id_update(graph, &update_ctx);
+  /* Make sure geometry which inputs have changed is evaluated again. */
+  invalidate_geometry_eval_inputs(graph);
   /* Reset evaluation result tagged which is tagged for update to some state
    * which is obvious to catch. */
   invalidate_tagged_evaluated_data(graph);
@@ -86,6 +86,30 @@ void deg_evaluate_object_modifiers_mode_node_visibility(::Depsgraph *depsgraph,
   }
 }
 
+static bool is_cow_update_deferred(const IDNode *id_node)
+{
+  /* Embedded data-blocks are copied together with their owner. */
+  if (id_node->id_orig->flag & LIB_EMBEDDED_DATA) {
+    return false;
+  }
+  /* The synchronization back to the original (an object's transform and bounding box) reads the
+   * copy, and the visibility of objects is evaluated from their copies as well. */
+  if (id_node->find_component(NodeType::SYNCHRONIZATION) != nullptr) {
+    return false;
+  }
+  for (const ComponentNode *comp_node : id_node->components.values()) {
+    if (comp_node->affects_visible_id) {
+      return false;
+    }
+    for (const OperationNode *op_node : comp_node->operations) {
+      if (op_node->flag & DEPSOP_FLAG_AFFECTS_VISIBILITY) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 void deg_graph_flush_visibility_flags(Depsgraph *graph)
 {
   enum {
@@ -219,6 +243,10 @@ void deg_graph_flush_visibility_flags(Depsgraph *graph)
   }
   BLI_stack_free(stack);
 
+  for (IDNode *id_node : graph->id_nodes) {
+    id_node->is_cow_update_deferred = is_cow_update_deferred(id_node);
+  }
+
   graph->need_update_nodes_visibility = false;
 }
 
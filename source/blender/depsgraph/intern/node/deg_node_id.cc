@@ -74,6 +74,7 @@ void IDNode::init(const ID *id, const char * /*subdata*/)
   is_collection_fully_expanded = false;
   has_base = false;
   is_user_modified = false;
+  is_cow_update_deferred = false;
   id_cow_recalc_backup = 0;
 
   visible_components_mask = 0;
@@ -120,6 +120,11 @@ struct IDNode : public Node {
   /* Copy-on-Write component has been explicitly tagged for update. */
   bool is_cow_explicitly_tagged;
 
+  /* Nothing visible depends on this data-block, so its Copy-on-Write update is postponed until it
+   * becomes visible. The operation stays tagged for update meanwhile. Is updated together with the
+   * visibility flags of the components. */
+  bool is_cow_update_deferred;
+
   /* Accumulate recalc flags from multiple update passes. */
   int id_cow_recalc_backup;
 
@@ -271,6 +271,13 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Averaged evaluation time of the operation in seconds, updated on every evaluation. Negative
+   * when the operation was not evaluated yet. */
+  float average_time;
+  /* Estimated time needed to evaluate this operation and the longest chain of its dependents that
+   * are tagged for update. Operations with a longer critical path are scheduled first. */
+  float critical_path_time;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -66,6 +66,12 @@ typedef struct SELECTID_Context {
 
   /* To check for updates. */
   float persmat[4][4];
+  /** Clipping planes of the region, only valid when `use_clipping` is set. */
+  float clip_planes[6][4];
+  bool use_clipping;
+  /** The X-ray and face dot overlay settings change which face dots are drawn. */
+  bool use_xray;
+  short overlay_edit_flag;
   bool is_dirty;
 } SELECTID_Context;
 
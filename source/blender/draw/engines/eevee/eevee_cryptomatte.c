@@ -39,6 +39,7 @@
 #include "BLI_alloca.h"
 #include "BLI_math_bits.h"
 #include "BLI_rect.h"
+#include "BLI_task.h"
 
 #include "DNA_curves_types.h"
 #include "DNA_mesh_types.h"
@@ -323,6 +324,48 @@ void EEVEE_cryptomatte_cache_populate(EEVEE_Data *vedata, EEVEE_ViewLayerData *s
 /** \name Accumulate Samples
  * \{ */
 
+typedef struct CryptomatteIntegrateData {
+  const ViewLayer *view_layer;
+  EEVEE_CryptomatteSample *accum_buffer;
+  const float *download_buffer;
+  int width;
+} CryptomatteIntegrateData;
+
+static void eevee_cryptomatte_integrate_row(void *__restrict userdata,
+                                            const int y,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const CryptomatteIntegrateData *data = userdata;
+  const ViewLayer *view_layer = data->view_layer;
+  const int num_cryptomatte_layers = eevee_cryptomatte_layers_count(view_layer);
+  const int num_levels = view_layer->cryptomatte_levels;
+  const int accum_pixel_stride = eevee_cryptomatte_pixel_stride(view_layer);
+  EEVEE_CryptomatteSample *accum_buffer = data->accum_buffer;
+
+  int download_pixel_index = y * data->width * num_cryptomatte_layers;
+  int accum_pixel_index = y * data->width * accum_pixel_stride;
+  for (int x = 0; x < data->width; x++) {
+    for (int layer = 0; layer < num_cryptomatte_layers; layer++) {
+      const int layer_offset = eevee_cryptomatte_layer_offset(view_layer, layer);
+      float download_hash = data->download_buffer[download_pixel_index++];
+      for (int level = 0; level < num_levels; level++) {
+        EEVEE_CryptomatteSample *sample = &accum_buffer[accum_pixel_index + layer_offset + level];
+        if (sample->hash == download_hash) {
+          sample->weight += 1.0f;
+          break;
+        }
+        /* We test against weight as hash 0.0f is used for samples hitting the world background. */
+        if (sample->weight == 0.0f) {
+          sample->hash = download_hash;
+          sample->weight = 1.0f;
+          break;
+        }
+      }
+    }
+    accum_pixel_index += accum_pixel_stride;
+  }
+}
+
 /* Downloads cryptomatte sample buffer from the GPU and integrate the samples with the accumulated
  * cryptomatte samples. */
 static void eevee_cryptomatte_download_buffer(EEVEE_Data *vedata, GPUFrameBuffer *framebuffer)
@@ -332,9 +375,7 @@ static void eevee_cryptomatte_download_buffer(EEVEE_Data *vedata, GPUFrameBuffer
   const DRWContextState *draw_ctx = DRW_context_state_get();
   const ViewLayer *view_layer = draw_ctx->view_layer;
   const int num_cryptomatte_layers = eevee_cryptomatte_layers_count(view_layer);
-  const int num_levels = view_layer->cryptomatte_levels;
   const float *viewport_size = DRW_viewport_size_get();
-  const int buffer_size = viewport_size[0] * viewport_size[1];
 
   EEVEE_CryptomatteSample *accum_buffer = g_data->cryptomatte_accum_buffer;
   float *download_buffer = g_data->cryptomatte_download_buffer;
@@ -359,30 +400,18 @@ static void eevee_cryptomatte_download_buffer(EEVEE_Data *vedata, GPUFrameBuffer
    * sort the samples by its weight to make sure that samples with the lowest weight
    * are discarded first. In our case the weight of each sample is always 1 as we don't have
    * subsamples and apply the coverage during the post processing. When there is no room for new
-   * samples the new samples has a weight of 1 and will always be discarded. */
-  int download_pixel_index = 0;
-  int accum_pixel_index = 0;
-  int accum_pixel_stride = eevee_cryptomatte_pixel_stride(view_layer);
-  for (int pixel_index = 0; pixel_index < buffer_size; pixel_index++) {
-    for (int layer = 0; layer < num_cryptomatte_layers; layer++) {
-      const int layer_offset = eevee_cryptomatte_layer_offset(view_layer, layer);
-      float download_hash = download_buffer[download_pixel_index++];
-      for (int level = 0; level < num_levels; level++) {
-        EEVEE_CryptomatteSample *sample = &accum_buffer[accum_pixel_index + layer_offset + level];
-        if (sample->hash == download_hash) {
-          sample->weight += 1.0f;
-          break;
-        }
-        /* We test against weight as hash 0.0f is used for samples hitting the world background. */
-        if (sample->weight == 0.0f) {
-          sample->hash = download_hash;
-          sample->weight = 1.0f;
-          break;
-        }
-      }
-    }
-    accum_pixel_index += accum_pixel_stride;
-  }
+   * samples the new samples has a weight of 1 and will always be discarded.
+   *
+   * Pixels are independent, so rows are integrated in parallel. */
+  CryptomatteIntegrateData data = {
+      .view_layer = view_layer,
+      .accum_buffer = accum_buffer,
+      .download_buffer = download_buffer,
+      .width = viewport_size[0],
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, viewport_size[1], &data, eevee_cryptomatte_integrate_row, &settings);
 }
 
 void EEVEE_cryptomatte_output_accumulate(EEVEE_ViewLayerData *UNUSED(sldata), EEVEE_Data *vedata)
@@ -472,34 +501,30 @@ static int eevee_cryptomatte_sample_cmp_reverse(const void *a_, const void *b_)
   return 0;
 }
 
-/* Post process the weights. The accumulated weights buffer adds one to each weight per sample.
- * During post processing ensure that the total of weights per sample is between 0 and 1. */
-static void eevee_cryptomatte_postprocess_weights(EEVEE_Data *vedata)
+typedef struct CryptomattePostprocessData {
+  const ViewLayer *view_layer;
+  EEVEE_CryptomatteSample *accum_buffer;
+  const float *volumetric_transmittance_buffer;
+  int num_samples;
+  int width;
+} CryptomattePostprocessData;
+
+static void eevee_cryptomatte_postprocess_row(void *__restrict userdata,
+                                              const int y,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
 {
-  EEVEE_StorageList *stl = vedata->stl;
-  EEVEE_PrivateData *g_data = stl->g_data;
-  EEVEE_EffectsInfo *effects = stl->effects;
-  EEVEE_TextureList *txl = vedata->txl;
-  const DRWContextState *draw_ctx = DRW_context_state_get();
-  const ViewLayer *view_layer = draw_ctx->view_layer;
+  const CryptomattePostprocessData *data = userdata;
+  const ViewLayer *view_layer = data->view_layer;
   const int num_cryptomatte_layers = eevee_cryptomatte_layers_count(view_layer);
   const int num_levels = view_layer->cryptomatte_levels;
-  const float *viewport_size = DRW_viewport_size_get();
-  const int buffer_size = viewport_size[0] * viewport_size[1];
-
-  EEVEE_CryptomatteSample *accum_buffer = g_data->cryptomatte_accum_buffer;
-  BLI_assert(accum_buffer);
-  float *volumetric_transmittance_buffer = NULL;
-  if ((effects->enabled_effects & EFFECT_VOLUMETRIC) != 0) {
-    volumetric_transmittance_buffer = GPU_texture_read(
-        txl->volume_transmittance_accum, GPU_DATA_FLOAT, 0);
-  }
-  const int num_samples = effects->taa_current_sample - 1;
-
-  int accum_pixel_index = 0;
-  int accum_pixel_stride = eevee_cryptomatte_pixel_stride(view_layer);
+  const int accum_pixel_stride = eevee_cryptomatte_pixel_stride(view_layer);
+  const float *volumetric_transmittance_buffer = data->volumetric_transmittance_buffer;
+  const int num_samples = data->num_samples;
+  EEVEE_CryptomatteSample *accum_buffer = data->accum_buffer;
 
-  for (int pixel_index = 0; pixel_index < buffer_size;
+  const int pixel_index_end = (y + 1) * data->width;
+  int accum_pixel_index = y * data->width * accum_pixel_stride;
+  for (int pixel_index = y * data->width; pixel_index < pixel_index_end;
        pixel_index++, accum_pixel_index += accum_pixel_stride) {
     float coverage = 1.0f;
     if (volumetric_transmittance_buffer != NULL) {
@@ -548,6 +573,41 @@ static void eevee_cryptomatte_postprocess_weights(EEVEE_Data *vedata)
       }
     }
   }
+}
+
+/* Post process the weights. The accumulated weights buffer adds one to each weight per sample.
+ * During post processing ensure that the total of weights per sample is between 0 and 1. */
+static void eevee_cryptomatte_postprocess_weights(EEVEE_Data *vedata)
+{
+  EEVEE_StorageList *stl = vedata->stl;
+  EEVEE_PrivateData *g_data = stl->g_data;
+  EEVEE_EffectsInfo *effects = stl->effects;
+  EEVEE_TextureList *txl = vedata->txl;
+  const DRWContextState *draw_ctx = DRW_context_state_get();
+  const ViewLayer *view_layer = draw_ctx->view_layer;
+  const float *viewport_size = DRW_viewport_size_get();
+
+  EEVEE_CryptomatteSample *accum_buffer = g_data->cryptomatte_accum_buffer;
+  BLI_assert(accum_buffer);
+  float *volumetric_transmittance_buffer = NULL;
+  if ((effects->enabled_effects & EFFECT_VOLUMETRIC) != 0) {
+    volumetric_transmittance_buffer = GPU_texture_read(
+        txl->volume_transmittance_accum, GPU_DATA_FLOAT, 0);
+  }
+  const int num_samples = effects->taa_current_sample - 1;
+
+  /* Pixels are independent, so rows are processed in parallel. */
+  CryptomattePostprocessData data = {
+      .view_layer = view_layer,
+      .accum_buffer = accum_buffer,
+      .volumetric_transmittance_buffer = volumetric_transmittance_buffer,
+      .num_samples = num_samples,
+      .width = viewport_size[0],
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(
+      0, viewport_size[1], &data, eevee_cryptomatte_postprocess_row, &settings);
 
   if (volumetric_transmittance_buffer) {
     MEM_freeN(volumetric_transmittance_buffer);
@@ -510,6 +510,10 @@ typedef struct EEVEE_LightsInfo {
   uchar shadow_cascade_light_indices[MAX_SHADOW_CASCADE];
   /* Update bitmap. */
   BLI_bitmap sh_cube_update[BLI_BITMAP_SIZE(MAX_SHADOW_CUBE)];
+  /* Matrices the cascade pool layers were last rendered with. Used to skip rendering a layer
+   * again when nothing changed. Only valid for layers enabled in `sh_cascade_layer_valid`. */
+  float sh_cascade_layer_persmat[MAX_SHADOW_CASCADE * MAX_CASCADE_NUM][4][4];
+  BLI_bitmap sh_cascade_layer_valid[BLI_BITMAP_SIZE(MAX_SHADOW_CASCADE * MAX_CASCADE_NUM)];
   /* Lights tracking */
   struct BoundSphere shadow_bounds[MAX_LIGHT]; /* Tightly packed light bounds. */
   /* List of bbox and update bitmap. Double buffered. */
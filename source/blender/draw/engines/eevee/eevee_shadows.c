@@ -225,6 +225,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
                                                               shadow_pool_format,
                                                               DRW_TEX_FILTER | DRW_TEX_COMPARE,
                                                               NULL);
+    BLI_bitmap_set_all(linfo->sh_cascade_layer_valid, false, MAX_SHADOW_CASCADE * MAX_CASCADE_NUM);
   }
 
   if (sldata->shadow_fb == NULL) {
@@ -241,12 +242,14 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
   }
 
   /* TODO(fclem): This part can be slow, optimize it. */
+  bool shcaster_updated = false;
   EEVEE_BoundBox *bbox = backbuffer->bbox;
   BoundSphere *bsphere = linfo->shadow_bounds;
   /* Search for deleted shadow casters or if shcaster WAS in shadow radius. */
   for (int i = 0; i < backbuffer->count; i++) {
     /* If the shadow-caster has been deleted or updated. */
     if (BLI_BITMAP_TEST(backbuffer->update, i)) {
+      shcaster_updated = true;
       for (int j = 0; j < linfo->cube_len; j++) {
         if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
@@ -261,6 +264,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
   for (int i = 0; i < frontbuffer->count; i++) {
     /* If the shadow-caster has been updated. */
     if (BLI_BITMAP_TEST(frontbuffer->update, i)) {
+      shcaster_updated = true;
       for (int j = 0; j < linfo->cube_len; j++) {
         if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
@@ -271,6 +275,11 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     }
   }
 
+  /* Cascades cover the whole view, so any caster update can change them. */
+  if (shcaster_updated) {
+    BLI_bitmap_set_all(linfo->sh_cascade_layer_valid, false, MAX_SHADOW_CASCADE * MAX_CASCADE_NUM);
+  }
+
   /* Resize shcasters buffers if too big. */
   if (frontbuffer->alloc_count - frontbuffer->count > SH_CASTER_ALLOC_CHUNK) {
     frontbuffer->alloc_count = divide_ceil_u(max_ii(1, frontbuffer->count),
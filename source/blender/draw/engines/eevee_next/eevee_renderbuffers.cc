@@ -63,15 +63,17 @@ void RenderBuffers::acquire(int2 extent)
   shadow_tx.acquire(pass_extent(EEVEE_RENDER_PASS_SHADOW), float_format);
   ambient_occlusion_tx.acquire(pass_extent(EEVEE_RENDER_PASS_AO), float_format);
 
-  light_tx.ensure_2d_array(color_format,
-                           max_light_color_layer > 0 ? extent : int2(1),
-                           max_ii(1, max_light_color_layer));
+  /* Arrays are also taken from the pool so that their memory can be reused by the other
+   * temporary textures once the view has been accumulated into the film. */
+  light_tx.acquire_array(max_light_color_layer > 0 ? extent : int2(1),
+                         max_ii(1, max_light_color_layer),
+                         color_format);
 
   const AOVsInfoData &aovs = inst_.film.aovs_info;
-  aov_color_tx.ensure_2d_array(
-      color_format, (aovs.color_len > 0) ? extent : int2(1), max_ii(1, aovs.color_len));
-  aov_value_tx.ensure_2d_array(
-      float_format, (aovs.value_len > 0) ? extent : int2(1), max_ii(1, aovs.value_len));
+  aov_color_tx.acquire_array(
+      (aovs.color_len > 0) ? extent : int2(1), max_ii(1, aovs.color_len), color_format);
+  aov_value_tx.acquire_array(
+      (aovs.value_len > 0) ? extent : int2(1), max_ii(1, aovs.value_len), float_format);
 
   eGPUTextureFormat cryptomatte_format = GPU_R32F;
   const int cryptomatte_layer_len = inst_.film.cryptomatte_layer_max_get();
@@ -103,6 +105,10 @@ void RenderBuffers::release()
   shadow_tx.release();
   ambient_occlusion_tx.release();
   cryptomatte_tx.release();
+
+  light_tx.release();
+  aov_color_tx.release();
+  aov_value_tx.release();
 }
 
 }  // namespace blender::eevee
@@ -36,10 +36,9 @@ class RenderBuffers {
   TextureFromPool shadow_tx;
   TextureFromPool ambient_occlusion_tx;
   TextureFromPool cryptomatte_tx;
-  /* TODO(fclem): Use texture from pool once they support texture array. */
-  Texture light_tx;
-  Texture aov_color_tx;
-  Texture aov_value_tx;
+  TextureFromPool light_tx;
+  TextureFromPool aov_color_tx;
+  TextureFromPool aov_value_tx;
 
  private:
   Instance &inst_;
@@ -13,6 +13,7 @@
 
 #include "BLI_float4x4.hh"
 #include "BLI_math_vec_types.hh"
+#include "BLI_task.hh"
 
 #include "image_batches.hh"
 #include "image_private.hh"
@@ -392,25 +393,30 @@ template<typename TextureMethod> class ScreenSpaceDrawingMode : public AbstractD
         IMB_initImBuf(
             &extracted_buffer, texture_region_width, texture_region_height, 32, IB_rectfloat);
 
-        int offset = 0;
-        for (int y = gpu_texture_region_to_update.ymin; y < gpu_texture_region_to_update.ymax;
-             y++) {
-          float yf = y / (float)texture_height;
-          float v = info.clipping_uv_bounds.ymax * yf + info.clipping_uv_bounds.ymin * (1.0 - yf) -
-                    tile_offset_y;
-          for (int x = gpu_texture_region_to_update.xmin; x < gpu_texture_region_to_update.xmax;
-               x++) {
-            float xf = x / (float)texture_width;
-            float u = info.clipping_uv_bounds.xmax * xf +
-                      info.clipping_uv_bounds.xmin * (1.0 - xf) - tile_offset_x;
-            nearest_interpolation_color(tile_buffer,
-                                        nullptr,
-                                        &extracted_buffer.rect_float[offset * 4],
-                                        u * tile_buffer->x,
-                                        v * tile_buffer->y);
-            offset++;
+        /* Rows are extracted in parallel, painting with a large brush on a big image changes many
+         * partial update tiles at once. */
+        const IndexRange rows(gpu_texture_region_to_update.ymin, texture_region_height);
+        threading::parallel_for(rows, 64, [&](const IndexRange sub_rows) {
+          for (const int y : sub_rows) {
+            int offset = (y - gpu_texture_region_to_update.ymin) * texture_region_width;
+            float yf = y / (float)texture_height;
+            float v = info.clipping_uv_bounds.ymax * yf +
+                      info.clipping_uv_bounds.ymin * (1.0 - yf) - tile_offset_y;
+            for (int x = gpu_texture_region_to_update.xmin;
+                 x < gpu_texture_region_to_update.xmax;
+                 x++) {
+              float xf = x / (float)texture_width;
+              float u = info.clipping_uv_bounds.xmax * xf +
+                        info.clipping_uv_bounds.xmin * (1.0 - xf) - tile_offset_x;
+              nearest_interpolation_color(tile_buffer,
+                                          nullptr,
+                                          &extracted_buffer.rect_float[offset * 4],
+                                          u * tile_buffer->x,
+                                          v * tile_buffer->y);
+              offset++;
+            }
           }
-        }
+        });
         IMB_gpu_clamp_half_float(&extracted_buffer);
 
         GPU_texture_update_sub(texture,
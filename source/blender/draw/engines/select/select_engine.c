@@ -9,6 +9,8 @@
 
 #include "DNA_screen_types.h"
 
+#include "ED_view3d.h"
+
 #include "UI_resources.h"
 
 #include "DRW_engine.h"
@@ -68,6 +70,27 @@ static void select_engine_framebuffer_setup(void)
   }
 }
 
+/**
+ * Check the settings of the view that are taken into account when drawing the selection buffer
+ * and store them for the next check.
+ */
+static bool select_engine_view_settings_changed(const View3D *v3d, const RegionView3D *rv3d)
+{
+  struct SELECTID_Context *ctx = &e_data.context;
+  const bool use_clipping = RV3D_CLIPPING_ENABLED(v3d, rv3d);
+  const bool use_xray = XRAY_FLAG_ENABLED(v3d);
+  bool changed = use_clipping != ctx->use_clipping || use_xray != ctx->use_xray ||
+                 v3d->overlay.edit_flag != ctx->overlay_edit_flag;
+  if (use_clipping) {
+    changed |= memcmp(ctx->clip_planes, rv3d->clip, sizeof(ctx->clip_planes)) != 0;
+    memcpy(ctx->clip_planes, rv3d->clip, sizeof(ctx->clip_planes));
+  }
+  ctx->use_clipping = use_clipping;
+  ctx->use_xray = use_xray;
+  ctx->overlay_edit_flag = v3d->overlay.edit_flag;
+  return changed;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -166,15 +189,18 @@ static void select_cache_init(void *vedata)
 
   /* Check if the viewport has changed. */
   float(*persmat)[4] = draw_ctx->rv3d->persmat;
-  e_data.context.is_dirty = !compare_m4m4(e_data.context.persmat, persmat, FLT_EPSILON);
+  e_data.context.is_dirty = !compare_m4m4(e_data.context.persmat, persmat, FLT_EPSILON) ||
+                            select_engine_view_settings_changed(draw_ctx->v3d, draw_ctx->rv3d);
 
   if (!e_data.context.is_dirty) {
-    /* Check if any of the drawn objects have been transformed. */
+    /* Check if any of the drawn objects have been changed. The buffer is kept between selection
+     * operators as long as nothing changes, so not only transform changes have to be detected
+     * but also geometry and display changes. */
     Object **ob = &e_data.context.objects_drawn[0];
     for (uint i = e_data.context.objects_drawn_len; i--; ob++) {
       DrawData *data = DRW_drawdata_get(&(*ob)->id, &draw_engine_select_type);
-      if (data && (data->recalc & ID_RECALC_TRANSFORM) != 0) {
-        data->recalc &= ~ID_RECALC_TRANSFORM;
+      if (data && data->recalc != 0) {
+        data->recalc = 0;
         e_data.context.is_dirty = true;
       }
     }
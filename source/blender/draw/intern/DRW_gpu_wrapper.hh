@@ -918,6 +918,18 @@ class TextureFromPool : public Texture, NonMovable {
         DST.vmempool->texture_pool, UNPACK2(extent), format, usage);
   }
 
+  /* Same as `acquire()` but for a 2D texture array. */
+  void acquire_array(int2 extent,
+                     int layers,
+                     eGPUTextureFormat format,
+                     eGPUTextureUsage usage = GPU_TEXTURE_USAGE_GENERAL)
+  {
+    BLI_assert(this->tx_ == nullptr);
+
+    this->tx_ = DRW_texture_pool_texture_array_acquire(
+        DST.vmempool->texture_pool, UNPACK2(extent), layers, format, usage);
+  }
+
   void release()
   {
     /* Allows multiple release. */
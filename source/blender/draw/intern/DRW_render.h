@@ -741,6 +741,11 @@ const DRWView *DRW_view_get_active(void);
  * \note planes must be in world space.
  */
 void DRW_view_clip_planes_set(DRWView *view, float (*planes)[4], int plane_len);
+/**
+ * Cull objects whose bounding sphere covers less than \a min_pixel_radius pixels on screen.
+ * Sub-views use the setting of their parent. A value of zero disables it (the default).
+ */
+void DRW_view_small_object_culling_set(DRWView *view, float min_pixel_radius);
 
 /* For all getters, if view is NULL, default view is assumed. */
 
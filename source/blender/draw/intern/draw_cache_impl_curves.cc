@@ -11,6 +11,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_base.h"
 #include "BLI_math_vec_types.hh"
@@ -66,6 +67,13 @@ struct CurvesBatchCache {
   /* Whether the cache is invalid. */
   bool is_dirty;
 
+  /**
+   * Curve offsets used to create the strand buffers. When the cache is tagged dirty but the
+   * offsets did not change, e.g. when the curves are only deformed, the buffers that only depend
+   * on the topology are kept and only the point positions are uploaded again.
+   */
+  blender::Array<int> topology_offsets;
+
   /**
    * The draw cache extraction is currently not multi-threaded for multiple objects, but if it was,
    * some locking would be necessary because multiple objects can use the same curves data with
@@ -148,10 +156,41 @@ static void curves_batch_cache_clear(Curves &curves)
 
   curves_batch_cache_clear_eval_data(cache->curves_cache);
   curves_batch_cache_clear_edit_data(cache);
+  cache->topology_offsets = {};
+}
+
+static bool curves_batch_cache_topology_matches(const Curves &curves,
+                                                const CurvesBatchCache &cache)
+{
+  if (cache.curves_cache.proc_strand_buf == nullptr || curves.geometry.curve_offsets == nullptr) {
+    return false;
+  }
+  const Span<int> offsets{curves.geometry.curve_offsets, curves.geometry.curve_num + 1};
+  return offsets == cache.topology_offsets.as_span();
+}
+
+/**
+ * Free the data that depends on the point positions and attribute values, but keep the strand
+ * buffers, the interpolated point buffers and the index buffers. The interpolation is run again
+ * because the point buffer is recreated.
+ */
+static void curves_batch_cache_clear_deformed_data(CurvesBatchCache &cache)
+{
+  CurvesEvalCache &curves_cache = cache.curves_cache;
+  GPU_VERTBUF_DISCARD_SAFE(curves_cache.proc_point_buf);
+  GPU_VERTBUF_DISCARD_SAFE(curves_cache.proc_length_buf);
+  curves_discard_attributes(curves_cache);
+  curves_batch_cache_clear_edit_data(&cache);
 }
 
 void DRW_curves_batch_cache_validate(Curves *curves)
 {
+  CurvesBatchCache *cache = static_cast<CurvesBatchCache *>(curves->batch_cache);
+  if (cache && cache->is_dirty && curves_batch_cache_topology_matches(*curves, *cache)) {
+    curves_batch_cache_clear_deformed_data(*cache);
+    cache->is_dirty = false;
+    return;
+  }
   if (!curves_batch_cache_valid(*curves)) {
     curves_batch_cache_clear(*curves);
     curves_batch_cache_init(*curves);
@@ -645,6 +684,10 @@ bool curves_ensure_procedural_data(Curves *curves,
   /* Refreshed if active layer or custom data changes. */
   if ((*r_hair_cache)->proc_strand_buf == nullptr) {
     curves_batch_cache_ensure_procedural_strand_data(*curves, cache.curves_cache);
+    if (curves->geometry.curve_offsets != nullptr) {
+      cache.topology_offsets = Span<int>(curves->geometry.curve_offsets,
+                                         curves->geometry.curve_num + 1);
+    }
   }
 
   /* Refreshed only on subdiv count change. */
@@ -5,6 +5,8 @@
  * \ingroup draw
  */
 
+#include <mutex>
+
 #include "DNA_curve_types.h"
 #include "DNA_gpencil_types.h"
 #include "DNA_meshdata_types.h"
@@ -25,6 +27,8 @@
 #include "BLI_hash.h"
 #include "BLI_math_vec_types.hh"
 #include "BLI_polyfill_2d.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "draw_cache.h"
 #include "draw_cache_impl.h"
@@ -255,6 +259,8 @@ struct gpIterData {
   gpStrokeVert *verts;
   gpColorVert *cols;
   GPUIndexBufBuilder ibo;
+  /** Visible strokes gathered by the counting pass, to fill the buffers in parallel. */
+  blender::Vector<bGPDstroke *> *strokes;
   int vert_len;
   int tri_len;
   int curve_len;
@@ -300,6 +306,7 @@ static void gpencil_buffer_add_point(GPUIndexBufBuilder *ibo,
                                      const bGPDstroke *gps,
                                      const bGPDspoint *pt,
                                      int v,
+                                     int tri,
                                      bool is_endpoint)
 {
   /* NOTE: we use the sign of strength and thickness to pass cap flag. */
@@ -334,8 +341,8 @@ static void gpencil_buffer_add_point(GPUIndexBufBuilder *ibo,
     /* Issue a Quad per point. */
     /* The attribute loading uses a different shader and will undo this bit packing. */
     int v_mat = (v << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-    GPU_indexbuf_add_tri_verts(ibo, v_mat + 0, v_mat + 1, v_mat + 2);
-    GPU_indexbuf_add_tri_verts(ibo, v_mat + 2, v_mat + 1, v_mat + 3);
+    GPU_indexbuf_set_tri_verts(ibo, tri + 0, v_mat + 0, v_mat + 1, v_mat + 2);
+    GPU_indexbuf_set_tri_verts(ibo, tri + 1, v_mat + 2, v_mat + 1, v_mat + 3);
   }
 }
 
@@ -348,17 +355,21 @@ static void gpencil_buffer_add_stroke(GPUIndexBufBuilder *ibo,
   int pts_len = gps->totpoints;
   bool is_cyclic = gpencil_stroke_is_cyclic(gps);
   int v = gps->runtime.vertex_start;
+  /* Every drawn point writes two triangles at a fixed offset, so strokes can be filled in any
+   * order. */
+  int tri = gps->runtime.stroke_start;
 
   /* First point for adjacency (not drawn). */
   int adj_idx = (is_cyclic) ? (pts_len - 1) : min_ii(pts_len - 1, 1);
-  gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[adj_idx], v++, true);
+  gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[adj_idx], v++, tri, true);
 
-  for (int i = 0; i < pts_len; i++) {
-    gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[i], v++, false);
+  for (int i = 0; i < pts_len; i++, tri += 2) {
+    gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[i], v++, tri, false);
   }
   /* Draw line to first point to complete the loop for cyclic strokes. */
   if (is_cyclic) {
-    gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[0], v, false);
+    gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[0], v, tri, false);
+    tri += 2;
     /* UV factor needs to be adjusted for the last point to not be equal to the UV factor of the
      * first point. It should be the factor of the last point plus the distance from the last point
      * to the first.
@@ -369,7 +380,7 @@ static void gpencil_buffer_add_stroke(GPUIndexBufBuilder *ibo,
   }
   /* Last adjacency point (not drawn). */
   adj_idx = (is_cyclic) ? 1 : max_ii(0, pts_len - 2);
-  gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[adj_idx], v++, true);
+  gpencil_buffer_add_point(ibo, verts, cols, gps, &pts[adj_idx], v++, tri, true);
 }
 
 static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *gps)
@@ -379,25 +390,14 @@ static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *g
   for (int i = 0; i < tri_len; i++) {
     uint *tri = gps->triangles[i].verts;
     /* The attribute loading uses a different shader and will undo this bit packing. */
-    GPU_indexbuf_add_tri_verts(ibo,
+    GPU_indexbuf_set_tri_verts(ibo,
+                               gps->runtime.fill_start + i,
                                (v + tri[0]) << GP_VERTEX_ID_SHIFT,
                                (v + tri[1]) << GP_VERTEX_ID_SHIFT,
                                (v + tri[2]) << GP_VERTEX_ID_SHIFT);
   }
 }
 
-static void gpencil_stroke_iter_cb(bGPDlayer * /*gpl*/,
-                                   bGPDframe * /*gpf*/,
-                                   bGPDstroke *gps,
-                                   void *thunk)
-{
-  gpIterData *iter = (gpIterData *)thunk;
-  if (gps->tot_triangles > 0) {
-    gpencil_buffer_add_fill(&iter->ibo, gps);
-  }
-  gpencil_buffer_add_stroke(&iter->ibo, iter->verts, iter->cols, gps);
-}
-
 static void gpencil_object_verts_count_cb(bGPDlayer * /*gpl*/,
                                           bGPDframe * /*gpf*/,
                                           bGPDstroke *gps,
@@ -413,6 +413,30 @@ static void gpencil_object_verts_count_cb(bGPDlayer * /*gpl*/,
   iter->tri_len += gps->tot_triangles;
   gps->runtime.stroke_start = iter->tri_len;
   iter->tri_len += stroke_vert_len * 2;
+  iter->strokes->append(gps);
+}
+
+/**
+ * Fill the buffers of all the strokes gathered by #gpencil_object_verts_count_cb. The vertices and
+ * triangles of every stroke are written at the offsets computed by the counting pass, so the
+ * strokes are independent and are processed in parallel, each task with its own index builder.
+ */
+static void gpencil_buffers_fill(gpIterData &iter)
+{
+  using namespace blender;
+  std::mutex builder_mutex;
+  threading::parallel_for(iter.strokes->index_range(), 64, [&](const IndexRange range) {
+    GPUIndexBufBuilder ibo = iter.ibo;
+    for (const int i : range) {
+      const bGPDstroke *gps = (*iter.strokes)[i];
+      if (gps->tot_triangles > 0) {
+        gpencil_buffer_add_fill(&ibo, gps);
+      }
+      gpencil_buffer_add_stroke(&ibo, iter.verts, iter.cols, gps);
+    }
+    std::lock_guard lock{builder_mutex};
+    GPU_indexbuf_join(&iter.ibo, &ibo);
+  });
 }
 
 static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfra)
@@ -431,10 +455,12 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     bool do_onion = true;
 
     /* First count how many vertices and triangles are needed for the whole object. */
+    blender::Vector<bGPDstroke *> strokes;
     gpIterData iter = {};
     iter.gpd = gpd;
     iter.verts = nullptr;
     iter.ibo = {0};
+    iter.strokes = &strokes;
     iter.vert_len = 0;
     iter.tri_len = 0;
     iter.curve_len = 0;
@@ -456,8 +482,7 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     GPU_indexbuf_init(&iter.ibo, GPU_PRIM_TRIS, iter.tri_len, 0xFFFFFFFFu);
 
     /* Fill buffers with data. */
-    BKE_gpencil_visible_stroke_advanced_iter(
-        nullptr, ob, nullptr, gpencil_stroke_iter_cb, &iter, do_onion, cfra);
+    gpencil_buffers_fill(iter);
 
     /* Mark last 2 verts as invalid. */
     for (int i = 0; i < 2; i++) {
@@ -661,7 +686,8 @@ static void gpencil_sbuffer_stroke_ensure(bGPdata *gpd, bool do_fill)
       MEM_freeN(tpoints2d);
     }
 
-    /* Fill buffers with data. */
+    /* Fill buffers with data, the stroke triangles are written after the fill triangles. */
+    gps->runtime.stroke_start = ibo_builder.index_len / 3;
     gpencil_buffer_add_stroke(&ibo_builder, verts, cols, gps);
 
     GPUBatch *batch = GPU_batch_create_ex(GPU_PRIM_TRIS,
@@ -14,6 +14,7 @@
 #include "BLI_bitmap.h"
 #include "BLI_buffer.h"
 #include "BLI_edgehash.h"
+#include "BLI_ghash.h"
 #include "BLI_index_range.hh"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
@@ -609,8 +610,21 @@ static void mesh_batch_cache_init(Object *object, Mesh *me)
   drw_mesh_weight_state_clear(&cache->weight_state);
 }
 
+/**
+ * Extraction tasks of different meshes run concurrently, but the tasks of a previous request for
+ * this mesh have to finish before its batch cache can be modified again.
+ */
+static void mesh_batch_cache_extraction_wait(Mesh *me)
+{
+  if (DST.extracting_meshes && BLI_gset_haskey(DST.extracting_meshes, me)) {
+    BLI_task_graph_work_and_wait(DST.task_graph);
+    BLI_gset_clear(DST.extracting_meshes, nullptr);
+  }
+}
+
 void DRW_mesh_batch_cache_validate(Object *object, Mesh *me)
 {
+  mesh_batch_cache_extraction_wait(me);
   if (!mesh_batch_cache_valid(object, me)) {
     if (me->runtime->batch_cache) {
       mesh_batch_cache_clear(static_cast<MeshBatchCache *>(me->runtime->batch_cache));
@@ -1348,6 +1362,12 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                            const bool use_hide)
 {
   BLI_assert(task_graph);
+  const bool use_extracting_meshes = (task_graph == DST.task_graph) &&
+                                     (DST.extracting_meshes != nullptr);
+  if (use_extracting_meshes) {
+    mesh_batch_cache_extraction_wait(me);
+  }
+
   const ToolSettings *ts = nullptr;
   if (scene) {
     ts = scene->toolsettings;
@@ -1938,13 +1958,19 @@ void DRW_mesh_batch_cache_create_requested(struct TaskGraph *task_graph,
                                                     use_hide);
 
   /* Ensure that all requested batches have finished.
-   * Ideally we want to remove this sync, but there are cases where this doesn't work.
-   * See T79038 for example.
+   * Outside of edit mode the sync is postponed until the next request for the same mesh, or until
+   * the end of the cache population, so that meshes of different objects are extracted in
+   * parallel. In edit mode it is still needed, see T79038 for example.
    *
    * An idea to improve this is to separate the Object mode from the edit mode draw caches. And
    * based on the mode the correct one will be updated. Other option is to look into using
    * drw_batch_cache_generate_requested_delayed. */
-  BLI_task_graph_work_and_wait(task_graph);
+  if (use_extracting_meshes && !is_editmode) {
+    BLI_gset_add(DST.extracting_meshes, me);
+  }
+  else {
+    BLI_task_graph_work_and_wait(task_graph);
+  }
 #ifdef DEBUG
   drw_mesh_batch_cache_check_available(task_graph, me);
 #endif
@@ -300,8 +300,19 @@ static DRWVolumeGrid *volume_grid_cache_get(const Volume *volume,
    * created. */
   const bool was_loaded = BKE_volume_grid_is_loaded(grid);
 
+  /* Downsample grids that would not fit in a 3D texture, or that would use most of the free video
+   * memory, instead of failing to display them. RGB textures are usually padded to RGBA. */
+  const int64_t voxel_size = (channels == 3) ? 4 * sizeof(uint16_t) : sizeof(uint16_t);
+  int64_t max_voxels = 0;
+  if (GPU_mem_stats_supported()) {
+    int total_mem_kb, free_mem_kb;
+    GPU_mem_stats_get(&total_mem_kb, &free_mem_kb);
+    max_voxels = int64_t(free_mem_kb) * 1024 / 2 / voxel_size;
+  }
+
   DenseFloatVolumeGrid dense_grid;
-  if (BKE_volume_grid_dense_floats(volume, grid, &dense_grid)) {
+  if (BKE_volume_grid_dense_floats(
+          volume, grid, GPU_max_texture_3d_size(), max_voxels, &dense_grid)) {
     copy_m4_m4(cache_grid->texture_to_object, dense_grid.texture_to_object);
     invert_m4_m4(cache_grid->object_to_texture, dense_grid.texture_to_object);
 
@@ -160,6 +160,7 @@ static void drw_task_graph_init(void)
   BLI_assert(DST.task_graph == NULL);
   DST.task_graph = BLI_task_graph_create();
   DST.delayed_extraction = BLI_gset_ptr_new(__func__);
+  DST.extracting_meshes = BLI_gset_ptr_new(__func__);
 }
 
 static void drw_task_graph_deinit(void)
@@ -171,6 +172,8 @@ static void drw_task_graph_deinit(void)
   DST.delayed_extraction = NULL;
   BLI_task_graph_work_and_wait(DST.task_graph);
 
+  BLI_gset_free(DST.extracting_meshes, NULL);
+  DST.extracting_meshes = NULL;
   BLI_task_graph_free(DST.task_graph);
   DST.task_graph = NULL;
 }
@@ -1675,6 +1678,14 @@ void DRW_draw_render_loop_ex(struct Depsgraph *depsgraph,
   drw_manager_init(&DST, viewport, NULL);
   DRW_viewport_colormanagement_set(viewport);
 
+  if (ELEM(v3d->shading.type, OB_SOLID, OB_MATERIAL)) {
+    /* Objects smaller than a pixel barely contribute to the image but still cost a draw call and
+     * their whole vertex count. Selection and depth drawing do not go through here and still draw
+     * everything, so tiny objects can be picked. A half pixel radius keeps objects that may still
+     * cover a pixel center. */
+    DRW_view_small_object_culling_set(DST.view_default, 0.5f);
+  }
+
   const int object_type_exclude_viewport = v3d->object_type_exclude_viewport;
   /* Check if scene needs to perform the populate loop */
   const bool internal_engine = (engine_type->flag & RE_INTERNAL) != 0;
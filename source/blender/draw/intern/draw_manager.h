@@ -462,6 +462,8 @@ struct DRWView {
   /** Custom visibility function. */
   DRWCallVisibilityFn *visibility_fn;
   void *user_data;
+  /** Objects whose bounding sphere projects to a smaller radius (in pixels) are culled. */
+  float min_pixel_radius;
 };
 
 /* ------------ Data Chunks --------------- */
@@ -639,6 +641,8 @@ typedef struct DRWManager {
   struct TaskGraph *task_graph;
   /* Contains list of objects that needs to be extracted from other objects. */
   struct GSet *delayed_extraction;
+  /* Meshes with extraction tasks in #task_graph that may still be running. */
+  struct GSet *extracting_meshes;
 
   /* ---------- Nothing after this point is cleared after use ----------- */
 
@@ -1573,21 +1573,29 @@ DRWCallBuffer *DRW_shgroup_call_buffer_instance(DRWShadingGroup *shgroup,
   return callbuf;
 }
 
+/**
+ * Make sure the buffer can hold the entry at index `count`. The size is doubled instead of
+ * growing by a constant amount, so that filling a buffer with many instances (e.g. thousands of
+ * lights or empties of the same shape) does not copy the whole buffer again every
+ * #DRW_BUFFER_VERTS_CHUNK entries.
+ */
+static void drw_call_buffer_ensure_size(GPUVertBuf *buf, const int count)
+{
+  if (UNLIKELY(uint(count) >= GPU_vertbuf_get_vertex_alloc(buf))) {
+    GPU_vertbuf_data_resize(buf, max_ii(count * 2, count + DRW_BUFFER_VERTS_CHUNK));
+  }
+}
+
 void DRW_buffer_add_entry_struct(DRWCallBuffer *callbuf, const void *data)
 {
   GPUVertBuf *buf = callbuf->buf;
-  const bool resize = (callbuf->count == GPU_vertbuf_get_vertex_alloc(buf));
 
-  if (UNLIKELY(resize)) {
-    GPU_vertbuf_data_resize(buf, callbuf->count + DRW_BUFFER_VERTS_CHUNK);
-  }
+  drw_call_buffer_ensure_size(buf, callbuf->count);
 
   GPU_vertbuf_vert_set(buf, callbuf->count, data);
 
   if (G.f & G_FLAG_PICKSEL) {
-    if (UNLIKELY(resize)) {
-      GPU_vertbuf_data_resize(callbuf->buf_select, callbuf->count + DRW_BUFFER_VERTS_CHUNK);
-    }
+    drw_call_buffer_ensure_size(callbuf->buf_select, callbuf->count);
     GPU_vertbuf_attr_set(callbuf->buf_select, 0, callbuf->count, &DST.select_id);
   }
 
@@ -1597,23 +1605,18 @@ void DRW_buffer_add_entry_struct(DRWCallBuffer *callbuf, const void *data)
 void DRW_buffer_add_entry_array(DRWCallBuffer *callbuf, const void *attr[], uint attr_len)
 {
   GPUVertBuf *buf = callbuf->buf;
-  const bool resize = (callbuf->count == GPU_vertbuf_get_vertex_alloc(buf));
 
   BLI_assert(attr_len == GPU_vertbuf_get_format(buf)->attr_len);
   UNUSED_VARS_NDEBUG(attr_len);
 
-  if (UNLIKELY(resize)) {
-    GPU_vertbuf_data_resize(buf, callbuf->count + DRW_BUFFER_VERTS_CHUNK);
-  }
+  drw_call_buffer_ensure_size(buf, callbuf->count);
 
   for (int i = 0; i < attr_len; i++) {
     GPU_vertbuf_attr_set(buf, i, callbuf->count, attr[i]);
   }
 
   if (G.f & G_FLAG_PICKSEL) {
-    if (UNLIKELY(resize)) {
-      GPU_vertbuf_data_resize(callbuf->buf_select, callbuf->count + DRW_BUFFER_VERTS_CHUNK);
-    }
+    drw_call_buffer_ensure_size(callbuf->buf_select, callbuf->count);
     GPU_vertbuf_attr_set(callbuf->buf_select, 0, callbuf->count, &DST.select_id);
   }
 
@@ -2193,6 +2196,7 @@ DRWView *DRW_view_create(const float viewmat[4][4],
   view->clip_planes_len = 0;
   view->visibility_fn = visibility_fn;
   view->parent = nullptr;
+  view->min_pixel_radius = 0.0f;
 
   DRW_view_update(view, viewmat, winmat, culling_viewmat, culling_winmat);
 
@@ -2329,6 +2333,13 @@ void DRW_view_clip_planes_set(DRWView *view, float (*planes)[4], int plane_len)
   }
 }
 
+void DRW_view_small_object_culling_set(DRWView *view, float min_pixel_radius)
+{
+  BLI_assert(view->parent == nullptr);
+  view->min_pixel_radius = min_pixel_radius;
+  view->is_dirty = true;
+}
+
 void DRW_view_frustum_corners_get(const DRWView *view, BoundBox *corners)
 {
   memcpy(corners, &view->frustum_corners, sizeof(view->frustum_corners));
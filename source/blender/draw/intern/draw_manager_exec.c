@@ -11,6 +11,7 @@
 #include "BLI_math.h"
 #include "BLI_math_bits.h"
 #include "BLI_memblock.h"
+#include "BLI_task.h"
 
 #include "BKE_global.h"
 
@@ -463,47 +464,103 @@ void DRW_culling_frustum_planes_get(const DRWView *view, float planes[6][4])
   memcpy(planes, view->frustum_planes, sizeof(float[6][4]));
 }
 
+/**
+ * Return true if the sphere is large enough on screen to be drawn. The bounding sphere is usually
+ * larger than the object, so this never culls objects that would cover more pixels than that.
+ */
+static bool draw_culling_small_object_test(const DRWView *view, const BoundSphere *bsphere)
+{
+  const float(*persmat)[4] = view->persmat;
+  const float *c = bsphere->center;
+  const float w = persmat[0][3] * c[0] + persmat[1][3] * c[1] + persmat[2][3] * c[2] +
+                  persmat[3][3];
+  if (view->storage.winmat[3][3] == 0.0f && w <= bsphere->radius) {
+    /* The sphere intersects the camera plane in perspective. */
+    return true;
+  }
+  const float pixel_radius = bsphere->radius * view->storage.winmat[1][1] * DST.size[1] * 0.5f /
+                             w;
+  return pixel_radius >= view->min_pixel_radius;
+}
+
+static void draw_compute_culling_state(const DRWView *view, DRWCullingState *cull)
+{
+  if (cull->bsphere.radius < 0.0) {
+    cull->mask = 0;
+    return;
+  }
+
+  bool culled = !draw_culling_sphere_test(
+      &view->frustum_bsphere, view->frustum_planes, &cull->bsphere);
+
+  if (!culled && view->min_pixel_radius > 0.0f) {
+    culled = !draw_culling_small_object_test(view, &cull->bsphere);
+  }
+
+#ifdef DRW_DEBUG_CULLING
+  if (G.debug_value != 0) {
+    if (culled) {
+      DRW_debug_sphere(cull->bsphere.center, cull->bsphere.radius, (const float[4]){1, 0, 0, 1});
+    }
+    else {
+      DRW_debug_sphere(cull->bsphere.center, cull->bsphere.radius, (const float[4]){0, 1, 0, 1});
+    }
+  }
+#endif
+
+  if (view->visibility_fn) {
+    culled = !view->visibility_fn(!culled, cull->user_data);
+  }
+
+  SET_FLAG_FROM_TEST(cull->mask, culled, view->culling_mask);
+}
+
+typedef struct DRWCullingTaskData {
+  const DRWView *view;
+  /** Number of culling states, they are stored in chunks of #DRW_RESOURCE_CHUNK_LEN. */
+  int cullstates_len;
+} DRWCullingTaskData;
+
+static void draw_compute_culling_chunk_cb(void *__restrict userdata,
+                                          const int chunk,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DRWCullingTaskData *data = userdata;
+  DRWCullingState *cullstates = BLI_memblock_elem_get(DST.vmempool->cullstates, chunk, 0);
+  const int len = min_ii(DRW_RESOURCE_CHUNK_LEN,
+                         data->cullstates_len - chunk * DRW_RESOURCE_CHUNK_LEN);
+  for (int i = 0; i < len; i++) {
+    draw_compute_culling_state(data->view, &cullstates[i]);
+  }
+}
+
 static void draw_compute_culling(DRWView *view)
 {
   view = view->parent ? view->parent : view;
 
-  /* TODO(fclem): multi-thread this. */
   /* TODO(fclem): compute all dirty views at once. */
   if (!view->is_dirty) {
     return;
   }
 
-  BLI_memblock_iter iter;
-  BLI_memblock_iternew(DST.vmempool->cullstates, &iter);
-  DRWCullingState *cull;
-  while ((cull = BLI_memblock_iterstep(&iter))) {
-    if (cull->bsphere.radius < 0.0) {
-      cull->mask = 0;
-    }
-    else {
-      bool culled = !draw_culling_sphere_test(
-          &view->frustum_bsphere, view->frustum_planes, &cull->bsphere);
+  /* Every resource handle has a culling state, allocated in the same order. */
+  const int cullstates_len = DRW_handle_chunk_get(&DST.resource_handle) * DRW_RESOURCE_CHUNK_LEN +
+                             DRW_handle_id_get(&DST.resource_handle);
+  const int chunks_len = divide_ceil_u(cullstates_len, DRW_RESOURCE_CHUNK_LEN);
 
+  DRWCullingTaskData data = {
+      .view = view,
+      .cullstates_len = cullstates_len,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
 #ifdef DRW_DEBUG_CULLING
-      if (G.debug_value != 0) {
-        if (culled) {
-          DRW_debug_sphere(
-              cull->bsphere.center, cull->bsphere.radius, (const float[4]){1, 0, 0, 1});
-        }
-        else {
-          DRW_debug_sphere(
-              cull->bsphere.center, cull->bsphere.radius, (const float[4]){0, 1, 0, 1});
-        }
-      }
+  /* Debug drawing is not thread-safe. */
+  settings.use_threading = false;
+#else
+  settings.use_threading = chunks_len > 1;
 #endif
-
-      if (view->visibility_fn) {
-        culled = !view->visibility_fn(!culled, cull->user_data);
-      }
-
-      SET_FLAG_FROM_TEST(cull->mask, culled, view->culling_mask);
-    }
-  }
+  BLI_task_parallel_range(0, chunks_len, &data, draw_compute_culling_chunk_cb, &settings);
 
   view->is_dirty = false;
 }
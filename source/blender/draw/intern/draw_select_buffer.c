@@ -461,6 +461,14 @@ void DRW_select_buffer_context_create(Base **bases, const uint bases_len, short
 {
   struct SELECTID_Context *select_ctx = DRW_select_engine_context_get();
 
+  /* Keep the selection buffer drawn by a previous operator when the objects and select mode are
+   * the same. The select engine checks for view and object changes before using it. */
+  bool is_same_context = (select_mode != -1) && (select_mode == select_ctx->select_mode) &&
+                         (bases_len == select_ctx->objects_len);
+  for (uint base_index = 0; is_same_context && base_index < bases_len; base_index++) {
+    is_same_context = bases[base_index]->object == select_ctx->objects[base_index];
+  }
+
   select_ctx->objects = MEM_reallocN(select_ctx->objects,
                                      sizeof(*select_ctx->objects) * bases_len);
 
@@ -480,7 +488,9 @@ void DRW_select_buffer_context_create(Base **bases, const uint bases_len, short
 
   select_ctx->objects_len = bases_len;
   select_ctx->select_mode = select_mode;
-  memset(select_ctx->persmat, 0, sizeof(select_ctx->persmat));
+  if (!is_same_context) {
+    memset(select_ctx->persmat, 0, sizeof(select_ctx->persmat));
+  }
 }
 
 /** \} */
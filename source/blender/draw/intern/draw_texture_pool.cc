@@ -108,14 +108,28 @@ GPUTexture *DRW_texture_pool_query(DRWTexturePool *pool,
   return handle.texture;
 }
 
-GPUTexture *DRW_texture_pool_texture_acquire(
-    DRWTexturePool *pool, int width, int height, eGPUTextureFormat format, eGPUTextureUsage usage)
+/**
+ * Shared implementation of the temporary texture acquire functions.
+ * A `layers` value of 0 means a regular 2D texture, otherwise a 2D texture array is returned.
+ */
+static GPUTexture *texture_pool_acquire(DRWTexturePool *pool,
+                                        int width,
+                                        int height,
+                                        int layers,
+                                        eGPUTextureFormat format,
+                                        eGPUTextureUsage usage)
 {
   GPUTexture *tmp_tex = nullptr;
   int64_t found_index = 0;
 
   auto texture_match = [&](GPUTexture *tex) -> bool {
     /* TODO(@fclem): We could reuse texture using texture views if the formats are compatible. */
+    if (GPU_texture_array(tex) != (layers > 0)) {
+      return false;
+    }
+    if (layers > 0 && GPU_texture_layer_count(tex) != layers) {
+      return false;
+    }
     return (GPU_texture_format(tex) == format) && (GPU_texture_width(tex) == width) &&
            (GPU_texture_height(tex) == height) && (GPU_texture_usage(tex) == usage);
   };
@@ -154,7 +168,13 @@ GPUTexture *DRW_texture_pool_texture_acquire(
       int texture_id = pool->handles.size();
       SNPRINTF(name, "DRW_tex_pool_%d", texture_id);
     }
-    tmp_tex = GPU_texture_create_2d_ex(name, width, height, 1, format, usage, nullptr);
+    if (layers > 0) {
+      tmp_tex = GPU_texture_create_2d_array_ex(
+          name, width, height, layers, 1, format, usage, nullptr);
+    }
+    else {
+      tmp_tex = GPU_texture_create_2d_ex(name, width, height, 1, format, usage, nullptr);
+    }
   }
 
   pool->tmp_tex_acquired.append(tmp_tex);
@@ -162,6 +182,23 @@ GPUTexture *DRW_texture_pool_texture_acquire(
   return tmp_tex;
 }
 
+GPUTexture *DRW_texture_pool_texture_acquire(
+    DRWTexturePool *pool, int width, int height, eGPUTextureFormat format, eGPUTextureUsage usage)
+{
+  return texture_pool_acquire(pool, width, height, 0, format, usage);
+}
+
+GPUTexture *DRW_texture_pool_texture_array_acquire(DRWTexturePool *pool,
+                                                   int width,
+                                                   int height,
+                                                   int layers,
+                                                   eGPUTextureFormat format,
+                                                   eGPUTextureUsage usage)
+{
+  BLI_assert(layers > 0);
+  return texture_pool_acquire(pool, width, height, layers, format, usage);
+}
+
 void DRW_texture_pool_texture_release(DRWTexturePool *pool, GPUTexture *tmp_tex)
 {
   pool->tmp_tex_acquired.remove_first_occurrence_and_reorder(tmp_tex);
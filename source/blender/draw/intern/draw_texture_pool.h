@@ -40,6 +40,16 @@ GPUTexture *DRW_texture_pool_query(DRWTexturePool *pool,
  */
 GPUTexture *DRW_texture_pool_texture_acquire(
     DRWTexturePool *pool, int width, int height, eGPUTextureFormat format, eGPUTextureUsage usage);
+/**
+ * Same as #DRW_texture_pool_texture_acquire but returns a 2D texture array with `layers` layers.
+ * Arrays are only reused for requests with the same layer count.
+ */
+GPUTexture *DRW_texture_pool_texture_array_acquire(DRWTexturePool *pool,
+                                                   int width,
+                                                   int height,
+                                                   int layers,
+                                                   eGPUTextureFormat format,
+                                                   eGPUTextureUsage usage);
 /**
  * Releases a previously acquired texture.
  */
@@ -91,7 +91,9 @@ struct MeshRenderData {
   const bool *select_vert;
   const bool *select_edge;
   const bool *select_poly;
-  float (*loop_normals)[3];
+  /* Owned by the mesh, or by #bm_loop_normals for #MR_EXTRACT_BMESH. */
+  const float (*loop_normals)[3];
+  float (*bm_loop_normals)[3];
   int *lverts, *ledges;
 
   const char *active_color_name;
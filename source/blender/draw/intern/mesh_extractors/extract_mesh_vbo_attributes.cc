@@ -88,6 +88,35 @@ template<> struct AttributeTypeConverter<ColorGeometry4b, gpuMeshCol> {
   }
 };
 
+/**
+ * Three components of one byte, padded to the four byte alignment that is used for such
+ * attributes in the vertex format. Used for boolean and 8-bit integer attributes, which are
+ * still read as floats in the shader, but take a third of the memory compared to 32-bit types.
+ */
+struct gpuMeshByte3 {
+  int8_t x, y, z, padding;
+};
+
+template<> struct AttributeTypeConverter<bool, gpuMeshByte3> {
+  static gpuMeshByte3 convert_value(bool value)
+  {
+    gpuMeshByte3 result;
+    result.x = result.y = result.z = int8_t(value);
+    result.padding = 0;
+    return result;
+  }
+};
+
+template<> struct AttributeTypeConverter<int8_t, gpuMeshByte3> {
+  static gpuMeshByte3 convert_value(int8_t value)
+  {
+    gpuMeshByte3 result;
+    result.x = result.y = result.z = value;
+    result.padding = 0;
+    return result;
+  }
+};
+
 /* Return the number of component for the attribute's value type, or 0 if is it unsupported. */
 static uint gpu_component_size_for_attribute_type(eCustomDataType type)
 {
@@ -111,9 +140,15 @@ static uint gpu_component_size_for_attribute_type(eCustomDataType type)
   }
 }
 
-static GPUVertFetchMode get_fetch_mode_for_type(eCustomDataType type)
+/**
+ * The compact types can't be used when the attribute is interpolated on the GPU for subdivision,
+ * because the compute shader only supports a few component types.
+ */
+static GPUVertFetchMode get_fetch_mode_for_type(eCustomDataType type, const bool use_compact)
 {
   switch (type) {
+    case CD_PROP_BOOL:
+      return use_compact ? GPU_FETCH_INT_TO_FLOAT : GPU_FETCH_FLOAT;
     case CD_PROP_INT8:
     case CD_PROP_INT32:
       return GPU_FETCH_INT_TO_FLOAT;
@@ -124,10 +159,13 @@ static GPUVertFetchMode get_fetch_mode_for_type(eCustomDataType type)
   }
 }
 
-static GPUVertCompType get_comp_type_for_type(eCustomDataType type)
+static GPUVertCompType get_comp_type_for_type(eCustomDataType type, const bool use_compact)
 {
   switch (type) {
+    case CD_PROP_BOOL:
+      return use_compact ? GPU_COMP_I8 : GPU_COMP_F32;
     case CD_PROP_INT8:
+      return use_compact ? GPU_COMP_I8 : GPU_COMP_I32;
     case CD_PROP_INT32:
       return GPU_COMP_I32;
     case CD_PROP_BYTE_COLOR:
@@ -145,8 +183,10 @@ static void init_vbo_for_attribute(const MeshRenderData &mr,
                                    bool build_on_device,
                                    uint32_t len)
 {
-  GPUVertCompType comp_type = get_comp_type_for_type(request.cd_type);
-  GPUVertFetchMode fetch_mode = get_fetch_mode_for_type(request.cd_type);
+  /* Device side buffers are filled by the subdivision compute shader. */
+  const bool use_compact = !build_on_device;
+  GPUVertCompType comp_type = get_comp_type_for_type(request.cd_type, use_compact);
+  GPUVertFetchMode fetch_mode = get_fetch_mode_for_type(request.cd_type, use_compact);
   const uint comp_size = gpu_component_size_for_attribute_type(request.cd_type);
   /* We should not be here if the attribute type is not supported. */
   BLI_assert(comp_size != 0);
@@ -283,7 +323,8 @@ static void extract_attr_generic(const MeshRenderData *mr,
 
 static void extract_attr(const MeshRenderData *mr,
                          GPUVertBuf *vbo,
-                         const DRW_AttributeRequest &request)
+                         const DRW_AttributeRequest &request,
+                         const bool use_compact)
 {
   /* TODO(@kevindietrich): float3 is used for scalar attributes as the implicit conversion done by
    * OpenGL to vec4 for a scalar `s` will produce a `vec4(s, 0, 0, 1)`. However, following the
@@ -291,10 +332,20 @@ static void extract_attr(const MeshRenderData *mr,
    * texture as for volume attribute, so we can control the conversion ourselves. */
   switch (request.cd_type) {
     case CD_PROP_BOOL:
-      extract_attr_generic<bool, float3>(mr, vbo, request);
+      if (use_compact) {
+        extract_attr_generic<bool, gpuMeshByte3>(mr, vbo, request);
+      }
+      else {
+        extract_attr_generic<bool, float3>(mr, vbo, request);
+      }
       break;
     case CD_PROP_INT8:
-      extract_attr_generic<int8_t, int3>(mr, vbo, request);
+      if (use_compact) {
+        extract_attr_generic<int8_t, gpuMeshByte3>(mr, vbo, request);
+      }
+      else {
+        extract_attr_generic<int8_t, int3>(mr, vbo, request);
+      }
       break;
     case CD_PROP_INT32:
       extract_attr_generic<int32_t, int3>(mr, vbo, request);
@@ -329,7 +380,7 @@ static void extract_attr_init(
 
   init_vbo_for_attribute(*mr, vbo, request, false, uint32_t(mr->loop_len));
 
-  extract_attr(mr, vbo, request);
+  extract_attr(mr, vbo, request, true);
 }
 
 static void extract_attr_init_subdiv(const DRWSubdivCache *subdiv_cache,
@@ -344,8 +395,8 @@ static void extract_attr_init_subdiv(const DRWSubdivCache *subdiv_cache,
 
   Mesh *coarse_mesh = subdiv_cache->mesh;
 
-  GPUVertCompType comp_type = get_comp_type_for_type(request.cd_type);
-  GPUVertFetchMode fetch_mode = get_fetch_mode_for_type(request.cd_type);
+  GPUVertCompType comp_type = get_comp_type_for_type(request.cd_type, false);
+  GPUVertFetchMode fetch_mode = get_fetch_mode_for_type(request.cd_type, false);
   const uint32_t dimensions = gpu_component_size_for_attribute_type(request.cd_type);
 
   /* Prepare VBO for coarse data. The compute shader only expects floats. */
@@ -355,7 +406,7 @@ static void extract_attr_init_subdiv(const DRWSubdivCache *subdiv_cache,
   GPU_vertbuf_init_with_format_ex(src_data, &coarse_format, GPU_USAGE_STATIC);
   GPU_vertbuf_data_alloc(src_data, uint32_t(coarse_mesh->totloop));
 
-  extract_attr(mr, src_data, request);
+  extract_attr(mr, src_data, request, false);
 
   GPUVertBuf *dst_buffer = static_cast<GPUVertBuf *>(buffer);
   init_vbo_for_attribute(*mr, dst_buffer, request, true, subdiv_cache->num_subdiv_loops);
@@ -7,6 +7,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_task.hh"
+
 #include "extract_mesh.hh"
 
 #include "draw_subdivision.h"
@@ -50,17 +52,19 @@ static void extract_pos_nor_init(const MeshRenderData *mr,
 
   /* Quicker than doing it for each loop. */
   if (mr->extract_type == MR_EXTRACT_BMESH) {
-    BMIter iter;
-    BMVert *eve;
-    int v;
-    BM_ITER_MESH_INDEX (eve, &iter, mr->bm, BM_VERTS_OF_MESH, v) {
-      data->normals[v].low = GPU_normal_convert_i10_v3(bm_vert_no_get(mr, eve));
-    }
+    threading::parallel_for(IndexRange(mr->vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        const BMVert *eve = BM_vert_at_index(mr->bm, v);
+        data->normals[v].low = GPU_normal_convert_i10_v3(bm_vert_no_get(mr, eve));
+      }
+    });
   }
   else {
-    for (int v = 0; v < mr->vert_len; v++) {
-      data->normals[v].low = GPU_normal_convert_i10_v3(mr->vert_normals[v]);
-    }
+    threading::parallel_for(IndexRange(mr->vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        data->normals[v].low = GPU_normal_convert_i10_v3(mr->vert_normals[v]);
+      }
+    });
   }
 }
 
@@ -427,17 +431,19 @@ static void extract_pos_nor_hq_init(const MeshRenderData *mr,
 
   /* Quicker than doing it for each loop. */
   if (mr->extract_type == MR_EXTRACT_BMESH) {
-    BMIter iter;
-    BMVert *eve;
-    int v;
-    BM_ITER_MESH_INDEX (eve, &iter, mr->bm, BM_VERTS_OF_MESH, v) {
-      normal_float_to_short_v3(data->normals[v].high, bm_vert_no_get(mr, eve));
-    }
+    threading::parallel_for(IndexRange(mr->vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        const BMVert *eve = BM_vert_at_index(mr->bm, v);
+        normal_float_to_short_v3(data->normals[v].high, bm_vert_no_get(mr, eve));
+      }
+    });
   }
   else {
-    for (int v = 0; v < mr->vert_len; v++) {
-      normal_float_to_short_v3(data->normals[v].high, mr->vert_normals[v]);
-    }
+    threading::parallel_for(IndexRange(mr->vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        normal_float_to_short_v3(data->normals[v].high, mr->vert_normals[v]);
+      }
+    });
   }
 }
 
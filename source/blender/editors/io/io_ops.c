@@ -65,6 +65,7 @@ void ED_operatortypes_io(void)
 #endif
 
 #ifdef WITH_IO_STL
+  WM_operatortype_append(WM_OT_stl_export);
   WM_operatortype_append(WM_OT_stl_import);
 #endif
 }
@@ -8,6 +8,7 @@
 
 #include "DNA_object_types.h"
 
+#include "BLI_bitmap.h"
 #include "BLI_math.h"
 #include "BLI_string.h"
 
@@ -298,6 +299,45 @@ static bool edbm_bevel_init(bContext *C, wmOperator *op, const bool is_modal)
   return true;
 }
 
+/**
+ * Tag the vertices of the faces created by the bevel.
+ *
+ * When the mesh is restored from the backup in modal mode, the normals of the geometry away from
+ * the bevel are still valid, so only the created faces and their surroundings need to be updated.
+ *
+ * \return The vertex mask or null when no faces were created.
+ */
+static BLI_bitmap *edbm_bevel_verts_mask_from_faces_out(BMesh *bm,
+                                                       BMOperator *bmop,
+                                                       int *r_verts_mask_count)
+{
+  BMOpSlot *slot_faces_out = BMO_slot_get(bmop->slots_out, "faces.out");
+  if (slot_faces_out->len == 0) {
+    return NULL;
+  }
+
+  BM_mesh_elem_index_ensure(bm, BM_VERT);
+  BLI_bitmap *verts_mask = BLI_BITMAP_NEW(bm->totvert, __func__);
+  int verts_mask_count = 0;
+
+  BMOIter oiter;
+  BMFace *f;
+  BMO_ITER (f, &oiter, bmop->slots_out, "faces.out", BM_FACE) {
+    BMLoop *l_iter, *l_first;
+    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+    do {
+      const int v_index = BM_elem_index_get(l_iter->v);
+      if (!BLI_BITMAP_TEST(verts_mask, v_index)) {
+        BLI_BITMAP_ENABLE(verts_mask, v_index);
+        verts_mask_count++;
+      }
+    } while ((l_iter = l_iter->next) != l_first);
+  }
+
+  *r_verts_mask_count = verts_mask_count;
+  return verts_mask;
+}
+
 static bool edbm_bevel_calc(wmOperator *op)
 {
   BevelData *opdata = op->customdata;
@@ -379,15 +419,38 @@ static bool edbm_bevel_calc(wmOperator *op)
           em->bm, bmop.slots_out, "faces.out", BM_FACE, BM_ELEM_SELECT, true);
     }
 
+    /* The modal operator re-runs the bevel on every change,
+     * limit the normal calculation to the geometry that changed. */
+    int verts_mask_count = 0;
+    BLI_bitmap *verts_mask = opdata->is_modal ?
+                                 edbm_bevel_verts_mask_from_faces_out(
+                                     em->bm, &bmop, &verts_mask_count) :
+                                 NULL;
+
     /* no need to de-select existing geometry */
     if (!EDBM_op_finish(em, &bmop, op, true)) {
+      MEM_SAFE_FREE(verts_mask);
       continue;
     }
 
+    if (verts_mask) {
+      BMPartialUpdate *bmpinfo = BM_mesh_partial_create_from_verts(
+          em->bm,
+          &(const BMPartialUpdate_Params){
+              .do_normals = true,
+          },
+          verts_mask,
+          verts_mask_count);
+      BM_mesh_normals_update_with_partial(em->bm, bmpinfo);
+      BM_mesh_partial_destroy(bmpinfo);
+      MEM_freeN(verts_mask);
+    }
+
+    /* The topology changed, so the tessellation can't be updated partially. */
     EDBM_update(obedit->data,
                 &(const struct EDBMUpdate_Params){
                     .calc_looptri = true,
-                    .calc_normals = true,
+                    .calc_normals = verts_mask == NULL,
                     .is_destructive = true,
                 });
     changed = true;
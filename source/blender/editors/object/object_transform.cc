@@ -25,6 +25,7 @@
 #include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math.h"
+#include "BLI_math_batch.hh"
 #include "BLI_math_vector.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
@@ -641,17 +642,6 @@ static bool apply_objects_internal_need_single_user(bContext *C)
   return (ID_REAL_USERS(ob->data) > CTX_DATA_COUNT(C, selected_editable_objects));
 }
 
-static void transform_positions(blender::MutableSpan<blender::float3> positions,
-                                const blender::float4x4 &matrix)
-{
-  using namespace blender;
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &position : positions.slice(range)) {
-      position = matrix * position;
-    }
-  });
-}
-
 static int apply_objects_internal(bContext *C,
                                   ReportList *reports,
                                   bool apply_loc,
@@ -952,7 +942,7 @@ static int apply_objects_internal(bContext *C,
       bke::MutableAttributeAccessor attributes = pointcloud.attributes_for_write();
       bke::SpanAttributeWriter position = attributes.lookup_or_add_for_write_span<float3>(
           "position", ATTR_DOMAIN_POINT);
-      transform_positions(position.span, float4x4(mat));
+      math::transform_points(float4x4(mat), position.span);
       position.finish();
     }
     else if (ob->type == OB_CAMERA) {
@@ -481,7 +481,25 @@ class DensitySubtractOperation : public CurvesSculptStrokeOperation {
    */
   Vector<float3> deformed_root_positions_;
 
+  /**
+   * Deformed root positions of the selected curves. The tree is only built once per stroke,
+   * so it refers to the curves by their index when the stroke started. The arrays below map
+   * between those and the current indices, which change as curves are removed.
+   */
+  KDTree_3d *root_points_kdtree_ = nullptr;
+  /** Index at the start of the stroke for every curve that still exists. */
+  Vector<int> original_curve_indices_;
+  /** Current index for every curve that existed at the start of the stroke, or -1. */
+  Array<int> current_curve_indices_;
+
  public:
+  ~DensitySubtractOperation() override
+  {
+    if (root_points_kdtree_ != nullptr) {
+      BLI_kdtree_3d_free(root_points_kdtree_);
+    }
+  }
+
   void on_stroke_extended(const bContext &C, const StrokeExtension &stroke_extension) override;
 };
 
@@ -518,8 +536,6 @@ struct DensitySubtractOperationExecutor {
 
   CurvesSurfaceTransforms transforms_;
 
-  KDTree_3d *root_points_kdtree_;
-
   DensitySubtractOperationExecutor(const bContext &C) : ctx_(C)
   {
   }
@@ -577,13 +593,9 @@ struct DensitySubtractOperationExecutor {
       }
     }
 
-    root_points_kdtree_ = BLI_kdtree_3d_new(curve_selection_.size());
-    BLI_SCOPED_DEFER([&]() { BLI_kdtree_3d_free(root_points_kdtree_); });
-    for (const int curve_i : curve_selection_) {
-      const float3 &pos_cu = self_->deformed_root_positions_[curve_i];
-      BLI_kdtree_3d_insert(root_points_kdtree_, curve_i, pos_cu);
+    if (self_->root_points_kdtree_ == nullptr) {
+      this->build_root_points_kdtree();
     }
-    BLI_kdtree_3d_balance(root_points_kdtree_);
 
     /* Find all curves that should be deleted. */
     Array<bool> curves_to_delete(curves_->curves_num(), false);
@@ -613,6 +625,8 @@ struct DensitySubtractOperationExecutor {
     }
     self_->deformed_root_positions_ = std::move(new_deformed_positions);
 
+    this->update_curve_indices(ranges_to_keep);
+
     curves_->remove_curves(mask_to_delete);
     BLI_assert(curves_->curves_num() == self_->deformed_root_positions_.size());
 
@@ -621,6 +635,58 @@ struct DensitySubtractOperationExecutor {
     ED_region_tag_redraw(ctx_.region);
   }
 
+  /**
+   * Building the tree for millions of curves is expensive, so it is done once per stroke and the
+   * removed curves are skipped when searching it instead.
+   */
+  void build_root_points_kdtree()
+  {
+    self_->root_points_kdtree_ = BLI_kdtree_3d_new(curve_selection_.size());
+    for (const int curve_i : curve_selection_) {
+      const float3 &pos_cu = self_->deformed_root_positions_[curve_i];
+      BLI_kdtree_3d_insert(self_->root_points_kdtree_, curve_i, pos_cu);
+    }
+    BLI_kdtree_3d_balance(self_->root_points_kdtree_);
+
+    self_->original_curve_indices_.resize(curves_->curves_num());
+    self_->current_curve_indices_.reinitialize(curves_->curves_num());
+    for (const int curve_i : curves_->curves_range()) {
+      self_->original_curve_indices_[curve_i] = curve_i;
+      self_->current_curve_indices_[curve_i] = curve_i;
+    }
+  }
+
+  void update_curve_indices(const Span<IndexRange> ranges_to_keep)
+  {
+    Vector<int> new_original_indices;
+    for (const IndexRange range : ranges_to_keep) {
+      new_original_indices.extend(self_->original_curve_indices_.as_span().slice(range));
+    }
+    self_->original_curve_indices_ = std::move(new_original_indices);
+
+    self_->current_curve_indices_.fill(-1);
+    for (const int curve_i : self_->original_curve_indices_.index_range()) {
+      self_->current_curve_indices_[self_->original_curve_indices_[curve_i]] = curve_i;
+    }
+  }
+
+  /** Call the function for the current index of every selected curve in the given distance. */
+  template<typename Fn>
+  void foreach_root_point_in_range(const float3 &position, const float distance, const Fn &fn)
+  {
+    BLI_kdtree_3d_range_search_cb_cpp(
+        self_->root_points_kdtree_,
+        position,
+        distance,
+        [&](const int original_curve_i, const float * /*co*/, float /*dist_sq*/) {
+          const int curve_i = self_->current_curve_indices_[original_curve_i];
+          if (curve_i != -1) {
+            fn(curve_i);
+          }
+          return true;
+        });
+  }
+
   void reduce_density_projected_with_symmetry(MutableSpan<bool> curves_to_delete)
   {
     const Vector<float4x4> symmetry_brush_transforms = get_symmetry_brush_transforms(
@@ -684,18 +750,14 @@ struct DensitySubtractOperationExecutor {
       if (dist_to_brush_sq_re > brush_radius_sq_re) {
         continue;
       }
-      BLI_kdtree_3d_range_search_cb_cpp(
-          root_points_kdtree_,
-          orig_pos_cu,
-          minimum_distance_,
-          [&](const int other_curve_i, const float * /*co*/, float /*dist_sq*/) {
+      this->foreach_root_point_in_range(
+          orig_pos_cu, minimum_distance_, [&](const int other_curve_i) {
             if (other_curve_i == curve_i) {
-              return true;
+              return;
             }
             if (allow_remove_curve[other_curve_i]) {
               curves_to_delete[other_curve_i] = true;
             }
-            return true;
           });
     }
   }
@@ -769,19 +831,14 @@ struct DensitySubtractOperationExecutor {
         continue;
       }
 
-      BLI_kdtree_3d_range_search_cb_cpp(
-          root_points_kdtree_,
-          pos_cu,
-          minimum_distance_,
-          [&](const int other_curve_i, const float * /*co*/, float /*dist_sq*/) {
-            if (other_curve_i == curve_i) {
-              return true;
-            }
-            if (allow_remove_curve[other_curve_i]) {
-              curves_to_delete[other_curve_i] = true;
-            }
-            return true;
-          });
+      this->foreach_root_point_in_range(pos_cu, minimum_distance_, [&](const int other_curve_i) {
+        if (other_curve_i == curve_i) {
+          return;
+        }
+        if (allow_remove_curve[other_curve_i]) {
+          curves_to_delete[other_curve_i] = true;
+        }
+      });
     }
   }
 };
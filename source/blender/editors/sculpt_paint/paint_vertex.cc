@@ -223,6 +223,17 @@ static MDeformVert *defweight_prev_init(MDeformVert *dvert_prev,
   return dv_prev;
 }
 
+static float defweight_prev_active_init(float *weight_prev,
+                                        const MDeformVert *dvert_curr,
+                                        const int index,
+                                        const int defgroup)
+{
+  if (weight_prev[index] == FLT_MAX) {
+    weight_prev[index] = BKE_defvert_find_weight(&dvert_curr[index], defgroup);
+  }
+  return weight_prev[index];
+}
+
 static void paint_last_stroke_update(Scene *scene, const float location[3])
 {
   UnifiedPaintSettings *ups = &scene->toolsettings->unified_paint_settings;
@@ -917,18 +928,27 @@ static void do_weight_paint_vertex_single(
   }
 
   if (!brush_use_accumulate(wp)) {
-    MDeformVert *dvert_prev = ob->sculpt->mode.wpaint.dvert_prev;
-    MDeformVert *dv_prev = defweight_prev_init(dvert_prev, wpi->dvert.data(), index);
-    if (index_mirr != -1) {
-      defweight_prev_init(dvert_prev, wpi->dvert.data(), index_mirr);
-    }
-
-    weight_prev = BKE_defvert_find_weight(dv_prev, wpi->active.index);
-
     if (wpi->do_lock_relative) {
+      MDeformVert *dvert_prev = ob->sculpt->mode.wpaint.dvert_prev;
+      MDeformVert *dv_prev = defweight_prev_init(dvert_prev, wpi->dvert.data(), index);
+      if (index_mirr != -1) {
+        defweight_prev_init(dvert_prev, wpi->dvert.data(), index_mirr);
+      }
+
+      weight_prev = BKE_defvert_find_weight(dv_prev, wpi->active.index);
       weight_prev = BKE_defvert_lock_relative_weight(
           weight_prev, dv_prev, wpi->defbase_tot, wpi->vgroup_locked, wpi->vgroup_unlocked);
     }
+    else {
+      /* Only the active group is needed, avoid copying all weights of the vertex. */
+      float *weight_prev_arr = ob->sculpt->mode.wpaint.weight_prev;
+      weight_prev = defweight_prev_active_init(
+          weight_prev_arr, wpi->dvert.data(), index, wpi->active.index);
+      if (index_mirr != -1) {
+        defweight_prev_active_init(
+            weight_prev_arr, wpi->dvert.data(), index_mirr, wpi->active.index);
+      }
+    }
   }
   else {
     weight_prev = weight_cur;
@@ -1280,8 +1300,14 @@ static void vertex_paint_init_session_data(const ToolSettings *ts, Object *ob)
           dv->flag = 1;
         }
       }
+      if (ob->sculpt->mode.wpaint.weight_prev == nullptr) {
+        ob->sculpt->mode.wpaint.weight_prev = (float *)MEM_mallocN(me->totvert * sizeof(float),
+                                                                   __func__);
+        copy_vn_fl(ob->sculpt->mode.wpaint.weight_prev, me->totvert, FLT_MAX);
+      }
     }
     else {
+      MEM_SAFE_FREE(ob->sculpt->mode.wpaint.weight_prev);
       MEM_SAFE_FREE(ob->sculpt->mode.wpaint.alpha_weight);
       if (ob->sculpt->mode.wpaint.dvert_prev != nullptr) {
         BKE_defvert_array_free_elems(ob->sculpt->mode.wpaint.dvert_prev, me->totvert);
@@ -1864,6 +1890,9 @@ static bool wpaint_stroke_test_start(bContext *C, wmOperator *op, const float mo
       dv->flag = 1;
     }
   }
+  if (ob->sculpt->mode.wpaint.weight_prev != nullptr) {
+    copy_vn_fl(ob->sculpt->mode.wpaint.weight_prev, me->totvert, FLT_MAX);
+  }
 
   return true;
 }
@@ -2538,30 +2538,22 @@ static float brush_strength(const Sculpt *sd,
   }
 }
 
-float SCULPT_brush_strength_factor(SculptSession *ss,
-                                   const Brush *br,
-                                   const float brush_point[3],
-                                   float len,
-                                   const float vno[3],
-                                   const float fno[3],
-                                   float mask,
-                                   const PBVHVertRef vertex,
-                                   const int thread_id,
-                                   AutomaskingNodeData *automask_data)
+/* Sample the brush texture at the vertex position, for #SCULPT_brush_strength_factor. */
+static float sculpt_brush_texture_factor(SculptSession *ss,
+                                         const Brush *br,
+                                         const MTex *mtex,
+                                         const float brush_point[3],
+                                         const int thread_id)
 {
   StrokeCache *cache = ss->cache;
   const Scene *scene = cache->vc->scene;
-  const MTex *mtex = BKE_brush_mask_texture_get(br, OB_MODE_SCULPT);
   float avg = 1.0f;
   float rgba[4];
   float point[3];
 
   sub_v3_v3v3(point, brush_point, cache->plane_offset);
 
-  if (!mtex->tex) {
-    avg = 1.0f;
-  }
-  else if (mtex->brush_map_mode == MTEX_MAP_MODE_3D) {
+  if (mtex->brush_map_mode == MTEX_MAP_MODE_3D) {
     /* Get strength by feeding the vertex location directly into a texture. */
     avg = BKE_brush_sample_tex_3d(scene, br, mtex, point, rgba, 0, ss->tex_pool);
   }
@@ -2608,6 +2600,23 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
     }
   }
 
+  return avg;
+}
+
+float SCULPT_brush_strength_factor(SculptSession *ss,
+                                   const Brush *br,
+                                   const float brush_point[3],
+                                   float len,
+                                   const float vno[3],
+                                   const float fno[3],
+                                   float mask,
+                                   const PBVHVertRef vertex,
+                                   const int thread_id,
+                                   AutomaskingNodeData *automask_data)
+{
+  StrokeCache *cache = ss->cache;
+  const MTex *mtex = BKE_brush_mask_texture_get(br, OB_MODE_SCULPT);
+
   /* Hardness. */
   float final_len = len;
   const float hardness = cache->paint_brush.hardness;
@@ -2624,7 +2633,7 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
   }
 
   /* Falloff curve. */
-  avg *= BKE_brush_curve_strength(br, final_len, cache->radius);
+  float avg = BKE_brush_curve_strength(br, final_len, cache->radius);
   avg *= frontface(br, cache->view_normal, vno, fno);
 
   /* Paint mask. */
@@ -2633,7 +2642,13 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
   /* Auto-masking. */
   avg *= SCULPT_automasking_factor_get(cache->automasking, ss, vertex, automask_data);
 
-  return avg;
+  /* Sampling the texture is by far the most expensive part, so it is skipped for the vertices
+   * that are not affected anyway, e.g. masked vertices or at the edge of the falloff. */
+  if (avg == 0.0f || !mtex->tex) {
+    return avg;
+  }
+
+  return avg * sculpt_brush_texture_factor(ss, br, mtex, brush_point, thread_id);
 }
 
 bool SCULPT_search_sphere_cb(PBVHNode *node, void *data_v)
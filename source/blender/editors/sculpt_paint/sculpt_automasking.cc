@@ -10,6 +10,7 @@
 #include "BLI_array.hh"
 #include "BLI_blenlib.h"
 #include "BLI_hash.h"
+#include "BLI_hash_mm2a.h"
 #include "BLI_index_range.hh"
 #include "BLI_math.h"
 #include "BLI_math_vec_types.hh"
@@ -583,7 +584,7 @@ void SCULPT_automasking_cache_free(AutomaskingCache *automasking)
   MEM_SAFE_FREE(automasking);
 }
 
-static bool sculpt_automasking_is_constrained_by_radius(Brush *br)
+static bool sculpt_automasking_is_constrained_by_radius(const Brush *br)
 {
   /* 2D falloff is not constrained by radius. */
   if (br->falloff_shape == PAINT_FALLOFF_SHAPE_TUBE) {
@@ -799,6 +800,57 @@ static void sculpt_normal_occlusion_automasking_fill(AutomaskingCache *automaski
   }
 }
 
+/* The factors of the topology, face sets and boundary modes don't depend on the vertex positions,
+ * so they can be kept between strokes. The view normal modes depend on the view, and the topology
+ * flood fill on the positions when it starts from the mirrored active vertex or is limited to the
+ * brush radius. */
+static bool automasking_factors_can_be_cached(Object *ob, const Brush *brush, const int mode)
+{
+  SculptSession *ss = ob->sculpt;
+
+  if (BKE_pbvh_type(ss->pbvh) != PBVH_FACES) {
+    return false;
+  }
+  if (mode & (BRUSH_AUTOMASKING_VIEW_NORMAL | BRUSH_AUTOMASKING_VIEW_OCCLUSION)) {
+    return false;
+  }
+  if (mode & BRUSH_AUTOMASKING_TOPOLOGY) {
+    if (SCULPT_mesh_symmetry_xyz_get(ob)) {
+      return false;
+    }
+    if (ss->cache && brush && sculpt_automasking_is_constrained_by_radius(brush)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static int automasking_factors_cache_hash(Object *ob,
+                                          AutomaskingCache *automasking,
+                                          const int boundary_propagation_steps)
+{
+  SculptSession *ss = ob->sculpt;
+
+  int hash = SCULPT_automasking_settings_hash(ob, automasking);
+  hash = BLI_hash_int_2d(hash, ss->totfaces);
+  hash = BLI_hash_int_2d(hash, boundary_propagation_steps);
+
+  if (automasking->settings.flags & BRUSH_AUTOMASKING_TOPOLOGY) {
+    hash = BLI_hash_int_2d(hash, int(SCULPT_active_vertex_get(ss).i));
+  }
+  /* Hashing the face sets and visibility is much cheaper than computing the factors again. */
+  if (ss->face_sets) {
+    hash = BLI_hash_mm2(
+        (const uchar *)ss->face_sets, sizeof(*ss->face_sets) * ss->totfaces, uint(hash));
+  }
+  if (ss->hide_poly) {
+    hash = BLI_hash_mm2(
+        (const uchar *)ss->hide_poly, sizeof(*ss->hide_poly) * ss->totfaces, uint(hash));
+  }
+
+  return hash;
+}
+
 bool SCULPT_tool_can_reuse_automask(int sculpt_tool)
 {
   return ELEM(sculpt_tool,
@@ -893,6 +945,26 @@ AutomaskingCache *SCULPT_automasking_cache_init(Sculpt *sd, Brush *brush, Object
   ss->attrs.automasking_factor = BKE_sculpt_attribute_ensure(
       ob, ATTR_DOMAIN_POINT, CD_PROP_FLOAT, SCULPT_ATTRIBUTE_NAME(automasking_factor), &params);
 
+  const int boundary_propagation_steps = brush ?
+                                             brush->automasking_boundary_edges_propagation_steps :
+                                             1;
+
+  const bool use_factors_cache = automasking_factors_can_be_cached(ob, brush, mode);
+  int factors_hash = 0;
+  if (use_factors_cache) {
+    factors_hash = automasking_factors_cache_hash(ob, automasking, boundary_propagation_steps);
+
+    if (ss->automasking_factors_cache && factors_hash == ss->automasking_factors_cache_hash) {
+      for (int i : IndexRange(totvert)) {
+        PBVHVertRef vertex = BKE_pbvh_index_to_vertex(ss->pbvh, i);
+
+        *(float *)SCULPT_vertex_attr_get(
+            vertex, ss->attrs.automasking_factor) = ss->automasking_factors_cache[i];
+      }
+      return automasking;
+    }
+  }
+
   float initial_value;
 
   /* Topology, boundary and boundary face sets build up the mask
@@ -912,10 +984,6 @@ AutomaskingCache *SCULPT_automasking_cache_init(Sculpt *sd, Brush *brush, Object
     (*(float *)SCULPT_vertex_attr_get(vertex, ss->attrs.automasking_factor)) = initial_value;
   }
 
-  const int boundary_propagation_steps = brush ?
-                                             brush->automasking_boundary_edges_propagation_steps :
-                                             1;
-
   /* Additive modes. */
   if (SCULPT_is_automasking_mode_enabled(sd, brush, BRUSH_AUTOMASKING_TOPOLOGY)) {
     SCULPT_vertex_random_access_ensure(ss);
@@ -936,6 +1004,20 @@ AutomaskingCache *SCULPT_automasking_cache_init(Sculpt *sd, Brush *brush, Object
         ob, AUTOMASK_INIT_BOUNDARY_FACE_SETS, boundary_propagation_steps);
   }
 
+  if (use_factors_cache) {
+    MEM_SAFE_FREE(ss->automasking_factors_cache);
+    ss->automasking_factors_cache = (float *)MEM_malloc_arrayN(
+        totvert, sizeof(float), "automasking factors cache");
+    ss->automasking_factors_cache_hash = factors_hash;
+
+    for (int i : IndexRange(totvert)) {
+      PBVHVertRef vertex = BKE_pbvh_index_to_vertex(ss->pbvh, i);
+
+      ss->automasking_factors_cache[i] = *(float *)SCULPT_vertex_attr_get(
+          vertex, ss->attrs.automasking_factor);
+    }
+  }
+
   /* Subtractive modes. */
   int normal_bits = sculpt_automasking_mode_effective_bits(sd, brush) &
                     (BRUSH_AUTOMASKING_VIEW_NORMAL | BRUSH_AUTOMASKING_VIEW_OCCLUSION);
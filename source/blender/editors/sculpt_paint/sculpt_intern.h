@@ -147,6 +147,9 @@ typedef struct SculptUndoNodeGeometry {
   int totpoly;
 } SculptUndoNodeGeometry;
 
+/* Number of arrays of #SculptUndoNode that are compressed. */
+#define SCULPT_UNDO_COMPRESSED_ARRAYS_NUM 8
+
 typedef struct SculptUndoNode {
   struct SculptUndoNode *next, *prev;
 
@@ -211,6 +214,12 @@ typedef struct SculptUndoNode {
   PBVHFaceRef *faces;
   int faces_num;
 
+  /* Arrays above compressed into a single buffer once the undo step is finished. They are
+   * decompressed again when the node is restored or accessed, see #sculpt_undo_node_compress. */
+  void *compressed_data;
+  size_t compressed_size;
+  size_t compressed_array_sizes[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM];
+
   size_t undo_size;
 } SculptUndoNode;
 
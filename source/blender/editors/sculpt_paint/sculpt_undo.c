@@ -31,6 +31,8 @@
 
 #include <stddef.h>
 
+#include <zstd.h>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_ghash.h"
@@ -872,7 +874,232 @@ static void sculpt_undo_refine_subdiv(Depsgraph *depsgraph,
   MEM_freeN(deformed_verts);
 }
 
-static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase *lb)
+/* -------------------------------------------------------------------- */
+/** \name Undo Node Compression
+ *
+ * The arrays of finished undo steps are only read again when the step is restored, so they are
+ * compressed to reduce the memory used by long sculpt sessions. All compressed arrays store 4 byte
+ * values (floats or integers). Before compressing, the bytes are reordered so that the same byte
+ * of all values is stored together, because neighboring coordinates and indices usually share
+ * their high bytes, which then compress much better.
+ * \{ */
+
+/* Fast compression, the undo push happens at the end of every stroke. */
+#define SCULPT_UNDO_ZSTD_LEVEL 1
+/* Nodes with less data are not worth compressing. */
+#define SCULPT_UNDO_COMPRESS_MIN_SIZE 4096
+
+/* Guards decompressing nodes on access from multiple threads. */
+static ThreadMutex sculpt_undo_decompress_mutex = BLI_MUTEX_INITIALIZER;
+
+static void sculpt_undo_node_arrays_get(SculptUndoNode *unode,
+                                        void **r_arrays[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM])
+{
+  r_arrays[0] = (void **)&unode->co;
+  r_arrays[1] = (void **)&unode->orig_co;
+  r_arrays[2] = (void **)&unode->col;
+  r_arrays[3] = (void **)&unode->loop_col;
+  r_arrays[4] = (void **)&unode->mask;
+  r_arrays[5] = (void **)&unode->index;
+  r_arrays[6] = (void **)&unode->loop_index;
+  r_arrays[7] = (void **)&unode->face_sets;
+}
+
+/* Size of the compressible arrays of the node, in their current form. */
+static size_t sculpt_undo_node_arrays_size(SculptUndoNode *unode)
+{
+  if (unode->compressed_data) {
+    return unode->compressed_size;
+  }
+  void **arrays[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM];
+  sculpt_undo_node_arrays_get(unode, arrays);
+  size_t size = 0;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    if (*arrays[i]) {
+      size += MEM_allocN_len(*arrays[i]);
+    }
+  }
+  return size;
+}
+
+static void sculpt_undo_bytes_shuffle(char *dst, const char *src, const size_t size)
+{
+  const size_t values_num = size / 4;
+  for (size_t i = 0; i < values_num; i++) {
+    for (int b = 0; b < 4; b++) {
+      dst[b * values_num + i] = src[i * 4 + b];
+    }
+  }
+}
+
+static void sculpt_undo_bytes_unshuffle(char *dst, const char *src, const size_t size)
+{
+  const size_t values_num = size / 4;
+  for (size_t i = 0; i < values_num; i++) {
+    for (int b = 0; b < 4; b++) {
+      dst[i * 4 + b] = src[b * values_num + i];
+    }
+  }
+}
+
+static void sculpt_undo_node_compress(SculptUndoNode *unode)
+{
+  if (unode->compressed_data) {
+    return;
+  }
+
+  void **arrays[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM];
+  size_t sizes[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM];
+  sculpt_undo_node_arrays_get(unode, arrays);
+  size_t total_size = 0;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    sizes[i] = *arrays[i] ? MEM_allocN_len(*arrays[i]) : 0;
+    BLI_assert(sizes[i] % 4 == 0);
+    total_size += sizes[i];
+  }
+  if (total_size < SCULPT_UNDO_COMPRESS_MIN_SIZE) {
+    return;
+  }
+
+  char *shuffled = MEM_mallocN(total_size, __func__);
+  size_t offset = 0;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    if (sizes[i]) {
+      sculpt_undo_bytes_shuffle(shuffled + offset, *arrays[i], sizes[i]);
+      offset += sizes[i];
+    }
+  }
+
+  const size_t compressed_size_max = ZSTD_compressBound(total_size);
+  void *compressed = MEM_mallocN(compressed_size_max, __func__);
+  const size_t compressed_size = ZSTD_compress(
+      compressed, compressed_size_max, shuffled, total_size, SCULPT_UNDO_ZSTD_LEVEL);
+  MEM_freeN(shuffled);
+
+  /* Keep the arrays when compression does not save a significant amount of memory. */
+  if (ZSTD_isError(compressed_size) || compressed_size > total_size / 4 * 3) {
+    MEM_freeN(compressed);
+    return;
+  }
+
+  unode->compressed_data = MEM_reallocN(compressed, compressed_size);
+  unode->compressed_size = compressed_size;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    unode->compressed_array_sizes[i] = sizes[i];
+    MEM_SAFE_FREE(*arrays[i]);
+  }
+}
+
+static void sculpt_undo_node_decompress(SculptUndoNode *unode)
+{
+  if (unode->compressed_data == NULL) {
+    return;
+  }
+
+  void **arrays[SCULPT_UNDO_COMPRESSED_ARRAYS_NUM];
+  sculpt_undo_node_arrays_get(unode, arrays);
+  size_t total_size = 0;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    total_size += unode->compressed_array_sizes[i];
+  }
+
+  char *shuffled = MEM_mallocN(total_size, __func__);
+  const size_t size = ZSTD_decompress(
+      shuffled, total_size, unode->compressed_data, unode->compressed_size);
+  BLI_assert(size == total_size);
+  UNUSED_VARS_NDEBUG(size);
+
+  size_t offset = 0;
+  for (int i = 0; i < SCULPT_UNDO_COMPRESSED_ARRAYS_NUM; i++) {
+    const size_t array_size = unode->compressed_array_sizes[i];
+    if (array_size) {
+      *arrays[i] = MEM_mallocN(array_size, "SculptUndoNode array");
+      sculpt_undo_bytes_unshuffle(*arrays[i], shuffled + offset, array_size);
+      offset += array_size;
+    }
+    unode->compressed_array_sizes[i] = 0;
+  }
+  MEM_freeN(shuffled);
+
+  MEM_freeN(unode->compressed_data);
+  unode->compressed_data = NULL;
+  unode->compressed_size = 0;
+}
+
+/* Decompress a node of the undo step that is being pushed, which is only needed when a node of a
+ * finished step is accessed again. */
+static void sculpt_undo_node_ensure_decompressed(UndoSculpt *usculpt, SculptUndoNode *unode)
+{
+  if (unode->compressed_data == NULL) {
+    return;
+  }
+  BLI_mutex_lock(&sculpt_undo_decompress_mutex);
+  if (unode->compressed_data) {
+    const size_t size_old = sculpt_undo_node_arrays_size(unode);
+    sculpt_undo_node_decompress(unode);
+    usculpt->undo_size += sculpt_undo_node_arrays_size(unode) - size_old;
+  }
+  BLI_mutex_unlock(&sculpt_undo_decompress_mutex);
+}
+
+static void sculpt_undo_node_compress_task_cb(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SculptUndoNode **unodes = userdata;
+  sculpt_undo_node_compress(unodes[i]);
+}
+
+static void sculpt_undo_node_decompress_task_cb(void *__restrict userdata,
+                                                const int i,
+                                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SculptUndoNode **unodes = userdata;
+  sculpt_undo_node_decompress(unodes[i]);
+}
+
+/* Compress or decompress all nodes of the list in parallel.
+ *
+ * \param r_undo_size: The memory usage of the nodes is updated, can be null. */
+static void sculpt_undo_nodes_compress_ex(ListBase *lb, const bool compress, size_t *r_undo_size)
+{
+  const int nodes_num = BLI_listbase_count(lb);
+  if (nodes_num == 0) {
+    return;
+  }
+
+  SculptUndoNode **unodes = MEM_malloc_arrayN(nodes_num, sizeof(*unodes), __func__);
+  size_t size_old = 0;
+  int i = 0;
+  LISTBASE_FOREACH (SculptUndoNode *, unode, lb) {
+    unodes[i++] = unode;
+    size_old += sculpt_undo_node_arrays_size(unode);
+  }
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0,
+                          nodes_num,
+                          unodes,
+                          compress ? sculpt_undo_node_compress_task_cb :
+                                     sculpt_undo_node_decompress_task_cb,
+                          &settings);
+
+  if (r_undo_size) {
+    size_t size_new = 0;
+    for (i = 0; i < nodes_num; i++) {
+      size_new += sculpt_undo_node_arrays_size(unodes[i]);
+    }
+    *r_undo_size = *r_undo_size - size_old + size_new;
+  }
+
+  MEM_freeN(unodes);
+}
+
+/** \} */
+
+static void sculpt_undo_restore_list_ex(bContext *C, Depsgraph *depsgraph, ListBase *lb)
 {
   Scene *scene = CTX_data_scene(C);
   ViewLayer *view_layer = CTX_data_view_layer(C);
@@ -1108,6 +1335,14 @@ static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase
   MEM_SAFE_FREE(undo_modified_grids);
 }
 
+static void sculpt_undo_restore_list(bContext *C, Depsgraph *depsgraph, ListBase *lb)
+{
+  /* Restoring swaps the stored data with the current state, which is compressed again after. */
+  sculpt_undo_nodes_compress_ex(lb, false, NULL);
+  sculpt_undo_restore_list_ex(C, depsgraph, lb);
+  sculpt_undo_nodes_compress_ex(lb, true, NULL);
+}
+
 static void sculpt_undo_free_list(ListBase *lb)
 {
   SculptUndoNode *unode = lb->first;
@@ -1166,6 +1401,9 @@ static void sculpt_undo_free_list(ListBase *lb)
     if (unode->face_sets) {
       MEM_freeN(unode->face_sets);
     }
+    if (unode->compressed_data) {
+      MEM_freeN(unode->compressed_data);
+    }
 
     MEM_freeN(unode);
 
@@ -1206,6 +1444,7 @@ SculptUndoNode *SCULPT_undo_get_node(PBVHNode *node, SculptUndoType type)
 
   LISTBASE_FOREACH (SculptUndoNode *, unode, &usculpt->nodes) {
     if (unode->node == node && unode->type == type) {
+      sculpt_undo_node_ensure_decompressed(usculpt, unode);
       return unode;
     }
   }
@@ -1221,7 +1460,11 @@ SculptUndoNode *SCULPT_undo_get_first_node()
     return NULL;
   }
 
-  return usculpt->nodes.first;
+  SculptUndoNode *unode = usculpt->nodes.first;
+  if (unode) {
+    sculpt_undo_node_ensure_decompressed(usculpt, unode);
+  }
+  return unode;
 }
 
 static size_t sculpt_undo_alloc_and_store_hidden(PBVH *pbvh, SculptUndoNode *unode)
@@ -1273,6 +1516,7 @@ static SculptUndoNode *sculpt_undo_find_or_alloc_node_type(Object *object, Sculp
 
   LISTBASE_FOREACH (SculptUndoNode *, unode, &usculpt->nodes) {
     if (unode->type == type) {
+      sculpt_undo_node_ensure_decompressed(usculpt, unode);
       return unode;
     }
   }
@@ -1795,6 +2039,8 @@ void SCULPT_undo_push_end_ex(struct Object *ob, const bool use_nested_undo)
     }
   }
 
+  sculpt_undo_nodes_compress_ex(&usculpt->nodes, true, &usculpt->undo_size);
+
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = G_MAIN->wm.first;
   if (wm->op_undo_depth == 0 || use_nested_undo) {
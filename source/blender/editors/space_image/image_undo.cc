@@ -201,25 +201,27 @@ void *ED_image_paint_tile_push(PaintTileMap *paint_tile_map,
                                bool use_thread_lock,
                                bool find_prev)
 {
-  if (use_thread_lock) {
-    BLI_spin_lock(&paint_tiles_lock);
-  }
   const bool has_float = (ibuf->rect_float != nullptr);
 
   /* check if tile is already pushed */
 
   /* in projective painting we keep accounting of tiles, so if we need one pushed, just push! */
   if (find_prev) {
+    if (use_thread_lock) {
+      BLI_spin_lock(&paint_tiles_lock);
+    }
     void *data = ED_image_paint_tile_find(
         paint_tile_map, image, ibuf, iuser, x_tile, y_tile, r_mask, true);
+    if (use_thread_lock) {
+      BLI_spin_unlock(&paint_tiles_lock);
+    }
     if (data) {
-      if (use_thread_lock) {
-        BLI_spin_unlock(&paint_tiles_lock);
-      }
       return data;
     }
   }
 
+  /* The tile is allocated and copied without holding the lock, as the temporary buffer is owned by
+   * the calling thread. Only the map itself is shared between the painting threads. */
   if (*tmpibuf == nullptr) {
     *tmpibuf = imbuf_alloc_temp_tile();
   }
@@ -274,18 +276,33 @@ void *ED_image_paint_tile_push(PaintTileMap *paint_tile_map,
   key.x_tile = x_tile;
   key.y_tile = y_tile;
   PaintTile *existing_tile = nullptr;
+  if (use_thread_lock) {
+    BLI_spin_lock(&paint_tiles_lock);
+  }
   paint_tile_map->map.add_or_modify(
       key,
       [&](PaintTile **pptile) { *pptile = ptile; },
       [&](PaintTile **pptile) { existing_tile = *pptile; });
   if (existing_tile) {
+    /* Another thread pushed the same tile in the meantime, use that one instead. */
     ptile_free(ptile);
     ptile = existing_tile;
+    ptile->valid = true;
+    if (r_mask) {
+      if (!ptile->mask) {
+        ptile->mask = static_cast<uint16_t *>(MEM_callocN(
+            sizeof(uint16_t) * square_i(ED_IMAGE_UNDO_TILE_SIZE), "PaintTile.mask"));
+      }
+      *r_mask = ptile->mask;
+    }
+    if (r_valid) {
+      *r_valid = &ptile->valid;
+    }
   }
-
   if (use_thread_lock) {
     BLI_spin_unlock(&paint_tiles_lock);
   }
+
   return ptile->rect.pt;
 }
 
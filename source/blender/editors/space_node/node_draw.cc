@@ -1812,6 +1812,34 @@ static std::string node_get_execution_time_label(TreeDrawContext &tree_draw_ctx,
   return stream.str() + " ms";
 }
 
+/**
+ * Size of the geometry outputs of the node in the latest evaluation. For the group output node,
+ * the geometry passed out of the group is used.
+ */
+static std::optional<int64_t> node_get_output_memory(TreeDrawContext &tree_draw_ctx,
+                                                     const bNode &node)
+{
+  geo_log::GeoTreeLog *tree_log = tree_draw_ctx.geo_tree_log;
+  if (tree_log == nullptr) {
+    return std::nullopt;
+  }
+  tree_log->ensure_socket_values();
+  const geo_log::GeoNodeLog *node_log = tree_log->nodes.lookup_ptr(node.identifier);
+  if (node_log == nullptr) {
+    return std::nullopt;
+  }
+  const Map<int, geo_log::ValueLog *> &value_logs = node.type == NODE_GROUP_OUTPUT ?
+                                                       node_log->input_values_ :
+                                                       node_log->output_values_;
+  std::optional<int64_t> memory;
+  for (const geo_log::ValueLog *value_log : value_logs.values()) {
+    if (const auto *geometry_log = dynamic_cast<const geo_log::GeometryInfoLog *>(value_log)) {
+      memory = memory.value_or(0) + geometry_log->memory_bytes;
+    }
+  }
+  return memory;
+}
+
 struct NodeExtraInfoRow {
   std::string text;
   int icon;
@@ -1952,6 +1980,20 @@ static Vector<NodeExtraInfoRow> node_get_extra_info(TreeDrawContext &tree_draw_c
     }
   }
 
+  if (snode.overlay.flag & SN_OVERLAY_SHOW_MEMORY && snode.edittree->type == NTREE_GEOMETRY) {
+    if (const std::optional<int64_t> memory = node_get_output_memory(tree_draw_ctx, node)) {
+      char memory_str[15];
+      BLI_str_format_byte_unit(memory_str, *memory, false);
+      NodeExtraInfoRow row;
+      row.text = memory_str;
+      row.tooltip = TIP_(
+          "The size of the geometry output by the node in the node tree's latest evaluation, "
+          "including data that is shared with its input geometry");
+      row.icon = ICON_MEMORY;
+      rows.append(std::move(row));
+    }
+  }
+
   if (snode.edittree->type == NTREE_GEOMETRY) {
     if (geo_log::GeoTreeLog *tree_log = tree_draw_ctx.geo_tree_log) {
       tree_log->ensure_debug_messages();
@@ -28,6 +28,7 @@
 #include "BKE_node_tree_update.h"
 #include "BKE_report.h"
 #include "BKE_scene.h"
+#include "BKE_screen.h"
 #include "BKE_workspace.h"
 
 #include "BLT_translation.h"
@@ -87,6 +88,9 @@ struct CompoJob {
   ViewLayer *view_layer;
   bNodeTree *ntree;
   int recalc_flags;
+  /* Visible part of the viewer image in the backdrop, see #bNodeTreeRuntime::backdrop_border. */
+  bool use_backdrop_border;
+  rctf backdrop_border;
   /* Evaluated state/ */
   Depsgraph *compositor_depsgraph;
   bNodeTree *localtree;
@@ -277,6 +281,8 @@ static void compo_startjob(void *cjv,
   ntree->runtime->prh = cj;
   ntree->runtime->update_draw = compo_redrawjob;
   ntree->runtime->udh = cj;
+  ntree->runtime->use_backdrop_border = cj->use_backdrop_border;
+  ntree->runtime->backdrop_border = cj->backdrop_border;
 
   // XXX BIF_store_spare();
   /* 1 is do_previews */
@@ -323,6 +329,57 @@ static void compo_completejob(void *cjv)
 /** \name Composite Job C API
  * \{ */
 
+/**
+ * Get the part of the viewer image that is visible in the backdrop of the node editor in the
+ * context, when it only composites the visible region. Returns false when the whole image has to
+ * be computed.
+ */
+static bool compo_get_backdrop_border(const bContext *C, Main *bmain, rctf *r_border)
+{
+  ScrArea *area = CTX_wm_area(C);
+  if (area == nullptr || area->spacetype != SPACE_NODE) {
+    return false;
+  }
+  const SpaceNode *snode = static_cast<const SpaceNode *>(area->spacedata.first);
+  if ((snode->flag & SNODE_BACKDRAW) == 0 || (snode->flag & SNODE_BACKDRAW_VISIBLE_REGION) == 0) {
+    return false;
+  }
+  const ARegion *region = BKE_area_find_region_type(area, RGN_TYPE_WINDOW);
+  if (region == nullptr || snode->zoom <= 0.0f) {
+    return false;
+  }
+
+  Image *ima = BKE_image_ensure_viewer(bmain, IMA_TYPE_COMPOSITE, "Viewer Node");
+  void *lock;
+  ImBuf *ibuf = BKE_image_acquire_ibuf(ima, nullptr, &lock);
+  if (ibuf == nullptr || ibuf->x == 0 || ibuf->y == 0) {
+    /* The image size is unknown before the first execution. */
+    BKE_image_release_ibuf(ima, ibuf, lock);
+    return false;
+  }
+  const float width = ibuf->x * snode->zoom;
+  const float height = ibuf->y * snode->zoom;
+  BKE_image_release_ibuf(ima, ibuf, lock);
+
+  /* Same placement of the image as in #draw_nodespace_back_pix. */
+  const float x = (region->winx - width) / 2 + snode->xof;
+  const float y = (region->winy - height) / 2 + snode->yof;
+  rctf border;
+  border.xmin = clamp_f(-x / width, 0.0f, 1.0f);
+  border.xmax = clamp_f((region->winx - x) / width, 0.0f, 1.0f);
+  border.ymin = clamp_f(-y / height, 0.0f, 1.0f);
+  border.ymax = clamp_f((region->winy - y) / height, 0.0f, 1.0f);
+  if (border.xmin >= border.xmax || border.ymin >= border.ymax) {
+    /* The image is outside of the region, keep computing it all rather than nothing. */
+    return false;
+  }
+  if (border.xmin == 0.0f && border.xmax == 1.0f && border.ymin == 0.0f && border.ymax == 1.0f) {
+    return false;
+  }
+  *r_border = border;
+  return true;
+}
+
 void ED_node_composite_job(const bContext *C, bNodeTree *nodetree, Scene *scene_owner)
 {
   using namespace blender::ed::space_node;
@@ -357,6 +414,7 @@ void ED_node_composite_job(const bContext *C, bNodeTree *nodetree, Scene *scene_
   cj->view_layer = view_layer;
   cj->ntree = nodetree;
   cj->recalc_flags = compo_get_recalc_flags(C);
+  cj->use_backdrop_border = compo_get_backdrop_border(C, bmain, &cj->backdrop_border);
 
   /* setup job */
   WM_jobs_customdata_set(wm_job, cj, compo_freejob);
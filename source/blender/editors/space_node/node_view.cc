@@ -184,6 +184,19 @@ struct NodeViewMove {
   float xof_orig, yof_orig;
 };
 
+/**
+ * When only the visible region of the backdrop is composited, changing the backdrop view requires
+ * compositing again.
+ */
+static void snode_bg_view_changed(bContext *C, SpaceNode *snode)
+{
+  if ((snode->flag & SNODE_BACKDRAW_VISIBLE_REGION) == 0) {
+    return;
+  }
+  snode->runtime->recalc_regular_compositing = true;
+  ED_area_tag_refresh(CTX_wm_area(C));
+}
+
 static int snode_bg_viewmove_modal(bContext *C, wmOperator *op, const wmEvent *event)
 {
   SpaceNode *snode = CTX_wm_space_node(C);
@@ -213,6 +226,7 @@ static int snode_bg_viewmove_modal(bContext *C, wmOperator *op, const wmEvent *e
       if (event->val == KM_RELEASE) {
         MEM_freeN(nvm);
         op->customdata = nullptr;
+        snode_bg_view_changed(C, snode);
         return OPERATOR_FINISHED;
       }
       break;
@@ -313,6 +327,7 @@ static int backimage_zoom_exec(bContext *C, wmOperator *op)
   ED_region_tag_redraw(region);
   WM_main_add_notifier(NC_NODE | ND_DISPLAY, nullptr);
   WM_main_add_notifier(NC_SPACE | ND_SPACE_NODE_VIEW, nullptr);
+  snode_bg_view_changed(C, snode);
 
   return OPERATOR_FINISHED;
 }
@@ -378,6 +393,7 @@ static int backimage_fit_exec(bContext *C, wmOperator * /*op*/)
   ED_region_tag_redraw(region);
   WM_main_add_notifier(NC_NODE | ND_DISPLAY, nullptr);
   WM_main_add_notifier(NC_SPACE | ND_SPACE_NODE_VIEW, nullptr);
+  snode_bg_view_changed(C, snode);
 
   return OPERATOR_FINISHED;
 }
@@ -279,6 +279,12 @@ TreeElement *outliner_add_collection_recursive(SpaceOutliner *space_outliner,
 
 bool outliner_requires_rebuild_on_select_or_active_change(
     const struct SpaceOutliner *space_outliner);
+/**
+ * Changes of the visibility or selectability of objects only need a rebuild when the tree is
+ * filtered based on them, otherwise redrawing is enough.
+ */
+bool outliner_requires_rebuild_on_visibility_change(const struct SpaceOutliner *space_outliner);
+bool outliner_requires_rebuild_on_frame_change(const struct SpaceOutliner *space_outliner);
 
 typedef struct IDsSelectedData {
   struct ListBase selected_array;
@@ -217,6 +217,22 @@ bool outliner_requires_rebuild_on_select_or_active_change(const SpaceOutliner *s
   return exclude_flags & (SO_FILTER_OB_STATE_SELECTED | SO_FILTER_OB_STATE_ACTIVE);
 }
 
+bool outliner_requires_rebuild_on_visibility_change(const SpaceOutliner *space_outliner)
+{
+  int exclude_flags = outliner_exclude_filter_get(space_outliner);
+  /* Need to rebuild tree to re-apply filter if visibility changed while filtering based on
+   * visibility. */
+  return exclude_flags & (SO_FILTER_OB_STATE_VISIBLE | SO_FILTER_OB_STATE_SELECTABLE);
+}
+
+bool outliner_requires_rebuild_on_frame_change(const SpaceOutliner *space_outliner)
+{
+  /* The data API view shows RNA collections that may change with the frame. In other display
+   * modes only the filtering can change, since the visibility of objects can be animated. */
+  return (space_outliner->outlinevis == SO_DATA_API) ||
+         outliner_requires_rebuild_on_visibility_change(space_outliner);
+}
+
 /* special handling of hierarchical non-lib data */
 static void outliner_add_bone(SpaceOutliner *space_outliner,
                               ListBase *lb,
@@ -124,10 +124,26 @@ static void outliner_main_region_listener(const wmRegionListenerParams *params)
           }
           break;
         case ND_OB_VISIBLE:
+          /* Avoid rebuilding large trees when hiding objects, e.g. with the eye icon. */
+          if (outliner_requires_rebuild_on_visibility_change(space_outliner)) {
+            ED_region_tag_redraw(region);
+          }
+          else {
+            ED_region_tag_redraw_no_rebuild(region);
+          }
+          break;
+        case ND_FRAME:
+          /* Avoid rebuilding on every frame during playback. */
+          if (outliner_requires_rebuild_on_frame_change(space_outliner)) {
+            ED_region_tag_redraw(region);
+          }
+          else {
+            ED_region_tag_redraw_no_rebuild(region);
+          }
+          break;
         case ND_OB_RENDER:
         case ND_MODE:
         case ND_KEYINGSET:
-        case ND_FRAME:
         case ND_RENDER_OPTIONS:
         case ND_SEQUENCER:
         case ND_LAYER_CONTENT:
@@ -1490,6 +1490,31 @@ void ED_sequencer_special_preview_clear(void)
   sequencer_special_update_set(NULL);
 }
 
+static void sequencer_render_data_get(struct Main *bmain,
+                                      struct Depsgraph *depsgraph,
+                                      Scene *scene,
+                                      SpaceSeq *sseq,
+                                      const char *viewname,
+                                      SeqRenderData *r_context)
+{
+  double render_size;
+
+  if (sseq->render_size == SEQ_RENDER_SIZE_SCENE) {
+    render_size = scene->r.size / 100.0;
+  }
+  else {
+    render_size = SEQ_rendersize_to_scale_factor(sseq->render_size);
+  }
+
+  const int rectx = roundf(render_size * scene->r.xsch);
+  const int recty = roundf(render_size * scene->r.ysch);
+
+  SEQ_render_new_render_data(
+      bmain, depsgraph, scene, rectx, recty, sseq->render_size, false, r_context);
+  r_context->view_id = BKE_scene_multiview_view_id_get(&scene->r, viewname);
+  r_context->use_proxies = (sseq->flag & SEQ_USE_PROXIES) != 0;
+}
+
 ImBuf *sequencer_ibuf_get(struct Main *bmain,
                           ARegion *region,
                           struct Depsgraph *depsgraph,
@@ -1501,28 +1526,13 @@ ImBuf *sequencer_ibuf_get(struct Main *bmain,
 {
   SeqRenderData context = {0};
   ImBuf *ibuf;
-  int rectx, recty;
-  double render_size;
   short is_break = G.is_break;
 
   if (sseq->render_size == SEQ_RENDER_SIZE_NONE) {
     return NULL;
   }
 
-  if (sseq->render_size == SEQ_RENDER_SIZE_SCENE) {
-    render_size = scene->r.size / 100.0;
-  }
-  else {
-    render_size = SEQ_rendersize_to_scale_factor(sseq->render_size);
-  }
-
-  rectx = roundf(render_size * scene->r.xsch);
-  recty = roundf(render_size * scene->r.ysch);
-
-  SEQ_render_new_render_data(
-      bmain, depsgraph, scene, rectx, recty, sseq->render_size, false, &context);
-  context.view_id = BKE_scene_multiview_view_id_get(&scene->r, viewname);
-  context.use_proxies = (sseq->flag & SEQ_USE_PROXIES) != 0;
+  sequencer_render_data_get(bmain, depsgraph, scene, sseq, viewname, &context);
 
   /* Sequencer could start rendering, in this case we need to be sure it wouldn't be canceled
    * by Escape pressed somewhere in the past. */
@@ -1562,6 +1572,195 @@ ImBuf *sequencer_ibuf_get(struct Main *bmain,
   return ibuf;
 }
 
+static void sequencer_display_size(Scene *scene, float r_viewrect[2])
+{
+  r_viewrect[0] = (float)scene->r.xsch;
+  r_viewrect[1] = (float)scene->r.ysch;
+
+  r_viewrect[0] *= scene->r.xasp / scene->r.yasp;
+}
+
+static GPUTexture *sequencer_gpu_composite_texture_create(ImBuf *ibuf)
+{
+  eGPUTextureFormat format;
+  eGPUDataFormat data;
+  void *buffer;
+  if (ibuf->rect_float && ibuf->channels == 4) {
+    format = GPU_RGBA16F;
+    data = GPU_DATA_FLOAT;
+    buffer = ibuf->rect_float;
+  }
+  else if (ibuf->rect_float == NULL && ibuf->rect) {
+    format = GPU_RGBA8;
+    data = GPU_DATA_UBYTE;
+    buffer = ibuf->rect;
+  }
+  else {
+    return NULL;
+  }
+
+  GPUTexture *texture = GPU_texture_create_2d_ex(
+      "seq_composite_strip", ibuf->x, ibuf->y, 1, format, GPU_TEXTURE_USAGE_SHADER_READ, NULL);
+  GPU_texture_update(texture, data, buffer);
+  GPU_texture_filter_mode(texture, true);
+  return texture;
+}
+
+static void sequencer_gpu_composite_strip_draw(Scene *scene,
+                                               Sequence *seq,
+                                               ImBuf *ibuf,
+                                               GPUTexture *texture)
+{
+  const StripCrop *crop = seq->strip->crop;
+  const float width = seq->strip->stripdata->orig_width;
+  const float height = seq->strip->stripdata->orig_height;
+  const float fac = seq->blend_opacity / 100.0f;
+
+  /* Texture coordinates of the crop, in the order of the corners of the strip quad. */
+  const float u_min = crop->left / width;
+  const float u_max = (width - crop->right) / width;
+  const float v_min = crop->bottom / height;
+  const float v_max = (height - crop->top) / height;
+  const float uv[4][2] = {{u_max, v_max}, {u_max, v_min}, {u_min, v_min}, {u_min, v_max}};
+
+  float quad[4][2];
+  SEQ_image_transform_final_quad_get(scene, seq, quad);
+
+  GPUVertFormat *imm_format = immVertexFormat();
+  uint pos = GPU_vertformat_attr_add(imm_format, "pos", GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
+  uint texCoord = GPU_vertformat_attr_add(
+      imm_format, "texCoord", GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
+
+  /* Float images are premultiplied, byte images have straight alpha. */
+  if (ibuf->rect_float) {
+    GPU_blend(GPU_BLEND_ALPHA_PREMULT);
+  }
+  else {
+    GPU_blend(GPU_BLEND_ALPHA);
+  }
+
+  GPU_texture_bind(texture, 0);
+  immBindBuiltinProgram(GPU_SHADER_3D_IMAGE_COLOR);
+  if (ibuf->rect_float) {
+    immUniformColor4f(fac, fac, fac, fac);
+  }
+  else {
+    immUniformColor4f(1.0f, 1.0f, 1.0f, fac);
+  }
+
+  immBegin(GPU_PRIM_TRI_FAN, 4);
+  for (int i = 0; i < 4; i++) {
+    immAttr2fv(texCoord, uv[i]);
+    immVertex2fv(pos, quad[i]);
+  }
+  immEnd();
+
+  immUnbindProgram();
+  GPU_texture_unbind(texture);
+  GPU_blend(GPU_BLEND_NONE);
+}
+
+/**
+ * Composite the strips of the frame on the GPU, instead of rendering the frame with
+ * #sequencer_ibuf_get. This is only possible when the strips are plain images or movies that are
+ * alpha over blended, see #SEQ_render_gpu_composite_strips_get.
+ *
+ * \param r_colorspace: Color space of the strip images, which is the sequencer color space.
+ * \return Off-screen buffer with the premultiplied frame, or NULL when the frame has to be
+ * rendered on the CPU.
+ */
+static GPUOffScreen *sequencer_gpu_composite(struct Main *bmain,
+                                            struct Depsgraph *depsgraph,
+                                            Scene *scene,
+                                            SpaceSeq *sseq,
+                                            int timeline_frame,
+                                            int frame_ofs,
+                                            const char *viewname,
+                                            struct ColorSpace **r_colorspace)
+{
+  if (!U.experimental.use_sequencer_gpu_compositing || special_seq_update != NULL ||
+      sseq->render_size == SEQ_RENDER_SIZE_NONE || sseq->mainb != SEQ_DRAW_IMG_IMBUF ||
+      sseq->zebra != 0) {
+    return NULL;
+  }
+
+  SeqRenderData context = {0};
+  sequencer_render_data_get(bmain, depsgraph, scene, sseq, viewname, &context);
+  const float frame = timeline_frame + frame_ofs;
+
+  Sequence *seq_arr[MAXSEQ + 1];
+  const int count = SEQ_render_gpu_composite_strips_get(
+      &context, frame, sseq->chanshown, seq_arr);
+  if (count == 0) {
+    return NULL;
+  }
+
+  /* Only image and movie strips are composited, rendering them doesn't use the GPU context. */
+  short is_break = G.is_break;
+  G.is_break = false;
+  ImBuf *ibufs[MAXSEQ + 1];
+  for (int i = 0; i < count; i++) {
+    ibufs[i] = SEQ_render_give_ibuf_raw(&context, frame, seq_arr[i]);
+  }
+  G.is_break = is_break;
+
+  GPUTexture *textures[MAXSEQ + 1];
+  bool is_valid = true;
+  *r_colorspace = NULL;
+  for (int i = 0; i < count; i++) {
+    textures[i] = ibufs[i] ? sequencer_gpu_composite_texture_create(ibufs[i]) : NULL;
+    is_valid &= ibufs[i] == NULL || textures[i] != NULL;
+    if (textures[i]) {
+      *r_colorspace = ibufs[i]->rect_float ? ibufs[i]->float_colorspace :
+                                             ibufs[i]->rect_colorspace;
+    }
+  }
+
+  GPUOffScreen *offscreen = NULL;
+  if (is_valid) {
+    offscreen = GPU_offscreen_create(context.rectx, context.recty, false, GPU_RGBA16F, NULL);
+  }
+
+  if (offscreen) {
+    float viewrect[2];
+    sequencer_display_size(scene, viewrect);
+
+    GPU_offscreen_bind(offscreen, true);
+    GPU_clear_color(0.0f, 0.0f, 0.0f, 0.0f);
+
+    GPU_matrix_push_projection();
+    GPU_matrix_push();
+    GPU_matrix_ortho_set(-viewrect[0] / 2.0f,
+                         viewrect[0] / 2.0f,
+                         -viewrect[1] / 2.0f,
+                         viewrect[1] / 2.0f,
+                         -1.0f,
+                         1.0f);
+    GPU_matrix_identity_set();
+
+    for (int i = 0; i < count; i++) {
+      if (textures[i]) {
+        sequencer_gpu_composite_strip_draw(scene, seq_arr[i], ibufs[i], textures[i]);
+      }
+    }
+
+    GPU_matrix_pop();
+    GPU_matrix_pop_projection();
+    GPU_offscreen_unbind(offscreen, true);
+  }
+
+  for (int i = 0; i < count; i++) {
+    if (textures[i]) {
+      GPU_texture_free(textures[i]);
+    }
+    if (ibufs[i]) {
+      IMB_freeImBuf(ibufs[i]);
+    }
+  }
+
+  return offscreen;
+}
+
 static void sequencer_check_scopes(SequencerScopes *scopes, ImBuf *ibuf)
 {
   if (scopes->reference_ibuf != ibuf) {
@@ -1607,14 +1806,6 @@ static ImBuf *sequencer_make_scope(Scene *scene, ImBuf *ibuf, ImBuf *(*make_scop
   return scope;
 }
 
-static void sequencer_display_size(Scene *scene, float r_viewrect[2])
-{
-  r_viewrect[0] = (float)scene->r.xsch;
-  r_viewrect[1] = (float)scene->r.ysch;
-
-  r_viewrect[0] *= scene->r.xasp / scene->r.yasp;
-}
-
 static void sequencer_draw_gpencil_overlay(const bContext *C)
 {
   /* Draw grease-pencil (image aligned). */
@@ -1859,6 +2050,42 @@ static void sequencer_preview_get_rect(rctf *preview,
   }
 }
 
+static void sequencer_draw_display_quad(Scene *scene,
+                                        ARegion *region,
+                                        SpaceSeq *sseq,
+                                        uint pos,
+                                        uint texCoord,
+                                        bool draw_overlay,
+                                        bool draw_backdrop)
+{
+  rctf preview;
+  rctf canvas;
+  sequencer_preview_get_rect(&preview, scene, region, sseq, draw_overlay, draw_backdrop);
+
+  if (draw_overlay && (sseq->overlay_frame_type == SEQ_OVERLAY_FRAME_TYPE_RECT)) {
+    canvas = scene->ed->overlay_frame_rect;
+  }
+  else {
+    BLI_rctf_init(&canvas, 0.0f, 1.0f, 0.0f, 1.0f);
+  }
+
+  immBegin(GPU_PRIM_TRI_FAN, 4);
+
+  immAttr2f(texCoord, canvas.xmin, canvas.ymin);
+  immVertex2f(pos, preview.xmin, preview.ymin);
+
+  immAttr2f(texCoord, canvas.xmin, canvas.ymax);
+  immVertex2f(pos, preview.xmin, preview.ymax);
+
+  immAttr2f(texCoord, canvas.xmax, canvas.ymax);
+  immVertex2f(pos, preview.xmax, preview.ymax);
+
+  immAttr2f(texCoord, canvas.xmax, canvas.ymin);
+  immVertex2f(pos, preview.xmax, preview.ymin);
+
+  immEnd();
+}
+
 static void sequencer_draw_display_buffer(const bContext *C,
                                           Scene *scene,
                                           ARegion *region,
@@ -1920,35 +2147,77 @@ static void sequencer_draw_display_buffer(const bContext *C,
     immUniformColor3f(1.0f, 1.0f, 1.0f);
   }
 
-  immBegin(GPU_PRIM_TRI_FAN, 4);
+  sequencer_draw_display_quad(scene, region, sseq, pos, texCoord, draw_overlay, draw_backdrop);
 
-  rctf preview;
-  rctf canvas;
-  sequencer_preview_get_rect(&preview, scene, region, sseq, draw_overlay, draw_backdrop);
+  GPU_texture_unbind(texture);
+  GPU_texture_free(texture);
 
-  if (draw_overlay && (sseq->overlay_frame_type == SEQ_OVERLAY_FRAME_TYPE_RECT)) {
-    canvas = scene->ed->overlay_frame_rect;
+  if (!glsl_used) {
+    immUnbindProgram();
   }
   else {
-    BLI_rctf_init(&canvas, 0.0f, 1.0f, 0.0f, 1.0f);
+    IMB_colormanagement_finish_glsl_draw();
   }
 
-  immAttr2f(texCoord, canvas.xmin, canvas.ymin);
-  immVertex2f(pos, preview.xmin, preview.ymin);
+  if (buffer_cache_handle) {
+    IMB_display_buffer_release(buffer_cache_handle);
+  }
 
-  immAttr2f(texCoord, canvas.xmin, canvas.ymax);
-  immVertex2f(pos, preview.xmin, preview.ymax);
+  if (sseq->mainb == SEQ_DRAW_IMG_IMBUF && sseq->flag & SEQ_USE_ALPHA) {
+    GPU_blend(GPU_BLEND_NONE);
+  }
 
-  immAttr2f(texCoord, canvas.xmax, canvas.ymax);
-  immVertex2f(pos, preview.xmax, preview.ymax);
+  if (draw_backdrop) {
+    GPU_matrix_pop();
+    GPU_matrix_pop_projection();
+  }
+}
 
-  immAttr2f(texCoord, canvas.xmax, canvas.ymin);
-  immVertex2f(pos, preview.xmax, preview.ymin);
+/* Draw the frame composited by #sequencer_gpu_composite, with the display transform. */
+static void sequencer_draw_display_offscreen(const bContext *C,
+                                             Scene *scene,
+                                             ARegion *region,
+                                             SpaceSeq *sseq,
+                                             GPUOffScreen *offscreen,
+                                             struct ColorSpace *colorspace,
+                                             bool draw_overlay,
+                                             bool draw_backdrop)
+{
+  if (sseq->flag & SEQ_USE_ALPHA) {
+    GPU_blend(GPU_BLEND_ALPHA);
+  }
 
-  immEnd();
+  GPUVertFormat *imm_format = immVertexFormat();
+  uint pos = GPU_vertformat_attr_add(imm_format, "pos", GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
+  uint texCoord = GPU_vertformat_attr_add(
+      imm_format, "texCoord", GPU_COMP_F32, 2, GPU_FETCH_FLOAT);
+
+  if (draw_backdrop) {
+    GPU_matrix_push();
+    GPU_matrix_identity_set();
+    GPU_matrix_push_projection();
+    GPU_matrix_identity_projection_set();
+  }
+
+  GPUTexture *texture = GPU_offscreen_color_texture(offscreen);
+  GPU_texture_filter_mode(texture, false);
+  GPU_texture_bind(texture, 0);
+
+  bool glsl_used;
+  if (colorspace) {
+    glsl_used = IMB_colormanagement_setup_glsl_draw_from_space_ctx(C, colorspace, 0.0f, true);
+  }
+  else {
+    glsl_used = IMB_colormanagement_setup_glsl_draw_ctx(C, 0.0f, true);
+  }
+  if (!glsl_used) {
+    immBindBuiltinProgram(GPU_SHADER_3D_IMAGE_COLOR);
+    immUniformColor3f(1.0f, 1.0f, 1.0f);
+  }
+
+  sequencer_draw_display_quad(scene, region, sseq, pos, texCoord, draw_overlay, draw_backdrop);
 
   GPU_texture_unbind(texture);
-  GPU_texture_free(texture);
 
   if (!glsl_used) {
     immUnbindProgram();
@@ -1957,11 +2226,7 @@ static void sequencer_draw_display_buffer(const bContext *C,
     IMB_colormanagement_finish_glsl_draw();
   }
 
-  if (buffer_cache_handle) {
-    IMB_display_buffer_release(buffer_cache_handle);
-  }
-
-  if (sseq->mainb == SEQ_DRAW_IMG_IMBUF && sseq->flag & SEQ_USE_ALPHA) {
+  if (sseq->flag & SEQ_USE_ALPHA) {
     GPU_blend(GPU_BLEND_NONE);
   }
 
@@ -2158,8 +2423,19 @@ void sequencer_draw_preview(const bContext *C,
   }
 
   /* Get image. */
-  ibuf = sequencer_ibuf_get(
-      bmain, region, depsgraph, scene, sseq, preview_frame, offset, names[sseq->multiview_eye]);
+  struct ColorSpace *offscreen_colorspace = NULL;
+  GPUOffScreen *offscreen = sequencer_gpu_composite(bmain,
+                                                    depsgraph,
+                                                    scene,
+                                                    sseq,
+                                                    preview_frame,
+                                                    offset,
+                                                    names[sseq->multiview_eye],
+                                                    &offscreen_colorspace);
+  if (offscreen == NULL) {
+    ibuf = sequencer_ibuf_get(
+        bmain, region, depsgraph, scene, sseq, preview_frame, offset, names[sseq->multiview_eye]);
+  }
 
   /* Setup off-screen buffers. */
   GPUViewport *viewport = WM_draw_region_get_viewport(region);
@@ -2169,6 +2445,7 @@ void sequencer_draw_preview(const bContext *C,
 
   if (sseq->render_size == SEQ_RENDER_SIZE_NONE) {
     sequencer_preview_clear();
+    BLI_assert(offscreen == NULL);
     return;
   }
 
@@ -2200,6 +2477,11 @@ void sequencer_draw_preview(const bContext *C,
       ED_region_image_metadata_draw(0.0, 0.0, ibuf, &v2d->tot, 1.0, 1.0);
     }
   }
+  else if (offscreen) {
+    sequencer_draw_display_offscreen(
+        C, scene, region, sseq, offscreen, offscreen_colorspace, draw_overlay, draw_backdrop);
+    GPU_offscreen_free(offscreen);
+  }
 
   if (show_imbuf && (sseq->flag & SEQ_SHOW_OVERLAY)) {
     sequencer_draw_borders_overlay(sseq, v2d, scene);
@@ -1900,7 +1900,8 @@ static void tc_mesh_partial_types_calc(TransInfo *t, struct PartialTypeState *r_
       }
       break;
     }
-    case TFM_ROTATION: {
+    case TFM_ROTATION:
+    case TFM_TRACKBALL: {
       partial_for_looptri = PARTIAL_TYPE_GROUP;
       partial_for_normals = PARTIAL_TYPE_ALL;
       break;
@@ -1918,6 +1919,13 @@ static void tc_mesh_partial_types_calc(TransInfo *t, struct PartialTypeState *r_
       }
       break;
     }
+    case TFM_MIRROR: {
+      /* Mirroring is an affine transformation, however it flips the faces
+       * along a single axis which changes the normals relative to each other. */
+      partial_for_looptri = PARTIAL_TYPE_GROUP;
+      partial_for_normals = PARTIAL_TYPE_ALL;
+      break;
+    }
     default: {
       partial_for_looptri = PARTIAL_TYPE_ALL;
       partial_for_normals = PARTIAL_TYPE_ALL;
@@ -308,6 +308,8 @@ static void memfile_undosys_step_free(UndoStep *us_p)
     }
   }
 
+  /* Nothing is shared with other steps anymore, don't block the undo push while freeing. */
+  BLO_memfile_free_deferred(&us->data->memfile);
   BKE_memfile_undo_free(us->data);
 }
 
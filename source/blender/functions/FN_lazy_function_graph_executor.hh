@@ -9,6 +9,10 @@
  * another #Graph again).
  */
 
+#include <atomic>
+#include <chrono>
+
+#include "BLI_array.hh"
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
@@ -54,10 +58,36 @@ class GraphExecutorSideEffectProvider {
   virtual Vector<const FunctionNode *> get_nodes_with_side_effects(const Context &context) const;
 };
 
+/**
+ * Remembers how long the nodes of a graph took to execute. The executor uses that to run
+ * expensive nodes in separate tasks when multiple nodes are ready at the same time. The timings
+ * should outlive the executors, so that the measurements of one execution are used in the next.
+ */
+class GraphExecutorNodeTimings : NonCopyable, NonMovable {
+ private:
+  /** Indexed by #Node::index_in_graph. */
+  Array<std::atomic<int64_t>> durations_ns_;
+
+ public:
+  GraphExecutorNodeTimings(const Graph &graph);
+
+  std::chrono::nanoseconds get(const Node &node) const
+  {
+    return std::chrono::nanoseconds(
+        durations_ns_[node.index_in_graph()].load(std::memory_order_relaxed));
+  }
+
+  void set(const Node &node, const std::chrono::nanoseconds duration)
+  {
+    durations_ns_[node.index_in_graph()].store(duration.count(), std::memory_order_relaxed);
+  }
+};
+
 class GraphExecutor : public LazyFunction {
  public:
   using Logger = GraphExecutorLogger;
   using SideEffectProvider = GraphExecutorSideEffectProvider;
+  using NodeTimings = GraphExecutorNodeTimings;
 
  private:
   /**
@@ -78,6 +108,15 @@ class GraphExecutor : public LazyFunction {
    * during evaluation.
    */
   const SideEffectProvider *side_effect_provider_;
+  /**
+   * Optional timings of previous executions, which are also updated by this executor.
+   */
+  NodeTimings *node_timings_;
+  /**
+   * Nodes that took at least this long in a previous execution are run in a separate task when
+   * other nodes can be executed at the same time.
+   */
+  std::chrono::nanoseconds separate_task_min_duration_ = std::chrono::microseconds(200);
 
   friend class Executor;
 
@@ -86,7 +125,17 @@ class GraphExecutor : public LazyFunction {
                 Span<const OutputSocket *> graph_inputs,
                 Span<const InputSocket *> graph_outputs,
                 const Logger *logger,
-                const SideEffectProvider *side_effect_provider);
+                const SideEffectProvider *side_effect_provider,
+                NodeTimings *node_timings = nullptr);
+
+  /**
+   * Change the granularity of multi-threading. Lower values allow executing more nodes in
+   * parallel, at the cost of more threading overhead.
+   */
+  void set_separate_task_min_duration(const std::chrono::nanoseconds duration)
+  {
+    separate_task_min_duration_ = duration;
+  }
 
   void *init_storage(LinearAllocator<> &allocator) const override;
   void destruct_storage(void *storage) const override;
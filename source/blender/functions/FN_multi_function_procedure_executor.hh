@@ -15,12 +15,25 @@ class MFProcedureExecutor : public MultiFunction {
  private:
   MFSignature signature_;
   const MFProcedure &procedure_;
+  /** True when the procedure can be executed for parts of the mask separately. */
+  bool supports_chunks_;
+  /** Number of indices that are processed at the same time for large contiguous masks. */
+  int64_t chunk_size_;
 
  public:
   MFProcedureExecutor(const MFProcedure &procedure);
 
   void call(IndexMask mask, MFParams params, MFContext context) const override;
 
+  /**
+   * Number of indices for which the procedure is executed at once. Callers that split the work
+   * into parts themselves (e.g. for multi-threading) should use multiples of this size.
+   */
+  int64_t chunk_size() const
+  {
+    return chunk_size_;
+  }
+
  private:
   ExecutionHints get_execution_hints() const override;
 };
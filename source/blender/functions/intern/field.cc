@@ -276,6 +276,54 @@ static void build_multi_function_procedure_for_fields(MFProcedure &procedure,
   BLI_assert(procedure.validate());
 }
 
+/**
+ * Evaluate the procedure in chunks that are processed in parallel. Every task only accesses a
+ * small part of the inputs and outputs, so that the temporary buffers of the executor fit into the
+ * CPU cache.
+ */
+static void execute_procedure_in_chunks(const MFProcedureExecutor &executor,
+                                        const IndexMask mask,
+                                        const Span<GVArray> inputs,
+                                        const Span<GMutableSpan> outputs)
+{
+  MFContextBuilder context;
+
+  /* The executor splits contiguous masks into chunks itself and reuses its buffers between them,
+   * so tasks can be larger in that case. Other masks are split into cache sized tasks here. */
+  const int64_t chunk_size = executor.chunk_size();
+  const int64_t grain_size = mask.is_range() ? chunk_size * 4 : chunk_size;
+
+  if (mask.size() <= grain_size) {
+    MFParamsBuilder params{executor, &mask};
+    for (const GVArray &varray : inputs) {
+      params.add_readonly_single_input(varray);
+    }
+    for (const GMutableSpan &span : outputs) {
+      params.add_uninitialized_single_output(span);
+    }
+    executor.call(mask, params, context);
+    return;
+  }
+
+  threading::parallel_for(mask.index_range(), grain_size, [&](const IndexRange sub_range) {
+    const IndexMask sliced_mask = mask.slice(sub_range);
+    const IndexRange slice_range{sliced_mask[0], sliced_mask.last() - sliced_mask[0] + 1};
+
+    /* Offset the indices, so that the executor only allocates buffers for the chunk. */
+    Vector<int64_t> offset_mask_indices;
+    const IndexMask offset_mask = mask.slice_and_offset(sub_range, offset_mask_indices);
+
+    MFParamsBuilder params{executor, offset_mask.min_array_size()};
+    for (const GVArray &varray : inputs) {
+      params.add_readonly_single_input(varray.slice(slice_range));
+    }
+    for (const GMutableSpan &span : outputs) {
+      params.add_uninitialized_single_output(span.slice(slice_range));
+    }
+    executor.call(offset_mask, params, context);
+  });
+}
+
 Vector<GVArray> evaluate_fields(ResourceScope &scope,
                                 Span<GFieldRef> fields_to_evaluate,
                                 IndexMask mask,
@@ -371,14 +419,7 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         procedure, scope, field_tree_info, varying_fields_to_evaluate);
     MFProcedureExecutor procedure_executor{procedure};
 
-    MFParamsBuilder mf_params{procedure_executor, &mask};
-    MFContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
-
+    Vector<GMutableSpan> output_spans;
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
       const CPPType &type = field.cpp_type();
@@ -408,11 +449,10 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
       }
 
       /* Pass output buffer to the procedure executor. */
-      const GMutableSpan span{type, buffer, array_size};
-      mf_params.add_uninitialized_single_output(span);
+      output_spans.append({type, buffer, array_size});
     }
 
-    procedure_executor.call_auto(mask, mf_params, mf_context);
+    execute_procedure_in_chunks(procedure_executor, mask, field_context_inputs, output_spans);
   }
 
   /* Evaluate constant fields if necessary. */
@@ -699,10 +699,24 @@ class Executor {
       if (current_task.scheduled_nodes.is_empty()) {
         current_task.has_scheduled_nodes.store(false, std::memory_order_relaxed);
       }
+      else if (this->is_expensive_node(node)) {
+        /* Allow other threads to execute the remaining nodes while this one is running. */
+        if (this->try_enable_multi_threading()) {
+          this->move_scheduled_nodes_to_task_pool(current_task);
+        }
+      }
       this->run_node_task(node, current_task);
     }
   }
 
+  bool is_expensive_node(const FunctionNode &node) const
+  {
+    if (self_.node_timings_ == nullptr) {
+      return false;
+    }
+    return self_.node_timings_->get(node) >= self_.separate_task_min_duration_;
+  }
+
   void run_node_task(const FunctionNode &node, CurrentTask &current_task)
   {
     NodeState &node_state = *node_states_[node.index_in_graph()];
@@ -1111,8 +1125,24 @@ class Executor {
       *nodes = std::move(current_task.scheduled_nodes);
       current_task.has_scheduled_nodes.store(false, std::memory_order_relaxed);
     }
-    /* All nodes are pushed as a single task in the pool. This avoids unnecessary threading
+    /* Nodes that are known to be expensive get their own task, so that they can run in parallel.
+     * All other nodes are pushed as a single task in the pool. This avoids unnecessary threading
      * overhead when the nodes are fast to compute. */
+    for (int64_t i = nodes->size() - 1; i >= 0; i--) {
+      const FunctionNode *node = (*nodes)[i];
+      if (nodes->size() > 1 && this->is_expensive_node(*node)) {
+        nodes->remove(i);
+        FunctionNodeVector *single_node = MEM_new<FunctionNodeVector>(__func__);
+        single_node->append(node);
+        this->push_nodes_to_task_pool(single_node);
+      }
+    }
+    this->push_nodes_to_task_pool(nodes);
+  }
+
+  void push_nodes_to_task_pool(Vector<const FunctionNode *> *nodes)
+  {
+    using FunctionNodeVector = Vector<const FunctionNode *>;
     BLI_task_pool_push(
         task_pool_.load(),
         [](TaskPool *pool, void *data) {
@@ -1259,23 +1289,40 @@ inline void Executor::execute_node(const FunctionNode &node,
   };
 
   lazy_threading::HintReceiver blocking_hint_receiver{blocking_hint_fn};
-  fn.execute(node_params, fn_context);
+  if (self_.node_timings_ != nullptr) {
+    const auto start_time = std::chrono::steady_clock::now();
+    fn.execute(node_params, fn_context);
+    self_.node_timings_->set(node, std::chrono::steady_clock::now() - start_time);
+  }
+  else {
+    fn.execute(node_params, fn_context);
+  }
 
   if (self_.logger_ != nullptr) {
     self_.logger_->log_after_node_execute(node, node_params, fn_context);
   }
 }
 
+GraphExecutorNodeTimings::GraphExecutorNodeTimings(const Graph &graph)
+    : durations_ns_(graph.nodes().size())
+{
+  for (std::atomic<int64_t> &duration : durations_ns_) {
+    duration.store(0, std::memory_order_relaxed);
+  }
+}
+
 GraphExecutor::GraphExecutor(const Graph &graph,
                              const Span<const OutputSocket *> graph_inputs,
                              const Span<const InputSocket *> graph_outputs,
                              const Logger *logger,
-                             const SideEffectProvider *side_effect_provider)
+                             const SideEffectProvider *side_effect_provider,
+                             NodeTimings *node_timings)
     : graph_(graph),
       graph_inputs_(graph_inputs),
       graph_outputs_(graph_outputs),
       logger_(logger),
-      side_effect_provider_(side_effect_provider)
+      side_effect_provider_(side_effect_provider),
+      node_timings_(node_timings)
 {
   /* The graph executor can handle partial execution when there are still missing inputs. */
   allow_missing_requested_inputs_ = true;
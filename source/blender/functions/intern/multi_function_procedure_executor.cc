@@ -1,5 +1,7 @@
 /* SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
+
 #include "FN_multi_function_procedure_executor.hh"
 
 #include "BLI_stack.hh"
@@ -16,6 +18,23 @@ MFProcedureExecutor::MFProcedureExecutor(const MFProcedure &procedure) : procedu
 
   signature_ = signature.build();
   this->set_signature(&signature_);
+
+  /* Vector parameters can't be sliced cheaply. */
+  supports_chunks_ = std::none_of(
+      procedure.params().begin(), procedure.params().end(), [](const ConstMFParameter &param) {
+        return param.variable->data_type().is_vector();
+      });
+
+  /* Choose the chunk size so that one element of every variable fits into the L2 cache for all
+   * indices of a chunk. */
+  int64_t bytes_per_index = 0;
+  for (const MFVariable *variable : procedure.variables()) {
+    const MFDataType data_type = variable->data_type();
+    /* Vector variables are only estimated, their size depends on the number of elements. */
+    bytes_per_index += data_type.is_single() ? data_type.single_type().size() : 32;
+  }
+  const int64_t cache_size = 256 * 1024;
+  chunk_size_ = std::clamp<int64_t>(cache_size / std::max<int64_t>(bytes_per_index, 1), 512, 8192);
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -822,17 +841,17 @@ class VariableState : NonCopyable, NonMovable {
 /** Keeps track of the states of all variables during evaluation. */
 class VariableStates {
  private:
-  ValueAllocator value_allocator_;
+  ValueAllocator &value_allocator_;
   const MFProcedure &procedure_;
   /** The state of every variable, indexed by #MFVariable::index_in_procedure(). */
   Array<VariableState> variable_states_;
   IndexMask full_mask_;
 
  public:
-  VariableStates(LinearAllocator<> &linear_allocator,
+  VariableStates(ValueAllocator &value_allocator,
                  const MFProcedure &procedure,
                  IndexMask full_mask)
-      : value_allocator_(linear_allocator),
+      : value_allocator_(value_allocator),
         procedure_(procedure),
         variable_states_(procedure.variables().size()),
         full_mask_(full_mask)
@@ -1174,19 +1193,18 @@ class InstructionScheduler {
   }
 };
 
-void MFProcedureExecutor::call(IndexMask full_mask, MFParams params, MFContext context) const
+static void execute_procedure(const MFProcedureExecutor &fn,
+                              const MFProcedure &procedure,
+                              const IndexMask full_mask,
+                              MFParams params,
+                              MFContext context,
+                              ValueAllocator &value_allocator)
 {
-  BLI_assert(procedure_.validate());
-
-  AlignedBuffer<512, 64> local_buffer;
-  LinearAllocator<> linear_allocator;
-  linear_allocator.provide_buffer(local_buffer);
-
-  VariableStates variable_states{linear_allocator, procedure_, full_mask};
-  variable_states.add_initial_variable_states(*this, procedure_, params);
+  VariableStates variable_states{value_allocator, procedure, full_mask};
+  variable_states.add_initial_variable_states(fn, procedure, params);
 
   InstructionScheduler scheduler;
-  scheduler.add_referenced_indices(*procedure_.entry(), full_mask);
+  scheduler.add_referenced_indices(*procedure.entry(), full_mask);
 
   /* Loop until all indices got to a return instruction. */
   while (!scheduler.is_done()) {
@@ -1235,9 +1253,9 @@ void MFProcedureExecutor::call(IndexMask full_mask, MFParams params, MFContext c
     }
   }
 
-  for (const int param_index : this->param_indices()) {
-    const MFParamType param_type = this->param_type(param_index);
-    const MFVariable *variable = procedure_.params()[param_index].variable;
+  for (const int param_index : fn.param_indices()) {
+    const MFParamType param_type = fn.param_type(param_index);
+    const MFVariable *variable = procedure.params()[param_index].variable;
     VariableState &variable_state = variable_states.get_variable_state(*variable);
     switch (param_type.interface_type()) {
       case MFParamType::Input: {
@@ -1258,6 +1276,71 @@ void MFProcedureExecutor::call(IndexMask full_mask, MFParams params, MFContext c
   }
 }
 
+void MFProcedureExecutor::call(IndexMask full_mask, MFParams params, MFContext context) const
+{
+  BLI_assert(procedure_.validate());
+
+  AlignedBuffer<512, 64> local_buffer;
+  LinearAllocator<> linear_allocator;
+  linear_allocator.provide_buffer(local_buffer);
+  /* Shared by all chunks, so that the buffers of one chunk are reused by the next. */
+  ValueAllocator value_allocator{linear_allocator};
+
+  if (!supports_chunks_ || !full_mask.is_range() || full_mask.size() <= chunk_size_) {
+    execute_procedure(*this, procedure_, full_mask, params, context, value_allocator);
+    return;
+  }
+
+  /* Execute the entire procedure for one chunk after another, instead of executing every
+   * instruction for all indices at once. That way the intermediate buffers stay in the CPU cache
+   * between instructions. All chunks except the last have the same size, which is required for
+   * the reuse of span buffers. */
+  const IndexRange full_range = full_mask.as_range();
+  for (int64_t chunk_start = 0; chunk_start < full_range.size(); chunk_start += chunk_size_) {
+    const IndexRange chunk_range = full_range.slice(
+        chunk_start, std::min(chunk_size_, full_range.size() - chunk_start));
+
+    MFParamsBuilder chunk_params{*this, chunk_range.size()};
+    for (const int param_index : this->param_indices()) {
+      const MFParamType param_type = this->param_type(param_index);
+      switch (param_type.category()) {
+        case MFParamCategory::SingleInput: {
+          const GVArray &varray = params.readonly_single_input(param_index);
+          chunk_params.add_readonly_single_input(varray.slice(chunk_range));
+          break;
+        }
+        case MFParamCategory::SingleMutable: {
+          const GMutableSpan span = params.single_mutable(param_index);
+          chunk_params.add_single_mutable(span.slice(chunk_range));
+          break;
+        }
+        case MFParamCategory::SingleOutput: {
+          const GMutableSpan span = params.uninitialized_single_output_if_required(param_index);
+          if (span.is_empty()) {
+            chunk_params.add_ignored_single_output();
+          }
+          else {
+            chunk_params.add_uninitialized_single_output(span.slice(chunk_range));
+          }
+          break;
+        }
+        case MFParamCategory::VectorInput:
+        case MFParamCategory::VectorMutable:
+        case MFParamCategory::VectorOutput: {
+          BLI_assert_unreachable();
+          break;
+        }
+      }
+    }
+    execute_procedure(*this,
+                      procedure_,
+                      IndexRange(chunk_range.size()),
+                      chunk_params,
+                      context,
+                      value_allocator);
+  }
+}
+
 MultiFunction::ExecutionHints MFProcedureExecutor::get_execution_hints() const
 {
   ExecutionHints hints;
@@ -10,6 +10,7 @@
 #include "DNA_pointcloud_types.h"
 
 #include "BLI_devirtualize_parameters.hh"
+#include "BLI_math_batch.hh"
 #include "BLI_noise.hh"
 #include "BLI_task.hh"
 
@@ -64,6 +65,7 @@ struct AttributeFallbacksArray {
    */
   Array<const void *> array;
 
+  AttributeFallbacksArray() = default;
   AttributeFallbacksArray(int size) : array(size, nullptr)
   {
   }
@@ -271,17 +273,6 @@ struct InstanceContext {
   }
 };
 
-static void copy_transformed_positions(const Span<float3> src,
-                                       const float4x4 &transform,
-                                       MutableSpan<float3> dst)
-{
-  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
-    for (const int i : range) {
-      dst[i] = transform * src[i];
-    }
-  });
-}
-
 static void threaded_copy(const GSpan src, GMutableSpan dst)
 {
   BLI_assert(src.size() == dst.size());
@@ -454,6 +445,199 @@ static void foreach_geometry_in_reference(
   }
 }
 
+/**
+ * Geometry referenced by an instance reference that does not contain nested instances. Such
+ * references add the same number of elements to the output for every instance, so their tasks can
+ * be created in parallel once the start offsets of all instances are known.
+ */
+struct SimpleReferenceInfo {
+  const PointCloudRealizeInfo *pointcloud_info = nullptr;
+  const MeshRealizeInfo *mesh_info = nullptr;
+  const RealizeCurveInfo *curve_info = nullptr;
+};
+
+/**
+ * Find the preprocessed geometry of the reference, or return #std::nullopt if the reference has to
+ * be gathered recursively, e.g. because it contains instances, volumes or multiple objects.
+ */
+static std::optional<SimpleReferenceInfo> get_simple_reference_info(
+    const GatherTasksInfo &gather_info, const InstanceReference &reference)
+{
+  GeometrySet object_geometry_set;
+  const GeometrySet *geometry_set = nullptr;
+  switch (reference.type()) {
+    case InstanceReference::Type::Object: {
+      object_geometry_set = object_get_evaluated_geometry_set(reference.object());
+      geometry_set = &object_geometry_set;
+      break;
+    }
+    case InstanceReference::Type::GeometrySet: {
+      geometry_set = &reference.geometry_set();
+      break;
+    }
+    case InstanceReference::Type::Collection: {
+      return std::nullopt;
+    }
+    case InstanceReference::Type::None: {
+      return SimpleReferenceInfo();
+    }
+  }
+
+  SimpleReferenceInfo info;
+  for (const GeometryComponent *component : geometry_set->get_components_for_read()) {
+    switch (component->type()) {
+      case GEO_COMPONENT_TYPE_MESH: {
+        const Mesh *mesh = static_cast<const MeshComponent *>(component)->get_for_read();
+        if (mesh != nullptr && mesh->totvert > 0) {
+          const int mesh_index = gather_info.meshes.order.index_of(mesh);
+          info.mesh_info = &gather_info.meshes.realize_info[mesh_index];
+        }
+        break;
+      }
+      case GEO_COMPONENT_TYPE_POINT_CLOUD: {
+        const PointCloud *pointcloud =
+            static_cast<const PointCloudComponent *>(component)->get_for_read();
+        if (pointcloud != nullptr && pointcloud->totpoint > 0) {
+          const int pointcloud_index = gather_info.pointclouds.order.index_of(pointcloud);
+          info.pointcloud_info = &gather_info.pointclouds.realize_info[pointcloud_index];
+        }
+        break;
+      }
+      case GEO_COMPONENT_TYPE_CURVE: {
+        const Curves *curves = static_cast<const CurveComponent *>(component)->get_for_read();
+        if (curves != nullptr && curves->geometry.curve_num > 0) {
+          const int curve_index = gather_info.curves.order.index_of(curves);
+          info.curve_info = &gather_info.curves.realize_info[curve_index];
+        }
+        break;
+      }
+      case GEO_COMPONENT_TYPE_INSTANCES:
+      case GEO_COMPONENT_TYPE_VOLUME:
+      case GEO_COMPONENT_TYPE_EDIT: {
+        return std::nullopt;
+      }
+    }
+  }
+  return info;
+}
+
+static uint32_t get_local_instance_id(const GatherTasksInfo &gather_info,
+                                      const Span<int> stored_instance_ids,
+                                      const int instance_index)
+{
+  if (!gather_info.create_id_attribute_on_any_component) {
+    return 0;
+  }
+  if (stored_instance_ids.is_empty()) {
+    return uint32_t(instance_index);
+  }
+  return uint32_t(stored_instance_ids[instance_index]);
+}
+
+static void apply_attribute_overrides(const Span<std::pair<int, GSpan>> attributes_to_override,
+                                      const int instance_index,
+                                      AttributeFallbacksArray &attribute_fallbacks)
+{
+  for (const std::pair<int, GSpan> &pair : attributes_to_override) {
+    attribute_fallbacks.array[pair.first] = pair.second[instance_index];
+  }
+}
+
+/**
+ * Create the tasks for instances that only reference simple geometry (see
+ * #SimpleReferenceInfo). The result is the same as when gathering every instance recursively, but
+ * only the computation of the start offsets is done serially.
+ */
+static void gather_realize_tasks_for_simple_instances(
+    GatherTasksInfo &gather_info,
+    const Instances &instances,
+    const Span<SimpleReferenceInfo> reference_infos,
+    const float4x4 &base_transform,
+    const InstanceContext &base_instance_context,
+    const Span<int> stored_instance_ids,
+    const Span<std::pair<int, GSpan>> pointcloud_attributes_to_override,
+    const Span<std::pair<int, GSpan>> mesh_attributes_to_override,
+    const Span<std::pair<int, GSpan>> curve_attributes_to_override)
+{
+  const Span<int> handles = instances.reference_handles();
+  const Span<float4x4> transforms = instances.transforms();
+  GatherTasks &tasks = gather_info.r_tasks;
+  GatherOffsets &offsets = gather_info.r_offsets;
+
+  struct InstanceStart {
+    GatherOffsets offsets;
+    int pointcloud_task;
+    int mesh_task;
+    int curve_task;
+  };
+  Array<InstanceStart> instance_starts(transforms.size());
+  int pointcloud_tasks_num = tasks.pointcloud_tasks.size();
+  int mesh_tasks_num = tasks.mesh_tasks.size();
+  int curve_tasks_num = tasks.curve_tasks.size();
+  for (const int i : transforms.index_range()) {
+    instance_starts[i] = {offsets, pointcloud_tasks_num, mesh_tasks_num, curve_tasks_num};
+    const SimpleReferenceInfo &info = reference_infos[handles[i]];
+    if (info.pointcloud_info) {
+      offsets.pointcloud_offset += info.pointcloud_info->pointcloud->totpoint;
+      pointcloud_tasks_num++;
+    }
+    if (info.mesh_info) {
+      const Mesh &mesh = *info.mesh_info->mesh;
+      offsets.mesh_offsets.vertex += mesh.totvert;
+      offsets.mesh_offsets.edge += mesh.totedge;
+      offsets.mesh_offsets.loop += mesh.totloop;
+      offsets.mesh_offsets.poly += mesh.totpoly;
+      mesh_tasks_num++;
+    }
+    if (info.curve_info) {
+      const Curves &curves = *info.curve_info->curves;
+      offsets.curves_offsets.point += curves.geometry.point_num;
+      offsets.curves_offsets.curve += curves.geometry.curve_num;
+      curve_tasks_num++;
+    }
+  }
+  tasks.pointcloud_tasks.resize(pointcloud_tasks_num);
+  tasks.mesh_tasks.resize(mesh_tasks_num);
+  tasks.curve_tasks.resize(curve_tasks_num);
+
+  threading::parallel_for(transforms.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const SimpleReferenceInfo &info = reference_infos[handles[i]];
+      const InstanceStart &start = instance_starts[i];
+      const float4x4 transform = base_transform * transforms[i];
+      const uint32_t id = noise::hash(base_instance_context.id,
+                                      get_local_instance_id(gather_info, stored_instance_ids, i));
+      if (info.pointcloud_info) {
+        RealizePointCloudTask &task = tasks.pointcloud_tasks[start.pointcloud_task];
+        task.start_index = start.offsets.pointcloud_offset;
+        task.pointcloud_info = info.pointcloud_info;
+        task.transform = transform;
+        task.attribute_fallbacks = base_instance_context.pointclouds;
+        apply_attribute_overrides(pointcloud_attributes_to_override, i, task.attribute_fallbacks);
+        task.id = id;
+      }
+      if (info.mesh_info) {
+        RealizeMeshTask &task = tasks.mesh_tasks[start.mesh_task];
+        task.start_indices = start.offsets.mesh_offsets;
+        task.mesh_info = info.mesh_info;
+        task.transform = transform;
+        task.attribute_fallbacks = base_instance_context.meshes;
+        apply_attribute_overrides(mesh_attributes_to_override, i, task.attribute_fallbacks);
+        task.id = id;
+      }
+      if (info.curve_info) {
+        RealizeCurveTask &task = tasks.curve_tasks[start.curve_task];
+        task.start_indices = start.offsets.curves_offsets;
+        task.curve_info = info.curve_info;
+        task.transform = transform;
+        task.attribute_fallbacks = base_instance_context.curves;
+        apply_attribute_overrides(curve_attributes_to_override, i, task.attribute_fallbacks);
+        task.id = id;
+      }
+    }
+  });
+}
+
 static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
                                                const Instances &instances,
                                                const float4x4 &base_transform,
@@ -480,6 +664,33 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
   Vector<std::pair<int, GSpan>> curve_attributes_to_override = prepare_attribute_fallbacks(
       gather_info, instances, gather_info.curves.attributes);
 
+  /* Most instances reference a few meshes or point clouds many times, which is common after
+   * instancing on points. Look up the referenced geometry only once per reference then, instead
+   * of once per instance, and create the tasks in parallel. */
+  Array<SimpleReferenceInfo> reference_infos(references.size());
+  bool all_references_simple = true;
+  for (const int i : references.index_range()) {
+    const std::optional<SimpleReferenceInfo> info = get_simple_reference_info(gather_info,
+                                                                              references[i]);
+    if (!info) {
+      all_references_simple = false;
+      break;
+    }
+    reference_infos[i] = *info;
+  }
+  if (all_references_simple) {
+    gather_realize_tasks_for_simple_instances(gather_info,
+                                              instances,
+                                              reference_infos,
+                                              base_transform,
+                                              base_instance_context,
+                                              stored_instance_ids,
+                                              pointcloud_attributes_to_override,
+                                              mesh_attributes_to_override,
+                                              curve_attributes_to_override);
+    return;
+  }
+
   for (const int i : transforms.index_range()) {
     const int handle = handles[i];
     const float4x4 &transform = transforms[i];
@@ -487,26 +698,12 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
     const float4x4 new_base_transform = base_transform * transform;
 
     /* Update attribute fallbacks for the current instance. */
-    for (const std::pair<int, GSpan> &pair : pointcloud_attributes_to_override) {
-      instance_context.pointclouds.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : mesh_attributes_to_override) {
-      instance_context.meshes.array[pair.first] = pair.second[i];
-    }
-    for (const std::pair<int, GSpan> &pair : curve_attributes_to_override) {
-      instance_context.curves.array[pair.first] = pair.second[i];
-    }
+    apply_attribute_overrides(pointcloud_attributes_to_override, i, instance_context.pointclouds);
+    apply_attribute_overrides(mesh_attributes_to_override, i, instance_context.meshes);
+    apply_attribute_overrides(curve_attributes_to_override, i, instance_context.curves);
 
-    uint32_t local_instance_id = 0;
-    if (gather_info.create_id_attribute_on_any_component) {
-      if (stored_instance_ids.is_empty()) {
-        local_instance_id = uint32_t(i);
-      }
-      else {
-        local_instance_id = uint32_t(stored_instance_ids[i]);
-      }
-    }
-    const uint32_t instance_id = noise::hash(base_instance_context.id, local_instance_id);
+    const uint32_t instance_id = noise::hash(
+        base_instance_context.id, get_local_instance_id(gather_info, stored_instance_ids, i));
 
     /* Add realize tasks for all referenced geometry sets recursively. */
     foreach_geometry_in_reference(reference,
@@ -719,7 +916,7 @@ static void execute_realize_pointcloud_task(
   const PointCloud &pointcloud = *pointcloud_info.pointcloud;
   const IndexRange point_slice{task.start_index, pointcloud.totpoint};
 
-  copy_transformed_positions(
+  math::transform_points(
       pointcloud_info.positions, task.transform, all_dst_positions.slice(point_slice));
 
   /* Create point ids. */
@@ -1258,7 +1455,7 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
   const IndexRange dst_point_range{task.start_indices.point, curves.points_num()};
   const IndexRange dst_curve_range{task.start_indices.curve, curves.curves_num()};
 
-  copy_transformed_positions(
+  math::transform_points(
       curves.positions(), task.transform, dst_curves.positions_for_write().slice(dst_point_range));
 
   /* Copy and transform handle positions if necessary. */
@@ -1267,14 +1464,14 @@ static void execute_realize_curve_task(const RealizeInstancesOptions &options,
       all_handle_left.slice(dst_point_range).fill(float3(0));
     }
     else {
-      copy_transformed_positions(
+      math::transform_points(
           curves_info.handle_left, task.transform, all_handle_left.slice(dst_point_range));
     }
     if (curves_info.handle_right.is_empty()) {
       all_handle_right.slice(dst_point_range).fill(float3(0));
     }
     else {
-      copy_transformed_positions(
+      math::transform_points(
           curves_info.handle_right, task.transform, all_handle_right.slice(dst_point_range));
     }
   }
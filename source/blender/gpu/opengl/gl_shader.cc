@@ -5,8 +5,12 @@
  * \ingroup gpu
  */
 
+#include "BKE_appdir.h"
 #include "BKE_global.h"
 
+#include "BLI_fileops.h"
+#include "BLI_hash_md5.h"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
@@ -36,6 +40,7 @@ GLShader::GLShader(const char *name) : Shader(name)
   BLI_assert(GLContext::get() != nullptr);
 #endif
   shader_program_ = glCreateProgram();
+  use_binary_cache_ = GLContext::program_binary_support;
 
   debug::object_label(GL_PROGRAM, shader_program_, name);
 }
@@ -903,16 +908,31 @@ char *GLShader::glsl_patch_get(GLenum gl_stage)
 }
 
 GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources)
+{
+  /* Patch the shader code using the first source slot. */
+  sources[0] = glsl_patch_get(gl_stage);
+
+  if (use_binary_cache_) {
+    /* The sources are not guaranteed to outlive this call. */
+    deferred_stages_.append({gl_stage, {}});
+    StageSources &stage = deferred_stages_.last();
+    for (const char *source : sources) {
+      stage.sources.append(source);
+    }
+    return 0;
+  }
+  return this->compile_shader_stage(gl_stage, sources);
+}
+
+GLuint GLShader::compile_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources)
 {
   GLuint shader = glCreateShader(gl_stage);
   if (shader == 0) {
     fprintf(stderr, "GLShader: Error: Could not create shader object.\n");
+    compilation_failed_ = true;
     return 0;
   }
 
-  /* Patch the shader code using the first source slot. */
-  sources[0] = glsl_patch_get(gl_stage);
-
   glShaderSource(shader, sources.size(), sources.data(), nullptr);
   glCompileShader(shader);
 
@@ -968,9 +988,36 @@ void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  is_compute_ = true;
   compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, sources);
 }
 
+void GLShader::compile_deferred_stages()
+{
+  for (StageSources &stage : deferred_stages_) {
+    Vector<const char *> sources;
+    for (const std::string &source : stage.sources) {
+      sources.append(source.c_str());
+    }
+    const GLuint shader = this->compile_shader_stage(stage.gl_stage, sources);
+    switch (stage.gl_stage) {
+      case GL_VERTEX_SHADER:
+        vert_shader_ = shader;
+        break;
+      case GL_GEOMETRY_SHADER:
+        geom_shader_ = shader;
+        break;
+      case GL_FRAGMENT_SHADER:
+        frag_shader_ = shader;
+        break;
+      case GL_COMPUTE_SHADER:
+        compute_shader_ = shader;
+        break;
+    }
+  }
+  deferred_stages_.clear_and_shrink();
+}
+
 bool GLShader::finalize(const shader::ShaderCreateInfo *info)
 {
   if (compilation_failed_) {
@@ -985,18 +1032,38 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
     geometry_shader_from_glsl(sources);
   }
 
-  glLinkProgram(shader_program_);
+  std::string cache_path;
+  if (use_binary_cache_ && transform_feedback_type_ == GPU_SHADER_TFB_NONE) {
+    cache_path = this->program_binary_cache_path();
+  }
 
-  GLint status;
-  glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
-  if (!status) {
-    char log[5000];
-    glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
-    Span<const char *> sources;
-    GLLogParser parser;
-    this->print_log(sources, log, "Linking", true, &parser);
-    return false;
+  if (cache_path.empty() || !this->program_binary_load(cache_path)) {
+    this->compile_deferred_stages();
+    if (compilation_failed_) {
+      return false;
+    }
+
+    if (!cache_path.empty()) {
+      glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(shader_program_);
+
+    GLint status;
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+    if (!status) {
+      char log[5000];
+      glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
+      Span<const char *> sources;
+      GLLogParser parser;
+      this->print_log(sources, log, "Linking", true, &parser);
+      return false;
+    }
+
+    if (!cache_path.empty()) {
+      this->program_binary_save(cache_path);
+    }
   }
+  deferred_stages_.clear_and_shrink();
 
   if (info != nullptr && info->legacy_resource_location_ == false) {
     interface = new GLShaderInterface(shader_program_, *info);
@@ -1010,6 +1077,131 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary Cache
+ *
+ * Linked programs are stored in the user cache directory, so they don't have to be compiled
+ * again in later sessions. The file name is the hash of the sources of all stages and of the
+ * driver identification strings, so a driver update doesn't load incompatible binaries. Drivers
+ * can still reject a binary, in which case the program is compiled and the file is replaced.
+ * \{ */
+
+struct ProgramBinaryHeader {
+  char magic[4];
+  uint32_t format;
+  uint32_t size;
+};
+
+static const char program_binary_magic[4] = {'B', 'G', 'L', 'P'};
+
+/** Directory of the cached program binaries, empty if it cannot be created. */
+static const std::string &program_binary_cache_dir()
+{
+  static const std::string dir = []() {
+    char path[FILE_MAX];
+    if (!BKE_appdir_folder_caches(path, sizeof(path))) {
+      return std::string();
+    }
+    BLI_path_append(path, sizeof(path), "shaders");
+    if (!BLI_dir_create_recursive(path)) {
+      return std::string();
+    }
+    return std::string(path);
+  }();
+  return dir;
+}
+
+std::string GLShader::program_binary_cache_path() const
+{
+  const std::string &dir = program_binary_cache_dir();
+  if (dir.empty()) {
+    return std::string();
+  }
+
+  std::string key;
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    const char *str = (const char *)glGetString(name);
+    key += (str != nullptr) ? str : "";
+    key += '\n';
+  }
+  for (const StageSources &stage : deferred_stages_) {
+    key += std::to_string(stage.gl_stage);
+    key += '\n';
+    for (const std::string &source : stage.sources) {
+      key += source;
+    }
+  }
+
+  char digest[16];
+  char hex_digest[33];
+  BLI_hash_md5_buffer(key.data(), key.size(), digest);
+  BLI_hash_md5_to_hexdigest(digest, hex_digest);
+
+  char path[FILE_MAX];
+  BLI_path_join(path, sizeof(path), dir.c_str(), hex_digest);
+  return std::string(path);
+}
+
+bool GLShader::program_binary_load(const std::string &path)
+{
+  FILE *file = BLI_fopen(path.c_str(), "rb");
+  if (file == nullptr) {
+    return false;
+  }
+  const size_t file_size = BLI_file_size(path.c_str());
+
+  ProgramBinaryHeader header;
+  Vector<char> binary;
+  bool read_ok = false;
+  if (fread(&header, sizeof(header), 1, file) == 1 &&
+      memcmp(header.magic, program_binary_magic, sizeof(header.magic)) == 0 &&
+      sizeof(header) + header.size == file_size) {
+    binary.resize(header.size);
+    read_ok = fread(binary.data(), 1, header.size, file) == header.size;
+  }
+  fclose(file);
+  if (!read_ok) {
+    return false;
+  }
+
+  glProgramBinary(shader_program_, header.format, binary.data(), GLsizei(binary.size()));
+  GLint status;
+  glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+  return status;
+}
+
+void GLShader::program_binary_save(const std::string &path)
+{
+  GLint size = 0;
+  glGetProgramiv(shader_program_, GL_PROGRAM_BINARY_LENGTH, &size);
+  if (size <= 0) {
+    return;
+  }
+
+  Vector<char> binary(size);
+  GLenum format;
+  glGetProgramBinary(shader_program_, size, &size, &format, binary.data());
+
+  ProgramBinaryHeader header;
+  memcpy(header.magic, program_binary_magic, sizeof(header.magic));
+  header.format = uint32_t(format);
+  header.size = uint32_t(size);
+
+  FILE *file = BLI_fopen(path.c_str(), "wb");
+  if (file == nullptr) {
+    return;
+  }
+  bool write_ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  fwrite(binary.data(), 1, size_t(size), file) == size_t(size);
+  fclose(file);
+  if (!write_ok) {
+    /* Don't leave a truncated binary behind. */
+    BLI_delete(path.c_str(), false, false);
+  }
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Binding
  * \{ */
@@ -34,6 +34,18 @@ class GLShader : public Shader {
   GLuint compute_shader_ = 0;
   /** True if any shader failed to compile. */
   bool compilation_failed_ = false;
+  bool is_compute_ = false;
+
+  /**
+   * When the program binary cache is available, compiling the stages is postponed to #finalize,
+   * so it can be skipped entirely when the linked program is found in the cache.
+   */
+  bool use_binary_cache_ = false;
+  struct StageSources {
+    GLenum gl_stage;
+    Vector<std::string> sources;
+  };
+  Vector<StageSources> deferred_stages_;
 
   eGPUShaderTFBType transform_feedback_type_ = GPU_SHADER_TFB_NONE;
 
@@ -72,14 +84,26 @@ class GLShader : public Shader {
 
   bool is_compute() const
   {
-    return compute_shader_ != 0;
+    return is_compute_;
   }
 
  private:
   char *glsl_patch_get(GLenum gl_stage);
 
-  /** Create, compile and attach the shader stage to the shader program. */
+  /**
+   * Create, compile and attach the shader stage to the shader program. Returns 0 when the
+   * compilation is deferred to #finalize.
+   */
   GLuint create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
+  GLuint compile_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
+  /** Compile the stages that were deferred by #create_shader_stage. */
+  void compile_deferred_stages();
+
+  /** Path of the cached program binary, computed from the sources of all stages. */
+  std::string program_binary_cache_path() const;
+  /** Return true if the program was successfully loaded from the cache. */
+  bool program_binary_load(const std::string &path);
+  void program_binary_save(const std::string &path);
 
   /**
    * \brief features available on newer implementation such as native barycentric coordinates
@@ -57,7 +57,10 @@ void GLStorageBuf::update(const void *data)
     this->init();
   }
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo_id_);
-  glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size_in_bytes_, data);
+  /* Re-specify the whole data store instead of updating it in place. If the GPU is still reading
+   * the previous content, the driver can give the buffer new storage instead of stalling until
+   * the commands using it are finished. The buffer name, and so all its bindings, stay valid. */
+  glBufferData(GL_SHADER_STORAGE_BUFFER, size_in_bytes_, data, to_gl(this->usage_));
   glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
 }
 
@@ -53,7 +53,10 @@ void GLUniformBuf::update(const void *data)
     this->init();
   }
   glBindBuffer(GL_UNIFORM_BUFFER, ubo_id_);
-  glBufferSubData(GL_UNIFORM_BUFFER, 0, size_in_bytes_, data);
+  /* Re-specify the whole data store instead of updating it in place. If the GPU is still reading
+   * the previous content, the driver can give the buffer new storage instead of stalling until
+   * the commands using it are finished. The buffer name, and so all its bindings, stay valid. */
+  glBufferData(GL_UNIFORM_BUFFER, size_in_bytes_, data, GL_DYNAMIC_DRAW);
   glBindBuffer(GL_UNIFORM_BUFFER, 0);
 }
 
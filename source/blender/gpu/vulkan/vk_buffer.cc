@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup gpu
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include "vk_buffer.hh"
+
+namespace blender::gpu {
+
+VKBuffer::~VKBuffer()
+{
+  VKContext *context = VKContext::get();
+  if (context != nullptr) {
+    free(*context);
+  }
+}
+
+bool VKBuffer::is_allocated() const
+{
+  return allocation_ != VK_NULL_HANDLE;
+}
+
+static VmaAllocationCreateFlagBits vma_allocation_flags(GPUUsageType usage)
+{
+  switch (usage & ~GPU_USAGE_FLAG_BUFFER_TEXTURE_ONLY) {
+    case GPU_USAGE_STREAM:
+    case GPU_USAGE_STATIC:
+    case GPU_USAGE_DYNAMIC:
+      return static_cast<VmaAllocationCreateFlagBits>(
+          VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+          VMA_ALLOCATION_CREATE_MAPPED_BIT);
+    default:
+      /* Device only buffers are still mapped as they can be read back, e.g. by
+       * #GPU_storagebuf_read. */
+      return static_cast<VmaAllocationCreateFlagBits>(
+          VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT | VMA_ALLOCATION_CREATE_MAPPED_BIT);
+  }
+}
+
+bool VKBuffer::create(VKContext &context,
+                      int64_t size_in_bytes,
+                      GPUUsageType usage,
+                      VkBufferUsageFlagBits buffer_usage)
+{
+  BLI_assert(!is_allocated());
+
+  size_in_bytes_ = size_in_bytes;
+
+  VmaAllocator allocator = context.mem_allocator_get();
+  VkBufferCreateInfo create_info = {};
+  create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  create_info.flags = 0;
+  create_info.size = size_in_bytes;
+  create_info.usage = buffer_usage;
+  /* We use the same command queue for the compute and graphics pipeline, so it is safe to use
+   * exclusive resource handling. */
+  create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+  create_info.queueFamilyIndexCount = 0;
+  create_info.pQueueFamilyIndices = nullptr;
+
+  VmaAllocationCreateInfo vma_create_info = {};
+  vma_create_info.flags = vma_allocation_flags(usage);
+  vma_create_info.priority = 1.0f;
+  vma_create_info.usage = VMA_MEMORY_USAGE_AUTO;
+
+  VmaAllocationInfo allocation_info = {};
+  VkResult result = vmaCreateBuffer(allocator,
+                                    &create_info,
+                                    &vma_create_info,
+                                    &vk_buffer_,
+                                    &allocation_,
+                                    &allocation_info);
+  if (result != VK_SUCCESS) {
+    vk_buffer_ = VK_NULL_HANDLE;
+    allocation_ = VK_NULL_HANDLE;
+    size_in_bytes_ = 0;
+    return false;
+  }
+  mapped_memory_ = allocation_info.pMappedData;
+  BLI_assert(mapped_memory_ != nullptr);
+  return true;
+}
+
+void VKBuffer::update(const void *data) const
+{
+  BLI_assert_msg(mapped_memory_ != nullptr, "Cannot update a non-mapped buffer.");
+  memcpy(mapped_memory_, data, size_in_bytes_);
+
+  /* No-op on host coherent memory. */
+  VKContext &context = *VKContext::get();
+  vmaFlushAllocation(context.mem_allocator_get(), allocation_, 0, VK_WHOLE_SIZE);
+}
+
+void VKBuffer::clear(const void *pattern, const int64_t pattern_size) const
+{
+  BLI_assert_msg(mapped_memory_ != nullptr, "Cannot clear a non-mapped buffer.");
+  BLI_assert(pattern_size > 0);
+  char *dst = static_cast<char *>(mapped_memory_);
+  int64_t offset = 0;
+  if (pattern_size <= size_in_bytes_) {
+    memcpy(dst, pattern, pattern_size);
+    offset = pattern_size;
+    /* Double the size of the filled part at each step, which is much faster than copying the
+     * pattern element by element. */
+    while (offset < size_in_bytes_) {
+      const int64_t copy_size = std::min(offset, size_in_bytes_ - offset);
+      memcpy(dst + offset, dst, copy_size);
+      offset += copy_size;
+    }
+  }
+
+  VKContext &context = *VKContext::get();
+  vmaFlushAllocation(context.mem_allocator_get(), allocation_, 0, VK_WHOLE_SIZE);
+}
+
+void VKBuffer::read(void *data) const
+{
+  BLI_assert_msg(mapped_memory_ != nullptr, "Cannot read a non-mapped buffer.");
+  /* Make writes done by the device visible to the host. No-op on host coherent memory. */
+  VKContext &context = *VKContext::get();
+  vmaInvalidateAllocation(context.mem_allocator_get(), allocation_, 0, VK_WHOLE_SIZE);
+  memcpy(data, mapped_memory_, size_in_bytes_);
+}
+
+bool VKBuffer::free(VKContext &context)
+{
+  if (!is_allocated()) {
+    return false;
+  }
+  VmaAllocator allocator = context.mem_allocator_get();
+  vmaDestroyBuffer(allocator, vk_buffer_, allocation_);
+  vk_buffer_ = VK_NULL_HANDLE;
+  allocation_ = VK_NULL_HANDLE;
+  mapped_memory_ = nullptr;
+  size_in_bytes_ = 0;
+  return true;
+}
+
+}  // namespace blender::gpu
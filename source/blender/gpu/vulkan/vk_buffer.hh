@@ -0,0 +1,61 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup gpu
+ */
+
+#pragma once
+
+#include "GPU_vertex_buffer.h"
+
+#include "gpu_context_private.hh"
+
+#include "vk_context.hh"
+
+namespace blender::gpu {
+
+/**
+ * Class for handling vulkan buffers (allocation/updating/reading).
+ *
+ * The memory is allocated through VMA and is persistently mapped, so updating and reading the
+ * buffer does not require a command buffer or a staging buffer.
+ */
+class VKBuffer {
+  int64_t size_in_bytes_ = 0;
+  VkBuffer vk_buffer_ = VK_NULL_HANDLE;
+  VmaAllocation allocation_ = VK_NULL_HANDLE;
+  /** Pointer to the mapped memory, valid as long as the buffer is allocated. */
+  void *mapped_memory_ = nullptr;
+
+ public:
+  VKBuffer() = default;
+  virtual ~VKBuffer();
+
+  /** Has this buffer been allocated? */
+  bool is_allocated() const;
+
+  bool create(VKContext &context,
+              int64_t size,
+              GPUUsageType usage,
+              VkBufferUsageFlagBits buffer_usage);
+  /** Copy `size_in_bytes()` bytes from `data` to the buffer. */
+  void update(const void *data) const;
+  /** Fill the buffer by repeating the `pattern` of `pattern_size` bytes. */
+  void clear(const void *pattern, int64_t pattern_size) const;
+  /** Copy the content of the buffer to `data`, which must hold `size_in_bytes()` bytes. */
+  void read(void *data) const;
+  bool free(VKContext &context);
+
+  int64_t size_in_bytes() const
+  {
+    return size_in_bytes_;
+  }
+
+  VkBuffer vk_handle() const
+  {
+    return vk_buffer_;
+  }
+};
+
+}  // namespace blender::gpu
@@ -5,29 +5,62 @@
  * \ingroup gpu
  */
 
+#include "gpu_texture_private.hh"
+
 #include "vk_vertex_buffer.hh"
 
 #include "vk_storage_buffer.hh"
 
 namespace blender::gpu {
 
-void VKStorageBuffer::update(const void * /*data*/)
+void VKStorageBuffer::allocate(VKContext &context)
+{
+  buffer_.create(context,
+                 size_in_bytes_,
+                 usage_,
+                 static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+                                                    VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+                                                    VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                                                    VK_BUFFER_USAGE_TRANSFER_DST_BIT));
+}
+
+void VKStorageBuffer::update(const void *data)
 {
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  buffer_.update(data);
 }
 
 void VKStorageBuffer::bind(int /*slot*/)
 {
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  /* TODO: Add the buffer to the descriptor set of the bound shader once those are implemented. */
 }
 
 void VKStorageBuffer::unbind()
 {
 }
 
-void VKStorageBuffer::clear(eGPUTextureFormat /*internal_format*/,
-                            eGPUDataFormat /*data_format*/,
-                            void * /*data*/)
+void VKStorageBuffer::clear(eGPUTextureFormat internal_format,
+                            eGPUDataFormat data_format,
+                            void *data)
 {
+  /* Converting the data to the internal format is not supported (yet). */
+  BLI_assert(to_bytesize(internal_format, data_format) == to_bytesize(internal_format));
+  UNUSED_VARS_NDEBUG(data_format);
+
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  buffer_.clear(data, to_bytesize(internal_format));
 }
+
 void VKStorageBuffer::copy_sub(VertBuf * /*src*/,
                                uint /*dst_offset*/,
                                uint /*src_offset*/,
@@ -35,8 +68,13 @@ void VKStorageBuffer::copy_sub(VertBuf * /*src*/,
 {
 }
 
-void VKStorageBuffer::read(void * /*data*/)
+void VKStorageBuffer::read(void *data)
 {
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  buffer_.read(data);
 }
 
 }  // namespace blender::gpu
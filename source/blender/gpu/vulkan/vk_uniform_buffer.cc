@@ -5,28 +5,56 @@
  * \ingroup gpu
  */
 
+#include "MEM_guardedalloc.h"
+
 #include "vk_uniform_buffer.hh"
 
 namespace blender::gpu {
 
-void VKUniformBuffer::update(const void * /*data*/)
+void VKUniformBuffer::allocate(VKContext &context)
+{
+  buffer_.create(context,
+                 size_in_bytes_,
+                 GPU_USAGE_STATIC,
+                 static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+                                                    VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+}
+
+void VKUniformBuffer::update(const void *data)
 {
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  buffer_.update(data);
 }
 
 void VKUniformBuffer::clear_to_zero()
 {
+  VKContext &context = *VKContext::get();
+  if (!buffer_.is_allocated()) {
+    allocate(context);
+  }
+  const uint32_t zero = 0;
+  buffer_.clear(&zero, sizeof(zero));
 }
 
 void VKUniformBuffer::bind(int /*slot*/)
 {
+  if (data_ != nullptr) {
+    this->update(data_);
+    MEM_SAFE_FREE(data_);
+  }
+  /* TODO: Add the buffer to the descriptor set of the bound shader once those are implemented. */
 }
 
-void VKUniformBuffer::bind_as_ssbo(int /*slot*/)
+void VKUniformBuffer::bind_as_ssbo(int slot)
 {
+  this->bind(slot);
 }
 
 void VKUniformBuffer::unbind()
 {
 }
 
-}  // namespace blender::gpu
\ No newline at end of file
+}  // namespace blender::gpu
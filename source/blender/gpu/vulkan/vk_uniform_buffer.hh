@@ -9,9 +9,13 @@
 
 #include "gpu_uniform_buffer_private.hh"
 
+#include "vk_buffer.hh"
+
 namespace blender::gpu {
 
 class VKUniformBuffer : public UniformBuf {
+  VKBuffer buffer_;
+
  public:
   VKUniformBuffer(int size, const char *name) : UniformBuf(size, name)
   {
@@ -22,6 +26,9 @@ class VKUniformBuffer : public UniformBuf {
   void bind(int slot) override;
   void bind_as_ssbo(int slot) override;
   void unbind() override;
+
+ private:
+  void allocate(VKContext &context);
 };
 
 }  // namespace blender::gpu
\ No newline at end of file
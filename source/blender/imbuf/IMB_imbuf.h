@@ -331,6 +331,14 @@ typedef enum eIMBInterpolationFilterMode {
   IMB_FILTER_BILINEAR,
 } eIMBInterpolationFilterMode;
 
+/** Filters for #IMB_scaleImBuf_filtered. */
+typedef enum eIMBScaleFilter {
+  /** Mitchell-Netravali cubic (B = C = 1/3), a good balance between sharpness and ringing. */
+  IMB_SCALE_FILTER_MITCHELL,
+  /** Three lobed Lanczos, sharper than Mitchell but with more ringing around edges. */
+  IMB_SCALE_FILTER_LANCZOS3,
+} eIMBScaleFilter;
+
 /**
  * Defaults to BL_proxy within the directory of the animation.
  */
@@ -482,6 +490,20 @@ bool IMB_scalefastImBuf(struct ImBuf *ibuf, unsigned int newx, unsigned int newy
  */
 void IMB_scaleImBuf_threaded(struct ImBuf *ibuf, unsigned int newx, unsigned int newy);
 
+/**
+ * \attention Defined in scaling.c
+ *
+ * High quality scaling up or down with a separable filter, threaded over the rows of the image.
+ * Byte buffers are filtered with premultiplied alpha, float buffers are expected to be
+ * premultiplied already.
+ *
+ * Return true if \a ibuf is modified.
+ */
+bool IMB_scaleImBuf_filtered(struct ImBuf *ibuf,
+                             unsigned int newx,
+                             unsigned int newy,
+                             eIMBScaleFilter filter);
+
 /**
  * \attention Defined in writeimage.c
  */
@@ -144,6 +144,8 @@ typedef enum eImBufFlags {
   IB_multilayer = 1 << 7,
   IB_metadata = 1 << 8,
   IB_animdeinterlace = 1 << 9,
+  /** Use hardware accelerated decoding for movies when available. */
+  IB_animhwdecode = 1 << 10,
 
   /** indicates whether image on disk have premul alpha */
   IB_alphamode_premul = 1 << 12,
@@ -81,6 +81,10 @@ void IMB_thumb_makedirs(void);
 struct ImBuf *IMB_thumb_load_blend(const char *blen_path,
                                    const char *blen_group,
                                    const char *blen_id);
+/**
+ * Close the blend files that were kept open to load ID previews from them.
+ */
+void IMB_thumb_blend_handles_free(void);
 
 /**
  * Special function for previewing fonts.
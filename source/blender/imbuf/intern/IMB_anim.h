@@ -112,8 +112,14 @@ struct anim {
   AVFrame *pFrameRGB;
   AVFrame *pFrameDeinterlaced;
   struct SwsContext *img_convert_ctx;
+  enum AVPixelFormat img_convert_ctx_format;
   int videoStream;
 
+  /* Pixel format of frames decoded on the GPU, AV_PIX_FMT_NONE for software decoding. */
+  enum AVPixelFormat hw_pix_fmt;
+  /* Hardware frames are downloaded here before color conversion. */
+  AVFrame *pFrame_hw_download;
+
   AVFrame *pFrame;
   bool pFrame_complete;
   AVFrame *pFrame_backup;
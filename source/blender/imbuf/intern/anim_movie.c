@@ -65,6 +65,7 @@
 
 #  include <libavcodec/avcodec.h>
 #  include <libavformat/avformat.h>
+#  include <libavutil/hwcontext.h>
 #  include <libavutil/imgutils.h>
 #  include <libavutil/rational.h>
 #  include <libswscale/swscale.h>
@@ -487,6 +488,127 @@ static ImBuf *avi_fetchibuf(struct anim *anim, int position)
 
 #ifdef WITH_FFMPEG
 
+/* Device types tried for hardware decoding, in order of preference. */
+static const enum AVHWDeviceType ffmpeg_hw_device_types[] = {
+#  if defined(__APPLE__)
+    AV_HWDEVICE_TYPE_VIDEOTOOLBOX,
+#  elif defined(_WIN32)
+    AV_HWDEVICE_TYPE_D3D11VA,
+    AV_HWDEVICE_TYPE_CUDA,
+#  else
+    AV_HWDEVICE_TYPE_CUDA,
+    AV_HWDEVICE_TYPE_VAAPI,
+#  endif
+};
+
+static enum AVPixelFormat ffmpeg_get_hw_format(AVCodecContext *pCodecCtx,
+                                              const enum AVPixelFormat *pix_fmts)
+{
+  const struct anim *anim = pCodecCtx->opaque;
+
+  for (const enum AVPixelFormat *p = pix_fmts; *p != AV_PIX_FMT_NONE; p++) {
+    if (*p == anim->hw_pix_fmt) {
+      return *p;
+    }
+  }
+
+  /* The device can't decode this stream (e.g. unsupported profile), decode in software. */
+  return avcodec_default_get_format(pCodecCtx, pix_fmts);
+}
+
+/* Try to create a hardware device the codec can decode with. On success the device is attached to
+ * the codec context and the hardware pixel format is stored in the #anim. */
+static void ffmpeg_hw_decode_init(struct anim *anim,
+                                  AVCodecContext *pCodecCtx,
+                                  const AVCodec *pCodec)
+{
+  for (int i = 0; i < ARRAY_SIZE(ffmpeg_hw_device_types); i++) {
+    const enum AVHWDeviceType device_type = ffmpeg_hw_device_types[i];
+
+    for (int j = 0;; j++) {
+      const AVCodecHWConfig *config = avcodec_get_hw_config(pCodec, j);
+      if (config == NULL) {
+        break;
+      }
+      if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0 ||
+          config->device_type != device_type) {
+        continue;
+      }
+
+      AVBufferRef *hw_device_ctx = NULL;
+      if (av_hwdevice_ctx_create(&hw_device_ctx, device_type, NULL, NULL, 0) < 0) {
+        break;
+      }
+
+      av_log(NULL,
+             AV_LOG_INFO,
+             "Using %s hardware decoding for %s\n",
+             av_hwdevice_get_type_name(device_type),
+             anim->name);
+
+      anim->hw_pix_fmt = config->pix_fmt;
+      pCodecCtx->hw_device_ctx = hw_device_ctx;
+      pCodecCtx->opaque = anim;
+      pCodecCtx->get_format = ffmpeg_get_hw_format;
+      return;
+    }
+  }
+}
+
+static struct SwsContext *ffmpeg_sws_context_create(struct anim *anim,
+                                                    enum AVPixelFormat src_format)
+{
+  /* The following for color space determination */
+  int srcRange, dstRange, brightness, contrast, saturation;
+  int *table;
+  const int *inv_table;
+
+  struct SwsContext *img_convert_ctx = sws_getContext(anim->x,
+                                                      anim->y,
+                                                      src_format,
+                                                      anim->x,
+                                                      anim->y,
+                                                      AV_PIX_FMT_RGBA,
+                                                      SWS_BILINEAR | SWS_PRINT_INFO |
+                                                          SWS_FULL_CHR_H_INT,
+                                                      NULL,
+                                                      NULL,
+                                                      NULL);
+  if (!img_convert_ctx) {
+    return NULL;
+  }
+
+  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
+  if (!sws_getColorspaceDetails(img_convert_ctx,
+                                (int **)&inv_table,
+                                &srcRange,
+                                &table,
+                                &dstRange,
+                                &brightness,
+                                &contrast,
+                                &saturation)) {
+    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
+    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+
+    if (sws_setColorspaceDetails(img_convert_ctx,
+                                 (int *)inv_table,
+                                 srcRange,
+                                 table,
+                                 dstRange,
+                                 brightness,
+                                 contrast,
+                                 saturation)) {
+      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+    }
+  }
+  else {
+    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  }
+
+  anim->img_convert_ctx_format = src_format;
+  return img_convert_ctx;
+}
+
 static int startffmpeg(struct anim *anim)
 {
   int i, video_stream_index;
@@ -500,11 +622,6 @@ static int startffmpeg(struct anim *anim)
   double frs_den;
   int streamcount;
 
-  /* The following for color space determination */
-  int srcRange, dstRange, brightness, contrast, saturation;
-  int *table;
-  const int *inv_table;
-
   if (anim == NULL) {
     return (-1);
   }
@@ -568,6 +685,12 @@ static int startffmpeg(struct anim *anim)
     pCodecCtx->thread_type = FF_THREAD_SLICE;
   }
 
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+  /* Deinterlacing works on the decoder's own pixel format, keep it in software. */
+  if ((anim->ib_flags & IB_animhwdecode) && !(anim->ib_flags & IB_animdeinterlace)) {
+    ffmpeg_hw_decode_init(anim, pCodecCtx, pCodec);
+  }
+
   if (avcodec_open2(pCodecCtx, pCodec, NULL) < 0) {
     avformat_close_input(&pFormatCtx);
     return -1;
@@ -686,6 +809,7 @@ static int startffmpeg(struct anim *anim)
   anim->pFrame_backup_complete = false;
   anim->pFrame_complete = false;
   anim->pFrameDeinterlaced = av_frame_alloc();
+  anim->pFrame_hw_download = av_frame_alloc();
   anim->pFrameRGB = av_frame_alloc();
   anim->pFrameRGB->format = AV_PIX_FMT_RGBA;
   anim->pFrameRGB->width = anim->x;
@@ -698,6 +822,7 @@ static int startffmpeg(struct anim *anim)
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrame_hw_download);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
     anim->pCodecCtx = NULL;
@@ -711,6 +836,7 @@ static int startffmpeg(struct anim *anim)
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrame_hw_download);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
     anim->pCodecCtx = NULL;
@@ -731,16 +857,7 @@ static int startffmpeg(struct anim *anim)
                          1);
   }
 
-  anim->img_convert_ctx = sws_getContext(anim->x,
-                                         anim->y,
-                                         anim->pCodecCtx->pix_fmt,
-                                         anim->x,
-                                         anim->y,
-                                         AV_PIX_FMT_RGBA,
-                                         SWS_BILINEAR | SWS_PRINT_INFO | SWS_FULL_CHR_H_INT,
-                                         NULL,
-                                         NULL,
-                                         NULL);
+  anim->img_convert_ctx = ffmpeg_sws_context_create(anim, anim->pCodecCtx->pix_fmt);
 
   if (!anim->img_convert_ctx) {
     fprintf(stderr, "Can't transform color space??? Bailing out...\n");
@@ -749,39 +866,13 @@ static int startffmpeg(struct anim *anim)
     av_packet_free(&anim->cur_packet);
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrame_hw_download);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
     anim->pCodecCtx = NULL;
     return -1;
   }
 
-  /* Try do detect if input has 0-255 YCbCR range (JFIF Jpeg MotionJpeg) */
-  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
-                                (int **)&inv_table,
-                                &srcRange,
-                                &table,
-                                &dstRange,
-                                &brightness,
-                                &contrast,
-                                &saturation)) {
-    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
-    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
-
-    if (sws_setColorspaceDetails(anim->img_convert_ctx,
-                                 (int *)inv_table,
-                                 srcRange,
-                                 table,
-                                 dstRange,
-                                 brightness,
-                                 contrast,
-                                 saturation)) {
-      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-    }
-  }
-  else {
-    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-  }
-
   return 0;
 }
 
@@ -867,6 +958,26 @@ static void ffmpeg_postprocess(struct anim *anim, AVFrame *input)
          input->data[2],
          input->data[3]);
 
+  if (anim->hw_pix_fmt != AV_PIX_FMT_NONE && input->format == anim->hw_pix_fmt) {
+    av_frame_unref(anim->pFrame_hw_download);
+    if (av_hwframe_transfer_data(anim->pFrame_hw_download, input, 0) < 0) {
+      fprintf(stderr, "ffmpeg_fetchibuf: could not download hardware frame\n");
+      return;
+    }
+    input = anim->pFrame_hw_download;
+  }
+
+  /* Downloaded hardware frames may not be in the pixel format the decoder was opened with. */
+  if (input->format != anim->img_convert_ctx_format) {
+    struct SwsContext *img_convert_ctx = ffmpeg_sws_context_create(anim, input->format);
+    if (img_convert_ctx == NULL) {
+      fprintf(stderr, "ffmpeg_fetchibuf: can't transform color space\n");
+      return;
+    }
+    sws_freeContext(anim->img_convert_ctx);
+    anim->img_convert_ctx = img_convert_ctx;
+  }
+
   if (anim->ib_flags & IB_animdeinterlace) {
     if (av_image_deinterlace(anim->pFrameDeinterlaced,
                              anim->pFrame,
@@ -1438,7 +1549,10 @@ static ImBuf *ffmpeg_fetchibuf(struct anim *anim, int position, IMB_Timecode_Typ
    * The issue was reported to FFmpeg under ticket #8747 in the FFmpeg tracker
    * and is fixed in the newer versions than 4.3.1. */
 
-  const AVPixFmtDescriptor *pix_fmt_descriptor = av_pix_fmt_desc_get(anim->pCodecCtx->pix_fmt);
+  const enum AVPixelFormat pix_fmt = anim->pCodecCtx->pix_fmt == anim->hw_pix_fmt ?
+                                         anim->pCodecCtx->sw_pix_fmt :
+                                         anim->pCodecCtx->pix_fmt;
+  const AVPixFmtDescriptor *pix_fmt_descriptor = av_pix_fmt_desc_get(pix_fmt);
 
   int planes = R_IMF_PLANES_RGBA;
   if ((pix_fmt_descriptor->flags & AV_PIX_FMT_FLAG_ALPHA) == 0) {
@@ -1487,6 +1601,7 @@ static void free_anim_ffmpeg(struct anim *anim)
     av_frame_free(&anim->pFrame_backup);
     av_frame_free(&anim->pFrameRGB);
     av_frame_free(&anim->pFrameDeinterlaced);
+    av_frame_free(&anim->pFrame_hw_download);
 
     sws_freeContext(anim->img_convert_ctx);
     IMB_freeImBuf(anim->cur_frame_final);
@@ -1455,8 +1455,8 @@ typedef struct DisplayBufferThread {
   bool is_data;
   bool predivide;
 
-  const char *byte_colorspace;
-  const char *float_colorspace;
+  ColorSpace *byte_colorspace;
+  ColorSpace *float_colorspace;
 } DisplayBufferThread;
 
 typedef struct DisplayBufferInitData {
@@ -1470,8 +1470,8 @@ typedef struct DisplayBufferInitData {
 
   int width;
 
-  const char *byte_colorspace;
-  const char *float_colorspace;
+  ColorSpace *byte_colorspace;
+  ColorSpace *float_colorspace;
 } DisplayBufferInitData;
 
 static void display_buffer_init_handle(void *handle_v,
@@ -1541,9 +1541,6 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
   if (!handle->buffer) {
     uchar *byte_buffer = handle->byte_buffer;
 
-    const char *from_colorspace = handle->byte_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
-
     float *fp;
     uchar *cp;
     const size_t i_last = ((size_t)width) * height;
@@ -1564,9 +1561,10 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     }
 
     if (!is_data && !is_data_display) {
-      /* convert float buffer to scene linear space */
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, false);
+      /* Convert float buffer to scene linear space, using the processor that is cached in the
+       * color space instead of creating a new one for every chunk of lines. */
+      IMB_colormanagement_colorspace_to_scene_linear(
+          linear_buffer, width, height, channels, handle->byte_colorspace, false);
     }
 
     *is_straight_alpha = true;
@@ -1578,14 +1576,11 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
      * Need to convert float buffer to linear space before applying display transform
      */
 
-    const char *from_colorspace = handle->float_colorspace;
-    const char *to_colorspace = global_role_scene_linear;
-
     memcpy(linear_buffer, handle->buffer, buffer_size * sizeof(float));
 
     if (!is_data && !is_data_display) {
-      IMB_colormanagement_transform(
-          linear_buffer, width, height, channels, from_colorspace, to_colorspace, predivide);
+      IMB_colormanagement_colorspace_to_scene_linear(
+          linear_buffer, width, height, channels, handle->float_colorspace, predivide);
     }
 
     *is_straight_alpha = false;
@@ -1713,22 +1708,17 @@ static void display_buffer_apply_threaded(ImBuf *ibuf,
   init_data.display_buffer_byte = display_buffer_byte;
 
   if (ibuf->rect_colorspace != NULL) {
-    init_data.byte_colorspace = ibuf->rect_colorspace->name;
+    init_data.byte_colorspace = ibuf->rect_colorspace;
   }
   else {
     /* happens for viewer images, which are not so simple to determine where to
      * set image buffer's color spaces
      */
-    init_data.byte_colorspace = global_role_default_byte;
+    init_data.byte_colorspace = colormanage_colorspace_get_named(global_role_default_byte);
   }
 
-  if (ibuf->float_colorspace != NULL) {
-    /* sequencer stores float buffers in non-linear space */
-    init_data.float_colorspace = ibuf->float_colorspace->name;
-  }
-  else {
-    init_data.float_colorspace = NULL;
-  }
+  /* sequencer stores float buffers in non-linear space */
+  init_data.float_colorspace = ibuf->float_colorspace;
 
   IMB_processor_apply_threaded(ibuf->y,
                                sizeof(DisplayBufferThread),
@@ -2205,6 +2195,85 @@ void IMB_colormanagement_colorspace_to_scene_linear(float *buffer,
   }
 }
 
+typedef struct ImbufTextureData {
+  int width;
+  int offset, stride;
+  int in_channels;
+  const void *in_buffer;
+  void *out_buffer;
+  bool use_premultiply;
+  bool use_unpremultiply;
+} ImbufTextureData;
+
+static void imbuf_byte_to_byte_texture_cb(void *__restrict userdata,
+                                          const int y,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ImbufTextureData *data = userdata;
+
+  const size_t in_offset = data->offset + y * data->stride;
+  const size_t out_offset = y * data->width;
+  const uchar *in = (const uchar *)data->in_buffer + in_offset * 4;
+  uchar *out = (uchar *)data->out_buffer + out_offset * 4;
+
+  if (data->use_premultiply) {
+    /* Premultiply only. */
+    for (int x = 0; x < data->width; x++, in += 4, out += 4) {
+      out[0] = (in[0] * in[3]) >> 8;
+      out[1] = (in[1] * in[3]) >> 8;
+      out[2] = (in[2] * in[3]) >> 8;
+      out[3] = in[3];
+    }
+  }
+  else {
+    /* Copy only. */
+    memcpy(out, in, sizeof(uchar[4]) * data->width);
+  }
+}
+
+static void imbuf_float_to_float_texture_cb(void *__restrict userdata,
+                                            const int y,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ImbufTextureData *data = userdata;
+  const int in_channels = data->in_channels;
+
+  const size_t in_offset = data->offset + y * data->stride;
+  const size_t out_offset = y * data->width;
+  const float *in = (const float *)data->in_buffer + in_offset * in_channels;
+  float *out = (float *)data->out_buffer + out_offset * 4;
+
+  if (in_channels == 1) {
+    /* Copy single channel. */
+    for (int x = 0; x < data->width; x++, in += 1, out += 4) {
+      out[0] = in[0];
+      out[1] = in[0];
+      out[2] = in[0];
+      out[3] = in[0];
+    }
+  }
+  else if (in_channels == 3) {
+    /* Copy RGB. */
+    for (int x = 0; x < data->width; x++, in += 3, out += 4) {
+      out[0] = in[0];
+      out[1] = in[1];
+      out[2] = in[2];
+      out[3] = 1.0f;
+    }
+  }
+  else if (in_channels == 4) {
+    /* Copy or convert RGBA. */
+    if (data->use_unpremultiply) {
+      for (int x = 0; x < data->width; x++, in += 4, out += 4) {
+        premul_to_straight_v4_v4(out, in);
+      }
+    }
+    else {
+      memcpy(out, in, sizeof(float[4]) * data->width);
+    }
+  }
+}
+
 void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
                                                const int offset_x,
                                                const int offset_y,
@@ -2220,34 +2289,19 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
              IMB_colormanagement_space_is_scene_linear(ibuf->rect_colorspace) ||
              IMB_colormanagement_space_is_data(ibuf->rect_colorspace));
 
-  const uchar *in_buffer = (uchar *)ibuf->rect;
-  const bool use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied;
+  ImbufTextureData data = {
+      .width = width,
+      .offset = offset_y * ibuf->x + offset_x,
+      .stride = ibuf->x,
+      .in_buffer = ibuf->rect,
+      .out_buffer = out_buffer,
+      .use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied,
+  };
 
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const uchar *in = in_buffer + in_offset * 4;
-    uchar *out = out_buffer + out_offset * 4;
-
-    if (use_premultiply) {
-      /* Premultiply only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = (in[0] * in[3]) >> 8;
-        out[1] = (in[1] * in[3]) >> 8;
-        out[2] = (in[2] * in[3]) >> 8;
-        out[3] = in[3];
-      }
-    }
-    else {
-      /* Copy only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = in[3];
-      }
-    }
-  }
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (height > 128);
+  BLI_task_parallel_range(0, height, &data, imbuf_byte_to_byte_texture_cb, &settings);
 }
 
 typedef struct ImbufByteToFloatData {
@@ -2299,46 +2353,20 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
    * alpha depending on the image alpha mode. */
   if (ibuf->rect_float) {
     /* Float source buffer. */
-    const float *in_buffer = ibuf->rect_float;
-    const int in_channels = ibuf->channels;
-    const bool use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied;
-
-    for (int y = 0; y < height; y++) {
-      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-      const size_t out_offset = y * width;
-      const float *in = in_buffer + in_offset * in_channels;
-      float *out = out_buffer + out_offset * 4;
-
-      if (in_channels == 1) {
-        /* Copy single channel. */
-        for (int x = 0; x < width; x++, in += 1, out += 4) {
-          out[0] = in[0];
-          out[1] = in[0];
-          out[2] = in[0];
-          out[3] = in[0];
-        }
-      }
-      else if (in_channels == 3) {
-        /* Copy RGB. */
-        for (int x = 0; x < width; x++, in += 3, out += 4) {
-          out[0] = in[0];
-          out[1] = in[1];
-          out[2] = in[2];
-          out[3] = 1.0f;
-        }
-      }
-      else if (in_channels == 4) {
-        /* Copy or convert RGBA. */
-        if (use_unpremultiply) {
-          for (int x = 0; x < width; x++, in += 4, out += 4) {
-            premul_to_straight_v4_v4(out, in);
-          }
-        }
-        else {
-          memcpy(out, in, sizeof(float[4]) * width);
-        }
-      }
-    }
+    ImbufTextureData data = {
+        .width = width,
+        .offset = offset_y * ibuf->x + offset_x,
+        .stride = ibuf->x,
+        .in_channels = ibuf->channels,
+        .in_buffer = ibuf->rect_float,
+        .out_buffer = out_buffer,
+        .use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied,
+    };
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (height > 128);
+    BLI_task_parallel_range(0, height, &data, imbuf_float_to_float_texture_cb, &settings);
   }
   else {
     /* Byte source buffer. */
@@ -78,6 +78,7 @@
 #include "BLI_math_color.h"
 #include "BLI_mmap.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "BKE_idprop.h"
@@ -520,37 +521,40 @@ static bool imb_save_openexr_half(ImBuf *ibuf, const char *name, const int flags
                                sizeof(float),
                                sizeof(float) * -width));
     }
+    /* Convert the scan-lines in parallel, flipped to the top-down order of EXR. */
     if (ibuf->rect_float) {
-      float *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = ibuf->rect_float + channels * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = float_to_half_safe(from[0]);
-          to->g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
-          to->b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
-          to->a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
-          to++;
-          from += channels;
-        }
-      }
+      blender::threading::parallel_for(
+          blender::IndexRange(height), 64, [&](const blender::IndexRange range) {
+            for (const int64_t i : range) {
+              const float *from = ibuf->rect_float + channels * i * width;
+              RGBAZ *to_row = to + (height - 1 - i) * width;
+
+              for (int j = 0; j < width; j++) {
+                to_row[j].r = float_to_half_safe(from[0]);
+                to_row[j].g = float_to_half_safe((channels >= 2) ? from[1] : from[0]);
+                to_row[j].b = float_to_half_safe((channels >= 3) ? from[2] : from[0]);
+                to_row[j].a = float_to_half_safe((channels >= 4) ? from[3] : 1.0f);
+                from += channels;
+              }
+            }
+          });
     }
     else {
-      uchar *from;
-
-      for (int i = ibuf->y - 1; i >= 0; i--) {
-        from = (uchar *)ibuf->rect + 4 * i * width;
-
-        for (int j = ibuf->x; j > 0; j--) {
-          to->r = srgb_to_linearrgb(float(from[0]) / 255.0f);
-          to->g = srgb_to_linearrgb(float(from[1]) / 255.0f);
-          to->b = srgb_to_linearrgb(float(from[2]) / 255.0f);
-          to->a = channels >= 4 ? float(from[3]) / 255.0f : 1.0f;
-          to++;
-          from += 4;
-        }
-      }
+      blender::threading::parallel_for(
+          blender::IndexRange(height), 64, [&](const blender::IndexRange range) {
+            for (const int64_t i : range) {
+              const uchar *from = (const uchar *)ibuf->rect + 4 * i * width;
+              RGBAZ *to_row = to + (height - 1 - i) * width;
+
+              for (int j = 0; j < width; j++) {
+                to_row[j].r = srgb_to_linearrgb(float(from[0]) / 255.0f);
+                to_row[j].g = srgb_to_linearrgb(float(from[1]) / 255.0f);
+                to_row[j].b = srgb_to_linearrgb(float(from[2]) / 255.0f);
+                to_row[j].a = channels >= 4 ? float(from[3]) / 255.0f : 1.0f;
+                from += 4;
+              }
+            }
+          });
     }
 
     exr_printf("OpenEXR-save: Writing OpenEXR file of height %d.\n", height);
@@ -1175,11 +1179,15 @@ void IMB_exr_write_channels(void *handle)
     for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
       /* Writing starts from last scan-line, stride negative. */
       if (echan->use_half_float) {
-        float *rect = echan->rect;
+        const float *rect = echan->rect;
         half *cur = current_rect_half;
-        for (size_t i = 0; i < num_pixels; i++, cur++) {
-          *cur = float_to_half_safe(rect[i * echan->xstride]);
-        }
+        const int xstride = echan->xstride;
+        blender::threading::parallel_for(
+            blender::IndexRange(num_pixels), 65536, [&](const blender::IndexRange range) {
+              for (const int64_t i : range) {
+                cur[i] = float_to_half_safe(rect[i * xstride]);
+              }
+            });
         half *rect_to_write = current_rect_half + (data->height - 1L) * data->width;
         frameBuffer.insert(
             echan->name,
@@ -1293,6 +1301,7 @@ void IMB_exr_read_channels(void *handle)
     /* Insert all matching channel into frame-buffer. */
     FrameBuffer frameBuffer;
     ExrChannel *echan;
+    int num_slices = 0;
 
     for (echan = (ExrChannel *)data->channels.first; echan; echan = echan->next) {
       if (echan->m->part_number != i) {
@@ -1324,12 +1333,18 @@ void IMB_exr_read_channels(void *handle)
 
         frameBuffer.insert(echan->m->internal_name,
                            Slice(Imf::FLOAT, (char *)rect, xstride, ystride));
+        num_slices++;
       }
       else {
         printf("warning, channel with no rect set %s\n", echan->m->internal_name.c_str());
       }
     }
 
+    /* Don't decompress parts of which no channel is needed. */
+    if (num_slices == 0) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
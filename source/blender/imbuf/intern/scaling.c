@@ -7,8 +7,10 @@
 
 #include <math.h>
 
+#include "BLI_math_base.h"
 #include "BLI_math_color.h"
 #include "BLI_math_interp.h"
+#include "BLI_math_vector.h"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -1888,3 +1890,278 @@ void IMB_scaleImBuf_threaded(ImBuf *ibuf, uint newx, uint newy)
     ibuf->rect_float = init_data.float_buffer;
   }
 }
+
+/* ******** filtered scaling ******** */
+
+/* Weights of the source pixels that contribute to every destination pixel, along one axis. Edge
+ * pixels are repeated for the taps that fall outside of the source image. */
+typedef struct ScaleFilterWeights {
+  int taps_num;
+  /* Both arrays have `taps_num` elements per destination pixel. */
+  int *indices;
+  float *weights;
+} ScaleFilterWeights;
+
+static float scale_filter_radius(const eIMBScaleFilter filter)
+{
+  switch (filter) {
+    case IMB_SCALE_FILTER_MITCHELL:
+      return 2.0f;
+    case IMB_SCALE_FILTER_LANCZOS3:
+      return 3.0f;
+  }
+  return 2.0f;
+}
+
+static float scale_filter_eval(const eIMBScaleFilter filter, float x)
+{
+  x = fabsf(x);
+  switch (filter) {
+    case IMB_SCALE_FILTER_MITCHELL: {
+      /* B = C = 1/3. */
+      const float x2 = x * x;
+      const float x3 = x2 * x;
+      if (x < 1.0f) {
+        return (7.0f * x3 - 12.0f * x2 + 16.0f / 3.0f) / 6.0f;
+      }
+      if (x < 2.0f) {
+        return (-7.0f / 3.0f * x3 + 12.0f * x2 - 20.0f * x + 32.0f / 3.0f) / 6.0f;
+      }
+      return 0.0f;
+    }
+    case IMB_SCALE_FILTER_LANCZOS3: {
+      if (x < 1e-6f) {
+        return 1.0f;
+      }
+      if (x < 3.0f) {
+        const float px = (float)M_PI * x;
+        return 3.0f * sinf(px) * sinf(px / 3.0f) / (px * px);
+      }
+      return 0.0f;
+    }
+  }
+  return 0.0f;
+}
+
+static void scale_filter_weights_init(ScaleFilterWeights *r_weights,
+                                      const int src_size,
+                                      const int dst_size,
+                                      const eIMBScaleFilter filter)
+{
+  /* When scaling down the filter is stretched over the source pixels to avoid aliasing. */
+  const float scale = (float)src_size / (float)dst_size;
+  const float filter_scale = max_ff(scale, 1.0f);
+  const float support = scale_filter_radius(filter) * filter_scale;
+  const int taps_num = (int)ceilf(support) * 2 + 1;
+
+  r_weights->taps_num = taps_num;
+  r_weights->indices = MEM_mallocN(sizeof(int) * taps_num * dst_size, __func__);
+  r_weights->weights = MEM_mallocN(sizeof(float) * taps_num * dst_size, __func__);
+
+  for (int i = 0; i < dst_size; i++) {
+    const float center = ((float)i + 0.5f) * scale - 0.5f;
+    const int first = (int)floorf(center) - taps_num / 2;
+    int *indices = r_weights->indices + i * taps_num;
+    float *weights = r_weights->weights + i * taps_num;
+    float weight_sum = 0.0f;
+
+    for (int k = 0; k < taps_num; k++) {
+      const int src = first + k;
+      indices[k] = clamp_i(src, 0, src_size - 1);
+      weights[k] = scale_filter_eval(filter, ((float)src - center) / filter_scale);
+      weight_sum += weights[k];
+    }
+
+    if (weight_sum != 0.0f) {
+      const float weight_sum_inv = 1.0f / weight_sum;
+      for (int k = 0; k < taps_num; k++) {
+        weights[k] *= weight_sum_inv;
+      }
+    }
+  }
+}
+
+static void scale_filter_weights_free(ScaleFilterWeights *weights)
+{
+  MEM_freeN(weights->indices);
+  MEM_freeN(weights->weights);
+}
+
+typedef struct ScaleFilterData {
+  int src_x;
+  int dst_x;
+  int dst_y;
+  int channels;
+
+  ScaleFilterWeights weights_x;
+  ScaleFilterWeights weights_y;
+
+  /* Source, only one of them is set. */
+  const uchar *src_byte;
+  const float *src_float;
+
+  /* Result of the horizontal pass, `src_y` rows of `dst_x` pixels, premultiplied. */
+  float *tmp;
+
+  /* Destination, only one of them is set. */
+  uchar *dst_byte;
+  float *dst_float;
+} ScaleFilterData;
+
+static void scale_filter_horizontal_scanline(void *custom_data, int y)
+{
+  const ScaleFilterData *data = custom_data;
+  const int channels = data->channels;
+  const int taps_num = data->weights_x.taps_num;
+  float *tmp_row = data->tmp + (size_t)y * data->dst_x * channels;
+
+  if (data->src_byte) {
+    /* Straight alpha, premultiply while reading the source pixels. */
+    const uchar *src_row = data->src_byte + (size_t)y * data->src_x * 4;
+    for (int x = 0; x < data->dst_x; x++) {
+      const int *indices = data->weights_x.indices + x * taps_num;
+      const float *weights = data->weights_x.weights + x * taps_num;
+      float accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      for (int k = 0; k < taps_num; k++) {
+        const uchar *src = src_row + indices[k] * 4;
+        const float weight_rgb = weights[k] * ((float)src[3] * (1.0f / 255.0f));
+        accum[0] += weight_rgb * (float)src[0];
+        accum[1] += weight_rgb * (float)src[1];
+        accum[2] += weight_rgb * (float)src[2];
+        accum[3] += weights[k] * (float)src[3];
+      }
+      copy_v4_v4(tmp_row + x * 4, accum);
+    }
+  }
+  else {
+    const float *src_row = data->src_float + (size_t)y * data->src_x * channels;
+    for (int x = 0; x < data->dst_x; x++) {
+      const int *indices = data->weights_x.indices + x * taps_num;
+      const float *weights = data->weights_x.weights + x * taps_num;
+      float accum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      for (int k = 0; k < taps_num; k++) {
+        const float *src = src_row + indices[k] * channels;
+        for (int c = 0; c < channels; c++) {
+          accum[c] += weights[k] * src[c];
+        }
+      }
+      memcpy(tmp_row + x * channels, accum, sizeof(float) * channels);
+    }
+  }
+}
+
+static void scale_filter_vertical_scanline(void *custom_data, int y)
+{
+  const ScaleFilterData *data = custom_data;
+  const int channels = data->channels;
+  const int taps_num = data->weights_y.taps_num;
+  const int *indices = data->weights_y.indices + y * taps_num;
+  const float *weights = data->weights_y.weights + y * taps_num;
+  const size_t row_len = (size_t)data->dst_x * channels;
+
+  float *dst_row = data->dst_float ? data->dst_float + (size_t)y * row_len :
+                                     MEM_mallocN(sizeof(float) * row_len, __func__);
+
+  /* Accumulate whole rows, which the compiler can vectorize. */
+  const float *tmp_row = data->tmp + (size_t)indices[0] * row_len;
+  for (size_t i = 0; i < row_len; i++) {
+    dst_row[i] = weights[0] * tmp_row[i];
+  }
+  for (int k = 1; k < taps_num; k++) {
+    const float weight = weights[k];
+    tmp_row = data->tmp + (size_t)indices[k] * row_len;
+    for (size_t i = 0; i < row_len; i++) {
+      dst_row[i] += weight * tmp_row[i];
+    }
+  }
+
+  if (data->dst_byte) {
+    uchar *dst_byte_row = data->dst_byte + (size_t)y * row_len;
+    for (int x = 0; x < data->dst_x; x++) {
+      const float *src = dst_row + x * 4;
+      uchar *dst = dst_byte_row + x * 4;
+      const float alpha = clamp_f(src[3], 0.0f, 255.0f);
+      const float alpha_inv = (alpha > 0.0f) ? 255.0f / alpha : 0.0f;
+      dst[0] = (uchar)(clamp_f(src[0] * alpha_inv, 0.0f, 255.0f) + 0.5f);
+      dst[1] = (uchar)(clamp_f(src[1] * alpha_inv, 0.0f, 255.0f) + 0.5f);
+      dst[2] = (uchar)(clamp_f(src[2] * alpha_inv, 0.0f, 255.0f) + 0.5f);
+      dst[3] = (uchar)(alpha + 0.5f);
+    }
+    MEM_freeN(dst_row);
+  }
+}
+
+static void *scale_filter_buffer(const ImBuf *ibuf,
+                                 const int newx,
+                                 const int newy,
+                                 const eIMBScaleFilter filter,
+                                 const bool use_float)
+{
+  ScaleFilterData data = {0};
+  data.src_x = ibuf->x;
+  data.dst_x = newx;
+  data.dst_y = newy;
+  data.channels = use_float ? ibuf->channels : 4;
+
+  scale_filter_weights_init(&data.weights_x, ibuf->x, newx, filter);
+  scale_filter_weights_init(&data.weights_y, ibuf->y, newy, filter);
+
+  data.tmp = MEM_mallocN(sizeof(float) * data.channels * newx * ibuf->y, __func__);
+
+  void *result;
+  if (use_float) {
+    data.src_float = ibuf->rect_float;
+    data.dst_float = MEM_mallocN(sizeof(float) * ibuf->channels * newx * newy,
+                                 "filtered scale float buffer");
+    result = data.dst_float;
+  }
+  else {
+    data.src_byte = (const uchar *)ibuf->rect;
+    data.dst_byte = MEM_mallocN(sizeof(uint) * newx * newy, "filtered scale byte buffer");
+    result = data.dst_byte;
+  }
+
+  IMB_processor_apply_threaded_scanlines(ibuf->y, scale_filter_horizontal_scanline, &data);
+  IMB_processor_apply_threaded_scanlines(newy, scale_filter_vertical_scanline, &data);
+
+  MEM_freeN(data.tmp);
+  scale_filter_weights_free(&data.weights_x);
+  scale_filter_weights_free(&data.weights_y);
+
+  return result;
+}
+
+bool IMB_scaleImBuf_filtered(struct ImBuf *ibuf, uint newx, uint newy, eIMBScaleFilter filter)
+{
+  BLI_assert_msg(newx > 0 && newy > 0, "Images must be at least 1 on both dimensions!");
+
+  if (ibuf == NULL) {
+    return false;
+  }
+  if (ibuf->rect == NULL && ibuf->rect_float == NULL) {
+    return false;
+  }
+  if (newx == ibuf->x && newy == ibuf->y) {
+    return false;
+  }
+
+  scalefast_Z_ImBuf(ibuf, newx, newy);
+
+  if (ibuf->rect) {
+    uint *rect = scale_filter_buffer(ibuf, newx, newy, filter, false);
+    imb_freerectImBuf(ibuf);
+    ibuf->mall |= IB_rect;
+    ibuf->rect = rect;
+  }
+
+  if (ibuf->rect_float) {
+    float *rect_float = scale_filter_buffer(ibuf, newx, newy, filter, true);
+    imb_freerectfloatImBuf(ibuf);
+    ibuf->mall |= IB_rectfloat;
+    ibuf->rect_float = rect_float;
+  }
+
+  ibuf->x = newx;
+  ibuf->y = newy;
+  return true;
+}
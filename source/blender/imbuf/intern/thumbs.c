@@ -407,7 +407,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
           }
           imb_freerectfloatImBuf(img);
         }
-        IMB_scaleImBuf(img, ex, ey);
+        IMB_scaleImBuf_filtered(img, ex, ey, IMB_SCALE_FILTER_LANCZOS3);
       }
     }
     BLI_snprintf(desc, sizeof(desc), "Thumbnail for %s", uri);
@@ -662,6 +662,9 @@ void IMB_thumb_locks_release(void)
     BLI_gset_free(thumb_locks.locked_paths, MEM_freeN);
     thumb_locks.locked_paths = NULL;
     BLI_condition_end(&thumb_locks.cond);
+
+    /* Nothing generates thumbnails anymore, so don't keep the files open. */
+    IMB_thumb_blend_handles_free();
   }
 
   BLI_thread_unlock(LOCK_IMAGE);
@@ -8,8 +8,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "BLI_fileops.h"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h" /* Needed due to import of BLO_readfile.h */
+#include "BLI_path_util.h"
+#include "BLI_string.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLO_blend_defs.h"
@@ -27,24 +31,160 @@
 
 #include "MEM_guardedalloc.h"
 
-/* NOTE: we should handle all previews for a same group at once, would avoid reopening
- * `.blend` file for each and every ID. However, this adds some complexity,
- * so keep it for later. */
+/* -------------------------------------------------------------------- */
+/** \name Blend File Handle Cache
+ *
+ * Previews of IDs are generated one at a time, usually for all IDs of a file in a row and from
+ * multiple threads. Opening the file for every ID reads all its block headers again, so the last
+ * opened files are kept open while thumbnails are being generated. A handle can only be read from
+ * one thread at a time.
+ * \{ */
+
+#define BLEND_HANDLE_CACHE_SIZE 4
+
+typedef struct BlendHandleCacheEntry {
+  struct BlendHandleCacheEntry *next, *prev;
+  char filepath[FILE_MAX];
+  int64_t mtime;
+  struct BlendHandle *handle;
+  /** Locked while the handle is read from. */
+  ThreadMutex handle_mutex;
+  /** Threads using the entry, it is only freed when there are none. */
+  int users;
+  /** False once removed from the cache, e.g. because the file was modified. */
+  bool is_cached;
+} BlendHandleCacheEntry;
+
+/** Most recently used first. */
+static ListBase blend_handle_cache = {NULL, NULL};
+static ThreadMutex blend_handle_cache_mutex = BLI_MUTEX_INITIALIZER;
+
+static int64_t blend_file_mtime(const char *filepath)
+{
+  BLI_stat_t st;
+  if (BLI_stat(filepath, &st) == -1) {
+    return 0;
+  }
+  return (int64_t)st.st_mtime;
+}
+
+static void blend_handle_cache_entry_free(BlendHandleCacheEntry *entry)
+{
+  BLO_blendhandle_close(entry->handle);
+  BLI_mutex_end(&entry->handle_mutex);
+  MEM_freeN(entry);
+}
+
+/* Must be called with the cache locked. */
+static void blend_handle_cache_remove(BlendHandleCacheEntry *entry)
+{
+  BLI_remlink(&blend_handle_cache, entry);
+  entry->is_cached = false;
+  if (entry->users == 0) {
+    blend_handle_cache_entry_free(entry);
+  }
+}
+
+static BlendHandleCacheEntry *blend_handle_cache_find(const char *filepath, const int64_t mtime)
+{
+  LISTBASE_FOREACH (BlendHandleCacheEntry *, entry, &blend_handle_cache) {
+    if (STREQ(entry->filepath, filepath)) {
+      if (entry->mtime != mtime) {
+        blend_handle_cache_remove(entry);
+        return NULL;
+      }
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static BlendHandleCacheEntry *blend_handle_cache_acquire(const char *filepath)
+{
+  const int64_t mtime = blend_file_mtime(filepath);
+
+  BLI_mutex_lock(&blend_handle_cache_mutex);
+  BlendHandleCacheEntry *entry = blend_handle_cache_find(filepath, mtime);
+  if (entry) {
+    entry->users++;
+    BLI_remlink(&blend_handle_cache, entry);
+    BLI_addhead(&blend_handle_cache, entry);
+    BLI_mutex_unlock(&blend_handle_cache_mutex);
+    return entry;
+  }
+  BLI_mutex_unlock(&blend_handle_cache_mutex);
+
+  /* Open the file without holding the lock, so other files can be read in the meantime. */
+  BlendFileReadReport bf_reports = {.reports = NULL};
+  struct BlendHandle *handle = BLO_blendhandle_from_file(filepath, &bf_reports);
+  if (handle == NULL) {
+    return NULL;
+  }
+
+  BLI_mutex_lock(&blend_handle_cache_mutex);
+  entry = blend_handle_cache_find(filepath, mtime);
+  if (entry) {
+    /* Another thread opened the same file in the meantime. */
+    BLO_blendhandle_close(handle);
+    entry->users++;
+  }
+  else {
+    entry = MEM_callocN(sizeof(*entry), __func__);
+    BLI_strncpy(entry->filepath, filepath, sizeof(entry->filepath));
+    entry->mtime = mtime;
+    entry->handle = handle;
+    BLI_mutex_init(&entry->handle_mutex);
+    entry->users = 1;
+    entry->is_cached = true;
+    BLI_addhead(&blend_handle_cache, entry);
+
+    while (BLI_listbase_count_at_most(&blend_handle_cache, BLEND_HANDLE_CACHE_SIZE + 1) >
+           BLEND_HANDLE_CACHE_SIZE) {
+      blend_handle_cache_remove(blend_handle_cache.last);
+    }
+  }
+  BLI_mutex_unlock(&blend_handle_cache_mutex);
+
+  return entry;
+}
+
+static void blend_handle_cache_release(BlendHandleCacheEntry *entry)
+{
+  BLI_mutex_lock(&blend_handle_cache_mutex);
+  entry->users--;
+  if (entry->users == 0 && !entry->is_cached) {
+    blend_handle_cache_entry_free(entry);
+  }
+  BLI_mutex_unlock(&blend_handle_cache_mutex);
+}
+
+void IMB_thumb_blend_handles_free(void)
+{
+  BLI_mutex_lock(&blend_handle_cache_mutex);
+  LISTBASE_FOREACH_MUTABLE (BlendHandleCacheEntry *, entry, &blend_handle_cache) {
+    blend_handle_cache_remove(entry);
+  }
+  BLI_mutex_unlock(&blend_handle_cache_mutex);
+}
+
+/** \} */
+
 static ImBuf *imb_thumb_load_from_blend_id(const char *blen_path,
                                            const char *blen_group,
                                            const char *blen_id)
 {
   ImBuf *ima = NULL;
-  BlendFileReadReport bf_reports = {.reports = NULL};
 
-  struct BlendHandle *libfiledata = BLO_blendhandle_from_file(blen_path, &bf_reports);
-  if (libfiledata == NULL) {
+  BlendHandleCacheEntry *entry = blend_handle_cache_acquire(blen_path);
+  if (entry == NULL) {
     return NULL;
   }
 
   int idcode = BKE_idtype_idcode_from_name(blen_group);
-  PreviewImage *preview = BLO_blendhandle_get_preview_for_id(libfiledata, idcode, blen_id);
-  BLO_blendhandle_close(libfiledata);
+  BLI_mutex_lock(&entry->handle_mutex);
+  PreviewImage *preview = BLO_blendhandle_get_preview_for_id(entry->handle, idcode, blen_id);
+  BLI_mutex_unlock(&entry->handle_mutex);
+  blend_handle_cache_release(entry);
 
   if (preview) {
     ima = BKE_previewimg_to_imbuf(preview, ICON_SIZE_PREVIEW);
@@ -212,9 +212,12 @@ static void *imb_gpu_get_data(const ImBuf *ibuf,
   /* Pack first channel data manually at the start of the buffer. */
   if (is_grayscale) {
     void *src_rect = data_rect;
+    /* The buffer may have been rescaled above, only pack the pixels that are uploaded. */
+    const uint64_t pixels_num = do_rescale ? (uint64_t)rescale_size[0] * rescale_size[1] :
+                                             (uint64_t)ibuf->x * ibuf->y;
 
     if (freedata == false) {
-      data_rect = MEM_mallocN((is_float_rect ? sizeof(float) : sizeof(uchar)) * ibuf->x * ibuf->y,
+      data_rect = MEM_mallocN((is_float_rect ? sizeof(float) : sizeof(uchar)) * pixels_num,
                               __func__);
       *r_freedata = freedata = true;
     }
@@ -224,12 +227,12 @@ static void *imb_gpu_get_data(const ImBuf *ibuf,
     }
 
     if (is_float_rect) {
-      for (uint64_t i = 0; i < ibuf->x * ibuf->y; i++) {
+      for (uint64_t i = 0; i < pixels_num; i++) {
         ((float *)data_rect)[i] = ((float *)src_rect)[i * 4];
       }
     }
     else {
-      for (uint64_t i = 0; i < ibuf->x * ibuf->y; i++) {
+      for (uint64_t i = 0; i < pixels_num; i++) {
         ((uchar *)data_rect)[i] = ((uchar *)src_rect)[i * 4];
       }
     }
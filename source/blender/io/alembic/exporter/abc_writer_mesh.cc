@@ -9,7 +9,9 @@
 #include "intern/abc_axis_conversion.h"
 
 #include "BLI_assert.h"
+#include "BLI_map.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.h"
 #include "BKE_attribute.hh"
@@ -380,9 +382,11 @@ bool ABCGenericMeshWriter::get_velocities(struct Mesh *mesh, std::vector<Imath::
   vels.clear();
   vels.resize(totverts);
 
-  for (int i = 0; i < totverts; i++) {
-    copy_yup_from_zup(vels[i].getValue(), mesh_velocities[i]);
-  }
+  threading::parallel_for(IndexRange(totverts), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      copy_yup_from_zup(vels[i].getValue(), mesh_velocities[i]);
+    }
+  });
 
   return true;
 }
@@ -395,23 +399,26 @@ void ABCGenericMeshWriter::get_geo_groups(Object *object,
   const VArraySpan<int> material_indices = attributes.lookup_or_default<int>(
       "material_index", ATTR_DOMAIN_FACE, 0);
 
+  /* Resolve the face set of every material slot once, instead of looking up the material and
+   * its name for every face. */
+  Map<short, std::vector<int32_t> *> face_set_by_material;
+
   for (const int i : material_indices.index_range()) {
     short mnr = material_indices[i];
 
-    Material *mat = BKE_object_material_get(object, mnr + 1);
-
-    if (!mat) {
-      continue;
+    std::vector<int32_t> *face_set = face_set_by_material.lookup_or_add_cb(
+        mnr, [&]() -> std::vector<int32_t> * {
+          Material *mat = BKE_object_material_get(object, mnr + 1);
+          if (!mat) {
+            return nullptr;
+          }
+          std::string name = args_.hierarchy_iterator->get_id_name(&mat->id);
+          return &geo_groups[name];
+        });
+
+    if (face_set) {
+      face_set->push_back(i);
     }
-
-    std::string name = args_.hierarchy_iterator->get_id_name(&mat->id);
-
-    if (geo_groups.find(name) == geo_groups.end()) {
-      std::vector<int32_t> faceArray;
-      geo_groups[name] = faceArray;
-    }
-
-    geo_groups[name].push_back(i);
   }
 
   if (geo_groups.empty()) {
@@ -437,9 +444,11 @@ static void get_vertices(struct Mesh *mesh, std::vector<Imath::V3f> &points)
   points.resize(mesh->totvert);
 
   const Span<MVert> verts = mesh->verts();
-  for (int i = 0, e = mesh->totvert; i < e; i++) {
-    copy_yup_from_zup(points[i].getValue(), verts[i].co);
-  }
+  threading::parallel_for(verts.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      copy_yup_from_zup(points[i].getValue(), verts[i].co);
+    }
+  });
 }
 
 static void get_topology(struct Mesh *mesh,
@@ -449,26 +458,34 @@ static void get_topology(struct Mesh *mesh,
 {
   const Span<MPoly> polys = mesh->polys();
   const Span<MLoop> loops = mesh->loops();
-  r_has_flat_shaded_poly = false;
 
   poly_verts.clear();
   loop_counts.clear();
-  poly_verts.reserve(loops.size());
-  loop_counts.reserve(polys.size());
-
-  /* NOTE: data needs to be written in the reverse order. */
-  for (const int i : polys.index_range()) {
-    const MPoly &poly = polys[i];
-    loop_counts.push_back(poly.totloop);
-
-    r_has_flat_shaded_poly |= (poly.flag & ME_SMOOTH) == 0;
-
-    const MLoop *loop = &loops[poly.loopstart + (poly.totloop - 1)];
-
-    for (int j = 0; j < poly.totloop; j++, loop--) {
-      poly_verts.push_back(loop->v);
-    }
-  }
+  poly_verts.resize(loops.size());
+  loop_counts.resize(polys.size());
+
+  /* NOTE: data needs to be written in the reverse order. Polygons store their loops contiguously
+   * and in order, so every polygon can be written at its own loop offset independently. */
+  r_has_flat_shaded_poly = threading::parallel_reduce(
+      polys.index_range(),
+      1024,
+      false,
+      [&](const IndexRange range, bool has_flat_shaded_poly) {
+        for (const int i : range) {
+          const MPoly &poly = polys[i];
+          loop_counts[i] = poly.totloop;
+
+          has_flat_shaded_poly |= (poly.flag & ME_SMOOTH) == 0;
+
+          const MLoop *loop = &loops[poly.loopstart + (poly.totloop - 1)];
+
+          for (int j = 0; j < poly.totloop; j++, loop--) {
+            poly_verts[poly.loopstart + j] = loop->v;
+          }
+        }
+        return has_flat_shaded_poly;
+      },
+      [](const bool a, const bool b) { return a || b; });
 }
 
 static void get_edge_creases(struct Mesh *mesh,
@@ -541,16 +558,18 @@ static void get_loop_normals(struct Mesh *mesh,
   normals.resize(mesh->totloop);
 
   /* NOTE: data needs to be written in the reverse order. */
-  int abc_index = 0;
   const Span<MPoly> polys = mesh->polys();
 
-  for (const int i : polys.index_range()) {
-    const MPoly *mp = &polys[i];
-    for (int j = mp->totloop - 1; j >= 0; j--, abc_index++) {
-      int blender_index = mp->loopstart + j;
-      copy_yup_from_zup(normals[abc_index].getValue(), lnors[blender_index]);
+  threading::parallel_for(polys.index_range(), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      const MPoly *mp = &polys[i];
+      int abc_index = mp->loopstart;
+      for (int j = mp->totloop - 1; j >= 0; j--, abc_index++) {
+        int blender_index = mp->loopstart + j;
+        copy_yup_from_zup(normals[abc_index].getValue(), lnors[blender_index]);
+      }
     }
-  }
+  });
 }
 
 ABCMeshWriter::ABCMeshWriter(const ABCWriterConstructorArgs &args) : ABCGenericMeshWriter(args)
@@ -24,6 +24,7 @@
 #include "BLI_index_range.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_lib_id.h"
@@ -127,15 +128,17 @@ static void read_mverts_interp(MVert *mverts,
                                const P3fArraySamplePtr &ceil_positions,
                                const double weight)
 {
-  float tmp[3];
-  for (int i = 0; i < positions->size(); i++) {
-    MVert &mvert = mverts[i];
-    const Imath::V3f &floor_pos = (*positions)[i];
-    const Imath::V3f &ceil_pos = (*ceil_positions)[i];
-
-    interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), float(weight));
-    copy_zup_from_yup(mvert.co, tmp);
-  }
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    float tmp[3];
+    for (const int64_t i : range) {
+      MVert &mvert = mverts[i];
+      const Imath::V3f &floor_pos = (*positions)[i];
+      const Imath::V3f &ceil_pos = (*ceil_positions)[i];
+
+      interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), float(weight));
+      copy_zup_from_yup(mvert.co, tmp);
+    }
+  });
 }
 
 static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
@@ -157,12 +160,14 @@ static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
 void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySamplePtr normals)
 {
   MutableSpan<MVert> verts = mesh.verts_for_write();
-  for (int i = 0; i < positions->size(); i++) {
-    MVert &mvert = verts[i];
-    Imath::V3f pos_in = (*positions)[i];
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      MVert &mvert = verts[i];
+      Imath::V3f pos_in = (*positions)[i];
 
-    copy_zup_from_yup(mvert.co, pos_in.getValue());
-  }
+      copy_zup_from_yup(mvert.co, pos_in.getValue());
+    }
+  });
   BKE_mesh_tag_coords_changed(&mesh);
 
   if (normals) {
@@ -195,11 +200,14 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   uint rev_loop_index = 0;
   uint uv_index = 0;
   bool seen_invalid_geometry = false;
+  /* When streaming into a mesh that already has the same loops, its edges are still valid. */
+  bool loops_changed = config.mesh->totedge == 0;
 
   for (int i = 0; i < face_counts->size(); i++) {
     const int face_size = (*face_counts)[i];
 
     MPoly &poly = mpolys[i];
+    loops_changed |= poly.loopstart != loop_index || poly.totloop != face_size;
     poly.loopstart = loop_index;
     poly.totloop = face_size;
 
@@ -213,7 +221,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     uint last_vertex_index = 0;
     for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
       MLoop &loop = mloops[rev_loop_index];
-      loop.v = (*face_indices)[loop_index];
+      const uint vert_index = (*face_indices)[loop_index];
+      loops_changed |= loop.v != vert_index;
+      loop.v = vert_index;
 
       if (f > 0 && loop.v == last_vertex_index) {
         /* This face is invalid, as it has consecutive loops from the same vertex. This is caused
@@ -237,7 +247,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     }
   }
 
-  BKE_mesh_calc_edges(config.mesh, false, false);
+  if (loops_changed) {
+    BKE_mesh_calc_edges(config.mesh, false, false);
+  }
   if (seen_invalid_geometry) {
     if (config.modifier_error_message) {
       *config.modifier_error_message = "Mesh hash invalid geometry; more details on the console";
@@ -651,6 +663,18 @@ bool AbcMeshReader::accepts_object_type(
   return true;
 }
 
+static bool sample_topology_changed(const Mesh *existing_mesh,
+                                    const IPolyMeshSchema::Sample &sample)
+{
+  const P3fArraySamplePtr &positions = sample.getPositions();
+  const Alembic::Abc::Int32ArraySamplePtr &face_indices = sample.getFaceIndices();
+  const Alembic::Abc::Int32ArraySamplePtr &face_counts = sample.getFaceCounts();
+
+  return positions->size() != existing_mesh->totvert ||
+         face_counts->size() != existing_mesh->totpoly ||
+         face_indices->size() != existing_mesh->totloop;
+}
+
 bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSelector &sample_sel)
 {
   IPolyMeshSchema::Sample sample;
@@ -667,13 +691,7 @@ bool AbcMeshReader::topology_changed(const Mesh *existing_mesh, const ISampleSel
     return false;
   }
 
-  const P3fArraySamplePtr &positions = sample.getPositions();
-  const Alembic::Abc::Int32ArraySamplePtr &face_indices = sample.getFaceIndices();
-  const Alembic::Abc::Int32ArraySamplePtr &face_counts = sample.getFaceCounts();
-
-  return positions->size() != existing_mesh->totvert ||
-         face_counts->size() != existing_mesh->totpoly ||
-         face_indices->size() != existing_mesh->totloop;
+  return sample_topology_changed(existing_mesh, sample);
 }
 
 Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
@@ -726,7 +744,7 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   settings.velocity_name = velocity_name;
   settings.velocity_scale = velocity_scale;
 
-  if (topology_changed(existing_mesh, sample_sel)) {
+  if (sample_topology_changed(existing_mesh, sample)) {
     new_mesh = BKE_mesh_new_nomain_from_template(
         existing_mesh, positions->size(), 0, 0, face_indices->size(), face_counts->size());
 
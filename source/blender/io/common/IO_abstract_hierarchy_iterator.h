@@ -44,6 +44,9 @@ class DupliParentFinder;
 struct HierarchyContext {
   /*********** Determined during hierarchy iteration: ***************/
   Object *object; /* Evaluated object. */
+  /* Data to export for the object. This is `object->data`, except for geometry instances (as
+   * created by geometry nodes) where `object` is the instancer and this is the instanced data. */
+  ID *object_data;
   Object *export_parent;
   Object *duplicator;
   PersistentID persistent_id;
@@ -92,6 +95,8 @@ struct HierarchyContext {
 
   /* For handling instanced collections, instances created by particles, etc. */
   bool is_instance() const;
+  /* True when this context exports instanced geometry data rather than the object's own data. */
+  bool is_geometry_instance() const;
   void mark_as_instance_of(const std::string &reference_export_path);
   void mark_as_not_instanced();
 
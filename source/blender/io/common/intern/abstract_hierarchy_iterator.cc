@@ -52,6 +52,10 @@ bool HierarchyContext::is_instance() const
 {
   return !original_export_path.empty();
 }
+bool HierarchyContext::is_geometry_instance() const
+{
+  return object_data != object->data;
+}
 void HierarchyContext::mark_as_instance_of(const std::string &reference_export_path)
 {
   original_export_path = reference_export_path;
@@ -181,6 +185,9 @@ void AbstractHierarchyIterator::iterate_and_write()
   export_graph_construct();
   connect_loose_objects();
   export_graph_prune();
+  /* Geometry instances are identified by pointers to temporary data, so don't keep their
+   * paths around for the next frame. */
+  duplisource_export_path_.clear();
   determine_export_paths(HierarchyContext::root());
   determine_duplication_references(HierarchyContext::root(), "");
   make_writers(HierarchyContext::root());
@@ -407,6 +414,7 @@ void AbstractHierarchyIterator::visit_object(Object *object,
 {
   HierarchyContext *context = new HierarchyContext();
   context->object = object;
+  context->object_data = static_cast<ID *>(object->data);
   context->export_name = get_object_name(object);
   context->export_parent = export_parent;
   context->duplicator = nullptr;
@@ -447,6 +455,8 @@ void AbstractHierarchyIterator::visit_dupli_object(DupliObject *dupli_object,
 {
   HierarchyContext *context = new HierarchyContext();
   context->object = dupli_object->ob;
+  context->object_data = dupli_object->ob_data ? dupli_object->ob_data :
+                                                 static_cast<ID *>(dupli_object->ob->data);
   context->duplicator = duplicator;
   context->persistent_id = PersistentID(dupli_object);
   context->weak_export = false;
@@ -530,7 +540,20 @@ void AbstractHierarchyIterator::determine_duplication_references(
   ExportChildren children = graph_children(parent_context);
 
   for (HierarchyContext *context : children) {
-    if (context->duplicator != nullptr) {
+    if (context->duplicator != nullptr && context->is_geometry_instance()) {
+      /* All geometry instances share the instancer as object, only their data tells what is
+       * instanced. The first one found is exported as the original. */
+      const ExportPathMap::const_iterator &it = duplisource_export_path_.find(
+          context->object_data);
+      if (it == duplisource_export_path_.end()) {
+        context->mark_as_not_instanced();
+        duplisource_export_path_[context->object_data] = get_object_data_path(context);
+      }
+      else {
+        context->mark_as_instance_of(it->second);
+      }
+    }
+    else if (context->duplicator != nullptr) {
       ID *source_id = &context->object->id;
       const ExportPathMap::const_iterator &it = duplisource_export_path_.find(source_id);
 
@@ -623,14 +646,13 @@ HierarchyContext AbstractHierarchyIterator::context_for_object_data(
 
 void AbstractHierarchyIterator::make_writer_object_data(const HierarchyContext *context)
 {
-  if (context->object->data == nullptr) {
+  if (context->object_data == nullptr) {
     return;
   }
 
   HierarchyContext data_context = context_for_object_data(context);
   if (data_context.is_instance()) {
-    ID *object_data = static_cast<ID *>(context->object->data);
-    data_context.original_export_path = duplisource_export_path_[object_data];
+    data_context.original_export_path = duplisource_export_path_[context->object_data];
 
     /* If the object is marked as an instance, so should the object data. */
     BLI_assert(data_context.is_instance());
@@ -0,0 +1,130 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup stl
+ */
+
+#include <iostream>
+#include <memory>
+#include <system_error>
+
+#include "BKE_context.h"
+#include "BKE_lib_id.h"
+#include "BKE_mesh.h"
+#include "BKE_mesh_wrapper.h"
+#include "BKE_object.h"
+
+#include "BLI_array.hh"
+#include "BLI_float4x4.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_vector.h"
+#include "BLI_task.hh"
+
+#include "DEG_depsgraph.h"
+#include "DEG_depsgraph_query.h"
+
+#include "DNA_layer_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_object_types.h"
+#include "DNA_scene_types.h"
+
+#include "IO_orientation.h"
+
+#include "stl_export.hh"
+#include "stl_export_writer.hh"
+
+namespace blender::io::stl {
+
+/**
+ * Compute the exported corner positions of all triangles of \a mesh, transformed into the
+ * export space. Negative scale flips the winding, so that normals keep pointing outwards.
+ */
+static Array<float3> mesh_triangle_corner_positions(const Mesh &mesh, const float4x4 &transform)
+{
+  const Span<MVert> verts = mesh.verts();
+  const Span<MLoop> loops = mesh.loops();
+  const Span<MLoopTri> looptris = mesh.looptris();
+  const bool flip = is_negative_m4(transform.values);
+
+  Array<float3> corner_positions(looptris.size() * 3);
+  threading::parallel_for(looptris.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const MLoopTri &lt = looptris[i];
+      for (const int corner : IndexRange(3)) {
+        const int src_corner = flip ? 2 - corner : corner;
+        const float3 co = verts[loops[lt.tri[src_corner]].v].co;
+        corner_positions[3 * i + corner] = transform * co;
+      }
+    }
+  });
+  return corner_positions;
+}
+
+void exporter_main(bContext *C, const STLExportParams &export_params)
+{
+  std::unique_ptr<FileWriter> writer;
+  try {
+    writer = std::make_unique<FileWriter>(export_params.filepath, export_params.ascii_format);
+  }
+  catch (const std::system_error &ex) {
+    std::cerr << ex.code().category().name() << ": " << ex.what() << ": "
+              << ex.code().message() << std::endl;
+    return;
+  }
+
+  Depsgraph *depsgraph = CTX_data_ensure_evaluated_depsgraph(C);
+  Scene *scene = CTX_data_scene(C);
+
+  float global_scale = export_params.global_scale;
+  if ((scene->unit.system != USER_UNIT_NONE) && export_params.use_scene_unit) {
+    global_scale *= scene->unit.scale_length;
+  }
+  float axes_transform[3][3];
+  unit_m3(axes_transform);
+  /* +Y-forward and +Z-up are the Blender's default axis settings. */
+  mat3_from_axis_conversion(
+      export_params.forward_axis, export_params.up_axis, IO_AXIS_Y, IO_AXIS_Z, axes_transform);
+  mul_m3_fl(axes_transform, global_scale);
+  float4x4 scene_transform;
+  copy_m4_m3(scene_transform.values, axes_transform);
+
+  DEGObjectIterSettings deg_iter_settings{};
+  deg_iter_settings.depsgraph = depsgraph;
+  deg_iter_settings.flags = DEG_ITER_OBJECT_FLAG_LINKED_DIRECTLY |
+                            DEG_ITER_OBJECT_FLAG_LINKED_VIA_SET | DEG_ITER_OBJECT_FLAG_VISIBLE |
+                            DEG_ITER_OBJECT_FLAG_DUPLI;
+  DEG_OBJECT_ITER_BEGIN (&deg_iter_settings, object) {
+    if (export_params.export_selected_objects && !(object->base_flag & BASE_SELECTED)) {
+      continue;
+    }
+    if (!ELEM(object->type, OB_MESH, OB_CURVES_LEGACY, OB_SURF, OB_FONT)) {
+      continue;
+    }
+
+    /* We need to copy the object because it may be in temporary space. */
+    Object object_eval = dna::shallow_copy(*object);
+    Mesh *mesh = nullptr;
+    Mesh *owned_mesh = nullptr;
+    if (object->type == OB_MESH) {
+      mesh = export_params.apply_modifiers ? BKE_object_get_evaluated_mesh(&object_eval) :
+                                             BKE_object_get_pre_modified_mesh(&object_eval);
+    }
+    if (mesh == nullptr) {
+      owned_mesh = BKE_mesh_new_from_object(
+          depsgraph, &object_eval, true, export_params.apply_modifiers);
+      mesh = owned_mesh;
+    }
+    if (mesh != nullptr) {
+      BKE_mesh_wrapper_ensure_mdata(mesh);
+      const float4x4 transform = scene_transform * float4x4(object->object_to_world);
+      writer->write_triangles(mesh_triangle_corner_positions(*mesh, transform));
+    }
+    if (owned_mesh != nullptr) {
+      BKE_id_free(nullptr, owned_mesh);
+    }
+  }
+  DEG_OBJECT_ITER_END;
+}
+
+}  // namespace blender::io::stl
@@ -0,0 +1,148 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup stl
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+#include "BKE_blender_version.h"
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_math_geom.h"
+#include "BLI_string.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
+#include "stl_export_writer.hh"
+
+namespace blender::io::stl {
+
+#pragma pack(push, 1)
+struct STLBinaryTriangle {
+  float normal[3];
+  float v1[3], v2[3], v3[3];
+  uint16_t attribute_byte_count;
+};
+#pragma pack(pop)
+
+static const size_t BINARY_HEADER_SIZE = 80;
+static const char *ASCII_SOLID_NAME = "Exported from Blender";
+
+/* Triangles are formatted in chunks of this size, each chunk on its own thread. */
+static const int64_t chunk_size = 16384;
+
+FileWriter::FileWriter(const char *filepath, const bool ascii) noexcept(false)
+    : filepath_(filepath), ascii_(ascii)
+{
+  file_ = BLI_fopen(filepath, "wb");
+  if (!file_) {
+    throw std::system_error(errno, std::system_category(), "Cannot open file " + filepath_);
+  }
+  if (ascii_) {
+    fprintf(file_, "solid %s\n", ASCII_SOLID_NAME);
+  }
+  else {
+    char header[BINARY_HEADER_SIZE] = {};
+    BLI_snprintf(
+        header, sizeof(header), "%s-%s", ASCII_SOLID_NAME, BKE_blender_version_string());
+    fwrite(header, 1, BINARY_HEADER_SIZE, file_);
+    /* The triangle count is written when the file is closed. */
+    fwrite(&tris_num_, sizeof(uint32_t), 1, file_);
+  }
+}
+
+FileWriter::~FileWriter()
+{
+  if (ascii_) {
+    fprintf(file_, "endsolid %s\n", ASCII_SOLID_NAME);
+  }
+  else {
+    fseek(file_, BINARY_HEADER_SIZE, SEEK_SET);
+    fwrite(&tris_num_, sizeof(uint32_t), 1, file_);
+  }
+  if (std::fclose(file_)) {
+    std::cerr << "Error: could not close the file '" << filepath_
+              << "' properly, it may be corrupted." << std::endl;
+  }
+}
+
+void FileWriter::write_triangles(const Span<float3> corner_positions)
+{
+  BLI_assert(corner_positions.size() % 3 == 0);
+  const int64_t tris_num = corner_positions.size() / 3;
+  if (tris_num == 0) {
+    return;
+  }
+  if (tris_num_ + uint64_t(tris_num) > UINT32_MAX) {
+    std::cerr << "STL Exporter: too many triangles, skipping " << tris_num << " of them"
+              << std::endl;
+    return;
+  }
+  tris_num_ += uint32_t(tris_num);
+
+  /* Format every chunk into its own buffer in parallel and write them in order. */
+  const int64_t chunks_num = (tris_num + chunk_size - 1) / chunk_size;
+  Array<Vector<char>> buffers(chunks_num);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+    for (const int64_t chunk : chunks) {
+      const IndexRange tris = IndexRange(chunk * chunk_size,
+                                         std::min(chunk_size, tris_num - chunk * chunk_size));
+      Vector<char> &buffer = buffers[chunk];
+      if (!ascii_) {
+        buffer.resize(tris.size() * sizeof(STLBinaryTriangle));
+      }
+      for (const int64_t i : IndexRange(tris.size())) {
+        const float3 &v1 = corner_positions[3 * tris[i]];
+        const float3 &v2 = corner_positions[3 * tris[i] + 1];
+        const float3 &v3 = corner_positions[3 * tris[i] + 2];
+        float3 normal;
+        normal_tri_v3(normal, v1, v2, v3);
+        if (ascii_) {
+          char str[512];
+          const size_t len = BLI_snprintf_rlen(str,
+                                               sizeof(str),
+                                               "facet normal %f %f %f\n"
+                                               " outer loop\n"
+                                               "  vertex %f %f %f\n"
+                                               "  vertex %f %f %f\n"
+                                               "  vertex %f %f %f\n"
+                                               " endloop\n"
+                                               "endfacet\n",
+                                               normal.x,
+                                               normal.y,
+                                               normal.z,
+                                               v1.x,
+                                               v1.y,
+                                               v1.z,
+                                               v2.x,
+                                               v2.y,
+                                               v2.z,
+                                               v3.x,
+                                               v3.y,
+                                               v3.z);
+          buffer.extend(Span<char>(str, len));
+        }
+        else {
+          STLBinaryTriangle tri;
+          memcpy(tri.normal, normal, sizeof(float[3]));
+          memcpy(tri.v1, v1, sizeof(float[3]));
+          memcpy(tri.v2, v2, sizeof(float[3]));
+          memcpy(tri.v3, v3, sizeof(float[3]));
+          tri.attribute_byte_count = 0;
+          memcpy(&buffer[i * sizeof(STLBinaryTriangle)], &tri, sizeof(STLBinaryTriangle));
+        }
+      }
+    }
+  });
+
+  for (const Vector<char> &buffer : buffers) {
+    fwrite(buffer.data(), 1, buffer.size(), file_);
+  }
+}
+
+}  // namespace blender::io::stl
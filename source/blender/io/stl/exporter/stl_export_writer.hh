@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup stl
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+#include "BLI_math_vec_types.hh"
+#include "BLI_span.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender::io::stl {
+
+/**
+ * Writes triangles into a binary or ASCII STL file. Triangles are given as three corner
+ * positions each; large batches are formatted in parallel and written in order.
+ */
+class FileWriter : NonCopyable, NonMovable {
+ private:
+  std::string filepath_;
+  FILE *file_;
+  const bool ascii_;
+  uint32_t tris_num_ = 0;
+
+ public:
+  /**
+   * Open the file for writing and write the STL header.
+   * \throws std::system_error when the file cannot be opened.
+   */
+  FileWriter(const char *filepath, bool ascii) noexcept(false);
+  /**
+   * Write the STL footer (ASCII) or the final triangle count (binary) and close the file.
+   */
+  ~FileWriter();
+
+  /**
+   * Write triangles from three consecutive corner positions each. The facet normals are
+   * computed from the positions.
+   */
+  void write_triangles(Span<float3> corner_positions);
+};
+
+}  // namespace blender::io::stl
@@ -12,6 +12,8 @@
 
 #include "BLI_array.hh"
 #include "BLI_memory_utils.hh"
+#include "BLI_mmap.h"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 
@@ -43,20 +45,58 @@ Mesh *read_stl_binary(FILE *file, Main *bmain, char *mesh_name, bool use_custom_
     return BKE_mesh_add(bmain, mesh_name);
   }
 
-  Array<STLBinaryTriangle> tris_buf(chunk_size);
-  STLMeshHelper stl_mesh(num_tris, use_custom_normals);
-  size_t num_read_tris;
-  while ((num_read_tris = fread(tris_buf.data(), sizeof(STLBinaryTriangle), chunk_size, file))) {
-    for (size_t i = 0; i < num_read_tris; i++) {
+  Array<float3> corner_positions(int64_t(num_tris) * 3);
+  Array<float3> tri_normals(use_custom_normals ? num_tris : 0);
+  const auto copy_triangles = [&](const STLBinaryTriangle *tris, const IndexRange range) {
+    for (const int64_t i : IndexRange(range.size())) {
+      const STLBinaryTriangle &tri = tris[i];
+      const int64_t tri_index = range[i];
+      corner_positions[3 * tri_index] = tri.v1;
+      corner_positions[3 * tri_index + 1] = tri.v2;
+      corner_positions[3 * tri_index + 2] = tri.v3;
       if (use_custom_normals) {
-        stl_mesh.add_triangle(tris_buf[i].v1, tris_buf[i].v2, tris_buf[i].v3, tris_buf[i].normal);
+        tri_normals[tri_index] = tri.normal;
       }
-      else {
-        stl_mesh.add_triangle(tris_buf[i].v1, tris_buf[i].v2, tris_buf[i].v3);
+    }
+  };
+
+  /* The file size was checked against the triangle count already, so all triangles can be
+   * read straight from the mapped file, in parallel. */
+  BLI_mmap_file *mmap_file = BLI_mmap_open(fileno(file));
+  if (mmap_file) {
+    BLI_SCOPED_DEFER([&]() { BLI_mmap_free(mmap_file); });
+    const STLBinaryTriangle *tris = reinterpret_cast<const STLBinaryTriangle *>(
+        static_cast<const char *>(BLI_mmap_get_pointer(mmap_file)) + BINARY_HEADER_SIZE +
+        sizeof(uint32_t));
+    threading::parallel_for(IndexRange(num_tris), 4096, [&](const IndexRange range) {
+      copy_triangles(tris + range.start(), range);
+    });
+    /* Reading fails after an IO error occurred while accessing the mapped memory. */
+    if (!BLI_mmap_read(mmap_file, &num_tris, BINARY_HEADER_SIZE, sizeof(uint32_t))) {
+      fprintf(stderr, "STL Importer: failed to read file, IO error.\n");
+      return nullptr;
+    }
+  }
+  else {
+    Array<STLBinaryTriangle> tris_buf(chunk_size);
+    int64_t tris_offset = 0;
+    while (tris_offset < num_tris) {
+      const size_t num_read_tris = fread(tris_buf.data(),
+                                         sizeof(STLBinaryTriangle),
+                                         std::min<int64_t>(chunk_size, num_tris - tris_offset),
+                                         file);
+      if (num_read_tris == 0) {
+        stl_import_report_error(file);
+        return nullptr;
       }
+      copy_triangles(tris_buf.data(), IndexRange(tris_offset, num_read_tris));
+      tris_offset += num_read_tris;
     }
   }
 
+  STLMeshHelper stl_mesh(num_tris, use_custom_normals);
+  stl_mesh.add_triangles(corner_positions, tri_normals);
+
   return stl_mesh.to_mesh(bmain, mesh_name);
 }
 
@@ -34,11 +34,16 @@ STLMeshHelper::STLMeshHelper(int tris_num, bool use_custom_normals)
   }
 }
 
-bool STLMeshHelper::add_triangle(const float3 &a, const float3 &b, const float3 &c)
+int STLMeshHelper::add_vertex(const float3 &co)
+{
+  return vert_indices_.lookup_or_add_cb(co, [&]() {
+    verts_.append(co);
+    return int(verts_.size() - 1);
+  });
+}
+
+bool STLMeshHelper::add_triangle_indices(const int v1_id, const int v2_id, const int v3_id)
 {
-  int v1_id = verts_.index_of_or_add(a);
-  int v2_id = verts_.index_of_or_add(b);
-  int v3_id = verts_.index_of_or_add(c);
   if ((v1_id == v2_id) || (v1_id == v3_id) || (v2_id == v3_id)) {
     degenerate_tris_num_++;
     return false;
@@ -50,6 +55,11 @@ bool STLMeshHelper::add_triangle(const float3 &a, const float3 &b, const float3
   return true;
 }
 
+bool STLMeshHelper::add_triangle(const float3 &a, const float3 &b, const float3 &c)
+{
+  return add_triangle_indices(add_vertex(a), add_vertex(b), add_vertex(c));
+}
+
 void STLMeshHelper::add_triangle(const float3 &a,
                                  const float3 &b,
                                  const float3 &c,
@@ -60,6 +70,113 @@ void STLMeshHelper::add_triangle(const float3 &a,
   }
 }
 
+/**
+ * Merge equal positions in \a corner_positions. The corners are distributed over partitions by
+ * the hash of their position, so that every partition can be merged with its own hash table
+ * in parallel. Vertices are numbered in the order of their first use, like when adding them
+ * one by one.
+ *
+ * \return The vertex index of every corner.
+ */
+static Array<int> weld_corner_positions(const Span<float3> corner_positions,
+                                        Vector<float3> &r_verts)
+{
+  constexpr int partition_bits = 6;
+  constexpr int partitions_num = 1 << partition_bits;
+  const int64_t corners_num = corner_positions.size();
+  const int64_t chunk_size = 1 << 16;
+  const int64_t chunks_num = (corners_num + chunk_size - 1) / chunk_size;
+  const auto chunk_range = [&](const int64_t chunk) {
+    return IndexRange(chunk * chunk_size, std::min(chunk_size, corners_num - chunk * chunk_size));
+  };
+
+  /* Use the highest bits of a mixed hash, the hash tables use the lowest ones. */
+  Array<uint8_t> corner_partitions(corners_num);
+  Array<int64_t> chunk_offsets(chunks_num * partitions_num, 0);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+    for (const int64_t chunk : chunks) {
+      int64_t *counts = &chunk_offsets[chunk * partitions_num];
+      for (const int64_t corner : chunk_range(chunk)) {
+        const uint64_t hash = DefaultHash<float3>{}(corner_positions[corner]);
+        const uint8_t partition = uint8_t((hash * 0x9E3779B97F4A7C15ull) >>
+                                          (64 - partition_bits));
+        corner_partitions[corner] = partition;
+        counts[partition]++;
+      }
+    }
+  });
+
+  /* Turn counts into offsets, ordered by partition first and chunk second, so that the corners
+   * of each partition stay sorted by index. */
+  Array<int64_t> partition_offsets(partitions_num + 1);
+  int64_t offset = 0;
+  for (const int partition : IndexRange(partitions_num)) {
+    partition_offsets[partition] = offset;
+    for (const int64_t chunk : IndexRange(chunks_num)) {
+      const int64_t count = chunk_offsets[chunk * partitions_num + partition];
+      chunk_offsets[chunk * partitions_num + partition] = offset;
+      offset += count;
+    }
+  }
+  partition_offsets.last() = offset;
+
+  Array<int> sorted_corners(corners_num);
+  threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+    for (const int64_t chunk : chunks) {
+      int64_t *offsets = &chunk_offsets[chunk * partitions_num];
+      for (const int64_t corner : chunk_range(chunk)) {
+        sorted_corners[offsets[corner_partitions[corner]]++] = int(corner);
+      }
+    }
+  });
+
+  /* Find the first corner using each position. */
+  Array<int> corner_verts(corners_num);
+  threading::parallel_for(IndexRange(partitions_num), 1, [&](const IndexRange partitions) {
+    for (const int partition : partitions) {
+      const Span<int> corners = sorted_corners.as_span().slice(
+          partition_offsets[partition],
+          partition_offsets[partition + 1] - partition_offsets[partition]);
+      Map<float3, int> first_corners;
+      first_corners.reserve(corners.size());
+      for (const int corner : corners) {
+        corner_verts[corner] = first_corners.lookup_or_add(corner_positions[corner], corner);
+      }
+    }
+  });
+
+  /* The first corner of a position always comes before the others,
+   * so the vertex indices can be assigned in a single pass. */
+  r_verts.clear();
+  for (const int64_t corner : IndexRange(corners_num)) {
+    const int first_corner = corner_verts[corner];
+    if (first_corner == corner) {
+      corner_verts[corner] = int(r_verts.size());
+      r_verts.append(corner_positions[corner]);
+    }
+    else {
+      corner_verts[corner] = corner_verts[first_corner];
+    }
+  }
+  return corner_verts;
+}
+
+void STLMeshHelper::add_triangles(const Span<float3> corner_positions,
+                                  const Span<float3> tri_normals)
+{
+  BLI_assert(verts_.is_empty() && tris_.is_empty());
+  BLI_assert(corner_positions.size() % 3 == 0);
+  const Array<int> corner_verts = weld_corner_positions(corner_positions, verts_);
+  const int64_t tris_num = corner_positions.size() / 3;
+  for (const int64_t i : IndexRange(tris_num)) {
+    const bool added = add_triangle_indices(
+        corner_verts[3 * i], corner_verts[3 * i + 1], corner_verts[3 * i + 2]);
+    if (added && use_custom_normals_) {
+      loop_normals_.append_n_times(tri_normals[i], 3);
+    }
+  }
+}
+
 Mesh *STLMeshHelper::to_mesh(Main *bmain, char *mesh_name)
 {
   if (degenerate_tris_num_ > 0) {
@@ -78,9 +195,11 @@ Mesh *STLMeshHelper::to_mesh(Main *bmain, char *mesh_name)
   mesh->totvert = verts_.size();
   CustomData_add_layer(&mesh->vdata, CD_MVERT, CD_SET_DEFAULT, nullptr, mesh->totvert);
   MutableSpan<MVert> verts = mesh->verts_for_write();
-  for (int i = 0; i < mesh->totvert; i++) {
-    copy_v3_v3(verts[i].co, verts_[i]);
-  }
+  threading::parallel_for(verts.index_range(), 4096, [&](IndexRange range) {
+    for (const int i : range) {
+      copy_v3_v3(verts[i].co, verts_[i]);
+    }
+  });
 
   mesh->totpoly = tris_.size();
   mesh->totloop = tris_.size() * 3;
@@ -8,6 +8,8 @@
 
 #include <cstdint>
 
+#include "BLI_array.hh"
+#include "BLI_map.hh"
 #include "BLI_math_vec_types.hh"
 #include "BLI_set.hh"
 #include "BLI_vector.hh"
@@ -47,7 +49,9 @@ class Triangle {
 
 class STLMeshHelper {
  private:
-  VectorSet<float3> verts_;
+  Vector<float3> verts_;
+  /** Index into #verts_ for every position, used when adding triangles one by one. */
+  Map<float3, int> vert_indices_;
   VectorSet<Triangle> tris_;
   Vector<float3> loop_normals_;
   int degenerate_tris_num_;
@@ -65,7 +69,17 @@ class STLMeshHelper {
                     const float3 &b,
                     const float3 &c,
                     const float3 &custom_normal);
+  /**
+   * Add all triangles at once, given three corner positions per triangle and optionally one
+   * custom normal per triangle. Duplicate vertices are merged in parallel, which is much faster
+   * than adding triangles one by one. Cannot be combined with #add_triangle.
+   */
+  void add_triangles(Span<float3> corner_positions, Span<float3> tri_normals);
   Mesh *to_mesh(Main *bmain, char *mesh_name);
+
+ private:
+  int add_vertex(const float3 &co);
+  bool add_triangle_indices(int v1_id, int v2_id, int v3_id);
 };
 
 }  // namespace blender::io::stl
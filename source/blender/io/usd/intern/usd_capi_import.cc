@@ -30,6 +30,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "DEG_depsgraph.h"
@@ -251,7 +252,26 @@ static void import_startjob(void *customdata, bool *stop, bool *do_update, float
     }
   }
 
-  /* Setup parenthood and read actual object data. */
+  /* Read the data that does not need Main in parallel over all prims. USD stages are safe
+   * to read from multiple threads, and each reader only fills its own object data. */
+  const std::vector<USDPrimReader *> &readers = archive->readers();
+  blender::threading::parallel_for(
+      blender::IndexRange(readers.size()), 1, [&](const blender::IndexRange range) {
+        for (const int64_t reader_index : range) {
+          if (readers[reader_index] != nullptr) {
+            readers[reader_index]->prefetch_object_data(0.0);
+          }
+        }
+      });
+  *data->do_update = true;
+  *data->progress = 0.75f;
+
+  if (G.is_break) {
+    data->was_canceled = true;
+    return;
+  }
+
+  /* Setup parenthood and read actual object data, this uses Main and has to be serial. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
 
@@ -272,7 +292,7 @@ static void import_startjob(void *customdata, bool *stop, bool *do_update, float
       ob->parent = parent->object();
     }
 
-    *data->progress = 0.5f + 0.5f * (++i / size);
+    *data->progress = 0.75f + 0.25f * (++i / size);
     *data->do_update = true;
 
     if (G.is_break) {
@@ -8,6 +8,7 @@
 
 #include "BKE_attribute.hh"
 #include "BKE_customdata.h"
+#include "BKE_lib_id.h"
 #include "BKE_main.h"
 #include "BKE_material.h"
 #include "BKE_mesh.h"
@@ -18,6 +19,7 @@
 #include "BLI_math_vec_types.hh"
 #include "BLI_span.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DNA_customdata_types.h"
 #include "DNA_material_types.h"
@@ -231,6 +233,14 @@ USDMeshReader::USDMeshReader(const pxr::UsdPrim &prim,
 {
 }
 
+USDMeshReader::~USDMeshReader()
+{
+  /* Import was canceled between prefetching and reading the object data. */
+  if (prefetched_mesh_is_owned_) {
+    BKE_id_free(nullptr, prefetched_mesh_);
+  }
+}
+
 void USDMeshReader::create_object(Main *bmain, const double /* motionSampleTime */)
 {
   Mesh *mesh = BKE_mesh_add(bmain, name_.c_str());
@@ -239,15 +249,29 @@ void USDMeshReader::create_object(Main *bmain, const double /* motionSampleTime
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+void USDMeshReader::prefetch_object_data(const double motionSampleTime)
 {
   Mesh *mesh = (Mesh *)object_->data;
 
+  /* Only the object's own mesh is accessed here, so this is safe to run in parallel. */
   is_initial_load_ = true;
-  Mesh *read_mesh = this->read_mesh(
+  prefetched_mesh_ = this->read_mesh(
       mesh, motionSampleTime, import_params_.mesh_read_flag, nullptr);
-
+  prefetched_mesh_is_owned_ = prefetched_mesh_ != mesh;
   is_initial_load_ = false;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  if (prefetched_mesh_ == nullptr) {
+    prefetch_object_data(motionSampleTime);
+  }
+  Mesh *read_mesh = prefetched_mesh_;
+  prefetched_mesh_ = nullptr;
+  prefetched_mesh_is_owned_ = false;
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
@@ -696,12 +720,15 @@ void USDMeshReader::read_mesh_sample(ImportSettings *settings,
 
   if (new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_VERT) != 0) {
     MutableSpan<MVert> verts = mesh->verts_for_write();
-    for (int i = 0; i < positions_.size(); i++) {
-      MVert &mvert = verts[i];
-      mvert.co[0] = positions_[i][0];
-      mvert.co[1] = positions_[i][1];
-      mvert.co[2] = positions_[i][2];
-    }
+    const Span<pxr::GfVec3f> positions(positions_.cdata(), positions_.size());
+    threading::parallel_for(positions.index_range(), 8192, [&](const IndexRange range) {
+      for (const int i : range) {
+        MVert &mvert = verts[i];
+        mvert.co[0] = positions[i][0];
+        mvert.co[1] = positions[i][1];
+        mvert.co[2] = positions[i][2];
+      }
+    });
     BKE_mesh_tag_coords_changed(mesh);
 
     read_vertex_creases(mesh, motionSampleTime);
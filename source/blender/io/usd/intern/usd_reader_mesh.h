@@ -38,14 +38,21 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_;
 
+  /** Geometry read by #prefetch_object_data, consumed by #read_object_data. */
+  Mesh *prefetched_mesh_ = nullptr;
+  /** The prefetched mesh is a new mesh outside of #Main, rather than the object's mesh. */
+  bool prefetched_mesh_is_owned_ = false;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
                 const ImportSettings &settings);
+  ~USDMeshReader() override;
 
   bool valid() const override;
 
   void create_object(Main *bmain, double motionSampleTime) override;
+  void prefetch_object_data(double motionSampleTime) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
 
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
@@ -89,6 +89,11 @@ class USDPrimReader {
   virtual bool valid() const;
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
+  /**
+   * Read the prim data that does not need access to #Main (e.g. mesh geometry) ahead of
+   * #read_object_data. This may be called for many readers in parallel.
+   */
+  virtual void prefetch_object_data(double /* motionSampleTime */){};
   virtual void read_object_data(Main * /* bmain */, double /* motionSampleTime */){};
 
   Object *object() const;
@@ -49,7 +49,14 @@ void USDGenericMeshWriter::do_write(HierarchyContext &context)
 {
   Object *object_eval = context.object;
   bool needsfree = false;
-  Mesh *mesh = get_export_mesh(object_eval, needsfree);
+  Mesh *mesh = nullptr;
+  if (context.is_geometry_instance() && GS(context.object_data->name) == ID_ME) {
+    /* Geometry instances share the instancer as object, the instanced mesh is the data. */
+    mesh = reinterpret_cast<Mesh *>(context.object_data);
+  }
+  else {
+    mesh = get_export_mesh(object_eval, needsfree);
+  }
 
   if (mesh == nullptr) {
     return;
@@ -104,6 +111,8 @@ struct USDMeshData {
   pxr::VtFloatArray corner_sharpnesses;
 };
 
+static void get_face_groups(const Mesh *mesh, USDMeshData &usd_mesh_data);
+
 void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_mesh)
 {
   pxr::UsdTimeCode timecode = get_export_time_code();
@@ -150,7 +159,6 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   write_visibility(context, timecode, usd_mesh);
 
   USDMeshData usd_mesh_data;
-  get_geometry_data(mesh, usd_mesh_data);
 
   if (usd_export_context_.export_params.use_instancing && context.is_instance()) {
     if (!mark_as_instance(context, usd_mesh.GetPrim())) {
@@ -162,12 +170,15 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
      * out of its own sub-tree. It does work when we override the material with exactly the same
      * path, though. */
     if (usd_export_context_.export_params.export_materials) {
+      get_face_groups(mesh, usd_mesh_data);
       assign_materials(context, usd_mesh, usd_mesh_data.face_groups);
     }
 
     return;
   }
 
+  get_geometry_data(mesh, usd_mesh_data);
+
   pxr::UsdAttribute attr_points = usd_mesh.CreatePointsAttr(pxr::VtValue(), true);
   pxr::UsdAttribute attr_face_vertex_counts = usd_mesh.CreateFaceVertexCountsAttr(pxr::VtValue(),
                                                                                   true);
@@ -255,7 +266,7 @@ static void get_vertices(const Mesh *mesh, USDMeshData &usd_mesh_data)
   }
 }
 
-static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
+static void get_face_groups(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
   /* Only construct face groups (a.k.a. geometry subsets) when we need them for material
    * assignments. */
@@ -268,6 +279,11 @@ static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
       usd_mesh_data.face_groups[indices_span[i]].push_back(i);
     }
   }
+}
+
+static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
+{
+  get_face_groups(mesh, usd_mesh_data);
 
   usd_mesh_data.face_vertex_counts.reserve(mesh->totpoly);
   usd_mesh_data.face_indices.reserve(mesh->totloop);
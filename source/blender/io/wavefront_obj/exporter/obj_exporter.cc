@@ -4,9 +4,12 @@
  * \ingroup obj
  */
 
+#include <condition_variable>
 #include <cstdio>
 #include <exception>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "BKE_scene.h"
 
@@ -188,6 +191,23 @@ static void write_mesh_objects(Vector<std::unique_ptr<OBJMesh>> exportable_as_me
     offsets.normal_offset += obj.tot_normal_indices();
   }
 
+  /* Object text buffers are written into the file by a separate thread, in order, as soon as
+   * they are ready. This overlaps the file I/O with formatting of the remaining objects, and
+   * releases the memory of each buffer early. */
+  FILE *f = obj_writer.get_outfile();
+  std::mutex finished_mutex;
+  std::condition_variable finished_cond;
+  std::vector<bool> finished(count, false);
+  std::thread buffer_writer([&]() {
+    for (size_t i = 0; i < count; i++) {
+      {
+        std::unique_lock<std::mutex> lock(finished_mutex);
+        finished_cond.wait(lock, [&]() { return bool(finished[i]); });
+      }
+      buffers[i].write_to_file(f);
+    }
+  });
+
   /* Parallel over meshes: main result writing. */
   blender::threading::parallel_for(IndexRange(count), 1, [&](IndexRange range) {
     for (const int i : range) {
@@ -226,14 +246,16 @@ static void write_mesh_objects(Vector<std::unique_ptr<OBJMesh>> exportable_as_me
       /* Nothing will need this object's data after this point, release
        * various arrays here. */
       obj.clear();
+
+      {
+        std::lock_guard<std::mutex> lock(finished_mutex);
+        finished[i] = true;
+      }
+      finished_cond.notify_one();
     }
   });
 
-  /* Write all the object text buffers into the output file. */
-  FILE *f = obj_writer.get_outfile();
-  for (auto &b : buffers) {
-    b.write_to_file(f);
-  }
+  buffer_writer.join();
 }
 
 /**
@@ -242,13 +264,20 @@ static void write_mesh_objects(Vector<std::unique_ptr<OBJMesh>> exportable_as_me
 static void write_nurbs_curve_objects(const Vector<std::unique_ptr<OBJCurve>> &exportable_as_nurbs,
                                       const OBJWriter &obj_writer)
 {
-  FormatHandler fh;
+  /* Curves only use relative vertex indices, so each one can be written into its own
+   * buffer independently of the others. */
+  std::vector<FormatHandler> buffers(exportable_as_nurbs.size());
   /* #OBJCurve doesn't have any dynamically allocated memory, so it's fine
    * to wait for #blender::Vector to clean the objects up. */
-  for (const std::unique_ptr<OBJCurve> &obj_curve : exportable_as_nurbs) {
-    obj_writer.write_nurbs_curve(fh, *obj_curve);
+  blender::threading::parallel_for(exportable_as_nurbs.index_range(), 1, [&](IndexRange range) {
+    for (const int i : range) {
+      obj_writer.write_nurbs_curve(buffers[i], *exportable_as_nurbs[i]);
+    }
+  });
+  FILE *f = obj_writer.get_outfile();
+  for (FormatHandler &fh : buffers) {
+    fh.write_to_file(f);
   }
-  fh.write_to_file(obj_writer.get_outfile());
 }
 
 void export_frame(Depsgraph *depsgraph, const OBJExportParams &export_params, const char *filepath)
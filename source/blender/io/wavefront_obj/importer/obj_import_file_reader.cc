@@ -8,6 +8,7 @@
 #include "BLI_math_color.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "obj_export_mtl.hh"
@@ -64,11 +65,13 @@ static Geometry *create_geometry(Geometry *const prev_geometry,
   return new_geometry();
 }
 
-static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+/**
+ * Parse the arguments of a `v` line.
+ * \return true when the position is followed by a valid `xyzrgb` color.
+ */
+static bool parse_vertex(const char *p, const char *end, float3 &r_vert, float3 &r_linear_color)
 {
-  float3 vert;
-  p = parse_floats(p, end, 0.0f, vert, 3);
-  r_global_vertices.vertices.append(vert);
+  p = parse_floats(p, end, 0.0f, r_vert, 3);
   /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
    * is followed by 3 more RGB color components. See
    * http://paulbourke.net/dataformats/obj/colour.html */
@@ -76,21 +79,27 @@ static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_gl
     float3 srgb;
     p = parse_floats(p, end, -1.0f, srgb, 3);
     if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
-      float3 linear;
-      srgb_to_linearrgb_v3_v3(linear, srgb);
-
-      auto &blocks = r_global_vertices.vertex_colors;
-      /* If we don't have vertex colors yet, or the previous vertex
-       * was without color, we need to start a new vertex colors block. */
-      if (blocks.is_empty() || (blocks.last().start_vertex_index + blocks.last().colors.size() !=
-                                r_global_vertices.vertices.size() - 1)) {
-        GlobalVertices::VertexColorsBlock block;
-        block.start_vertex_index = r_global_vertices.vertices.size() - 1;
-        blocks.append(block);
-      }
-      blocks.last().colors.append(linear);
+      srgb_to_linearrgb_v3_v3(r_linear_color, srgb);
+      return true;
     }
   }
+  return false;
+}
+
+static void geom_add_vertex_color(const int vertex_index,
+                                  const float3 &linear_color,
+                                  GlobalVertices &r_global_vertices)
+{
+  auto &blocks = r_global_vertices.vertex_colors;
+  /* If we don't have vertex colors yet, or the previous vertex
+   * was without color, we need to start a new vertex colors block. */
+  if (blocks.is_empty() ||
+      (blocks.last().start_vertex_index + blocks.last().colors.size() != vertex_index)) {
+    GlobalVertices::VertexColorsBlock block;
+    block.start_vertex_index = vertex_index;
+    blocks.append(block);
+  }
+  blocks.last().colors.append(linear_color);
 }
 
 static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices &r_global_vertices)
@@ -132,9 +141,7 @@ static void geom_add_mrgb_colors(const char *p, const char *end, GlobalVertices
   }
 }
 
-static void geom_add_vertex_normal(const char *p,
-                                   const char *end,
-                                   GlobalVertices &r_global_vertices)
+static float3 parse_vertex_normal(const char *p, const char *end)
 {
   float3 normal;
   parse_floats(p, end, 0.0f, normal, 3);
@@ -142,14 +149,14 @@ static void geom_add_vertex_normal(const char *p,
    * making them ever-so-slightly non unit length. Make sure they are
    * normalized. */
   normalize_v3(normal);
-  r_global_vertices.vertex_normals.append(normal);
+  return normal;
 }
 
-static void geom_add_uv_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+static float2 parse_uv_vertex(const char *p, const char *end)
 {
   float2 uv;
   parse_floats(p, end, 0.0f, uv, 2);
-  r_global_vertices.uv_vertices.append(uv);
+  return uv;
 }
 
 static void geom_add_edge(Geometry *geom,
@@ -363,7 +370,7 @@ static void geom_update_smooth_group(const char *p, const char *end, bool &r_sta
   r_state_shaded_smooth = smooth != 0;
 }
 
-OBJParser::OBJParser(const OBJImportParams &import_params, size_t read_buffer_size = 64 * 1024)
+OBJParser::OBJParser(const OBJImportParams &import_params, size_t read_buffer_size)
     : import_params_(import_params), read_buffer_size_(read_buffer_size)
 {
   obj_file_ = BLI_fopen(import_params_.filepath, "rb");
@@ -399,6 +406,101 @@ static bool parse_keyword(const char *&p, const char *end, StringRef keyword)
   return true;
 }
 
+enum class VertexDataKind { None, Position, Normal, UV };
+
+static VertexDataKind parse_vertex_data_keyword(const char *&p, const char *end)
+{
+  if (p == end || *p != 'v') {
+    return VertexDataKind::None;
+  }
+  if (parse_keyword(p, end, "v")) {
+    return VertexDataKind::Position;
+  }
+  if (parse_keyword(p, end, "vn")) {
+    return VertexDataKind::Normal;
+  }
+  if (parse_keyword(p, end, "vt")) {
+    return VertexDataKind::UV;
+  }
+  return VertexDataKind::None;
+}
+
+/**
+ * Parse the consecutive lines holding the same kind of vertex data (`v`, `vn` or `vt`)
+ * at the start of \a r_buffer and remove them from it. These runs make up the bulk of
+ * large OBJ files; they are parsed in parallel and stored in file order.
+ *
+ * \return The number of lines consumed, zero when the next line is not vertex data.
+ */
+static int64_t geom_add_vertex_data_run(StringRef &r_buffer, GlobalVertices &r_global_vertices)
+{
+  /* Arguments of each line, with the keyword already skipped. */
+  Vector<StringRef> lines;
+  VertexDataKind run_kind = VertexDataKind::None;
+  while (!r_buffer.is_empty()) {
+    StringRef rest = r_buffer;
+    const StringRef line = read_next_line(rest);
+    const char *p = drop_whitespace(line.begin(), line.end());
+    const VertexDataKind kind = parse_vertex_data_keyword(p, line.end());
+    if (kind == VertexDataKind::None || (!lines.is_empty() && kind != run_kind)) {
+      break;
+    }
+    run_kind = kind;
+    lines.append(StringRef(p, line.end()));
+    r_buffer = rest;
+  }
+
+  const int64_t grain_size = 2048;
+  switch (run_kind) {
+    case VertexDataKind::None:
+      break;
+    case VertexDataKind::Position: {
+      const int64_t start = r_global_vertices.vertices.size();
+      r_global_vertices.vertices.resize(start + lines.size());
+      MutableSpan<float3> verts = r_global_vertices.vertices.as_mutable_span().drop_front(start);
+      /* Negative components mark vertices without a color. */
+      Array<float3> colors(lines.size());
+      threading::parallel_for(lines.index_range(), grain_size, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          if (!parse_vertex(lines[i].begin(), lines[i].end(), verts[i], colors[i])) {
+            colors[i] = float3(-1.0f);
+          }
+        }
+      });
+      for (const int64_t i : lines.index_range()) {
+        if (colors[i].x >= 0.0f) {
+          geom_add_vertex_color(int(start + i), colors[i], r_global_vertices);
+        }
+      }
+      break;
+    }
+    case VertexDataKind::Normal: {
+      const int64_t start = r_global_vertices.vertex_normals.size();
+      r_global_vertices.vertex_normals.resize(start + lines.size());
+      MutableSpan<float3> normals =
+          r_global_vertices.vertex_normals.as_mutable_span().drop_front(start);
+      threading::parallel_for(lines.index_range(), grain_size, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          normals[i] = parse_vertex_normal(lines[i].begin(), lines[i].end());
+        }
+      });
+      break;
+    }
+    case VertexDataKind::UV: {
+      const int64_t start = r_global_vertices.uv_vertices.size();
+      r_global_vertices.uv_vertices.resize(start + lines.size());
+      MutableSpan<float2> uvs = r_global_vertices.uv_vertices.as_mutable_span().drop_front(start);
+      threading::parallel_for(lines.index_range(), grain_size, [&](const IndexRange range) {
+        for (const int64_t i : range) {
+          uvs[i] = parse_uv_vertex(lines[i].begin(), lines[i].end());
+        }
+      });
+      break;
+    }
+  }
+  return lines.size();
+}
+
 /* Special case: if there were no faces/edges in any geometries,
  * treat all the vertices as a point cloud. */
 static void use_all_vertices_if_no_faces(Geometry *geom,
@@ -490,6 +592,11 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
      * line by line. */
     StringRef buffer_str{buffer.data(), int64_t(last_nl)};
     while (!buffer_str.is_empty()) {
+      /* Most common things that start with 'v': vertices, normals, UVs. */
+      if (const int64_t vertex_lines = geom_add_vertex_data_run(buffer_str, r_global_vertices)) {
+        line_number += vertex_lines;
+        continue;
+      }
       StringRef line = read_next_line(buffer_str);
       const char *p = line.begin(), *end = line.end();
       p = drop_whitespace(p, end);
@@ -497,17 +604,9 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
       if (p == end) {
         continue;
       }
-      /* Most common things that start with 'v': vertices, normals, UVs. */
+      /* Vertex data was handled above; ignore other 'v' elements (e.g. `vp`). */
       if (*p == 'v') {
-        if (parse_keyword(p, end, "v")) {
-          geom_add_vertex(p, end, r_global_vertices);
-        }
-        else if (parse_keyword(p, end, "vn")) {
-          geom_add_vertex_normal(p, end, r_global_vertices);
-        }
-        else if (parse_keyword(p, end, "vt")) {
-          geom_add_uv_vertex(p, end, r_global_vertices);
-        }
+        /* Nothing to do. */
       }
       /* Faces. */
       else if (parse_keyword(p, end, "f")) {
@@ -19,6 +19,7 @@
 
 #include "BLI_math_vector.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 
 #include "IO_wavefront_obj.h"
 #include "importer_mesh_utils.hh"
@@ -42,6 +43,7 @@ Object *MeshFromGeometry::create_mesh(Main *bmain,
     ob_name = "Untitled";
   }
   fixup_invalid_faces();
+  calc_face_loop_offsets();
 
   /* Total explicitly imported edges, not the ones belonging the polygons to be created. */
   const int64_t tot_edges{mesh_geometry_.edges_.size()};
@@ -152,6 +154,18 @@ void MeshFromGeometry::fixup_invalid_faces()
   }
 }
 
+void MeshFromGeometry::calc_face_loop_offsets()
+{
+  const Span<PolyElem> faces = mesh_geometry_.face_elements_;
+  face_loop_offsets_.reinitialize(faces.size());
+  int tot_loop_idx = 0;
+  for (const int i : faces.index_range()) {
+    face_loop_offsets_[i] = tot_loop_idx;
+    tot_loop_idx += faces[i].corner_count_;
+  }
+  BLI_assert(tot_loop_idx == mesh_geometry_.total_loops_);
+}
+
 void MeshFromGeometry::create_vertices(Mesh *mesh)
 {
   MutableSpan<MVert> verts = mesh->verts_for_write();
@@ -187,43 +201,44 @@ void MeshFromGeometry::create_polys_loops(Mesh *mesh, bool use_vertex_groups)
       mesh->attributes_for_write().lookup_or_add_for_write_only_span<int>("material_index",
                                                                           ATTR_DOMAIN_FACE);
 
-  const int64_t tot_face_elems{mesh->totpoly};
-  int tot_loop_idx = 0;
-
-  for (int poly_idx = 0; poly_idx < tot_face_elems; ++poly_idx) {
-    const PolyElem &curr_face = mesh_geometry_.face_elements_[poly_idx];
-    if (curr_face.corner_count_ < 3) {
-      /* Don't add single vertex face, or edges. */
-      std::cerr << "Face with less than 3 vertices found, skipping." << std::endl;
-      continue;
-    }
-
-    MPoly &mpoly = polys[poly_idx];
-    mpoly.totloop = curr_face.corner_count_;
-    mpoly.loopstart = tot_loop_idx;
-    if (curr_face.shaded_smooth) {
-      mpoly.flag |= ME_SMOOTH;
-    }
-    material_indices.span[poly_idx] = curr_face.material_index;
-    /* Importing obj files without any materials would result in negative indices, which is not
-     * supported. */
-    if (material_indices.span[poly_idx] < 0) {
-      material_indices.span[poly_idx] = 0;
+  const Span<PolyElem> faces = mesh_geometry_.face_elements_;
+  const Span<PolyCorner> corners = mesh_geometry_.face_corners_;
+  const Map<int, int> &global_to_local = mesh_geometry_.global_to_local_vertices_;
+  BLI_assert(faces.size() == mesh->totpoly);
+
+  threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+    for (const int poly_idx : range) {
+      const PolyElem &curr_face = faces[poly_idx];
+      /* Faces with less than 3 vertices were removed by #fixup_invalid_faces. */
+      BLI_assert(curr_face.corner_count_ >= 3);
+
+      MPoly &mpoly = polys[poly_idx];
+      mpoly.totloop = curr_face.corner_count_;
+      mpoly.loopstart = face_loop_offsets_[poly_idx];
+      if (curr_face.shaded_smooth) {
+        mpoly.flag |= ME_SMOOTH;
+      }
+      /* Importing obj files without any materials would result in negative indices, which is
+       * not supported. */
+      material_indices.span[poly_idx] = std::max(curr_face.material_index, 0);
+
+      for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
+        const PolyCorner &curr_corner = corners[curr_face.start_index_ + idx];
+        MLoop &mloop = loops[mpoly.loopstart + idx];
+        mloop.v = global_to_local.lookup_default(curr_corner.vert_index, 0);
+      }
     }
-
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const PolyCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      MLoop &mloop = loops[tot_loop_idx];
-      tot_loop_idx++;
-      mloop.v = mesh_geometry_.global_to_local_vertices_.lookup_default(curr_corner.vert_index, 0);
-
-      /* Setup vertex group data, if needed. */
-      if (dverts.is_empty()) {
-        continue;
+  });
+
+  /* Setup vertex group data, if needed. Done serially, since faces share vertices. */
+  if (!dverts.is_empty()) {
+    for (const int poly_idx : faces.index_range()) {
+      const MPoly &mpoly = polys[poly_idx];
+      const int group_index = faces[poly_idx].vertex_group_index;
+      for (const MLoop &mloop : loops.slice(mpoly.loopstart, mpoly.totloop)) {
+        MDeformWeight *dw = BKE_defvert_ensure_index(&dverts[mloop.v], group_index);
+        dw->weight = 1.0f;
       }
-      const int group_index = curr_face.vertex_group_index;
-      MDeformWeight *dw = BKE_defvert_ensure_index(&dverts[mloop.v], group_index);
-      dw->weight = 1.0f;
     }
   }
 
@@ -268,20 +283,23 @@ void MeshFromGeometry::create_uv_verts(Mesh *mesh)
   }
   MLoopUV *mluv_dst = static_cast<MLoopUV *>(CustomData_add_layer(
       &mesh->ldata, CD_MLOOPUV, CD_SET_DEFAULT, nullptr, mesh_geometry_.total_loops_));
-  int tot_loop_idx = 0;
-
-  for (const PolyElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const PolyCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      const int uv_index = curr_corner.uv_vert_index;
-      float2 uv(0, 0);
-      if (uv_index >= 0 && uv_index < global_vertices_.uv_vertices.size()) {
-        uv = global_vertices_.uv_vertices[uv_index];
+  const Span<PolyElem> faces = mesh_geometry_.face_elements_;
+  threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+    for (const int face_idx : range) {
+      const PolyElem &curr_face = faces[face_idx];
+      const int loop_start = face_loop_offsets_[face_idx];
+      for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
+        const PolyCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        const int uv_index = curr_corner.uv_vert_index;
+        float2 uv(0, 0);
+        if (uv_index >= 0 && uv_index < global_vertices_.uv_vertices.size()) {
+          uv = global_vertices_.uv_vertices[uv_index];
+        }
+        copy_v2_v2(mluv_dst[loop_start + idx].uv, uv);
       }
-      copy_v2_v2(mluv_dst[tot_loop_idx].uv, uv);
-      tot_loop_idx++;
     }
-  }
+  });
 }
 
 static Material *get_or_create_material(Main *bmain,
@@ -344,19 +362,23 @@ void MeshFromGeometry::create_normals(Mesh *mesh)
 
   float(*loop_normals)[3] = static_cast<float(*)[3]>(
       MEM_malloc_arrayN(mesh_geometry_.total_loops_, sizeof(float[3]), __func__));
-  int tot_loop_idx = 0;
-  for (const PolyElem &curr_face : mesh_geometry_.face_elements_) {
-    for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
-      const PolyCorner &curr_corner = mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
-      int n_index = curr_corner.vertex_normal_index;
-      float3 normal(0, 0, 0);
-      if (n_index >= 0) {
-        normal = global_vertices_.vertex_normals[n_index];
+  const Span<PolyElem> faces = mesh_geometry_.face_elements_;
+  threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+    for (const int face_idx : range) {
+      const PolyElem &curr_face = faces[face_idx];
+      const int loop_start = face_loop_offsets_[face_idx];
+      for (int idx = 0; idx < curr_face.corner_count_; ++idx) {
+        const PolyCorner &curr_corner =
+            mesh_geometry_.face_corners_[curr_face.start_index_ + idx];
+        int n_index = curr_corner.vertex_normal_index;
+        float3 normal(0, 0, 0);
+        if (n_index >= 0) {
+          normal = global_vertices_.vertex_normals[n_index];
+        }
+        copy_v3_v3(loop_normals[loop_start + idx], normal);
       }
-      copy_v3_v3(loop_normals[tot_loop_idx], normal);
-      tot_loop_idx++;
     }
-  }
+  });
   mesh->flag |= ME_AUTOSMOOTH;
   BKE_mesh_set_custom_normals(mesh, loop_normals);
   MEM_freeN(loop_normals);
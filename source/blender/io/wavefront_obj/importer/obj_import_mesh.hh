@@ -8,6 +8,7 @@
 
 #include "BKE_lib_id.h"
 
+#include "BLI_array.hh"
 #include "BLI_utility_mixins.hh"
 
 #include "obj_import_mtl.hh"
@@ -24,6 +25,8 @@ class MeshFromGeometry : NonMovable, NonCopyable {
  private:
   Geometry &mesh_geometry_;
   const GlobalVertices &global_vertices_;
+  /** Index of the first loop of every face element, computed after fixing up invalid faces. */
+  Array<int> face_loop_offsets_;
 
  public:
   MeshFromGeometry(Geometry &mesh_geometry, const GlobalVertices &global_vertices)
@@ -43,6 +46,11 @@ class MeshFromGeometry : NonMovable, NonCopyable {
    * polygons with holes). This method tries to fix them up.
    */
   void fixup_invalid_faces();
+  /**
+   * Compute the first loop index of every face, so that per-loop data can be filled in
+   * for many faces in parallel.
+   */
+  void calc_face_loop_offsets();
   void create_vertices(Mesh *mesh);
   /**
    * Create polygons for the Mesh, set smooth shading flags, Materials.
@@ -46,6 +46,11 @@ typedef struct CustomDataLayer {
    * automatically.
    */
   const struct AnonymousAttributeID *anonymous_id;
+  /**
+   * Run-time reference counted owner of the layer data, when it is shared with other layers. The
+   * data must not be modified while it is shared, see #CustomData_duplicate_referenced_layer.
+   */
+  struct CustomDataLayerSharing *sharing;
 } CustomDataLayer;
 
 #define MAX_CUSTOMDATA_LAYER_NAME 64
@@ -122,6 +122,24 @@ void *DNA_struct_reconstruct(const struct DNA_ReconstructInfo *reconstruct_info,
                              int old_struct_nr,
                              int blocks,
                              const void *old_blocks);
+/**
+ * \return The size of a single reconstructed element of \a old_struct_nr,
+ * zero when the struct doesn't exist anymore.
+ */
+int DNA_struct_reconstruct_block_size(const struct DNA_ReconstructInfo *reconstruct_info,
+                                      int old_struct_nr);
+/**
+ * Same as #DNA_struct_reconstruct, but converts the elements in the range
+ * `[block_start, block_start + blocks)` of \a old_blocks into the zero-initialized
+ * \a new_blocks array, which is allocated by the caller. This is thread-safe, so large arrays
+ * can be split up in chunks that are converted in parallel.
+ */
+void DNA_struct_reconstruct_range(const struct DNA_ReconstructInfo *reconstruct_info,
+                                  int old_struct_nr,
+                                  int block_start,
+                                  int blocks,
+                                  const void *old_blocks,
+                                  void *new_blocks);
 
 /**
  * Returns the offset of the field with the specified name and type within the specified
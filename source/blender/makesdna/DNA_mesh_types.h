@@ -26,6 +26,7 @@ struct MeshRuntime;
 class AttributeAccessor;
 class MutableAttributeAccessor;
 struct LooseEdgeCache;
+struct VertToElemMap;
 }  // namespace bke
 }  // namespace blender
 using MeshRuntimeHandle = blender::bke::MeshRuntime;
@@ -276,6 +277,15 @@ typedef struct Mesh {
    */
   void loose_edges_tag_none() const;
 
+  /**
+   * Cached map from every vertex to the edges that use it, sorted by edge index.
+   */
+  const blender::bke::VertToElemMap &vert_to_edge_map() const;
+  /**
+   * Cached map from every vertex to the face corners that use it, sorted by corner index.
+   */
+  const blender::bke::VertToElemMap &vert_to_loop_map() const;
+
   /**
    * Normal direction of every polygon, which is defined by the winding direction of its corners.
    */
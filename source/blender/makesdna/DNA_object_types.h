@@ -217,7 +217,19 @@ typedef struct Object_Runtime {
   float (*crazyspace_deform_cos)[3];
   int crazyspace_verts_num;
 
-  int _pad3[3];
+  int _pad3;
+
+  /**
+   * Hash of the inputs that were used to evaluate `data_eval`, zero when unknown. Used to keep the
+   * evaluated geometry when the depsgraph re-evaluates it without any of these inputs changing.
+   */
+  uint64_t geometry_eval_inputs_hash;
+
+  /**
+   * Changes whenever the evaluated geometry is computed again, zero when it was never evaluated.
+   * Used by caches that depend on the geometry, because it may be re-created at the same address.
+   */
+  uint64_t geometry_eval_version;
 } Object_Runtime;
 
 typedef struct ObjectLineArt {
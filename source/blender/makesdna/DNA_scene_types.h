@@ -2034,7 +2034,7 @@ typedef struct Scene {
 #define R_SIMPLIFY (1 << 24)
 #define R_EDGE_FRS (1 << 25)        /* R_EDGE reserved for Freestyle */
 #define R_PERSISTENT_DATA (1 << 26) /* Keep data around for re-render. */
-#define R_MODE_UNUSED_27 (1 << 27)  /* cleared */
+#define R_ASYNC_WRITE (1 << 27)     /* Write frames while the next one renders. */
 
 /** #RenderData.seq_flag */
 enum {
@@ -2412,6 +2412,7 @@ enum {
   FFMPEG_AUTOSPLIT_OUTPUT = (1 << 1),
   FFMPEG_LOSSLESS_OUTPUT = (1 << 2),
   FFMPEG_USE_MAX_B_FRAMES = (1 << 3),
+  FFMPEG_USE_HW_ENCODER = (1 << 4),
 };
 
 /** #Paint.flags */
@@ -1542,6 +1542,7 @@ typedef enum eSpaceNodeOverlay_Flag {
   SN_OVERLAY_SHOW_TIMINGS = (1 << 3),
   SN_OVERLAY_SHOW_PATH = (1 << 4),
   SN_OVERLAY_SHOW_NAMED_ATTRIBUTES = (1 << 5),
+  SN_OVERLAY_SHOW_MEMORY = (1 << 6),
 } eSpaceNodeOverlay_Flag;
 
 typedef struct SpaceNode {
@@ -1613,7 +1614,8 @@ typedef enum eSpaceNode_Flag {
   SNODE_SHOW_G = (1 << 8),
   SNODE_SHOW_B = (1 << 9),
   SNODE_AUTO_RENDER = (1 << 5),
-  SNODE_FLAG_UNUSED_6 = (1 << 6),   /* cleared */
+  /** Only composite the part of the viewer image that is visible in the backdrop. */
+  SNODE_BACKDRAW_VISIBLE_REGION = (1 << 6),
   SNODE_FLAG_UNUSED_10 = (1 << 10), /* cleared */
   SNODE_FLAG_UNUSED_11 = (1 << 11), /* cleared */
   SNODE_PIN = (1 << 12),
@@ -653,7 +653,8 @@ typedef struct UserDef_Experimental {
   char enable_eevee_next;
   char use_sculpt_texture_paint;
   char use_realtime_compositor;
-  char _pad0[7];
+  char use_sequencer_gpu_compositing;
+  char _pad0[6];
   /** `makesdna` does not allow empty structs. */
 } UserDef_Experimental;
 
@@ -934,7 +935,7 @@ typedef struct UserDef {
 
   float collection_instance_empty_size;
   char text_flag;
-  char _pad10[1];
+  char video_flag; /* eUserpref_VideoFlag */
 
   char file_preview_type; /* eUserpref_File_Preview_Type */
   char statusbar_flag;    /* eUserpref_StatusBar_Flag */
@@ -1394,6 +1395,11 @@ typedef enum eUserpref_SeqProxySetup {
   USER_SEQ_PROXY_SETUP_AUTOMATIC = 1,
 } eUserpref_SeqProxySetup;
 
+/** #UserDef.video_flag */
+typedef enum eUserpref_VideoFlag {
+  USER_VIDEO_HARDWARE_DECODE = (1 << 0),
+} eUserpref_VideoFlag;
+
 /* Locale Ids. Auto will try to get local from OS. Our default is English though. */
 /** #UserDef.language */
 enum {
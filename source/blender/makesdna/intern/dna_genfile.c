@@ -1120,6 +1120,8 @@ typedef struct DNA_ReconstructInfo {
 
   int *step_counts;
   ReconstructStep **steps;
+  /** Index into `newsdna->structs` for every struct in `oldsdna`, -1 if it doesn't exist. */
+  int *new_struct_nrs;
 } DNA_ReconstructInfo;
 
 static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
@@ -1216,24 +1218,48 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
                              int blocks,
                              const void *old_blocks)
 {
-  const SDNA *oldsdna = reconstruct_info->oldsdna;
-  const SDNA *newsdna = reconstruct_info->newsdna;
+  const int new_block_size = DNA_struct_reconstruct_block_size(reconstruct_info, old_struct_nr);
+  if (new_block_size == 0) {
+    return NULL;
+  }
 
-  const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
-  const char *type_name = oldsdna->types[old_struct->type];
-  const int new_struct_nr = DNA_struct_find_nr(newsdna, type_name);
+  char *new_blocks = MEM_callocN((size_t)blocks * (size_t)new_block_size, "reconstruct");
+  DNA_struct_reconstruct_range(reconstruct_info, old_struct_nr, 0, blocks, old_blocks, new_blocks);
+  return new_blocks;
+}
 
+int DNA_struct_reconstruct_block_size(const DNA_ReconstructInfo *reconstruct_info,
+                                      int old_struct_nr)
+{
+  const int new_struct_nr = reconstruct_info->new_struct_nrs[old_struct_nr];
   if (new_struct_nr == -1) {
-    return NULL;
+    return 0;
   }
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  return newsdna->types_size[newsdna->structs[new_struct_nr]->type];
+}
 
-  const SDNA_Struct *new_struct = newsdna->structs[new_struct_nr];
-  const int new_block_size = newsdna->types_size[new_struct->type];
+void DNA_struct_reconstruct_range(const DNA_ReconstructInfo *reconstruct_info,
+                                  int old_struct_nr,
+                                  int block_start,
+                                  int blocks,
+                                  const void *old_blocks,
+                                  void *new_blocks)
+{
+  const int new_struct_nr = reconstruct_info->new_struct_nrs[old_struct_nr];
+  BLI_assert(new_struct_nr != -1);
 
-  char *new_blocks = MEM_callocN(blocks * new_block_size, "reconstruct");
-  reconstruct_structs(
-      reconstruct_info, blocks, old_struct_nr, new_struct_nr, old_blocks, new_blocks);
-  return new_blocks;
+  const SDNA *oldsdna = reconstruct_info->oldsdna;
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  const size_t old_block_size = oldsdna->types_size[oldsdna->structs[old_struct_nr]->type];
+  const size_t new_block_size = newsdna->types_size[newsdna->structs[new_struct_nr]->type];
+
+  reconstruct_structs(reconstruct_info,
+                      blocks,
+                      old_struct_nr,
+                      new_struct_nr,
+                      (const char *)old_blocks + (size_t)block_start * old_block_size,
+                      (char *)new_blocks + (size_t)block_start * new_block_size);
 }
 
 /** Finds a member in the given struct with the given name. */
@@ -1519,6 +1545,16 @@ DNA_ReconstructInfo *DNA_reconstruct_info_create(const SDNA *oldsdna,
   reconstruct_info->step_counts = MEM_malloc_arrayN(newsdna->structs_len, sizeof(int), __func__);
   reconstruct_info->steps = MEM_malloc_arrayN(
       newsdna->structs_len, sizeof(ReconstructStep *), __func__);
+  reconstruct_info->new_struct_nrs = MEM_malloc_arrayN(
+      oldsdna->structs_len, sizeof(int), __func__);
+
+  /* Resolve the new struct of every old one once, #DNA_struct_reconstruct is called for every
+   * block that has to be converted. */
+  for (int old_struct_nr = 0; old_struct_nr < oldsdna->structs_len; old_struct_nr++) {
+    const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
+    reconstruct_info->new_struct_nrs[old_struct_nr] = DNA_struct_find_nr(
+        newsdna, oldsdna->types[old_struct->type]);
+  }
 
   /* Generate reconstruct steps for all structs. */
   for (int new_struct_nr = 0; new_struct_nr < newsdna->structs_len; new_struct_nr++) {
@@ -1564,6 +1600,7 @@ void DNA_reconstruct_info_free(DNA_ReconstructInfo *reconstruct_info)
   }
   MEM_freeN(reconstruct_info->steps);
   MEM_freeN(reconstruct_info->step_counts);
+  MEM_freeN(reconstruct_info->new_struct_nrs);
   MEM_freeN(reconstruct_info);
 }
 
@@ -4416,6 +4416,17 @@ static int rna_raw_access(ReportList *reports,
 
         size = RNA_raw_type_sizeof(out.type) * arraylen;
 
+        /* Contiguous items (e.g. generic attributes), copy all of them at once. */
+        if (out.stride == size) {
+          if (set) {
+            memcpy(outp, inp, (size_t)size * (size_t)out.len);
+          }
+          else {
+            memcpy(inp, outp, (size_t)size * (size_t)out.len);
+          }
+          return 1;
+        }
+
         for (a = 0; a < out.len; a++) {
           if (set) {
             memcpy(outp, inp, size);
@@ -4431,8 +4442,30 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching raw types, convert the values directly instead of
+       * accessing every item through RNA (e.g. a double buffer for float values).
+       * All raw types can be represented by a double without loss. */
+      if (out.type != PROP_RAW_UNSET) {
+        RawArray out_item = out;
+        int a, j, index = 0;
+
+        for (a = 0; a < out.len; a++) {
+          for (j = 0; j < arraylen; j++, index++) {
+            double value;
+            if (set) {
+              RAW_GET(double, value, in, index);
+              RAW_SET(double, out_item, j, value);
+            }
+            else {
+              RAW_GET(double, value, out_item, j);
+              RAW_SET(double, in, index, value);
+            }
+          }
+          out_item.array = (char *)out_item.array + out.stride;
+        }
+
+        return 1;
+      }
     }
   }
 
@@ -266,6 +266,26 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_timeline_begin(Depsgraph *depsgraph)
+{
+  DEG_debug_timeline_begin(depsgraph);
+}
+
+static void rna_Depsgraph_debug_timeline_end(Depsgraph *depsgraph)
+{
+  DEG_debug_timeline_end(depsgraph);
+}
+
+static void rna_Depsgraph_debug_timeline_chrome_trace(Depsgraph *depsgraph, const char *filename)
+{
+  FILE *f = fopen(filename, "w");
+  if (f == NULL) {
+    return;
+  }
+  DEG_debug_timeline_chrome_trace(depsgraph, f);
+  fclose(f);
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -708,6 +728,21 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_timeline_begin", "rna_Depsgraph_debug_timeline_begin");
+  RNA_def_function_ui_description(
+      func, "Begin recording the timeline of evaluated operations, discarding a previous one");
+
+  func = RNA_def_function(srna, "debug_timeline_end", "rna_Depsgraph_debug_timeline_end");
+  RNA_def_function_ui_description(func, "Stop recording the timeline of evaluated operations");
+
+  func = RNA_def_function(
+      srna, "debug_timeline_chrome_trace", "rna_Depsgraph_debug_timeline_chrome_trace");
+  RNA_def_function_ui_description(
+      func, "Write the recorded timeline of evaluated operations in Chrome trace format");
+  parm = RNA_def_string_file_path(
+      func, "filename", NULL, FILE_MAX, "File Name", "Output path for the trace file");
+  RNA_def_parameter_flags(parm, 0, PARM_REQUIRED);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
@@ -50,6 +50,13 @@ static void rna_Mesh_create_normals_split(Mesh *mesh)
   }
 }
 
+static void rna_Mesh_calc_normals_split(Mesh *mesh)
+{
+  /* The sharp flags and custom normals may have been changed without tagging the mesh. */
+  BKE_mesh_tag_sharpness_changed(mesh);
+  BKE_mesh_calc_normals_split(mesh);
+}
+
 static void rna_Mesh_free_normals_split(Mesh *mesh)
 {
   CustomData_free_layers(&mesh->ldata, CD_NORMAL, mesh->totloop);
@@ -71,7 +78,7 @@ static void rna_Mesh_calc_tangents(Mesh *mesh, ReportList *reports, const char *
 
   /* Compute loop normals if needed. */
   if (!CustomData_has_layer(&mesh->ldata, CD_NORMAL)) {
-    BKE_mesh_calc_normals_split(mesh);
+    rna_Mesh_calc_normals_split(mesh);
   }
 
   BKE_mesh_calc_loop_tangent_single(mesh, uvmap, r_looptangents, reports);
@@ -225,7 +232,7 @@ void RNA_api_mesh(StructRNA *srna)
   func = RNA_def_function(srna, "create_normals_split", "rna_Mesh_create_normals_split");
   RNA_def_function_ui_description(func, "Empty split vertex normals");
 
-  func = RNA_def_function(srna, "calc_normals_split", "BKE_mesh_calc_normals_split");
+  func = RNA_def_function(srna, "calc_normals_split", "rna_Mesh_calc_normals_split");
   RNA_def_function_ui_description(func,
                                   "Calculate split vertex normals, which preserve sharp edges");
 
@@ -130,6 +130,12 @@ static const EnumPropertyItem rna_enum_execution_mode_items[] = {
      0,
      "Full Frame",
      "Composites full image result as fast as possible"},
+    {NTREE_EXECUTION_MODE_GPU,
+     "GPU",
+     0,
+     "GPU",
+     "Use the realtime compositor for final renders, falling back to Full Frame when the node "
+     "tree uses nodes that are not supported on the GPU"},
     {0, NULL, 0, NULL, NULL},
 };
 
@@ -7314,6 +7314,13 @@ static void rna_def_space_node_overlay(BlenderRNA *brna)
   RNA_def_property_ui_text(prop, "Show Timing", "Display each node's last execution time");
   RNA_def_property_update(prop, NC_SPACE | ND_SPACE_NODE, NULL);
 
+  prop = RNA_def_property(srna, "show_memory", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "overlay.flag", SN_OVERLAY_SHOW_MEMORY);
+  RNA_def_property_boolean_default(prop, false);
+  RNA_def_property_ui_text(
+      prop, "Show Memory", "Display the size of the geometry output by each node");
+  RNA_def_property_update(prop, NC_SPACE | ND_SPACE_NODE, NULL);
+
   prop = RNA_def_property(srna, "show_context_path", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "overlay.flag", SN_OVERLAY_SHOW_PATH);
   RNA_def_property_boolean_default(prop, true);
@@ -7456,6 +7463,15 @@ static void rna_def_space_node(BlenderRNA *brna)
   RNA_def_property_update(
       prop, NC_SPACE | ND_SPACE_NODE_VIEW, "rna_SpaceNodeEditor_show_backdrop_update");
 
+  prop = RNA_def_property(srna, "use_backdrop_visible_region", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "flag", SNODE_BACKDRAW_VISIBLE_REGION);
+  RNA_def_property_ui_text(prop,
+                           "Visible Region Only",
+                           "Only compute the part of the Viewer Node output that is visible in "
+                           "the backdrop, the rest of the viewer image is not updated");
+  RNA_def_property_update(
+      prop, NC_SPACE | ND_SPACE_NODE_VIEW, "rna_SpaceNodeEditor_show_backdrop_update");
+
   prop = RNA_def_property(srna, "show_annotation", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "flag", SNODE_SHOW_GPENCIL);
   RNA_def_property_ui_text(prop, "Show Annotation", "Show annotations for this view");
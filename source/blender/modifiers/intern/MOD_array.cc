@@ -11,7 +11,10 @@
 
 #include "BLI_utildefines.h"
 
+#include "BLI_array.hh"
+#include "BLI_float4x4.hh"
 #include "BLI_math.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.h"
 
@@ -124,17 +127,49 @@ static int svert_sum_cmp(const void *e1, const void *e2)
   return 0;
 }
 
-static void svert_from_mvert(SortVertsElem *sv,
-                             const MVert *mv,
-                             const int i_begin,
-                             const int i_end)
+BLI_INLINE bool point_in_bounds_v3(const float co[3], const float min[3], const float max[3])
 {
-  int i;
-  for (i = i_begin; i < i_end; i++, sv++, mv++) {
+  return (co[0] >= min[0] && co[1] >= min[1] && co[2] >= min[2] && co[0] <= max[0] &&
+          co[1] <= max[1] && co[2] <= max[2]);
+}
+
+/**
+ * Only add the vertices within the bounds, the others can't have a double in the other set.
+ * Returns the number of added vertices.
+ */
+static int svert_from_mvert(SortVertsElem *sv,
+                            const MVert *mv,
+                            const int i_begin,
+                            const int i_end,
+                            const float bounds_min[3],
+                            const float bounds_max[3])
+{
+  int i, sv_num = 0;
+  for (i = i_begin; i < i_end; i++, mv++) {
+    if (!point_in_bounds_v3(mv->co, bounds_min, bounds_max)) {
+      continue;
+    }
     sv->vertex_num = i;
     copy_v3_v3(sv->co, mv->co);
     sv->sum_co = sum_v3(mv->co);
+    sv++;
+    sv_num++;
   }
+  return sv_num;
+}
+
+static void mvert_bounds_with_margin(const MVert *mv,
+                                     const int verts_num,
+                                     const float margin,
+                                     float r_min[3],
+                                     float r_max[3])
+{
+  INIT_MINMAX(r_min, r_max);
+  for (int i = 0; i < verts_num; i++) {
+    minmax_v3v3_v3(r_min, r_max, mv[i].co);
+  }
+  add_v3_fl(r_min, -margin);
+  add_v3_fl(r_max, margin);
 }
 
 /**
@@ -147,9 +182,9 @@ static void svert_from_mvert(SortVertsElem *sv,
 static void dm_mvert_map_doubles(int *doubles_map,
                                  const MVert *mverts,
                                  const int target_start,
-                                 const int target_verts_num,
+                                 int target_verts_num,
                                  const int source_start,
-                                 const int source_verts_num,
+                                 int source_verts_num,
                                  const float dist)
 {
   const float dist3 = (float(M_SQRT3) + 0.00005f) * dist; /* Just above sqrt(3) */
@@ -160,6 +195,13 @@ static void dm_mvert_map_doubles(int *doubles_map,
   target_end = target_start + target_verts_num;
   source_end = source_start + source_verts_num;
 
+  /* Usually only a small part of both sets overlaps (the seam between two copies), so only the
+   * vertices within range of the bounds of the other set have to be sorted and tested. Vertices
+   * that are skipped keep their -1 mapping, like when no double is found for them. */
+  float target_min[3], target_max[3], source_min[3], source_max[3];
+  mvert_bounds_with_margin(mverts + target_start, target_verts_num, dist, target_min, target_max);
+  mvert_bounds_with_margin(mverts + source_start, source_verts_num, dist, source_min, source_max);
+
   /* build array of MVerts to be tested for merging */
   SortVertsElem *sorted_verts_target = static_cast<SortVertsElem *>(
       MEM_malloc_arrayN(target_verts_num, sizeof(SortVertsElem), __func__));
@@ -167,10 +209,20 @@ static void dm_mvert_map_doubles(int *doubles_map,
       MEM_malloc_arrayN(source_verts_num, sizeof(SortVertsElem), __func__));
 
   /* Copy target vertices index and cos into SortVertsElem array */
-  svert_from_mvert(sorted_verts_target, mverts + target_start, target_start, target_end);
+  target_verts_num = svert_from_mvert(sorted_verts_target,
+                                      mverts + target_start,
+                                      target_start,
+                                      target_end,
+                                      source_min,
+                                      source_max);
 
   /* Copy source vertices index and cos into SortVertsElem array */
-  svert_from_mvert(sorted_verts_source, mverts + source_start, source_start, source_end);
+  source_verts_num = svert_from_mvert(sorted_verts_source,
+                                      mverts + source_start,
+                                      source_start,
+                                      source_end,
+                                      target_min,
+                                      target_max);
 
   /* sort arrays according to sum of vertex coordinates (sumco) */
   qsort(sorted_verts_target, target_verts_num, sizeof(SortVertsElem), svert_sum_cmp);
@@ -357,9 +409,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
                                    const ModifierEvalContext *ctx,
                                    const Mesh *mesh)
 {
-  MEdge *me;
-  MLoop *ml;
-  MPoly *mp;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
@@ -585,50 +634,68 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
     BKE_mesh_vertex_normals_clear_dirty(result);
   }
 
+  /* The cumulative offset of every copy, so that the copies can be created independently. */
+  blender::Array<blender::float4x4> chunk_offsets(count);
+  chunk_offsets[0] = blender::float4x4::identity();
   for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
-
-    const int vert_offset = c * chunk_nverts;
-
-    /* recalculate cumulative offset here */
-    mul_m4_m4m4(current_offset, current_offset, offset);
-
-    /* apply offset to all new verts */
-    for (i = 0; i < chunk_nverts; i++) {
-      const int i_dst = vert_offset + i;
-      mul_m4_v3(current_offset, result_verts[i_dst].co);
-
-      /* We have to correct normals too, if we do not tag them as dirty! */
-      if (!use_recalc_normals) {
-        copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[i]);
-        mul_mat3_m4_v3(current_offset, dst_vert_normals[i_dst]);
-        normalize_v3(dst_vert_normals[i_dst]);
-      }
-    }
+    mul_m4_m4m4(chunk_offsets[c].ptr(), chunk_offsets[c - 1].ptr(), offset);
+  }
+  copy_m4_m4(current_offset, chunk_offsets[count - 1].ptr());
+
+  /* Create the copies in parallel, each copy only writes to its own part of the result. */
+  const int chunk_size = chunk_nverts + chunk_nedges + chunk_nloops + chunk_npolys;
+  const int64_t chunks_per_task = std::max(1, 4096 / std::max(chunk_size, 1));
+  blender::threading::parallel_for(
+      blender::IndexRange(1, count - 1), chunks_per_task, [&](const blender::IndexRange range) {
+        for (const int64_t chunk : range) {
+          const int c = int(chunk);
+          const float(*chunk_offset)[4] = chunk_offsets[c].ptr();
+
+          /* copy customdata to new geometry */
+          CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
+          CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
+          CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
+          CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
+
+          const int vert_offset = c * chunk_nverts;
+
+          /* apply offset to all new verts */
+          for (int i = 0; i < chunk_nverts; i++) {
+            const int i_dst = vert_offset + i;
+            mul_m4_v3(chunk_offset, result_verts[i_dst].co);
+
+            /* We have to correct normals too, if we do not tag them as dirty! */
+            if (!use_recalc_normals) {
+              copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[i]);
+              mul_mat3_m4_v3(chunk_offset, dst_vert_normals[i_dst]);
+              normalize_v3(dst_vert_normals[i_dst]);
+            }
+          }
 
-    /* adjust edge vertex indices */
-    me = result_edges + c * chunk_nedges;
-    for (i = 0; i < chunk_nedges; i++, me++) {
-      me->v1 += c * chunk_nverts;
-      me->v2 += c * chunk_nverts;
-    }
+          /* adjust edge vertex indices */
+          MEdge *me = result_edges + c * chunk_nedges;
+          for (int i = 0; i < chunk_nedges; i++, me++) {
+            me->v1 += c * chunk_nverts;
+            me->v2 += c * chunk_nverts;
+          }
 
-    mp = result_polys + c * chunk_npolys;
-    for (i = 0; i < chunk_npolys; i++, mp++) {
-      mp->loopstart += c * chunk_nloops;
-    }
+          MPoly *mp = result_polys + c * chunk_npolys;
+          for (int i = 0; i < chunk_npolys; i++, mp++) {
+            mp->loopstart += c * chunk_nloops;
+          }
 
-    /* adjust loop vertex and edge indices */
-    ml = result_loops + c * chunk_nloops;
-    for (i = 0; i < chunk_nloops; i++, ml++) {
-      ml->v += c * chunk_nverts;
-      ml->e += c * chunk_nedges;
-    }
+          /* adjust loop vertex and edge indices */
+          MLoop *ml = result_loops + c * chunk_nloops;
+          for (int i = 0; i < chunk_nloops; i++, ml++) {
+            ml->v += c * chunk_nverts;
+            ml->e += c * chunk_nedges;
+          }
+        }
+      });
 
+  /* The merge of every copy with the previous one depends on the mapping of the previous copy,
+   * so it can't be done in the loop above. */
+  for (c = 1; c < count; c++) {
     /* Handle merge between chunk n and n-1 */
     if (use_merge && (c >= 1)) {
       if (!offset_has_scale && (c >= 2)) {
@@ -675,18 +742,22 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
     for (i = 0; i < totuv; i++) {
       MLoopUV *dmloopuv = static_cast<MLoopUV *>(
           CustomData_get_layer_n(&result->ldata, CD_MLOOPUV, i));
-      dmloopuv += chunk_nloops;
-      for (c = 1; c < count; c++) {
-        const float uv_offset[2] = {
-            amd->uv_offset[0] * float(c),
-            amd->uv_offset[1] * float(c),
-        };
-        int l_index = chunk_nloops;
-        for (; l_index-- != 0; dmloopuv++) {
-          dmloopuv->uv[0] += uv_offset[0];
-          dmloopuv->uv[1] += uv_offset[1];
-        }
-      }
+      blender::threading::parallel_for(
+          blender::IndexRange(1, count - 1),
+          std::max(1, 4096 / chunk_nloops),
+          [&](const blender::IndexRange range) {
+            for (const int64_t chunk : range) {
+              const float uv_offset[2] = {
+                  amd->uv_offset[0] * float(chunk),
+                  amd->uv_offset[1] * float(chunk),
+              };
+              MLoopUV *chunk_uvs = dmloopuv + chunk * chunk_nloops;
+              for (int l_index = 0; l_index < chunk_nloops; l_index++) {
+                chunk_uvs[l_index].uv[0] += uv_offset[0];
+                chunk_uvs[l_index].uv[1] += uv_offset[1];
+              }
+            }
+          });
     }
   }
 
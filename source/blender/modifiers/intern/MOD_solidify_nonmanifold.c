@@ -7,6 +7,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -129,6 +130,557 @@ static int comp_float_int_pair(const void *a, const void *b)
   return (int)(x->angle > y->angle) - (int)(x->angle < y->angle);
 }
 
+typedef struct SolidifyEdgeGroupCoData {
+  const SolidifyModifierData *smd;
+  EdgeGroup **orig_vert_groups_arr;
+  const float (*orig_mvert_co)[3];
+  const MEdge *orig_medge;
+  const MLoop *orig_mloop;
+  const uint *vm;
+  const float (*poly_nors)[3];
+  const bool *null_faces;
+  const float *face_weight;
+  const float *orig_edge_lengths;
+  const MDeformVert *dvert;
+  int defgrp_index;
+  bool defgrp_invert;
+  bool do_flat_faces;
+  bool do_clamp;
+  bool do_angle_clamp;
+  float ofs_front_clamped;
+  float ofs_back_clamped;
+  float offset;
+  float offset_fac_vg;
+  float offset_fac_vg_inv;
+} SolidifyEdgeGroupCoData;
+
+/**
+ * Calculate the new coordinates of the edge groups of one original vertex. Every vertex only
+ * writes to its own edge groups, so this runs in parallel over all vertices.
+ */
+static void solidify_edge_group_co_task_cb(void *__restrict userdata,
+                                           const int vert_index,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const SolidifyEdgeGroupCoData *data = userdata;
+  const SolidifyModifierData *smd = data->smd;
+  const float(*orig_mvert_co)[3] = data->orig_mvert_co;
+  const MEdge *orig_medge = data->orig_medge;
+  const MLoop *orig_mloop = data->orig_mloop;
+  const uint *vm = data->vm;
+  const float(*poly_nors)[3] = data->poly_nors;
+  const bool *null_faces = data->null_faces;
+  const float *face_weight = data->face_weight;
+  const float *orig_edge_lengths = data->orig_edge_lengths;
+  const MDeformVert *dvert = data->dvert;
+  const int defgrp_index = data->defgrp_index;
+  const bool defgrp_invert = data->defgrp_invert;
+  const bool do_flat_faces = data->do_flat_faces;
+  const bool do_clamp = data->do_clamp;
+  const bool do_angle_clamp = data->do_angle_clamp;
+  const float ofs_front_clamped = data->ofs_front_clamped;
+  const float ofs_back_clamped = data->ofs_back_clamped;
+  const float offset = data->offset;
+  const float offset_fac_vg = data->offset_fac_vg;
+  const float offset_fac_vg_inv = data->offset_fac_vg_inv;
+  const uint i = (uint)vert_index;
+
+  EdgeGroup *g = data->orig_vert_groups_arr[i];
+  if (g == NULL) {
+    return;
+  }
+  for (uint j = 0; g->valid; j++, g++) {
+    if (!g->is_singularity) {
+      float *nor = g->no;
+      /* During vertex position calculation, the algorithm decides if it wants to disable the
+       * boundary fix to maintain correct thickness. If the used algorithm does not produce a
+       * free move direction (move_nor), it can use approximate_free_direction to decide on
+       * a movement direction based on the connected edges. */
+      float move_nor[3] = {0, 0, 0};
+      bool disable_boundary_fix = (smd->nonmanifold_boundary_mode ==
+                                       MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_NONE ||
+                                   (g->is_orig_closed || g->split));
+      bool approximate_free_direction = false;
+      /* Constraints Method. */
+      if (smd->nonmanifold_offset_mode == MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_CONSTRAINTS) {
+        NewEdgeRef *first_edge = NULL;
+        NewEdgeRef **edge_ptr = g->edges;
+        /* Contains normal and offset [nx, ny, nz, ofs].
+         * Most vertices have a low valence, avoid an allocation for them. */
+        float planes_queue_stack[16][4];
+        float(*planes_queue)[4] = planes_queue_stack;
+        if (g->edges_len + 1 > ARRAY_SIZE(planes_queue_stack)) {
+          planes_queue = MEM_malloc_arrayN(
+              g->edges_len + 1, sizeof(*planes_queue), "planes_queue in solidify");
+        }
+        uint queue_index = 0;
+
+        float fallback_nor[3];
+        float fallback_ofs = 0.0f;
+
+        const bool cycle = (g->is_orig_closed && !g->split) || g->is_even_split;
+        for (uint k = 0; k < g->edges_len; k++, edge_ptr++) {
+          if (!(k & 1) || (!cycle && k == g->edges_len - 1)) {
+            NewEdgeRef *edge = *edge_ptr;
+            for (uint l = 0; l < 2; l++) {
+              NewFaceRef *face = edge->faces[l];
+              if (face && (first_edge == NULL ||
+                           (first_edge->faces[0] != face && first_edge->faces[1] != face))) {
+                float ofs = face->reversed ? ofs_back_clamped : ofs_front_clamped;
+                /* Use face_weight here to make faces thinner. */
+                if (do_flat_faces) {
+                  ofs *= face_weight[face->index];
+                }
+
+                if (!null_faces[face->index]) {
+                  /* And plane to the queue. */
+                  mul_v3_v3fl(planes_queue[queue_index],
+                              poly_nors[face->index],
+                              face->reversed ? -1 : 1);
+                  planes_queue[queue_index++][3] = ofs;
+                }
+                else {
+                  /* Just use this approximate normal of the null face if there is no other
+                   * normal to use. */
+                  mul_v3_v3fl(fallback_nor, poly_nors[face->index], face->reversed ? -1 : 1);
+                  fallback_ofs = ofs;
+                }
+              }
+            }
+            if ((cycle && k == 0) || (!cycle && k + 3 >= g->edges_len)) {
+              first_edge = edge;
+            }
+          }
+        }
+        if (queue_index > 2) {
+          /* Find the two most different normals. */
+          float min_p = 2.0f;
+          uint min_n0 = 0;
+          uint min_n1 = 0;
+          for (uint k = 0; k < queue_index; k++) {
+            for (uint m = k + 1; m < queue_index; m++) {
+              float p = dot_v3v3(planes_queue[k], planes_queue[m]);
+              if (p < min_p) {
+                min_p = p;
+                min_n0 = k;
+                min_n1 = m;
+              }
+            }
+          }
+          /* Put the two found normals, first in the array queue. */
+          if (min_n1 != 0) {
+            swap_v4_v4(planes_queue[min_n0], planes_queue[0]);
+            swap_v4_v4(planes_queue[min_n1], planes_queue[1]);
+          }
+          else {
+            swap_v4_v4(planes_queue[min_n0], planes_queue[1]);
+          }
+          /* Find the third most important/different normal. */
+          min_p = 1.0f;
+          min_n1 = 2;
+          float max_p = -1.0f;
+          for (uint k = 2; k < queue_index; k++) {
+            max_p = max_ff(dot_v3v3(planes_queue[0], planes_queue[k]),
+                           dot_v3v3(planes_queue[1], planes_queue[k]));
+            if (max_p <= min_p) {
+              min_p = max_p;
+              min_n1 = k;
+            }
+          }
+          swap_v4_v4(planes_queue[min_n1], planes_queue[2]);
+        }
+        /* Remove/average duplicate normals in planes_queue. */
+        while (queue_index > 2) {
+          uint best_n0 = 0;
+          uint best_n1 = 0;
+          float best_p = -1.0f;
+          float best_ofs_diff = 0.0f;
+          for (uint k = 0; k < queue_index; k++) {
+            for (uint m = k + 1; m < queue_index; m++) {
+              float p = dot_v3v3(planes_queue[m], planes_queue[k]);
+              float ofs_diff = fabsf(planes_queue[m][3] - planes_queue[k][3]);
+              if (p > best_p + FLT_EPSILON || (p >= best_p && ofs_diff < best_ofs_diff)) {
+                best_p = p;
+                best_ofs_diff = ofs_diff;
+                best_n0 = k;
+                best_n1 = m;
+              }
+            }
+          }
+          /* Make sure there are no equal planes. This threshold is crucial for the
+           * methods below to work without numerical issues. */
+          if (best_p < 0.98f) {
+            break;
+          }
+          add_v3_v3(planes_queue[best_n0], planes_queue[best_n1]);
+          normalize_v3(planes_queue[best_n0]);
+          planes_queue[best_n0][3] = (planes_queue[best_n0][3] + planes_queue[best_n1][3]) * 0.5f;
+          queue_index--;
+          memmove(planes_queue + best_n1,
+                  planes_queue + best_n1 + 1,
+                  (queue_index - best_n1) * sizeof(*planes_queue));
+        }
+        const uint size = queue_index;
+        /* If there is more than 2 planes at this vertex, the boundary fix should be disabled
+         * to stay at the correct thickness for all the faces. This is not very good in
+         * practice though, since that will almost always disable the boundary fix. Instead
+         * introduce a threshold which decides whether the boundary fix can be used without
+         * major thickness changes. If the following constant is 1.0, it would always
+         * prioritize correct thickness. At 0.7 the thickness is allowed to change a bit if
+         * necessary for the fix (~10%). Note this only applies if a boundary fix is used. */
+        const float boundary_fix_threshold = 0.7f;
+        if (size > 3) {
+          /* Use the most general least squares method to find the best position. */
+          float mat[3][3];
+          zero_m3(mat);
+          for (int k = 0; k < 3; k++) {
+            for (int m = 0; m < size; m++) {
+              madd_v3_v3fl(mat[k], planes_queue[m], planes_queue[m][k]);
+            }
+            /* Add a small epsilon to ensure the invert is going to work.
+             * This addition makes the inverse more stable and the results
+             * seem to get more precise. */
+            mat[k][k] += 5e-5f;
+          }
+          /* NOTE: this matrix invert fails if there is less than 3 different normals. */
+          invert_m3(mat);
+          zero_v3(nor);
+          for (int k = 0; k < size; k++) {
+            madd_v3_v3fl(nor, planes_queue[k], planes_queue[k][3]);
+          }
+          mul_v3_m3v3(nor, mat, nor);
+
+          if (!disable_boundary_fix) {
+            /* Figure out if the approximate boundary fix can get use here. */
+            float greatest_angle_cos = 1.0f;
+            for (uint k = 0; k < 2; k++) {
+              for (uint m = 2; m < size; m++) {
+                float p = dot_v3v3(planes_queue[m], planes_queue[k]);
+                if (p < greatest_angle_cos) {
+                  greatest_angle_cos = p;
+                }
+              }
+            }
+            if (greatest_angle_cos > boundary_fix_threshold) {
+              approximate_free_direction = true;
+            }
+            else {
+              disable_boundary_fix = true;
+            }
+          }
+        }
+        else if (size > 1) {
+          /* When up to 3 constraint normals are found, there is a simple solution. */
+          const float stop_explosion = 0.999f - fabsf(smd->offset_fac) * 0.05f;
+          const float q = dot_v3v3(planes_queue[0], planes_queue[1]);
+          float d = 1.0f - q * q;
+          cross_v3_v3v3(move_nor, planes_queue[0], planes_queue[1]);
+          normalize_v3(move_nor);
+          if (d > FLT_EPSILON * 10 && q < stop_explosion) {
+            d = 1.0f / d;
+            mul_v3_fl(planes_queue[0], (planes_queue[0][3] - planes_queue[1][3] * q) * d);
+            mul_v3_fl(planes_queue[1], (planes_queue[1][3] - planes_queue[0][3] * q) * d);
+          }
+          else {
+            d = 1.0f / (fabsf(q) + 1.0f);
+            mul_v3_fl(planes_queue[0], planes_queue[0][3] * d);
+            mul_v3_fl(planes_queue[1], planes_queue[1][3] * d);
+          }
+          add_v3_v3v3(nor, planes_queue[0], planes_queue[1]);
+          if (size == 3) {
+            d = dot_v3v3(planes_queue[2], move_nor);
+            /* The following threshold ignores the third plane if it is almost orthogonal to
+             * the still free direction. */
+            if (fabsf(d) > 0.02f) {
+              float tmp[3];
+              madd_v3_v3v3fl(tmp, nor, planes_queue[2], -planes_queue[2][3]);
+              mul_v3_v3fl(tmp, move_nor, dot_v3v3(planes_queue[2], tmp) / d);
+              sub_v3_v3(nor, tmp);
+              /* Disable boundary fix if the constraints would be majorly unsatisfied. */
+              if (fabsf(d) > 1.0f - boundary_fix_threshold) {
+                disable_boundary_fix = true;
+              }
+            }
+          }
+          approximate_free_direction = false;
+        }
+        else if (size == 1) {
+          /* Face corner case. */
+          mul_v3_v3fl(nor, planes_queue[0], planes_queue[0][3]);
+          if (g->edges_len > 2) {
+            disable_boundary_fix = true;
+            approximate_free_direction = true;
+          }
+        }
+        else {
+          /* Fallback case for null faces. */
+          mul_v3_v3fl(nor, fallback_nor, fallback_ofs);
+          disable_boundary_fix = true;
+        }
+        if (planes_queue != planes_queue_stack) {
+          MEM_freeN(planes_queue);
+        }
+      }
+      /* Fixed/Even Method. */
+      else {
+        float total_angle = 0;
+        float total_angle_back = 0;
+        NewEdgeRef *first_edge = NULL;
+        NewEdgeRef **edge_ptr = g->edges;
+        float face_nor[3];
+        float nor_back[3] = {0, 0, 0};
+        bool has_back = false;
+        bool has_front = false;
+        bool cycle = (g->is_orig_closed && !g->split) || g->is_even_split;
+        for (uint k = 0; k < g->edges_len; k++, edge_ptr++) {
+          if (!(k & 1) || (!cycle && k == g->edges_len - 1)) {
+            NewEdgeRef *edge = *edge_ptr;
+            for (uint l = 0; l < 2; l++) {
+              NewFaceRef *face = edge->faces[l];
+              if (face && (first_edge == NULL ||
+                           (first_edge->faces[0] != face && first_edge->faces[1] != face))) {
+                float angle = 1.0f;
+                float ofs = face->reversed ? -ofs_back_clamped : ofs_front_clamped;
+                /* Use face_weight here to make faces thinner. */
+                if (do_flat_faces) {
+                  ofs *= face_weight[face->index];
+                }
+
+                if (smd->nonmanifold_offset_mode == MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_EVEN) {
+                  const MLoop *ml_next = orig_mloop + face->face->loopstart;
+                  const MLoop *ml = ml_next + (face->face->totloop - 1);
+                  const MLoop *ml_prev = ml - 1;
+                  for (int m = 0; m < face->face->totloop && vm[ml->v] != i;
+                       m++, ml_next++) {
+                    ml_prev = ml;
+                    ml = ml_next;
+                  }
+                  angle = angle_v3v3v3(orig_mvert_co[vm[ml_prev->v]],
+                                       orig_mvert_co[i],
+                                       orig_mvert_co[vm[ml_next->v]]);
+                  if (face->reversed) {
+                    total_angle_back += angle * ofs * ofs;
+                  }
+                  else {
+                    total_angle += angle * ofs * ofs;
+                  }
+                }
+                else {
+                  if (face->reversed) {
+                    total_angle_back++;
+                  }
+                  else {
+                    total_angle++;
+                  }
+                }
+                mul_v3_v3fl(face_nor, poly_nors[face->index], angle * ofs);
+                if (face->reversed) {
+                  add_v3_v3(nor_back, face_nor);
+                  has_back = true;
+                }
+                else {
+                  add_v3_v3(nor, face_nor);
+                  has_front = true;
+                }
+              }
+            }
+            if ((cycle && k == 0) || (!cycle && k + 3 >= g->edges_len)) {
+              first_edge = edge;
+            }
+          }
+        }
+
+        /* Set normal length with selected method. */
+        if (smd->nonmanifold_offset_mode == MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_EVEN) {
+          if (has_front) {
+            float length_sq = len_squared_v3(nor);
+            if (LIKELY(length_sq > FLT_EPSILON)) {
+              mul_v3_fl(nor, total_angle / length_sq);
+            }
+          }
+          if (has_back) {
+            float length_sq = len_squared_v3(nor_back);
+            if (LIKELY(length_sq > FLT_EPSILON)) {
+              mul_v3_fl(nor_back, total_angle_back / length_sq);
+            }
+            if (!has_front) {
+              copy_v3_v3(nor, nor_back);
+            }
+          }
+          if (has_front && has_back) {
+            float nor_length = len_v3(nor);
+            float nor_back_length = len_v3(nor_back);
+            float q = dot_v3v3(nor, nor_back);
+            if (LIKELY(fabsf(q) > FLT_EPSILON)) {
+              q /= nor_length * nor_back_length;
+            }
+            float d = 1.0f - q * q;
+            if (LIKELY(d > FLT_EPSILON)) {
+              d = 1.0f / d;
+              if (LIKELY(nor_length > FLT_EPSILON)) {
+                mul_v3_fl(nor, (1 - nor_back_length * q / nor_length) * d);
+              }
+              if (LIKELY(nor_back_length > FLT_EPSILON)) {
+                mul_v3_fl(nor_back, (1 - nor_length * q / nor_back_length) * d);
+              }
+              add_v3_v3(nor, nor_back);
+            }
+            else {
+              mul_v3_fl(nor, 0.5f);
+              mul_v3_fl(nor_back, 0.5f);
+              add_v3_v3(nor, nor_back);
+            }
+          }
+        }
+        else {
+          if (has_front && total_angle > FLT_EPSILON) {
+            mul_v3_fl(nor, 1.0f / total_angle);
+          }
+          if (has_back && total_angle_back > FLT_EPSILON) {
+            mul_v3_fl(nor_back, 1.0f / total_angle_back);
+            add_v3_v3(nor, nor_back);
+            if (has_front && total_angle > FLT_EPSILON) {
+              mul_v3_fl(nor, 0.5f);
+            }
+          }
+        }
+        /* Set move_nor for boundary fix. */
+        if (!disable_boundary_fix && g->edges_len > 2) {
+          approximate_free_direction = true;
+        }
+        else {
+          disable_boundary_fix = true;
+        }
+      }
+      if (approximate_free_direction) {
+        /* Set move_nor for boundary fix. */
+        NewEdgeRef **edge_ptr = g->edges + 1;
+        float tmp[3];
+        int k;
+        for (k = 1; k + 1 < g->edges_len; k++, edge_ptr++) {
+          const MEdge *e = orig_medge + (*edge_ptr)->old_edge;
+          sub_v3_v3v3(tmp, orig_mvert_co[vm[e->v1] == i ? e->v2 : e->v1], orig_mvert_co[i]);
+          add_v3_v3(move_nor, tmp);
+        }
+        if (k == 1) {
+          disable_boundary_fix = true;
+        }
+        else {
+          disable_boundary_fix = normalize_v3(move_nor) == 0.0f;
+        }
+      }
+      /* Fix boundary verts. */
+      if (!disable_boundary_fix) {
+        /* Constraint normal, nor * constr_nor == 0 after this fix. */
+        float constr_nor[3];
+        const MEdge *e0_edge = orig_medge + g->edges[0]->old_edge;
+        const MEdge *e1_edge = orig_medge + g->edges[g->edges_len - 1]->old_edge;
+        float e0[3];
+        float e1[3];
+        sub_v3_v3v3(e0,
+                    orig_mvert_co[vm[e0_edge->v1] == i ? e0_edge->v2 : e0_edge->v1],
+                    orig_mvert_co[i]);
+        sub_v3_v3v3(e1,
+                    orig_mvert_co[vm[e1_edge->v1] == i ? e1_edge->v2 : e1_edge->v1],
+                    orig_mvert_co[i]);
+        if (smd->nonmanifold_boundary_mode == MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_FLAT) {
+          cross_v3_v3v3(constr_nor, e0, e1);
+          normalize_v3(constr_nor);
+        }
+        else {
+          BLI_assert(smd->nonmanifold_boundary_mode ==
+                     MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_ROUND);
+          float f0[3];
+          float f1[3];
+          if (g->edges[0]->faces[0]->reversed) {
+            negate_v3_v3(f0, poly_nors[g->edges[0]->faces[0]->index]);
+          }
+          else {
+            copy_v3_v3(f0, poly_nors[g->edges[0]->faces[0]->index]);
+          }
+          if (g->edges[g->edges_len - 1]->faces[0]->reversed) {
+            negate_v3_v3(f1, poly_nors[g->edges[g->edges_len - 1]->faces[0]->index]);
+          }
+          else {
+            copy_v3_v3(f1, poly_nors[g->edges[g->edges_len - 1]->faces[0]->index]);
+          }
+          float n0[3];
+          float n1[3];
+          cross_v3_v3v3(n0, e0, f0);
+          cross_v3_v3v3(n1, f1, e1);
+          normalize_v3(n0);
+          normalize_v3(n1);
+          add_v3_v3v3(constr_nor, n0, n1);
+          normalize_v3(constr_nor);
+        }
+        float d = dot_v3v3(constr_nor, move_nor);
+        /* Only allow the thickness to increase about 10 times. */
+        if (fabsf(d) > 0.1f) {
+          mul_v3_fl(move_nor, dot_v3v3(constr_nor, nor) / d);
+          sub_v3_v3(nor, move_nor);
+        }
+      }
+      float scalar_vgroup = 1;
+      /* Use vertex group. */
+      if (dvert && !do_flat_faces) {
+        const MDeformVert *dv = &dvert[i];
+        if (defgrp_invert) {
+          scalar_vgroup = 1.0f - BKE_defvert_find_weight(dv, defgrp_index);
+        }
+        else {
+          scalar_vgroup = BKE_defvert_find_weight(dv, defgrp_index);
+        }
+        scalar_vgroup = offset_fac_vg + (scalar_vgroup * offset_fac_vg_inv);
+      }
+      /* Do clamping. */
+      if (do_clamp) {
+        if (do_angle_clamp) {
+          if (g->edges_len > 2) {
+            float min_length = 0;
+            float angle = 0.5f * M_PI;
+            uint k = 0;
+            for (NewEdgeRef **p = g->edges; k < g->edges_len; k++, p++) {
+              float length = orig_edge_lengths[(*p)->old_edge];
+              float e_ang = (*p)->angle;
+              if (e_ang > angle) {
+                angle = e_ang;
+              }
+              if (length < min_length || k == 0) {
+                min_length = length;
+              }
+            }
+            float cos_ang = cosf(angle * 0.5f);
+            if (cos_ang > 0) {
+              float max_off = min_length * 0.5f / cos_ang;
+              if (max_off < offset * 0.5f) {
+                scalar_vgroup *= max_off / offset * 2;
+              }
+            }
+          }
+        }
+        else {
+          float min_length = 0;
+          uint k = 0;
+          for (NewEdgeRef **p = g->edges; k < g->edges_len; k++, p++) {
+            float length = orig_edge_lengths[(*p)->old_edge];
+            if (length < min_length || k == 0) {
+              min_length = length;
+            }
+          }
+          if (min_length < offset) {
+            scalar_vgroup *= min_length / offset;
+          }
+        }
+      }
+      mul_v3_fl(nor, scalar_vgroup);
+      add_v3_v3v3(g->co, nor, orig_mvert_co[i]);
+    }
+    else {
+      copy_v3_v3(g->co, orig_mvert_co[i]);
+    }
+  }
+}
+
 /* NOLINTNEXTLINE: readability-function-size */
 Mesh *MOD_solidify_nonmanifold_modifyMesh(ModifierData *md,
                                           const ModifierEvalContext *ctx,
@@ -1398,498 +1950,33 @@ Mesh *MOD_solidify_nonmanifold_modifyMesh(ModifierData *md,
       }
     }
 
-    const MVert *mv = orig_mvert;
-    gs_ptr = orig_vert_groups_arr;
-    for (uint i = 0; i < verts_num; i++, mv++, gs_ptr++) {
-      if (*gs_ptr) {
-        EdgeGroup *g = *gs_ptr;
-        for (uint j = 0; g->valid; j++, g++) {
-          if (!g->is_singularity) {
-            float *nor = g->no;
-            /* During vertex position calculation, the algorithm decides if it wants to disable the
-             * boundary fix to maintain correct thickness. If the used algorithm does not produce a
-             * free move direction (move_nor), it can use approximate_free_direction to decide on
-             * a movement direction based on the connected edges. */
-            float move_nor[3] = {0, 0, 0};
-            bool disable_boundary_fix = (smd->nonmanifold_boundary_mode ==
-                                             MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_NONE ||
-                                         (g->is_orig_closed || g->split));
-            bool approximate_free_direction = false;
-            /* Constraints Method. */
-            if (smd->nonmanifold_offset_mode == MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_CONSTRAINTS) {
-              NewEdgeRef *first_edge = NULL;
-              NewEdgeRef **edge_ptr = g->edges;
-              /* Contains normal and offset [nx, ny, nz, ofs]. */
-              float(*planes_queue)[4] = MEM_malloc_arrayN(
-                  g->edges_len + 1, sizeof(*planes_queue), "planes_queue in solidify");
-              uint queue_index = 0;
-
-              float fallback_nor[3];
-              float fallback_ofs = 0.0f;
-
-              const bool cycle = (g->is_orig_closed && !g->split) || g->is_even_split;
-              for (uint k = 0; k < g->edges_len; k++, edge_ptr++) {
-                if (!(k & 1) || (!cycle && k == g->edges_len - 1)) {
-                  NewEdgeRef *edge = *edge_ptr;
-                  for (uint l = 0; l < 2; l++) {
-                    NewFaceRef *face = edge->faces[l];
-                    if (face && (first_edge == NULL ||
-                                 (first_edge->faces[0] != face && first_edge->faces[1] != face))) {
-                      float ofs = face->reversed ? ofs_back_clamped : ofs_front_clamped;
-                      /* Use face_weight here to make faces thinner. */
-                      if (do_flat_faces) {
-                        ofs *= face_weight[face->index];
-                      }
-
-                      if (!null_faces[face->index]) {
-                        /* And plane to the queue. */
-                        mul_v3_v3fl(planes_queue[queue_index],
-                                    poly_nors[face->index],
-                                    face->reversed ? -1 : 1);
-                        planes_queue[queue_index++][3] = ofs;
-                      }
-                      else {
-                        /* Just use this approximate normal of the null face if there is no other
-                         * normal to use. */
-                        mul_v3_v3fl(fallback_nor, poly_nors[face->index], face->reversed ? -1 : 1);
-                        fallback_ofs = ofs;
-                      }
-                    }
-                  }
-                  if ((cycle && k == 0) || (!cycle && k + 3 >= g->edges_len)) {
-                    first_edge = edge;
-                  }
-                }
-              }
-              if (queue_index > 2) {
-                /* Find the two most different normals. */
-                float min_p = 2.0f;
-                uint min_n0 = 0;
-                uint min_n1 = 0;
-                for (uint k = 0; k < queue_index; k++) {
-                  for (uint m = k + 1; m < queue_index; m++) {
-                    float p = dot_v3v3(planes_queue[k], planes_queue[m]);
-                    if (p < min_p) {
-                      min_p = p;
-                      min_n0 = k;
-                      min_n1 = m;
-                    }
-                  }
-                }
-                /* Put the two found normals, first in the array queue. */
-                if (min_n1 != 0) {
-                  swap_v4_v4(planes_queue[min_n0], planes_queue[0]);
-                  swap_v4_v4(planes_queue[min_n1], planes_queue[1]);
-                }
-                else {
-                  swap_v4_v4(planes_queue[min_n0], planes_queue[1]);
-                }
-                /* Find the third most important/different normal. */
-                min_p = 1.0f;
-                min_n1 = 2;
-                float max_p = -1.0f;
-                for (uint k = 2; k < queue_index; k++) {
-                  max_p = max_ff(dot_v3v3(planes_queue[0], planes_queue[k]),
-                                 dot_v3v3(planes_queue[1], planes_queue[k]));
-                  if (max_p <= min_p) {
-                    min_p = max_p;
-                    min_n1 = k;
-                  }
-                }
-                swap_v4_v4(planes_queue[min_n1], planes_queue[2]);
-              }
-              /* Remove/average duplicate normals in planes_queue. */
-              while (queue_index > 2) {
-                uint best_n0 = 0;
-                uint best_n1 = 0;
-                float best_p = -1.0f;
-                float best_ofs_diff = 0.0f;
-                for (uint k = 0; k < queue_index; k++) {
-                  for (uint m = k + 1; m < queue_index; m++) {
-                    float p = dot_v3v3(planes_queue[m], planes_queue[k]);
-                    float ofs_diff = fabsf(planes_queue[m][3] - planes_queue[k][3]);
-                    if (p > best_p + FLT_EPSILON || (p >= best_p && ofs_diff < best_ofs_diff)) {
-                      best_p = p;
-                      best_ofs_diff = ofs_diff;
-                      best_n0 = k;
-                      best_n1 = m;
-                    }
-                  }
-                }
-                /* Make sure there are no equal planes. This threshold is crucial for the
-                 * methods below to work without numerical issues. */
-                if (best_p < 0.98f) {
-                  break;
-                }
-                add_v3_v3(planes_queue[best_n0], planes_queue[best_n1]);
-                normalize_v3(planes_queue[best_n0]);
-                planes_queue[best_n0][3] = (planes_queue[best_n0][3] + planes_queue[best_n1][3]) *
-                                           0.5f;
-                queue_index--;
-                memmove(planes_queue + best_n1,
-                        planes_queue + best_n1 + 1,
-                        (queue_index - best_n1) * sizeof(*planes_queue));
-              }
-              const uint size = queue_index;
-              /* If there is more than 2 planes at this vertex, the boundary fix should be disabled
-               * to stay at the correct thickness for all the faces. This is not very good in
-               * practice though, since that will almost always disable the boundary fix. Instead
-               * introduce a threshold which decides whether the boundary fix can be used without
-               * major thickness changes. If the following constant is 1.0, it would always
-               * prioritize correct thickness. At 0.7 the thickness is allowed to change a bit if
-               * necessary for the fix (~10%). Note this only applies if a boundary fix is used. */
-              const float boundary_fix_threshold = 0.7f;
-              if (size > 3) {
-                /* Use the most general least squares method to find the best position. */
-                float mat[3][3];
-                zero_m3(mat);
-                for (int k = 0; k < 3; k++) {
-                  for (int m = 0; m < size; m++) {
-                    madd_v3_v3fl(mat[k], planes_queue[m], planes_queue[m][k]);
-                  }
-                  /* Add a small epsilon to ensure the invert is going to work.
-                   * This addition makes the inverse more stable and the results
-                   * seem to get more precise. */
-                  mat[k][k] += 5e-5f;
-                }
-                /* NOTE: this matrix invert fails if there is less than 3 different normals. */
-                invert_m3(mat);
-                zero_v3(nor);
-                for (int k = 0; k < size; k++) {
-                  madd_v3_v3fl(nor, planes_queue[k], planes_queue[k][3]);
-                }
-                mul_v3_m3v3(nor, mat, nor);
-
-                if (!disable_boundary_fix) {
-                  /* Figure out if the approximate boundary fix can get use here. */
-                  float greatest_angle_cos = 1.0f;
-                  for (uint k = 0; k < 2; k++) {
-                    for (uint m = 2; m < size; m++) {
-                      float p = dot_v3v3(planes_queue[m], planes_queue[k]);
-                      if (p < greatest_angle_cos) {
-                        greatest_angle_cos = p;
-                      }
-                    }
-                  }
-                  if (greatest_angle_cos > boundary_fix_threshold) {
-                    approximate_free_direction = true;
-                  }
-                  else {
-                    disable_boundary_fix = true;
-                  }
-                }
-              }
-              else if (size > 1) {
-                /* When up to 3 constraint normals are found, there is a simple solution. */
-                const float stop_explosion = 0.999f - fabsf(smd->offset_fac) * 0.05f;
-                const float q = dot_v3v3(planes_queue[0], planes_queue[1]);
-                float d = 1.0f - q * q;
-                cross_v3_v3v3(move_nor, planes_queue[0], planes_queue[1]);
-                normalize_v3(move_nor);
-                if (d > FLT_EPSILON * 10 && q < stop_explosion) {
-                  d = 1.0f / d;
-                  mul_v3_fl(planes_queue[0], (planes_queue[0][3] - planes_queue[1][3] * q) * d);
-                  mul_v3_fl(planes_queue[1], (planes_queue[1][3] - planes_queue[0][3] * q) * d);
-                }
-                else {
-                  d = 1.0f / (fabsf(q) + 1.0f);
-                  mul_v3_fl(planes_queue[0], planes_queue[0][3] * d);
-                  mul_v3_fl(planes_queue[1], planes_queue[1][3] * d);
-                }
-                add_v3_v3v3(nor, planes_queue[0], planes_queue[1]);
-                if (size == 3) {
-                  d = dot_v3v3(planes_queue[2], move_nor);
-                  /* The following threshold ignores the third plane if it is almost orthogonal to
-                   * the still free direction. */
-                  if (fabsf(d) > 0.02f) {
-                    float tmp[3];
-                    madd_v3_v3v3fl(tmp, nor, planes_queue[2], -planes_queue[2][3]);
-                    mul_v3_v3fl(tmp, move_nor, dot_v3v3(planes_queue[2], tmp) / d);
-                    sub_v3_v3(nor, tmp);
-                    /* Disable boundary fix if the constraints would be majorly unsatisfied. */
-                    if (fabsf(d) > 1.0f - boundary_fix_threshold) {
-                      disable_boundary_fix = true;
-                    }
-                  }
-                }
-                approximate_free_direction = false;
-              }
-              else if (size == 1) {
-                /* Face corner case. */
-                mul_v3_v3fl(nor, planes_queue[0], planes_queue[0][3]);
-                if (g->edges_len > 2) {
-                  disable_boundary_fix = true;
-                  approximate_free_direction = true;
-                }
-              }
-              else {
-                /* Fallback case for null faces. */
-                mul_v3_v3fl(nor, fallback_nor, fallback_ofs);
-                disable_boundary_fix = true;
-              }
-              MEM_freeN(planes_queue);
-            }
-            /* Fixed/Even Method. */
-            else {
-              float total_angle = 0;
-              float total_angle_back = 0;
-              NewEdgeRef *first_edge = NULL;
-              NewEdgeRef **edge_ptr = g->edges;
-              float face_nor[3];
-              float nor_back[3] = {0, 0, 0};
-              bool has_back = false;
-              bool has_front = false;
-              bool cycle = (g->is_orig_closed && !g->split) || g->is_even_split;
-              for (uint k = 0; k < g->edges_len; k++, edge_ptr++) {
-                if (!(k & 1) || (!cycle && k == g->edges_len - 1)) {
-                  NewEdgeRef *edge = *edge_ptr;
-                  for (uint l = 0; l < 2; l++) {
-                    NewFaceRef *face = edge->faces[l];
-                    if (face && (first_edge == NULL ||
-                                 (first_edge->faces[0] != face && first_edge->faces[1] != face))) {
-                      float angle = 1.0f;
-                      float ofs = face->reversed ? -ofs_back_clamped : ofs_front_clamped;
-                      /* Use face_weight here to make faces thinner. */
-                      if (do_flat_faces) {
-                        ofs *= face_weight[face->index];
-                      }
-
-                      if (smd->nonmanifold_offset_mode ==
-                          MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_EVEN) {
-                        const MLoop *ml_next = orig_mloop + face->face->loopstart;
-                        const MLoop *ml = ml_next + (face->face->totloop - 1);
-                        const MLoop *ml_prev = ml - 1;
-                        for (int m = 0; m < face->face->totloop && vm[ml->v] != i;
-                             m++, ml_next++) {
-                          ml_prev = ml;
-                          ml = ml_next;
-                        }
-                        angle = angle_v3v3v3(orig_mvert_co[vm[ml_prev->v]],
-                                             orig_mvert_co[i],
-                                             orig_mvert_co[vm[ml_next->v]]);
-                        if (face->reversed) {
-                          total_angle_back += angle * ofs * ofs;
-                        }
-                        else {
-                          total_angle += angle * ofs * ofs;
-                        }
-                      }
-                      else {
-                        if (face->reversed) {
-                          total_angle_back++;
-                        }
-                        else {
-                          total_angle++;
-                        }
-                      }
-                      mul_v3_v3fl(face_nor, poly_nors[face->index], angle * ofs);
-                      if (face->reversed) {
-                        add_v3_v3(nor_back, face_nor);
-                        has_back = true;
-                      }
-                      else {
-                        add_v3_v3(nor, face_nor);
-                        has_front = true;
-                      }
-                    }
-                  }
-                  if ((cycle && k == 0) || (!cycle && k + 3 >= g->edges_len)) {
-                    first_edge = edge;
-                  }
-                }
-              }
-
-              /* Set normal length with selected method. */
-              if (smd->nonmanifold_offset_mode == MOD_SOLIDIFY_NONMANIFOLD_OFFSET_MODE_EVEN) {
-                if (has_front) {
-                  float length_sq = len_squared_v3(nor);
-                  if (LIKELY(length_sq > FLT_EPSILON)) {
-                    mul_v3_fl(nor, total_angle / length_sq);
-                  }
-                }
-                if (has_back) {
-                  float length_sq = len_squared_v3(nor_back);
-                  if (LIKELY(length_sq > FLT_EPSILON)) {
-                    mul_v3_fl(nor_back, total_angle_back / length_sq);
-                  }
-                  if (!has_front) {
-                    copy_v3_v3(nor, nor_back);
-                  }
-                }
-                if (has_front && has_back) {
-                  float nor_length = len_v3(nor);
-                  float nor_back_length = len_v3(nor_back);
-                  float q = dot_v3v3(nor, nor_back);
-                  if (LIKELY(fabsf(q) > FLT_EPSILON)) {
-                    q /= nor_length * nor_back_length;
-                  }
-                  float d = 1.0f - q * q;
-                  if (LIKELY(d > FLT_EPSILON)) {
-                    d = 1.0f / d;
-                    if (LIKELY(nor_length > FLT_EPSILON)) {
-                      mul_v3_fl(nor, (1 - nor_back_length * q / nor_length) * d);
-                    }
-                    if (LIKELY(nor_back_length > FLT_EPSILON)) {
-                      mul_v3_fl(nor_back, (1 - nor_length * q / nor_back_length) * d);
-                    }
-                    add_v3_v3(nor, nor_back);
-                  }
-                  else {
-                    mul_v3_fl(nor, 0.5f);
-                    mul_v3_fl(nor_back, 0.5f);
-                    add_v3_v3(nor, nor_back);
-                  }
-                }
-              }
-              else {
-                if (has_front && total_angle > FLT_EPSILON) {
-                  mul_v3_fl(nor, 1.0f / total_angle);
-                }
-                if (has_back && total_angle_back > FLT_EPSILON) {
-                  mul_v3_fl(nor_back, 1.0f / total_angle_back);
-                  add_v3_v3(nor, nor_back);
-                  if (has_front && total_angle > FLT_EPSILON) {
-                    mul_v3_fl(nor, 0.5f);
-                  }
-                }
-              }
-              /* Set move_nor for boundary fix. */
-              if (!disable_boundary_fix && g->edges_len > 2) {
-                approximate_free_direction = true;
-              }
-              else {
-                disable_boundary_fix = true;
-              }
-            }
-            if (approximate_free_direction) {
-              /* Set move_nor for boundary fix. */
-              NewEdgeRef **edge_ptr = g->edges + 1;
-              float tmp[3];
-              int k;
-              for (k = 1; k + 1 < g->edges_len; k++, edge_ptr++) {
-                const MEdge *e = orig_medge + (*edge_ptr)->old_edge;
-                sub_v3_v3v3(tmp, orig_mvert_co[vm[e->v1] == i ? e->v2 : e->v1], orig_mvert_co[i]);
-                add_v3_v3(move_nor, tmp);
-              }
-              if (k == 1) {
-                disable_boundary_fix = true;
-              }
-              else {
-                disable_boundary_fix = normalize_v3(move_nor) == 0.0f;
-              }
-            }
-            /* Fix boundary verts. */
-            if (!disable_boundary_fix) {
-              /* Constraint normal, nor * constr_nor == 0 after this fix. */
-              float constr_nor[3];
-              const MEdge *e0_edge = orig_medge + g->edges[0]->old_edge;
-              const MEdge *e1_edge = orig_medge + g->edges[g->edges_len - 1]->old_edge;
-              float e0[3];
-              float e1[3];
-              sub_v3_v3v3(e0,
-                          orig_mvert_co[vm[e0_edge->v1] == i ? e0_edge->v2 : e0_edge->v1],
-                          orig_mvert_co[i]);
-              sub_v3_v3v3(e1,
-                          orig_mvert_co[vm[e1_edge->v1] == i ? e1_edge->v2 : e1_edge->v1],
-                          orig_mvert_co[i]);
-              if (smd->nonmanifold_boundary_mode == MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_FLAT) {
-                cross_v3_v3v3(constr_nor, e0, e1);
-                normalize_v3(constr_nor);
-              }
-              else {
-                BLI_assert(smd->nonmanifold_boundary_mode ==
-                           MOD_SOLIDIFY_NONMANIFOLD_BOUNDARY_MODE_ROUND);
-                float f0[3];
-                float f1[3];
-                if (g->edges[0]->faces[0]->reversed) {
-                  negate_v3_v3(f0, poly_nors[g->edges[0]->faces[0]->index]);
-                }
-                else {
-                  copy_v3_v3(f0, poly_nors[g->edges[0]->faces[0]->index]);
-                }
-                if (g->edges[g->edges_len - 1]->faces[0]->reversed) {
-                  negate_v3_v3(f1, poly_nors[g->edges[g->edges_len - 1]->faces[0]->index]);
-                }
-                else {
-                  copy_v3_v3(f1, poly_nors[g->edges[g->edges_len - 1]->faces[0]->index]);
-                }
-                float n0[3];
-                float n1[3];
-                cross_v3_v3v3(n0, e0, f0);
-                cross_v3_v3v3(n1, f1, e1);
-                normalize_v3(n0);
-                normalize_v3(n1);
-                add_v3_v3v3(constr_nor, n0, n1);
-                normalize_v3(constr_nor);
-              }
-              float d = dot_v3v3(constr_nor, move_nor);
-              /* Only allow the thickness to increase about 10 times. */
-              if (fabsf(d) > 0.1f) {
-                mul_v3_fl(move_nor, dot_v3v3(constr_nor, nor) / d);
-                sub_v3_v3(nor, move_nor);
-              }
-            }
-            float scalar_vgroup = 1;
-            /* Use vertex group. */
-            if (dvert && !do_flat_faces) {
-              const MDeformVert *dv = &dvert[i];
-              if (defgrp_invert) {
-                scalar_vgroup = 1.0f - BKE_defvert_find_weight(dv, defgrp_index);
-              }
-              else {
-                scalar_vgroup = BKE_defvert_find_weight(dv, defgrp_index);
-              }
-              scalar_vgroup = offset_fac_vg + (scalar_vgroup * offset_fac_vg_inv);
-            }
-            /* Do clamping. */
-            if (do_clamp) {
-              if (do_angle_clamp) {
-                if (g->edges_len > 2) {
-                  float min_length = 0;
-                  float angle = 0.5f * M_PI;
-                  uint k = 0;
-                  for (NewEdgeRef **p = g->edges; k < g->edges_len; k++, p++) {
-                    float length = orig_edge_lengths[(*p)->old_edge];
-                    float e_ang = (*p)->angle;
-                    if (e_ang > angle) {
-                      angle = e_ang;
-                    }
-                    if (length < min_length || k == 0) {
-                      min_length = length;
-                    }
-                  }
-                  float cos_ang = cosf(angle * 0.5f);
-                  if (cos_ang > 0) {
-                    float max_off = min_length * 0.5f / cos_ang;
-                    if (max_off < offset * 0.5f) {
-                      scalar_vgroup *= max_off / offset * 2;
-                    }
-                  }
-                }
-              }
-              else {
-                float min_length = 0;
-                uint k = 0;
-                for (NewEdgeRef **p = g->edges; k < g->edges_len; k++, p++) {
-                  float length = orig_edge_lengths[(*p)->old_edge];
-                  if (length < min_length || k == 0) {
-                    min_length = length;
-                  }
-                }
-                if (min_length < offset) {
-                  scalar_vgroup *= min_length / offset;
-                }
-              }
-            }
-            mul_v3_fl(nor, scalar_vgroup);
-            add_v3_v3v3(g->co, nor, orig_mvert_co[i]);
-          }
-          else {
-            copy_v3_v3(g->co, orig_mvert_co[i]);
-          }
-        }
-      }
-    }
+    SolidifyEdgeGroupCoData data = {
+        .smd = smd,
+        .orig_vert_groups_arr = orig_vert_groups_arr,
+        .orig_mvert_co = (const float(*)[3])orig_mvert_co,
+        .orig_medge = orig_medge,
+        .orig_mloop = orig_mloop,
+        .vm = vm,
+        .poly_nors = (const float(*)[3])poly_nors,
+        .null_faces = null_faces,
+        .face_weight = face_weight,
+        .orig_edge_lengths = orig_edge_lengths,
+        .dvert = dvert,
+        .defgrp_index = defgrp_index,
+        .defgrp_invert = defgrp_invert,
+        .do_flat_faces = do_flat_faces,
+        .do_clamp = do_clamp,
+        .do_angle_clamp = do_angle_clamp,
+        .ofs_front_clamped = ofs_front_clamped,
+        .ofs_back_clamped = ofs_back_clamped,
+        .offset = offset,
+        .offset_fac_vg = offset_fac_vg,
+        .offset_fac_vg_inv = offset_fac_vg_inv,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (verts_num > 1024);
+    BLI_task_parallel_range(0, (int)verts_num, &data, solidify_edge_group_co_task_cb, &settings);
 
     if (do_flat_faces) {
       MEM_freeN(face_weight);
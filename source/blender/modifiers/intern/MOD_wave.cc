@@ -8,6 +8,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.hh"
 
 #include "BLT_translation.h"
 
@@ -22,6 +23,7 @@
 #include "BKE_deform.h"
 #include "BKE_editmesh.h"
 #include "BKE_editmesh_cache.h"
+#include "BKE_image.h"
 #include "BKE_lib_id.h"
 #include "BKE_lib_query.h"
 #include "BKE_mesh.h"
@@ -141,7 +143,6 @@ static void waveModifier_do(WaveModifierData *md,
   float(*tex_co)[3] = nullptr;
   const int wmd_axis = wmd->flag & (MOD_WAVE_X | MOD_WAVE_Y);
   const float falloff = wmd->falloff;
-  float falloff_fac = 1.0f; /* when falloff == 0.0f this stays at 1.0f */
   const bool invert_group = (wmd->flag & MOD_WAVE_INVERT_VGROUP) != 0;
 
   const float(*vert_normals)[3] = nullptr;
@@ -182,6 +183,7 @@ static void waveModifier_do(WaveModifierData *md,
   }
 
   Tex *tex_target = wmd->texture;
+  ImagePool *pool = nullptr;
   if (mesh != nullptr && tex_target != nullptr) {
     tex_co = static_cast<float(*)[3]>(MEM_malloc_arrayN(verts_num, sizeof(*tex_co), __func__));
     MOD_get_texture_coords((MappingInfoModifierData *)wmd, ctx, ob, mesh, vertexCos, tex_co);
@@ -192,100 +194,112 @@ static void waveModifier_do(WaveModifierData *md,
   if (lifefac != 0.0f) {
     /* avoid divide by zero checks within the loop */
     float falloff_inv = falloff != 0.0f ? 1.0f / falloff : 1.0f;
-    int i;
-
-    for (i = 0; i < verts_num; i++) {
-      float *co = vertexCos[i];
-      float x = co[0] - wmd->startx;
-      float y = co[1] - wmd->starty;
-      float amplit = 0.0f;
-      float def_weight = 1.0f;
-
-      /* get weights */
-      if (dvert) {
-        def_weight = invert_group ? 1.0f - BKE_defvert_find_weight(&dvert[i], defgrp_index) :
-                                    BKE_defvert_find_weight(&dvert[i], defgrp_index);
-
-        /* if this vert isn't in the vgroup, don't deform it */
-        if (def_weight == 0.0f) {
-          continue;
-        }
-      }
-
-      switch (wmd_axis) {
-        case MOD_WAVE_X | MOD_WAVE_Y:
-          amplit = sqrtf(x * x + y * y);
-          break;
-        case MOD_WAVE_X:
-          amplit = x;
-          break;
-        case MOD_WAVE_Y:
-          amplit = y;
-          break;
-      }
-
-      /* this way it makes nice circles */
-      amplit -= (ctime - wmd->timeoffs) * wmd->speed;
+    const Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
 
-      if (wmd->flag & MOD_WAVE_CYCL) {
-        amplit = float(fmodf(amplit - wmd->width, 2.0f * wmd->width)) + wmd->width;
-      }
-
-      if (falloff != 0.0f) {
-        float dist = 0.0f;
-
-        switch (wmd_axis) {
-          case MOD_WAVE_X | MOD_WAVE_Y:
-            dist = sqrtf(x * x + y * y);
-            break;
-          case MOD_WAVE_X:
-            dist = fabsf(x);
-            break;
-          case MOD_WAVE_Y:
-            dist = fabsf(y);
-            break;
-        }
-
-        falloff_fac = (1.0f - (dist * falloff_inv));
-        CLAMP(falloff_fac, 0.0f, 1.0f);
-      }
+    /* Load the images used by the texture once, so the vertices can be evaluated in parallel. */
+    if (tex_co) {
+      pool = BKE_image_pool_new();
+      BKE_texture_fetch_images_for_pool(tex_target, pool);
+    }
 
-      /* GAUSSIAN */
-      if ((falloff_fac != 0.0f) && (amplit > -wmd->width) && (amplit < wmd->width)) {
-        amplit = amplit * wmd->narrow;
-        amplit = float(1.0f / expf(amplit * amplit) - minfac);
-
-        /* Apply texture. */
-        if (tex_co) {
-          Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
-          TexResult texres;
-          BKE_texture_get_value(scene, tex_target, tex_co[i], &texres, false);
-          amplit *= texres.tin;
-        }
-
-        /* Apply weight & falloff. */
-        amplit *= def_weight * falloff_fac;
-
-        if (vert_normals) {
-          /* move along normals */
-          if (wmd->flag & MOD_WAVE_NORM_X) {
-            co[0] += (lifefac * amplit) * vert_normals[i][0];
-          }
-          if (wmd->flag & MOD_WAVE_NORM_Y) {
-            co[1] += (lifefac * amplit) * vert_normals[i][1];
-          }
-          if (wmd->flag & MOD_WAVE_NORM_Z) {
-            co[2] += (lifefac * amplit) * vert_normals[i][2];
+    blender::threading::parallel_for(
+        blender::IndexRange(verts_num), 512, [&](const blender::IndexRange range) {
+          for (const int i : range) {
+            float *co = vertexCos[i];
+            float x = co[0] - wmd->startx;
+            float y = co[1] - wmd->starty;
+            float amplit = 0.0f;
+            float def_weight = 1.0f;
+            float falloff_fac = 1.0f; /* when falloff == 0.0f this stays at 1.0f */
+
+            /* get weights */
+            if (dvert) {
+              def_weight = invert_group ? 1.0f - BKE_defvert_find_weight(&dvert[i], defgrp_index) :
+                                          BKE_defvert_find_weight(&dvert[i], defgrp_index);
+
+              /* if this vert isn't in the vgroup, don't deform it */
+              if (def_weight == 0.0f) {
+                continue;
+              }
+            }
+
+            switch (wmd_axis) {
+              case MOD_WAVE_X | MOD_WAVE_Y:
+                amplit = sqrtf(x * x + y * y);
+                break;
+              case MOD_WAVE_X:
+                amplit = x;
+                break;
+              case MOD_WAVE_Y:
+                amplit = y;
+                break;
+            }
+
+            /* this way it makes nice circles */
+            amplit -= (ctime - wmd->timeoffs) * wmd->speed;
+
+            if (wmd->flag & MOD_WAVE_CYCL) {
+              amplit = float(fmodf(amplit - wmd->width, 2.0f * wmd->width)) + wmd->width;
+            }
+
+            if (falloff != 0.0f) {
+              float dist = 0.0f;
+
+              switch (wmd_axis) {
+                case MOD_WAVE_X | MOD_WAVE_Y:
+                  dist = sqrtf(x * x + y * y);
+                  break;
+                case MOD_WAVE_X:
+                  dist = fabsf(x);
+                  break;
+                case MOD_WAVE_Y:
+                  dist = fabsf(y);
+                  break;
+              }
+
+              falloff_fac = (1.0f - (dist * falloff_inv));
+              CLAMP(falloff_fac, 0.0f, 1.0f);
+            }
+
+            /* GAUSSIAN */
+            if ((falloff_fac != 0.0f) && (amplit > -wmd->width) && (amplit < wmd->width)) {
+              amplit = amplit * wmd->narrow;
+              amplit = float(1.0f / expf(amplit * amplit) - minfac);
+
+              /* Apply texture. */
+              if (tex_co) {
+                TexResult texres;
+                BKE_texture_get_value_ex(scene, tex_target, tex_co[i], &texres, pool, false);
+                amplit *= texres.tin;
+              }
+
+              /* Apply weight & falloff. */
+              amplit *= def_weight * falloff_fac;
+
+              if (vert_normals) {
+                /* move along normals */
+                if (wmd->flag & MOD_WAVE_NORM_X) {
+                  co[0] += (lifefac * amplit) * vert_normals[i][0];
+                }
+                if (wmd->flag & MOD_WAVE_NORM_Y) {
+                  co[1] += (lifefac * amplit) * vert_normals[i][1];
+                }
+                if (wmd->flag & MOD_WAVE_NORM_Z) {
+                  co[2] += (lifefac * amplit) * vert_normals[i][2];
+                }
+              }
+              else {
+                /* move along local z axis */
+                co[2] += lifefac * amplit;
+              }
+            }
           }
-        }
-        else {
-          /* move along local z axis */
-          co[2] += lifefac * amplit;
-        }
-      }
-    }
+        });
   }
 
+  if (pool != nullptr) {
+    BKE_image_pool_free(pool);
+  }
   MEM_SAFE_FREE(tex_co);
 }
 
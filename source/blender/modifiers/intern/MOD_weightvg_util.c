@@ -153,16 +153,28 @@ void weightvg_do_mask(const ModifierEvalContext *ctx,
 
     MOD_init_texture(&t_map, ctx);
 
+    /* Evaluate the texture for all weights at once, which is multi-threaded. */
+    float(*weight_tex_co)[3] = tex_co;
+    if (indices) {
+      weight_tex_co = MEM_malloc_arrayN(num, sizeof(*weight_tex_co), __func__);
+      for (i = 0; i < num; i++) {
+        copy_v3_v3(weight_tex_co[i], tex_co[indices[i]]);
+      }
+    }
+    TexResult *texres_array = MEM_malloc_arrayN(num, sizeof(*texres_array), __func__);
+    BKE_texture_get_values(scene,
+                           texture,
+                           (const float(*)[3])weight_tex_co,
+                           num,
+                           texres_array,
+                           NULL,
+                           tex_use_channel != MOD_WVG_MASK_TEX_USE_INT);
+
     /* For each weight (vertex), make the mix between org and new weights. */
     for (i = 0; i < num; i++) {
-      int idx = indices ? indices[i] : i;
-      TexResult texres;
+      const TexResult texres = texres_array[i];
       float hsv[3]; /* For HSV color space. */
-      bool do_color_manage;
-
-      do_color_manage = tex_use_channel != MOD_WVG_MASK_TEX_USE_INT;
 
-      BKE_texture_get_value(scene, texture, tex_co[idx], &texres, do_color_manage);
       /* Get the good channel value... */
       switch (tex_use_channel) {
         case MOD_WVG_MASK_TEX_USE_INT:
@@ -202,6 +214,10 @@ void weightvg_do_mask(const ModifierEvalContext *ctx,
       }
     }
 
+    MEM_freeN(texres_array);
+    if (weight_tex_co != tex_co) {
+      MEM_freeN(weight_tex_co);
+    }
     MEM_freeN(tex_co);
   }
   else if ((ref_didx = BKE_id_defgroup_name_index(&mesh->id, defgrp_name)) != -1) {
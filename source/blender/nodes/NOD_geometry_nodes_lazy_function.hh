@@ -145,6 +145,11 @@ struct GeometryNodesLazyFunctionGraphInfo {
    * This can be used as a simple heuristic for the complexity of the node group.
    */
   int num_inline_nodes_approximate = 0;
+  /**
+   * Execution times of the nodes in the graph, which are used for scheduling in later
+   * evaluations. They are shared by all evaluations of the node group.
+   */
+  std::unique_ptr<lf::GraphExecutor::NodeTimings> node_timings;
 
   GeometryNodesLazyFunctionGraphInfo();
   ~GeometryNodesLazyFunctionGraphInfo();
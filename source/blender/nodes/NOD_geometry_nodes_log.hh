@@ -147,6 +147,12 @@ class GeometryInfoLog : public ValueLog {
   std::optional<InstancesInfo> instances_info;
   std::optional<EditDataInfo> edit_data_info;
 
+  /**
+   * Approximate size of all attribute and topology arrays of the geometry in bytes, including
+   * instanced geometry. Memory that is shared with other geometries is counted as well.
+   */
+  int64_t memory_bytes = 0;
+
   GeometryInfoLog(const GeometrySet &geometry_set);
 };
 
@@ -72,6 +72,10 @@ class ViewerOperation : public NodeOperation {
 
   void execute() override
   {
+    if (!context().use_viewer_output()) {
+      return;
+    }
+
     const Result &image = get_input("Image");
     const Result &alpha = get_input("Alpha");
 
@@ -127,13 +127,12 @@ static Array<Vector<int>> build_vert_to_vert_by_edge_map(const Span<MEdge> edges
   return map;
 }
 
-static Array<Vector<int>> build_edge_to_edge_by_vert_map(const Span<MEdge> edges,
-                                                         const int verts_num,
+static Array<Vector<int>> build_edge_to_edge_by_vert_map(const Mesh &mesh,
                                                          const IndexMask edge_mask)
 {
+  const Span<MEdge> edges = mesh.edges();
   Array<Vector<int>> map(edges.size());
-  Array<Vector<int>> vert_to_edge_map = bke::mesh_topology::build_vert_to_edge_map(edges,
-                                                                                   verts_num);
+  const bke::VertToElemMap &vert_to_edge_map = mesh.vert_to_edge_map();
 
   threading::parallel_for(edge_mask.index_range(), 1024, [&](IndexRange range) {
     for (const int edge_i : edge_mask.slice(range)) {
@@ -210,9 +209,7 @@ static Array<Vector<int>> create_mesh_map(const Mesh &mesh,
       return build_vert_to_vert_by_edge_map(edges, verts_num);
     }
     case ATTR_DOMAIN_EDGE: {
-      const Span<MEdge> edges = mesh.edges();
-      const int verts_num = mesh.totvert;
-      return build_edge_to_edge_by_vert_map(edges, verts_num, mask);
+      return build_edge_to_edge_by_vert_map(mesh, mask);
     }
     case ATTR_DOMAIN_FACE: {
       const Span<MPoly> polys = mesh.polys();
@@ -109,17 +109,21 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<MLoop> loops = mesh.loops();
   const Span<MLoopTri> looptris = mesh.looptris();
 
-  for (const int looptri_index : looptris.index_range()) {
+  /* Initializes the random number generator of a triangle and returns the number of points that
+   * are created on it. Every triangle has its own seed, so the result does not depend on the
+   * order in which the triangles are processed. */
+  const auto init_looptri = [&](const int looptri_index,
+                                RandomNumberGenerator &r_rng,
+                                float3 &r_v0_pos,
+                                float3 &r_v1_pos,
+                                float3 &r_v2_pos) {
     const MLoopTri &looptri = looptris[looptri_index];
     const int v0_loop = looptri.tri[0];
     const int v1_loop = looptri.tri[1];
     const int v2_loop = looptri.tri[2];
-    const int v0_index = loops[v0_loop].v;
-    const int v1_index = loops[v1_loop].v;
-    const int v2_index = loops[v2_loop].v;
-    const float3 v0_pos = verts[v0_index].co;
-    const float3 v1_pos = verts[v1_index].co;
-    const float3 v2_pos = verts[v2_index].co;
+    r_v0_pos = verts[loops[v0_loop].v].co;
+    r_v1_pos = verts[loops[v1_loop].v].co;
+    r_v2_pos = verts[loops[v2_loop].v].co;
 
     float looptri_density_factor = 1.0f;
     if (!density_factors.is_empty()) {
@@ -128,23 +132,54 @@ static void sample_mesh_surface(const Mesh &mesh,
       const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
       looptri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) / 3.0f;
     }
-    const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+    const float area = area_tri_v3(r_v0_pos, r_v1_pos, r_v2_pos);
 
     const int looptri_seed = noise::hash(looptri_index, seed);
-    RandomNumberGenerator looptri_rng(looptri_seed);
-
-    const int point_amount = looptri_rng.round_probabilistic(area * base_density *
-                                                             looptri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_looptri_indices.append(looptri_index);
+    r_rng.seed(looptri_seed);
+    return r_rng.round_probabilistic(area * base_density * looptri_density_factor);
+  };
+
+  /* Count the points on every triangle first, so that the points can be created in parallel
+   * afterwards, in the same order as when the triangles are processed one after another. */
+  Array<int> offsets(looptris.size() + 1);
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      RandomNumberGenerator looptri_rng;
+      float3 v0_pos, v1_pos, v2_pos;
+      offsets[looptri_index] = init_looptri(looptri_index, looptri_rng, v0_pos, v1_pos, v2_pos);
     }
+  });
+  int offset = 0;
+  for (const int looptri_index : looptris.index_range()) {
+    const int point_amount = offsets[looptri_index];
+    offsets[looptri_index] = offset;
+    offset += point_amount;
   }
+  offsets.last() = offset;
+
+  const int start = r_positions.size();
+  r_positions.resize(start + offset);
+  r_bary_coords.resize(start + offset);
+  r_looptri_indices.resize(start + offset);
+
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      RandomNumberGenerator looptri_rng;
+      float3 v0_pos, v1_pos, v2_pos;
+      init_looptri(looptri_index, looptri_rng, v0_pos, v1_pos, v2_pos);
+
+      const IndexRange points(start + offsets[looptri_index],
+                              offsets[looptri_index + 1] - offsets[looptri_index]);
+      for (const int i : points) {
+        const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
+        float3 point_pos;
+        interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
+        r_positions[i] = point_pos;
+        r_bary_coords[i] = bary_coord;
+        r_looptri_indices[i] = looptri_index;
+      }
+    }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -171,28 +206,73 @@ BLI_NOINLINE static void update_elimination_mask_for_close_points(
   KDTree_3d *kdtree = build_kdtree(positions);
   BLI_SCOPED_DEFER([&]() { BLI_kdtree_3d_free(kdtree); });
 
-  for (const int i : positions.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
+  /* Points are processed in order, and every point that is not eliminated yet eliminates all
+   * points close to it. That is the same as eliminating every point that is close to an earlier
+   * point which is kept. The expensive range searches are done in parallel for blocks of points,
+   * only resolving the dependencies between close points in the same block is done serially. */
+  const int block_size = 65536;
+  Array<Vector<int, 8>> close_points_in_block(std::min<int>(block_size, positions.size()));
+
+  for (int block_start = 0; block_start < positions.size(); block_start += block_size) {
+    const IndexRange block(block_start, std::min<int>(block_size, positions.size() - block_start));
+
+    threading::parallel_for(IndexRange(block.size()), 256, [&](const IndexRange range) {
+      for (const int index_in_block : range) {
+        const int i = block[index_in_block];
+        if (elimination_mask[i]) {
+          continue;
+        }
+
+        struct CallbackData {
+          int index;
+          IndexRange block;
+          Span<bool> elimination_mask;
+          Vector<int, 8> &close_points;
+          bool close_to_kept_point;
+        } callback_data = {
+            i, block, elimination_mask, close_points_in_block[index_in_block], false};
+        callback_data.close_points.clear();
+
+        BLI_kdtree_3d_range_search_cb(
+            kdtree,
+            positions[i],
+            minimum_distance,
+            [](void *user_data, int index, const float * /*co*/, float /*dist_sq*/) {
+              CallbackData &callback_data = *static_cast<CallbackData *>(user_data);
+              if (index >= callback_data.index) {
+                return true;
+              }
+              if (index < callback_data.block.start()) {
+                /* Points from previous blocks are resolved already. */
+                if (!callback_data.elimination_mask[index]) {
+                  callback_data.close_to_kept_point = true;
+                  return false;
+                }
+                return true;
+              }
+              callback_data.close_points.append(index);
+              return true;
+            },
+            &callback_data);
+
+        if (callback_data.close_to_kept_point) {
+          elimination_mask[i] = true;
+        }
+      }
+    });
+
+    for (const int index_in_block : IndexRange(block.size())) {
+      const int i = block[index_in_block];
+      if (elimination_mask[i]) {
+        continue;
+      }
+      for (const int close_point : close_points_in_block[index_in_block]) {
+        if (!elimination_mask[close_point]) {
+          elimination_mask[i] = true;
+          break;
+        }
+      }
     }
-
-    struct CallbackData {
-      int index;
-      MutableSpan<bool> elimination_mask;
-    } callback_data = {i, elimination_mask};
-
-    BLI_kdtree_3d_range_search_cb(
-        kdtree,
-        positions[i],
-        minimum_distance,
-        [](void *user_data, int index, const float * /*co*/, float /*dist_sq*/) {
-          CallbackData &callback_data = *static_cast<CallbackData *>(user_data);
-          if (index != callback_data.index) {
-            callback_data.elimination_mask[index] = true;
-          }
-          return true;
-        },
-        &callback_data);
   }
 }
 
@@ -204,30 +284,33 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const MutableSpan<bool> elimination_mask)
 {
   const Span<MLoopTri> looptris = mesh.looptris();
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const MLoopTri &looptri = looptris[looptri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const MLoopTri &looptri = looptris[looptri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const int v0_loop = looptri.tri[0];
-    const int v1_loop = looptri.tri[1];
-    const int v2_loop = looptri.tri[2];
+      const int v0_loop = looptri.tri[0];
+      const int v1_loop = looptri.tri[1];
+      const int v2_loop = looptri.tri[2];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-    const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-    const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
+      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
+      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
 
-    const float probability = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                              v2_density_factor * bary_coord.z;
+      const float probability = v0_density_factor * bary_coord.x +
+                                v1_density_factor * bary_coord.y +
+                                v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probability) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probability) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
@@ -251,35 +334,34 @@ BLI_NOINLINE static void interpolate_attribute(const Mesh &mesh,
                                                const GVArray &source_data,
                                                GMutableSpan output_data)
 {
-  switch (source_domain) {
-    case ATTR_DOMAIN_POINT: {
-      bke::mesh_surface_sample::sample_point_attribute(mesh,
-                                                       looptri_indices,
-                                                       bary_coords,
-                                                       source_data,
-                                                       IndexMask(output_data.size()),
-                                                       output_data);
-      break;
-    }
-    case ATTR_DOMAIN_CORNER: {
-      bke::mesh_surface_sample::sample_corner_attribute(mesh,
-                                                        looptri_indices,
-                                                        bary_coords,
-                                                        source_data,
-                                                        IndexMask(output_data.size()),
-                                                        output_data);
-      break;
-    }
-    case ATTR_DOMAIN_FACE: {
-      bke::mesh_surface_sample::sample_face_attribute(
-          mesh, looptri_indices, source_data, IndexMask(output_data.size()), output_data);
-      break;
-    }
-    default: {
-      /* Not supported currently. */
-      return;
-    }
+  if (!ELEM(source_domain, ATTR_DOMAIN_POINT, ATTR_DOMAIN_CORNER, ATTR_DOMAIN_FACE)) {
+    /* Not supported currently. */
+    return;
   }
+  threading::parallel_for(IndexRange(output_data.size()), 4096, [&](const IndexRange range) {
+    const IndexMask mask(range);
+    switch (source_domain) {
+      case ATTR_DOMAIN_POINT: {
+        bke::mesh_surface_sample::sample_point_attribute(
+            mesh, looptri_indices, bary_coords, source_data, mask, output_data);
+        break;
+      }
+      case ATTR_DOMAIN_CORNER: {
+        bke::mesh_surface_sample::sample_corner_attribute(
+            mesh, looptri_indices, bary_coords, source_data, mask, output_data);
+        break;
+      }
+      case ATTR_DOMAIN_FACE: {
+        bke::mesh_surface_sample::sample_face_attribute(
+            mesh, looptri_indices, source_data, mask, output_data);
+        break;
+      }
+      default: {
+        BLI_assert_unreachable();
+        break;
+      }
+    }
+  });
 }
 
 BLI_NOINLINE static void propagate_existing_attributes(
@@ -352,31 +434,33 @@ BLI_NOINLINE static void compute_attribute_outputs(const Mesh &mesh,
   const Span<MLoop> loops = mesh.loops();
   const Span<MLoopTri> looptris = mesh.looptris();
 
-  for (const int i : bary_coords.index_range()) {
-    const int looptri_index = looptri_indices[i];
-    const MLoopTri &looptri = looptris[looptri_index];
-    const float3 &bary_coord = bary_coords[i];
-
-    const int v0_index = loops[looptri.tri[0]].v;
-    const int v1_index = loops[looptri.tri[1]].v;
-    const int v2_index = loops[looptri.tri[2]].v;
-    const float3 v0_pos = verts[v0_index].co;
-    const float3 v1_pos = verts[v1_index].co;
-    const float3 v2_pos = verts[v2_index].co;
-
-    ids.span[i] = noise::hash(noise::hash_float(bary_coord), looptri_index);
-
-    float3 normal;
-    if (!normals.span.is_empty() || !rotations.span.is_empty()) {
-      normal_tri_v3(normal, v0_pos, v1_pos, v2_pos);
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      const int looptri_index = looptri_indices[i];
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &bary_coord = bary_coords[i];
+
+      const int v0_index = loops[looptri.tri[0]].v;
+      const int v1_index = loops[looptri.tri[1]].v;
+      const int v2_index = loops[looptri.tri[2]].v;
+      const float3 v0_pos = verts[v0_index].co;
+      const float3 v1_pos = verts[v1_index].co;
+      const float3 v2_pos = verts[v2_index].co;
+
+      ids.span[i] = noise::hash(noise::hash_float(bary_coord), looptri_index);
+
+      float3 normal;
+      if (!normals.span.is_empty() || !rotations.span.is_empty()) {
+        normal_tri_v3(normal, v0_pos, v1_pos, v2_pos);
+      }
+      if (!normals.span.is_empty()) {
+        normals.span[i] = normal;
+      }
+      if (!rotations.span.is_empty()) {
+        rotations.span[i] = normal_to_euler_rotation(normal);
+      }
     }
-    if (!normals.span.is_empty()) {
-      normals.span[i] = normal;
-    }
-    if (!rotations.span.is_empty()) {
-      rotations.span[i] = normal_to_euler_rotation(normal);
-    }
-  }
+  });
 
   ids.finish();
   normals.finish();
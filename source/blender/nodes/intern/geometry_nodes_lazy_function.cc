@@ -21,9 +21,15 @@
 #include "BLI_map.hh"
 
 #include "DNA_ID.h"
+#include "DNA_curves_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_object_types.h"
+#include "DNA_pointcloud_types.h"
+#include "DNA_volume_types.h"
 
 #include "BKE_compute_contexts.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_geometry_set_instances.hh"
 #include "BKE_type_conversions.hh"
 
 #include "FN_field_cpp_type.hh"
@@ -103,12 +109,316 @@ static void lazy_function_interface_from_node(const bNode &node,
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Node Output Cache
+ *
+ * Some nodes are expensive to evaluate while their inputs often don't change between evaluations,
+ * e.g. a boolean of two objects that were not modified, while another object that the node tree
+ * depends on is moved. The outputs of those nodes are cached in their lazy-function, which is
+ * freed when the node tree changes.
+ *
+ * The cache key contains the input values and the data that the node reads from the context.
+ * Geometry is identified by the session UUIDs of its data-blocks, which are not reused. Therefore
+ * geometry that is referenced from other evaluated objects or that has been output by a cached
+ * node is considered to be equal in the next evaluation, so that cache hits propagate through the
+ * node tree.
+ * \{ */
+
+/** Number of evaluations that are cached per node, e.g. for different modifiers using a group. */
+static constexpr int node_output_cache_max_entries = 8;
+
+/**
+ * Only nodes whose outputs are fully determined by what is added to the cache key are supported.
+ * Cheap nodes are not cached, because the cache keeps their outputs in memory, except for
+ * primitives, whose outputs are often the input of expensive nodes.
+ */
+static bool node_supports_output_cache(const bNode &node)
+{
+  switch (node.type) {
+    case GEO_NODE_CONVEX_HULL:
+    case GEO_NODE_CURVE_TO_MESH:
+    case GEO_NODE_DISTRIBUTE_POINTS_ON_FACES:
+    case GEO_NODE_DUAL_MESH:
+    case GEO_NODE_EXTRUDE_MESH:
+    case GEO_NODE_FILLET_CURVE:
+    case GEO_NODE_MERGE_BY_DISTANCE:
+    case GEO_NODE_MESH_BOOLEAN:
+    case GEO_NODE_MESH_PRIMITIVE_CIRCLE:
+    case GEO_NODE_MESH_PRIMITIVE_CONE:
+    case GEO_NODE_MESH_PRIMITIVE_CUBE:
+    case GEO_NODE_MESH_PRIMITIVE_CYLINDER:
+    case GEO_NODE_MESH_PRIMITIVE_GRID:
+    case GEO_NODE_MESH_PRIMITIVE_ICO_SPHERE:
+    case GEO_NODE_MESH_PRIMITIVE_LINE:
+    case GEO_NODE_MESH_PRIMITIVE_UV_SPHERE:
+    case GEO_NODE_MESH_TO_VOLUME:
+    case GEO_NODE_OBJECT_INFO:
+    case GEO_NODE_POINTS_TO_VOLUME:
+    case GEO_NODE_RESAMPLE_CURVE:
+    case GEO_NODE_SUBDIVIDE_MESH:
+    case GEO_NODE_SUBDIVISION_SURFACE:
+    case GEO_NODE_TRIANGULATE:
+    case GEO_NODE_VOLUME_TO_MESH:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool cache_key_supports_type(const CPPType &type)
+{
+  if (type.is<GeometrySet>() || type.is<Vector<GeometrySet>>() || type.is<Object *>()) {
+    return true;
+  }
+  if (const ValueOrFieldCPPType *value_or_field_type = ValueOrFieldCPPType::get_from_self(type)) {
+    return value_or_field_type->value.is_equality_comparable() &&
+           value_or_field_type->value.is_hashable();
+  }
+  return false;
+}
+
+static GMutablePointer copy_cached_value(const CPPType &type, const void *value)
+{
+  void *buffer = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+  type.copy_construct(value, buffer);
+  return {type, buffer};
+}
+
+static void free_cached_value(GMutablePointer value)
+{
+  if (value.get() != nullptr) {
+    value.type()->destruct(value.get());
+    MEM_freeN(value.get());
+  }
+}
+
+struct NodeOutputCacheKey : NonCopyable, NonMovable {
+  /** Identities of geometries and objects and values read from the context, compared exactly. */
+  Vector<uint64_t> words;
+  /**
+   * Copies of the #ValueOrField inputs. The copies keep the field nodes alive, so that a field
+   * that is compared by pointer can't be freed and replaced by another one at the same address.
+   */
+  Vector<GMutablePointer> values;
+  uint64_t hash = 0;
+
+  ~NodeOutputCacheKey()
+  {
+    for (GMutablePointer value : values) {
+      free_cached_value(value);
+    }
+  }
+
+  void add_word(const uint64_t word)
+  {
+    words.append(word);
+    hash = get_default_hash_2(hash, word);
+  }
+
+  void add_pointer(const void *ptr)
+  {
+    this->add_word(uint64_t(uintptr_t(ptr)));
+  }
+
+  void add_id(const ID *id)
+  {
+    this->add_pointer(id);
+    this->add_word(id ? id->session_uuid : 0);
+  }
+
+  void add_matrix(const float matrix[4][4])
+  {
+    for (const int i : IndexRange(16)) {
+      uint32_t bits;
+      memcpy(&bits, &matrix[i / 4][i % 4], sizeof(bits));
+      this->add_word(bits);
+    }
+  }
+
+  /** Returns false if the geometry contains data that can't be identified cheaply. */
+  bool add_geometry(const GeometrySet &geometry)
+  {
+    const Vector<const GeometryComponent *> components = geometry.get_components_for_read();
+    this->add_word(uint64_t(components.size()));
+    for (const GeometryComponent *component : components) {
+      this->add_word(uint64_t(component->type()));
+      switch (component->type()) {
+        case GEO_COMPONENT_TYPE_MESH: {
+          const Mesh *mesh = static_cast<const MeshComponent *>(component)->get_for_read();
+          this->add_id(mesh ? &mesh->id : nullptr);
+          break;
+        }
+        case GEO_COMPONENT_TYPE_POINT_CLOUD: {
+          const PointCloud *pointcloud =
+              static_cast<const PointCloudComponent *>(component)->get_for_read();
+          this->add_id(pointcloud ? &pointcloud->id : nullptr);
+          break;
+        }
+        case GEO_COMPONENT_TYPE_CURVE: {
+          const Curves *curves = static_cast<const CurveComponent *>(component)->get_for_read();
+          this->add_id(curves ? &curves->id : nullptr);
+          break;
+        }
+        case GEO_COMPONENT_TYPE_VOLUME: {
+          const Volume *volume = static_cast<const VolumeComponent *>(component)->get_for_read();
+          this->add_id(volume ? &volume->id : nullptr);
+          break;
+        }
+        case GEO_COMPONENT_TYPE_INSTANCES:
+        case GEO_COMPONENT_TYPE_EDIT:
+          return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * A node that uses an object generally reads its transform and geometry, possibly relative to
+   * the modifier object.
+   */
+  bool add_object(const Object *object, const Object *self_object)
+  {
+    this->add_id(object ? &object->id : nullptr);
+    if (object == nullptr) {
+      return true;
+    }
+    this->add_matrix(object->object_to_world);
+    this->add_id(self_object ? &self_object->id : nullptr);
+    if (self_object != nullptr) {
+      this->add_matrix(self_object->world_to_object);
+    }
+    if (object == self_object) {
+      return true;
+    }
+    /* The evaluated data-blocks of the object may be updated in place. */
+    this->add_word(object->runtime.geometry_eval_version);
+    return this->add_geometry(bke::object_get_evaluated_geometry_set(*object));
+  }
+
+  void add_value(const ValueOrFieldCPPType &type, const void *value)
+  {
+    if (type.is_field(value)) {
+      hash = get_default_hash_2(hash, type.get_field_ptr(value)->hash());
+    }
+    else {
+      hash = get_default_hash_2(hash, type.value.hash(type.get_value_ptr(value)));
+    }
+    values.append(copy_cached_value(type.self, value));
+  }
+
+  friend bool operator==(const NodeOutputCacheKey &a, const NodeOutputCacheKey &b)
+  {
+    if (a.hash != b.hash || a.words != b.words || a.values.size() != b.values.size()) {
+      return false;
+    }
+    for (const int i : a.values.index_range()) {
+      const ValueOrFieldCPPType &type = *ValueOrFieldCPPType::get_from_self(*a.values[i].type());
+      const void *value_a = a.values[i].get();
+      const void *value_b = b.values[i].get();
+      if (type.is_field(value_a) != type.is_field(value_b)) {
+        return false;
+      }
+      if (type.is_field(value_a)) {
+        if (*type.get_field_ptr(value_a) != *type.get_field_ptr(value_b)) {
+          return false;
+        }
+      }
+      else if (!type.value.is_equal(type.get_value_ptr(value_a), type.get_value_ptr(value_b))) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+struct NodeOutputCacheEntry : NonCopyable, NonMovable {
+  std::unique_ptr<NodeOutputCacheKey> key;
+  /** Copies of the outputs that have been set by the node, null for the other outputs. */
+  Array<GMutablePointer> outputs;
+  /** Warnings are logged again when the cached outputs are used. */
+  Vector<geo_eval_log::NodeWarning> warnings;
+
+  ~NodeOutputCacheEntry()
+  {
+    for (GMutablePointer value : outputs) {
+      free_cached_value(value);
+    }
+  }
+};
+
+/**
+ * Forwards everything to the params of the caller, but keeps a copy of every output that is set,
+ * so that the outputs can be cached after the node has been executed.
+ */
+class CachingParams : public lf::Params {
+ private:
+  lf::Params &params_;
+  MutableSpan<GMutablePointer> r_outputs_;
+
+ public:
+  /* Multi-threading is checked by the wrapped params. */
+  CachingParams(const LazyFunction &fn, lf::Params &params, MutableSpan<GMutablePointer> r_outputs)
+      : lf::Params(fn, true), params_(params), r_outputs_(r_outputs)
+  {
+  }
+
+ private:
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    return params_.get_output_data_ptr(index);
+  }
+
+  void output_set_impl(const int index) override
+  {
+    /* The value may be moved away when the output is set, so copy it first. */
+    const CPPType &type = *fn_.outputs()[index].type;
+    r_outputs_[index] = copy_cached_value(type, params_.get_output_data_ptr(index));
+    params_.output_set(index);
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return params_.try_enable_multi_threading();
+  }
+};
+
+/** \} */
+
 /**
  * Used for most normal geometry nodes like Subdivision Surface and Set Position.
  */
 class LazyFunctionForGeometryNode : public LazyFunction {
  private:
   const bNode &node_;
+  bool use_output_cache_ = false;
+  mutable std::mutex output_cache_mutex_;
+  /** Least recently added entries come first. */
+  mutable Vector<std::unique_ptr<NodeOutputCacheEntry>> output_cache_;
 
  public:
   LazyFunctionForGeometryNode(const bNode &node,
@@ -119,9 +429,134 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     BLI_assert(node.typeinfo->geometry_node_execute != nullptr);
     debug_name_ = node.name;
     lazy_function_interface_from_node(node, r_used_inputs, r_used_outputs, inputs_, outputs_);
+
+    /* All inputs have to be available at the start to build the cache key. */
+    use_output_cache_ = node_supports_output_cache(node) &&
+                        std::all_of(inputs_.begin(), inputs_.end(), [](const lf::Input &input) {
+                          return input.usage == lf::ValueUsage::Used &&
+                                 cache_key_supports_type(*input.type);
+                        });
   }
 
   void execute_impl(lf::Params &params, const lf::Context &context) const override
+  {
+    if (!use_output_cache_) {
+      this->execute_node(params, context);
+      return;
+    }
+    GeoNodesLFUserData *user_data = dynamic_cast<GeoNodesLFUserData *>(context.user_data);
+    BLI_assert(user_data != nullptr);
+
+    std::unique_ptr<NodeOutputCacheKey> key = this->build_cache_key(params, *user_data);
+    if (!key) {
+      this->execute_node(params, context);
+      return;
+    }
+    if (this->try_use_cached_outputs(*key, params, *user_data)) {
+      return;
+    }
+
+    geo_eval_log::GeoTreeLogger *tree_logger = nullptr;
+    if (geo_eval_log::GeoModifierLog *modifier_log = user_data->modifier_data->eval_log) {
+      tree_logger = &modifier_log->get_local_tree_logger(*user_data->compute_context);
+    }
+    const int64_t warnings_num_before = tree_logger ? tree_logger->node_warnings.size() : 0;
+
+    auto entry = std::make_unique<NodeOutputCacheEntry>();
+    entry->outputs.reinitialize(outputs_.size());
+    entry->outputs.fill({});
+    CachingParams caching_params{*this, params, entry->outputs};
+    this->execute_node(caching_params, context);
+
+    if (tree_logger != nullptr) {
+      for (const geo_eval_log::GeoTreeLogger::WarningWithNode &warning :
+           tree_logger->node_warnings.as_span().drop_front(warnings_num_before)) {
+        if (warning.node_id == node_.identifier) {
+          entry->warnings.append(warning.warning);
+        }
+      }
+    }
+    entry->key = std::move(key);
+
+    std::lock_guard lock{output_cache_mutex_};
+    if (output_cache_.size() >= node_output_cache_max_entries) {
+      output_cache_.remove(0);
+    }
+    output_cache_.append(std::move(entry));
+  }
+
+ private:
+  std::unique_ptr<NodeOutputCacheKey> build_cache_key(const lf::Params &params,
+                                                      const GeoNodesLFUserData &user_data) const
+  {
+    auto key = std::make_unique<NodeOutputCacheKey>();
+    /* Anonymous attributes and logged data depend on the compute context. */
+    const ComputeContextHash &context_hash = user_data.compute_context->hash();
+    key->add_word(context_hash.v1);
+    key->add_word(context_hash.v2);
+    for (const int i : outputs_.index_range()) {
+      key->add_word(uint64_t(params.get_output_usage(i)));
+    }
+    const Object *self_object = user_data.modifier_data->self_object;
+    for (const int i : inputs_.index_range()) {
+      const CPPType &type = *inputs_[i].type;
+      const void *value = params.try_get_input_data_ptr(i);
+      BLI_assert(value != nullptr);
+      if (type.is<GeometrySet>()) {
+        if (!key->add_geometry(*static_cast<const GeometrySet *>(value))) {
+          return {};
+        }
+      }
+      else if (type.is<Vector<GeometrySet>>()) {
+        const Vector<GeometrySet> &geometries = *static_cast<const Vector<GeometrySet> *>(value);
+        key->add_word(uint64_t(geometries.size()));
+        for (const GeometrySet &geometry : geometries) {
+          if (!key->add_geometry(geometry)) {
+            return {};
+          }
+        }
+      }
+      else if (type.is<Object *>()) {
+        if (!key->add_object(*static_cast<const Object *const *>(value), self_object)) {
+          return {};
+        }
+      }
+      else {
+        key->add_value(*ValueOrFieldCPPType::get_from_self(type), value);
+      }
+    }
+    return key;
+  }
+
+  bool try_use_cached_outputs(const NodeOutputCacheKey &key,
+                              lf::Params &params,
+                              const GeoNodesLFUserData &user_data) const
+  {
+    std::lock_guard lock{output_cache_mutex_};
+    for (const std::unique_ptr<NodeOutputCacheEntry> &entry : output_cache_) {
+      if (!(*entry->key == key)) {
+        continue;
+      }
+      for (const int i : entry->outputs.index_range()) {
+        const GMutablePointer value = entry->outputs[i];
+        if (value.get() != nullptr) {
+          value.type()->copy_construct(value.get(), params.get_output_data_ptr(i));
+          params.output_set(i);
+        }
+      }
+      if (geo_eval_log::GeoModifierLog *modifier_log = user_data.modifier_data->eval_log) {
+        geo_eval_log::GeoTreeLogger &tree_logger = modifier_log->get_local_tree_logger(
+            *user_data.compute_context);
+        for (const geo_eval_log::NodeWarning &warning : entry->warnings) {
+          tree_logger.node_warnings.append({node_.identifier, warning});
+        }
+      }
+      return true;
+    }
+    return false;
+  }
+
+  void execute_node(lf::Params &params, const lf::Context &context) const
   {
     GeoNodesLFUserData *user_data = dynamic_cast<GeoNodesLFUserData *>(context.user_data);
     BLI_assert(user_data != nullptr);
@@ -649,7 +1084,8 @@ class LazyFunctionForGroupNode : public LazyFunction {
                             std::move(graph_inputs),
                             std::move(graph_outputs),
                             &*lf_logger_,
-                            &*lf_side_effect_provider_);
+                            &*lf_side_effect_provider_,
+                            lf_graph_info.node_timings.get());
   }
 
   void execute_impl(lf::Params &params, const lf::Context &context) const override
@@ -791,6 +1227,7 @@ struct GeometryNodesLazyFunctionGraphBuilder {
 
     lf_graph_->update_node_indices();
     lf_graph_info_->num_inline_nodes_approximate += lf_graph_->nodes().size();
+    lf_graph_info_->node_timings = std::make_unique<lf::GraphExecutor::NodeTimings>(*lf_graph_);
   }
 
  private:
@@ -10,6 +10,8 @@
 
 #include "FN_field_cpp_type.hh"
 
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
 #include "DNA_modifier_types.h"
 #include "DNA_space_types.h"
 
@@ -69,10 +71,14 @@ GeometryInfoLog::GeometryInfoLog(const GeometrySet &geometry_set)
       true,
       [&](const bke::AttributeIDRef &attribute_id,
           const bke::AttributeMetaData &meta_data,
-          const GeometryComponent & /*component*/) {
+          const GeometryComponent &component) {
         if (attribute_id.is_named() && names.add(attribute_id.name())) {
           this->attributes.append({attribute_id.name(), meta_data.domain, meta_data.data_type});
         }
+        if (const CPPType *type = bke::custom_data_type_to_cpp_type(meta_data.data_type)) {
+          this->memory_bytes += int64_t(component.attribute_domain_size(meta_data.domain)) *
+                                type->size();
+        }
       });
 
   for (const GeometryComponent *component : geometry_set.get_components_for_read()) {
@@ -84,6 +90,12 @@ GeometryInfoLog::GeometryInfoLog(const GeometrySet &geometry_set)
         info.verts_num = mesh_component.attribute_domain_size(ATTR_DOMAIN_POINT);
         info.edges_num = mesh_component.attribute_domain_size(ATTR_DOMAIN_EDGE);
         info.faces_num = mesh_component.attribute_domain_size(ATTR_DOMAIN_FACE);
+        /* The topology is not exposed as attributes. */
+        if (const Mesh *mesh = mesh_component.get_for_read()) {
+          this->memory_bytes += int64_t(mesh->totedge) * sizeof(MEdge) +
+                                int64_t(mesh->totpoly) * sizeof(MPoly) +
+                                int64_t(mesh->totloop) * sizeof(MLoop);
+        }
         break;
       }
       case GEO_COMPONENT_TYPE_CURVE: {
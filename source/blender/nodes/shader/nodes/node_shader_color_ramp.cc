@@ -114,12 +114,14 @@ class ColorBandFunction : public fn::MultiFunction {
         1, "Color");
     MutableSpan<float> alphas = params.uninitialized_single_output<float>(2, "Alpha");
 
-    for (int64_t i : mask) {
-      ColorGeometry4f color;
-      BKE_colorband_evaluate(&color_band_, values[i], color);
-      colors[i] = color;
-      alphas[i] = color.a;
-    }
+    devirtualize_varray(values, [&](const auto values) {
+      for (int64_t i : mask) {
+        ColorGeometry4f color;
+        BKE_colorband_evaluate(&color_band_, values[i], color);
+        colors[i] = color;
+        alphas[i] = color.a;
+      }
+    });
   }
 };
 
@@ -103,9 +103,9 @@ static int node_shader_gpu_tex_brick(GPUMaterial *mat,
                         in,
                         out,
                         GPU_uniform(&tex->offset),
-                        GPU_constant(&offset_freq),
+                        GPU_uniform(&offset_freq),
                         GPU_uniform(&tex->squash),
-                        GPU_constant(&squash_freq));
+                        GPU_uniform(&squash_freq));
 }
 
 class BrickFunction : public fn::MultiFunction {
@@ -136,88 +136,99 @@ class NoiseFunction : public fn::MultiFunction {
     const bool compute_factor = !r_factor.is_empty();
     const bool compute_color = !r_color.is_empty();
 
+    /* The position is usually different for every element, while the other inputs are often
+     * single values. Devirtualizing the position avoids a virtual function call per element in
+     * the common case that it is a span. */
     switch (dimensions_) {
       case 1: {
         const VArray<float> &w = params.readonly_single_input<float>(0, "W");
-        if (compute_factor) {
-          for (int64_t i : mask) {
-            const float position = w[i] * scale[i];
-            r_factor[i] = noise::perlin_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
+        devirtualize_varray(w, [&](const auto w) {
+          if (compute_factor) {
+            for (int64_t i : mask) {
+              const float position = w[i] * scale[i];
+              r_factor[i] = noise::perlin_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+            }
           }
-        }
-        if (compute_color) {
-          for (int64_t i : mask) {
-            const float position = w[i] * scale[i];
-            const float3 c = noise::perlin_float3_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
-            r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+          if (compute_color) {
+            for (int64_t i : mask) {
+              const float position = w[i] * scale[i];
+              const float3 c = noise::perlin_float3_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+              r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            }
           }
-        }
+        });
         break;
       }
       case 2: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
-        if (compute_factor) {
-          for (int64_t i : mask) {
-            const float2 position = float2(vector[i] * scale[i]);
-            r_factor[i] = noise::perlin_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
+        devirtualize_varray(vector, [&](const auto vector) {
+          if (compute_factor) {
+            for (int64_t i : mask) {
+              const float2 position = float2(vector[i] * scale[i]);
+              r_factor[i] = noise::perlin_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+            }
           }
-        }
-        if (compute_color) {
-          for (int64_t i : mask) {
-            const float2 position = float2(vector[i] * scale[i]);
-            const float3 c = noise::perlin_float3_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
-            r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+          if (compute_color) {
+            for (int64_t i : mask) {
+              const float2 position = float2(vector[i] * scale[i]);
+              const float3 c = noise::perlin_float3_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+              r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            }
           }
-        }
+        });
         break;
       }
       case 3: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
-        if (compute_factor) {
-          for (int64_t i : mask) {
-            const float3 position = vector[i] * scale[i];
-            r_factor[i] = noise::perlin_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
+        devirtualize_varray(vector, [&](const auto vector) {
+          if (compute_factor) {
+            for (int64_t i : mask) {
+              const float3 position = vector[i] * scale[i];
+              r_factor[i] = noise::perlin_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+            }
           }
-        }
-        if (compute_color) {
-          for (int64_t i : mask) {
-            const float3 position = vector[i] * scale[i];
-            const float3 c = noise::perlin_float3_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
-            r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+          if (compute_color) {
+            for (int64_t i : mask) {
+              const float3 position = vector[i] * scale[i];
+              const float3 c = noise::perlin_float3_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+              r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            }
           }
-        }
+        });
         break;
       }
       case 4: {
         const VArray<float3> &vector = params.readonly_single_input<float3>(0, "Vector");
         const VArray<float> &w = params.readonly_single_input<float>(1, "W");
-        if (compute_factor) {
-          for (int64_t i : mask) {
-            const float3 position_vector = vector[i] * scale[i];
-            const float position_w = w[i] * scale[i];
-            const float4 position{
-                position_vector[0], position_vector[1], position_vector[2], position_w};
-            r_factor[i] = noise::perlin_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
+        devirtualize_varray2(vector, w, [&](const auto vector, const auto w) {
+          if (compute_factor) {
+            for (int64_t i : mask) {
+              const float3 position_vector = vector[i] * scale[i];
+              const float position_w = w[i] * scale[i];
+              const float4 position{
+                  position_vector[0], position_vector[1], position_vector[2], position_w};
+              r_factor[i] = noise::perlin_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+            }
           }
-        }
-        if (compute_color) {
-          for (int64_t i : mask) {
-            const float3 position_vector = vector[i] * scale[i];
-            const float position_w = w[i] * scale[i];
-            const float4 position{
-                position_vector[0], position_vector[1], position_vector[2], position_w};
-            const float3 c = noise::perlin_float3_fractal_distorted(
-                position, detail[i], roughness[i], distortion[i]);
-            r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+          if (compute_color) {
+            for (int64_t i : mask) {
+              const float3 position_vector = vector[i] * scale[i];
+              const float position_w = w[i] * scale[i];
+              const float4 position{
+                  position_vector[0], position_vector[1], position_vector[2], position_w};
+              const float3 c = noise::perlin_float3_fractal_distorted(
+                  position, detail[i], roughness[i], distortion[i]);
+              r_color[i] = ColorGeometry4f(c[0], c[1], c[2], 1.0f);
+            }
           }
-        }
+        });
         break;
       }
     }
@@ -260,7 +260,7 @@ static int node_shader_gpu_tex_sky(GPUMaterial *mat,
                           "node_tex_sky_nishita",
                           in,
                           out,
-                          GPU_constant(&sun_rotation),
+                          GPU_uniform(&sun_rotation),
                           GPU_uniform(xyz_to_rgb.r),
                           GPU_uniform(xyz_to_rgb.g),
                           GPU_uniform(xyz_to_rgb.b),
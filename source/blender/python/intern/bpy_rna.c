@@ -5316,6 +5316,41 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return 0;
 }
 
+/**
+ * The raw type of the buffer items, used when they don't match the attribute type.
+ * RNA converts the values, which is still much faster than accessing the buffer as a sequence.
+ */
+static RawPropertyType foreach_buffer_raw_type(const Py_buffer *buf)
+{
+  const char f = buf->format ? *buf->format : 'B'; /* B is assumed when not set */
+  RawPropertyType raw_type;
+
+  switch (f) {
+    case 'h':
+      raw_type = PROP_RAW_SHORT;
+      break;
+    case 'i':
+      raw_type = PROP_RAW_INT;
+      break;
+    case '?':
+      raw_type = PROP_RAW_BOOLEAN;
+      break;
+    case 'f':
+      raw_type = PROP_RAW_FLOAT;
+      break;
+    case 'd':
+      raw_type = PROP_RAW_DOUBLE;
+      break;
+    default:
+      return PROP_RAW_UNSET;
+  }
+
+  if (buf->itemsize != RNA_raw_type_sizeof(raw_type)) {
+    return PROP_RAW_UNSET;
+  }
+  return raw_type;
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = NULL;
@@ -5353,6 +5388,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_set(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else {
+        const RawPropertyType buf_raw_type = foreach_buffer_raw_type(&buf);
+        if (buf_raw_type != PROP_RAW_UNSET) {
+          buffer_is_compat = true;
+          ok = RNA_property_collection_raw_set(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_raw_type, tot);
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
@@ -5409,6 +5452,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         ok = RNA_property_collection_raw_get(
             NULL, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
       }
+      else {
+        const RawPropertyType buf_raw_type = foreach_buffer_raw_type(&buf);
+        if (buf_raw_type != PROP_RAW_UNSET) {
+          buffer_is_compat = true;
+          ok = RNA_property_collection_raw_get(
+              NULL, &self->ptr, self->prop, attr, buf.buf, buf_raw_type, tot);
+        }
+      }
 
       PyBuffer_Release(&buf);
     }
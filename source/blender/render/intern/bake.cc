@@ -74,13 +74,17 @@
 /* local include */
 #include "zbuf.h"
 
+struct BakeDifferentials {
+  float du_dx, du_dy;
+  float dv_dx, dv_dy;
+};
+
 struct BakeDataZSpan {
   BakePixel *pixel_array;
-  int primitive_id;
   BakeImage *bk_image;
-  ZSpan *zspan;
-  float du_dx, du_dy;
-  float dv_dx, dv_dy;
+  /* Indexed by the rasterized triangles of the image. */
+  const int *primitive_ids;
+  const BakeDifferentials *differentials;
 };
 
 /**
@@ -100,7 +104,7 @@ struct TriTessFace {
   bool is_smooth;
 };
 
-static void store_bake_pixel(void *handle, int x, int y, float u, float v)
+static void store_bake_pixel(void *handle, int tri, int x, int y, float u, float v)
 {
   BakeDataZSpan *bd = (BakeDataZSpan *)handle;
   BakePixel *pixel;
@@ -108,19 +112,20 @@ static void store_bake_pixel(void *handle, int x, int y, float u, float v)
   const int width = bd->bk_image->width;
   const size_t offset = bd->bk_image->offset;
   const int i = offset + y * width + x;
+  const BakeDifferentials *differentials = &bd->differentials[tri];
 
   pixel = &bd->pixel_array[i];
-  pixel->primitive_id = bd->primitive_id;
+  pixel->primitive_id = bd->primitive_ids[tri];
 
   /* At this point object_id is always 0, since this function runs for the
    * low-poly mesh only. The object_id lookup indices are set afterwards. */
 
   copy_v2_fl2(pixel->uv, u, v);
 
-  pixel->du_dx = bd->du_dx;
-  pixel->du_dy = bd->du_dy;
-  pixel->dv_dx = bd->dv_dx;
-  pixel->dv_dy = bd->dv_dy;
+  pixel->du_dx = differentials->du_dx;
+  pixel->du_dy = differentials->du_dy;
+  pixel->dv_dx = differentials->dv_dx;
+  pixel->dv_dy = differentials->dv_dy;
   pixel->object_id = 0;
   pixel->seed = i;
 }
@@ -683,7 +688,7 @@ cleanup:
   return result;
 }
 
-static void bake_differentials(BakeDataZSpan *bd,
+static void bake_differentials(BakeDifferentials *bd,
                                const float *uv1,
                                const float *uv2,
                                const float *uv3)
@@ -729,7 +734,6 @@ void RE_bake_pixels_populate(Mesh *me,
 
   BakeDataZSpan bd;
   bd.pixel_array = pixel_array;
-  bd.zspan = MEM_cnew_array<ZSpan>(targets->images_num, "bake zspan");
 
   /* initialize all pixel arrays so we know which ones are 'blank' */
   for (int i = 0; i < pixels_num; i++) {
@@ -737,10 +741,6 @@ void RE_bake_pixels_populate(Mesh *me,
     pixel_array[i].object_id = 0;
   }
 
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_alloc_span(&bd.zspan[i], targets->images[i].width, targets->images[i].height);
-  }
-
   const int tottri = poly_to_tri_count(me->totpoly, me->totloop);
   MLoopTri *looptri = static_cast<MLoopTri *>(MEM_mallocN(sizeof(*looptri) * tottri, __func__));
 
@@ -752,24 +752,33 @@ void RE_bake_pixels_populate(Mesh *me,
   const int *material_indices = BKE_mesh_material_indices(me);
   const int materials_num = targets->materials_num;
 
-  for (int i = 0; i < tottri; i++) {
-    const MLoopTri *lt = &looptri[i];
-
-    bd.primitive_id = i;
-
-    /* Find images matching this material. */
-    const int material_index = (material_indices && materials_num) ?
-                                   clamp_i(material_indices[lt->poly], 0, materials_num - 1) :
-                                   0;
-    Image *image = targets->material_to_image[material_index];
-    for (int image_id = 0; image_id < targets->images_num; image_id++) {
-      BakeImage *bk_image = &targets->images[image_id];
-      if (bk_image->image != image) {
+  /* The triangles of each image are gathered first and then rasterized in parallel. The images
+   * don't share pixels, so this gives the same result as rasterizing the triangles in order. */
+  float(*tri_coords)[3][2] = static_cast<float(*)[3][2]>(
+      MEM_malloc_arrayN(tottri, sizeof(*tri_coords), __func__));
+  int *primitive_ids = static_cast<int *>(MEM_malloc_arrayN(tottri, sizeof(int), __func__));
+  BakeDifferentials *differentials = static_cast<BakeDifferentials *>(
+      MEM_malloc_arrayN(tottri, sizeof(BakeDifferentials), __func__));
+  bd.primitive_ids = primitive_ids;
+  bd.differentials = differentials;
+
+  for (int image_id = 0; image_id < targets->images_num; image_id++) {
+    BakeImage *bk_image = &targets->images[image_id];
+    int image_tris_num = 0;
+
+    for (int i = 0; i < tottri; i++) {
+      const MLoopTri *lt = &looptri[i];
+
+      /* Only triangles with a material that uses this image. */
+      const int material_index = (material_indices && materials_num) ?
+                                     clamp_i(material_indices[lt->poly], 0, materials_num - 1) :
+                                     0;
+      if (targets->material_to_image[material_index] != bk_image->image) {
         continue;
       }
 
       /* Compute triangle vertex UV coordinates. */
-      float vec[3][2];
+      float(*vec)[2] = tri_coords[image_tris_num];
       for (int a = 0; a < 3; a++) {
         const float *uv = mloopuv[lt->tri[a]].uv;
 
@@ -781,20 +790,21 @@ void RE_bake_pixels_populate(Mesh *me,
         vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) - (0.5f + 0.002f);
       }
 
-      /* Rasterize triangle. */
-      bd.bk_image = bk_image;
-      bake_differentials(&bd, vec[0], vec[1], vec[2]);
-      zspan_scanconvert(
-          &bd.zspan[image_id], (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
+      bake_differentials(&differentials[image_tris_num], vec[0], vec[1], vec[2]);
+      primitive_ids[image_tris_num] = i;
+      image_tris_num++;
     }
-  }
 
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_free_span(&bd.zspan[i]);
+    /* Rasterize triangles. */
+    bd.bk_image = bk_image;
+    zspan_scanconvert_triangles(
+        bk_image->width, bk_image->height, tri_coords, image_tris_num, &bd, store_bake_pixel);
   }
 
+  MEM_freeN(tri_coords);
+  MEM_freeN(primitive_ids);
+  MEM_freeN(differentials);
   MEM_freeN(looptri);
-  MEM_freeN(bd.zspan);
 }
 
 /* ******************** NORMALS ************************ */
@@ -0,0 +1,284 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup render
+ *
+ * Compositing of final renders with the realtime compositor. The render passes are uploaded to
+ * GPU textures, the node tree is evaluated on the GPU and the output of the composite node is read
+ * back into the render result. Node trees that use nodes or passes that the realtime compositor
+ * does not support are composited with the CPU compositor instead.
+ */
+
+#include <string>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_listbase.h"
+#include "BLI_map.hh"
+#include "BLI_math_vec_types.hh"
+#include "BLI_string.h"
+#include "BLI_string_ref.hh"
+#include "BLI_threads.h"
+#include "BLI_vector.hh"
+
+#include "DNA_node_types.h"
+#include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
+
+#include "BKE_node.h"
+#include "BKE_node_runtime.hh"
+#include "BKE_report.h"
+
+#include "DRW_engine.h"
+
+#include "GPU_state.h"
+#include "GPU_texture.h"
+
+#include "NOD_derived_node_tree.hh"
+
+#include "COM_context.hh"
+#include "COM_evaluator.hh"
+#include "COM_texture_pool.hh"
+
+#include "RE_pipeline.h"
+
+#include "pipeline.h"
+#include "render_types.h"
+
+namespace blender::render {
+
+/* The compositor can be executed from multiple render jobs at the same time, while it uses the
+ * draw manager GPU context, so evaluations are serialized. */
+static ThreadMutex compositor_mutex = BLI_MUTEX_INITIALIZER;
+
+class TexturePool : public realtime_compositor::TexturePool {
+ private:
+  /* All textures allocated by the pool, which are freed when the pool is destructed. The pool only
+   * lives for the duration of a single compositor execution. */
+  Vector<GPUTexture *> textures_;
+
+ public:
+  ~TexturePool()
+  {
+    for (GPUTexture *texture : textures_) {
+      GPU_texture_free(texture);
+    }
+  }
+
+  GPUTexture *allocate_texture(int2 size, eGPUTextureFormat format) override
+  {
+    GPUTexture *texture = GPU_texture_create_2d(
+        "compositor_texture_pool", size.x, size.y, 1, format, nullptr);
+    textures_.append(texture);
+    return texture;
+  }
+};
+
+class Context : public realtime_compositor::Context {
+ private:
+  Render &render_;
+  const Scene &scene_;
+  const char *view_name_;
+
+  /* Texture the composite node writes to, allocated on first use. */
+  GPUTexture *output_texture_ = nullptr;
+  /* Render passes that were uploaded to the GPU, indexed by their view layer. Only the combined
+   * pass is supported by the Render Layers node of the realtime compositor. */
+  Map<int, GPUTexture *> input_textures_;
+
+ public:
+  Context(realtime_compositor::TexturePool &texture_pool,
+          Render &render,
+          const Scene &scene,
+          const char *view_name)
+      : realtime_compositor::Context(texture_pool),
+        render_(render),
+        scene_(scene),
+        view_name_(view_name)
+  {
+  }
+
+  ~Context()
+  {
+    if (output_texture_) {
+      GPU_texture_free(output_texture_);
+    }
+    for (GPUTexture *texture : input_textures_.values()) {
+      GPU_texture_free(texture);
+    }
+  }
+
+  const Scene *get_scene() const override
+  {
+    return &scene_;
+  }
+
+  int2 get_output_size() override
+  {
+    return int2(render_.result->rectx, render_.result->recty);
+  }
+
+  GPUTexture *get_output_texture() override
+  {
+    if (output_texture_ == nullptr) {
+      const int2 size = get_output_size();
+      output_texture_ = GPU_texture_create_2d(
+          "compositor_output_texture", size.x, size.y, 1, GPU_RGBA16F, nullptr);
+      const float clear_color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      GPU_texture_clear(output_texture_, GPU_DATA_FLOAT, clear_color);
+    }
+    return output_texture_;
+  }
+
+  GPUTexture *get_input_texture(int view_layer, eScenePassType pass_type) override
+  {
+    BLI_assert(pass_type == SCE_PASS_COMBINED);
+    UNUSED_VARS_NDEBUG(pass_type);
+    return input_textures_.lookup_or_add_cb(view_layer, [&]() {
+      return create_combined_pass_texture(view_layer);
+    });
+  }
+
+  StringRef get_view_name() override
+  {
+    return view_name_;
+  }
+
+  void set_info_message(StringRef message) const override
+  {
+    BKE_report(render_.reports, RPT_WARNING, std::string(message).c_str());
+  }
+
+  bool use_viewer_output() const override
+  {
+    return false;
+  }
+
+  /* Read the output texture back and store it in the render result of the view. */
+  void write_output()
+  {
+    if (output_texture_ == nullptr) {
+      return;
+    }
+
+    GPU_memory_barrier(GPU_BARRIER_TEXTURE_UPDATE);
+    float *pixels = static_cast<float *>(GPU_texture_read(output_texture_, GPU_DATA_FLOAT, 0));
+
+    RenderResult *render_result = RE_AcquireResultWrite(&render_);
+    RenderView *render_view = render_result ?
+                                  RE_RenderViewGetByName(render_result, view_name_) :
+                                  nullptr;
+    if (render_view) {
+      MEM_SAFE_FREE(render_view->rectf);
+      render_view->rectf = pixels;
+      pixels = nullptr;
+    }
+    RE_ReleaseResult(&render_);
+
+    MEM_SAFE_FREE(pixels);
+  }
+
+ private:
+  GPUTexture *create_combined_pass_texture(const int view_layer_index)
+  {
+    const int2 size = get_output_size();
+    GPUTexture *texture = GPU_texture_create_2d(
+        "compositor_input_texture", size.x, size.y, 1, GPU_RGBA32F, nullptr);
+
+    const ViewLayer *view_layer = static_cast<const ViewLayer *>(
+        BLI_findlink(&scene_.view_layers, view_layer_index));
+    RenderLayer *render_layer = view_layer ? RE_GetRenderLayer(render_.result, view_layer->name) :
+                                             nullptr;
+    RenderPass *pass = render_layer ?
+                           RE_pass_find_by_type(render_layer, SCE_PASS_COMBINED, view_name_) :
+                           nullptr;
+
+    if (pass && pass->rect && pass->channels == 4 && pass->rectx == size.x &&
+        pass->recty == size.y) {
+      GPU_texture_update(texture, GPU_DATA_FLOAT, pass->rect);
+    }
+    else {
+      const float clear_color[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+      GPU_texture_clear(texture, GPU_DATA_FLOAT, clear_color);
+    }
+    return texture;
+  }
+};
+
+/* Check if the node tree can be evaluated by the realtime compositor for a final render. Nodes
+ * without a GPU implementation, Render Layers nodes that use other passes than the combined pass
+ * or other scenes, and trees without a composite output are left to the CPU compositor. */
+static bool is_node_tree_supported(const Scene &scene, const bNodeTree &node_tree)
+{
+  const nodes::DerivedNodeTree tree(node_tree);
+  if (tree.has_link_cycles() || tree.has_undefined_nodes_or_sockets()) {
+    return false;
+  }
+
+  bool is_supported = true;
+  bool has_composite_output = false;
+  tree.foreach_node([&](const nodes::DNode node) {
+    if (node->is_muted() || node->is_group() || node->is_group_input() ||
+        node->is_group_output() || node->is_reroute()) {
+      return;
+    }
+    if (!node->typeinfo->get_compositor_operation &&
+        !node->typeinfo->get_compositor_shader_node) {
+      is_supported = false;
+      return;
+    }
+    if (node->typeinfo->realtime_compositor_unsupported_message) {
+      is_supported = false;
+      return;
+    }
+    if (node->type == CMP_NODE_COMPOSITE) {
+      has_composite_output = true;
+    }
+    if (node->type == CMP_NODE_R_LAYERS) {
+      if (node->id != nullptr && node->id != &scene.id) {
+        is_supported = false;
+        return;
+      }
+      for (const bNodeSocket *output : node->output_sockets()) {
+        if (output->is_directly_linked() && !STR_ELEM(output->name, "Image", "Alpha")) {
+          is_supported = false;
+          return;
+        }
+      }
+    }
+  });
+
+  return is_supported && has_composite_output;
+}
+
+}  // namespace blender::render
+
+bool RE_compositor_execute(Render *re, Scene *scene, bNodeTree *node_tree, const char *view_name)
+{
+  using namespace blender::render;
+
+  if (!U.experimental.use_realtime_compositor ||
+      node_tree->execution_mode != NTREE_EXECUTION_MODE_GPU) {
+    return false;
+  }
+
+  if (!is_node_tree_supported(*scene, *node_tree)) {
+    return false;
+  }
+
+  BLI_mutex_lock(&compositor_mutex);
+  DRW_render_context_enable(re);
+
+  {
+    TexturePool texture_pool;
+    Context context(texture_pool, *re, *scene, view_name);
+    blender::realtime_compositor::Evaluator evaluator(context);
+    evaluator.evaluate();
+    context.write_output();
+  }
+
+  DRW_render_context_disable(re);
+  BLI_mutex_unlock(&compositor_mutex);
+
+  return true;
+}
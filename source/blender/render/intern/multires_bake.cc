@@ -52,13 +52,27 @@ using MPassKnownData = void (*)(DerivedMesh *lores_dm,
                                 const int x,
                                 const int y);
 
-using MInitBakeData = void *(*)(MultiresBakeRender *bkr, ImBuf *ibuf);
+struct MultiresBakeSharedData;
+
+using MInitBakeData = void *(*)(MultiresBakeRender *bkr,
+                                const MultiresBakeSharedData *shared,
+                                ImBuf *ibuf);
 using MFreeBakeData = void (*)(void *bake_data);
 
 struct MultiresBakeResult {
   float height_min, height_max;
 };
 
+/* Data derived from the low resolution mesh, computed once and shared by all images and tiles
+ * that are baked. */
+struct MultiresBakeSharedData {
+  Mesh *temp_mesh;
+  const float (*vert_normals)[3];
+  const float (*poly_normals)[3];
+  /* Subdivided low resolution mesh for displacement baking, can be null. */
+  DerivedMesh *ssdm;
+};
+
 struct MResolvePixelData {
   MVert *mvert;
   const float (*vert_normals)[3];
@@ -334,9 +348,16 @@ static int multiresbake_test_break(MultiresBakeRender *bkr)
 
 /* **** Threading routines **** */
 
+/* Number of triangles a thread takes from the queue at once. */
+#define MULTIRES_BAKE_QUEUE_CHUNK 32
+
 struct MultiresBakeQueue {
+  /* Triangles that use the image and overlap the tile. */
+  const int *tris;
   int cur_tri;
   int tot_tri;
+  /* Number of triangles of the mesh, for progress reports. */
+  int mesh_tot_tri;
   SpinLock spin;
 };
 
@@ -355,22 +376,21 @@ struct MultiresBakeThread {
   float height_min, height_max;
 };
 
-static int multires_bake_queue_next_tri(MultiresBakeQueue *queue)
+/* Take the next chunk of triangles from the queue, returns the number of triangles. Neighboring
+ * triangles are usually close in the image, which helps memory cache utilization. */
+static int multires_bake_queue_next_tris(MultiresBakeQueue *queue, int *r_tri_start)
 {
-  int face = -1;
-
-  /* TODO: it could worth making it so thread will handle neighbor faces
-   *       for better memory cache utilization
-   */
+  int tris_num = 0;
 
   BLI_spin_lock(&queue->spin);
   if (queue->cur_tri < queue->tot_tri) {
-    face = queue->cur_tri;
-    queue->cur_tri++;
+    *r_tri_start = queue->cur_tri;
+    tris_num = min_ii(MULTIRES_BAKE_QUEUE_CHUNK, queue->tot_tri - queue->cur_tri);
+    queue->cur_tri += tris_num;
   }
   BLI_spin_unlock(&queue->spin);
 
-  return face;
+  return tris_num;
 }
 
 static void *do_multires_bake_thread(void *data_v)
@@ -379,30 +399,28 @@ static void *do_multires_bake_thread(void *data_v)
   MResolvePixelData *data = &handle->data;
   MBakeRast *bake_rast = &handle->bake_rast;
   MultiresBakeRender *bkr = handle->bkr;
-  int tri_index;
-
-  while ((tri_index = multires_bake_queue_next_tri(handle->queue)) >= 0) {
-    const MLoopTri *lt = &data->mlooptri[tri_index];
-    const short mat_nr = data->material_indices == nullptr ? 0 : data->material_indices[lt->poly];
-    const MLoopUV *mloopuv = data->mloopuv;
+  MultiresBakeQueue *queue = handle->queue;
+  int tri_start, tris_num;
 
+  while ((tris_num = multires_bake_queue_next_tris(queue, &tri_start)) > 0) {
     if (multiresbake_test_break(bkr)) {
       break;
     }
 
-    Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : nullptr;
-    if (tri_image != handle->image) {
-      continue;
-    }
+    for (int i = tri_start; i < tri_start + tris_num; i++) {
+      const int tri_index = queue->tris[i];
+      const MLoopTri *lt = &data->mlooptri[tri_index];
+      const MLoopUV *mloopuv = data->mloopuv;
 
-    data->tri_index = tri_index;
+      data->tri_index = tri_index;
 
-    float uv[3][2];
-    sub_v2_v2v2(uv[0], mloopuv[lt->tri[0]].uv, data->uv_offset);
-    sub_v2_v2v2(uv[1], mloopuv[lt->tri[1]].uv, data->uv_offset);
-    sub_v2_v2v2(uv[2], mloopuv[lt->tri[2]].uv, data->uv_offset);
+      float uv[3][2];
+      sub_v2_v2v2(uv[0], mloopuv[lt->tri[0]].uv, data->uv_offset);
+      sub_v2_v2v2(uv[1], mloopuv[lt->tri[1]].uv, data->uv_offset);
+      sub_v2_v2v2(uv[2], mloopuv[lt->tri[2]].uv, data->uv_offset);
 
-    bake_rasterize(bake_rast, uv[0], uv[1], uv[2]);
+      bake_rasterize(bake_rast, uv[0], uv[1], uv[2]);
+    }
 
     /* tag image buffer for refresh */
     if (data->ibuf->rect_float) {
@@ -412,8 +430,8 @@ static void *do_multires_bake_thread(void *data_v)
     data->ibuf->userflags |= IB_DISPLAY_BUFFER_INVALID;
 
     /* update progress */
-    BLI_spin_lock(&handle->queue->spin);
-    bkr->baked_faces++;
+    BLI_spin_lock(&queue->spin);
+    bkr->baked_faces += tris_num;
 
     if (bkr->do_update) {
       *bkr->do_update = true;
@@ -421,10 +439,10 @@ static void *do_multires_bake_thread(void *data_v)
 
     if (bkr->progress) {
       *bkr->progress = (float(bkr->baked_objects) +
-                        float(bkr->baked_faces) / handle->queue->tot_tri) /
+                        min_ff(float(bkr->baked_faces) / queue->mesh_tot_tri, 1.0f)) /
                        bkr->tot_obj;
     }
-    BLI_spin_unlock(&handle->queue->spin);
+    BLI_spin_unlock(&queue->spin);
   }
 
   return nullptr;
@@ -451,7 +469,48 @@ static void init_ccgdm_arrays(DerivedMesh *dm)
   (void)grid_offset;
 }
 
+/* Gather the triangles that use the image and whose UVs overlap the tile, so that every tile only
+ * has to rasterize its own triangles. */
+static int multires_bake_tile_tris(MultiresBakeRender *bkr,
+                                   Image *ima,
+                                   const float uv_offset[2],
+                                   int *r_tris)
+{
+  DerivedMesh *dm = bkr->lores_dm;
+  const MLoopTri *mlooptri = dm->getLoopTriArray(dm);
+  const int tot_tri = dm->getNumLoopTri(dm);
+  const MLoopUV *mloopuv = static_cast<const MLoopUV *>(dm->getLoopDataArray(dm, CD_MLOOPUV));
+  const int *material_indices = static_cast<const int *>(
+      CustomData_get_layer_named(&dm->polyData, CD_PROP_INT32, "material_index"));
+
+  int tris_num = 0;
+  for (int i = 0; i < tot_tri; i++) {
+    const MLoopTri *lt = &mlooptri[i];
+    const short mat_nr = material_indices == nullptr ? 0 : material_indices[lt->poly];
+    Image *tri_image = mat_nr < bkr->ob_image.len ? bkr->ob_image.array[mat_nr] : nullptr;
+    if (tri_image != ima) {
+      continue;
+    }
+
+    float uv_min[2] = {FLT_MAX, FLT_MAX};
+    float uv_max[2] = {-FLT_MAX, -FLT_MAX};
+    for (int a = 0; a < 3; a++) {
+      minmax_v2v2_v2(uv_min, uv_max, mloopuv[lt->tri[a]].uv);
+    }
+    sub_v2_v2(uv_min, uv_offset);
+    sub_v2_v2(uv_max, uv_offset);
+    if (uv_max[0] < 0.0f || uv_max[1] < 0.0f || uv_min[0] > 1.0f || uv_min[1] > 1.0f) {
+      continue;
+    }
+
+    r_tris[tris_num++] = i;
+  }
+
+  return tris_num;
+}
+
 static void do_multires_bake(MultiresBakeRender *bkr,
+                             const MultiresBakeSharedData *shared,
                              Image *ima,
                              ImageTile *tile,
                              ImBuf *ibuf,
@@ -469,6 +528,16 @@ static void do_multires_bake(MultiresBakeRender *bkr,
     return;
   }
 
+  float uv_offset[2];
+  BKE_image_get_tile_uv(ima, tile->tile_number, uv_offset);
+
+  int *tile_tris = static_cast<int *>(MEM_malloc_arrayN(tot_tri, sizeof(int), __func__));
+  const int tile_tot_tri = multires_bake_tile_tris(bkr, ima, uv_offset, tile_tris);
+  if (tile_tot_tri == 0) {
+    MEM_freeN(tile_tris);
+    return;
+  }
+
   MultiresBakeThread *handles;
   MultiresBakeQueue queue;
 
@@ -480,25 +549,14 @@ static void do_multires_bake(MultiresBakeRender *bkr,
 
   ListBase threads;
   int i, tot_thread = bkr->threads > 0 ? bkr->threads : BLI_system_thread_count();
+  /* No need for more threads than there are chunks of triangles. */
+  tot_thread = max_ii(
+      min_ii(tot_thread, divide_ceil_u(tile_tot_tri, MULTIRES_BAKE_QUEUE_CHUNK)), 1);
 
   void *bake_data = nullptr;
 
-  Mesh *temp_mesh = BKE_mesh_new_nomain(
-      dm->getNumVerts(dm), dm->getNumEdges(dm), 0, dm->getNumLoops(dm), dm->getNumPolys(dm));
-  memcpy(BKE_mesh_verts_for_write(temp_mesh),
-         dm->getVertArray(dm),
-         temp_mesh->totvert * sizeof(MVert));
-  memcpy(BKE_mesh_edges_for_write(temp_mesh),
-         dm->getEdgeArray(dm),
-         temp_mesh->totedge * sizeof(MEdge));
-  memcpy(BKE_mesh_polys_for_write(temp_mesh),
-         dm->getPolyArray(dm),
-         temp_mesh->totpoly * sizeof(MPoly));
-  memcpy(BKE_mesh_loops_for_write(temp_mesh),
-         dm->getLoopArray(dm),
-         temp_mesh->totloop * sizeof(MLoop));
-  const float(*vert_normals)[3] = BKE_mesh_vertex_normals_ensure(temp_mesh);
-  const float(*poly_normals)[3] = BKE_mesh_poly_normals_ensure(temp_mesh);
+  const float(*vert_normals)[3] = shared->vert_normals;
+  const float(*poly_normals)[3] = shared->poly_normals;
 
   if (require_tangent) {
     if (CustomData_get_layer_index(&dm->loopData, CD_TANGENT) == -1) {
@@ -528,7 +586,7 @@ static void do_multires_bake(MultiresBakeRender *bkr,
 
   /* all threads shares the same custom bake data */
   if (initBakeData) {
-    bake_data = initBakeData(bkr, ibuf);
+    bake_data = initBakeData(bkr, shared, ibuf);
   }
 
   if (tot_thread > 1) {
@@ -540,8 +598,10 @@ static void do_multires_bake(MultiresBakeRender *bkr,
   init_ccgdm_arrays(bkr->hires_dm);
 
   /* faces queue */
+  queue.tris = tile_tris;
   queue.cur_tri = 0;
-  queue.tot_tri = tot_tri;
+  queue.tot_tri = tile_tot_tri;
+  queue.mesh_tot_tri = tot_tri;
   BLI_spin_init(&queue.spin);
 
   /* fill in threads handles */
@@ -558,7 +618,7 @@ static void do_multires_bake(MultiresBakeRender *bkr,
     handle->data.mvert = mvert;
     handle->data.vert_normals = vert_normals;
     handle->data.mloopuv = mloopuv;
-    BKE_image_get_tile_uv(ima, tile->tile_number, handle->data.uv_offset);
+    copy_v2_v2(handle->data.uv_offset, uv_offset);
     handle->data.mlooptri = mlooptri;
     handle->data.mloop = mloop;
     handle->data.pvtangent = pvtangent;
@@ -591,11 +651,8 @@ static void do_multires_bake(MultiresBakeRender *bkr,
     do_multires_bake_thread(&handles[0]);
   }
 
-  /* construct bake result */
-  result->height_min = handles[0].height_min;
-  result->height_max = handles[0].height_max;
-
-  for (i = 1; i < tot_thread; i++) {
+  /* Construct bake result, the range of heights is shared by all tiles. */
+  for (i = 0; i < tot_thread; i++) {
     result->height_min = min_ff(result->height_min, handles[i].height_min);
     result->height_max = max_ff(result->height_max, handles[i].height_max);
   }
@@ -608,8 +665,7 @@ static void do_multires_bake(MultiresBakeRender *bkr,
   }
 
   MEM_freeN(handles);
-
-  BKE_id_free(nullptr, temp_mesh);
+  MEM_freeN(tile_tris);
 }
 
 /* mode = 0: interpolate normals,
@@ -768,7 +824,9 @@ static void interp_barycentric_mlooptri(DerivedMesh *dm,
 
 /* **************** Displacement Baker **************** */
 
-static void *init_heights_data(MultiresBakeRender *bkr, ImBuf *ibuf)
+static void *init_heights_data(MultiresBakeRender *bkr,
+                               const MultiresBakeSharedData *shared,
+                               ImBuf *ibuf)
 {
   MHeightBakeData *height_data;
   DerivedMesh *lodm = bkr->lores_dm;
@@ -782,23 +840,7 @@ static void *init_heights_data(MultiresBakeRender *bkr, ImBuf *ibuf)
   height_data = MEM_cnew<MHeightBakeData>("MultiresBake heightData");
 
   height_data->heights = userdata->displacement_buffer;
-
-  if (!bkr->use_lores_mesh) {
-    SubsurfModifierData smd = {{nullptr}};
-    int ss_lvl = bkr->tot_lvl - bkr->lvl;
-
-    CLAMP(ss_lvl, 0, 6);
-
-    if (ss_lvl > 0) {
-      smd.levels = smd.renderLevels = ss_lvl;
-      smd.uv_smooth = SUBSURF_UV_SMOOTH_PRESERVE_BOUNDARIES;
-      smd.quality = 3;
-
-      height_data->ssdm = subsurf_make_derived_from_derived(
-          bkr->lores_dm, &smd, bkr->scene, nullptr, SubsurfFlags(0));
-      init_ccgdm_arrays(height_data->ssdm);
-    }
-  }
+  height_data->ssdm = shared->ssdm;
 
   height_data->orig_index_mp_to_orig = static_cast<const int *>(
       lodm->getPolyDataArray(lodm, CD_ORIGINDEX));
@@ -810,10 +852,6 @@ static void free_heights_data(void *bake_data)
 {
   MHeightBakeData *height_data = (MHeightBakeData *)bake_data;
 
-  if (height_data->ssdm) {
-    height_data->ssdm->release(height_data->ssdm);
-  }
-
   MEM_freeN(height_data);
 }
 
@@ -910,7 +948,9 @@ static void apply_heights_callback(DerivedMesh *lores_dm,
 
 /* **************** Normal Maps Baker **************** */
 
-static void *init_normal_data(MultiresBakeRender *bkr, ImBuf * /*ibuf*/)
+static void *init_normal_data(MultiresBakeRender *bkr,
+                              const MultiresBakeSharedData * /*shared*/,
+                              ImBuf * /*ibuf*/)
 {
   MNormalBakeData *normal_data;
   DerivedMesh *lodm = bkr->lores_dm;
@@ -1107,7 +1147,9 @@ static void create_ao_raytree(MultiresBakeRender *bkr, MAOBakeData *ao_data)
   RE_rayobject_done(raytree);
 }
 
-static void *init_ao_data(MultiresBakeRender *bkr, ImBuf */*ibuf*/)
+static void *init_ao_data(MultiresBakeRender *bkr,
+                          const MultiresBakeSharedData */*shared*/,
+                          ImBuf */*ibuf*/)
 {
   MAOBakeData *ao_data;
   DerivedMesh *lodm = bkr->lores_dm;
@@ -1433,10 +1475,65 @@ static void count_images(MultiresBakeRender *bkr)
   }
 }
 
+static void multires_bake_shared_data_init(MultiresBakeRender *bkr,
+                                           MultiresBakeSharedData *shared)
+{
+  DerivedMesh *dm = bkr->lores_dm;
+
+  Mesh *temp_mesh = BKE_mesh_new_nomain(
+      dm->getNumVerts(dm), dm->getNumEdges(dm), 0, dm->getNumLoops(dm), dm->getNumPolys(dm));
+  memcpy(BKE_mesh_verts_for_write(temp_mesh),
+         dm->getVertArray(dm),
+         temp_mesh->totvert * sizeof(MVert));
+  memcpy(BKE_mesh_edges_for_write(temp_mesh),
+         dm->getEdgeArray(dm),
+         temp_mesh->totedge * sizeof(MEdge));
+  memcpy(BKE_mesh_polys_for_write(temp_mesh),
+         dm->getPolyArray(dm),
+         temp_mesh->totpoly * sizeof(MPoly));
+  memcpy(BKE_mesh_loops_for_write(temp_mesh),
+         dm->getLoopArray(dm),
+         temp_mesh->totloop * sizeof(MLoop));
+  shared->temp_mesh = temp_mesh;
+  shared->vert_normals = BKE_mesh_vertex_normals_ensure(temp_mesh);
+  shared->poly_normals = BKE_mesh_poly_normals_ensure(temp_mesh);
+
+  shared->ssdm = nullptr;
+  if (bkr->mode == RE_BAKE_DISPLACEMENT && !bkr->use_lores_mesh) {
+    SubsurfModifierData smd = {{nullptr}};
+    int ss_lvl = bkr->tot_lvl - bkr->lvl;
+
+    CLAMP(ss_lvl, 0, 6);
+
+    if (ss_lvl > 0) {
+      smd.levels = smd.renderLevels = ss_lvl;
+      smd.uv_smooth = SUBSURF_UV_SMOOTH_PRESERVE_BOUNDARIES;
+      smd.quality = 3;
+
+      shared->ssdm = subsurf_make_derived_from_derived(
+          bkr->lores_dm, &smd, bkr->scene, nullptr, SubsurfFlags(0));
+      init_ccgdm_arrays(shared->ssdm);
+    }
+  }
+}
+
+static void multires_bake_shared_data_free(MultiresBakeSharedData *shared)
+{
+  if (shared->ssdm) {
+    shared->ssdm->release(shared->ssdm);
+  }
+  BKE_id_free(nullptr, shared->temp_mesh);
+}
+
 static void bake_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
 {
   LinkData *link;
 
+  /* The subdivided mesh and normals don't depend on the image, so they are computed once instead
+   * of for every image and tile. */
+  MultiresBakeSharedData shared;
+  multires_bake_shared_data_init(bkr, &shared);
+
   for (link = static_cast<LinkData *>(bkr->image.first); link; link = link->next) {
     Image *ima = (Image *)link->data;
 
@@ -1455,6 +1552,7 @@ static void bake_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
         switch (bkr->mode) {
           case RE_BAKE_NORMALS:
             do_multires_bake(bkr,
+                             &shared,
                              ima,
                              tile,
                              ibuf,
@@ -1466,6 +1564,7 @@ static void bake_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
             break;
           case RE_BAKE_DISPLACEMENT:
             do_multires_bake(bkr,
+                             &shared,
                              ima,
                              tile,
                              ibuf,
@@ -1478,7 +1577,7 @@ static void bake_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
             /* TODO: restore ambient occlusion baking support. */
 #if 0
           case RE_BAKE_AO:
-            do_multires_bake(bkr, ima, tile, ibuf, false, apply_ao_callback, init_ao_data, free_ao_data, result);
+            do_multires_bake(bkr, &shared, ima, tile, ibuf, false, apply_ao_callback, init_ao_data, free_ao_data, result);
             break;
 #endif
         }
@@ -1489,6 +1588,8 @@ static void bake_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
 
     ima->id.tag |= LIB_TAG_DOIT;
   }
+
+  multires_bake_shared_data_free(&shared);
 }
 
 static void finish_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
@@ -1560,6 +1661,8 @@ static void finish_images(MultiresBakeRender *bkr, MultiresBakeResult *result)
 void RE_multires_bake_images(MultiresBakeRender *bkr)
 {
   MultiresBakeResult result;
+  result.height_min = FLT_MAX;
+  result.height_max = -FLT_MAX;
 
   count_images(bkr);
   bake_images(bkr, &result);
@@ -31,6 +31,8 @@
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_timecode.h"
 #include "BLI_vector.hh"
@@ -155,12 +157,15 @@ static void render_callback_exec_id(Render *re, Main *bmain, ID *id, eCbEvent ev
 /** \name Allocation & Free
  * \{ */
 
+struct RenderWriteQueue;
+
 static bool do_write_image_or_movie(Render *re,
                                     Main *bmain,
                                     Scene *scene,
                                     bMovieHandle *mh,
                                     const int totvideos,
-                                    const char *name_override);
+                                    const char *name_override,
+                                    RenderWriteQueue *write_queue);
 
 /* default callbacks, set in each new render */
 static void result_nothing(void * /*arg*/, RenderResult * /*rr*/)
@@ -1171,6 +1176,9 @@ static void do_render_compositor(Render *re)
         }
 
         LISTBASE_FOREACH (RenderView *, rv, &re->result->views) {
+          if (RE_compositor_execute(re, re->pipeline_scene_eval, ntree, rv->name)) {
+            continue;
+          }
           ntreeCompositExecTree(
               re->pipeline_scene_eval, ntree, &re->r, true, G.background == 0, rv->name);
         }
@@ -1793,7 +1801,7 @@ void RE_RenderFrame(Render *re,
                                      nullptr);
 
         /* reports only used for Movie */
-        do_write_image_or_movie(re, bmain, scene, nullptr, 0, name);
+        do_write_image_or_movie(re, bmain, scene, nullptr, 0, name, nullptr);
       }
     }
 
@@ -1973,12 +1981,188 @@ bool RE_WriteRenderViewsMovie(ReportList *reports,
   return ok;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Asynchronous Writing of Animation Frames
+ *
+ * With #R_ASYNC_WRITE, frames of an animation render are saved by a background task while the
+ * next frame is rendered. Frames are written in order, which movies rely on. The callbacks that
+ * run after a frame is saved are delayed until its write has finished.
+ * \{ */
+
+/* Number of frames that can wait to be written, each keeps a copy of the render result. */
+#define MAX_SCHEDULED_WRITES 2
+
+struct RenderWriteQueue {
+  Render *re;
+  bMovieHandle *mh;
+  int totvideos;
+
+  TaskPool *task_pool;
+  ThreadMutex mutex;
+  ThreadCondition condition;
+  /* Protected by the mutex. */
+  int scheduled_num;
+  blender::Vector<int> written_frames;
+  bool ok;
+};
+
+struct RenderWriteTask {
+  RenderResult *rr;
+  /* Shallow copy of the scene with the settings of the frame, like #Scene.r.cfra. */
+  Scene scene;
+  RenderData rd;
+  bool is_movie;
+  char name[FILE_MAX];
+};
+
+static void render_write_task(TaskPool *__restrict pool, void *taskdata)
+{
+  RenderWriteQueue *queue = static_cast<RenderWriteQueue *>(BLI_task_pool_user_data(pool));
+  RenderWriteTask *task = static_cast<RenderWriteTask *>(taskdata);
+  Render *re = queue->re;
+
+  /* The reports of the render are used by other threads, so they are copied after writing. */
+  ReportList reports;
+  BKE_reports_init(&reports, re->reports ? (re->reports->flag & ~RPT_PRINT) : 0);
+
+  bool ok = true;
+  /* Writing may use multi-threading, don't let it pick up other tasks of the render. */
+  blender::threading::isolate_task([&]() {
+    if (task->is_movie) {
+      ok = RE_WriteRenderViewsMovie(&reports,
+                                    task->rr,
+                                    &task->scene,
+                                    &task->rd,
+                                    queue->mh,
+                                    re->movie_ctx_arr,
+                                    queue->totvideos,
+                                    false);
+    }
+    else {
+      ok = BKE_image_render_write(&reports, task->rr, &task->scene, true, task->name);
+    }
+  });
+
+  BLI_mutex_lock(&queue->mutex);
+  if (re->reports) {
+    LISTBASE_FOREACH (Report *, report, &reports.list) {
+      BKE_report(re->reports, static_cast<eReportType>(report->type), report->message);
+    }
+  }
+  if (ok) {
+    queue->written_frames.append(task->scene.r.cfra);
+  }
+  else {
+    queue->ok = false;
+  }
+  queue->scheduled_num--;
+  BLI_condition_notify_all(&queue->condition);
+  BLI_mutex_unlock(&queue->mutex);
+
+  BKE_reports_clear(&reports);
+}
+
+static void render_write_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  RenderWriteTask *task = static_cast<RenderWriteTask *>(taskdata);
+  RE_FreeRenderResult(task->rr);
+  MEM_freeN(task);
+}
+
+static RenderWriteQueue *render_write_queue_create(Render *re, bMovieHandle *mh, int totvideos)
+{
+  RenderWriteQueue *queue = MEM_new<RenderWriteQueue>(__func__);
+  queue->re = re;
+  queue->mh = mh;
+  queue->totvideos = totvideos;
+  queue->ok = true;
+  BLI_mutex_init(&queue->mutex);
+  BLI_condition_init(&queue->condition);
+  queue->task_pool = BLI_task_pool_create_background_serial(queue, TASK_PRIORITY_HIGH);
+  return queue;
+}
+
+/**
+ * Schedule writing a copy of the render result, waiting when too many frames are scheduled
+ * already. The render result must be acquired by the caller.
+ */
+static void render_write_queue_push(RenderWriteQueue *queue,
+                                    RenderResult *rr,
+                                    Scene *scene,
+                                    const RenderData *rd,
+                                    const bool is_movie,
+                                    const char *name)
+{
+  BLI_mutex_lock(&queue->mutex);
+  while (queue->scheduled_num >= MAX_SCHEDULED_WRITES) {
+    BLI_condition_wait(&queue->condition, &queue->mutex);
+  }
+  queue->scheduled_num++;
+  BLI_mutex_unlock(&queue->mutex);
+
+  RenderWriteTask *task = MEM_cnew<RenderWriteTask>(__func__);
+  task->rr = RE_DuplicateRenderResult(rr);
+  memcpy(&task->scene, scene, sizeof(task->scene));
+  memcpy(&task->rd, rd, sizeof(task->rd));
+  task->is_movie = is_movie;
+  BLI_strncpy(task->name, name, sizeof(task->name));
+
+  BLI_task_pool_push(queue->task_pool, render_write_task, task, false, render_write_task_free);
+}
+
+/**
+ * Run the callbacks of the frames that were written since the last call, with the frame of the
+ * scene temporarily set to the written frame.
+ *
+ * \return False when writing a frame failed.
+ */
+static bool render_write_queue_flush(RenderWriteQueue *queue, Scene *scene)
+{
+  Render *re = queue->re;
+
+  BLI_mutex_lock(&queue->mutex);
+  blender::Vector<int> written_frames = std::move(queue->written_frames);
+  queue->written_frames.clear();
+  const bool ok = queue->ok;
+  BLI_mutex_unlock(&queue->mutex);
+
+  if (written_frames.is_empty()) {
+    return ok;
+  }
+
+  const int cfra = scene->r.cfra;
+  for (const int frame : written_frames) {
+    if (G.is_break) {
+      break;
+    }
+    scene->r.cfra = frame;
+    render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
+    render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
+  }
+  scene->r.cfra = cfra;
+
+  return ok;
+}
+
+/** Wait for all frames to be written and free the queue. */
+static void render_write_queue_free(RenderWriteQueue *queue)
+{
+  BLI_task_pool_work_and_wait(queue->task_pool);
+  BLI_task_pool_free(queue->task_pool);
+  BLI_condition_end(&queue->condition);
+  BLI_mutex_end(&queue->mutex);
+  MEM_delete(queue);
+}
+
+/** \} */
+
 static bool do_write_image_or_movie(Render *re,
                                     Main *bmain,
                                     Scene *scene,
                                     bMovieHandle *mh,
                                     const int totvideos,
-                                    const char *name_override)
+                                    const char *name_override,
+                                    RenderWriteQueue *write_queue)
 {
   char name[FILE_MAX];
   RenderResult rres;
@@ -1995,8 +2179,13 @@ static bool do_write_image_or_movie(Render *re,
 
     /* write movie or image */
     if (BKE_imtype_is_movie(scene->r.im_format.imtype)) {
-      RE_WriteRenderViewsMovie(
-          re->reports, &rres, scene, &re->r, mh, re->movie_ctx_arr, totvideos, false);
+      if (write_queue) {
+        render_write_queue_push(write_queue, &rres, scene, &re->r, true, "");
+      }
+      else {
+        RE_WriteRenderViewsMovie(
+            re->reports, &rres, scene, &re->r, mh, re->movie_ctx_arr, totvideos, false);
+      }
     }
     else {
       if (name_override) {
@@ -2014,7 +2203,12 @@ static bool do_write_image_or_movie(Render *re,
       }
 
       /* write images as individual images or stereo */
-      ok = BKE_image_render_write(re->reports, &rres, scene, true, name);
+      if (write_queue) {
+        render_write_queue_push(write_queue, &rres, scene, &re->r, false, name);
+      }
+      else {
+        ok = BKE_image_render_write(re->reports, &rres, scene, true, name);
+      }
     }
 
     RE_ReleaseResultImageViews(re, &rres);
@@ -2033,7 +2227,7 @@ static bool do_write_image_or_movie(Render *re,
    * Not sure it's actually even used anyway, we could as well pass nullptr? */
   render_callback_exec_null(re, G_MAIN, BKE_CB_EVT_RENDER_STATS);
 
-  if (do_write_file) {
+  if (do_write_file && write_queue == nullptr) {
     BLI_timecode_string_from_time_simple(name, sizeof(name), re->i.lastframetime - render_time);
     printf(" (Saving: %s)\n", name);
   }
@@ -2159,6 +2353,15 @@ void RE_RenderAnim(Render *re,
     }
   }
 
+  /* Reuse the pass buffers of the previous frame. */
+  render_result_pass_buffer_pool_begin();
+
+  /* Write frames while the next one is rendered. */
+  RenderWriteQueue *write_queue = nullptr;
+  if (do_write_file && (rd.mode & R_ASYNC_WRITE)) {
+    write_queue = render_write_queue_create(re, mh, totvideos);
+  }
+
   /* Ugly global still... is to prevent renderwin events and signal subdivision-surface etc
    * to make full resolution is also set by caller renderwin.c */
   G.is_rendering = true;
@@ -2283,7 +2486,7 @@ void RE_RenderAnim(Render *re,
 
       if (re->test_break(re->tbh) == 0) {
         if (!G.is_break) {
-          if (!do_write_image_or_movie(re, bmain, scene, mh, totvideos, nullptr)) {
+          if (!do_write_image_or_movie(re, bmain, scene, mh, totvideos, nullptr, write_queue)) {
             G.is_break = true;
           }
         }
@@ -2326,17 +2529,35 @@ void RE_RenderAnim(Render *re,
 
       if (G.is_break == false) {
         /* keep after file save */
-        render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
-        render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
+        if (write_queue) {
+          if (!render_write_queue_flush(write_queue, scene)) {
+            G.is_break = true;
+          }
+        }
+        else {
+          render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
+          render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
+        }
       }
     }
   }
 
+  if (write_queue) {
+    /* Frames that are already scheduled are still written when the render is canceled. */
+    BLI_task_pool_work_and_wait(write_queue->task_pool);
+    if (G.is_break == false) {
+      render_write_queue_flush(write_queue, scene);
+    }
+    render_write_queue_free(write_queue);
+  }
+
   /* end movie */
   if (is_movie && do_write_file) {
     re_movie_free_all(re, mh, totvideos);
   }
 
+  render_result_pass_buffer_pool_end();
+
   if (totskipped && totrendered == 0) {
     BKE_report(re->reports, RPT_INFO, "No frames rendered, skipped to not overwrite");
   }
@@ -9,6 +9,8 @@
 
 struct ListBase;
 struct Render;
+struct Scene;
+struct bNodeTree;
 struct RenderData;
 struct RenderLayer;
 struct RenderResult;
@@ -20,6 +22,16 @@ extern "C" {
 struct RenderLayer *render_get_single_layer(struct Render *re, struct RenderResult *rr);
 void render_copy_renderdata(struct RenderData *to, struct RenderData *from);
 
+/**
+ * Composite the given view of the render result with the realtime compositor, when it is enabled
+ * for the node tree. Returns false when the CPU compositor has to be used instead, either because
+ * the GPU execution mode is not used or the node tree is not supported by the realtime compositor.
+ */
+bool RE_compositor_execute(struct Render *re,
+                           struct Scene *scene,
+                           struct bNodeTree *node_tree,
+                           const char *view_name);
+
 #ifdef __cplusplus
 }
 #endif
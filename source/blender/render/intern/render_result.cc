@@ -15,12 +15,14 @@
 #include "BLI_ghash.h"
 #include "BLI_hash_md5.h"
 #include "BLI_listbase.h"
+#include "BLI_map.hh"
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_appdir.h"
 #include "BKE_camera.h"
@@ -68,6 +70,91 @@ static void render_result_views_free(RenderResult *rr)
   rr->have_combined = false;
 }
 
+/********************************* Pass Buffer Pool *************************************/
+
+/* Animation renders allocate the same large pass buffers for every frame. While the pool is
+ * used, freed pass buffers are kept and cleared for reuse instead of being returned to the
+ * system, which avoids mapping and faulting in the same amount of memory for each frame again. */
+struct RenderPassBufferPool {
+  int users = 0;
+  /* Free buffers by their size in bytes. */
+  blender::Map<size_t, blender::Vector<float *>> buffers;
+};
+
+static ThreadMutex pass_buffer_pool_mutex = BLI_MUTEX_INITIALIZER;
+
+static RenderPassBufferPool &pass_buffer_pool_get()
+{
+  static RenderPassBufferPool pool;
+  return pool;
+}
+
+static void pass_buffer_pool_clear(RenderPassBufferPool &pool)
+{
+  for (blender::Vector<float *> &buffers : pool.buffers.values()) {
+    for (float *buffer : buffers) {
+      MEM_freeN(buffer);
+    }
+  }
+  pool.buffers.clear();
+}
+
+void render_result_pass_buffer_pool_begin()
+{
+  BLI_mutex_lock(&pass_buffer_pool_mutex);
+  pass_buffer_pool_get().users++;
+  BLI_mutex_unlock(&pass_buffer_pool_mutex);
+}
+
+void render_result_pass_buffer_pool_end()
+{
+  BLI_mutex_lock(&pass_buffer_pool_mutex);
+  RenderPassBufferPool &pool = pass_buffer_pool_get();
+  BLI_assert(pool.users > 0);
+  if (--pool.users == 0) {
+    pass_buffer_pool_clear(pool);
+  }
+  BLI_mutex_unlock(&pass_buffer_pool_mutex);
+}
+
+/* Allocate a zero initialized pass buffer, reusing a buffer from the pool when possible. */
+static float *pass_buffer_alloc(const size_t rectsize, const char *name)
+{
+  const size_t size = sizeof(float) * rectsize;
+  float *buffer = nullptr;
+
+  BLI_mutex_lock(&pass_buffer_pool_mutex);
+  RenderPassBufferPool &pool = pass_buffer_pool_get();
+  if (pool.users > 0) {
+    blender::Vector<float *> *buffers = pool.buffers.lookup_ptr(size);
+    if (buffers && !buffers->is_empty()) {
+      buffer = buffers->pop_last();
+    }
+  }
+  BLI_mutex_unlock(&pass_buffer_pool_mutex);
+
+  if (buffer) {
+    memset(buffer, 0, size);
+    return buffer;
+  }
+  return MEM_cnew_array<float>(rectsize, name);
+}
+
+static void pass_buffer_free(float *buffer)
+{
+  BLI_mutex_lock(&pass_buffer_pool_mutex);
+  RenderPassBufferPool &pool = pass_buffer_pool_get();
+  if (pool.users > 0) {
+    pool.buffers.lookup_or_add_default(MEM_allocN_len(buffer)).append(buffer);
+    buffer = nullptr;
+  }
+  BLI_mutex_unlock(&pass_buffer_pool_mutex);
+
+  if (buffer) {
+    MEM_freeN(buffer);
+  }
+}
+
 void render_result_free(RenderResult *rr)
 {
   if (rr == nullptr) {
@@ -80,7 +167,7 @@ void render_result_free(RenderResult *rr)
     while (rl->passes.first) {
       RenderPass *rpass = static_cast<RenderPass *>(rl->passes.first);
       if (rpass->rect) {
-        MEM_freeN(rpass->rect);
+        pass_buffer_free(rpass->rect);
       }
       BLI_remlink(&rl->passes, rpass);
       MEM_freeN(rpass);
@@ -170,7 +257,7 @@ static void render_layer_allocate_pass(RenderResult *rr, RenderPass *rp)
   }
 
   const size_t rectsize = size_t(rr->rectx) * rr->recty * rp->channels;
-  rp->rect = MEM_cnew_array<float>(rectsize, rp->name);
+  rp->rect = pass_buffer_alloc(rectsize, rp->name);
 
   if (STREQ(rp->name, RE_PASSNAME_VECTOR)) {
     /* initialize to max speed */
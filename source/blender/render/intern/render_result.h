@@ -43,6 +43,14 @@ struct RenderResult *render_result_new(struct Render *re,
 
 void render_result_passes_allocated_ensure(struct RenderResult *rr);
 
+/**
+ * Keep the pass buffers of freed render results for reuse by new render results, until the
+ * matching #render_result_pass_buffer_pool_end call. Used for animation renders, where every
+ * frame allocates the same passes.
+ */
+void render_result_pass_buffer_pool_begin(void);
+void render_result_pass_buffer_pool_end(void);
+
 /**
  * From `imbuf`, if a handle was returned and
  * it's not a single-layer multi-view we convert this to render result.
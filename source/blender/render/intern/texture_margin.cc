@@ -5,10 +5,12 @@
  * \ingroup render
  */
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vec_types.hh"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_DerivedMesh.h"
@@ -29,6 +31,7 @@
 #include "RE_texture_margin.h"
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <valarray>
 
@@ -39,9 +42,6 @@ namespace blender::render::texturemargin {
  * adjacency tables.
  */
 class TextureMarginMap {
-  static const int directions[8][2];
-  static const int distances[8];
-
   /** Maps UV-edges to their corresponding UV-edge. */
   Vector<int> loop_adjacency_map_;
   /** Maps UV-edges to their corresponding polygon. */
@@ -50,9 +50,6 @@ class TextureMarginMap {
   int w_, h_;
   float uv_offset_[2];
   Vector<uint32_t> pixel_data_;
-  ZSpan zspan_;
-  uint32_t value_to_store_;
-  char *mask_;
 
   MPoly const *mpoly_;
   MLoop const *mloop_;
@@ -84,16 +81,9 @@ class TextureMarginMap {
 
     pixel_data_.resize(w_ * h_, 0xFFFFFFFF);
 
-    zbuf_alloc_span(&zspan_, w_, h_);
-
     build_tables();
   }
 
-  ~TextureMarginMap()
-  {
-    zbuf_free_span(&zspan_);
-  }
-
   inline void set_pixel(int x, int y, uint32_t value)
   {
     BLI_assert(x < w_);
@@ -110,176 +100,207 @@ class TextureMarginMap {
     return pixel_data_[y * w_ + x];
   }
 
-  void rasterize_tri(float *v1, float *v2, float *v3, uint32_t value, char *mask)
+  struct RasterizeData {
+    TextureMarginMap *map;
+    const uint32_t *tri_polys;
+    char *mask;
+  };
+
+  /**
+   * Rasterize the triangles into the map, storing the polygon index of each triangle.
+   * The triangles are rasterized in parallel, see #zspan_scanconvert_triangles.
+   */
+  void rasterize_tris(const float (*coords)[3][2],
+                      const uint32_t *tri_polys,
+                      int tris_num,
+                      char *mask)
   {
-    /* NOTE: This is not thread safe, because the value to be written by the rasterizer is
-     * a class member. If this is ever made multi-threaded each thread needs to get its own. */
-    value_to_store_ = value;
-    mask_ = mask;
-    zspan_scanconvert(
-        &zspan_, this, &(v1[0]), &(v2[0]), &(v3[0]), TextureMarginMap::zscan_store_pixel);
+    RasterizeData data = {this, tri_polys, mask};
+    zspan_scanconvert_triangles(
+        w_, h_, coords, tris_num, &data, TextureMarginMap::zscan_store_pixel);
   }
 
-  static void zscan_store_pixel(
-      void *map, int x, int y, [[maybe_unused]] float u, [[maybe_unused]] float v)
+  static void zscan_store_pixel(void *handle,
+                                int tri,
+                                int x,
+                                int y,
+                                [[maybe_unused]] float u,
+                                [[maybe_unused]] float v)
   {
-    /* NOTE: Not thread safe, see comment above. */
-    TextureMarginMap *m = static_cast<TextureMarginMap *>(map);
-    m->set_pixel(x, y, m->value_to_store_);
-    if (m->mask_) {
-      m->mask_[y * m->w_ + x] = 1;
+    RasterizeData *data = static_cast<RasterizeData *>(handle);
+    TextureMarginMap *m = data->map;
+    m->set_pixel(x, y, data->tri_polys[tri]);
+    if (data->mask) {
+      data->mask[y * m->w_ + x] = 1;
     }
   }
 
-/* The map contains 2 kinds of pixels: DijkstraPixels and polygon indices. The top bit determines
- * what kind it is. With the top bit set, it is a 'dijkstra' pixel. The bottom 4 bits encode the
- * direction of the shortest path and the remaining 27 bits are used to store the distance. If
- * the top bit  is not set, the rest of the bits is used to store the polygon index.
+/* The map contains 3 kinds of pixels: polygon indices, margin pixels and unset pixels. Margin
+ * pixels have the top bit set, the rest of the bits is used to store the index of the nearest
+ * polygon. Pixels that are too far away from polygons have all bits set.
  */
-#define PackDijkstraPixel(dist, dir) (0x80000000 + ((dist) << 4) + (dir))
-#define DijkstraPixelGetDistance(dp) (((dp) ^ 0x80000000) >> 4)
-#define DijkstraPixelGetDirection(dp) ((dp)&0xF)
-#define IsDijkstraPixel(dp) ((dp)&0x80000000)
-#define DijkstraPixelIsUnset(dp) ((dp) == 0xFFFFFFFF)
+#define PackMarginPixel(poly) (0x80000000 | (poly))
+#define MarginPixelGetPolygon(dp) ((dp) & ~0x80000000)
+#define IsMarginPixel(dp) ((dp)&0x80000000)
+#define MarginPixelIsUnset(dp) ((dp) == 0xFFFFFFFF)
 
   /**
-   * Use dijkstra's algorithm to 'grow' a border around the polygons marked in the map.
-   * For each pixel mark which direction is the shortest way to a polygon.
+   * Use the jump flooding algorithm to 'grow' a border around the polygons marked in the map.
+   * For each pixel within the margin, mark which polygon has the nearest pixel.
+   *
+   * Every pass only reads the nearest pixels found by the previous pass, so all pixels of a pass
+   * are processed in parallel.
    */
-  void grow_dijkstra(int margin)
+  void grow_jump_flood(int margin)
   {
-    class DijkstraActivePixel {
-     public:
-      DijkstraActivePixel(int dist, int _x, int _y) : distance(dist), x(_x), y(_y)
-      {
+    const int pixels_num = w_ * h_;
+    /* Index of the nearest polygon pixel, or -1 when none was found yet. */
+    Array<int> nearest(pixels_num);
+    Array<int> nearest_next(pixels_num);
+
+    threading::parallel_for(IndexRange(pixels_num), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        nearest[i] = IsMarginPixel(pixel_data_[i]) ? -1 : i;
       }
-      int distance;
-      int x, y;
-    };
-    auto cmp_dijkstrapixel_fun = [](DijkstraActivePixel const &a1, DijkstraActivePixel const &a2) {
-      return a1.distance > a2.distance;
+    });
+
+    const int max_distance = margin + 1;
+    const int max_distance_sq = max_distance * max_distance;
+
+    auto distance_sq = [&](const int x, const int y, const int pixel) {
+      const int dx = pixel % w_ - x;
+      const int dy = pixel / w_ - y;
+      return dx * dx + dy * dy;
     };
 
-    Vector<DijkstraActivePixel> active_pixels;
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        if (DijkstraPixelIsUnset(get_pixel(x, y))) {
-          for (int i = 0; i < 8; i++) {
-            int xx = x - directions[i][0];
-            int yy = y - directions[i][1];
-
-            if (xx >= 0 && xx < w_ && yy >= 0 && yy < w_ && !IsDijkstraPixel(get_pixel(xx, yy))) {
-              set_pixel(x, y, PackDijkstraPixel(distances[i], i));
-              active_pixels.append(DijkstraActivePixel(distances[i], x, y));
-              break;
+    /* An additional pass with a step of one fixes most of the errors of the algorithm. */
+    Vector<int> steps;
+    for (int step = power_of_2_max_i(max_distance); step > 1; step /= 2) {
+      steps.append(step);
+    }
+    steps.append(1);
+    steps.append(1);
+
+    for (const int step : steps) {
+      threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+        for (const int y : rows) {
+          for (int x = 0; x < w_; x++) {
+            int best = nearest[y * w_ + x];
+            int best_dist_sq = (best == -1) ? INT_MAX : distance_sq(x, y, best);
+            for (int dy = -step; dy <= step; dy += step) {
+              const int yy = y + dy;
+              if (yy < 0 || yy >= h_) {
+                continue;
+              }
+              for (int dx = -step; dx <= step; dx += step) {
+                const int xx = x + dx;
+                if (xx < 0 || xx >= w_) {
+                  continue;
+                }
+                const int candidate = nearest[yy * w_ + xx];
+                if (candidate == -1 || candidate == best) {
+                  continue;
+                }
+                const int dist_sq = distance_sq(x, y, candidate);
+                /* Compare the indices as well, so that the result doesn't depend on the order
+                 * in which the neighbors are visited. */
+                if (dist_sq < best_dist_sq || (dist_sq == best_dist_sq && candidate < best)) {
+                  best = candidate;
+                  best_dist_sq = dist_sq;
+                }
+              }
             }
+            nearest_next[y * w_ + x] = best;
           }
         }
-      }
+      });
+      std::swap(nearest, nearest_next);
     }
 
-    /* Not strictly needed because at this point it already is a heap. */
-#if 0
-    std::make_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-#endif
-
-    while (active_pixels.size()) {
-      std::pop_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-      DijkstraActivePixel p = active_pixels.pop_last();
-
-      int dist = p.distance;
-
-      if (dist < 2 * (margin + 1)) {
-        for (int i = 0; i < 8; i++) {
-          int x = p.x + directions[i][0];
-          int y = p.y + directions[i][1];
-          if (x >= 0 && x < w_ && y >= 0 && y < h_) {
-            uint32_t dp = get_pixel(x, y);
-            if (IsDijkstraPixel(dp) && (DijkstraPixelGetDistance(dp) > dist + distances[i])) {
-              BLI_assert(DijkstraPixelGetDirection(dp) != i);
-              set_pixel(x, y, PackDijkstraPixel(dist + distances[i], i));
-              active_pixels.append(DijkstraActivePixel(dist + distances[i], x, y));
-              std::push_heap(active_pixels.begin(), active_pixels.end(), cmp_dijkstrapixel_fun);
-            }
+    threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        for (int x = 0; x < w_; x++) {
+          const int i = y * w_ + x;
+          if (!IsMarginPixel(pixel_data_[i]) || nearest[i] == -1) {
+            continue;
+          }
+          if (distance_sq(x, y, nearest[i]) <= max_distance_sq) {
+            pixel_data_[i] = PackMarginPixel(pixel_data_[nearest[i]]);
           }
         }
       }
-    }
+    });
   }
 
   /**
-   * Walk over the map and for margin pixels follow the direction stored in the bottom 3
-   * bits back to the polygon.
-   * Then look up the pixel from the next polygon.
+   * Walk over the map and for margin pixels look up the pixel from the polygon next to the
+   * nearest polygon.
+   *
+   * Pixels are read from a copy of the image, so that the margin pixels can be written in
+   * parallel without reading each other.
    */
   void lookup_pixels(ImBuf *ibuf, char *mask, int maxPolygonSteps)
   {
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        uint32_t dp = get_pixel(x, y);
-        if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
-          int dist = DijkstraPixelGetDistance(dp);
-          int direction = DijkstraPixelGetDirection(dp);
-
-          int xx = x;
-          int yy = y;
-
-          /* Follow the dijkstra directions to find the polygon this margin pixels belongs to. */
-          while (dist > 0) {
-            xx -= directions[direction][0];
-            yy -= directions[direction][1];
-            dp = get_pixel(xx, yy);
-            dist -= distances[direction];
-            BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
-            direction = DijkstraPixelGetDirection(dp);
-          }
-
-          uint32_t poly = get_pixel(xx, yy);
+    ImBuf *ibuf_src = IMB_dupImBuf(ibuf);
 
-          BLI_assert(!IsDijkstraPixel(poly));
-
-          float destX, destY;
-
-          int other_poly;
-          bool found_pixel_in_polygon = false;
-          if (lookup_pixel_polygon_neighbourhood(x, y, &poly, &destX, &destY, &other_poly)) {
+    threading::parallel_for(IndexRange(h_), 8, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        for (int x = 0; x < w_; x++) {
+          lookup_pixel_in_margin(ibuf_src, ibuf, mask, maxPolygonSteps, x, y);
+        }
+      }
+    });
 
-            for (int i = 0; i < maxPolygonSteps; i++) {
-              /* Force to pixel grid. */
-              int nx = int(round(destX));
-              int ny = int(round(destY));
-              uint32_t polygon_from_map = get_pixel(nx, ny);
-              if (other_poly == polygon_from_map) {
-                found_pixel_in_polygon = true;
-                break;
-              }
+    IMB_freeImBuf(ibuf_src);
+  }
 
-              float dist_to_edge;
-              /* Look up again, but starting from the polygon we were expected to land in. */
-              if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
-                found_pixel_in_polygon = false;
-                break;
-              }
-            }
+ private:
+  void lookup_pixel_in_margin(
+      const ImBuf *ibuf_src, ImBuf *ibuf, char *mask, int maxPolygonSteps, int x, int y)
+  {
+    uint32_t dp = get_pixel(x, y);
+    if (IsMarginPixel(dp) && !MarginPixelIsUnset(dp)) {
+      uint32_t poly = MarginPixelGetPolygon(dp);
+
+      float destX, destY;
+
+      int other_poly;
+      bool found_pixel_in_polygon = false;
+      if (lookup_pixel_polygon_neighbourhood(x, y, &poly, &destX, &destY, &other_poly)) {
+
+        for (int i = 0; i < maxPolygonSteps; i++) {
+          /* Force to pixel grid. */
+          int nx = int(round(destX));
+          int ny = int(round(destY));
+          uint32_t polygon_from_map = get_pixel(nx, ny);
+          if (other_poly == polygon_from_map) {
+            found_pixel_in_polygon = true;
+            break;
+          }
 
-            if (found_pixel_in_polygon) {
-              bilinear_interpolation(ibuf, ibuf, destX, destY, x, y);
-              /* Add our new pixels to the assigned pixel map. */
-              mask[y * w_ + x] = 1;
-            }
+          float dist_to_edge;
+          /* Look up again, but starting from the polygon we were expected to land in. */
+          if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
+            found_pixel_in_polygon = false;
+            break;
           }
         }
-        else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
-          /* These are not margin pixels, make sure the extend filter which is run after this step
-           * leaves them alone.
-           */
+
+        if (found_pixel_in_polygon) {
+          bilinear_interpolation(ibuf_src, ibuf, destX, destY, x, y);
+          /* Add our new pixels to the assigned pixel map. */
           mask[y * w_ + x] = 1;
         }
       }
     }
+    else if (MarginPixelIsUnset(dp) || !IsMarginPixel(dp)) {
+      /* These are not margin pixels, make sure the extend filter which is run after this step
+       * leaves them alone.
+       */
+      mask[y * w_ + x] = 1;
+    }
   }
 
- private:
   float2 uv_to_xy(MLoopUV const &mloopuv) const
   {
     float2 ret;
@@ -314,8 +335,8 @@ class TextureMarginMap {
 
   /**
    * Call lookup_pixel for the start_poly. If that fails, try the adjacent polygons as well.
-   * Because the Dijkstra is not very exact in determining which polygon is the closest, the
-   * polygon we need can be the one next to the one the Dijkstra map provides. To prevent missing
+   * Because the nearest polygon pixel is not necessarily on the polygon edge that is closest, the
+   * polygon we need can be the one next to the one the margin map provides. To prevent missing
    * pixels also check the neighboring polygons.
    */
   bool lookup_pixel_polygon_neighbourhood(
@@ -474,10 +495,6 @@ class TextureMarginMap {
   }
 };  // class TextureMarginMap
 
-const int TextureMarginMap::directions[8][2] = {
-    {-1, 0}, {-1, -1}, {0, -1}, {1, -1}, {1, 0}, {1, 1}, {0, 1}, {-1, 1}};
-const int TextureMarginMap::distances[8] = {2, 3, 2, 3, 2, 3, 2, 3};
-
 static void generate_margin(ImBuf *ibuf,
                             char *mask,
                             const int margin,
@@ -547,9 +564,14 @@ static void generate_margin(ImBuf *ibuf,
     draw_new_mask = true;
   }
 
+  float(*tri_coords)[3][2] = static_cast<float(*)[3][2]>(
+      MEM_malloc_arrayN(tottri, sizeof(*tri_coords), __func__));
+  uint32_t *tri_polys = static_cast<uint32_t *>(
+      MEM_malloc_arrayN(tottri, sizeof(uint32_t), __func__));
+
   for (int i = 0; i < tottri; i++) {
     const MLoopTri *lt = &looptri[i];
-    float vec[3][2];
+    float(*vec)[2] = tri_coords[i];
 
     for (int a = 0; a < 3; a++) {
       const float *uv = mloopuv[lt->tri[a]].uv;
@@ -562,19 +584,23 @@ static void generate_margin(ImBuf *ibuf,
       vec[a][1] = (uv[1] - uv_offset[1]) * float(ibuf->y) - (0.5f + 0.002f);
     }
 
-    /* NOTE: we need the top bit for the dijkstra distance map. */
-    BLI_assert(lt->poly < 0x80000000);
-
-    map.rasterize_tri(vec[0], vec[1], vec[2], lt->poly, draw_new_mask ? mask : nullptr);
+    /* NOTE: we need the top bit for the margin pixels. */
+    BLI_assert(lt->poly < 0x7FFFFFFF);
+    tri_polys[i] = lt->poly;
   }
 
+  map.rasterize_tris(tri_coords, tri_polys, tottri, draw_new_mask ? mask : nullptr);
+
+  MEM_freeN(tri_coords);
+  MEM_freeN(tri_polys);
+
   char *tmpmask = (char *)MEM_dupallocN(mask);
   /* Extend (with averaging) by 2 pixels. Those will be overwritten, but it
    *  helps linear interpolations on the edges of polygons. */
   IMB_filter_extend(ibuf, tmpmask, 2);
   MEM_freeN(tmpmask);
 
-  map.grow_dijkstra(margin);
+  map.grow_jump_flood(margin);
 
   /* Looking further than 3 polygons away leads to so much cumulative rounding
    * that it isn't worth it. So hard-code it to 3. */
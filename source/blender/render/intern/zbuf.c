@@ -17,6 +17,8 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_math_base.h"
+#include "BLI_task.h"
+#include "BLI_utildefines.h"
 
 /* own includes */
 #include "zbuf.h"
@@ -162,6 +164,18 @@ void zspan_scanconvert(ZSpan *zspan,
                        float *v2,
                        float *v3,
                        void (*func)(void *, int, int, float, float))
+{
+  zspan_scanconvert_rows(zspan, handle, v1, v2, v3, 0, zspan->recty - 1, func);
+}
+
+void zspan_scanconvert_rows(ZSpan *zspan,
+                            void *handle,
+                            float *v1,
+                            float *v2,
+                            float *v3,
+                            const int row_min,
+                            const int row_max,
+                            void (*func)(void *, int, int, float, float))
 {
   float x0, y0, x1, y1, x2, y2, z0, z1, z2;
   float u, v, uxd, uyd, vxd, vyd, uy0, vy0, xx1;
@@ -181,8 +195,8 @@ void zspan_scanconvert(ZSpan *zspan,
     return;
   }
 
-  my0 = max_ii(zspan->miny1, zspan->miny2);
-  my2 = min_ii(zspan->maxy1, zspan->maxy2);
+  my0 = max_iii(zspan->miny1, zspan->miny2, row_min);
+  my2 = min_iii(zspan->maxy1, zspan->maxy2, row_max);
 
   //  printf("my %d %d\n", my0, my2);
   if (my2 < my0) {
@@ -248,4 +262,134 @@ void zspan_scanconvert(ZSpan *zspan,
   }
 }
 
+/* Rows of the rect that are rasterized by a single task. */
+#define ZSPAN_BAND_ROWS 64
+
+typedef struct ZSpanTrianglesData {
+  int rectx, recty;
+  const float (*coords)[3][2];
+  void *handle;
+  ZSpanTriangleFunc func;
+
+  /* Triangles in each band, the triangles of band `i` are in
+   * `band_tris[band_offsets[i]]` to `band_tris[band_offsets[i + 1]]`. */
+  int *band_offsets;
+  int *band_tris;
+} ZSpanTrianglesData;
+
+typedef struct ZSpanTriangleHandle {
+  void *handle;
+  ZSpanTriangleFunc func;
+  int tri;
+} ZSpanTriangleHandle;
+
+static void zspan_triangle_pixel(void *handle, int x, int y, float u, float v)
+{
+  ZSpanTriangleHandle *tri_handle = (ZSpanTriangleHandle *)handle;
+  tri_handle->func(tri_handle->handle, tri_handle->tri, x, y, u, v);
+}
+
+/* Range of bands the triangle overlaps, false when the triangle is outside of the rect. */
+static bool zspan_triangle_bands(const ZSpanTrianglesData *data,
+                                 const float co[3][2],
+                                 int *r_band_min,
+                                 int *r_band_max)
+{
+  const float xmin = min_fff(co[0][0], co[1][0], co[2][0]);
+  const float xmax = max_fff(co[0][0], co[1][0], co[2][0]);
+  const float ymin = min_fff(co[0][1], co[1][1], co[2][1]);
+  const float ymax = max_fff(co[0][1], co[1][1], co[2][1]);
+  if (xmax < -1.0f || xmin > (float)data->rectx || ymax < 0.0f || ymin > (float)data->recty) {
+    return false;
+  }
+  const int row_min = max_ii((int)floorf(ymin), 0);
+  const int row_max = min_ii((int)ceilf(ymax), data->recty - 1);
+  if (row_min > row_max) {
+    return false;
+  }
+  *r_band_min = row_min / ZSPAN_BAND_ROWS;
+  *r_band_max = row_max / ZSPAN_BAND_ROWS;
+  return true;
+}
+
+static void zspan_scanconvert_band(void *__restrict userdata,
+                                   const int band,
+                                   const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ZSpanTrianglesData *data = userdata;
+  const int row_min = band * ZSPAN_BAND_ROWS;
+  const int row_max = min_ii(row_min + ZSPAN_BAND_ROWS, data->recty) - 1;
+
+  ZSpan zspan;
+  zbuf_alloc_span(&zspan, data->rectx, data->recty);
+
+  ZSpanTriangleHandle tri_handle;
+  tri_handle.handle = data->handle;
+  tri_handle.func = data->func;
+
+  for (int i = data->band_offsets[band]; i < data->band_offsets[band + 1]; i++) {
+    tri_handle.tri = data->band_tris[i];
+    float co[3][2];
+    memcpy(co, data->coords[tri_handle.tri], sizeof(co));
+    zspan_scanconvert_rows(
+        &zspan, &tri_handle, co[0], co[1], co[2], row_min, row_max, zspan_triangle_pixel);
+  }
+
+  zbuf_free_span(&zspan);
+}
+
+void zspan_scanconvert_triangles(const int rectx,
+                                 const int recty,
+                                 const float (*coords)[3][2],
+                                 const int tris_num,
+                                 void *handle,
+                                 ZSpanTriangleFunc func)
+{
+  if (rectx <= 0 || recty <= 0 || tris_num == 0) {
+    return;
+  }
+
+  ZSpanTrianglesData data;
+  data.rectx = rectx;
+  data.recty = recty;
+  data.coords = coords;
+  data.handle = handle;
+  data.func = func;
+
+  /* Sort the triangles into bands, keeping their order within each band. */
+  const int bands_num = (recty + ZSPAN_BAND_ROWS - 1) / ZSPAN_BAND_ROWS;
+  data.band_offsets = MEM_callocN(sizeof(int) * (bands_num + 1), __func__);
+  for (int tri = 0; tri < tris_num; tri++) {
+    int band_min, band_max;
+    if (zspan_triangle_bands(&data, coords[tri], &band_min, &band_max)) {
+      for (int band = band_min; band <= band_max; band++) {
+        data.band_offsets[band + 1]++;
+      }
+    }
+  }
+  for (int band = 0; band < bands_num; band++) {
+    data.band_offsets[band + 1] += data.band_offsets[band];
+  }
+
+  data.band_tris = MEM_mallocN(sizeof(int) * max_ii(data.band_offsets[bands_num], 1), __func__);
+  int *band_fill = MEM_dupallocN(data.band_offsets);
+  for (int tri = 0; tri < tris_num; tri++) {
+    int band_min, band_max;
+    if (zspan_triangle_bands(&data, coords[tri], &band_min, &band_max)) {
+      for (int band = band_min; band <= band_max; band++) {
+        data.band_tris[band_fill[band]++] = tri;
+      }
+    }
+  }
+  MEM_freeN(band_fill);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, bands_num, &data, zspan_scanconvert_band, &settings);
+
+  MEM_freeN(data.band_offsets);
+  MEM_freeN(data.band_tris);
+}
+
 /* end of zbuf.c */
@@ -36,6 +36,35 @@ void zspan_scanconvert(struct ZSpan *zspan,
                        float *v3,
                        void (*func)(void *, int, int, float, float));
 
+/**
+ * Same as #zspan_scanconvert, but only calls the function for rows in the given range.
+ */
+void zspan_scanconvert_rows(struct ZSpan *zspan,
+                            void *handle,
+                            float *v1,
+                            float *v2,
+                            float *v3,
+                            int row_min,
+                            int row_max,
+                            void (*func)(void *, int, int, float, float));
+
+typedef void (*ZSpanTriangleFunc)(void *handle, int tri, int x, int y, float u, float v);
+
+/**
+ * Scan-convert many triangles into a `rectx * recty` rect, calls function for each x, y
+ * coordinate covered by a triangle, with the index of the triangle.
+ *
+ * The rect is split into bands of rows which are rasterized in parallel, so the function must be
+ * thread safe for different rows. Within a row, triangles are visited in order, so overlapping
+ * triangles give the same result as calling #zspan_scanconvert for each triangle.
+ */
+void zspan_scanconvert_triangles(int rectx,
+                                 int recty,
+                                 const float (*coords)[3][2],
+                                 int tris_num,
+                                 void *handle,
+                                 ZSpanTriangleFunc func);
+
 #ifdef __cplusplus
 }
 #endif
@@ -32,6 +32,11 @@ void SEQ_proxy_rebuild(struct SeqIndexBuildContext *context,
                        bool *stop,
                        bool *do_update,
                        float *progress);
+/**
+ * Check if the proxy of the context can be built at the same time as proxies of other contexts,
+ * which is the case for movies, that are decoded and encoded with their own FFmpeg contexts.
+ */
+bool SEQ_proxy_rebuild_can_run_in_parallel(const struct SeqIndexBuildContext *context);
 void SEQ_proxy_rebuild_finish(struct SeqIndexBuildContext *context, bool stop);
 void SEQ_proxy_set(struct Sequence *seq, bool value);
 bool SEQ_can_use_proxy(const struct SeqRenderData *context, struct Sequence *seq, int psize);
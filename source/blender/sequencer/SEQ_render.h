@@ -59,6 +59,31 @@ struct ImBuf *SEQ_render_give_ibuf(const SeqRenderData *context,
 struct ImBuf *SEQ_render_give_ibuf_direct(const SeqRenderData *context,
                                           float timeline_frame,
                                           struct Sequence *seq);
+/**
+ * Get the strips whose images make up the frame, from the bottom to the top, when the frame can
+ * be composited by drawing the untransformed images with #SEQ_image_transform_final_quad_get and
+ * alpha over blending, e.g. on the GPU. That is the case when all strips are image or movie strips
+ * without modifiers or color adjustments, blended with Alpha Over or Replace.
+ *
+ * \param r_seq_arr: Array of #MAXSEQ + 1 strips.
+ * \return The number of strips, zero when the frame has to be rendered with
+ * #SEQ_render_give_ibuf.
+ */
+int SEQ_render_gpu_composite_strips_get(const SeqRenderData *context,
+                                        float timeline_frame,
+                                        int chanshown,
+                                        struct Sequence **r_seq_arr);
+/**
+ * Get the image of the strip in sequencer color space, before it is transformed, cropped and
+ * blended. Float images are premultiplied, byte images have straight alpha and are only returned
+ * when they are already in sequencer color space.
+ *
+ * 
+ote The returned #ImBuf has its reference increased, free after usage!
+ */
+struct ImBuf *SEQ_render_give_ibuf_raw(const SeqRenderData *context,
+                                       float timeline_frame,
+                                       struct Sequence *seq);
 /**
  * Render the series of thumbnails and store in cache.
  */
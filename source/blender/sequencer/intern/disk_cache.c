@@ -27,6 +27,7 @@
 #include "BLI_ghash.h"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
+#include "BLI_mmap.h"
 #include "BLI_path_util.h"
 #include "BLI_threads.h"
 
@@ -52,8 +53,10 @@
  * For each cached non-temp image, image data and supplementary info are written to HDD.
  * Multiple(DCACHE_IMAGES_PER_FILE) images share the same file.
  * Each of these files contains header DiskCacheHeader followed by image data.
- * Zlib compression with user definable level can be used to compress image data(per image)
+ * Zstd compression with user definable level can be used to compress image data(per image)
  * Images are written in order in which they are rendered.
+ * Files are memory-mapped for reading, image data is decompressed or copied from the mapped
+ * memory directly into the image buffer.
  * Overwriting of individual entry is not possible.
  * Stored images are deleted by invalidation, or when size of all files exceeds maximum
  * size specified in user preferences.
@@ -437,8 +440,47 @@ static size_t deflate_imbuf_to_file(ImBuf *ibuf,
   return fwrite(data, 1, header_entry->size_raw, file);
 }
 
+static size_t inflate_mmap_to_imbuf(ImBuf *ibuf,
+                                    BLI_mmap_file *mmap_file,
+                                    DiskCacheHeaderEntry *header_entry)
+{
+  void *data = (ibuf->rect != NULL) ? (void *)ibuf->rect : (void *)ibuf->rect_float;
+  char header[4];
+  if (!BLI_mmap_read(mmap_file, header, header_entry->offset, sizeof(header))) {
+    return 0;
+  }
+
+  /* Check if the data is compressed or raw. */
+  if (BLI_file_magic_is_zstd(header)) {
+    const char *mapped_data = BLI_mmap_get_pointer(mmap_file);
+    return BLI_file_unzstd_from_mem(data,
+                                    header_entry->size_raw,
+                                    mapped_data + header_entry->offset,
+                                    header_entry->size_compressed);
+  }
+
+  if (!BLI_mmap_read(mmap_file, data, header_entry->offset, header_entry->size_raw)) {
+    return 0;
+  }
+  return header_entry->size_raw;
+}
+
 static size_t inflate_file_to_imbuf(ImBuf *ibuf, FILE *file, DiskCacheHeaderEntry *header_entry)
 {
+  /* The mapping fails for files that are still empty, the entry can not be valid then anyway. */
+  const int fd = fileno(file);
+  if (header_entry->offset + header_entry->size_compressed > BLI_file_descriptor_size(fd)) {
+    return 0;
+  }
+
+  BLI_mmap_file *mmap_file = BLI_mmap_open(fd);
+  if (mmap_file != NULL) {
+    const size_t size = inflate_mmap_to_imbuf(ibuf, mmap_file, header_entry);
+    BLI_mmap_free(mmap_file);
+    return size;
+  }
+
+  /* Fall back to reading the file when it can't be memory-mapped. */
   void *data = (ibuf->rect != NULL) ? (void *)ibuf->rect : (void *)ibuf->rect_float;
   char header[4];
   fseek(file, header_entry->offset, SEEK_SET);
@@ -605,7 +647,6 @@ ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
   DiskCacheHeader header;
 
   seq_disk_cache_get_file_path(disk_cache, key, filepath, sizeof(filepath));
-  BLI_make_existing_file(filepath);
 
   FILE *file = BLI_fopen(filepath, "rb");
   if (!file) {
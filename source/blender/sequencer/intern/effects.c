@@ -18,6 +18,7 @@
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -1656,8 +1657,15 @@ static void copy_wipe_effect(Sequence *dst, Sequence *src, const int UNUSED(flag
   dst->effectdata = MEM_dupallocN(src->effectdata);
 }
 
-static void do_wipe_effect_byte(
-    Sequence *seq, float fac, int x, int y, uchar *rect1, uchar *rect2, uchar *out)
+static void do_wipe_effect_byte(Sequence *seq,
+                                float fac,
+                                int x,
+                                int y,
+                                int start_line,
+                                int total_lines,
+                                uchar *rect1,
+                                uchar *rect2,
+                                uchar *out)
 {
   WipeZone wipezone;
   WipeVars *wipe = (WipeVars *)seq->effectdata;
@@ -1667,7 +1675,7 @@ static void do_wipe_effect_byte(
   uchar *cp2 = rect2;
   uchar *rt = out;
 
-  for (int i = 0; i < y; i++) {
+  for (int i = start_line; i < start_line + total_lines; i++) {
     for (int j = 0; j < x; j++) {
       float check = check_zone(&wipezone, j, i, seq, fac);
       if (check) {
@@ -1717,8 +1725,15 @@ static void do_wipe_effect_byte(
   }
 }
 
-static void do_wipe_effect_float(
-    Sequence *seq, float fac, int x, int y, float *rect1, float *rect2, float *out)
+static void do_wipe_effect_float(Sequence *seq,
+                                 float fac,
+                                 int x,
+                                 int y,
+                                 int start_line,
+                                 int total_lines,
+                                 float *rect1,
+                                 float *rect2,
+                                 float *out)
 {
   WipeZone wipezone;
   WipeVars *wipe = (WipeVars *)seq->effectdata;
@@ -1728,7 +1743,7 @@ static void do_wipe_effect_float(
   float *rt2 = rect2;
   float *rt = out;
 
-  for (int i = 0; i < y; i++) {
+  for (int i = start_line; i < start_line + total_lines; i++) {
     for (int j = 0; j < x; j++) {
       float check = check_zone(&wipezone, j, i, seq, fac);
       if (check) {
@@ -1771,36 +1786,42 @@ static void do_wipe_effect_float(
   }
 }
 
-static ImBuf *do_wipe_effect(const SeqRenderData *context,
-                             Sequence *seq,
-                             float UNUSED(timeline_frame),
-                             float fac,
-                             ImBuf *ibuf1,
-                             ImBuf *ibuf2,
-                             ImBuf *ibuf3)
+static void do_wipe_effect(const SeqRenderData *context,
+                           Sequence *seq,
+                           float UNUSED(timeline_frame),
+                           float fac,
+                           ImBuf *ibuf1,
+                           ImBuf *ibuf2,
+                           ImBuf *UNUSED(ibuf3),
+                           int start_line,
+                           int total_lines,
+                           ImBuf *out)
 {
-  ImBuf *out = prepare_effect_imbufs(context, ibuf1, ibuf2, ibuf3);
+  /* The wipe zone depends on the position in the whole image, so the slice is passed along. */
+  const int offset = 4 * start_line * context->rectx;
 
   if (out->rect_float) {
     do_wipe_effect_float(seq,
                          fac,
                          context->rectx,
                          context->recty,
-                         ibuf1->rect_float,
-                         ibuf2->rect_float,
-                         out->rect_float);
+                         start_line,
+                         total_lines,
+                         ibuf1->rect_float ? ibuf1->rect_float + offset : NULL,
+                         ibuf2->rect_float ? ibuf2->rect_float + offset : NULL,
+                         out->rect_float + offset);
   }
   else {
     do_wipe_effect_byte(seq,
                         fac,
                         context->rectx,
                         context->recty,
-                        (uchar *)ibuf1->rect,
-                        (uchar *)ibuf2->rect,
-                        (uchar *)out->rect);
+                        start_line,
+                        total_lines,
+                        ibuf1->rect ? (uchar *)ibuf1->rect + offset : NULL,
+                        ibuf2->rect ? (uchar *)ibuf2->rect + offset : NULL,
+                        (uchar *)out->rect + offset);
   }
-
-  return out;
 }
 
 /** \} */
@@ -1965,6 +1986,117 @@ static void do_transform_effect(const SeqRenderData *context,
 /** \name Glow Effect
  * \{ */
 
+typedef struct GlowBlurData {
+  const float *map;
+  float *temp;
+  const float *filter;
+  int width;
+  int height;
+  int halfWidth;
+} GlowBlurData;
+
+static void glow_blur_row_fn(void *__restrict userdata,
+                             const int y,
+                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const GlowBlurData *data = (const GlowBlurData *)userdata;
+  const float *map = data->map;
+  float *temp = data->temp;
+  const float *filter = data->filter;
+  const int width = data->width;
+  const int halfWidth = data->halfWidth;
+  int x, i, fx, index;
+  float curColor[4], curColor2[4];
+
+  /* Do the left & right strips */
+  for (x = 0; x < halfWidth; x++) {
+    fx = 0;
+    zero_v4(curColor);
+    zero_v4(curColor2);
+
+    for (i = x - halfWidth; i < x + halfWidth; i++) {
+      if ((i >= 0) && (i < width)) {
+        index = (i + y * width) * 4;
+        madd_v4_v4fl(curColor, map + index, filter[fx]);
+
+        index = (width - 1 - i + y * width) * 4;
+        madd_v4_v4fl(curColor2, map + index, filter[fx]);
+      }
+      fx++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+
+    index = (width - 1 - x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor2);
+  }
+
+  /* Do the main body */
+  for (x = halfWidth; x < width - halfWidth; x++) {
+    fx = 0;
+    zero_v4(curColor);
+    for (i = x - halfWidth; i < x + halfWidth; i++) {
+      index = (i + y * width) * 4;
+      madd_v4_v4fl(curColor, map + index, filter[fx]);
+      fx++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+  }
+}
+
+static void glow_blur_column_fn(void *__restrict userdata,
+                                const int x,
+                                const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const GlowBlurData *data = (const GlowBlurData *)userdata;
+  const float *map = data->map;
+  float *temp = data->temp;
+  const float *filter = data->filter;
+  const int width = data->width;
+  const int height = data->height;
+  const int halfWidth = data->halfWidth;
+  int y, i, fy, index;
+  float curColor[4], curColor2[4];
+
+  /* Do the top & bottom strips */
+  for (y = 0; y < halfWidth; y++) {
+    fy = 0;
+    zero_v4(curColor);
+    zero_v4(curColor2);
+    for (i = y - halfWidth; i < y + halfWidth; i++) {
+      if ((i >= 0) && (i < height)) {
+        /* Bottom */
+        index = (x + i * width) * 4;
+        madd_v4_v4fl(curColor, map + index, filter[fy]);
+
+        /* Top */
+        index = (x + (height - 1 - i) * width) * 4;
+        madd_v4_v4fl(curColor2, map + index, filter[fy]);
+      }
+      fy++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+
+    index = (x + (height - 1 - y) * width) * 4;
+    copy_v4_v4(temp + index, curColor2);
+  }
+
+  /* Do the main body */
+  for (y = halfWidth; y < height - halfWidth; y++) {
+    fy = 0;
+    zero_v4(curColor);
+    for (i = y - halfWidth; i < y + halfWidth; i++) {
+      index = (x + i * width) * 4;
+      madd_v4_v4fl(curColor, map + index, filter[fy]);
+      fy++;
+    }
+    index = (x + y * width) * 4;
+    copy_v4_v4(temp + index, curColor);
+  }
+}
+
 static void RVBlurBitmap2_float(float *map, int width, int height, float blur, int quality)
 {
   /* Much better than the previous blur!
@@ -1974,11 +2106,10 @@ static void RVBlurBitmap2_float(float *map, int width, int height, float blur, i
    * Watch out though, it tends to misbehave with large blur values on
    * a small bitmap. Avoid! */
 
-  float *temp = NULL, *swap;
+  float *temp = NULL;
   float *filter = NULL;
-  int x, y, i, fx, fy;
-  int index, ix, halfWidth;
-  float fval, k, curColor[4], curColor2[4], weight = 0;
+  int ix, halfWidth;
+  float fval, k, weight = 0;
 
   /* If we're not really blurring, bail out */
   if (blur <= 0) {
@@ -2023,93 +2154,19 @@ static void RVBlurBitmap2_float(float *map, int width, int height, float blur, i
     filter[ix] /= fval;
   }
 
-  /* Blur the rows */
-  for (y = 0; y < height; y++) {
-    /* Do the left & right strips */
-    for (x = 0; x < halfWidth; x++) {
-      fx = 0;
-      zero_v4(curColor);
-      zero_v4(curColor2);
-
-      for (i = x - halfWidth; i < x + halfWidth; i++) {
-        if ((i >= 0) && (i < width)) {
-          index = (i + y * width) * 4;
-          madd_v4_v4fl(curColor, map + index, filter[fx]);
-
-          index = (width - 1 - i + y * width) * 4;
-          madd_v4_v4fl(curColor2, map + index, filter[fx]);
-        }
-        fx++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-
-      index = (width - 1 - x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor2);
-    }
-
-    /* Do the main body */
-    for (x = halfWidth; x < width - halfWidth; x++) {
-      fx = 0;
-      zero_v4(curColor);
-      for (i = x - halfWidth; i < x + halfWidth; i++) {
-        index = (i + y * width) * 4;
-        madd_v4_v4fl(curColor, map + index, filter[fx]);
-        fx++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-    }
-  }
-
-  /* Swap buffers */
-  swap = temp;
-  temp = map;
-  map = swap;
-
-  /* Blur the columns */
-  for (x = 0; x < width; x++) {
-    /* Do the top & bottom strips */
-    for (y = 0; y < halfWidth; y++) {
-      fy = 0;
-      zero_v4(curColor);
-      zero_v4(curColor2);
-      for (i = y - halfWidth; i < y + halfWidth; i++) {
-        if ((i >= 0) && (i < height)) {
-          /* Bottom */
-          index = (x + i * width) * 4;
-          madd_v4_v4fl(curColor, map + index, filter[fy]);
-
-          /* Top */
-          index = (x + (height - 1 - i) * width) * 4;
-          madd_v4_v4fl(curColor2, map + index, filter[fy]);
-        }
-        fy++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
+  /* Every row and column is blurred independently, so they are distributed over threads. */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 16;
 
-      index = (x + (height - 1 - y) * width) * 4;
-      copy_v4_v4(temp + index, curColor2);
-    }
+  /* Blur the rows from the map into the temp buffer. */
+  GlowBlurData data = {map, temp, filter, width, height, halfWidth};
+  BLI_task_parallel_range(0, height, &data, glow_blur_row_fn, &settings);
 
-    /* Do the main body */
-    for (y = halfWidth; y < height - halfWidth; y++) {
-      fy = 0;
-      zero_v4(curColor);
-      for (i = y - halfWidth; i < y + halfWidth; i++) {
-        index = (x + i * width) * 4;
-        madd_v4_v4fl(curColor, map + index, filter[fy]);
-        fy++;
-      }
-      index = (x + y * width) * 4;
-      copy_v4_v4(temp + index, curColor);
-    }
-  }
-
-  /* Swap buffers */
-  swap = temp;
-  temp = map; /* map = swap; */ /* UNUSED */
+  /* Blur the columns from the temp buffer back into the map. */
+  data.map = temp;
+  data.temp = map;
+  BLI_task_parallel_range(0, width, &data, glow_blur_column_fn, &settings);
 
   /* Tidy up. */
   MEM_freeN(filter);
@@ -3602,13 +3659,14 @@ static struct SeqEffectHandle get_sequence_effect_impl(int seq_type)
       rval.execute_slice = do_alphaunder_effect;
       break;
     case SEQ_TYPE_WIPE:
+      rval.multithreaded = true;
       rval.init = init_wipe_effect;
       rval.num_inputs = num_inputs_wipe;
       rval.free = free_wipe_effect;
       rval.copy = copy_wipe_effect;
       rval.early_out = early_out_fade;
       rval.get_default_fac = get_default_fac_fade;
-      rval.execute = do_wipe_effect;
+      rval.execute_slice = do_wipe_effect;
       break;
     case SEQ_TYPE_GLOW:
       rval.init = init_glow_effect;
@@ -67,6 +67,11 @@
  * entries one by one in reverse order to their creation.
  *
  * User can exclude caching of some images. Such entries will have is_temp_cache set.
+ *
+ * Locking: Lookups only take a read lock, so playback and prefetch threads can look up images at
+ * the same time. Adding and removing entries, as well as recycling, take the write lock. The key
+ * hash is computed once when a key is populated, so lookups, comparisons and growing the hash
+ * don't have to hash the render data again.
  */
 
 #define THUMB_CACHE_LIMIT 5000
@@ -74,7 +79,7 @@
 typedef struct SeqCache {
   Main *bmain;
   struct GHash *hash;
-  ThreadMutex iterator_mutex;
+  ThreadRWMutex iterator_mutex;
   struct BLI_mempool *keys_pool;
   struct BLI_mempool *items_pool;
   struct SeqCacheKey *last_key;
@@ -112,9 +117,8 @@ static uint seq_hash_render_data(const SeqRenderData *a)
   return rval;
 }
 
-static uint seq_cache_hashhash(const void *key_)
+static uint seq_cache_key_hash(const SeqCacheKey *key)
 {
-  const SeqCacheKey *key = key_;
   uint rval = seq_hash_render_data(&key->context);
 
   rval ^= *(const uint *)&key->frame_index;
@@ -124,13 +128,19 @@ static uint seq_cache_hashhash(const void *key_)
   return rval;
 }
 
+static uint seq_cache_hashhash(const void *key_)
+{
+  const SeqCacheKey *key = key_;
+  return key->hash;
+}
+
 static bool seq_cache_hashcmp(const void *a_, const void *b_)
 {
   const SeqCacheKey *a = a_;
   const SeqCacheKey *b = b_;
 
-  return ((a->seq != b->seq) || (a->frame_index != b->frame_index) || (a->type != b->type) ||
-          seq_cmp_render_data(&a->context, &b->context));
+  return ((a->hash != b->hash) || (a->seq != b->seq) || (a->frame_index != b->frame_index) ||
+          (a->type != b->type) || seq_cmp_render_data(&a->context, &b->context));
 }
 
 static float seq_cache_timeline_frame_to_frame_index(Scene *scene,
@@ -167,7 +177,17 @@ static void seq_cache_lock(Scene *scene)
   SeqCache *cache = seq_cache_get_from_scene(scene);
 
   if (cache) {
-    BLI_mutex_lock(&cache->iterator_mutex);
+    BLI_rw_mutex_lock(&cache->iterator_mutex, THREAD_LOCK_WRITE);
+  }
+}
+
+/* Only for lookups, the hash and the keys must not be modified while holding the read lock. */
+static void seq_cache_lock_read(Scene *scene)
+{
+  SeqCache *cache = seq_cache_get_from_scene(scene);
+
+  if (cache) {
+    BLI_rw_mutex_lock(&cache->iterator_mutex, THREAD_LOCK_READ);
   }
 }
 
@@ -176,7 +196,7 @@ static void seq_cache_unlock(Scene *scene)
   SeqCache *cache = seq_cache_get_from_scene(scene);
 
   if (cache) {
-    BLI_mutex_unlock(&cache->iterator_mutex);
+    BLI_rw_mutex_unlock(&cache->iterator_mutex);
   }
 }
 
@@ -502,7 +522,7 @@ static void seq_cache_create(Main *bmain, Scene *scene)
     cache->last_key = NULL;
     cache->bmain = bmain;
     cache->thumbnail_count = 0;
-    BLI_mutex_init(&cache->iterator_mutex);
+    BLI_rw_mutex_init(&cache->iterator_mutex);
     scene->ed->cache = cache;
 
     if (scene->ed->disk_cache_timestamp == 0) {
@@ -529,6 +549,7 @@ static void seq_cache_populate_key(SeqCacheKey *key,
   key->link_next = NULL;
   key->is_temp_cache = true;
   key->task_id = context->task_id;
+  key->hash = seq_cache_key_hash(key);
 }
 
 static SeqCacheKey *seq_cache_allocate_key(SeqCache *cache,
@@ -583,7 +604,7 @@ void seq_cache_destruct(Scene *scene)
   BLI_ghash_free(cache->hash, seq_cache_keyfree, seq_cache_valfree);
   BLI_mempool_destroy(cache->keys_pool);
   BLI_mempool_destroy(cache->items_pool);
-  BLI_mutex_end(&cache->iterator_mutex);
+  BLI_rw_mutex_end(&cache->iterator_mutex);
 
   if (cache->disk_cache != NULL) {
     seq_disk_cache_free(cache->disk_cache);
@@ -748,7 +769,7 @@ struct ImBuf *seq_cache_get(const SeqRenderData *context,
     seq_cache_create(context->bmain, scene);
   }
 
-  seq_cache_lock(scene);
+  seq_cache_lock_read(scene);
   SeqCache *cache = seq_cache_get_from_scene(scene);
   ImBuf *ibuf = NULL;
   SeqCacheKey key;
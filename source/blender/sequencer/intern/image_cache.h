@@ -33,6 +33,8 @@ typedef struct SeqCacheKey {
   /* ID of task for assigning temp cache entries to particular task(thread, etc.) */
   eSeqTaskId task_id;
   int type;
+  /* Hash of all fields that identify the entry, computed once when the key is populated. */
+  uint hash;
 } SeqCacheKey;
 
 struct ImBuf *seq_cache_get(const struct SeqRenderData *context,
@@ -18,6 +18,9 @@
 #include "DNA_windowmanager_types.h"
 
 #include "BLI_listbase.h"
+#include "BLI_math_base.h"
+#include "BLI_system.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "IMB_imbuf.h"
@@ -40,6 +43,7 @@
 #include "SEQ_channels.h"
 #include "SEQ_iterator.h"
 #include "SEQ_prefetch.h"
+#include "SEQ_proxy.h"
 #include "SEQ_relations.h"
 #include "SEQ_render.h"
 #include "SEQ_sequencer.h"
@@ -48,6 +52,16 @@
 #include "prefetch.h"
 #include "render.h"
 
+/* Maximum number of frames of which images are read ahead in parallel. */
+#define PREFETCH_LOOKAHEAD_FRAMES_MAX 16
+
+/* Image of an upcoming frame that was read ahead, see #seq_prefetch_lookahead_read. */
+typedef struct PrefetchLookaheadImage {
+  struct Sequence *seq;
+  float timeline_frame;
+  struct ImBuf *ibuf;
+} PrefetchLookaheadImage;
+
 typedef struct PrefetchJob {
   struct PrefetchJob *next, *prev;
 
@@ -72,6 +86,10 @@ typedef struct PrefetchJob {
   float cfra;
   int num_frames_prefetched;
 
+  /* Images of upcoming frames, read ahead by multiple threads. */
+  PrefetchLookaheadImage *lookahead_images;
+  int lookahead_images_num;
+
   /* control */
   bool running;
   bool waiting;
@@ -446,6 +464,140 @@ static bool seq_prefetch_must_skip_frame(PrefetchJob *pfjob, ListBase *channels,
   return false;
 }
 
+static void seq_prefetch_lookahead_free(PrefetchJob *pfjob)
+{
+  for (int i = 0; i < pfjob->lookahead_images_num; i++) {
+    if (pfjob->lookahead_images[i].ibuf) {
+      IMB_freeImBuf(pfjob->lookahead_images[i].ibuf);
+    }
+  }
+  MEM_SAFE_FREE(pfjob->lookahead_images);
+  pfjob->lookahead_images_num = 0;
+}
+
+static bool seq_prefetch_lookahead_has_frame(PrefetchJob *pfjob, float timeline_frame)
+{
+  for (int i = 0; i < pfjob->lookahead_images_num; i++) {
+    if (pfjob->lookahead_images[i].timeline_frame >= timeline_frame) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* Image strips of the frame whose source images would be read when rendering it. */
+static int seq_prefetch_lookahead_strips_get(PrefetchJob *pfjob,
+                                             ListBase *channels,
+                                             ListBase *seqbase,
+                                             float timeline_frame,
+                                             Sequence **r_seq_arr)
+{
+  SeqRenderData *ctx = &pfjob->context_cpy;
+  const IMB_Proxy_Size proxy_size = SEQ_rendersize_to_proxysize(ctx->preview_render_size);
+  Sequence *seq_arr[MAXSEQ + 1];
+  const int count = seq_get_shown_sequences(
+      pfjob->scene_eval, channels, seqbase, timeline_frame, 0, seq_arr);
+
+  int strips_num = 0;
+  for (int i = count - 1; i >= 0; i--) {
+    Sequence *seq = seq_arr[i];
+    /* Proxies are not stored in cache, only read images that are. */
+    if (seq->type == SEQ_TYPE_IMAGE && !SEQ_can_use_proxy(ctx, seq, proxy_size)) {
+      ImBuf *ibuf = seq_cache_get(ctx, seq, timeline_frame, SEQ_CACHE_STORE_RAW);
+      if (ibuf) {
+        IMB_freeImBuf(ibuf);
+      }
+      else {
+        r_seq_arr[strips_num++] = seq;
+      }
+    }
+    /* Strips below an opaque strip that replaces everything are not rendered. */
+    if (seq->blend_mode == SEQ_BLEND_REPLACE && seq->blend_opacity == 100.0f) {
+      break;
+    }
+  }
+  return strips_num;
+}
+
+static void seq_prefetch_lookahead_read_fn(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PrefetchJob *pfjob = userdata;
+  PrefetchLookaheadImage *image = &pfjob->lookahead_images[i];
+  bool is_proxy_image = false;
+  image->ibuf = seq_render_strip_raw_uncached(
+      &pfjob->context_cpy, image->seq, image->timeline_frame, &is_proxy_image);
+  if (image->ibuf && is_proxy_image) {
+    IMB_freeImBuf(image->ibuf);
+    image->ibuf = NULL;
+  }
+}
+
+/**
+ * Rendering frames can't be done in parallel, because cache entries of a frame are linked in the
+ * order they are added. Reading the source images of image strips is independent of that, and
+ * usually the most expensive part of rendering such frames, so the images of the following frames
+ * are read ahead by multiple threads and added to the cache just before their frame is rendered.
+ */
+static void seq_prefetch_lookahead_read(PrefetchJob *pfjob, ListBase *channels, ListBase *seqbase)
+{
+  const float cfra = seq_prefetch_cfra(pfjob);
+  if (seq_prefetch_lookahead_has_frame(pfjob, cfra)) {
+    return;
+  }
+  seq_prefetch_lookahead_free(pfjob);
+
+  /* Animation is only evaluated for the frame that is rendered, so the strips that are shown in
+   * the following frames are not known when they are animated. */
+  if (pfjob->scene_eval->r.scemode & R_MULTIVIEW ||
+      BKE_animdata_from_id(&pfjob->scene_eval->id) != NULL) {
+    return;
+  }
+
+  const int frames_num = clamp_i(BLI_system_thread_count(), 1, PREFETCH_LOOKAHEAD_FRAMES_MAX);
+  if (frames_num < 2) {
+    return;
+  }
+
+  pfjob->lookahead_images = MEM_malloc_arrayN(
+      (size_t)frames_num * (MAXSEQ + 1), sizeof(PrefetchLookaheadImage), __func__);
+  for (int frame = 0; frame < frames_num && cfra + frame <= pfjob->scene->r.efra; frame++) {
+    Sequence *seq_arr[MAXSEQ + 1];
+    const int count = seq_prefetch_lookahead_strips_get(
+        pfjob, channels, seqbase, cfra + frame, seq_arr);
+    for (int i = 0; i < count; i++) {
+      PrefetchLookaheadImage *image = &pfjob->lookahead_images[pfjob->lookahead_images_num++];
+      image->seq = seq_arr[i];
+      image->timeline_frame = cfra + frame;
+      image->ibuf = NULL;
+    }
+  }
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(
+      0, pfjob->lookahead_images_num, pfjob, seq_prefetch_lookahead_read_fn, &settings);
+}
+
+/* Add the images that were read ahead for the frame to the cache, before it is rendered. */
+static void seq_prefetch_lookahead_cache_put(PrefetchJob *pfjob)
+{
+  const float cfra = seq_prefetch_cfra(pfjob);
+  for (int i = 0; i < pfjob->lookahead_images_num; i++) {
+    PrefetchLookaheadImage *image = &pfjob->lookahead_images[i];
+    if (image->ibuf == NULL || image->timeline_frame > cfra) {
+      continue;
+    }
+    if (image->timeline_frame == cfra) {
+      seq_cache_put(&pfjob->context_cpy, image->seq, cfra, SEQ_CACHE_STORE_RAW, image->ibuf);
+    }
+    IMB_freeImBuf(image->ibuf);
+    image->ibuf = NULL;
+  }
+}
+
 static bool seq_prefetch_need_suspend(PrefetchJob *pfjob)
 {
   return seq_prefetch_is_cache_full(pfjob->scene) || seq_prefetch_is_scrubbing(pfjob->bmain) ||
@@ -493,6 +645,9 @@ static void *seq_prefetch_frames(void *job)
       continue;
     }
 
+    seq_prefetch_lookahead_read(pfjob, channels, seqbase);
+    seq_prefetch_lookahead_cache_put(pfjob);
+
     ImBuf *ibuf = SEQ_render_give_ibuf(&pfjob->context_cpy, seq_prefetch_cfra(pfjob), 0);
     seq_cache_free_temp_cache(pfjob->scene, pfjob->context.task_id, seq_prefetch_cfra(pfjob));
     IMB_freeImBuf(ibuf);
@@ -515,6 +670,7 @@ static void *seq_prefetch_frames(void *job)
   }
 
   seq_cache_free_temp_cache(pfjob->scene, pfjob->context.task_id, seq_prefetch_cfra(pfjob));
+  seq_prefetch_lookahead_free(pfjob);
   pfjob->running = false;
   pfjob->scene_eval->ed->prefetch_job = NULL;
 
@@ -281,7 +281,7 @@ static void seq_proxy_build_frame(const SeqRenderData *context,
     ibuf = IMB_dupImBuf(ibuf_tmp);
     IMB_metadata_copy(ibuf, ibuf_tmp);
     IMB_freeImBuf(ibuf_tmp);
-    IMB_scalefastImBuf(ibuf, (short)rectx, (short)recty);
+    IMB_scaleImBuf_filtered(ibuf, (short)rectx, (short)recty, IMB_SCALE_FILTER_MITCHELL);
   }
   else {
     ibuf = ibuf_tmp;
@@ -546,6 +546,11 @@ void SEQ_proxy_rebuild(SeqIndexBuildContext *context, bool *stop, bool *do_updat
   }
 }
 
+bool SEQ_proxy_rebuild_can_run_in_parallel(const SeqIndexBuildContext *context)
+{
+  return context->seq->type == SEQ_TYPE_MOVIE && context->index_context != NULL;
+}
+
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop)
 {
   if (context->index_context) {
@@ -9,10 +9,16 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "atomic_ops.h"
+
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_math_base.h"
+#include "BLI_threads.h"
 #include "BLI_timecode.h"
 
+#include "PIL_time.h"
+
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
 
@@ -40,23 +46,134 @@ static void proxy_freejob(void *pjv)
   MEM_freeN(pj);
 }
 
+/* Movie proxy of one strip, built in its own thread. */
+typedef struct ProxyBuildItem {
+  struct SeqIndexBuildContext *context;
+  bool *stop;
+  bool do_update;
+  float progress;
+  int32_t is_done;
+} ProxyBuildItem;
+
+static void *proxy_build_movie_thread(void *item_v)
+{
+  ProxyBuildItem *item = item_v;
+  SEQ_proxy_rebuild(item->context, item->stop, &item->do_update, &item->progress);
+  atomic_store_int32(&item->is_done, 1);
+  return NULL;
+}
+
+/* Join the threads of finished items and update the progress of the job. Returns the number of
+ * items that are still being built. */
+static int proxy_build_movie_threads_update(ListBase *threads,
+                                            ProxyBuildItem *items,
+                                            int items_started,
+                                            float progress_done,
+                                            float progress_total,
+                                            bool *do_update,
+                                            float *progress)
+{
+  int running = 0;
+  float progress_sum = progress_done;
+  for (int i = 0; i < items_started; i++) {
+    if (items[i].context == NULL) {
+      progress_sum += 1.0f;
+      continue;
+    }
+    if (atomic_load_int32(&items[i].is_done)) {
+      BLI_threadpool_remove(threads, &items[i]);
+      items[i].context = NULL;
+      progress_sum += 1.0f;
+      continue;
+    }
+    progress_sum += items[i].progress;
+    running++;
+  }
+
+  *progress = progress_sum / progress_total;
+  *do_update = true;
+  return running;
+}
+
+/**
+ * Movie proxies are built with a separate decoder and encoders per strip, so multiple strips are
+ * built in parallel. Other proxies are rendered through the sequencer and built one at a time.
+ */
+static void proxy_build_movies(ListBase *movie_contexts,
+                               int contexts_num,
+                               bool *stop,
+                               bool *do_update,
+                               float *progress)
+{
+  const int items_num = BLI_listbase_count(movie_contexts);
+  if (items_num == 0) {
+    return;
+  }
+
+  ProxyBuildItem *items = MEM_calloc_arrayN(items_num, sizeof(ProxyBuildItem), __func__);
+  ListBase threads;
+  BLI_threadpool_init(
+      &threads, proxy_build_movie_thread, min_ii(BLI_system_thread_count(), items_num));
+
+  const float progress_done = contexts_num - items_num;
+  int items_started = 0;
+  LISTBASE_FOREACH (LinkData *, link, movie_contexts) {
+    while (BLI_available_threads(&threads) == 0) {
+      PIL_sleep_ms(50);
+      proxy_build_movie_threads_update(
+          &threads, items, items_started, progress_done, contexts_num, do_update, progress);
+    }
+    if (*stop) {
+      break;
+    }
+
+    ProxyBuildItem *item = &items[items_started++];
+    item->context = link->data;
+    item->stop = stop;
+    BLI_threadpool_insert(&threads, item);
+  }
+
+  while (proxy_build_movie_threads_update(
+      &threads, items, items_started, progress_done, contexts_num, do_update, progress)) {
+    PIL_sleep_ms(50);
+  }
+
+  BLI_threadpool_end(&threads);
+  MEM_freeN(items);
+}
+
 /* Only this runs inside thread. */
 static void proxy_startjob(void *pjv, bool *stop, bool *do_update, float *progress)
 {
   ProxyJob *pj = pjv;
   LinkData *link;
+  ListBase movie_contexts = {NULL, NULL};
+  const int contexts_num = BLI_listbase_count(&pj->queue);
 
   for (link = pj->queue.first; link; link = link->next) {
     struct SeqIndexBuildContext *context = link->data;
 
+    if (SEQ_proxy_rebuild_can_run_in_parallel(context)) {
+      BLI_addtail(&movie_contexts, BLI_genericNodeN(context));
+      continue;
+    }
+
     SEQ_proxy_rebuild(context, stop, do_update, progress);
 
     if (*stop) {
-      pj->stop = true;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
       break;
     }
   }
+
+  if (!*stop) {
+    proxy_build_movies(&movie_contexts, contexts_num, stop, do_update, progress);
+  }
+  BLI_freelistN(&movie_contexts);
+
+  if (*stop) {
+    pj->stop = true;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
+  }
 }
 
 static void proxy_endjob(void *pjv)
@@ -22,6 +22,7 @@
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
+#include "BLI_task.h"
 
 #include "BKE_anim_data.h"
 #include "BKE_animsys.h"
@@ -1725,6 +1726,17 @@ static ImBuf *do_render_strip_uncached(const SeqRenderData *context,
   return ibuf;
 }
 
+ImBuf *seq_render_strip_raw_uncached(const SeqRenderData *context,
+                                     Sequence *seq,
+                                     float timeline_frame,
+                                     bool *r_is_proxy_image)
+{
+  SeqRenderState state;
+  seq_render_state_init(&state);
+  *r_is_proxy_image = false;
+  return do_render_strip_uncached(context, &state, seq, timeline_frame, r_is_proxy_image);
+}
+
 ImBuf *seq_render_strip(const SeqRenderData *context,
                         SeqRenderState *state,
                         Sequence *seq,
@@ -1828,6 +1840,76 @@ static ImBuf *seq_render_strip_stack_apply_effect(
   return out;
 }
 
+/**
+ * Strips that only read their own data can be rendered at the same time as other strips. Scene
+ * strips and strips with masks from other strips or mask data-blocks are not thread safe.
+ */
+static bool seq_render_strip_is_thread_safe(const Sequence *seq)
+{
+  if (!ELEM(seq->type, SEQ_TYPE_IMAGE, SEQ_TYPE_MOVIE, SEQ_TYPE_COLOR)) {
+    return false;
+  }
+  LISTBASE_FOREACH (const SequenceModifierData *, smd, &seq->modifiers) {
+    if (smd->mask_sequence != NULL || smd->mask_id != NULL) {
+      return false;
+    }
+  }
+  return true;
+}
+
+typedef struct SeqRenderStripsData {
+  const SeqRenderData *context;
+  SeqRenderState *state;
+  float timeline_frame;
+  Sequence **seqs;
+  ImBuf ***r_ibufs;
+} SeqRenderStripsData;
+
+static void seq_render_strips_fn(void *__restrict userdata,
+                                 const int index,
+                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  SeqRenderStripsData *data = (SeqRenderStripsData *)userdata;
+  *data->r_ibufs[index] = seq_render_strip(
+      data->context, data->state, data->seqs[index], data->timeline_frame);
+}
+
+/**
+ * Render the images of the strips from `start` to `count` that are blended with the strips
+ * below them. Independent strips are rendered in parallel, images that are already rendered are
+ * kept, the others are rendered later on demand.
+ */
+static void seq_render_strip_stack_prefetch_strips(const SeqRenderData *context,
+                                                   SeqRenderState *state,
+                                                   Sequence **seq_arr,
+                                                   const int start,
+                                                   const int count,
+                                                   float timeline_frame,
+                                                   ImBuf **ibufs)
+{
+  Sequence *seqs[MAXSEQ + 1];
+  ImBuf **r_ibufs[MAXSEQ + 1];
+  int seqs_num = 0;
+  for (int i = start; i < count; i++) {
+    Sequence *seq = seq_arr[i];
+    if (ibufs[i] == NULL && seq_get_early_out_for_blend_mode(seq) == EARLY_DO_EFFECT &&
+        seq_render_strip_is_thread_safe(seq)) {
+      seqs[seqs_num] = seq;
+      r_ibufs[seqs_num] = &ibufs[i];
+      seqs_num++;
+    }
+  }
+  if (seqs_num < 2) {
+    return;
+  }
+
+  SeqRenderStripsData data = {context, state, timeline_frame, seqs, r_ibufs};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, seqs_num, &data, seq_render_strips_fn, &settings);
+}
+
 static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      SeqRenderState *state,
                                      ListBase *channels,
@@ -1836,6 +1918,8 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
                                      int chanshown)
 {
   Sequence *seq_arr[MAXSEQ + 1];
+  /* Images of strips that were rendered ahead of blending them. */
+  ImBuf *ibufs[MAXSEQ + 1] = {NULL};
   int count;
   int i;
   ImBuf *out = NULL;
@@ -1866,21 +1950,26 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
     /* Early out for alpha over. It requires image to be rendered, so it can't use
      * `seq_get_early_out_for_blend_mode`. */
     if (out == NULL && seq->blend_mode == SEQ_TYPE_ALPHAOVER && seq->blend_opacity == 100.0f) {
-      ImBuf *test = seq_render_strip(context, state, seq, timeline_frame);
-      if (ELEM(test->planes, R_IMF_PLANES_BW, R_IMF_PLANES_RGB)) {
+      /* Keep the image for blending, so it is not rendered again when the cache is disabled. */
+      ibufs[i] = seq_render_strip(context, state, seq, timeline_frame);
+      if (ELEM(ibufs[i]->planes, R_IMF_PLANES_BW, R_IMF_PLANES_RGB)) {
         early_out = EARLY_USE_INPUT_2;
       }
       else {
         early_out = EARLY_DO_EFFECT;
       }
-      /* Free the image. It is stored in cache, so this doesn't affect performance. */
-      IMB_freeImBuf(test);
     }
 
     switch (early_out) {
       case EARLY_NO_INPUT:
       case EARLY_USE_INPUT_2:
-        out = seq_render_strip(context, state, seq, timeline_frame);
+        if (ibufs[i] != NULL) {
+          out = ibufs[i];
+          ibufs[i] = NULL;
+        }
+        else {
+          out = seq_render_strip(context, state, seq, timeline_frame);
+        }
         break;
       case EARLY_USE_INPUT_1:
         if (i == 0) {
@@ -1890,7 +1979,9 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
       case EARLY_DO_EFFECT:
         if (i == 0) {
           ImBuf *ibuf1 = IMB_allocImBuf(context->rectx, context->recty, 32, IB_rect);
-          ImBuf *ibuf2 = seq_render_strip(context, state, seq, timeline_frame);
+          ImBuf *ibuf2 = ibufs[i] ? ibufs[i] :
+                                    seq_render_strip(context, state, seq, timeline_frame);
+          ibufs[i] = NULL;
 
           out = seq_render_strip_stack_apply_effect(context, seq, timeline_frame, ibuf1, ibuf2);
 
@@ -1908,12 +1999,17 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
   }
 
   i++;
+  /* Blending has to happen from the bottom to the top, but the images of the strips do not depend
+   * on each other. */
+  seq_render_strip_stack_prefetch_strips(context, state, seq_arr, i, count, timeline_frame, ibufs);
+
   for (; i < count; i++) {
     Sequence *seq = seq_arr[i];
 
     if (seq_get_early_out_for_blend_mode(seq) == EARLY_DO_EFFECT) {
       ImBuf *ibuf1 = out;
-      ImBuf *ibuf2 = seq_render_strip(context, state, seq, timeline_frame);
+      ImBuf *ibuf2 = ibufs[i] ? ibufs[i] : seq_render_strip(context, state, seq, timeline_frame);
+      ibufs[i] = NULL;
 
       out = seq_render_strip_stack_apply_effect(context, seq, timeline_frame, ibuf1, ibuf2);
 
@@ -1924,6 +2020,11 @@ static ImBuf *seq_render_strip_stack(const SeqRenderData *context,
     seq_cache_put(context, seq_arr[i], timeline_frame, SEQ_CACHE_STORE_COMPOSITE, out);
   }
 
+  /* Images that were rendered ahead, but turned out not to be needed. */
+  for (i = 0; i < count; i++) {
+    IMB_freeImBuf(ibufs[i]);
+  }
+
   return out;
 }
 
@@ -2007,6 +2108,102 @@ ImBuf *SEQ_render_give_ibuf_direct(const SeqRenderData *context,
   return ibuf;
 }
 
+static bool seq_render_strip_is_gpu_composite_compatible(const Sequence *seq)
+{
+  if (!ELEM(seq->type, SEQ_TYPE_IMAGE, SEQ_TYPE_MOVIE)) {
+    return false;
+  }
+  if (!ELEM(seq->blend_mode, SEQ_BLEND_REPLACE, SEQ_TYPE_ALPHAOVER)) {
+    return false;
+  }
+  if (seq->modifiers.first != NULL ||
+      (seq->flag & (SEQ_FILTERY | SEQ_FLIPX | SEQ_FLIPY | SEQ_MAKE_FLOAT)) != 0) {
+    return false;
+  }
+  return seq->mul == 1.0f && seq->sat == 1.0f;
+}
+
+int SEQ_render_gpu_composite_strips_get(const SeqRenderData *context,
+                                        float timeline_frame,
+                                        int chanshown,
+                                        Sequence **r_seq_arr)
+{
+  Scene *scene = context->scene;
+  Editing *ed = SEQ_editing_get(scene);
+  if (ed == NULL || (scene->r.scemode & R_MULTIVIEW) != 0) {
+    return 0;
+  }
+
+  ListBase *seqbasep = ed->seqbasep;
+  ListBase *channels = ed->displayed_channels;
+  if ((chanshown < 0) && !BLI_listbase_is_empty(&ed->metastack)) {
+    int count = BLI_listbase_count(&ed->metastack);
+    count = max_ii(count + chanshown, 0);
+    seqbasep = ((MetaStack *)BLI_findlink(&ed->metastack, count))->oldbasep;
+    channels = ((MetaStack *)BLI_findlink(&ed->metastack, count))->old_channels;
+  }
+
+  Sequence *seq_arr[MAXSEQ + 1];
+  const int count = seq_get_shown_sequences(
+      scene, channels, seqbasep, timeline_frame, chanshown, seq_arr);
+
+  /* Strips below a strip that replaces everything are not visible. */
+  int start = 0;
+  for (int i = count - 1; i >= 0; i--) {
+    if (!seq_render_strip_is_gpu_composite_compatible(seq_arr[i])) {
+      return 0;
+    }
+    if (seq_arr[i]->blend_mode == SEQ_BLEND_REPLACE) {
+      start = i;
+      break;
+    }
+  }
+
+  for (int i = start; i < count; i++) {
+    r_seq_arr[i - start] = seq_arr[i];
+  }
+  return count - start;
+}
+
+ImBuf *SEQ_render_give_ibuf_raw(const SeqRenderData *context,
+                                float timeline_frame,
+                                Sequence *seq)
+{
+  SeqRenderState state;
+  seq_render_state_init(&state);
+  bool is_proxy_image = false;
+  ImBuf *ibuf = NULL;
+
+  BLI_mutex_lock(&seq_render_mutex);
+
+  /* Proxies are not stored in cache. */
+  if (!SEQ_can_use_proxy(
+          context, seq, SEQ_rendersize_to_proxysize(context->preview_render_size))) {
+    ibuf = seq_cache_get(context, seq, timeline_frame, SEQ_CACHE_STORE_RAW);
+  }
+
+  if (ibuf == NULL) {
+    ibuf = do_render_strip_uncached(context, &state, seq, timeline_frame, &is_proxy_image);
+    if (ibuf != NULL && !is_proxy_image) {
+      seq_cache_put(context, seq, timeline_frame, SEQ_CACHE_STORE_RAW, ibuf);
+    }
+  }
+
+  BLI_mutex_unlock(&seq_render_mutex);
+
+  /* Byte images are only converted when they are blended, don't modify the cached image. */
+  if (ibuf != NULL && ibuf->rect_float == NULL &&
+      !STREQ(IMB_colormanagement_get_rect_colorspace(ibuf),
+             context->scene->sequencer_colorspace_settings.name)) {
+    ImBuf *ibuf_converted = IMB_dupImBuf(ibuf);
+    IMB_freeImBuf(ibuf);
+    seq_imbuf_to_sequencer_space(context->scene, ibuf_converted, true);
+    ibuf = ibuf_converted;
+  }
+
+  return ibuf;
+}
+
 float SEQ_render_thumbnail_first_frame_get(const Scene *scene,
                                            Sequence *seq,
                                            float frame_step,
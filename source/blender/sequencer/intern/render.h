@@ -54,6 +54,14 @@ struct ImBuf *seq_render_strip(const struct SeqRenderData *context,
                                struct SeqRenderState *state,
                                struct Sequence *seq,
                                float timeline_frame);
+/**
+ * Render the source image of the strip, without preprocessing and without using the cache. For
+ * image strips this only reads files, so it can be called from multiple threads at the same time.
+ */
+struct ImBuf *seq_render_strip_raw_uncached(const struct SeqRenderData *context,
+                                            struct Sequence *seq,
+                                            float timeline_frame,
+                                            bool *r_is_proxy_image);
 struct ImBuf *seq_render_mask(const struct SeqRenderData *context,
                               struct Mask *mask,
                               float frame_index,
@@ -15,6 +15,7 @@
 #include "DNA_mask_types.h"
 #include "DNA_scene_types.h"
 #include "DNA_sequence_types.h"
+#include "DNA_userdef_types.h"
 
 #include "BLI_blenlib.h"
 
@@ -216,6 +217,13 @@ void seq_open_anim_file(Scene *scene, Sequence *seq, bool openfile)
   Editing *ed = scene->ed;
   const bool is_multiview = (seq->flag & SEQ_USE_VIEWS) != 0 &&
                             (scene->r.scemode & R_MULTIVIEW) != 0;
+  int anim_flags = IB_rect;
+  if (seq->flag & SEQ_FILTERY) {
+    anim_flags |= IB_animdeinterlace;
+  }
+  if (U.video_flag & USER_VIDEO_HARDWARE_DECODE) {
+    anim_flags |= IB_animhwdecode;
+  }
 
   if ((seq->anims.first != NULL) && (((StripAnim *)seq->anims.first)->anim != NULL) && !openfile) {
     return;
@@ -267,14 +275,13 @@ void seq_open_anim_file(Scene *scene, Sequence *seq, bool openfile)
 
         if (openfile) {
           sanim->anim = openanim(str,
-                                 IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                 anim_flags,
                                  seq->streamindex,
                                  seq->strip->colorspace_settings.name);
         }
         else {
           sanim->anim = openanim_noload(str,
-                                        IB_rect |
-                                            ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                        anim_flags,
                                         seq->streamindex,
                                         seq->strip->colorspace_settings.name);
         }
@@ -286,14 +293,13 @@ void seq_open_anim_file(Scene *scene, Sequence *seq, bool openfile)
         else {
           if (openfile) {
             sanim->anim = openanim(name,
-                                   IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                   anim_flags,
                                    seq->streamindex,
                                    seq->strip->colorspace_settings.name);
           }
           else {
             sanim->anim = openanim_noload(name,
-                                          IB_rect |
-                                              ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                          anim_flags,
                                           seq->streamindex,
                                           seq->strip->colorspace_settings.name);
           }
@@ -318,13 +324,13 @@ void seq_open_anim_file(Scene *scene, Sequence *seq, bool openfile)
 
     if (openfile) {
       sanim->anim = openanim(name,
-                             IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                             anim_flags,
                              seq->streamindex,
                              seq->strip->colorspace_settings.name);
     }
     else {
       sanim->anim = openanim_noload(name,
-                                    IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                    anim_flags,
                                     seq->streamindex,
                                     seq->strip->colorspace_settings.name);
     }
@@ -18,6 +18,7 @@
 #  include "DNA_texture_types.h"
 
 #  include "BLI_math.h"
+#  include "BLI_task.h"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.h"
@@ -614,6 +615,109 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   del_lfvector(temp);
 }
 
+/**
+ * Row-wise access to the blocks of a big matrix, to multiply it with a long vector in parallel
+ * without write conflicts. Every off-diagonal block contributes to its own row as well as
+ * (transposed) to the row of its column.
+ */
+typedef struct BigMatrixRows {
+  /** Start of the blocks of every row in #blocks, the last element is the total. */
+  uint *offsets;
+  /** Block index times two, the lowest bit is set when the block is used transposed. */
+  uint *blocks;
+} BigMatrixRows;
+
+static void bfmatrix_rows_create(BigMatrixRows *rows, const fmatrix3x3 *matrix)
+{
+  const uint vcount = matrix[0].vcount;
+  const uint tot = matrix[0].vcount + matrix[0].scount;
+
+  rows->offsets = MEM_callocN(sizeof(uint) * (vcount + 1), __func__);
+  rows->blocks = MEM_mallocN(sizeof(uint) * (2 * matrix[0].scount + 1), __func__);
+
+  for (uint i = vcount; i < tot; i++) {
+    rows->offsets[matrix[i].r]++;
+    rows->offsets[matrix[i].c]++;
+  }
+  uint offset = 0;
+  for (uint v = 0; v <= vcount; v++) {
+    const uint count = rows->offsets[v];
+    rows->offsets[v] = offset;
+    offset += count;
+  }
+
+  /* Use the offsets as fill positions, they are shifted back afterwards. */
+  for (uint i = vcount; i < tot; i++) {
+    rows->blocks[rows->offsets[matrix[i].r]++] = i << 1;
+    rows->blocks[rows->offsets[matrix[i].c]++] = (i << 1) | 1;
+  }
+  for (uint v = vcount; v > 0; v--) {
+    rows->offsets[v] = rows->offsets[v - 1];
+  }
+  rows->offsets[0] = 0;
+}
+
+static void bfmatrix_rows_free(BigMatrixRows *rows)
+{
+  MEM_freeN(rows->offsets);
+  MEM_freeN(rows->blocks);
+}
+
+typedef struct BigMatrixRowsMulData {
+  float (*to)[3];
+  const fmatrix3x3 *from;
+  const BigMatrixRows *rows;
+  const lfVector *fLongVector;
+} BigMatrixRowsMulData;
+
+static void mul_bfmatrix_rows_lfvector_cb(void *__restrict userdata,
+                                          const int v,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const BigMatrixRowsMulData *data = userdata;
+  const fmatrix3x3 *from = data->from;
+  const lfVector *fLongVector = data->fLongVector;
+  float *to = data->to[v];
+
+  /* Diagonal block. */
+  zero_v3(to);
+  muladd_fmatrix_fvector(to, from[v].m, fLongVector[v]);
+
+  for (uint k = data->rows->offsets[v]; k < data->rows->offsets[v + 1]; k++) {
+    const uint block = data->rows->blocks[k];
+    const fmatrix3x3 *m = &from[block >> 1];
+    if (block & 1) {
+      /* This is the lower triangle of the sparse matrix,
+       * therefore multiplication occurs with transposed submatrices. */
+      muladd_fmatrixT_fvector(to, m->m, fLongVector[m->r]);
+    }
+    else {
+      muladd_fmatrix_fvector(to, m->m, fLongVector[m->c]);
+    }
+  }
+}
+
+/**
+ * Same as #mul_bfmatrix_lfvector, but runs in parallel over the rows of the matrix.
+ * The result doesn't depend on the number of threads.
+ */
+static void mul_bfmatrix_rows_lfvector(float (*to)[3],
+                                       const fmatrix3x3 *from,
+                                       const BigMatrixRows *rows,
+                                       const lfVector *fLongVector)
+{
+  BigMatrixRowsMulData data = {
+      .to = to,
+      .from = from,
+      .rows = rows,
+      .fLongVector = fLongVector,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 512;
+  BLI_task_parallel_range(0, from[0].vcount, &data, mul_bfmatrix_rows_lfvector_cb, &settings);
+}
+
 /* SPARSE SYMMETRIC sub big matrix with big matrix. */
 /* A -= B * float + C * float --> for big matrix */
 /* VERIFIED */
@@ -840,6 +944,10 @@ static int cg_filtered(lfVector *ldV,
   lfVector *s = create_lfvector(numverts);
   float bnorm2, delta_new, delta_old, delta_target, alpha;
 
+  /* The matrix is multiplied in every iteration, prepare it for parallel multiplication. */
+  BigMatrixRows rows;
+  bfmatrix_rows_create(&rows, lA);
+
   cp_lfvector(ldV, z, numverts);
 
   /* d0 = filter(B)^T * P * filter(B) */
@@ -849,7 +957,7 @@ static int cg_filtered(lfVector *ldV,
   delta_target = conjgrad_epsilon * conjgrad_epsilon * bnorm2;
 
   /* r = filter(B - A * dV) */
-  mul_bfmatrix_lfvector(AdV, lA, ldV);
+  mul_bfmatrix_rows_lfvector(AdV, lA, &rows, ldV);
   sub_lfvector_lfvector(r, lB, AdV, numverts);
   filter(r, S);
 
@@ -872,7 +980,7 @@ static int cg_filtered(lfVector *ldV,
 #  endif
 
   while (delta_new > delta_target && conjgrad_loopcount < conjgrad_looplimit) {
-    mul_bfmatrix_lfvector(q, lA, c);
+    mul_bfmatrix_rows_lfvector(q, lA, &rows, c);
     filter(q, S);
 
     alpha = delta_new / dot_lfvector(c, q, numverts);
@@ -898,6 +1006,8 @@ static int cg_filtered(lfVector *ldV,
   printf("========\n");
 #  endif
 
+  bfmatrix_rows_free(&rows);
+
   del_lfvector(fB);
   del_lfvector(AdV);
   del_lfvector(r);
@@ -43,11 +43,13 @@
 #include "BKE_global.h"
 #include "BKE_icons.h"
 #include "BKE_image.h"
+#include "BKE_image_read_ahead.h"
 #include "BKE_keyconfig.h"
 #include "BKE_lib_remap.h"
 #include "BKE_main.h"
 #include "BKE_mball_tessellate.h"
 #include "BKE_node.h"
+#include "BKE_pointcache.h"
 #include "BKE_report.h"
 #include "BKE_scene.h"
 #include "BKE_screen.h"
@@ -115,6 +117,8 @@
 #include "GPU_init_exit.h"
 #include "GPU_material.h"
 
+#include "PIL_time.h"
+
 #include "COM_compositor.h"
 
 #include "DEG_depsgraph.h"
@@ -209,8 +213,23 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
   }
 }
 
+/**
+ * Print the time spent on a step of #WM_init, enabled with `--debug-startup-time`.
+ */
+static void wm_init_time_print(const char *step, double *time_step)
+{
+  if ((G.debug & G_DEBUG_STARTUP_TIME) == 0) {
+    return;
+  }
+  const double time = PIL_check_seconds_timer();
+  printf("Startup: %s in %.4f seconds\n", step, time - *time_step);
+  *time_step = time;
+}
+
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  const double time_start = PIL_check_seconds_timer();
+  double time_step = time_start;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
@@ -267,6 +286,8 @@ void WM_init(bContext *C, int argc, const char **argv)
    * otherwise the versioning cannot find the default studio-light. */
   BKE_studiolight_init();
 
+  wm_init_time_print("sub-systems initialized", &time_step);
+
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
   /**
@@ -300,6 +321,8 @@ void WM_init(bContext *C, int argc, const char **argv)
                       NULL,
                       &params_file_read_post);
 
+  wm_init_time_print("startup file and preferences read", &time_step);
+
   /* NOTE: leave `G_MAIN->filepath` set to an empty string since this
    * matches behavior after loading a new file. */
   BLI_assert(G_MAIN->filepath[0] == '\0');
@@ -334,9 +357,14 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_spacemacros_init();
 
+  wm_init_time_print("GPU and interface initialized", &time_step);
+
 #ifdef WITH_PYTHON
+  /* Also loads the scripts and enables the add-ons. */
   BPY_python_start(C, argc, argv);
+  wm_init_time_print("Python started", &time_step);
   BPY_python_reset(C);
+  wm_init_time_print("Python reset", &time_step);
 #else
   UNUSED_VARS(argc, argv);
 #endif
@@ -358,6 +386,11 @@ void WM_init(bContext *C, int argc, const char **argv)
   BLI_strncpy(G.lib, BKE_main_blendfile_path_from_global(), sizeof(G.lib));
 
   wm_homefile_read_post(C, params_file_read_post);
+
+  wm_init_time_print("startup file loaded", &time_step);
+  if (G.debug & G_DEBUG_STARTUP_TIME) {
+    printf("Startup: total %.4f seconds\n", PIL_check_seconds_timer() - time_start);
+  }
 }
 
 void WM_init_splash(bContext *C)
@@ -546,6 +579,9 @@ void WM_exit_ex(bContext *C, const bool do_python)
 
   BKE_subdiv_exit();
 
+  BKE_image_read_ahead_exit();
+  BKE_ptcache_disk_writes_exit();
+
   if (opengl_is_init) {
     BKE_image_free_unused_gpu_textures();
   }
@@ -626,6 +662,8 @@ void WM_exit_ex(bContext *C, const bool do_python)
 
   DNA_sdna_current_free();
 
+  BLO_memfile_free_deferred_wait();
+
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
@@ -14,6 +14,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -375,11 +376,21 @@ void WM_jobs_callbacks_ex(wmJob *wm_job,
   wm_job->canceled = canceled;
 }
 
+static void do_job_start(void *job_v)
+{
+  wmJob *wm_job = job_v;
+  wm_job->startjob(wm_job->run_customdata, &wm_job->stop, &wm_job->do_update, &wm_job->progress);
+}
+
 static void *do_job_thread(void *job_v)
 {
   wmJob *wm_job = job_v;
 
-  wm_job->startjob(wm_job->run_customdata, &wm_job->stop, &wm_job->do_update, &wm_job->progress);
+  /* Priority jobs (rendering, baking) are what the user is waiting for and may use all threads.
+   * Other jobs run in the background arena, so they can't starve interactive evaluation. */
+  const eTaskArena arena = (wm_job->flag & WM_JOB_PRIORITY) ? TASK_ARENA_INTERACTIVE :
+                                                               TASK_ARENA_BACKGROUND;
+  BLI_task_arena_execute(arena, do_job_start, wm_job);
   wm_job->ready = true;
 
   return NULL;
@@ -0,0 +1,53 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    # Scenes without Render Layers nodes are not rendered, so only the node tree is executed.
+    scene.render.use_compositing = True
+    scene.render.use_sequencer = False
+
+    # Execute once first, to load the images used by the nodes.
+    bpy.ops.render.render()
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_executions = 0
+
+    while elapsed_time < 10.0:
+        bpy.ops.render.render()
+
+        num_executions += 1
+        elapsed_time = time.time() - start_time
+
+    time_per_execution = elapsed_time / num_executions
+
+    result = {'time': time_per_execution}
+    return result
+
+
+class CompositorTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "compositor"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('compositor/*')
+    return [CompositorTest(filepath) for filepath in filepaths]
@@ -0,0 +1,55 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Evaluate objects once first, so only the relations are built in the measured updates.
+    bpy.context.view_layer.update()
+
+    # Linking and unlinking an object tags the relations of the dependency graph for a rebuild.
+    ob = bpy.data.objects.new("benchmark_empty", None)
+    collection = bpy.context.scene.collection
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_rebuilds = 0
+
+    while elapsed_time < 10.0:
+        collection.objects.link(ob)
+        bpy.context.view_layer.update()
+        collection.objects.unlink(ob)
+        bpy.context.view_layer.update()
+
+        num_rebuilds += 2
+        elapsed_time = time.time() - start_time
+
+    time_per_rebuild = elapsed_time / num_rebuilds
+
+    result = {'time': time_per_rebuild}
+    return result
+
+
+class DepsgraphTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "depsgraph"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('depsgraph/*')
+    return [DepsgraphTest(filepath) for filepath in filepaths]
@@ -0,0 +1,60 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Use the active mesh, or the first mesh in the scene.
+    ob = bpy.context.view_layer.objects.active
+    if ob is None or ob.type != 'MESH':
+        ob = next((ob for ob in bpy.context.view_layer.objects if ob.type == 'MESH'), None)
+    if ob is None:
+        return None
+    bpy.context.view_layer.objects.active = ob
+
+    # Enter edit mode once first, to avoid measuring lazy evaluation of the mesh.
+    bpy.ops.object.mode_set(mode='EDIT')
+    bpy.ops.object.mode_set(mode='OBJECT')
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_toggles = 0
+
+    while elapsed_time < 10.0:
+        bpy.ops.object.mode_set(mode='EDIT')
+        bpy.ops.mesh.select_all(action='SELECT')
+        bpy.ops.mesh.normals_make_consistent()
+        bpy.ops.object.mode_set(mode='OBJECT')
+
+        num_toggles += 1
+        elapsed_time = time.time() - start_time
+
+    time_per_toggle = elapsed_time / num_toggles
+
+    result = {'time': time_per_toggle}
+    return result
+
+
+class EditMeshTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "edit_mesh"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('edit_mesh/*')
+    return [EditMeshTest(filepath) for filepath in filepaths]
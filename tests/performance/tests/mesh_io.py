@@ -0,0 +1,61 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    file_format = args['format']
+    export_op = getattr(bpy.ops.wm, file_format + '_export')
+    import_op = getattr(bpy.ops.wm, file_format + '_import')
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        filepath = os.path.join(tmpdir, 'benchmark.' + file_format)
+
+        # Evaluate objects once first, to avoid measuring the evaluation in the export.
+        bpy.context.view_layer.update()
+
+        start_time = time.time()
+        export_op(filepath=filepath)
+        export_time = time.time() - start_time
+
+        # Import into an empty file, so the time doesn't depend on the existing data.
+        bpy.ops.wm.read_homefile(use_empty=True)
+
+        start_time = time.time()
+        import_op(filepath=filepath)
+        import_time = time.time() - start_time
+
+    result = {'time': export_time + import_time,
+              'export_time': export_time,
+              'import_time': import_time}
+    return result
+
+
+class IOTest(api.Test):
+    def __init__(self, filepath, file_format):
+        self.filepath = filepath
+        self.file_format = file_format
+
+    def name(self):
+        return f'{self.filepath.stem}_{self.file_format}'
+
+    def category(self):
+        return "io"
+
+    def run(self, env, device_id):
+        args = {'format': self.file_format}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('io/*')
+    return [IOTest(filepath, file_format)
+            for filepath in filepaths
+            for file_format in ('obj', 'stl')]
@@ -0,0 +1,58 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Use the active mesh, or the first mesh in the scene.
+    ob = bpy.context.view_layer.objects.active
+    if ob is None or ob.type != 'MESH':
+        ob = next((ob for ob in bpy.context.view_layer.objects if ob.type == 'MESH'), None)
+    if ob is None:
+        return None
+    bpy.context.view_layer.objects.active = ob
+
+    # Evaluate objects once first, to avoid any possible lazy evaluation later.
+    bpy.context.view_layer.update()
+
+    # Entering sculpt mode builds the PBVH and the data needed by the brushes.
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_toggles = 0
+
+    while elapsed_time < 10.0:
+        bpy.ops.object.mode_set(mode='SCULPT')
+        bpy.ops.object.mode_set(mode='OBJECT')
+
+        num_toggles += 1
+        elapsed_time = time.time() - start_time
+
+    time_per_toggle = elapsed_time / num_toggles
+
+    result = {'time': time_per_toggle}
+    return result
+
+
+class SculptTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "sculpt"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('sculpt/*')
+    return [SculptTest(filepath) for filepath in filepaths]
@@ -0,0 +1,53 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    scene = bpy.context.scene
+    # Only measure the sequencer, the strips are rendered without the 3D scene.
+    scene.render.use_sequencer = True
+    scene.render.use_compositing = False
+
+    # Render the first frame once, to load the media files.
+    scene.frame_set(scene.frame_start)
+    bpy.ops.render.render()
+
+    start_time = time.time()
+    num_frames = 0
+
+    for i in range(scene.frame_start, scene.frame_end + 1):
+        scene.frame_set(i)
+        bpy.ops.render.render()
+        num_frames += 1
+
+    elapsed_time = time.time() - start_time
+    time_per_frame = elapsed_time / num_frames
+
+    result = {'time': time_per_frame}
+    return result
+
+
+class SequencerTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "sequencer"
+
+    def run(self, env, device_id):
+        args = {}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('sequencer/*')
+    return [SequencerTest(filepath) for filepath in filepaths]